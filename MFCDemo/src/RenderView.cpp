@@ -50,15 +50,12 @@ std::optional<BoundsResult> ComputeSceneBounds(const SR::GPUScene& scene) {
     Vec3 maxBounds{-kInf, -kInf, -kInf};
     bool hasPoint = false;
 
-    for (const GPUSceneDrawItem& item : scene.GetItems()) {
-        if (!item.mesh) {
-            continue;
-        }
-
-        const std::vector<Vertex>& vertices = item.mesh->GetVertices();
-        for (const Vertex& v : vertices) {
-            Vec4 p{v.position.x, v.position.y, v.position.z, 1.0};
-            Vec4 world = item.modelMatrix.Multiply(p);
+    auto accumulateMesh = [&](const Mesh& mesh, const Mat4& modelMatrix) {
+        const size_t vertexCount = mesh.GetVertexCount();
+        for (size_t i = 0; i < vertexCount; ++i) {
+            Vec3 position = mesh.GetPosition(i);
+            Vec4 p{position.x, position.y, position.z, 1.0};
+            Vec4 world = modelMatrix.Multiply(p);
             double invW = (world.w != 0.0) ? (1.0 / world.w) : 1.0;
             Vec3 pos{world.x * invW, world.y * invW, world.z * invW};
 
@@ -70,6 +67,21 @@ std::optional<BoundsResult> ComputeSceneBounds(const SR::GPUScene& scene) {
             maxBounds.z = std::max(maxBounds.z, pos.z);
             hasPoint = true;
         }
+    };
+
+    for (const GPUSceneDrawItem& item : scene.GetItems()) {
+        if (!item.mesh) {
+            continue;
+        }
+        accumulateMesh(*item.mesh, item.modelMatrix);
+    }
+    for (const GPUSceneInstancedDrawItem& item : scene.GetInstancedItems()) {
+        if (!item.mesh) {
+            continue;
+        }
+        for (const InstanceTransform& instance : item.instances) {
+            accumulateMesh(*item.mesh, instance.modelMatrix);
+        }
     }
 
     if (!hasPoint) {
@@ -113,7 +125,7 @@ void CRenderView::Initialize(int width, int height) {
     GLTFAsset asset = loader.LoadGLB("example/2019_mazda_mx-5.glb");
     if (!asset.meshes.empty()) {
         m_gpuScene.Build(asset, -1);
-        m_hasGLB = !m_gpuScene.GetItems().empty();
+        m_hasGLB = !m_gpuScene.GetItems().empty() || !m_gpuScene.GetInstancedItems().empty();
         if (m_hasGLB) {
             // 如果成功加载了模型，则计算其包围盒并自动调整相机视角
             if (auto bounds = ComputeSceneBounds(m_gpuScene)) {
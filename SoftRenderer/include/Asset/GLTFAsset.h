@@ -21,6 +21,7 @@ struct GLTFAsset {
     std::vector<GLTFMesh>       meshes;              ///< 网格列表
     std::vector<GLTFNode>       nodes;               ///< 节点列表
     std::vector<GLTFScene>      scenes;              ///< 场景列表
+    std::vector<GLTFLight>      lights;              ///< KHR_lights_punctual 光源列表
     int         defaultSceneIndex = -1;              ///< 默认场景索引，-1 表示使用第一个
     std::string generator;                           ///< 生成该资产的工具名称
 };
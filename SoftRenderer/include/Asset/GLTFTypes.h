@@ -158,6 +158,7 @@ struct GLTFMesh {
 /// @brief glTF 场景节点，可持有网格、变换及子节点
 struct GLTFNode {
     int              meshIndex         = -1;  ///< 关联的网格索引，-1 表示无网格
+    int              lightIndex        = -1;  ///< 关联的 KHR_lights_punctual 光源索引，-1 表示无光源
     std::vector<int> children;                ///< 子节点索引列表
     double           translation[3]    = {0.0, 0.0, 0.0}; ///< 平移 (X, Y, Z)
     double           rotation[4]       = {0.0, 0.0, 0.0, 1.0}; ///< 旋转四元数 (X, Y, Z, W)
@@ -169,6 +170,31 @@ struct GLTFNode {
         0.0, 0.0, 1.0, 0.0,
         0.0, 0.0, 0.0, 1.0
     };
+    /// EXT_mesh_gpu_instancing 扩展
+    struct {
+        int  translationAccessor = -1;    ///< TRANSLATION 访问器索引 (VEC3)
+        int  rotationAccessor    = -1;    ///< ROTATION 访问器索引 (VEC4 四元数)
+        int  scaleAccessor       = -1;    ///< SCALE 访问器索引 (VEC3)
+        bool hasInstancing       = false; ///< 是否有实例化扩展
+    } instancing{};
+};
+
+/// @brief KHR_lights_punctual 光源类型
+enum class GLTFLightType : int {
+    Directional = 0, ///< 平行光（沿节点 -Z 方向）
+    Point       = 1, ///< 点光源
+    Spot        = 2  ///< 聚光灯（沿节点 -Z 方向）
+};
+
+/// @brief KHR_lights_punctual 光源定义（位置与方向由引用它的节点决定）
+struct GLTFLight {
+    std::string   name;                          ///< 光源名称
+    GLTFLightType type = GLTFLightType::Point;   ///< 光源类型
+    double        color[3] = {1.0, 1.0, 1.0};    ///< 线性 RGB 颜色
+    double        intensity = 1.0;               ///< 强度（平行光为 lux，点光/聚光为 candela）
+    double        range = 0.0;                   ///< 影响半径，0 表示未指定（无穷远）
+    double        innerConeAngle = 0.0;          ///< 聚光内锥角（弧度）
+    double        outerConeAngle = 0.7853981633974483; ///< 聚光外锥角（弧度，默认 π/4）
 };
 
 /// @brief glTF 场景，包含根节点列表
@@ -0,0 +1,285 @@
+#pragma once
+
+/**
+ * @file FrameArena.h
+ * @brief 帧级线性分配器：每线程一个 bump 区域 + 一个共享区域，帧末整体复位。
+ *
+ * 所有只在一帧内存活的渲染临时数据（三角形列表、Tile 分箱、直方图、裁剪结果等）从这里分配，
+ * 不再逐个 malloc/free，也不再依赖散落的 static / thread_local 缓冲。
+ * 区域内存按页直接向系统申请（可用时使用大页），跨帧保留；高水位持续低于容量一定比例后才收缩。
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace SR {
+
+/**
+ * @brief 帧级分配器配置
+ */
+struct FrameArenaOptions {
+    double shrinkHeadroom = 1.0;        ///< 容量超过 高水位 × (1 + headroom) 视为过剩
+    int shrinkDelayFrames = 60;         ///< 连续过剩多少帧后收缩（避免负载波动时反复映射）
+    bool useHugePages = true;           ///< 大块区域尝试使用大页（Linux THP / Windows Large Page）
+    size_t minRegionBytes = 256 * 1024; ///< 每个区域的最小保留容量
+};
+
+/**
+ * @brief 帧级分配器统计（EndFrame 时计算）
+ */
+struct FrameArenaStats {
+    size_t highWaterBytes = 0;       ///< 本帧所有区域高水位之和
+    size_t sharedHighWaterBytes = 0; ///< 共享区域高水位
+    size_t threadHighWaterBytes = 0; ///< 单个线程区域高水位的最大值
+    size_t reservedBytes = 0;        ///< 帧末保留的总容量
+    size_t hugePageBytes = 0;        ///< 其中以大页方式申请的容量
+    int regionCount = 0;             ///< 区域数（共享 + 线程）
+    int growCount = 0;               ///< 本帧溢出后合并扩容的区域数
+    int shrinkCount = 0;             ///< 本帧收缩的区域数
+};
+
+/// 区域内的分配位置（用于作用域回滚）
+struct ArenaMarker {
+    size_t block = 0;    ///< 当前块下标
+    size_t offset = 0;   ///< 块内偏移
+    size_t usedBase = 0; ///< 之前各块的总字节数（计算高水位用）
+};
+
+/**
+ * @brief 单个线性分配区域（同一时刻只能由一个线程使用）
+ *
+ * 由若干块组成：当前块用尽时切到下一块（或追加新块），帧末若使用了多块则合并为一块，
+ * 使稳态下每帧只有一块、分配只是指针加法。
+ */
+class alignas(64) ArenaRegion {
+public:
+    ArenaRegion() = default;
+    ~ArenaRegion();
+
+    ArenaRegion(const ArenaRegion&) = delete;
+    ArenaRegion& operator=(const ArenaRegion&) = delete;
+
+    /** @brief 分配 bytes 字节（align 须为 2 的幂），内容未初始化 */
+    void* Allocate(size_t bytes, size_t align = alignof(std::max_align_t));
+
+    /** @brief 分配 count 个未初始化的 T（64 字节对齐，T 须为平凡类型） */
+    template<typename T>
+    T* AllocateArray(size_t count) {
+        static_assert(std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>,
+                      "ArenaRegion 只存放平凡类型");
+        return static_cast<T*>(Allocate(count * sizeof(T), alignof(T) > 64 ? alignof(T) : 64));
+    }
+
+    /**
+     * @brief 原地扩展最近一次分配
+     * @return ptr 是区域顶端的分配且当前块剩余空间足够时返回 true
+     */
+    bool TryExtend(const void* ptr, size_t oldBytes, size_t newBytes);
+
+    /** @brief 当前分配位置 */
+    ArenaMarker Mark() const { return ArenaMarker{m_block, m_offset, m_usedBase}; }
+
+    /** @brief 回滚到 marker 之后的分配（marker 之后分配的指针全部失效） */
+    void Restore(const ArenaMarker& marker);
+
+    /**
+     * @brief 帧末复位：多块合并为一块，按高水位与配置决定是否收缩
+     * @return +1 表示合并扩容，-1 表示收缩，0 表示容量不变
+     */
+    int EndFrame(const FrameArenaOptions& options);
+
+    /** @brief 本帧高水位（字节） */
+    size_t GetHighWater() const { return m_peak; }
+    /** @brief 保留容量（字节） */
+    size_t GetReserved() const;
+    /** @brief 以大页方式申请的容量（字节） */
+    size_t GetHugePageBytes() const;
+
+    /** @brief 设置大页偏好（仅影响之后申请的块） */
+    void SetUseHugePages(bool enabled) { m_useHugePages = enabled; }
+
+private:
+    struct Block {
+        uint8_t* base = nullptr;
+        size_t size = 0;
+        bool huge = false;
+    };
+
+    void* AllocateSlow(size_t bytes, size_t align);
+    void ReleaseBlocks();
+    void ResetTo(size_t bytes);
+
+    std::vector<Block> m_blocks;
+    uint8_t* m_base = nullptr;  ///< 当前块起始地址（热路径缓存）
+    size_t m_size = 0;          ///< 当前块大小
+    size_t m_block = 0;         ///< 当前块下标
+    size_t m_offset = 0;        ///< 当前块已用字节
+    size_t m_usedBase = 0;      ///< 之前各块的总字节数
+    size_t m_peak = 0;          ///< 本帧高水位
+    size_t m_windowPeak = 0;    ///< 收缩观察窗口内的高水位
+    int m_surplusFrames = 0;    ///< 连续容量过剩的帧数
+    bool m_useHugePages = true;
+};
+
+/**
+ * @brief 帧级分配器：一个共享区域 + 每线程区域
+ *
+ * 共享区域供串行代码（或单个线程）分配跨阶段存活的数据；线程区域按 OpenMP 线程号索引，
+ * 并行区内各线程只访问自己的区域，无需同步。EnsureThreadRegions 须在并行区外调用。
+ */
+class FrameArena {
+public:
+    /**
+     * @brief 作用域回滚：析构时把所有区域恢复到构造时的位置
+     *
+     * 用于一帧内多次执行、结果不需要跨调用保留的阶段（如光栅化、每级阴影）。
+     */
+    class Scope {
+    public:
+        explicit Scope(FrameArena& arena);
+        ~Scope();
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        FrameArena& m_arena;
+        ArenaMarker m_shared;
+        ArenaMarker* m_threadMarks = nullptr; ///< 各线程区域位置（存放在共享区域中）
+        size_t m_threadCount = 0;
+    };
+
+    FrameArena();
+    explicit FrameArena(const FrameArenaOptions& options);
+    ~FrameArena();
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    /** @brief 更新配置（大页偏好只影响之后申请的块） */
+    void SetOptions(const FrameArenaOptions& options);
+    const FrameArenaOptions& GetOptions() const { return m_options; }
+
+    /** @brief 共享区域 */
+    ArenaRegion& Shared() { return *m_shared; }
+
+    /** @brief 确保至少有 count 个线程区域（并行区外调用） */
+    void EnsureThreadRegions(int count);
+
+    /** @brief 线程区域（tid 须小于 EnsureThreadRegions 的数量） */
+    ArenaRegion& ThreadRegion(int tid) { return *m_threads[static_cast<size_t>(tid)]; }
+
+    /** @brief 线程区域数 */
+    int GetThreadRegionCount() const { return static_cast<int>(m_threads.size()); }
+
+    /** @brief 帧末复位所有区域并统计高水位 / 收缩 */
+    void EndFrame();
+
+    /** @brief 最近一次 EndFrame 的统计 */
+    const FrameArenaStats& GetLastFrameStats() const { return m_lastStats; }
+
+private:
+    FrameArenaOptions m_options{};
+    std::unique_ptr<ArenaRegion> m_shared;
+    std::vector<std::unique_ptr<ArenaRegion>> m_threads;
+    FrameArenaStats m_lastStats{};
+};
+
+/**
+ * @brief 区域内的动态数组（只用于平凡类型，不调用构造 / 析构）
+ *
+ * 增长时优先原地扩展（位于区域顶端时），否则在区域内重新分配并拷贝；旧空间直到作用域回滚或帧末才回收。
+ * 对象本身可平凡析构，可以整体存放在区域中。
+ */
+template<typename T>
+class ArenaVector {
+    static_assert(std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>,
+                  "ArenaVector 只存放平凡类型");
+
+public:
+    ArenaVector() = default;
+    explicit ArenaVector(ArenaRegion& region) : m_region(&region) {}
+
+    /** @brief 确保容量不少于 n */
+    void reserve(size_t n) {
+        if (n > m_capacity) {
+            Grow(n);
+        }
+    }
+
+    /** @brief 设置元素数量（新元素未初始化） */
+    void resize(size_t n) {
+        reserve(n);
+        m_size = n;
+    }
+
+    /** @brief 设置为 n 个 value */
+    void assign(size_t n, const T& value) {
+        resize(n);
+        for (size_t i = 0; i < n; ++i) {
+            m_data[i] = value;
+        }
+    }
+
+    void push_back(const T& value) {
+        if (m_size == m_capacity) {
+            Grow(m_size + 1);
+        }
+        m_data[m_size++] = value;
+    }
+
+    T& emplace_back(const T& value) {
+        push_back(value);
+        return m_data[m_size - 1];
+    }
+
+    /** @brief 追加 count 个元素 */
+    void append(const T* values, size_t count) {
+        if (count == 0) {
+            return;
+        }
+        reserve(m_size + count);
+        std::memcpy(m_data + m_size, values, count * sizeof(T));
+        m_size += count;
+    }
+
+    void clear() { m_size = 0; }
+    [[nodiscard]] size_t size() const { return m_size; }
+    [[nodiscard]] bool empty() const { return m_size == 0; }
+    T* data() { return m_data; }
+    const T* data() const { return m_data; }
+    T& operator[](size_t i) { return m_data[i]; }
+    const T& operator[](size_t i) const { return m_data[i]; }
+    T* begin() { return m_data; }
+    T* end() { return m_data + m_size; }
+    const T* begin() const { return m_data; }
+    const T* end() const { return m_data + m_size; }
+
+private:
+    void Grow(size_t minCapacity) {
+        size_t capacity = m_capacity < 16 ? 16 : m_capacity * 2;
+        if (capacity < minCapacity) {
+            capacity = minCapacity;
+        }
+        if (m_data && m_region->TryExtend(m_data, m_capacity * sizeof(T), capacity * sizeof(T))) {
+            m_capacity = capacity;
+            return;
+        }
+        T* data = m_region->AllocateArray<T>(capacity);
+        if (m_size > 0) {
+            std::memcpy(data, m_data, m_size * sizeof(T));
+        }
+        m_data = data;
+        m_capacity = capacity;
+    }
+
+    ArenaRegion* m_region = nullptr;
+    T* m_data = nullptr;
+    size_t m_size = 0;
+    size_t m_capacity = 0;
+};
+
+} // namespace SR
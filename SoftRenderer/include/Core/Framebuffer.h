@@ -40,14 +40,21 @@ public:
     /** @brief 获取内部可写的线性像素缓冲区指针 */
     inline Vec3* GetLinearPixelsWritable() { return m_linearPixels.data(); }
     
-    /** @brief 执行 FXAA 抗锯齿算法 */
+    /** @brief 执行 FXAA 抗锯齿算法（结果写回线性缓冲，供 HDR 输出使用） */
     void ApplyFXAA();
     /**
      * @brief 将线性 HDR 数据色调映射并转换为 sRGB 存入 SDR 缓冲
      * @param exposure 曝光值
      * @param dither 是否启用抖动 (暂未广泛应用)
+     * @param fxaa 是否在同一趟内先做 FXAA（只影响 SDR 输出，线性缓冲不变）
      */
-    void ResolveToSRGB(double exposure = 1.0, bool dither = false);
+    void ResolveToSRGB(double exposure = 1.0, bool dither = false, bool fxaa = false);
+    /**
+     * @brief 只对像素矩形（闭区间）做色调映射与 sRGB 输出，不含 FXAA
+     *
+     * 供 Tile 收尾在光栅化线程内调用：单线程、只读写矩形内像素，不同矩形可并发。
+     */
+    void ResolveRectToSRGB(int minX, int minY, int maxX, int maxY, double exposure = 1.0);
 
     /** @brief 获取导出的像素数组 (BGRA8) */
     const uint32_t* GetPixels() const;
@@ -64,6 +71,7 @@ private:
     std::vector<uint32_t> m_pixels;
     std::vector<Vec3> m_linearPixels;
     std::vector<Vec3> m_fxaaTemp;
+    std::vector<float> m_luma;     ///< FXAA 亮度平面（每帧重建）
 };
 
 } // namespace SR
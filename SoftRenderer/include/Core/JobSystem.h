@@ -0,0 +1,129 @@
+#pragma once
+
+/**
+ * @file JobSystem.h
+ * @brief 工作窃取任务系统：每线程一个 Chase-Lev 双端队列，空闲线程先自旋再休眠。
+ *
+ * 区间任务在执行时递归二分，右半压入本线程队列供其他线程窃取，左半继续拆分直到不超过 grain；
+ * 任务图（JobGraph）的节点在全部前驱完成后才入队，阶段之间以依赖代替整体屏障。
+ */
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace SR {
+
+/// 区间任务体：处理 [begin, end)
+using JobRangeFn = void (*)(void* context, int begin, int end);
+
+/**
+ * @brief 任务图：节点为区间任务，边表示“前驱全部完成后才开始”
+ *
+ * 只记录结构，不持有运行状态；同一个图可重复提交。节点引用的 context 须在执行期间保持有效。
+ */
+class JobGraph {
+public:
+    struct Node {
+        JobRangeFn body = nullptr;
+        void* context = nullptr;
+        int begin = 0;
+        int end = 0;
+        int grain = 1;              ///< 叶任务的最大区间长度
+        int dependencies = 0;       ///< 前驱数
+        std::vector<int> successors;
+    };
+
+    /** @brief 添加区间节点，返回节点编号 */
+    int Add(JobRangeFn body, void* context, int begin, int end, int grain = 1);
+
+    /** @brief 声明 before 完成后 after 才能开始 */
+    void Precede(int before, int after);
+
+    /** @brief 清空全部节点（保留容量） */
+    void Clear() { m_nodes.clear(); }
+
+    const std::vector<Node>& GetNodes() const { return m_nodes; }
+    [[nodiscard]] bool Empty() const { return m_nodes.empty(); }
+
+private:
+    std::vector<Node> m_nodes;
+};
+
+/**
+ * @brief 工作窃取线程池（可由多个渲染器共享）
+ *
+ * 槽位 1..N-1 为常驻工作线程；提交任务的外部线程在 ParallelFor / Run 期间占用一个提交槽位
+ * （0 号与 N..N+K-2 号，共 K 个）并参与执行直到完成。多个外部线程可以同时提交，
+ * 各自的任务进入各自槽位的队列，工作线程随机选择窃取对象，因此并发的提交方大致均分工作线程；
+ * 提交方多于提交槽位时按到达顺序排队。工作线程内可以嵌套提交。
+ */
+class JobSystem {
+public:
+    static constexpr int kDefaultCallerSlots = 4; ///< 默认可同时提交的外部线程数
+
+    /**
+     * @param threadCount 总线程数（含一个提交线程），<= 0 时使用硬件线程数
+     * @param callerSlots 可同时提交的外部线程数（至少 1）
+     */
+    explicit JobSystem(int threadCount = 0, int callerSlots = kDefaultCallerSlots);
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    /** @brief 总线程数（含一个提交线程） */
+    int GetThreadCount() const { return m_threadCount; }
+
+    /** @brief 槽位总数（工作线程 + 提交槽位），即 CurrentThreadIndex 的上界 */
+    int GetSlotCount() const { return static_cast<int>(m_workers.size()); }
+
+    /** @brief 当前线程所在的线程池（工作线程，或正在提交的外部线程；否则为空） */
+    static JobSystem* Current();
+
+    /** @brief 当前线程在所在线程池内的槽位下标（不在任何线程池内时为 0） */
+    static int CurrentThreadIndex();
+
+    /** @brief 并行执行 body 于 [begin, end)，叶任务长度不超过 grain，阻塞直到全部完成 */
+    void ParallelFor(int begin, int end, int grain, JobRangeFn body, void* context);
+
+    /** @brief 按依赖执行整个任务图，阻塞直到全部节点完成 */
+    void Run(const JobGraph& graph);
+
+    struct Job;
+    struct Batch;
+    struct GraphState;
+    struct Worker;
+
+private:
+    class CallerSlot;
+
+    void WorkerLoop(int index);
+    void Launch(Batch& batch, int thread);
+    void Execute(Job* job, int thread);
+    void FinishLeaf(Batch& batch, int thread);
+    Job* FindJob(int thread);
+    Job* AllocateJob(int thread);
+    bool Push(int thread, Job* job);
+    void WaitUntil(const std::atomic<int>& remaining, int thread);
+    void Notify();
+
+    int m_threadCount = 1;
+    std::vector<std::unique_ptr<Worker>> m_workers; ///< 每线程队列与任务池（0 号属于提交线程）
+    std::vector<std::thread> m_threads;
+    std::atomic<bool> m_running{true};
+    std::atomic<uint32_t> m_epoch{0};   ///< 有新任务入队时递增，休眠线程在此等待
+    std::atomic<int> m_sleepers{0};     ///< 正在休眠的工作线程数
+
+    std::mutex m_callerMutex;
+    std::condition_variable m_callerReleased; ///< 有提交槽位被归还
+    std::vector<int> m_freeCallerSlots;       ///< 空闲的提交槽位
+    uint64_t m_nextTicket = 0;                ///< 下一个排队提交方的号码
+    uint64_t m_servingTicket = 0;             ///< 当前可以取得槽位的号码（按到达顺序分配）
+};
+
+} // namespace SR
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace SR {
+
+/**
+ * @brief 八面体映射的 HDR 方向图像，RGBA16F 存储
+ *
+ * 单位球面方向经 L1 归一化后投影到 [0,1]² 正方形（+Y 半球位于中心，-Y 半球折叠到四角），
+ * 内部 size × size 个纹素，四周各加 1 纹素边框：边框按八面体折叠规则复制对应纹素，
+ * 双线性采样无需处理跨边 / 跨角的接缝。
+ * 每纹素 4 个 half（RGB + 填充），相邻两个纹素恰好 16 字节，可用一次 F16C 转换读取。
+ * 纹素可自有（Resize 后写入），也可只读引用外部内存（如内存映射的 IBL 缓存文件）。
+ */
+struct OctahedralImage {
+    std::vector<uint16_t> texels;       ///< 自有纹素（含边框的 RGBA16F，行主序，每行 stride 个纹素）
+    const uint16_t* external = nullptr; ///< 外部只读纹素（非空时优先于 texels）
+    int size = 0;                       ///< 内部边长（纹素）
+    int stride = 0;                     ///< 含边框的边长（size + 2）
+
+    /** @brief 含边框的 half 个数 */
+    size_t ElementCount() const { return static_cast<size_t>(stride) * static_cast<size_t>(stride) * 4; }
+
+    /** @brief 分配自有的 size × size（含边框）纹素，内容为 0 */
+    void Resize(int newSize) {
+        size = newSize;
+        stride = newSize + 2;
+        external = nullptr;
+        texels.assign(ElementCount(), 0);
+    }
+
+    /** @brief 只读引用外部纹素（布局同 texels，调用方保证其生命周期），释放自有存储 */
+    void Attach(const uint16_t* data, int newSize) {
+        size = newSize;
+        stride = newSize + 2;
+        external = data;
+        std::vector<uint16_t>().swap(texels);
+    }
+
+    /** @brief 含边框纹素起始地址 */
+    const uint16_t* Data() const { return external ? external : texels.data(); }
+
+    /** @brief 纹素指针（x, y 为内部坐标，可取 -1..size 访问边框；仅自有存储可写） */
+    inline uint16_t* Texel(int x, int y) {
+        return texels.data() + (static_cast<size_t>(y + 1) * static_cast<size_t>(stride) + static_cast<size_t>(x + 1)) * 4;
+    }
+    /** @brief 纹素指针（只读） */
+    inline const uint16_t* Texel(int x, int y) const {
+        return Data() + (static_cast<size_t>(y + 1) * static_cast<size_t>(stride) + static_cast<size_t>(x + 1)) * 4;
+    }
+
+    /** @brief 检查图像是否有效 */
+    bool IsValid() const { return size > 0 && (external != nullptr || texels.size() == ElementCount()); }
+};
+
+} // namespace SR
@@ -0,0 +1,193 @@
+#pragma once
+
+/**
+ * @file Parallel.h
+ * @brief 并行后端门面：OpenMP 或工作窃取任务系统（JobSystem），运行时切换。
+ *
+ * 渲染各阶段只通过这里的 For / ForRange / Run 表达并行，不直接写 omp 并行区；
+ * 每线程数据按 ThreadIndex() 索引，长度取 MaxThreads()。OpenMP 后端保留用于 A/B 对比。
+ *
+ * 后端按线程解析：JobSystem 任务体内沿用所在线程池；否则使用当前线程安装的 ParallelContext
+ * （每个 Renderer 一个，见 ContextScope）；都没有时使用 Configure 设置的进程默认值。
+ * 因此多个渲染器可以在不同线程上同时渲染，各自的后端互不干扰。
+ */
+
+#include <memory>
+#include <type_traits>
+
+#include "Core/JobSystem.h"
+
+namespace SR {
+
+enum class OpenMPSchedulePolicy {
+    Static,
+    Dynamic,
+    Guided
+};
+
+/// 并行后端
+enum class ParallelBackend {
+    OpenMP,    ///< 每阶段一个 omp 并行区（阶段之间隐式屏障）
+    JobSystem  ///< 工作窃取任务系统（阶段可以表达为相互依赖的任务）
+};
+
+/**
+ * @brief 并行后端配置
+ */
+struct ParallelOptions {
+    ParallelBackend backend = ParallelBackend::OpenMP; ///< 当前后端
+    int jobThreads = 0;                                ///< JobSystem 总线程数（含提交线程），0 表示与 OpenMP 最大线程数一致
+    std::shared_ptr<JobSystem> jobSystem;              ///< 指定 JobSystem 线程池（为空时使用按线程数共享的进程线程池）
+};
+
+/**
+ * @brief 解析后的并行执行环境：后端与线程池（共享所有权）
+ *
+ * 同一线程池上的多个环境并发提交时，工作线程在各提交方之间大致均分（见 JobSystem）。
+ * OpenMP 后端下每个提交线程各自创建线程组，并发渲染时会超额订阅，共享场景应使用 JobSystem。
+ */
+struct ParallelContext {
+    ParallelBackend backend = ParallelBackend::OpenMP;
+    std::shared_ptr<JobSystem> jobSystem; ///< JobSystem 后端的线程池
+};
+
+namespace Parallel {
+
+/// 负载不均匀的循环使用的调度策略（Intel 运行时下 guided 更好，其余使用 dynamic）
+#if defined(SR_INTEL_OMP)
+inline constexpr OpenMPSchedulePolicy kBalanced = OpenMPSchedulePolicy::Guided;
+#else
+inline constexpr OpenMPSchedulePolicy kBalanced = OpenMPSchedulePolicy::Dynamic;
+#endif
+
+/** @brief 按线程数取得进程共享的 JobSystem 线程池（没有使用方时释放） */
+std::shared_ptr<JobSystem> GetSharedJobSystem(int threadCount);
+
+/** @brief 由配置创建执行环境（JobSystem 后端未指定线程池时使用共享线程池） */
+ParallelContext CreateContext(const ParallelOptions& options);
+
+/** @brief 设置进程默认后端 / 线程数（须在并行区外调用，且不能与使用默认环境的并行区并发） */
+void Configure(const ParallelOptions& options);
+
+/**
+ * @brief 在当前线程安装执行环境（析构时恢复之前的环境；环境须在作用域内保持存活）
+ */
+class ContextScope {
+public:
+    explicit ContextScope(const ParallelContext& context);
+    ~ContextScope();
+
+    ContextScope(const ContextScope&) = delete;
+    ContextScope& operator=(const ContextScope&) = delete;
+
+private:
+    const ParallelContext* m_previous = nullptr;
+};
+
+/** @brief 当前线程生效的后端 */
+ParallelBackend GetBackend();
+
+/** @brief 并行区内可能出现的最大线程数（每线程数组的长度） */
+int MaxThreads();
+
+/** @brief 当前线程下标，位于 [0, MaxThreads()) */
+int ThreadIndex();
+
+/** @brief 按依赖执行任务图（OpenMP 后端按拓扑层逐层执行，层间屏障） */
+void Run(const JobGraph& graph);
+
+namespace Detail {
+/** @brief JobSystem 后端的区间并行（grain 为 OpenMP chunk，叶任务长度会按线程数放大） */
+void JobFor(JobSystem& jobs, int begin, int end, int grain, JobRangeFn body, void* context);
+
+/** @brief 当前线程生效的 JobSystem 线程池（OpenMP 后端为空） */
+JobSystem* ActiveJobSystem();
+
+template <typename Body>
+void* ContextOf(Body& body) {
+    return const_cast<void*>(static_cast<const void*>(std::addressof(body)));
+}
+} // namespace Detail
+
+/**
+ * @brief 并行循环 body(i)，i ∈ [begin, end)
+ *
+ * schedule / grain 对应 OpenMP 的 schedule 子句（Static 忽略 grain）；JobSystem 后端以 grain 为最小叶任务长度，
+ * 负载通过窃取均衡。
+ */
+template <typename Body>
+void For(int begin, int end, int grain, OpenMPSchedulePolicy schedule, Body&& body) {
+    if (end <= begin) {
+        return;
+    }
+    if (JobSystem* jobs = Detail::ActiveJobSystem()) {
+        using BodyType = std::remove_reference_t<Body>;
+        Detail::JobFor(*jobs, begin, end, grain, [](void* context, int first, int last) {
+            BodyType& f = *static_cast<BodyType*>(context);
+            for (int i = first; i < last; ++i) {
+                f(i);
+            }
+        }, Detail::ContextOf(body));
+        return;
+    }
+    switch (schedule) {
+    case OpenMPSchedulePolicy::Static:
+        #pragma omp parallel for schedule(static)
+        for (int i = begin; i < end; ++i) {
+            body(i);
+        }
+        break;
+    case OpenMPSchedulePolicy::Guided:
+        #pragma omp parallel for schedule(guided, grain)
+        for (int i = begin; i < end; ++i) {
+            body(i);
+        }
+        break;
+    case OpenMPSchedulePolicy::Dynamic:
+    default:
+        #pragma omp parallel for schedule(dynamic, grain)
+        for (int i = begin; i < end; ++i) {
+            body(i);
+        }
+        break;
+    }
+}
+
+/**
+ * @brief 按块并行 body(first, last)
+ *
+ * OpenMP 后端按 grain 切块、块号 dynamic 调度；JobSystem 后端的块即叶任务（长度不小于 grain）。
+ * 用于每块需要准备局部状态（批量着色缓冲、局部计数）的循环。
+ */
+template <typename Body>
+void ForRange(int begin, int end, int grain, Body&& body) {
+    if (end <= begin) {
+        return;
+    }
+    grain = grain < 1 ? 1 : grain;
+    if (JobSystem* jobs = Detail::ActiveJobSystem()) {
+        using BodyType = std::remove_reference_t<Body>;
+        Detail::JobFor(*jobs, begin, end, grain, [](void* context, int first, int last) {
+            (*static_cast<BodyType*>(context))(first, last);
+        }, Detail::ContextOf(body));
+        return;
+    }
+    const int chunkCount = (end - begin + grain - 1) / grain;
+    #pragma omp parallel for schedule(dynamic, 1)
+    for (int chunk = 0; chunk < chunkCount; ++chunk) {
+        const int first = begin + chunk * grain;
+        body(first, end - first < grain ? end : first + grain);
+    }
+}
+
+/** @brief 向任务图添加区间节点 body(first, last)（body 须在 Run 返回前保持有效） */
+template <typename Body>
+int AddRange(JobGraph& graph, int begin, int end, int grain, Body& body) {
+    return graph.Add([](void* context, int first, int last) {
+        (*static_cast<Body*>(context))(first, last);
+    }, Detail::ContextOf(body), begin, end, grain);
+}
+
+} // namespace Parallel
+
+} // namespace SR
@@ -1,7 +1,5 @@
 #pragma once
 
-#include <vector>
-
 #include "Math/Vec2.h"
 #include "Math/Vec3.h"
 #include "Math/Vec4.h"
@@ -21,6 +19,22 @@ struct ClipVertex {
     Vec3 tangent;   ///< 切线
 };
 
+/**
+ * @brief 裁剪结果多边形（定长存储，不做堆分配）
+ *
+ * 三角形依次被 6 个凸平面裁剪，每个平面最多增加一个顶点，顶点数不超过 9。
+ */
+struct ClipPolygon {
+    static constexpr int kMaxVertices = 9;
+
+    ClipVertex vertices[kMaxVertices];
+    int count = 0;
+
+    size_t size() const { return static_cast<size_t>(count); }
+    bool empty() const { return count == 0; }
+    const ClipVertex& operator[](size_t i) const { return vertices[i]; }
+};
+
 /**
  * @brief 裁剪器类，实现 Sutherland-Hodgman 裁剪算法
  */
@@ -28,11 +42,11 @@ class Clipper {
 public:
     /** 
      * @brief 对单个三角形进行近平面裁剪 (Z < 0)
-     * @return 裁剪后生成的顶点多边形列表
+     * @return 裁剪后生成的顶点多边形（顶点数 < 3 表示完全被裁掉）
      */
-    std::vector<ClipVertex> ClipTriangle(const ClipVertex& a,
-                                         const ClipVertex& b,
-                                         const ClipVertex& c) const;
+    ClipPolygon ClipTriangle(const ClipVertex& a,
+                             const ClipVertex& b,
+                             const ClipVertex& c) const;
 };
 
 } // namespace SR
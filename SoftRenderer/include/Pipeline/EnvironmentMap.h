@@ -1,40 +1,78 @@
 #pragma once
 
+#include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "Core/HDRImage.h"
+#include "Core/OctahedralImage.h"
 #include "Math/Vec2.h"
 #include "Math/Vec3.h"
 #include "SoftRendererExport.h"
 
 namespace SR {
 
+class MappedFile;
+
+/**
+ * @brief 环境贴图运行时存储布局
+ */
+enum class EnvironmentLayout : uint8_t {
+    Equirect,   ///< 等距柱形 float RGB（方向 → UV 需要 atan2 / asin）
+    Octahedral, ///< 八面体映射 RGBA16F（方向 → UV 仅需一次除法，带边框无缝双线性）
+};
+
+/**
+ * @brief 环境贴图加载选项
+ */
+struct EnvironmentLoadOptions {
+    EnvironmentLayout layout = EnvironmentLayout::Octahedral; ///< 运行时存储布局
+    bool useCache = true;                                     ///< 读写 IBL 预计算磁盘缓存
+    std::string cacheDirectory;                               ///< 缓存目录（空表示与 EXR 同目录）
+};
+
 /**
  * @brief 环境贴图类，提供 IBL（基于图像的光照）支持
  *
  * 加载 EXR 等距柱形投影环境贴图后，预计算：
  *   - SH L=2 漫反射辐照度系数（9 × 3 通道）
  *   - Split-Sum 预过滤镜面反射 mip 链（6 级）
- *   - BRDF 积分 LUT（128×128）
+ *   - BRDF 积分 LUT（128×128，离线烘焙为编译期常量表，与环境无关）
+ *
+ * Octahedral 布局下，天空盒背景与镜面反射 mip 链均转为八面体 RGBA16F 图像，
+ * 逐像素路径不再调用超越函数；预计算完成后释放等距柱形原图。
+ *
+ * 预计算结果写入版本化的二进制缓存文件（<EXR 文件名>.sribl），以 EXR 内容哈希与预计算参数为键；
+ * 再次加载时若键匹配则内存映射该文件，Octahedral 布局直接引用映射内的纹素，跳过解码与预计算。
  */
 class SR_API EnvironmentMap {
 public:
     /**
-     * @brief 从 EXR 文件加载环境贴图并预计算所有 IBL 数据
-     * @return 成功返回 true
+     * @brief 从 EXR 文件加载环境贴图并预计算（或从缓存映射）所有 IBL 数据
+     * @return 成功返回 true（缓存读写失败不影响结果）
      */
-    bool LoadFromEXR(const std::string& path);
+    bool LoadFromEXR(const std::string& path, const EnvironmentLoadOptions& options = {});
 
     /** @brief 是否已成功加载 */
     bool IsLoaded() const { return m_loaded; }
 
+    /** @brief 当前运行时存储布局 */
+    EnvironmentLayout GetLayout() const { return m_layout; }
+
+    /** @brief 最近一次加载是否命中磁盘缓存 */
+    bool IsFromCache() const { return m_fromCache; }
+
     /** @brief 按方向采样原始环境贴图（天空盒背景用） */
     Vec3 SampleDirection(const Vec3& dir) const;
 
     /** @brief 使用 SH 系数评估漫反射辐照度 */
     Vec3 EvalDiffuseSH(const Vec3& normal) const;
 
+    /** @brief 4 个法线（SoA）同时评估漫反射辐照度（AVX2），结果写入 SoA 输出 */
+    void EvalDiffuseSH4(const double* nx, const double* ny, const double* nz,
+                        double* outR, double* outG, double* outB) const;
+
     /** @brief 按反射方向和粗糙度采样预过滤镜面反射贴图 */
     Vec3 SampleSpecular(const Vec3& R, double roughness) const;
 
@@ -47,17 +85,28 @@ public:
 private:
     // 等距柱形投影双线性采样
     Vec3 SampleEquirectBilinear(const HDRImage& img, const Vec3& dir) const;
+    // GGX 重要性采样预过滤单个方向（V = N）
+    Vec3 PrefilterSpecular(const Vec3& N, double roughness) const;
 
     // 预计算步骤
     void ComputeSH9();
     void ComputePrefilteredSpecular();
-    void ComputeBRDFLUT();
+    void ComputeOctahedralSky();
+
+    // 磁盘缓存（key 为 EXR 内容哈希与预计算参数的组合）
+    bool LoadCache(const std::string& cachePath, uint64_t key);
+    bool SaveCache(const std::string& cachePath, uint64_t key) const;
 
     bool m_loaded = false;
+    bool m_fromCache = false;
+    EnvironmentLayout m_layout = EnvironmentLayout::Octahedral;
     std::string m_lastError;
+    std::shared_ptr<const MappedFile> m_cacheMapping; ///< 缓存文件映射（Octahedral 图像引用其中的纹素）
 
-    // 原始环境贴图
+    // 原始环境贴图（Octahedral 布局下预计算完成后释放）
     HDRImage m_envMap;
+    // 八面体天空盒（Octahedral 布局）
+    OctahedralImage m_skyOcta;
 
     // 漫反射 SH L=2 系数（9 个 Vec3）
     Vec3 m_sh[9]{};
@@ -65,11 +114,8 @@ private:
     // 预过滤镜面反射 mip 链
     static constexpr int kSpecularMipCount = 6;
     static constexpr double kMipRoughness[kSpecularMipCount] = {0.0, 0.2, 0.4, 0.6, 0.8, 1.0};
-    HDRImage m_specularMips[kSpecularMipCount];
-
-    // BRDF 积分 LUT
-    static constexpr int kBRDFLutSize = 128;
-    std::vector<float> m_brdfLUT; // 128×128，每条目 2 floats (scale, bias)
+    HDRImage m_specularMips[kSpecularMipCount];         ///< Equirect 布局
+    OctahedralImage m_specularOcta[kSpecularMipCount];  ///< Octahedral 布局
 };
 
 } // namespace SR
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <vector>
 
 #include "Asset/GLTFTypes.h"
@@ -7,6 +8,8 @@
 #include "Math/Vec2.h"
 #include "Math/Vec3.h"
 #include "Math/Vec4.h"
+#include "Pipeline/ShaderPermutation.h"
+#include "Scene/PreparedTexture.h"
 #include "Scene/TextureBinding.h"
 #include "Scene/LightGroup.h"
 
@@ -15,6 +18,7 @@ namespace SR {
 struct GLTFImage;
 struct GLTFSampler;
 class EnvironmentMap;
+struct ShadowMapData;
 
 /// @brief 每帧预计算的光照数据（避免在每个片元重复计算）
 struct PrecomputedLight {
@@ -22,6 +26,22 @@ struct PrecomputedLight {
     Vec3 radiance; ///< 辐射亮度 = 光照颜色 × 强度
 };
 
+/**
+ * @brief 每帧预计算的局部光源（点光 / 聚光）
+ *
+ * 衰减 = window(d) / max(d², ε) × spot²，其中 window = saturate(1 - (d²/range²)²)²，
+ * spot = saturate(dot(-L, direction) × spotScale + spotOffset)；点光源 spotScale = 0、spotOffset = 1。
+ */
+struct PrecomputedLocalLight {
+    Vec3 position;            ///< 世界空间位置
+    Vec3 radiance;            ///< 颜色 × 强度
+    Vec3 direction{0.0, 0.0, 1.0}; ///< 聚光光轴（光传播方向）
+    double range = 0.0;       ///< 有效影响半径（剔除与 window 衰减共用）
+    double invRangeSq = 0.0;  ///< 1 / range²
+    double spotScale = 0.0;   ///< 1 / (cos(inner) - cos(outer))
+    double spotOffset = 1.0;  ///< -cos(outer) × spotScale
+};
+
 /**
  * @brief 三角形级常量数据（同一三角形内所有像素共享）
  *
@@ -47,6 +67,8 @@ struct FragmentContext {
 
     // 纹理绑定（从 MaterialTable 复制）
     TextureBindingArray textures{};
+    // 各插槽预解析的采样描述符（由 Rasterizer 按三角形解析；nullptr 时回退到 images/samplers）
+    TextureDescriptorArray textureDescriptors{};
 
     // 场景引用（指针，不持有所有权）
     const std::vector<DirectionalLight>* lights = nullptr; ///< 平行光列表
@@ -60,6 +82,13 @@ struct FragmentContext {
     // 预计算光照数据（指针，避免 vector 拷贝，由 Rasterizer 赋值）
     const PrecomputedLight* precomputedLights = nullptr; ///< 预计算光照数组
     size_t precomputedLightCount = 0;                    ///< 预计算光照数量
+
+    // 局部光源（由 Rasterizer 按片元所在 Tile 赋值）
+    const PrecomputedLocalLight* localLights = nullptr;  ///< 帧级局部光源数组
+    const uint32_t* localLightIndices = nullptr;         ///< 当前 Tile 的光源索引（nullptr 表示依次遍历 localLights）
+    size_t localLightCount = 0;                          ///< 需要遍历的局部光源数量
+
+    const ShadowMapData* shadow = nullptr; ///< 平行光级联阴影（nullptr 表示无阴影）
 };
 
 /// @brief 像素级插值数据（在每个像素处由重心坐标插值得到）
@@ -70,6 +99,86 @@ struct FragmentVarying {
     Vec2 texCoord1; ///< 次 UV 坐标（插值后）
     Vec4 color;     ///< 顶点颜色（插值后，RGBA）
     Vec3 tangent;   ///< 世界空间切线（用于法线贴图）
+    Vec2 texCoordDx;  ///< 主 UV 对屏幕 x 的导数（用于 mip 选级；全 0 表示未知，按放大处理）
+    Vec2 texCoordDy;  ///< 主 UV 对屏幕 y 的导数
+    Vec2 texCoord1Dx; ///< 次 UV 对屏幕 x 的导数
+    Vec2 texCoord1Dy; ///< 次 UV 对屏幕 y 的导数
+};
+
+/**
+ * @brief 4 个片元的 SoA 插值数据（ShadeBatch 输入）
+ *
+ * 每个分量一个 32 字节对齐数组，对应一个 AVX2 double 寄存器；
+ * 未激活通道的内容不参与输出，但必须是已初始化的数值。
+ */
+struct FragmentVaryingBatch {
+    static constexpr int kLanes = 4; ///< 每批片元数（AVX2 double 宽度）
+
+    alignas(32) double normalX[kLanes] = {};
+    alignas(32) double normalY[kLanes] = {};
+    alignas(32) double normalZ[kLanes] = {};
+    alignas(32) double worldX[kLanes] = {};
+    alignas(32) double worldY[kLanes] = {};
+    alignas(32) double worldZ[kLanes] = {};
+    alignas(32) double u0[kLanes] = {};
+    alignas(32) double v0[kLanes] = {};
+    alignas(32) double u1[kLanes] = {};
+    alignas(32) double v1[kLanes] = {};
+    alignas(32) double colorR[kLanes] = {};
+    alignas(32) double colorG[kLanes] = {};
+    alignas(32) double colorB[kLanes] = {};
+    alignas(32) double colorA[kLanes] = {};
+    alignas(32) double tangentX[kLanes] = {};
+    alignas(32) double tangentY[kLanes] = {};
+    alignas(32) double tangentZ[kLanes] = {};
+    alignas(32) double du0dx[kLanes] = {};
+    alignas(32) double dv0dx[kLanes] = {};
+    alignas(32) double du0dy[kLanes] = {};
+    alignas(32) double dv0dy[kLanes] = {};
+    alignas(32) double du1dx[kLanes] = {};
+    alignas(32) double dv1dx[kLanes] = {};
+    alignas(32) double du1dy[kLanes] = {};
+    alignas(32) double dv1dy[kLanes] = {};
+
+    /** @brief 写入第 lane 个片元 */
+    void Set(int lane, const FragmentVarying& v) {
+        normalX[lane] = v.normal.x;   normalY[lane] = v.normal.y;   normalZ[lane] = v.normal.z;
+        worldX[lane] = v.worldPos.x;  worldY[lane] = v.worldPos.y;  worldZ[lane] = v.worldPos.z;
+        u0[lane] = v.texCoord.x;      v0[lane] = v.texCoord.y;
+        u1[lane] = v.texCoord1.x;     v1[lane] = v.texCoord1.y;
+        colorR[lane] = v.color.x;     colorG[lane] = v.color.y;
+        colorB[lane] = v.color.z;     colorA[lane] = v.color.w;
+        tangentX[lane] = v.tangent.x; tangentY[lane] = v.tangent.y; tangentZ[lane] = v.tangent.z;
+        du0dx[lane] = v.texCoordDx.x;  dv0dx[lane] = v.texCoordDx.y;
+        du0dy[lane] = v.texCoordDy.x;  dv0dy[lane] = v.texCoordDy.y;
+        du1dx[lane] = v.texCoord1Dx.x; dv1dx[lane] = v.texCoord1Dx.y;
+        du1dy[lane] = v.texCoord1Dy.x; dv1dy[lane] = v.texCoord1Dy.y;
+    }
+};
+
+/// @brief ShadeBatch 输出：线性 HDR 颜色与有效混合 alpha（SoA）
+struct FragmentOutputBatch {
+    alignas(32) double r[FragmentVaryingBatch::kLanes];
+    alignas(32) double g[FragmentVaryingBatch::kLanes];
+    alignas(32) double b[FragmentVaryingBatch::kLanes];
+    alignas(32) double alpha[FragmentVaryingBatch::kLanes];
+};
+
+/// @brief 单片元着色函数（特化变体入口）
+using ShadeFastFn = Vec3 (*)(const FragmentContext& ctx, const FragmentVarying& varying, double* outEffectiveAlpha);
+/// @brief 4 片元批量着色函数（特化变体入口）
+using ShadeBatchFn = void (*)(const FragmentContext& ctx, const FragmentVaryingBatch& batch, int activeMask,
+                              FragmentOutputBatch& out);
+
+/**
+ * @brief 着色器变体：按特性掩码编译期特化的一组着色函数
+ *
+ * 变体内部不再检查纹理绑定、双面与环境贴图，光照只读取 ctx.precomputedLights 与 ctx.localLights。
+ * 调用方需保证 ctx 与生成掩码的材质/帧状态一致。
+ */
+struct ShaderPermutation {
+    ShadeFastFn shadeFast = nullptr;   ///< 单片元着色
+    ShadeBatchFn shadeBatch = nullptr; ///< 4 片元批量着色
 };
 
 /**
@@ -77,10 +186,29 @@ struct FragmentVarying {
  */
 class FragmentShader {
 public:
+    /** @brief 由三角形级上下文计算特性掩码（与 MaterialTable 按材质预计算的掩码一致） */
+    static ShaderFeatureMask ComputeFeatureMask(const FragmentContext& ctx);
+
+    /** @brief 获取特性掩码对应的着色器变体（查表，O(1)） */
+    static const ShaderPermutation& GetPermutation(ShaderFeatureMask features);
+
     /** @brief 优化的着色方法：Context 为三角形级常数，Varying 为像素级变量
+     *
+     *  按 ctx 计算特性掩码后分派到对应变体；热路径应预先取得变体并直接调用函数指针。
      *  @param outEffectiveAlpha 如果非 nullptr，将输出 Fresnel 调制后的有效混合 alpha
      */
     Vec3 ShadeFast(const FragmentContext& ctx, const FragmentVarying& varying, double* outEffectiveAlpha = nullptr) const;
+
+    /**
+     * @brief 批量着色：同一三角形的 4 个片元，跨通道执行 PBR 计算（AVX2）
+     *
+     * 归一化、GGX/Smith、Fresnel、多重散射补偿、SH 辐照度与光照累加在 4 个通道上并行，
+     * 纹理采样与 IBL 镜面查表仍逐通道执行。结果与 ShadeFast 一致（仅浮点舍入差异）。
+     *
+     * @param activeMask 第 i 位为 1 表示第 i 个通道有效；无效通道的输出未定义
+     */
+    void ShadeBatch(const FragmentContext& ctx, const FragmentVaryingBatch& batch, int activeMask,
+                    FragmentOutputBatch& out) const;
 };
 
 } // namespace SR
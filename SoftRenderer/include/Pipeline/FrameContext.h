@@ -1,19 +1,15 @@
 #pragma once
 
+#include <atomic>
 #include <vector>
 
+#include "Core/Parallel.h"
 #include "Math/Mat4.h"
 #include "Math/Vec3.h"
 #include "Scene/LightGroup.h"
 
 namespace SR {
 
-enum class OpenMPSchedulePolicy {
-    Static,
-    Dynamic,
-    Guided
-};
-
 struct OpenMPTuningOptions {
 #if defined(SR_INTEL_OMP)
     OpenMPSchedulePolicy clipSchedule = OpenMPSchedulePolicy::Guided;          ///< 裁剪阶段并行调度策略
@@ -41,7 +37,11 @@ struct OpenMPTuningOptions {
 struct GLTFImage;
 struct GLTFSampler;
 class EnvironmentMap;
+class FrameArena;
 class MaterialTable;
+class PreparedTextureSet;
+class LightCuller;
+struct ShadowMapData;
 
 /**
  * @brief 每帧全局渲染上下文
@@ -55,11 +55,23 @@ struct FrameContext {
     Vec3 cameraPos{0.0, 0.0, 0.0};          ///< 相机在世界空间中的位置
     Vec3 ambientColor{0.03, 0.03, 0.03};    ///< 全局环境光颜色（无 IBL 时使用）
     std::vector<DirectionalLight> lights;    ///< 场景平行光列表
+    std::vector<PointLight> pointLights;     ///< 场景点光源列表（世界空间）
+    std::vector<SpotLight> spotLights;       ///< 场景聚光灯列表（世界空间）
+    const LightCuller* tiledLights = nullptr; ///< 分块局部光源列表（每帧构建；nullptr 时每个片元遍历全部局部光源）
+    const ShadowMapData* shadowMap = nullptr; ///< lights[0] 的级联阴影贴图（每帧构建；nullptr 时无阴影）
     const std::vector<GLTFImage>*   images   = nullptr; ///< 场景图像数组（纹理采样用）
     const std::vector<GLTFSampler>* samplers = nullptr; ///< 场景采样器数组（纹理过滤用）
+    const PreparedTextureSet* preparedTextures = nullptr; ///< 采样就绪纹理（可选，缺失的图像回退到 images）
     const EnvironmentMap* environmentMap     = nullptr; ///< IBL 环境贴图（可选，nullptr 时退回常量环境光）
     const MaterialTable*  materialTable      = nullptr; ///< 帧级材质表 (SOA 布局，由 GeometryProcessor 填充)
     OpenMPTuningOptions openmp{};                        ///< OpenMP 调优选项（调度策略、chunk、统计开关）
+    FrameArena* frameArena = nullptr;                    ///< 帧级临时内存（Renderer 持有，帧末复位；nullptr 时各阶段使用局部分配器）
+    const std::atomic<bool>* cancelRequested = nullptr;  ///< 取消标志（可选）：置位后各阶段在 Tile / Pass 之间尽快放弃本帧
 };
 
+/** @brief 取消标志是否已置位（空指针表示不可取消） */
+inline bool IsCancelRequested(const std::atomic<bool>* flag) {
+    return flag != nullptr && flag->load(std::memory_order_relaxed);
+}
+
 } // namespace SR
@@ -2,17 +2,17 @@
 
 #include <vector>
 
+#include "Core/FrameArena.h"
 #include "Material/PBRMaterial.h"
 #include "Pipeline/FrameContext.h"
 #include "Pipeline/MaterialTable.h"
+#include "Pipeline/Rasterizer.h"
 #include "Scene/Mesh.h"
 #include "Scene/Transform.h"
 #include "Scene/RenderQueue.h"
 
 namespace SR {
 
-struct Triangle;
-
 /**
  * @brief 从 PBRMaterial 和 DrawItem 构建 MaterialParams
  *
@@ -28,13 +28,17 @@ class GeometryProcessor {
 public:
     /**
      * @brief 从网格构建一组经过变换的三角形
+     *
+     * 背面（单面材质）、退化和完全位于视锥外的三角形在组装属性前即被剔除，
+     * 剔除计数可通过 GetLastCullStats() 获取。
+     *
      * @param mesh 输入网格数据
      * @param item 渲染提交项
      * @param modelMatrix 模型到世界坐标变换矩阵
      * @param normalMatrix 法线变换矩阵
      * @param frameContext 系统级帧上下文 (包含 View/Projection)
      * @param materialHandle 预注册的材质句柄
-     * @param outTriangles 输出构建好的三角形列表
+     * @param outTriangles 构建好的三角形追加到末尾（不清空已有内容）
      */
     void BuildTriangles(const Mesh& mesh,
                         const DrawItem& item,
@@ -42,12 +46,87 @@ public:
                         const Mat4& normalMatrix,
                         const FrameContext& frameContext,
                         MaterialHandle materialHandle,
-                        std::vector<Triangle>& outTriangles) const;
-    /** @brief 获取最后一次构建生成的三角形总数 */
+                        ArenaVector<Triangle>& outTriangles) const;
+    /**
+     * @brief 批量构建同一网格多个实例的三角形
+     *
+     * 索引校验、顶点解码与实例无关的属性（UV、颜色、切线、材质句柄）只处理一次并缓存为三角形模板；
+     * 逐实例仅对唯一顶点执行一次 MVP/世界/法线变换，再按模板组装三角形。
+     *
+     * @param mesh 输入网格数据
+     * @param item 渲染提交项（提供材质的单/双面属性）
+     * @param instances 实例变换数组
+     * @param instanceCount 实例数量
+     * @param frameContext 系统级帧上下文 (包含 View/Projection)
+     * @param materialHandle 预注册的材质句柄
+     * @param outTriangles 构建好的三角形追加到末尾（所有实例依次排列）
+     */
+    void BuildTrianglesInstanced(const Mesh& mesh,
+                                 const DrawItem& item,
+                                 const InstanceTransform* instances,
+                                 size_t instanceCount,
+                                 const FrameContext& frameContext,
+                                 MaterialHandle materialHandle,
+                                 ArenaVector<Triangle>& outTriangles) const;
+    /**
+     * @brief 只做与视图无关的处理：构建世界空间三角形（多视图共享）
+     *
+     * 不执行视图相关的裁剪前剔除；v0..v2 存放齐次世界坐标（w = 1），
+     * 由各视图再乘以 View * Projection 得到裁剪空间位置（见 MultiViewGeometry）。
+     */
+    void BuildWorldTriangles(const Mesh& mesh,
+                             const DrawItem& item,
+                             const Mat4& modelMatrix,
+                             const Mat4& normalMatrix,
+                             MaterialHandle materialHandle,
+                             ArenaVector<Triangle>& outTriangles) const;
+    /** @brief BuildWorldTriangles 的实例化版本 */
+    void BuildWorldTrianglesInstanced(const Mesh& mesh,
+                                      const DrawItem& item,
+                                      const InstanceTransform* instances,
+                                      size_t instanceCount,
+                                      MaterialHandle materialHandle,
+                                      ArenaVector<Triangle>& outTriangles) const;
+    /** @brief 获取最后一次构建追加的三角形总数 */
     uint64_t GetLastTriangleCount() const;
+    /** @brief 获取最后一次构建的裁剪前剔除统计（仅 trianglesCulled* 字段有效） */
+    const RasterStats& GetLastCullStats() const;
 
 private:
+    /** @brief 单个渲染项的构建；preClipCull 为 false 时 positionMVP 即模型矩阵（世界空间输出） */
+    void BuildTrianglesWith(const Mesh& mesh,
+                            const DrawItem& item,
+                            const Mat4& modelMatrix,
+                            const Mat4& normalMatrix,
+                            const Mat4& positionMVP,
+                            bool preClipCull,
+                            MaterialHandle materialHandle,
+                            ArenaVector<Triangle>& outTriangles) const;
+    /** @brief 实例化构建；viewProjection 为空时输出世界空间且不剔除 */
+    void BuildTrianglesInstancedWith(const Mesh& mesh,
+                                     const DrawItem& item,
+                                     const InstanceTransform* instances,
+                                     size_t instanceCount,
+                                     const Mat4* viewProjection,
+                                     MaterialHandle materialHandle,
+                                     ArenaVector<Triangle>& outTriangles) const;
+    /** @brief 为网格构建实例共享的三角形模板（同一网格/材质连续调用时复用） */
+    void PrepareInstanceTemplates(const Mesh& mesh, MaterialHandle materialHandle) const;
+
     mutable uint64_t m_lastTriangleCount = 0;
+    mutable RasterStats m_lastCullStats{};
+
+    // 实例化批处理的共享状态（每个 GeometryProcessor 由单线程独占）
+    mutable const Mesh* m_templateMesh = nullptr;                  ///< 当前模板对应的网格
+    mutable MaterialHandle m_templateMaterial = InvalidMaterialHandle; ///< 当前模板对应的材质句柄
+    mutable std::vector<Triangle> m_templateTriangles;             ///< 实例无关属性已填好的三角形模板
+    mutable std::vector<uint32_t> m_templateIndices;               ///< 模板三角形对应的顶点索引 (3 个一组)
+    mutable std::vector<Vec4> m_templatePositions;                 ///< 物体空间顶点位置（原始存储值）
+    mutable std::vector<Vec3> m_templateNormals;                   ///< 物体空间顶点法线（已解码）
+    mutable Mat4 m_templateDequant = Mat4::Identity();             ///< 网格位置反量化矩阵
+    mutable std::vector<Vec4> m_instanceClip;                      ///< 当前实例的裁剪空间顶点
+    mutable std::vector<Vec3> m_instanceWorld;                     ///< 当前实例的世界空间顶点
+    mutable std::vector<Vec3> m_instanceNormal;                    ///< 当前实例的世界空间法线
 };
 
 } // namespace SR
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Math/Mat4.h"
+#include "Pipeline/FragmentShader.h"
+#include "Scene/LightGroup.h"
+
+namespace SR {
+
+/**
+ * @brief 分块局部光源剔除（每帧构建一次，供所有 Pass 共享）
+ *
+ * 将点光 / 聚光的包围球投影到与 Rasterizer 相同的 Tile 网格，为每个 Tile 生成
+ * 可能照亮它的光源索引列表（CSR 紧凑存储）。片元着色只遍历所在 Tile 的列表，
+ * 着色开销随每 Tile 光源数增长，而不是随场景光源总数增长。
+ *
+ * 包围球：点光源取 (position, range)；聚光灯取光锥的最小包围球。
+ * 未指定 range 的光源按辐射亮度衰减到 kLightCutoffRadiance 的距离截断。
+ * 包围球与近平面相交时保守地覆盖整个屏幕。
+ */
+class LightCuller {
+public:
+    /// 未指定 range 时的截断亮度：超过该距离的贡献被视为 0
+    static constexpr double kLightCutoffRadiance = 1e-3;
+
+    /**
+     * @brief 预计算局部光源并构建 Tile 光源列表
+     * @param pointLights 世界空间点光源
+     * @param spotLights  世界空间聚光灯
+     * @param view        观察矩阵
+     * @param projection  投影矩阵
+     * @param width       视口宽度
+     * @param height      视口高度
+     * @param tileSize    Tile 边长（像素，需与 Rasterizer 一致）
+     */
+    void Build(const std::vector<PointLight>& pointLights, const std::vector<SpotLight>& spotLights,
+               const Mat4& view, const Mat4& projection, int width, int height, int tileSize);
+
+    /** @brief 清空光源与 Tile 列表 */
+    void Clear();
+
+    /** @brief 预计算的局部光源（Tile 列表中的索引指向此数组） */
+    const std::vector<PrecomputedLocalLight>& GetLights() const { return m_lights; }
+
+    /** @brief Tile 网格是否与给定视口和 Tile 尺寸一致 */
+    bool Matches(int width, int height, int tileSize) const {
+        return m_width == width && m_height == height && m_tileSize == tileSize;
+    }
+
+    /** @brief 第 tileIndex 个 Tile（行主序）的光源索引 */
+    const uint32_t* GetTileLights(size_t tileIndex) const { return m_tileIndices.data() + m_tileOffsets[tileIndex]; }
+
+    /** @brief 第 tileIndex 个 Tile 的光源数量 */
+    size_t GetTileLightCount(size_t tileIndex) const {
+        return m_tileOffsets[tileIndex + 1] - m_tileOffsets[tileIndex];
+    }
+
+    /** @brief 所有 Tile 的光源引用总数 */
+    size_t GetReferenceCount() const { return m_tileIndices.size(); }
+
+private:
+    /// @brief 光源覆盖的 Tile 矩形（闭区间）
+    struct TileRect {
+        int minX;
+        int minY;
+        int maxX;
+        int maxY;
+    };
+
+    std::vector<PrecomputedLocalLight> m_lights; ///< 预计算的局部光源
+    std::vector<TileRect> m_lightRects;          ///< 每个光源覆盖的 Tile 矩形（构建期临时数据）
+    std::vector<uint32_t> m_tileOffsets;         ///< 每 Tile 的起始偏移（长度 Tile 数 + 1）
+    std::vector<uint32_t> m_tileIndices;         ///< 光源索引（按 Tile 连续存放）
+    int m_width = 0;    ///< 视口宽度
+    int m_height = 0;   ///< 视口高度
+    int m_tileSize = 0; ///< Tile 边长
+    int m_tilesX = 0;   ///< 水平 Tile 数
+    int m_tilesY = 0;   ///< 垂直 Tile 数
+};
+
+} // namespace SR
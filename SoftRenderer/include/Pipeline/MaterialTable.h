@@ -4,6 +4,7 @@
 #include <cstdint>
 #include <deque>
 #include "Material/PBRMaterial.h"
+#include "Pipeline/ShaderPermutation.h"
 
 namespace SR {
 
@@ -92,7 +93,7 @@ struct MaterialParams {
  *
  * ## 生命周期
  * MaterialTable 必须在整个渲染帧期间保持有效 (包括延迟的透明物体渲染)。
- * 通常由 RenderPipeline 在 Render() 调用时创建并管理。
+ * 通常作为帧图临时资源由 FrameGraph 持有，每帧 Clear() 后复用。
  */
 class MaterialTable {
 public:
@@ -196,6 +197,15 @@ public:
     int32_t GetPrimitiveIndex(MaterialHandle handle) const;
     int32_t GetNodeIndex(MaterialHandle handle) const;
 
+    // ========== 着色器变体 ==========
+
+    /**
+     * @brief 获取材质的着色器特性掩码（添加材质时计算一次）
+     *
+     * 仅包含材质相关特性；帧级的 ShaderFeature::EnvironmentMap 由光栅化器合并。
+     */
+    ShaderFeatureMask GetShaderFeatures(MaterialHandle handle) const;
+
     /**
      * @brief 获取完整的 PBRMaterial 结构 (用于兼容)
      * @param handle 材质句柄
@@ -210,6 +220,7 @@ public:
 
 private:
     void InitializeDefaultMaterial();
+    static ShaderFeatureMask ComputeShaderFeatures(const MaterialParams& params);
 
     template<typename T>
     const T& GetProperty(MaterialHandle handle, const std::vector<T>& storage, const T& defaultValue) const {
@@ -274,6 +285,9 @@ private:
     std::vector<int32_t> m_primitiveIndex;
     std::vector<int32_t> m_nodeIndex;
 
+    // 着色器特性掩码 (SOA)
+    std::vector<ShaderFeatureMask> m_shaderFeatures;
+
     // 空闲槽位列表
     std::deque<MaterialHandle> m_freeSlots;
 
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "Core/FrameArena.h"
+#include "Math/Mat4.h"
+#include "Math/Vec3.h"
+#include "Pipeline/MaterialTable.h"
+#include "Pipeline/Rasterizer.h"
+
+namespace SR {
+
+struct FrameContext;
+class RenderQueue;
+
+/**
+ * @brief 共享几何在某一视图下的投影结果（位于帧级内存共享区域）
+ */
+struct ProjectedGeometry {
+    std::span<Triangle> opaque;             ///< 不透明 / Mask 三角形（裁剪空间位置，保持队列顺序）
+    std::span<Triangle> blend;              ///< 半透明三角形（按该视图从远到近）
+    uint64_t trianglesCulledBackface = 0;   ///< 裁剪前剔除：背面
+    uint64_t trianglesCulledDegenerate = 0; ///< 裁剪前剔除：退化
+    uint64_t trianglesCulledOffscreen = 0;  ///< 裁剪前剔除：视锥外
+};
+
+/**
+ * @brief 多视图渲染共享的世界空间几何
+ *
+ * 同一场景从多个视点渲染（立方体贴图探针、立体、转台缩略图）时，材质注册、模型 / 法线变换
+ * 与三角形属性组装只做一次（Build）；各视图只需 Project：逐三角形一次裁剪空间变换与裁剪前剔除，
+ * 之后照常进入裁剪 / 分箱 / 光栅化。三角形的 v0..v2 存放齐次世界坐标（w = 1）。
+ *
+ * 三角形分配在 Build 时传入的帧级内存中，所有视图须在该内存复位之前完成。
+ */
+class MultiViewGeometry {
+public:
+    /**
+     * @brief 为排序后的渲染队列构建共享几何（材质表清空后重新注册）
+     * @param queue 渲染队列（须已排序）
+     * @param frame 帧上下文（提供并行调优选项）
+     * @param arena 三角形所在的帧级内存
+     */
+    void Build(const RenderQueue& queue, const FrameContext& frame, FrameArena& arena);
+
+    /**
+     * @brief 投影到某一视图：裁剪空间变换 + 裁剪前剔除，半透明部分按视点重新排序
+     * @param viewProjection View * Projection
+     * @param cameraPos 视点（半透明从远到近排序）
+     * @param arena 输出所在的帧级内存
+     */
+    ProjectedGeometry Project(const Mat4& viewProjection, const Vec3& cameraPos, FrameArena& arena) const;
+
+    /** @brief 共享几何引用的材质表 */
+    MaterialTable& GetMaterials() { return m_materials; }
+    const MaterialTable& GetMaterials() const { return m_materials; }
+
+    size_t GetOpaqueCount() const { return m_opaque.size(); }
+    size_t GetBlendCount() const { return m_blend.size(); }
+    /** @brief 最近一次 Build 的耗时（毫秒） */
+    double GetBuildMs() const { return m_buildMs; }
+
+private:
+    /// 同一渲染项（或实例区间）的半透明三角形，按锚点到视点的距离整体排序
+    struct BlendGroup {
+        size_t begin = 0;
+        size_t end = 0;
+        Vec3 anchor{};
+    };
+
+    MaterialTable m_materials;                 ///< 跨调用复用容量
+    std::span<const Triangle> m_opaque;        ///< 世界空间不透明 / Mask 三角形
+    std::span<const uint8_t> m_opaqueCull;     ///< 对应三角形是否背面剔除（单面材质）
+    std::span<const Triangle> m_blend;         ///< 世界空间半透明三角形（按队列顺序）
+    std::span<const uint8_t> m_blendCull;
+    std::vector<BlendGroup> m_blendGroups;
+    double m_buildMs = 0.0;
+};
+
+} // namespace SR
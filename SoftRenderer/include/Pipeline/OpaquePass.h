@@ -22,15 +22,54 @@ public:
         return "OpaquePass";
     }
 
+    PassResources GetResources() const override {
+        // Tile 收尾可能直接写出 SDR 结果
+        return PassResources{
+            FrameResource::Depth,
+            FrameResource::Color | FrameResource::Depth | FrameResource::Output |
+                FrameResource::BlendTriangles | FrameResource::Materials | FrameResource::FrameMemory,
+            0};
+    }
+
     int GetPriority() const override {
         return 100; // 不透明物体先渲染
     }
 };
 
+/**
+ * @brief 透明几何体准备 Pass
+ *
+ * 裁剪 OpaquePass 延迟的半透明三角形并分配到 Tile Bin。
+ * 不访问颜色与深度，可与 SkyboxPass 并发执行。
+ */
+class TransparentSetupPass : public RenderPass {
+public:
+    PassStats Execute(RenderContext& context) override;
+
+    bool ShouldExecute(const RenderContext& context) const override {
+        return context.renderQueue != nullptr;
+    }
+
+    std::string GetName() const override {
+        return "TransparentSetupPass";
+    }
+
+    PassResources GetResources() const override {
+        return PassResources{
+            FrameResource::BlendTriangles | FrameResource::Materials,
+            FrameResource::BlendBins | FrameResource::FrameMemory,
+            0};
+    }
+
+    int GetPriority() const override {
+        return 150; // 不透明物体之后即可准备
+    }
+};
+
 /**
  * @brief 透明几何体渲染 Pass
  *
- * 渲染所有 alphaMode 为 Blend 的几何体。
+ * 光栅化 TransparentSetupPass 分箱后的 Blend 几何体。
  * 使用从后到前的排序进行正确的 alpha 混合。
  */
 class TransparentPass : public RenderPass {
@@ -45,6 +84,13 @@ public:
         return "TransparentPass";
     }
 
+    PassResources GetResources() const override {
+        return PassResources{
+            FrameResource::Color | FrameResource::Depth | FrameResource::BlendBins,
+            FrameResource::Color | FrameResource::FrameMemory,
+            0};
+    }
+
     int GetPriority() const override {
         return 300; // 透明物体在天空盒之后渲染
     }
@@ -66,6 +112,10 @@ public:
         return "SkyboxPass";
     }
 
+    PassResources GetResources() const override {
+        return PassResources{FrameResource::Depth, FrameResource::Color, 0};
+    }
+
     int GetPriority() const override {
         return 200; // 天空盒在不透明物体之后
     }
@@ -84,6 +134,13 @@ public:
         return "PostProcessPass";
     }
 
+    PassResources GetResources() const override {
+        if (m_toneMappingEnabled) {
+            return PassResources{FrameResource::Color, FrameResource::Output, FrameResource::Output}; // 色调映射写满整个 SDR 输出
+        }
+        return PassResources{FrameResource::Color, m_fxaaEnabled ? FrameResource::Color : 0, 0};
+    }
+
     int GetPriority() const override {
         return 400; // 后处理最后执行
     }
@@ -11,16 +11,25 @@
 
 namespace SR {
 
+/// Build() 结果中每个 Pass 的直接前驱（下标对应 Build() 返回的顺序）
+using PassDependencies = std::vector<std::vector<int>>;
+
+/** @brief 资源掩码的可读形式，例如 "Color|Depth"（无资源时为 "none"） */
+std::string FormatResourceMask(FrameResourceMask mask);
+
 /**
  * @brief Pass 构建器
  *
  * 使用构建器模式创建可配置的渲染管线。
- * 支持依赖关系和条件执行。
+ * 支持依赖关系和条件执行；没有先后依赖的 Pass 可以并发执行。
  */
 class PassBuilder {
 public:
     PassBuilder() = default;
 
+    /// 对已注册 Pass 的配置回调
+    using PassConfigurator = std::function<void(RenderPass&)>;
+
     /**
      * @brief 添加 Pass 到管线
      * @param pass Pass 实例
@@ -45,14 +54,25 @@ public:
     using PassCondition = std::function<bool(const RenderContext&)>;
     PassBuilder& SetCondition(const std::string& passName, PassCondition condition);
 
+    /**
+     * @brief 配置所有已注册的 Pass（资源声明可能取决于配置，须在 Validate / Build 之前调用）
+     * @param configure 配置回调
+     * @return 构建器引用
+     */
+    PassBuilder& ConfigurePasses(const PassConfigurator& configure);
+
     /**
      * @brief 构建并返回排序后的 Pass 列表
+     * @param dependencies 可选输出：每个 Pass 的直接前驱下标
      * @return 按依赖关系排序的 Pass 列表
      */
-    std::vector<std::unique_ptr<RenderPass>> Build();
+    std::vector<std::unique_ptr<RenderPass>> Build(PassDependencies* dependencies = nullptr);
 
     /**
      * @brief 验证管线配置
+     *
+     * 除循环依赖外还检查资源声明：overwrites 须包含于 writes；
+     * 互不可达（可能并发）的两个 Pass 不能一方写入另一方读取或写入的资源。
      * @return true 如果配置有效
      */
     bool Validate() const;
@@ -81,6 +101,13 @@ private:
      */
     bool HasCircularDependency() const;
 
+    /**
+     * @brief 检查资源声明与并发冲突
+     * @param order 拓扑排序后的 Pass 名称
+     * @return true 如果声明有效
+     */
+    bool ValidateResources(const std::vector<std::string>& order) const;
+
     struct PassNode {
         std::unique_ptr<RenderPass> pass;
         std::unordered_set<std::string> dependencies;
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>
+
+#include "Math/Vec4.h"
+
+namespace SR {
+
+struct RasterStats;
+
+/**
+ * @brief 裁剪前剔除批次（SoA 布局，8 个三角形 × 3 个裁剪空间顶点）
+ */
+struct PreClipCullBatch {
+    static constexpr int kSize = 8; ///< 每批三角形数
+
+    alignas(32) double x[3][kSize]; ///< 各顶点裁剪空间 x
+    alignas(32) double y[3][kSize]; ///< 各顶点裁剪空间 y
+    alignas(32) double z[3][kSize]; ///< 各顶点裁剪空间 z
+    alignas(32) double w[3][kSize]; ///< 各顶点裁剪空间 w
+
+    /** @brief 写入第 lane 个三角形的三个裁剪空间顶点 */
+    void Set(int lane, const Vec4& v0, const Vec4& v1, const Vec4& v2) {
+        x[0][lane] = v0.x; y[0][lane] = v0.y; z[0][lane] = v0.z; w[0][lane] = v0.w;
+        x[1][lane] = v1.x; y[1][lane] = v1.y; z[1][lane] = v1.z; w[1][lane] = v1.w;
+        x[2][lane] = v2.x; y[2][lane] = v2.y; z[2][lane] = v2.z; w[2][lane] = v2.w;
+    }
+};
+
+/**
+ * @brief 齐次裁剪空间中的早期三角形剔除（AVX2，每批 8 个三角形）
+ *
+ * 在 GeometryProcessor 组装完整属性和 Sutherland-Hodgman 裁剪之前执行，剔除原因依次为：
+ * 1. 屏幕外：三个顶点同时位于任一视锥平面外侧（与 Clipper 的 6 个平面一致）
+ * 2. 退化：齐次行列式 det[x y w] 相对顶点尺度近似为 0（零面积或与视线共面）
+ * 3. 背面：det[x y w] < 0，仅对单面材质生效
+ *
+ * det[x y w] = w0·w1·w2·(NDC 有向面积)，其符号与 Rasterizer 屏幕空间有向面积一致，
+ * 且在顶点跨越 w=0 时依然代表三角形相对视点的朝向，因此无需先做透视除法。
+ */
+class PreClipCuller {
+public:
+    /**
+     * @brief 对一批三角形执行剔除
+     * @param batch        SoA 三角形批次
+     * @param count        批次中有效三角形数量 (1..8)，其余通道忽略
+     * @param cullBackface 是否执行背面剔除（单面材质为 true）
+     * @param stats        剔除原因计数累加到此处
+     * @return 存活掩码，第 i 位为 1 表示第 i 个三角形需要继续处理
+     */
+    uint32_t CullBatch(const PreClipCullBatch& batch, int count, bool cullBackface, RasterStats& stats) const;
+};
+
+} // namespace SR
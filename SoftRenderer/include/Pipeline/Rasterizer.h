@@ -2,6 +2,7 @@
 
 #include <vector>
 #include <cstdint>
+#include <span>
 
 #include "Core/Framebuffer.h"
 #include "Core/DepthBuffer.h"
@@ -10,9 +11,14 @@
 #include "Math/Vec4.h"
 #include "Pipeline/FrameContext.h"
 #include "Pipeline/MaterialTable.h"
+#include "Pipeline/ShaderPermutation.h"
+#include "Pipeline/TileEpilogue.h"
 
 namespace SR {
 
+/// 光栅化 Tile 边长（像素）；分块光源剔除使用同一网格
+constexpr int kRasterTileSize = 32;
+
 /**
  * @brief 表示待光栅化的三角形及其属性
  *
@@ -58,6 +64,17 @@ struct Triangle {
     MaterialHandle materialId = 0;
 };
 
+/**
+ * @brief 仅深度光栅化的三角形（只携带裁剪空间位置）
+ *
+ * 用于阴影贴图等只写深度的 Pass：不做属性设置、材质拷贝和片元着色，两面都光栅化。
+ */
+struct DepthTriangle {
+    Vec4 v0{};
+    Vec4 v1{};
+    Vec4 v2{};
+};
+
 /**
  * @brief 光栅化统计数据
  */
@@ -67,6 +84,31 @@ struct RasterStats {
     uint64_t trianglesRaster = 0;  ///< 进入光栅化阶段的三角形数量
     uint64_t pixelsTested = 0;     ///< 深度测试执行次数
     uint64_t pixelsShaded = 0;     ///< 片元着色器执行次数
+    uint64_t trianglesCulledBackface = 0;   ///< 裁剪前剔除：背面（仅单面材质）
+    uint64_t trianglesCulledDegenerate = 0; ///< 裁剪前剔除：退化/零面积
+    uint64_t trianglesCulledOffscreen = 0;  ///< 裁剪前剔除：完全位于视锥外
+    ShaderPermutationUsage shaderUsage;     ///< 光栅化三角形的着色器变体分布
+    bool tileEpilogueDone = false;          ///< 所有 Tile 均已执行收尾（TileEpilogue）
+};
+
+struct RasterTriangle;
+
+/**
+ * @brief 已完成裁剪、三角形建立与 Tile 分箱的批次（Rasterizer::PrepareTriangles 的结果）
+ *
+ * 数据位于帧级内存，在其回滚前有效；光栅化时就地对 Tile Bin 排序，每个批次只光栅化一次。
+ */
+struct PreparedTriangles {
+    std::span<RasterTriangle> triangles; ///< 屏幕空间三角形
+    std::span<size_t> binOffsets;        ///< 各 Tile 在 binTriIndices 中的起始偏移（Tile 数 + 1 项）
+    std::span<size_t> binTriIndices;     ///< 按 Tile 紧密存储的三角形索引
+    int width = 0;                       ///< 准备时的视口宽度
+    int height = 0;                      ///< 准备时的视口高度
+    int tilesX = 0;                      ///< Tile 列数
+    int tilesY = 0;                      ///< Tile 行数
+    RasterStats stats;                   ///< 裁剪阶段统计（输入 / 裁剪 / 光栅三角形数与变体分布）
+    double clipMs = 0.0;                 ///< 裁剪耗时（毫秒）
+    double binMs = 0.0;                  ///< 分箱耗时（毫秒）
 };
 
 /**
@@ -76,17 +118,60 @@ class Rasterizer {
 public:
     /** @brief 设置渲染目标 */
     void SetTargets(Framebuffer* framebuffer, DepthBuffer* depthBuffer);
-    /** @brief 设置当前帧渲染上下文 */
+    /** @brief 设置当前帧渲染上下文（同时采用其中的帧级临时内存） */
     void SetFrameContext(const FrameContext& context);
+    /**
+     * @brief 设置帧级临时内存（可为空，空时每次调用使用局部分配器）
+     *
+     * 光栅化期间的临时数据从中分配，调用返回前回滚，调用方在其中已分配的数据不受影响。
+     */
+    void SetFrameArena(FrameArena* arena);
+    /**
+     * @brief 设置 Tile 收尾（可为空）；每个 Tile 的最后一个三角形完成后在同一线程内执行
+     *
+     * 仅对 RasterizeTriangles 生效；空 Tile 同样执行。
+     */
+    void SetTileEpilogue(const TileEpilogue* epilogue);
+    /**
+     * @brief 设置取消标志（可为空；SetFrameContext 会采用帧上下文中的标志）
+     *
+     * 置位后跳过剩余 Tile 并尽快返回，结果不完整。
+     */
+    void SetCancelFlag(const std::atomic<bool>* flag);
     /** @brief 执行光栅化渲染 */
     RasterStats RasterizeTriangles(const std::vector<Triangle>& triangles);
     /** @brief 执行光栅化渲染（原始指针版本，避免 vector 开销） */
     RasterStats RasterizeTriangles(const Triangle* triangles, size_t count);
+    /**
+     * @brief 裁剪并分箱，不读写颜色 / 深度目标（只使用帧缓冲尺寸与帧上下文）
+     *
+     * 结果分配在帧级内存中且不回滚（需已设置帧级内存，否则返回空批次），
+     * 可与写渲染目标的工作并发执行。
+     */
+    PreparedTriangles PrepareTriangles(const Triangle* triangles, size_t count);
+    /**
+     * @brief 光栅化已准备的批次（视口须与准备时一致）
+     * @return 仅含光栅阶段统计（像素计数与 Tile 收尾），裁剪统计见 PreparedTriangles::stats
+     */
+    RasterStats RasterizePrepared(const PreparedTriangles& prepared);
+    /**
+     * @brief 仅深度光栅化（只需要深度目标，不读取帧上下文）
+     *
+     * w 均为正的三角形直接光栅化（NDC 超出 [-1,1] 的部分由包围盒裁掉，不做平面裁剪）；
+     * 否则走完整视锥裁剪。每像素只做深度最小值写入。
+     */
+    RasterStats RasterizeDepth(const DepthTriangle* triangles, size_t count);
 
 private:
+    PreparedTriangles PrepareTriangles(const Triangle* triangles, size_t count, FrameArena& arena);
+    RasterStats RasterizePrepared(const PreparedTriangles& prepared, FrameArena& arena);
+
     Framebuffer* m_framebuffer = nullptr;
     DepthBuffer* m_depthBuffer = nullptr;
     FrameContext m_frameContext{};
+    const TileEpilogue* m_tileEpilogue = nullptr;
+    FrameArena* m_frameArena = nullptr;
+    const std::atomic<bool>* m_cancelRequested = nullptr;
 };
 
 } // namespace SR
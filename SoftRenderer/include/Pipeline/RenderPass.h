@@ -1,9 +1,12 @@
 #pragma once
 
+#include <cstdint>
 #include <vector>
 #include <string>
 #include <memory>
 
+#include "Pipeline/ShaderPermutation.h"
+
 namespace SR {
 
 // 前向声明
@@ -14,6 +17,47 @@ struct FrameContext;
 struct RenderStats;
 struct Triangle;
 class MaterialTable;
+struct TileEpilogueSettings;
+class MultiViewGeometry;
+class FrameArena;
+struct PreparedTriangles;
+template<typename T> class ArenaVector;
+
+/// @brief 帧图资源掩码（每一位对应一个 Pass 间共享的资源）
+using FrameResourceMask = uint32_t;
+
+/**
+ * @brief 帧图资源位
+ *
+ * Color / Depth / Output 由渲染器导入（跨帧持久）；BlendTriangles / Materials / BlendBins 为帧图
+ * 临时资源，由 FrameGraph 每帧绑定（半透明三角形及其分箱结果分配在帧级内存中，材质表跨帧复用容量）。
+ * FrameMemory 表示帧级内存本身：光栅化以作用域回滚所有区域，使用它的 Pass 只能依次执行。
+ */
+namespace FrameResource {
+constexpr FrameResourceMask Color          = 1u << 0; ///< 线性 HDR 颜色
+constexpr FrameResourceMask Depth          = 1u << 1; ///< 深度
+constexpr FrameResourceMask Output         = 1u << 2; ///< SDR BGRA8 输出
+constexpr FrameResourceMask BlendTriangles = 1u << 3; ///< 延迟绘制的半透明三角形
+constexpr FrameResourceMask Materials      = 1u << 4; ///< 帧级材质表
+constexpr FrameResourceMask FrameMemory    = 1u << 5; ///< 帧级内存（只声明写入，表示独占使用）
+constexpr FrameResourceMask BlendBins      = 1u << 6; ///< 已裁剪并分箱的半透明三角形
+
+constexpr FrameResourceMask Imported  = Color | Depth | Output;                   ///< 外部导入资源
+constexpr FrameResourceMask Transient = BlendTriangles | Materials | BlendBins;   ///< 帧图临时资源
+} // namespace FrameResource
+
+/**
+ * @brief Pass 的资源读写声明
+ *
+ * overwrites ⊆ writes：该 Pass 无条件覆盖资源的每个元素（不读取旧值），
+ * 帧图据此省略之前的清除。没有先后依赖的两个 Pass 可能并发执行，
+ * 因此它们的声明不能出现“一方写、另一方读或写”的同一资源（由 PassBuilder::Validate 检查）。
+ */
+struct PassResources {
+    FrameResourceMask reads = 0;
+    FrameResourceMask writes = 0;
+    FrameResourceMask overwrites = 0;
+};
 
 /**
  * @brief 渲染上下文，包含 Pass 执行所需的所有数据
@@ -23,8 +67,15 @@ struct RenderContext {
     DepthBuffer* depthBuffer = nullptr;
     const RenderQueue* renderQueue = nullptr;
     const FrameContext* frameContext = nullptr;
-    std::vector<Triangle>* deferredBlendTriangles = nullptr;
+    ArenaVector<Triangle>* deferredBlendTriangles = nullptr; ///< 帧级内存共享区域中的半透明三角形
     MaterialTable* materialTable = nullptr;
+    PreparedTriangles* preparedBlendTriangles = nullptr; ///< 半透明三角形的分箱结果（TransparentSetupPass 写入）
+    FrameArena* transientArena = nullptr;                ///< 帧图临时资源所在的帧级内存
+    const TileEpilogueSettings* tileEpilogue = nullptr; ///< 非空时允许 OpaquePass 在 Tile 内完成收尾
+    const MultiViewGeometry* multiViewGeometry = nullptr; ///< 非空时 OpaquePass 投影共享几何而不重新构建
+
+    bool skyboxFilled = false;   ///< 天空盒已在光栅化 Tile 收尾中填充
+    bool outputResolved = false; ///< SDR 输出已在光栅化 Tile 收尾中写出
 
     /// 当前 Pass 名称（调试用）
     std::string passName;
@@ -42,6 +93,10 @@ struct PassStats {
     uint64_t trianglesRendered = 0; ///< 渲染的三角形数
     uint64_t pixelsTested = 0;      ///< 深度测试总像素数
     uint64_t pixelsShaded = 0;      ///< 最终着色的总像素数
+    uint64_t trianglesCulledBackface = 0;   ///< 裁剪前剔除的背面三角形数
+    uint64_t trianglesCulledDegenerate = 0; ///< 裁剪前剔除的退化三角形数
+    uint64_t trianglesCulledOffscreen = 0;  ///< 裁剪前剔除的视锥外三角形数
+    ShaderPermutationUsage shaderUsage;     ///< 着色器变体使用统计
 };
 
 /**
@@ -77,6 +132,15 @@ public:
      */
     virtual std::string GetName() const = 0;
 
+    /**
+     * @brief 获取 Pass 的资源读写声明（帧图编译时查询一次）
+     * @return 默认保守地声明读写颜色与深度，并独占帧级内存
+     */
+    virtual PassResources GetResources() const {
+        return PassResources{FrameResource::Color | FrameResource::Depth,
+                             FrameResource::Color | FrameResource::Depth | FrameResource::FrameMemory, 0};
+    }
+
     /**
      * @brief 获取 Pass 优先级（用于排序）
      * @return 优先级值（越小越先执行）
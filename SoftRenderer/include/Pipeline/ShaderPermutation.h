@@ -0,0 +1,109 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace SR {
+
+/// @brief 着色器特性掩码（每一位对应一个可在编译期裁剪的着色分支）
+using ShaderFeatureMask = uint32_t;
+
+/**
+ * @brief 着色器特性位
+ *
+ * 材质相关位由 MaterialTable 在添加材质时计算一次；EnvironmentMap 为帧级特性，
+ * 由光栅化器按当前帧是否存在环境贴图合并。每种组合对应一个模板特化的着色器变体。
+ */
+namespace ShaderFeature {
+constexpr ShaderFeatureMask BaseColorMap         = 1u << 0; ///< 基础色贴图
+constexpr ShaderFeatureMask MetallicRoughnessMap = 1u << 1; ///< 金属度-粗糙度贴图
+constexpr ShaderFeatureMask NormalMap            = 1u << 2; ///< 法线贴图
+constexpr ShaderFeatureMask OcclusionMap         = 1u << 3; ///< AO 贴图
+constexpr ShaderFeatureMask EmissiveMap          = 1u << 4; ///< 自发光贴图
+constexpr ShaderFeatureMask Transmission         = 1u << 5; ///< 透射（因子 > 0 或存在透射贴图）
+constexpr ShaderFeatureMask DoubleSided          = 1u << 6; ///< 双面渲染（背向视线时翻转法线）
+constexpr ShaderFeatureMask EnvironmentMap       = 1u << 7; ///< IBL 环境光照（否则为常量环境光）
+
+constexpr uint32_t kCount = 8; ///< 特性位数量
+} // namespace ShaderFeature
+
+/// 着色器变体总数（所有特性组合）
+constexpr size_t kShaderPermutationCount = size_t{1} << ShaderFeature::kCount;
+
+/**
+ * @brief 特性掩码的可读形式，例如 "BC|N|IBL"（无特性时为 "base"）
+ */
+inline std::string FormatShaderFeatureMask(ShaderFeatureMask mask) {
+    static constexpr const char* kNames[ShaderFeature::kCount] = {
+        "BC", "MR", "N", "AO", "E", "T", "DS", "IBL"
+    };
+    std::string result;
+    for (uint32_t bit = 0; bit < ShaderFeature::kCount; ++bit) {
+        if (mask & (1u << bit)) {
+            if (!result.empty()) {
+                result += '|';
+            }
+            result += kNames[bit];
+        }
+    }
+    return result.empty() ? std::string("base") : result;
+}
+
+/**
+ * @brief 每帧着色器变体使用统计（按变体计数光栅化三角形）
+ */
+struct ShaderPermutationUsage {
+    std::array<uint64_t, kShaderPermutationCount> triangles{}; ///< 各变体的三角形数
+
+    /** @brief 记录 count 个使用 mask 变体的三角形 */
+    void Add(ShaderFeatureMask mask, uint64_t count = 1) {
+        triangles[mask & (kShaderPermutationCount - 1)] += count;
+    }
+
+    /** @brief 累加另一份统计 */
+    void Accumulate(const ShaderPermutationUsage& other) {
+        for (size_t i = 0; i < kShaderPermutationCount; ++i) {
+            triangles[i] += other.triangles[i];
+        }
+    }
+
+    /** @brief 本帧实际使用的变体数量 */
+    size_t GetUsedCount() const {
+        return static_cast<size_t>(std::count_if(triangles.begin(), triangles.end(),
+            [](uint64_t n) { return n > 0; }));
+    }
+
+    /**
+     * @brief 按三角形数降序格式化使用最多的变体，例如 "BC|N=1200 base=300"
+     * @param maxEntries 最多输出的变体数
+     */
+    std::string Format(size_t maxEntries) const {
+        std::vector<std::pair<uint64_t, ShaderFeatureMask>> used;
+        for (size_t i = 0; i < kShaderPermutationCount; ++i) {
+            if (triangles[i] > 0) {
+                used.emplace_back(triangles[i], static_cast<ShaderFeatureMask>(i));
+            }
+        }
+        std::sort(used.begin(), used.end(), [](const auto& a, const auto& b) {
+            return a.first != b.first ? a.first > b.first : a.second < b.second;
+        });
+
+        std::string result;
+        char entry[64];
+        for (size_t i = 0; i < used.size() && i < maxEntries; ++i) {
+            std::snprintf(entry, sizeof(entry), "%s%s=%llu", result.empty() ? "" : " ",
+                          FormatShaderFeatureMask(used[i].second).c_str(),
+                          static_cast<unsigned long long>(used[i].first));
+            result += entry;
+        }
+        return result;
+    }
+};
+
+} // namespace SR
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "Core/DepthBuffer.h"
+#include "Core/FrameArena.h"
+#include "Math/Mat4.h"
+#include "Math/Vec3.h"
+#include "Pipeline/Rasterizer.h"
+
+namespace SR {
+
+class RenderQueue;
+struct FrameContext;
+
+/// 级联数上限
+constexpr int kMaxShadowCascades = 4;
+
+/**
+ * @brief 级联阴影贴图选项
+ */
+struct ShadowMapOptions {
+    bool enabled = true;        ///< 是否为主平行光（FrameContext::lights[0]）生成阴影
+    int cascadeCount = 3;       ///< 级联数（1..kMaxShadowCascades）
+    int resolution = 1024;      ///< 每级阴影贴图边长（像素）
+    double maxDistance = 40.0;  ///< 阴影覆盖的最远视空间深度（不超过 zFar）
+    double splitLambda = 0.6;   ///< 对数 / 均匀分割的混合系数（1 为纯对数分割）
+    double depthBias = 1.5;     ///< 深度偏移（纹素数，按每级纹素世界尺寸换算）
+    double normalBias = 1.0;    ///< 沿法线的采样点偏移（纹素数）
+};
+
+/**
+ * @brief 单级阴影贴图的采样参数
+ */
+struct ShadowCascade {
+    Mat4 worldToShadow = Mat4::Identity(); ///< 世界空间 → (纹素 x, 纹素 y, 归一化深度)
+    double splitDepth = 0.0;               ///< 该级覆盖的最远视空间深度
+    double normalOffset = 0.0;             ///< 沿法线的采样点偏移（世界单位）
+    double depthBias = 0.0;                ///< 深度偏移（归一化深度）
+    const double* depth = nullptr;         ///< 深度数据（行主序，resolution × resolution）
+};
+
+/**
+ * @brief 片元阶段读取的阴影数据（由 CascadedShadowMap 填充，按指针传给 FragmentContext）
+ */
+struct ShadowMapData {
+    ShadowCascade cascades[kMaxShadowCascades]; ///< 由近到远的各级参数
+    int cascadeCount = 0;                       ///< 有效级数（0 表示无阴影）
+    int resolution = 0;                         ///< 阴影贴图边长
+    Vec3 viewDepthAxis{0.0, 0.0, 1.0};          ///< 视空间深度 = dot(worldPos, viewDepthAxis) + viewDepthOffset
+    double viewDepthOffset = 0.0;               ///< 视空间深度常量项
+    size_t lightIndex = 0;                      ///< 投射阴影的平行光下标（FrameContext::lights）
+};
+
+/**
+ * @brief 变换到光源空间的投射体（CascadedShadowMap::PrepareCasters 的结果）
+ *
+ * 只取决于渲染队列与光源方向，与相机无关，可供多个视图的级联复用。
+ * 顶点位于帧级内存中，在其回滚之前有效。
+ */
+struct ShadowCasters {
+    std::span<const Vec3> vertices;   ///< 光源空间三角形顶点（每 3 个构成一个三角形）
+    Mat4 lightView = Mat4::Identity(); ///< 世界空间 → 光源空间
+    double minDepth = 0.0;            ///< 投射体最近的光源空间深度
+    double maxDepth = 0.0;            ///< 投射体最远的光源空间深度
+};
+
+/**
+ * @brief 计算世界空间点对投射阴影平行光的可见度
+ *
+ * 按视空间深度选择级联，沿法线偏移后投影到阴影贴图，做 4×4 纹素的帐篷权重 PCF
+ * （等价于 3×3 个双线性比较样本的平均）；每行 4 个纹素用一次 AVX2 比较完成。
+ * 超出最远级联的点返回 1。
+ *
+ * @param data     阴影数据
+ * @param worldPos 世界空间位置
+ * @param normal   世界空间单位法线（用于法线偏移）
+ * @return 可见度 [0, 1]
+ */
+double SampleShadow(const ShadowMapData& data, const Vec3& worldPos, const Vec3& normal);
+
+/**
+ * @brief 主平行光的级联阴影贴图（每帧构建一次，跨帧复用缓冲）
+ *
+ * 投射体：渲染队列中 alphaMode 为 Opaque 的绘制项。仅深度路径不采样纹理，
+ * Mask（镂空）与 Blend 材质无法得到正确的轮廓，因此不投射阴影。投射体顶点每帧只变换一次到光源空间，各级联只做
+ * 缩放平移后交给 Rasterizer::RasterizeDepth 按 Tile 并行光栅化。
+ *
+ * 级联按对数 / 均匀混合分割相机视锥；每级以视锥切片的包围球拟合正交投影，
+ * 中心对齐到纹素网格，相机平移 / 旋转时阴影边缘不闪烁。
+ */
+class CascadedShadowMap {
+public:
+    /**
+     * @brief 构建阴影贴图
+     * @param queue   渲染队列（投射体来源）
+     * @param frame   帧上下文（相机矩阵、平行光；临时数据分配在其帧级内存中）
+     * @param options 阴影选项
+     * @return 是否生成了阴影（无平行光、选项关闭或无投射体时为 false）
+     */
+    bool Build(const RenderQueue& queue, const FrameContext& frame, const ShadowMapOptions& options);
+
+    /**
+     * @brief 收集投射体并变换到光源空间（Build 的第一步，与相机无关）
+     * @param queue   渲染队列（投射体来源）
+     * @param frame   帧上下文（只使用平行光）
+     * @param options 阴影选项
+     * @param arena   顶点所在的帧级内存（不回滚，由调用方的作用域或帧末释放）
+     * @param casters 输出的投射体
+     * @return 是否有投射体（无平行光、选项关闭或无投射体时为 false）
+     */
+    static bool PrepareCasters(const RenderQueue& queue, const FrameContext& frame, const ShadowMapOptions& options,
+                               FrameArena& arena, ShadowCasters& casters);
+
+    /**
+     * @brief 为当前相机拟合级联并光栅化已准备的投射体（Build 的第二步）
+     * @param casters 投射体（光源方向须与 frame.lights[0] 一致）
+     * @param frame   帧上下文（相机矩阵；临时数据分配在其帧级内存中）
+     * @param options 阴影选项
+     * @return 是否生成了阴影
+     */
+    bool BuildCascades(const ShadowCasters& casters, const FrameContext& frame, const ShadowMapOptions& options);
+
+    /** @brief 清空阴影（GetData().cascadeCount 置 0） */
+    void Clear();
+
+    /** @brief 片元阶段使用的阴影数据 */
+    const ShadowMapData& GetData() const { return m_data; }
+
+    /** @brief 最近一次构建的投射体三角形数 */
+    size_t GetCasterTriangleCount() const { return m_casterTriangleCount; }
+
+    /** @brief 最近一次构建各级联光栅化的统计之和 */
+    const RasterStats& GetRasterStats() const { return m_rasterStats; }
+
+private:
+    /** @brief 将投射体三角形变换到光源空间（顶点写入帧级内存），返回光源空间深度范围 */
+    static bool GatherCasters(const RenderQueue& queue, const Mat4& lightView, FrameArena& arena,
+                              ArenaVector<Vec3>& casterVertices, double& minDepth, double& maxDepth);
+
+    ShadowMapData m_data;                              ///< 片元阶段读取的参数
+    DepthBuffer m_depth[kMaxShadowCascades];           ///< 各级深度贴图
+    size_t m_casterTriangleCount = 0;                  ///< 最近一次构建的投射体三角形数
+    RasterStats m_rasterStats;                         ///< 光栅化统计
+};
+
+} // namespace SR
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "Math/Vec3.h"
+
+namespace SR {
+
+class DepthBuffer;
+class EnvironmentMap;
+class Framebuffer;
+struct FrameContext;
+
+/**
+ * @brief 屏幕像素 → 世界空间视线方向（未归一化）的增量步进器
+ *
+ * 近 / 远平面在视空间中是常深度平面，其上的点与 NDC 成仿射关系，两者之差（视线方向）
+ * 对像素坐标也是仿射的：dir(x, y) = origin + x · stepX + y · stepY。
+ * 每帧用逆 VP 求一次三个角点，之后逐像素只需加法，替代每像素两次 Mat4 乘法与透视除法。
+ */
+struct ViewRayStepper {
+    Vec3 origin{};  ///< 像素 (0, 0) 中心的视线方向
+    Vec3 stepX{};   ///< x 方向每像素增量
+    Vec3 stepY{};   ///< y 方向每像素增量
+
+    /** @brief 由帧上下文的 view / projection 构建（像素中心约定与 SkyboxPass 一致） */
+    static ViewRayStepper FromFrame(const FrameContext& frame, int width, int height);
+
+    /** @brief 像素 (x, y) 的视线方向（未归一化） */
+    Vec3 At(int x, int y) const {
+        return Vec3{origin.x + stepX.x * x + stepY.x * y,
+                    origin.y + stepX.y * x + stepY.y * y,
+                    origin.z + stepX.z * x + stepY.z * y};
+    }
+};
+
+/**
+ * @brief 用环境贴图填充矩形区域内未被几何覆盖（深度为远平面）的像素
+ * @param minX, minY, maxX, maxY 像素矩形（闭区间）
+ */
+void FillSkyRect(const EnvironmentMap& environment, const ViewRayStepper& rays, const double* depth,
+                 Vec3* linearPixels, int width, int minX, int minY, int maxX, int maxY);
+
+/**
+ * @brief 允许的 Tile 收尾工作（由管线根据后续 Pass 是否还需要线性颜色决定）
+ */
+struct TileEpilogueSettings {
+    bool resolveOutput = false; ///< 允许在 Tile 内完成色调映射与 sRGB 输出（无 FXAA 时）
+    double exposure = 1.0;      ///< 色调映射曝光
+};
+
+/**
+ * @brief Tile 收尾：某个 Tile 的最后一个不透明三角形光栅化完成后立即执行
+ *
+ * 趁 Tile 的深度与颜色仍在缓存中，填充天空盒背景，并（可选）色调映射后写出 BGRA8。
+ * 只处理本 Tile 的像素，可由多个线程对不同 Tile 并发调用。
+ * 需要相邻像素的效果（FXAA）不能在 Tile 内完成，仍由全帧 Pass 处理。
+ */
+class TileEpilogue {
+public:
+    /**
+     * @brief 设置本帧参数
+     * @param frame       帧上下文（相机矩阵）
+     * @param framebuffer 颜色目标
+     * @param depthBuffer 深度目标
+     * @param sky         非空时填充天空盒
+     * @param resolve     是否色调映射并写 BGRA8
+     * @param exposure    色调映射曝光
+     */
+    void Setup(const FrameContext& frame, Framebuffer* framebuffer, const DepthBuffer* depthBuffer,
+               const EnvironmentMap* sky, bool resolve, double exposure);
+
+    /** @brief 是否有收尾工作 */
+    bool IsActive() const { return m_framebuffer && (m_sky || m_resolve); }
+
+    /** @brief 是否填充天空盒 */
+    bool FillsSky() const { return m_sky != nullptr; }
+
+    /** @brief 是否写出 SDR 结果 */
+    bool ResolvesOutput() const { return m_resolve; }
+
+    /** @brief 处理一个 Tile（像素闭区间） */
+    void Run(int minX, int minY, int maxX, int maxY) const;
+
+private:
+    Framebuffer* m_framebuffer = nullptr;
+    const double* m_depth = nullptr;
+    const EnvironmentMap* m_sky = nullptr;
+    ViewRayStepper m_rays{};
+    bool m_resolve = false;
+    double m_exposure = 1.0;
+};
+
+} // namespace SR
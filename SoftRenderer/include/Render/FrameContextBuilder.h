@@ -5,6 +5,7 @@
 namespace SR {
 
 class Scene;
+class LightGroup;
 
 /**
  * @brief 帧上下文构建选项，包含相机和光照的默认参数
@@ -29,6 +30,12 @@ public:
     FrameContext Build(const Scene& scene, int width, int height) const;
     /** @brief 使用自定义选项构建帧上下文 */
     FrameContext Build(const Scene& scene, int width, int height, const FrameContextOptions& options) const;
+    /**
+     * @brief 将场景光源写入帧上下文
+     *
+     * 光源组非空时原样使用其平行光、点光与聚光；为空（或 nullptr）时只添加选项中的默认平行光。
+     */
+    void ApplyLights(const LightGroup* lights, const FrameContextOptions& options, FrameContext& frameContext) const;
 };
 
 } // namespace SR
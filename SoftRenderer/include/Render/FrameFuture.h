@@ -0,0 +1,74 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+#include "Render/FrameSlot.h"
+
+namespace SR {
+
+/// 异步帧的状态
+enum class FrameStatus {
+    Pending,    ///< 尚未完成
+    Completed,  ///< 已完成，结果可用
+    Cancelled   ///< 已取消（结果不完整，像素指针为空）
+};
+
+/**
+ * @brief 异步帧的句柄（Renderer::RenderAsync 的返回值）
+ *
+ * 可复制，所有副本共享同一帧的状态。完成回调在帧结束（完成或取消）时于后端线程调用一次，
+ * 全部返回后 Wait 才返回；若注册时帧已结束则在注册线程立即调用。
+ * Cancel 只是请求：后端在 Pass 之间与 Tile 之间检查，之后尽快放弃该帧。
+ */
+class FrameFuture {
+public:
+    FrameFuture() = default;
+
+    /** @brief 是否关联了某一帧 */
+    bool IsValid() const { return m_state != nullptr; }
+
+    /** @brief 帧序号（无效句柄为 0） */
+    uint64_t GetFrameId() const;
+
+    /** @brief 当前状态 */
+    FrameStatus GetStatus() const;
+
+    /** @brief 帧是否已结束（完成或取消） */
+    bool IsReady() const { return GetStatus() != FrameStatus::Pending; }
+
+    /** @brief 阻塞直到帧结束，返回最终状态 */
+    FrameStatus Wait() const;
+
+    /** @brief 阻塞直到帧结束并返回结果（取消时 cancelled 为 true） */
+    const CompletedFrame& Get() const;
+
+    /** @brief 请求取消（帧已结束时无效果） */
+    void Cancel();
+
+    /** @brief 是否已请求取消 */
+    bool IsCancelRequested() const;
+
+    /** @brief 注册完成回调（可注册多个，按注册顺序调用） */
+    void Then(FrameCallback callback);
+
+private:
+    friend class Renderer;
+    struct State;
+
+    explicit FrameFuture(std::shared_ptr<State> state) : m_state(std::move(state)) {}
+
+    /** @brief 创建新帧的句柄 */
+    static FrameFuture Create(uint64_t frameId);
+
+    /** @brief 供帧上下文引用的取消标志 */
+    const std::atomic<bool>* GetCancelFlag() const;
+
+    /** @brief 标记帧结束并调用回调 */
+    void Finish(const CompletedFrame& frame);
+
+    std::shared_ptr<State> m_state;
+};
+
+} // namespace SR
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Core/FrameArena.h"
+#include "Pipeline/MaterialTable.h"
+#include "Pipeline/PassBuilder.h"
+#include "Pipeline/Rasterizer.h"
+#include "Pipeline/RenderPass.h"
+
+namespace SR {
+
+/**
+ * @brief 影响 Pass 实例配置的设置；仅当其变化时帧图才重新编译
+ */
+struct FrameGraphSettings {
+    bool enableFXAA = false;     ///< 是否开启 FXAA
+    bool enableToneMap = true;   ///< 是否开启色调映射（HDR 输出时为 false）
+    double exposure = 1.0;       ///< 色调映射曝光
+
+    bool operator==(const FrameGraphSettings& other) const = default;
+};
+
+/**
+ * @brief 编译后的持久帧图
+ *
+ * 由 PassBuilder 编译一次：按依赖拓扑序保存 Pass 实例及其直接前驱，校验每个 Pass 读取的资源
+ * 均为导入资源或已由之前的 Pass 写入，并据此求出帧首真正需要清除的导入资源
+ * （首次读取前会被某个 Pass 完整覆盖的资源无需清除）。
+ * 临时资源每帧复位：半透明三角形及其分箱结果分配在帧级内存的共享区域，材质表由帧图持有并保留容量。
+ */
+class FrameGraph {
+public:
+    /// 编译时对每个 Pass 实例的配置回调（在校验资源声明之前调用）
+    using PassConfigurator = PassBuilder::PassConfigurator;
+
+    /**
+     * @brief 从构建器编译帧图（构建器中的 Pass 被移入帧图）
+     * @param builder   已注册 Pass 与依赖的构建器
+     * @param configure 可选的 Pass 配置回调
+     * @return 失败时帧图为空，错误信息见 GetError()
+     */
+    bool Compile(PassBuilder& builder, const PassConfigurator& configure = {});
+
+    /** @brief 是否已成功编译 */
+    bool IsCompiled() const { return !m_passes.empty(); }
+
+    /** @brief 获取编译错误信息 */
+    const std::string& GetError() const { return m_error; }
+
+    /** @brief 按执行顺序排列的 Pass */
+    std::vector<std::unique_ptr<RenderPass>>& GetPasses() { return m_passes; }
+
+    /** @brief 每个 Pass 的直接前驱（下标对应 GetPasses()） */
+    const PassDependencies& GetDependencies() const { return m_dependencies; }
+
+    /** @brief 帧首需要清除的导入资源 */
+    FrameResourceMask GetClearMask() const { return m_clearMask; }
+
+    /**
+     * @brief 复位本帧使用的临时资源并绑定到渲染上下文
+     * @param arena 本帧的帧级内存；nullptr 时使用帧图自带的分配器（每次绑定时复位）
+     */
+    void BindTransients(RenderContext& context, FrameArena* arena);
+
+private:
+    std::vector<std::unique_ptr<RenderPass>> m_passes;
+    PassDependencies m_dependencies;           ///< 每个 Pass 的直接前驱
+    FrameResourceMask m_clearMask = FrameResource::Imported;
+    FrameResourceMask m_transients = 0;        ///< 被任一 Pass 使用的临时资源
+    ArenaVector<Triangle> m_blendTriangles;    ///< 临时资源：延迟半透明三角形（每帧绑定到帧级内存）
+    PreparedTriangles m_preparedBlendTriangles; ///< 临时资源：半透明三角形的分箱结果（数据位于帧级内存）
+    FrameArena m_fallbackArena;                ///< 调用方未提供帧级内存时使用
+    MaterialTable m_materialTable;             ///< 临时资源：帧级材质表
+    std::string m_error;
+};
+
+} // namespace SR
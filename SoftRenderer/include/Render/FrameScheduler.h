@@ -0,0 +1,77 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace SR {
+
+/**
+ * @brief 多帧流水线的后端线程
+ *
+ * 前端（调用 Renderer::Render 的线程）完成帧准备后把该帧的后端工作（清除、Pass 执行、统计）
+ * 提交到这里，后端线程按提交顺序逐帧执行；帧序号即围栏，可查询或等待某帧完成。
+ * 后端线程在首次提交时才创建。
+ */
+class FrameScheduler {
+public:
+    using Task = std::function<void()>;
+
+    FrameScheduler() = default;
+    ~FrameScheduler();
+
+    FrameScheduler(const FrameScheduler&) = delete;
+    FrameScheduler& operator=(const FrameScheduler&) = delete;
+
+    /**
+     * @brief 分配下一个帧序号（从 1 开始递增）
+     */
+    uint64_t NextFrameId() { return ++m_lastFrameId; }
+
+    /**
+     * @brief 提交帧的后端工作（帧序号须按 NextFrameId 的顺序提交）
+     * @param frameId 帧序号
+     * @param task 后端工作；执行完毕后该帧视为完成
+     */
+    void Submit(uint64_t frameId, Task task);
+
+    /**
+     * @brief 在当前线程直接完成一帧（同步模式，不经过后端线程）
+     */
+    void CompleteInline(uint64_t frameId, const Task& task);
+
+    /** @brief 帧是否已完成（frameId 为 0 视为已完成） */
+    bool IsComplete(uint64_t frameId) const;
+
+    /** @brief 阻塞直到帧完成 */
+    void Wait(uint64_t frameId) const;
+
+    /** @brief 阻塞直到所有已提交的帧完成 */
+    void WaitIdle() const { Wait(m_lastFrameId); }
+
+    /** @brief 最近一个完成的帧序号（0 表示尚无） */
+    uint64_t GetCompletedFrameId() const;
+
+private:
+    struct Pending {
+        uint64_t frameId = 0;
+        Task task;
+    };
+
+    void ThreadLoop();
+    void MarkComplete(uint64_t frameId);
+
+    std::thread m_thread;
+    mutable std::mutex m_mutex;
+    mutable std::condition_variable m_submitted;  ///< 有新帧提交或需要退出
+    mutable std::condition_variable m_completed;  ///< 有帧完成
+    std::deque<Pending> m_pending;
+    uint64_t m_lastFrameId = 0;       ///< 最近分配的帧序号（只由前端线程访问）
+    uint64_t m_completedFrameId = 0;  ///< 最近完成的帧序号（帧按序完成）
+    bool m_stopping = false;
+};
+
+} // namespace SR
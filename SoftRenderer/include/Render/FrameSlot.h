@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+#include "Core/DepthBuffer.h"
+#include "Core/FrameArena.h"
+#include "Core/Framebuffer.h"
+#include "Pipeline/LightCuller.h"
+#include "Pipeline/MultiViewGeometry.h"
+#include "Pipeline/ShadowMap.h"
+#include "Render/RenderPipeline.h"
+#include "Scene/RenderQueue.h"
+
+namespace SR {
+
+/**
+ * @brief 一帧渲染独占的可变资源
+ *
+ * 流水线模式下 Renderer 持有 framesInFlight + 1 个帧槽并轮换：前端为帧 N+1 准备
+ * 光源、阴影和渲染队列的同时，后端仍在用另一个帧槽光栅化帧 N，最近完成帧所在的帧槽保持不变。
+ * 帧槽在其上一帧完成后才会被复用。
+ */
+struct FrameSlot {
+    Framebuffer framebuffer;
+    DepthBuffer depthBuffer;
+    FrameArena frameArena;        ///< 帧级临时内存（后端结束时复位）
+    LightCuller lightCuller;      ///< 分块局部光源列表
+    CascadedShadowMap shadowMap;  ///< 主平行光级联阴影
+    RenderPipeline pipeline;      ///< 默认管线帧图（含帧图临时资源）
+    RenderQueue queue;            ///< 本帧渲染队列（Scene 每帧构建；流水线模式下为 GPUScene 持久队列的只读快照）
+    MultiViewGeometry multiViewGeometry; ///< 多视图渲染共享的世界空间几何
+    DepthBuffer viewDepthBuffer;  ///< 多视图渲染的深度缓冲（按视图目标尺寸调整）
+    uint64_t frameId = 0;         ///< 最近一次使用该帧槽的帧序号
+};
+
+/**
+ * @brief 完成帧的信息（帧完成回调的参数）
+ *
+ * 像素指针指向该帧的帧槽，在之后再提交 framesInFlight 帧之前保持有效。
+ */
+struct CompletedFrame {
+    uint64_t frameId = 0;
+    const uint32_t* pixels = nullptr;      ///< SDR BGRA8 输出
+    const Vec3* linearPixels = nullptr;    ///< 线性 HDR 颜色
+    int width = 0;
+    int height = 0;
+    RenderStats stats{};
+    double totalMs = 0.0;                  ///< 帧耗时（前端准备 + 清除 + Pass 执行，不含排队）
+    bool cancelled = false;                ///< 帧被取消（像素指针为空）
+};
+
+/// 帧完成回调（流水线模式与 RenderAsync 下在后端线程调用，回调内不要等待本帧；被取消的帧不触发）
+using FrameCallback = std::function<void(const CompletedFrame&)>;
+
+} // namespace SR
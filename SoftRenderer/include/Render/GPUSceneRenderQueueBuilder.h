@@ -9,12 +9,33 @@ class GPUScene;
 /**
  * @brief GPUScene 到渲染队列的构建器
  * 
- * 将扁平化的 GPUScene 数据转换为渲染管线可执行的 RenderQueue
+ * 将扁平化的 GPUScene 数据转换为渲染管线可执行的 RenderQueue。
+ * Build 每次整体重建；Update 面向跨帧持久的队列，依据 GPUScene 版本号增量同步。
  */
 class GPUSceneRenderQueueBuilder {
 public:
     /** @brief 从 GPUScene 提取信息并填充到渲染队列中 */
     void Build(const GPUScene& scene, RenderQueue& outQueue, int onlyMaterialIndex = -1) const;
+
+    /**
+     * @brief 增量同步持久渲染队列
+     *
+     * - 场景版本未变：不做任何事
+     * - 场景仅追加了渲染项：只把新增项追加到队列
+     * - 其他情况（Clear / SetItems / 切换场景或过滤条件）：整体重建
+     *
+     * @return 本次是否修改了队列内容
+     */
+    bool Update(const GPUScene& scene, RenderQueue& queue, int onlyMaterialIndex = -1);
+
+private:
+    const GPUScene* m_syncedScene = nullptr; ///< 上次同步的场景
+    const RenderQueue* m_syncedQueue = nullptr; ///< 上次同步的队列
+    uint64_t m_syncedRevision = 0;           ///< 上次同步时的场景版本
+    uint64_t m_syncedLayoutRevision = 0;     ///< 上次同步时的非追加式变更版本
+    size_t m_syncedItemCount = 0;            ///< 已同步的普通渲染项数量
+    size_t m_syncedInstancedCount = 0;       ///< 已同步的实例化渲染项数量
+    int m_syncedFilter = -1;                 ///< 上次同步使用的材质过滤
 };
 
 } // namespace SR
@@ -6,6 +6,8 @@
 
 namespace SR {
 
+class MultiViewGeometry;
+
 /**
  * @brief 渲染 Pass 上下文，包含单次渲染所需的所有资源和配置
  */
@@ -16,6 +18,8 @@ struct PassContext {
     bool enableFXAA = false;          ///< 是否开启 FXAA 抗锯齿
     bool enableToneMap = true;       ///< 是否开启色调映射 (HDR -> sRGB)
     double exposure = 1.0;            ///< 曝光度
+    bool enableTileEpilogue = true;   ///< 是否在光栅化 Tile 内完成天空填充 / 输出
+    MultiViewGeometry* multiViewGeometry = nullptr; ///< 多视图共享几何（非空时跳过逐帧几何构建，材质取自其中）
 };
 
 } // namespace SR
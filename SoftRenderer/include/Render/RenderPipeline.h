@@ -2,6 +2,7 @@
 
 #include <vector>
 #include <memory>
+#include "Render/FrameGraph.h"
 #include "Render/PassContext.h"
 #include "Scene/RenderQueue.h"
 #include "Pipeline/RenderPass.h"
@@ -21,22 +22,35 @@ struct RenderStats {
     uint64_t trianglesRaster = 0;   ///< 进入光栅化的总三角形数
     uint64_t pixelsTested = 0;      ///< 深度测试总像素数
     uint64_t pixelsShaded = 0;      ///< 最终着色的总像素数
+    uint64_t trianglesCulledBackface = 0;   ///< 裁剪前剔除的背面三角形数
+    uint64_t trianglesCulledDegenerate = 0; ///< 裁剪前剔除的退化三角形数
+    uint64_t trianglesCulledOffscreen = 0;  ///< 裁剪前剔除的视锥外三角形数
+    ShaderPermutationUsage shaderUsage;     ///< 本帧着色器变体使用统计
 };
 
 /**
  * @brief 渲染管线类，协调几何处理、光栅化和后处理流程
  *
  * 支持两种渲染模式：
- * 1. 传统模式：使用 Render() 方法执行固定管线流程
+ * 1. 传统模式：使用 Render() 方法执行默认管线（编译为持久帧图，跨帧复用）
  * 2. Pass 模式：使用 ExecutePasses() 执行可配置的 Pass 管线
  */
 class RenderPipeline {
 public:
     /**
-     * @brief 执行完整渲染流程
+     * @brief 按设置编译默认管线的帧图；设置未变化且已编译时直接返回
+     * @return 帧图是否可用
+     */
+    bool Configure(const FrameGraphSettings& settings);
+
+    /** @brief 帧首需要清除的导入资源（未编译时为全部） */
+    FrameResourceMask GetClearMask() const { return m_frameGraph.GetClearMask(); }
+
+    /**
+     * @brief 执行完整渲染流程（目标缓冲由调用方按 GetClearMask() 清除）
      * @return 该帧的完整渲染统计信息
      */
-    RenderStats Render(const RenderQueue& queue, const PassContext& pass) const;
+    RenderStats Render(const RenderQueue& queue, const PassContext& pass);
 
     /**
      * @brief 使用 Pass 系统执行渲染管线
@@ -47,6 +61,20 @@ public:
     RenderStats ExecutePasses(std::vector<std::unique_ptr<RenderPass>>& passes,
                               RenderContext& context) const;
 
+    /**
+     * @brief 按依赖图执行 Pass：互不依赖的 Pass 在任务系统上并发执行
+     *
+     * 仅 JobSystem 后端且依赖图不是单链时并发（OpenMP 嵌套并行区会退化为单线程），
+     * 否则等同于按顺序执行。统计按 Pass 顺序汇总，与执行顺序无关。
+     * @param passes 按依赖关系排序的 Pass 列表
+     * @param dependencies 每个 Pass 的直接前驱（见 PassBuilder::Build）
+     * @param context 渲染上下文
+     * @return 汇总的渲染统计信息
+     */
+    RenderStats ExecutePasses(std::vector<std::unique_ptr<RenderPass>>& passes,
+                              const PassDependencies& dependencies,
+                              RenderContext& context) const;
+
     /**
      * @brief 执行单个 Pass
      * @param pass Pass 实例
@@ -54,6 +82,10 @@ public:
      * @return Pass 统计信息
      */
     PassStats ExecutePass(RenderPass& pass, RenderContext& context) const;
+
+private:
+    FrameGraph m_frameGraph;           ///< 默认管线编译结果（Pass 实例与临时资源常驻）
+    FrameGraphSettings m_settings{};   ///< 当前帧图对应的设置
 };
 
 } // namespace SR
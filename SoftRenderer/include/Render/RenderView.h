@@ -0,0 +1,22 @@
+#pragma once
+
+#include "Math/Mat4.h"
+#include "Math/Vec3.h"
+
+namespace SR {
+
+class Framebuffer;
+
+/**
+ * @brief 多视图渲染中的一个视图（Renderer::RenderViews 的参数）
+ *
+ * 输出写入调用方持有的帧缓冲，其尺寸决定该视图的分辨率；投影矩阵的宽高比应与之匹配。
+ */
+struct RenderView {
+    Mat4 view = Mat4::Identity();        ///< 观察矩阵（世界空间 → 相机空间）
+    Mat4 projection = Mat4::Identity();  ///< 投影矩阵（相机空间 → 裁剪空间）
+    Vec3 cameraPos{0.0, 0.0, 0.0};       ///< 视点（光照与半透明排序）
+    Framebuffer* target = nullptr;       ///< 输出目标（为空的视图被跳过）
+};
+
+} // namespace SR
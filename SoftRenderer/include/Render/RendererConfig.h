@@ -1,12 +1,18 @@
 #pragma once
 
+#include "Core/FrameArena.h"
+#include "Core/Parallel.h"
 #include "Render/FrameContextBuilder.h"
 #include "Math/Mat4.h"
+#include "Pipeline/ShadowMap.h"
 
 namespace SR {
 
 class EnvironmentMap;
 
+/// 流水线模式下同时在途的最大帧数
+constexpr int kMaxFramesInFlight = 3;
+
 /**
  * @brief 渲染器全局配置选项
  */
@@ -15,17 +21,22 @@ struct RendererConfig {
     bool enableFXAA = true;               ///< 是否开启抗锯齿
     bool enableToneMap = true;            ///< 是否开启色调映射
     double exposure = 1.0;                 ///< 渲染曝光强度
+    bool enableTileEpilogue = true;       ///< 天空填充 / 色调映射在光栅化 Tile 内完成（无 FXAA 时才含色调映射）
     int debugOnlyMaterialIndex = -1;      ///< 调试: 仅渲染指定材质索引, -1 表示不过滤
     bool useViewOverride = false;         ///< 是否覆盖视图矩阵 (如用于调试)
     Mat4 viewOverride = Mat4::Identity();  ///< 覆盖用的视图矩阵
     bool useCameraPosOverride = false;    ///< 是否覆盖相机位置
     Vec3 cameraPosOverride{0.0, 0.0, 0.0}; ///< 覆盖用的相机位置
     const EnvironmentMap* environmentMap = nullptr; ///< IBL 环境贴图（可选）
+    ShadowMapOptions shadows{};           ///< 主平行光级联阴影配置
     OpenMPTuningOptions openmp{};         ///< OpenMP 并行调优配置（内部可用）
+    FrameArenaOptions frameArena{};       ///< 帧级临时内存的大页 / 收缩策略
+    ParallelOptions parallel{};           ///< 并行后端（OpenMP / 工作窃取任务系统）、线程数与共享线程池
+    int framesInFlight = 1;               ///< 在途帧数：1 为同步渲染，2~3 时 Render 完成前端准备即返回
 
     /** @brief 获取默认配置 */
     static RendererConfig Default();
-    /** @brief 规范化配置边界（chunk >= 1） */
+    /** @brief 规范化配置边界（chunk >= 1，阴影级数 / 分辨率，帧级内存收缩参数，在途帧数） */
     void Sanitize();
 };
 
@@ -7,7 +7,10 @@
 #include "Asset/GLTFAsset.h"
 #include "Material/PBRMaterial.h"
 #include "Math/Mat4.h"
+#include "Scene/InstanceTransform.h"
+#include "Scene/LightGroup.h"
 #include "Scene/Mesh.h"
+#include "Scene/PreparedTexture.h"
 #include "Scene/TextureBinding.h"
 #include "Runtime/MeshPool.h"
 #include "Runtime/MaterialPool.h"
@@ -26,6 +29,36 @@ struct GPUSceneDrawItem {
     TextureBindingArray textures{};
 };
 
+/**
+ * @brief 实例化渲染项：同一网格 + 同一材质 + 多份实例变换
+ *
+ * 由重复引用同一网格的节点或 EXT_mesh_gpu_instancing 扩展生成。
+ * GeometryProcessor 对整批实例共享顶点读取与索引校验，仅逐实例执行变换。
+ */
+struct GPUSceneInstancedDrawItem {
+    const Mesh* mesh = nullptr;
+    const PBRMaterial* material = nullptr;
+    int meshIndex = -1;
+    int materialIndex = -1;
+    int primitiveIndex = -1;
+    TextureBindingArray textures{};
+    std::vector<InstanceTransform> instances;
+};
+
+/**
+ * @brief GPUScene 构建选项
+ */
+struct GPUSceneBuildOptions {
+    bool packVertices = true;                                      ///< 是否将网格顶点压缩为打包格式
+    VertexPositionFormat positionFormat = VertexPositionFormat::UNorm16; ///< 打包位置格式
+    bool releaseSourceVertices = true;                             ///< 打包后释放双精度顶点以节省内存
+    bool optimizeMeshes = false;                                   ///< 是否执行加载期网格优化（顶点缓存/overdraw/顶点读取重排）
+    MeshOptimizeOptions optimizeOptions{};                         ///< 网格优化参数
+    bool prepareTextures = true;                                   ///< 是否将被引用的图像预处理为采样就绪纹理
+    bool generateMipmaps = true;                                   ///< 是否为以 mipmap 过滤采样的纹理生成 mip 链（需 prepareTextures）
+    bool compressTextures = false;                                 ///< 是否以 BCn 块压缩存储采样就绪纹理（有损，需 prepareTextures）
+};
+
 /**
  * @brief 扁平化的渲染场景，由 DrawItem 列表组成
  *
@@ -57,12 +90,30 @@ public:
     void Clear();
     /** @brief 获取所有渲染项列表 */
     const std::vector<GPUSceneDrawItem>& GetItems() const;
+    /** @brief 添加一个实例化渲染项 */
+    void AddInstancedDrawable(GPUSceneInstancedDrawItem item);
+    /** @brief 获取所有实例化渲染项列表 */
+    const std::vector<GPUSceneInstancedDrawItem>& GetInstancedItems() const;
+    /** @brief 获取全部实例总数 */
+    size_t GetInstanceCount() const;
+    /**
+     * @brief 内容版本：渲染项任何变更后都会更新，且不同 GPUScene 之间不会重复
+     *
+     * 持久渲染队列据此判断是否需要同步。
+     */
+    uint64_t GetRevision() const;
+    /** @brief 非追加式变更（Clear / SetItems）对应的版本，不变时仅追加了渲染项 */
+    uint64_t GetLayoutRevision() const;
     /** @brief 从 glTF 资产构建场景 */
-    void Build(const GLTFAsset& asset, int sceneIndex);
+    void Build(const GLTFAsset& asset, int sceneIndex, const GPUSceneBuildOptions& options = {});
     /** @brief 获取场景相关的贴图列表 */
     const std::vector<GLTFImage>& GetImages() const;
     /** @brief 获取场景相关的采样器列表 */
     const std::vector<GLTFSampler>& GetSamplers() const;
+    /** @brief 获取采样就绪纹理（Build 时生成，未启用时为空集合） */
+    const PreparedTextureSet& GetPreparedTextures() const;
+    /** @brief 获取场景光源（由 KHR_lights_punctual 节点转换到世界空间） */
+    const LightGroup& GetLights() const;
 
     // ========== ResourcePool 集成 API (未来默认) ==========
 
@@ -80,15 +131,20 @@ public:
     /** @brief 执行 LRU 淘汰 */
     void EvictResources();
 
-    /** @brief 获取总资源内存使用量 */
+    /** @brief 获取总资源内存使用量（含采样就绪纹理及其 mip 链） */
     size_t GetTotalMemoryUsage() const;
 
 private:
     std::vector<GPUSceneDrawItem> m_items;
+    std::vector<GPUSceneInstancedDrawItem> m_instancedItems;
     std::vector<Mesh> m_ownedMeshes;
     std::vector<PBRMaterial> m_ownedMaterials;
     std::vector<GLTFImage> m_ownedImages;
     std::vector<GLTFSampler> m_ownedSamplers;
+    PreparedTextureSet m_preparedTextures;
+    LightGroup m_lights;            ///< 场景光源（世界空间）
+    uint64_t m_revision = 0;        ///< 内容版本
+    uint64_t m_layoutRevision = 0;  ///< 非追加式变更版本
 
     // ResourcePool 成员（用于未来池化模式）
     MeshPool m_meshPool;
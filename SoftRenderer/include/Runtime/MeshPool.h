@@ -24,11 +24,9 @@ public:
     size_t GetMeshMemory(Handle h) const {
         const Mesh* mesh = Get(h);
         if (!mesh) return 0;
-        // 顶点约 56 字节（position, normal, texCoord, tangent, color 等）
-        // 索引 4 字节
-        const auto& vertices = mesh->GetVertices();
+        // 顶点按实际存储计算（双精度 Vertex 和/或打包顶点），索引 4 字节
         const auto& indices = mesh->GetIndices();
-        return vertices.size() * sizeof(Vertex) + indices.size() * sizeof(uint32_t);
+        return mesh->GetVertexMemory() + indices.size() * sizeof(uint32_t);
     }
 
     /**
@@ -39,7 +37,7 @@ public:
     size_t GetVertexCount(Handle h) const {
         const Mesh* mesh = Get(h);
         if (!mesh) return 0;
-        return mesh->GetVertices().size();
+        return mesh->GetVertexCount();
     }
 
     /**
@@ -60,7 +58,7 @@ public:
     size_t GetTotalVertexCount() const {
         size_t total = 0;
         ForEach([&total](Handle, const Mesh* mesh) {
-            total += mesh->GetVertices().size();
+            total += mesh->GetVertexCount();
         });
         return total;
     }
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "Math/Mat4.h"
+
+namespace SR {
+
+/// @brief 单个实例的变换数据（实例化绘制时每个副本一份）
+struct InstanceTransform {
+    Mat4 modelMatrix  = Mat4::Identity(); ///< 模型到世界变换矩阵
+    Mat4 normalMatrix = Mat4::Identity(); ///< 法线变换矩阵（模型矩阵左上 3x3 的逆转置）
+    int  nodeIndex    = -1;               ///< 来源节点索引，-1 表示无节点
+};
+
+} // namespace SR
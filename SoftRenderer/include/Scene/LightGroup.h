@@ -16,6 +16,33 @@ struct DirectionalLight {
     double intensity = 1.0;          ///< 光照强度
 };
 
+/**
+ * @brief 点光源结构体（KHR_lights_punctual point）
+ *
+ * 辐照度按 intensity / d² 衰减，并在 range 处平滑衰减到 0。
+ */
+struct PointLight {
+    Vec3 position{0.0, 0.0, 0.0}; ///< 世界空间位置
+    Vec3 color{1.0, 1.0, 1.0};    ///< 光照颜色
+    double intensity = 1.0;        ///< 发光强度（坎德拉）
+    double range = 0.0;            ///< 影响半径，0 表示未指定（按强度推导截断半径）
+};
+
+/**
+ * @brief 聚光灯结构体（KHR_lights_punctual spot）
+ *
+ * 在点光源衰减基础上，按与光轴夹角在内外锥角之间平滑过渡。
+ */
+struct SpotLight {
+    Vec3 position{0.0, 0.0, 0.0};    ///< 世界空间位置
+    Vec3 direction{0.0, -1.0, 0.0};  ///< 光照方向（光传播方向）
+    Vec3 color{1.0, 1.0, 1.0};       ///< 光照颜色
+    double intensity = 1.0;           ///< 发光强度（坎德拉）
+    double range = 0.0;               ///< 影响半径，0 表示未指定
+    double innerConeAngle = 0.0;      ///< 内锥角（弧度），其内为全强度
+    double outerConeAngle = 0.7853981633974483; ///< 外锥角（弧度），其外为 0
+};
+
 /**
  * @brief 场景灯光组，管理场景中所有的光源
  */
@@ -27,9 +54,21 @@ public:
     void AddDirectionalLight(const DirectionalLight& light);
     /** @brief 获取平行光列表 */
     const std::vector<DirectionalLight>& GetDirectionalLights() const;
+    /** @brief 添加一盏点光源 */
+    void AddPointLight(const PointLight& light);
+    /** @brief 获取点光源列表 */
+    const std::vector<PointLight>& GetPointLights() const;
+    /** @brief 添加一盏聚光灯 */
+    void AddSpotLight(const SpotLight& light);
+    /** @brief 获取聚光灯列表 */
+    const std::vector<SpotLight>& GetSpotLights() const;
+    /** @brief 是否不含任何光源 */
+    bool IsEmpty() const;
 
 private:
     std::vector<DirectionalLight> m_directionalLights; ///< 存储所有的平行光
+    std::vector<PointLight> m_pointLights;             ///< 存储所有的点光源
+    std::vector<SpotLight> m_spotLights;               ///< 存储所有的聚光灯
 };
 
 } // namespace SR
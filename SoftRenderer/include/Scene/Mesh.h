@@ -4,6 +4,8 @@
 #include <vector>
 
 #include "SoftRendererExport.h"
+#include "Scene/MeshOptimizer.h"
+#include "Scene/PackedVertex.h"
 #include "Scene/Vertex.h"
 
 namespace SR {
@@ -37,9 +39,37 @@ public:
     /** @brief 获取索引数组引用 */
     const std::vector<uint32_t>& GetIndices() const;
 
+    /**
+     * @brief 加载期网格优化：顶点缓存排序 + overdraw 簇排序 + 顶点读取重映射
+     *
+     * 需在 Pack 之前调用（依赖双精度顶点）；未被引用的顶点会被移除。
+     * 索引越界或已打包时不做任何修改，返回的统计中 triangleCount 为 0。
+     */
+    MeshOptimizeStats Optimize(const MeshOptimizeOptions& options = {});
+
+    /**
+     * @brief 将顶点压缩为打包格式（八面体法线/切线、half UV、RGBA8 颜色）
+     * @param positionFormat 位置存储格式
+     * @param releaseSource  打包后是否释放双精度顶点（释放后 GetVertices() 为空，
+     *                       法线/切线生成需在打包前完成）
+     */
+    void Pack(VertexPositionFormat positionFormat = VertexPositionFormat::UNorm16, bool releaseSource = true);
+    /** @brief 是否已生成打包顶点 */
+    bool IsPacked() const;
+    /** @brief 获取打包顶点缓冲 */
+    const PackedVertexBuffer& GetPackedVertices() const;
+    /** @brief 获取顶点数量（与存储格式无关） */
+    size_t GetVertexCount() const;
+    /** @brief 获取物体空间顶点位置（与存储格式无关） */
+    Vec3 GetPosition(size_t index) const;
+    /** @brief 获取顶点数据占用字节数（双精度顶点 + 打包顶点） */
+    size_t GetVertexMemory() const;
+
 private:
     std::vector<Vertex> m_vertices;   ///< 顶点缓中区
     std::vector<uint32_t> m_indices; ///< 索引缓冲区 (支持非索引绘制时可为空，但目前逻辑倾向于有索引)
+    PackedVertexBuffer m_packed;      ///< 打包顶点缓冲（Pack 后有效）
+    bool m_isPacked = false;          ///< 是否已打包
 };
 
 } // namespace SR
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Math/Vec3.h"
+
+namespace SR {
+
+/**
+ * @brief 网格优化参数
+ */
+struct MeshOptimizeOptions {
+    int cacheSize = 16;               ///< 模拟的后变换顶点缓存大小（FIFO）
+    double overdrawThreshold = 1.05;  ///< 为降低 overdraw 允许的 ACMR 劣化比例（1.0 表示不允许）
+    size_t fetchStride = 0;           ///< 统计 overfetch 时的顶点步长（字节），0 表示使用 sizeof(Vertex)
+};
+
+/**
+ * @brief 网格优化前后的统计
+ *
+ * ACMR：每三角形平均顶点缓存未命中数（越接近 0.5 越好，最差为 3）；
+ * overfetch：按 64 字节缓存行读取的顶点字节数 / 顶点缓冲字节数（理想为 1）。
+ */
+struct MeshOptimizeStats {
+    double acmrBefore = 0.0;      ///< 优化前 ACMR
+    double acmrAfter = 0.0;       ///< 优化后 ACMR
+    double overfetchBefore = 0.0; ///< 优化前 overfetch
+    double overfetchAfter = 0.0;  ///< 优化后 overfetch
+    size_t triangleCount = 0;     ///< 三角形数量（用于多网格加权汇总）
+    size_t clusterCount = 0;      ///< overdraw 排序使用的簇数量
+};
+
+/**
+ * @brief 加载期网格优化：顶点缓存排序、overdraw 簇排序与顶点读取重映射
+ *
+ * 三个步骤按顺序执行：
+ * 1. OptimizeVertexCache：Tipsify（Sander et al. 2007）线性时间三角形重排，并输出簇边界
+ * 2. OptimizeOverdraw：在 ACMR 允许范围内细分簇，按簇朝外程度排序使外层表面先绘制
+ * 3. OptimizeVertexFetch：按首次引用顺序重排顶点，使顶点读取在内存中近似顺序
+ */
+namespace MeshOptimizer {
+
+/** @brief 计算 FIFO 顶点缓存下的 ACMR */
+double ComputeACMR(const std::vector<uint32_t>& indices, size_t vertexCount, int cacheSize);
+
+/** @brief 计算按 64 字节缓存行读取顶点的 overfetch 比例 */
+double ComputeOverfetch(const std::vector<uint32_t>& indices, size_t vertexCount, size_t vertexStride);
+
+/**
+ * @brief Tipsify 顶点缓存排序
+ * @param indices       三角形索引（原地重排）
+ * @param vertexCount   顶点数量
+ * @param cacheSize     目标缓存大小
+ * @param outClusters   输出硬簇边界（三角形序号，首元素为 0）
+ */
+void OptimizeVertexCache(std::vector<uint32_t>& indices, size_t vertexCount, int cacheSize,
+                         std::vector<uint32_t>* outClusters = nullptr);
+
+/**
+ * @brief 基于簇的 overdraw 排序
+ * @param indices     已经过顶点缓存排序的三角形索引（原地重排）
+ * @param positions   物体空间顶点位置
+ * @param clusters    OptimizeVertexCache 输出的硬簇边界
+ * @param cacheSize   缓存大小（用于细分簇时评估 ACMR）
+ * @param threshold   允许的 ACMR 劣化比例
+ * @return 最终簇数量
+ */
+size_t OptimizeOverdraw(std::vector<uint32_t>& indices, const std::vector<Vec3>& positions,
+                        const std::vector<uint32_t>& clusters, int cacheSize, double threshold);
+
+/**
+ * @brief 顶点读取重映射
+ * @param indices     三角形索引（原地改写为新顶点编号）
+ * @param vertexCount 顶点数量
+ * @return 旧顶点编号 → 新顶点编号映射（未被引用的顶点为 UINT32_MAX）
+ */
+std::vector<uint32_t> OptimizeVertexFetch(std::vector<uint32_t>& indices, size_t vertexCount);
+
+} // namespace MeshOptimizer
+
+} // namespace SR
@@ -0,0 +1,216 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "Math/Mat4.h"
+#include "Math/Vec2.h"
+#include "Math/Vec3.h"
+#include "Math/Vec4.h"
+
+namespace SR {
+
+/// @brief 打包顶点的位置存储格式
+enum class VertexPositionFormat : uint8_t {
+    Float32 = 0, ///< 32 位浮点 xyz（12 字节）
+    UNorm16 = 1  ///< 16 位无符号量化 xyz（相对网格包围盒，8 字节含填充）
+};
+
+/**
+ * @brief 打包顶点属性（20 字节，不含位置）
+ *
+ * 位置单独成流（见 PackedVertexBuffer），便于顶点阶段先只读取位置做变换与剔除。
+ */
+struct PackedVertex {
+    int16_t  normalOct[2]  = {0, 0}; ///< 八面体编码法线 (SNORM16)
+    int16_t  tangentOct[2] = {0, 0}; ///< 八面体编码切线 (SNORM16)，tangentOct[1] 最低位存 tangentW 符号
+    uint16_t texCoord[2]   = {0, 0}; ///< 主 UV (half)
+    uint16_t texCoord1[2]  = {0, 0}; ///< 次 UV (half)
+    uint32_t color = 0xFFFFFFFFu;    ///< 顶点颜色 RGBA8（R 位于最低字节）
+};
+
+static_assert(sizeof(PackedVertex) == 20, "PackedVertex layout must stay 20 bytes");
+
+/// 八面体编码中表示零向量的保留值（正常编码结果被钳制在 ±32767，不会与之冲突）
+constexpr int16_t kOctZeroSentinel = INT16_MIN;
+
+// ========== 编解码辅助函数 ==========
+
+/** @brief float → IEEE 754 half（就近舍入，溢出饱和为 Inf） */
+inline uint16_t FloatToHalf(float value) {
+    uint32_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    const uint32_t sign = (bits >> 16) & 0x8000u;
+    const int32_t exponent = static_cast<int32_t>((bits >> 23) & 0xFFu) - 127 + 15;
+    uint32_t mantissa = bits & 0x7FFFFFu;
+
+    if (((bits >> 23) & 0xFFu) == 0xFFu) {
+        return static_cast<uint16_t>(sign | 0x7C00u | (mantissa ? 0x200u : 0u));
+    }
+    if (exponent >= 31) {
+        return static_cast<uint16_t>(sign | 0x7C00u);
+    }
+    if (exponent <= 0) {
+        if (exponent < -10) {
+            return static_cast<uint16_t>(sign);
+        }
+        mantissa |= 0x800000u;
+        const uint32_t shift = static_cast<uint32_t>(14 - exponent);
+        uint32_t half = mantissa >> shift;
+        const uint32_t rest = mantissa & ((1u << shift) - 1u);
+        const uint32_t halfway = 1u << (shift - 1u);
+        if (rest > halfway || (rest == halfway && (half & 1u))) {
+            ++half;
+        }
+        return static_cast<uint16_t>(sign | half);
+    }
+
+    uint32_t half = sign | (static_cast<uint32_t>(exponent) << 10) | (mantissa >> 13);
+    const uint32_t rest = mantissa & 0x1FFFu;
+    if (rest > 0x1000u || (rest == 0x1000u && (half & 1u))) {
+        ++half; // 进位可自然溢出到指数位
+    }
+    return static_cast<uint16_t>(half);
+}
+
+/** @brief IEEE 754 half → float */
+inline float HalfToFloat(uint16_t half) {
+    const uint32_t sign = static_cast<uint32_t>(half & 0x8000u) << 16;
+    uint32_t exponent = (half >> 10) & 0x1Fu;
+    uint32_t mantissa = half & 0x3FFu;
+    uint32_t bits = 0;
+
+    if (exponent == 0) {
+        if (mantissa == 0) {
+            bits = sign;
+        } else {
+            // 非规格化数：规格化后再组装
+            exponent = 127 - 15 + 1;
+            while ((mantissa & 0x400u) == 0) {
+                mantissa <<= 1;
+                --exponent;
+            }
+            mantissa &= 0x3FFu;
+            bits = sign | (exponent << 23) | (mantissa << 13);
+        }
+    } else if (exponent == 31) {
+        bits = sign | 0x7F800000u | (mantissa << 13);
+    } else {
+        bits = sign | ((exponent - 15 + 127) << 23) | (mantissa << 13);
+    }
+
+    float value = 0.0f;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+/** @brief 单位向量 → 八面体编码 (SNORM16×2)；零向量写入保留值 */
+inline void EncodeOctahedral(const Vec3& v, int16_t out[2]) {
+    const double l1 = std::abs(v.x) + std::abs(v.y) + std::abs(v.z);
+    if (l1 < 1e-20) {
+        out[0] = kOctZeroSentinel;
+        out[1] = kOctZeroSentinel;
+        return;
+    }
+    double px = v.x / l1;
+    double py = v.y / l1;
+    if (v.z < 0.0) {
+        const double ox = (1.0 - std::abs(py)) * (px >= 0.0 ? 1.0 : -1.0);
+        const double oy = (1.0 - std::abs(px)) * (py >= 0.0 ? 1.0 : -1.0);
+        px = ox;
+        py = oy;
+    }
+    out[0] = static_cast<int16_t>(std::lround(std::clamp(px, -1.0, 1.0) * 32767.0));
+    out[1] = static_cast<int16_t>(std::lround(std::clamp(py, -1.0, 1.0) * 32767.0));
+}
+
+/** @brief 八面体编码 → 单位向量（保留值解码为零向量） */
+inline Vec3 DecodeOctahedral(int16_t ex, int16_t ey) {
+    if (ex == kOctZeroSentinel && ey == kOctZeroSentinel) {
+        return Vec3{0.0, 0.0, 0.0};
+    }
+    double x = static_cast<double>(ex) * (1.0 / 32767.0);
+    double y = static_cast<double>(ey) * (1.0 / 32767.0);
+    const double z = 1.0 - std::abs(x) - std::abs(y);
+    const double t = std::max(-z, 0.0);
+    x += (x >= 0.0) ? -t : t;
+    y += (y >= 0.0) ? -t : t;
+    return Vec3{x, y, z}.Normalized();
+}
+
+/** @brief 线性 [0,1] RGBA → RGBA8（R 位于最低字节） */
+inline uint32_t PackRGBA8(const Vec4& c) {
+    auto q = [](double v) {
+        return static_cast<uint32_t>(std::lround(std::clamp(v, 0.0, 1.0) * 255.0));
+    };
+    return q(c.x) | (q(c.y) << 8) | (q(c.z) << 16) | (q(c.w) << 24);
+}
+
+/** @brief RGBA8 → [0,1] RGBA */
+inline Vec4 UnpackRGBA8(uint32_t c) {
+    constexpr double kInv255 = 1.0 / 255.0;
+    return Vec4{static_cast<double>(c & 0xFFu) * kInv255,
+                static_cast<double>((c >> 8) & 0xFFu) * kInv255,
+                static_cast<double>((c >> 16) & 0xFFu) * kInv255,
+                static_cast<double>((c >> 24) & 0xFFu) * kInv255};
+}
+
+/**
+ * @brief 网格的打包顶点缓冲
+ *
+ * UNorm16 位置按网格包围盒量化：p = q * dequantScale + dequantOffset，
+ * 顶点阶段把该反量化变换并入模型矩阵，因此逐顶点只需一次整数到浮点的转换。
+ */
+struct PackedVertexBuffer {
+    VertexPositionFormat positionFormat = VertexPositionFormat::Float32; ///< 位置格式
+    Vec3 dequantScale{1.0, 1.0, 1.0};   ///< 反量化缩放（UNorm16 有效）
+    Vec3 dequantOffset{0.0, 0.0, 0.0};  ///< 反量化偏移，即包围盒最小点（UNorm16 有效）
+    std::vector<float> positionsF32;     ///< Float32 位置流 (xyz)
+    std::vector<uint16_t> positionsU16;  ///< UNorm16 位置流 (xyz + 填充)
+    std::vector<PackedVertex> attributes; ///< 其余顶点属性
+
+    /** @brief 顶点数量 */
+    size_t GetVertexCount() const { return attributes.size(); }
+
+    /** @brief 打包数据占用字节数 */
+    size_t GetMemoryBytes() const {
+        return positionsF32.size() * sizeof(float) +
+               positionsU16.size() * sizeof(uint16_t) +
+               attributes.size() * sizeof(PackedVertex);
+    }
+
+    /** @brief 反量化矩阵（行向量约定，Float32 格式为单位矩阵） */
+    Mat4 GetDequantizationMatrix() const {
+        if (positionFormat != VertexPositionFormat::UNorm16) {
+            return Mat4::Identity();
+        }
+        return Mat4::Scale(dequantScale.x, dequantScale.y, dequantScale.z) *
+               Mat4::Translation(dequantOffset.x, dequantOffset.y, dequantOffset.z);
+    }
+
+    /** @brief 读取原始存储位置（UNorm16 返回未反量化的整数值，需配合 GetDequantizationMatrix） */
+    Vec4 GetRawPosition(size_t index) const {
+        if (positionFormat == VertexPositionFormat::UNorm16) {
+            const uint16_t* q = &positionsU16[index * 4];
+            return Vec4{static_cast<double>(q[0]), static_cast<double>(q[1]), static_cast<double>(q[2]), 1.0};
+        }
+        const float* p = &positionsF32[index * 3];
+        return Vec4{static_cast<double>(p[0]), static_cast<double>(p[1]), static_cast<double>(p[2]), 1.0};
+    }
+
+    /** @brief 解码物体空间位置 */
+    Vec3 DecodePosition(size_t index) const {
+        Vec4 raw = GetRawPosition(index);
+        if (positionFormat == VertexPositionFormat::UNorm16) {
+            return Vec3{raw.x * dequantScale.x + dequantOffset.x,
+                        raw.y * dequantScale.y + dequantOffset.y,
+                        raw.z * dequantScale.z + dequantOffset.z};
+        }
+        return Vec3{raw.x, raw.y, raw.z};
+    }
+};
+
+} // namespace SR
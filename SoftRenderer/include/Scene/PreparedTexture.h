@@ -0,0 +1,328 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "Scene/TextureBinding.h"
+
+namespace SR {
+
+struct GLTFImage;
+struct GLTFSampler;
+struct SampledColor;
+struct Vec2;
+
+/// @brief 采样就绪纹理的存储格式
+enum class PreparedTextureFormat : uint8_t {
+    RGBA8Unorm = 0,           ///< 线性数据贴图（金属度-粗糙度/法线/AO/透射），按原字节保存
+    RGBA16Linear = 1,         ///< 不透明 sRGB 颜色贴图：经查表解码为 16 位线性值
+    RGBA32FPremultiplied = 2, ///< 含半透明纹素的 sRGB 颜色贴图：线性 float、预乘 alpha（过滤后反预乘）
+    BC1 = 3,                  ///< BC1 块压缩 RGB（颜色贴图块内为 sRGB，数据贴图为线性）
+    BC3 = 4,                  ///< BC3 块压缩的半透明 sRGB 颜色贴图（解码后预乘，过滤后反预乘）
+    BC4 = 5,                  ///< BC4 块压缩的单通道数据贴图（AO / 透射，仅 R 通道有效）
+    BC5 = 6                   ///< BC5 块压缩的法线贴图（存 RG，解码时重建 B = Z）
+};
+
+/// @brief 是否为 BCn 块压缩格式
+constexpr bool IsBlockCompressed(PreparedTextureFormat format) {
+    return format == PreparedTextureFormat::BC1 || format == PreparedTextureFormat::BC3 ||
+           format == PreparedTextureFormat::BC4 || format == PreparedTextureFormat::BC5;
+}
+
+/// @brief 贴图用途（决定是否做 sRGB 解码）
+enum class TextureUsage : uint8_t {
+    Color = 0, ///< 颜色贴图（基础色/自发光），采样时按 sRGB 解码
+    Data = 1   ///< 数据贴图，按线性值读取
+};
+
+/// @brief 是否为颜色插槽（基础色与自发光按 sRGB 采样，其余插槽为线性数据）
+inline bool IsColorTextureSlot(size_t slot) {
+    return slot == static_cast<size_t>(TextureSlot::BaseColor) ||
+           slot == static_cast<size_t>(TextureSlot::Emissive);
+}
+
+/// 纹素块边长的 log2（4x4 块：RGBA8 一块恰为一条 64 字节缓存行）
+constexpr int kTextureBlockShift = 2;
+/// 纹素块边长
+constexpr int kTextureBlockSize = 1 << kTextureBlockShift;
+
+/**
+ * @brief Mip 级别描述（各级纹素在同一数组中连续存放）
+ *
+ * 纹素按 4x4 块存储：块按行主序排列，块内按 Morton（Z 序）排列，
+ * 双线性的 2x2 足迹大多落在同一块内。宽高向上补齐到块边长，补齐部分复制边缘纹素。
+ */
+struct PreparedTextureLevel {
+    int width = 0;     ///< 该级宽度（像素）
+    int height = 0;    ///< 该级高度（像素）
+    int blocksX = 0;   ///< 每行块数
+    int blocksY = 0;   ///< 块行数
+    size_t offset = 0; ///< 该级首纹素在纹素数组中的序号
+
+    /** @brief 创建级别描述 */
+    static PreparedTextureLevel Make(int levelWidth, int levelHeight, size_t levelOffset) {
+        PreparedTextureLevel level;
+        level.width = levelWidth;
+        level.height = levelHeight;
+        level.blocksX = (levelWidth + kTextureBlockSize - 1) >> kTextureBlockShift;
+        level.blocksY = (levelHeight + kTextureBlockSize - 1) >> kTextureBlockShift;
+        level.offset = levelOffset;
+        return level;
+    }
+
+    /** @brief 该级占用的纹素数（含块补齐） */
+    size_t GetStoredTexelCount() const {
+        return static_cast<size_t>(blocksX) * static_cast<size_t>(blocksY) * (kTextureBlockSize * kTextureBlockSize);
+    }
+
+    /** @brief 纹素 (x, y) 在纹素数组中的序号（x、y 需在 [0, width/height) 内） */
+    size_t TexelIndex(int x, int y) const {
+        const size_t block = static_cast<size_t>(y >> kTextureBlockShift) * static_cast<size_t>(blocksX) +
+                             static_cast<size_t>(x >> kTextureBlockShift);
+        // 块内 Morton 序：x0 y0 x1 y1
+        const unsigned morton = (x & 1u) | ((y & 1u) << 1) | ((x & 2u) << 1) | ((y & 2u) << 2);
+        return offset + (block << (2 * kTextureBlockShift)) + morton;
+    }
+};
+
+/**
+ * @brief 采样就绪的纹理
+ *
+ * 在场景构建阶段由 GLTFImage 转换而来：sRGB 解码、归一化与预乘都已完成，
+ * 逐样本只剩整数/浮点加载与插值，不再调用 pow。
+ * 以 mipmap 过滤采样的纹理同时保存完整 mip 链（在线性空间降采样）。
+ * BCn 格式只保存压缩块，采样时经每线程的 DecodedBlockCache 按块解码。
+ */
+struct PreparedTexture {
+    PreparedTextureFormat format = PreparedTextureFormat::RGBA8Unorm; ///< 存储格式
+    int width = 0;                ///< 基础级宽度（像素）
+    int height = 0;               ///< 基础级高度（像素）
+    std::vector<PreparedTextureLevel> levels; ///< mip 链，levels[0] 为基础级
+    std::vector<uint8_t> texels8;  ///< RGBA8Unorm 纹素
+    std::vector<uint16_t> texels16; ///< RGBA16Linear 纹素
+    std::vector<float> texelsF32;   ///< RGBA32FPremultiplied 纹素
+    std::vector<uint8_t> blocks;    ///< BCn 压缩块（第 i 块对应纹素 [16i, 16i+16)，与非压缩格式的块布局一致）
+    bool srgbBlocks = false;        ///< BC1/BC3 块内颜色是否为 sRGB 编码（解码时查表转线性）
+    uint64_t blockCacheId = 0;      ///< 解码块缓存标识（每次压缩分配唯一值；0 表示未压缩）
+
+    /** @brief mip 级别数（至少为 1） */
+    int GetLevelCount() const { return static_cast<int>(levels.size()); }
+
+    /** @brief 每纹素字节数（非压缩格式） */
+    size_t GetBytesPerTexel() const {
+        switch (format) {
+        case PreparedTextureFormat::RGBA16Linear: return 4 * sizeof(uint16_t);
+        case PreparedTextureFormat::RGBA32FPremultiplied: return 4 * sizeof(float);
+        default: return 4 * sizeof(uint8_t);
+        }
+    }
+
+    /** @brief 每个 4x4 块的字节数（非压缩格式返回 0） */
+    size_t GetBlockBytes() const {
+        switch (format) {
+        case PreparedTextureFormat::BC1:
+        case PreparedTextureFormat::BC4: return 8;
+        case PreparedTextureFormat::BC3:
+        case PreparedTextureFormat::BC5: return 16;
+        default: return 0;
+        }
+    }
+
+    /** @brief 前 texelCount 个纹素（16 的倍数）占用的字节数 */
+    size_t GetStorageBytes(size_t texelCount) const {
+        return IsBlockCompressed(format) ? texelCount / 16 * GetBlockBytes() : texelCount * GetBytesPerTexel();
+    }
+
+    /** @brief 纹素数据占用字节数（含全部 mip 级别） */
+    size_t GetMemoryBytes() const {
+        return texels8.size() * sizeof(uint8_t) +
+               texels16.size() * sizeof(uint16_t) +
+               texelsF32.size() * sizeof(float) +
+               blocks.size();
+    }
+
+    /** @brief 基础级以外的 mip 级别占用字节数 */
+    size_t GetMipMemoryBytes() const {
+        return levels.size() > 1 ? GetMemoryBytes() - GetStorageBytes(levels[1].offset) : 0;
+    }
+};
+
+/**
+ * @brief 解码一个 BCn 块为线性 float RGBA
+ *
+ * 输出 16 个纹素，块内按 Morton 序（与 PreparedTextureLevel::TexelIndex 的低 4 位一致）；
+ * sRGB 块查表转线性，BC3 输出预乘值，BC5 由 RG 重建法线 Z。
+ * @param blockIndex 块序号（纹素序号 / 16）
+ */
+void DecodePreparedBlock(const PreparedTexture& texture, size_t blockIndex, float out[64]);
+
+/**
+ * @brief 已解码 BCn 块缓存（每线程一份，直接映射）
+ *
+ * 双线性的 4 个纹素与相邻像素的样本大多落在同一块内，命中时省去整块解码。
+ * 以 blockCacheId 而非纹理地址作键，场景重建后旧条目不会被误命中。
+ */
+struct DecodedBlockCache {
+    static constexpr size_t kEntries = 64; ///< 缓存条目数（2 的幂，约 17 KB）
+
+    struct Entry {
+        uint64_t textureId = 0;  ///< 所属纹理的 blockCacheId（0 表示空）
+        size_t blockIndex = 0;   ///< 块序号
+        float texels[64];        ///< 解码后的线性 RGBA（Morton 序）
+    };
+    Entry entries[kEntries];
+
+    /** @brief 取得解码后的块（未命中时解码并替换对应条目） */
+    const float* Fetch(const PreparedTexture& texture, size_t blockIndex) {
+        Entry& entry = entries[(blockIndex + texture.blockCacheId * 17) & (kEntries - 1)];
+        if (entry.textureId != texture.blockCacheId || entry.blockIndex != blockIndex) {
+            DecodePreparedBlock(texture, blockIndex, entry.texels);
+            entry.textureId = texture.blockCacheId;
+            entry.blockIndex = blockIndex;
+        }
+        return entry.texels;
+    }
+};
+
+/** @brief 当前线程的解码块缓存 */
+inline DecodedBlockCache& GetDecodedBlockCache() {
+    thread_local DecodedBlockCache cache;
+    return cache;
+}
+
+/**
+ * @brief 预解析的纹理采样描述符
+ *
+ * 纹理与采样器在场景构建时绑定一次：回绕模式与过滤模式解析为函数指针
+ * （按存储格式与过滤模式模板特化），逐样本不再校验索引、查找采样器或分支判断回绕模式。
+ * 由 TextureSampler.h 的 MakeTextureDescriptor 创建、SampleTexture 采样。
+ */
+struct TextureDescriptor {
+    using WrapFn = double (*)(double);
+    using SampleFn = SampledColor (*)(const TextureDescriptor&, const Vec2&, double);
+
+    const PreparedTexture* texture = nullptr; ///< 采样就绪纹理
+    WrapFn wrapS = nullptr;     ///< U 方向回绕
+    WrapFn wrapT = nullptr;     ///< V 方向回绕
+    SampleFn magnify = nullptr; ///< LOD <= 0 时的采样函数（magFilter）
+    SampleFn minify = nullptr;  ///< LOD > 0 时的采样函数（minFilter；与 magnify 相同时跳过 LOD 计算）
+    uint32_t widthMask = 0;     ///< 2 的幂宽度时为 width-1（Repeat 最近邻直接按位与回绕），否则为 0
+    uint32_t heightMask = 0;    ///< 2 的幂高度时为 height-1，否则为 0
+};
+
+/// @brief 材质各插槽的纹理描述符（nullptr 表示回退到 GLTFImage 采样）
+using TextureDescriptorArray = std::array<const TextureDescriptor*, static_cast<size_t>(TextureSlot::Count)>;
+
+/**
+ * @brief 由 GLTFImage 生成采样就绪纹理
+ * @param image          源图像（RGBA8）
+ * @param usage          贴图用途；Color 用途或 image.isSRGB 时执行 sRGB 解码
+ * @param generateMipmaps 是否生成完整 mip 链
+ */
+PreparedTexture PrepareTexture(const GLTFImage& image, TextureUsage usage, bool generateMipmaps = false);
+
+/**
+ * @brief 为只有基础级的纹理追加 mip 链
+ *
+ * 每级由上一级的线性值（预乘格式为预乘值）按面积加权盒式滤波降采样，
+ * 宽高各减半（向下取整，最小为 1），直到 1x1；因此 sRGB 贴图的降采样在线性空间进行。
+ */
+void GenerateMipChain(PreparedTexture& texture);
+
+/**
+ * @brief 将纹理（含全部 mip 级别）压缩为 BCn 块
+ *
+ * 颜色纹理先转回 sRGB 8-bit（预乘格式先反预乘）再编码，保证暗部精度；
+ * 数据纹理直接量化线性值。压缩后释放非压缩纹素。
+ * @param format 目标格式（BC1 / BC3 / BC4 / BC5）
+ */
+void CompressTexture(PreparedTexture& texture, PreparedTextureFormat format);
+
+/**
+ * @brief 采样就绪纹理的构建选项
+ */
+struct PreparedTextureOptions {
+    bool generateMipmaps = true; ///< 为以 mipmap 过滤采样的图像生成 mip 链
+    bool compress = false;       ///< 以 BCn 块压缩存储（有损；内存约为非压缩格式的 1/8 ~ 1/16）
+};
+
+/**
+ * @brief 场景的采样就绪纹理集合
+ *
+ * 同一图像可能同时以颜色和数据两种用途引用，两种用途分别保存；
+ * 未被引用的图像不生成纹理，采样端回退到 GLTFImage 路径。
+ * 启用压缩时按用途选择 BCn 格式：不透明颜色 BC1、半透明颜色 BC3、
+ * 仅作法线贴图 BC5、仅读 R 通道（AO/透射）BC4、其余数据 BC1。
+ */
+class PreparedTextureSet {
+public:
+    /**
+     * @brief 按渲染项的纹理绑定收集用途并生成纹理
+     * @param images          场景图像
+     * @param samplers        场景采样器（用于判断是否需要 mip 链）
+     * @param bindings        所有渲染项的纹理绑定
+     * @param options         mip 链与压缩选项
+     */
+    void Build(const std::vector<GLTFImage>& images, const std::vector<GLTFSampler>& samplers,
+               const std::vector<TextureBindingArray>& bindings, const PreparedTextureOptions& options);
+
+    /** @brief 清空 */
+    void Clear();
+
+    /**
+     * @brief 查找图像的采样就绪纹理
+     * @param imageIndex 图像索引
+     * @param srgb       是否以颜色用途采样（与 SampleImage* 的 srgb 参数一致）
+     * @return 纹理指针，不存在时返回 nullptr
+     */
+    const PreparedTexture* Find(int imageIndex, bool srgb) const {
+        if (imageIndex < 0 || static_cast<size_t>(imageIndex) >= m_colorIndex.size()) {
+            return nullptr;
+        }
+        const int32_t index = srgb ? m_colorIndex[static_cast<size_t>(imageIndex)]
+                                   : m_dataIndex[static_cast<size_t>(imageIndex)];
+        return index >= 0 ? &m_textures[static_cast<size_t>(index)] : nullptr;
+    }
+
+    /**
+     * @brief 查找纹理绑定对应的采样描述符
+     * @param binding 纹理绑定（图像 + 采样器）
+     * @param srgb    是否以颜色用途采样
+     * @return 描述符指针，不存在时返回 nullptr
+     */
+    const TextureDescriptor* FindDescriptor(const TextureBinding& binding, bool srgb) const;
+
+    /**
+     * @brief 解析材质全部插槽的采样描述符（光栅化器按三角形调用一次）
+     * @param bindings 材质纹理绑定
+     * @param out      输出描述符数组
+     */
+    void ResolveDescriptors(const TextureBindingArray& bindings, TextureDescriptorArray& out) const;
+
+    /** @brief 纹理数量 */
+    size_t GetTextureCount() const { return m_textures.size(); }
+
+    /** @brief 全部纹素占用字节数 */
+    size_t GetMemoryBytes() const;
+
+    /** @brief 其中 mip 链（基础级以外）占用的字节数 */
+    size_t GetMipMemoryBytes() const;
+
+private:
+    /// @brief 描述符键：纹理序号与采样器索引（-1 为默认采样器）
+    static uint64_t MakeDescriptorKey(int32_t textureIndex, int samplerIndex) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(textureIndex)) << 32) |
+               static_cast<uint32_t>(samplerIndex + 1);
+    }
+
+    std::vector<PreparedTexture> m_textures;
+    std::vector<TextureDescriptor> m_descriptors;             ///< 所有被引用的（纹理, 采样器）组合
+    std::unordered_map<uint64_t, int32_t> m_descriptorIndex;  ///< 描述符键 → m_descriptors 序号
+    std::vector<int32_t> m_colorIndex; ///< 图像索引 → 颜色用途纹理索引（-1 表示无）
+    std::vector<int32_t> m_dataIndex;  ///< 图像索引 → 数据用途纹理索引（-1 表示无）
+};
+
+} // namespace SR
@@ -1,9 +1,12 @@
 #pragma once
 
+#include <cstdint>
+#include <unordered_map>
 #include <vector>
 
 #include "Material/PBRMaterial.h"
 #include "Math/Mat4.h"
+#include "Scene/InstanceTransform.h"
 #include "Scene/Mesh.h"
 #include "Scene/TextureBinding.h"
 #include "Scene/Transform.h"
@@ -25,22 +28,86 @@ struct DrawItem {
     int primitiveIndex = -1;                     ///< Primitive 索引
     int nodeIndex = -1;                          ///< 节点索引
     TextureBindingArray textures{}; ///< 纹理绑定数组
+    const InstanceTransform* instances = nullptr; ///< 实例变换数组（为空时使用 modelMatrix/normalMatrix）
+    size_t instanceCount = 0;                     ///< 实例数量（0 表示非实例化绘制）
+};
+
+/**
+ * @brief 紧凑绘制记录：排序键计算所需的逐项静态信息（与 DrawItem 一一对应）
+ */
+struct RenderQueueRecord {
+    uint32_t materialId = 0; ///< 队列内稠密材质编号（按首次出现顺序分配）
+    uint32_t meshId = 0;     ///< 队列内稠密网格编号（按首次出现顺序分配）
+};
+
+/**
+ * @brief 已排序的队列条目：64 位排序键 + 对应 DrawItem 下标
+ *
+ * 排序键布局（高位优先）：
+ * - Opaque / Mask：alphaMode(2) | material(20) | mesh(20) | 深度桶(22，近→远)
+ * - Blend        ：alphaMode(2) | 反转深度桶(22，远→近) | material(20) | mesh(20)
+ */
+struct RenderQueueEntry {
+    uint64_t sortKey = 0;   ///< 打包排序键
+    uint32_t itemIndex = 0; ///< DrawItem 下标
 };
 
 /**
  * @brief 渲染队列，存储一帧中所有需要绘制的项目
+ *
+ * 队列可跨帧持久存在：DrawItem 只在场景变更时写入，
+ * 每帧仅由 UpdateSortKeys 重新计算排序键，键发生变化时才执行基数排序。
  */
 class RenderQueue {
 public:
-    /** @brief 设置队列内容 */
+    /** @brief 设置队列内容（整体替换） */
     void SetItems(std::vector<DrawItem>&& items);
+    /** @brief 追加单个绘制项（增量更新） */
+    void AddItem(const DrawItem& item);
     /** @brief 清空队列 */
     void Clear();
-    /** @brief 获取所有绘制项 */
+    /** @brief 获取所有绘制项（插入顺序） */
     const std::vector<DrawItem>& GetItems() const;
 
+    /**
+     * @brief 重新计算排序键，键有变化时基数排序
+     * @param cameraPos 相机位置（用于深度桶）
+     * @return 本次是否执行了排序
+     */
+    bool UpdateSortKeys(const Vec3& cameraPos);
+    /** @brief 获取排序后的条目（需先调用 UpdateSortKeys） */
+    const std::vector<RenderQueueEntry>& GetSortedEntries() const;
+    /** @brief 按排序位置获取绘制项 */
+    const DrawItem& GetSortedItem(size_t sortedIndex) const;
+    /** @brief 累计执行的排序次数 */
+    uint64_t GetSortCount() const;
+
+    /**
+     * @brief 将另一队列的绘制项与排序结果复制为只读快照
+     *
+     * 只复制自上次从同一队列快照以来变化的部分（绘制项集合未变且未重新排序时不复制任何数据）；
+     * 紧凑记录、排序键与编号表不复制，快照不能调用 UpdateSortKeys。修改快照会使其脱离来源。
+     * @return 本次是否复制了绘制项
+     */
+    bool SnapshotFrom(const RenderQueue& source);
+
 private:
-    std::vector<DrawItem> m_items; ///< 存储 DrawItem 的列表
+    /** @brief 为绘制项分配紧凑记录 */
+    RenderQueueRecord MakeRecord(const DrawItem& item);
+
+    std::vector<DrawItem> m_items;                 ///< 存储 DrawItem 的列表
+    std::vector<RenderQueueRecord> m_records;      ///< 与 m_items 对应的紧凑记录
+    std::vector<uint64_t> m_keys;                  ///< 上一次计算的排序键（按 m_items 顺序）
+    std::vector<RenderQueueEntry> m_sorted;        ///< 排序结果
+    std::vector<RenderQueueEntry> m_sortScratch;   ///< 基数排序双缓冲
+    std::unordered_map<const void*, uint32_t> m_materialIds; ///< 材质指针 → 稠密编号
+    std::unordered_map<const void*, uint32_t> m_meshIds;     ///< 网格指针 → 稠密编号
+    bool m_orderDirty = true;                      ///< 条目集合变化，需要重新排序
+    uint64_t m_sortCount = 0;                      ///< 累计排序次数
+    uint64_t m_itemsVersion = 0;                   ///< 绘制项集合的修改计数
+    const RenderQueue* m_snapshotSource = nullptr; ///< 快照来源（自身被修改后置空）
+    uint64_t m_snapshotItemsVersion = 0;           ///< 快照时来源的绘制项修改计数
+    uint64_t m_snapshotSortCount = 0;              ///< 快照时来源的排序次数
 };
 
 } // namespace SR
@@ -1,13 +1,24 @@
 #pragma once
 
+#include <atomic>
 #include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
 
-#include "Core/DepthBuffer.h"
-#include "Core/Framebuffer.h"
+#include "Core/FrameArena.h"
+#include "Core/Parallel.h"
 #include "SoftRendererExport.h"
 #include "Math/Vec3.h"
 #include "Render/FrameContextBuilder.h"
+#include "Render/FrameFuture.h"
+#include "Render/FrameScheduler.h"
+#include "Render/FrameSlot.h"
+#include "Render/GPUSceneRenderQueueBuilder.h"
+#include "Render/RenderPipeline.h"
 #include "Render/RendererConfig.h"
+#include "Render/RenderView.h"
+#include "Scene/RenderQueue.h"
 
 namespace SR {
 
@@ -15,10 +26,19 @@ class Scene;
 class GPUScene;
 struct PassContext;
 struct FrameContext;
-struct RenderStats;
 
 /**
  * @brief 渲染器主类，负责整个渲染流程的管理
+ *
+ * RendererConfig::framesInFlight > 1 时为流水线模式：Render 在调用线程完成帧准备
+ * （光源剔除、渲染队列同步、阴影贴图）后把清除与 Pass 执行交给后端线程并立即返回帧序号，
+ * 下一帧的准备与上一帧的光栅化重叠。场景在帧完成之前须保持不变；修改配置会先等待所有在途帧。
+ * RenderAsync 把整帧交给后端线程并返回可等待 / 可取消的句柄。
+ * RenderViews 从多个视点渲染同一 GPUScene，世界空间几何只构建一次。
+ *
+ * 渲染器之间不共享可变状态（临时数据来自各自帧槽的帧级内存，并行后端按渲染器安装），
+ * 多个实例可以在不同线程上同时渲染；JobSystem 后端默认共享同线程数的进程线程池，
+ * 也可以通过 ParallelOptions::jobSystem 显式指定。
  */
 class SR_API Renderer {
 public:
@@ -34,30 +54,72 @@ public:
     void SetConfig(const RendererConfig& config);
     /** @brief 获取当前配置 (只读) */
     const RendererConfig& GetConfig() const;
-    /** @brief 渲染传统层级的场景 */
-    void Render(const Scene& scene);
-    /** @brief 渲染扁平化加速结构的 GPUScene */
-    void Render(const GPUScene& scene);
-    /** @brief 获取最终输出的 BGRA8 像素缓冲区 */
+    /** @brief 渲染传统层级的场景，返回帧序号 */
+    uint64_t Render(const Scene& scene);
+    /** @brief 渲染扁平化加速结构的 GPUScene，返回帧序号 */
+    uint64_t Render(const GPUScene& scene);
+    /** @brief 异步渲染 GPUScene：调用方立即返回，通过句柄等待、注册回调或取消 */
+    FrameFuture RenderAsync(const GPUScene& scene);
+    /** @brief 从多个视点渲染 GPUScene 到各自的目标（同步完成，不更新最近完成帧），返回帧序号 */
+    uint64_t RenderViews(const GPUScene& scene, std::span<const RenderView> views);
+    /** @brief 帧是否已完成（含被取消的帧） */
+    bool IsFrameComplete(uint64_t frameId) const;
+    /** @brief 阻塞直到帧完成 */
+    void WaitForFrame(uint64_t frameId) const;
+    /** @brief 阻塞直到所有在途帧完成 */
+    void Flush();
+    /** @brief 设置帧完成回调（会先等待所有在途帧） */
+    void SetFrameCallback(FrameCallback callback);
+    /** @brief 获取最近完成帧的 BGRA8 像素缓冲区 */
     const uint32_t* GetFramebuffer() const;
-    /** @brief 获取线性空间 HDR 像素缓冲区 */
+    /** @brief 获取最近完成帧的线性空间 HDR 像素缓冲区 */
     const Vec3* GetFramebufferLinear() const;
     /** @brief 获取渲染目标宽度 */
     int GetWidth() const;
     /** @brief 获取渲染目标高度 */
     int GetHeight() const;
+    /** @brief 获取最近完成帧的帧级临时内存高水位 / 容量统计 */
+    const FrameArenaStats& GetFrameArenaStats() const;
 
 private:
-    void ClearBuffers();
-    PassContext BuildPassContext(const FrameContext& frame);
+    /// 一帧的后端工作参数（前端准备完成后提交）
+    struct FrameSubmission {
+        uint64_t frameId = 0;
+        const char* label = "";
+        const RenderQueue* queue = nullptr; ///< 为空时只清除缓冲（本帧不执行管线）
+        double setupMs = 0.0;
+        bool logBreakdown = false;
+    };
+
+    void EnsureSlots(size_t count);
+    FrameSlot& AcquireSlot(uint64_t frameId, bool deferred);
+    void PreparePipeline(FrameSlot& slot);
+    void ClearBuffers(const FrameSlot& slot, Framebuffer& framebuffer, DepthBuffer& depthBuffer, bool forceOutput = false);
+    PassContext BuildPassContext(FrameSlot& slot, const FrameContext& frame);
+    void BuildTiledLights(FrameSlot& slot, FrameContext& frame, int width, int height);
+    void BuildShadowMap(FrameSlot& slot, FrameContext& frame, const RenderQueue& queue,
+                        const ShadowCasters* casters = nullptr);
+    FrameContext BuildSceneFrameContext(FrameSlot& slot, const GPUScene& scene, const std::atomic<bool>* cancel) const;
+    PassContext PrepareFrame(FrameSlot& slot, const GPUScene& scene, const std::atomic<bool>* cancel,
+                             FrameSubmission& submission);
+    CompletedFrame ExecuteFrame(FrameSlot& slot, const FrameSubmission& submission, const PassContext& passContext);
+    void SubmitFrame(FrameSlot& slot, const FrameSubmission& submission, PassContext passContext);
+    void WaitForAsyncFrames();
+    void EndFrameArena(FrameSlot& slot);
     void LogFrameStats(const RenderStats& stats, double clearMs, double setupMs, double totalMs, const char* label, size_t itemCount = 0) const;
 
     int m_width = 0;
     int m_height = 0;
     bool m_useHDR = false;
-    Framebuffer m_framebuffer;
-    DepthBuffer m_depthBuffer;
     RendererConfig m_config{};
+    RenderQueue m_gpuSceneQueue;                      ///< GPUScene 持久渲染队列（跨帧复用）
+    GPUSceneRenderQueueBuilder m_gpuSceneQueueBuilder; ///< 持久队列的增量同步状态
+    std::vector<std::unique_ptr<FrameSlot>> m_slots;  ///< 帧槽（按需创建；后端执行的帧多保留一个，不覆盖最近完成帧）
+    std::atomic<FrameSlot*> m_presentSlot{nullptr};   ///< 最近完成帧的帧槽
+    FrameCallback m_frameCallback;                    ///< 帧完成回调
+    ParallelContext m_parallel;                       ///< 本渲染器的并行后端（渲染期间安装到执行线程）
+    uint64_t m_lastAsyncFrameId = 0;                  ///< 最近提交的异步帧（同步提交前须等待其结束）
+    FrameScheduler m_scheduler;                       ///< 后端线程（最后析构：先完成在途帧）
 };
 
 } // namespace SR
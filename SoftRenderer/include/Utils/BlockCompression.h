@@ -0,0 +1,63 @@
+#pragma once
+
+/**
+ * @file BlockCompression.h
+ * @brief BCn（BC1/BC3/BC4/BC5）4x4 块编解码，供采样就绪纹理的内存压缩使用。
+ *
+ * 所有函数按单个 4x4 块工作，块内纹素按行主序（texel = y * 4 + x）。
+ * 编码器采用主轴（PCA）端点拟合（比较原始与内缩两组端点）+ 最近调色板索引，面向加载期一次性编码；
+ * 解码器遵循 D3D 规范，支持 BC1 三色 + 透明模式与 BC4 六值模式。
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+namespace SR {
+
+/// BC1 / BC4 块字节数
+constexpr size_t kBC1BlockBytes = 8;
+/// BC3 / BC5 块字节数
+constexpr size_t kBC3BlockBytes = 16;
+
+/**
+ * @brief 编码 BC1 块（RGB，4 色模式，不保留 alpha）
+ * @param rgba 16 个 RGBA8 纹素
+ * @param out  8 字节输出
+ */
+void EncodeBC1Block(const uint8_t rgba[64], uint8_t out[8]);
+
+/**
+ * @brief 编码 BC3 块（BC4 形式的 alpha + BC1 颜色）
+ * @param rgba 16 个 RGBA8 纹素
+ * @param out  16 字节输出
+ */
+void EncodeBC3Block(const uint8_t rgba[64], uint8_t out[16]);
+
+/**
+ * @brief 编码 BC4 块（单通道）
+ * @param values 16 个 8-bit 值
+ * @param out    8 字节输出
+ */
+void EncodeBC4Block(const uint8_t values[16], uint8_t out[8]);
+
+/**
+ * @brief 编码 BC5 块（双通道，两个 BC4 块）
+ * @param red   16 个 R 值
+ * @param green 16 个 G 值
+ * @param out   16 字节输出
+ */
+void EncodeBC5Block(const uint8_t red[16], const uint8_t green[16], uint8_t out[16]);
+
+/** @brief 解码 BC1 块为 16 个 RGBA8 纹素 */
+void DecodeBC1Block(const uint8_t* block, uint8_t rgba[64]);
+
+/** @brief 解码 BC3 块为 16 个 RGBA8 纹素 */
+void DecodeBC3Block(const uint8_t* block, uint8_t rgba[64]);
+
+/** @brief 解码 BC4 块为 16 个 8-bit 值 */
+void DecodeBC4Block(const uint8_t* block, uint8_t values[16]);
+
+/** @brief 解码 BC5 块为 16 个 R 值与 16 个 G 值 */
+void DecodeBC5Block(const uint8_t* block, uint8_t red[16], uint8_t green[16]);
+
+} // namespace SR
@@ -0,0 +1,56 @@
+#pragma once
+
+/**
+ * @file MappedFile.h
+ * @brief 只读内存映射文件（Windows: CreateFileMapping / MapViewOfFile，其他平台: mmap）。
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace SR {
+
+/**
+ * @brief 只读内存映射文件，析构时解除映射
+ *
+ * 不可复制，可移动；映射期间 Data() 指向的内容保持有效。
+ */
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    /**
+     * @brief 以只读方式映射整个文件（先关闭已有映射）
+     * @return 成功返回 true；文件不存在、为空或映射失败返回 false
+     */
+    bool Open(const std::string& path);
+
+    /** @brief 解除映射 */
+    void Close();
+
+    /** @brief 是否已映射 */
+    bool IsOpen() const { return m_data != nullptr; }
+
+    /** @brief 映射起始地址（页对齐） */
+    const uint8_t* Data() const { return m_data; }
+
+    /** @brief 文件字节数 */
+    size_t Size() const { return m_size; }
+
+private:
+    const uint8_t* m_data = nullptr;
+    size_t m_size = 0;
+#if defined(_WIN32)
+    void* m_file = nullptr;    ///< 文件句柄（HANDLE）
+    void* m_mapping = nullptr; ///< 映射对象句柄（HANDLE）
+#endif
+};
+
+} // namespace SR
@@ -7,18 +7,27 @@
  * 包含：
  *   - WrapCoord         — 纹理坐标回绕（ClampToEdge / MirroredRepeat / Repeat）
  *   - UseLinearFilter   — 根据采样器配置判断是否使用双线性过滤
- *   - SRGB8ToLinear     — sRGB 8-bit 到线性空间转换
+ *   - SRGB8ToLinear     — sRGB 8-bit 到线性空间转换（查表）
  *   - SampleImageNearest  — 最近邻采样
  *   - SampleImageBilinear — 双线性采样
+ *   - SampleTextureNearest / SampleTextureBilinear — 采样就绪纹理（PreparedTexture）的对应版本
+ *   - ComputeTextureLod — 由 UV 屏幕空间导数计算 mip LOD
+ *   - SampleTextureMipNearest / SampleTextureTrilinear — 最近 mip 级 / 相邻两级插值采样
+ *   - SampleTexture     — 按 GLTFFilterMode（min/mag）选择上述采样方式
+ *   - MakeTextureDescriptor / SampleTexture(TextureDescriptor) — 预解析回绕/过滤函数指针的描述符采样
  */
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstdint>
+#include <limits>
+#include <type_traits>
 
 #include "Asset/GLTFTypes.h"
 #include "Math/Vec2.h"
 #include "Math/Vec3.h"
+#include "Scene/PreparedTexture.h"
 
 namespace SR {
 
@@ -71,17 +80,42 @@ inline bool UseLinearFilter(const GLTFSampler* sampler) {
            minFilter == GLTFFilterMode::LinearMipmapLinear;
 }
 
+/**
+ * @brief 缩小过滤是否需要 mip 链（minFilter 为任一 *Mipmap* 模式）
+ * @param sampler 采样器指针，为 nullptr 时返回 false
+ */
+inline bool UsesMipmapFilter(const GLTFSampler* sampler) {
+    if (!sampler) {
+        return false;
+    }
+    return sampler->minFilter == GLTFFilterMode::NearestMipmapNearest ||
+           sampler->minFilter == GLTFFilterMode::LinearMipmapNearest ||
+           sampler->minFilter == GLTFFilterMode::NearestMipmapLinear ||
+           sampler->minFilter == GLTFFilterMode::LinearMipmapLinear;
+}
+
+/**
+ * @brief sRGB 8-bit → 线性亮度查找表（首次使用时按 IEC 61966-2-1 公式生成）
+ */
+inline const std::array<double, 256>& GetSRGB8ToLinearTable() {
+    static const std::array<double, 256> table = [] {
+        std::array<double, 256> t{};
+        for (int i = 0; i < 256; ++i) {
+            double x = static_cast<double>(i) / 255.0;
+            t[static_cast<size_t>(i)] = (x <= 0.04045) ? x / 12.92 : std::pow((x + 0.055) / 1.055, 2.4);
+        }
+        return t;
+    }();
+    return table;
+}
+
 /**
  * @brief 将 sRGB 8-bit 像素值转换为线性亮度
  * @param v sRGB 编码的 8-bit 值 [0, 255]
  * @return 线性亮度 [0.0, 1.0]
  */
 inline double SRGB8ToLinear(uint8_t v) {
-    double x = static_cast<double>(v) / 255.0;
-    if (x <= 0.04045) {
-        return x / 12.92;
-    }
-    return std::pow((x + 0.055) / 1.055, 2.4);
+    return GetSRGB8ToLinearTable()[v];
 }
 
 /**
@@ -167,4 +201,418 @@ inline SampledColor SampleImageBilinear(const GLTFImage& image, const GLTFSample
     return {rgb, a0 * (1.0 - ty) + a1 * ty};
 }
 
+// ========== 采样就绪纹理（PreparedTexture） ==========
+
+/**
+ * @brief 读取一个纹素的 RGBA（线性；RGBA32FPremultiplied / BC3 格式为预乘值）
+ *
+ * BCn 格式经当前线程的 DecodedBlockCache 读取所在块的解码结果。
+ */
+template <PreparedTextureFormat kFormat>
+inline void FetchPreparedTexel(const PreparedTexture& texture, size_t texelIndex, double out[4]) {
+    const size_t base = texelIndex * 4;
+    if constexpr (kFormat == PreparedTextureFormat::RGBA8Unorm) {
+        constexpr double kInv255 = 1.0 / 255.0;
+        const uint8_t* p = texture.texels8.data() + base;
+        out[0] = p[0] * kInv255; out[1] = p[1] * kInv255; out[2] = p[2] * kInv255; out[3] = p[3] * kInv255;
+    } else if constexpr (kFormat == PreparedTextureFormat::RGBA16Linear) {
+        constexpr double kInv65535 = 1.0 / 65535.0;
+        const uint16_t* p = texture.texels16.data() + base;
+        out[0] = p[0] * kInv65535; out[1] = p[1] * kInv65535; out[2] = p[2] * kInv65535; out[3] = p[3] * kInv65535;
+    } else if constexpr (IsBlockCompressed(kFormat)) {
+        const float* p = GetDecodedBlockCache().Fetch(texture, texelIndex >> 4) + (texelIndex & 15) * 4;
+        out[0] = p[0]; out[1] = p[1]; out[2] = p[2]; out[3] = p[3];
+    } else {
+        const float* p = texture.texelsF32.data() + base;
+        out[0] = p[0]; out[1] = p[1]; out[2] = p[2]; out[3] = p[3];
+    }
+}
+
+/**
+ * @brief 由插值后的 RGBA 生成采样结果（预乘格式在过滤后反预乘）
+ */
+template <PreparedTextureFormat kFormat>
+inline SampledColor ResolvePreparedColor(const double c[4]) {
+    if constexpr (kFormat == PreparedTextureFormat::RGBA32FPremultiplied || kFormat == PreparedTextureFormat::BC3) {
+        const double invA = (c[3] > 1e-6) ? 1.0 / c[3] : 0.0;
+        return {Vec3{c[0] * invA, c[1] * invA, c[2] * invA}, c[3]};
+    } else {
+        return {Vec3{c[0], c[1], c[2]}, c[3]};
+    }
+}
+
+/**
+ * @brief 在单个 mip 级别上采样（最近邻或双线性），输出未反预乘的 RGBA
+ * @param u, v 已回绕到 [0, 1] 的纹理坐标
+ */
+template <PreparedTextureFormat kFormat, bool kBilinear>
+inline void SampleTextureLevelT(const PreparedTexture& texture, int levelIndex, double u, double v, double out[4]) {
+    const PreparedTextureLevel& level = texture.levels[static_cast<size_t>(levelIndex)];
+
+    if constexpr (!kBilinear) {
+        int x = static_cast<int>(u * level.width);
+        int y = static_cast<int>(v * level.height);
+        x = std::max(0, std::min(x, level.width - 1));
+        y = std::max(0, std::min(y, level.height - 1));
+        FetchPreparedTexel<kFormat>(texture, level.TexelIndex(x, y), out);
+    } else {
+        double fx = u * (level.width - 1);
+        double fy = v * (level.height - 1);
+        int x0 = static_cast<int>(fx);
+        int y0 = static_cast<int>(fy);
+        int x1 = std::min(x0 + 1, level.width - 1);
+        int y1 = std::min(y0 + 1, level.height - 1);
+        double tx = fx - x0;
+        double ty = fy - y0;
+
+        double c00[4], c10[4], c01[4], c11[4];
+        FetchPreparedTexel<kFormat>(texture, level.TexelIndex(x0, y0), c00);
+        FetchPreparedTexel<kFormat>(texture, level.TexelIndex(x1, y0), c10);
+        FetchPreparedTexel<kFormat>(texture, level.TexelIndex(x0, y1), c01);
+        FetchPreparedTexel<kFormat>(texture, level.TexelIndex(x1, y1), c11);
+
+        for (int i = 0; i < 4; ++i) {
+            double top = c00[i] * (1.0 - tx) + c10[i] * tx;
+            double bottom = c01[i] * (1.0 - tx) + c11[i] * tx;
+            out[i] = top * (1.0 - ty) + bottom * ty;
+        }
+    }
+}
+
+/// @brief 按采样器回绕模式处理纹理坐标
+inline void WrapTexCoord(const GLTFSampler* sampler, const Vec2& uv, double& u, double& v) {
+    u = WrapCoord(uv.x, sampler ? sampler->wrapS : GLTFWrapMode::Repeat);
+    v = WrapCoord(uv.y, sampler ? sampler->wrapT : GLTFWrapMode::Repeat);
+}
+
+/// @brief 基础级采样（最近邻或双线性）
+template <PreparedTextureFormat kFormat, bool kBilinear>
+inline SampledColor SampleTextureBaseT(const PreparedTexture& texture, const GLTFSampler* sampler, const Vec2& uv) {
+    double u, v, c[4];
+    WrapTexCoord(sampler, uv, u, v);
+    SampleTextureLevelT<kFormat, kBilinear>(texture, 0, u, v, c);
+    return ResolvePreparedColor<kFormat>(c);
+}
+
+/// @brief 最近 mip 级采样：级别 = round(lod)，钳制到 [0, levelCount-1]
+template <PreparedTextureFormat kFormat, bool kBilinear>
+inline SampledColor SampleTextureMipNearestT(const PreparedTexture& texture, const GLTFSampler* sampler,
+                                             const Vec2& uv, double lod) {
+    const double maxLevel = static_cast<double>(texture.GetLevelCount() - 1);
+    const int level = static_cast<int>(std::floor(std::clamp(lod, 0.0, maxLevel) + 0.5));
+    double u, v, c[4];
+    WrapTexCoord(sampler, uv, u, v);
+    SampleTextureLevelT<kFormat, kBilinear>(texture, level, u, v, c);
+    return ResolvePreparedColor<kFormat>(c);
+}
+
+/// @brief 相邻两级 mip 插值采样（kBilinear 时即三线性过滤）
+template <PreparedTextureFormat kFormat, bool kBilinear>
+inline SampledColor SampleTextureTrilinearT(const PreparedTexture& texture, const GLTFSampler* sampler,
+                                            const Vec2& uv, double lod) {
+    const int levelCount = texture.GetLevelCount();
+    const double clamped = std::clamp(lod, 0.0, static_cast<double>(levelCount - 1));
+    const int level0 = static_cast<int>(clamped);
+    const int level1 = std::min(level0 + 1, levelCount - 1);
+    const double t = clamped - level0;
+
+    double u, v, c0[4], c[4];
+    WrapTexCoord(sampler, uv, u, v);
+    SampleTextureLevelT<kFormat, kBilinear>(texture, level0, u, v, c0);
+    if (level1 == level0 || t <= 0.0) {
+        return ResolvePreparedColor<kFormat>(c0);
+    }
+    // 预乘格式在预乘空间插值，反预乘放在最后
+    SampleTextureLevelT<kFormat, kBilinear>(texture, level1, u, v, c);
+    for (int i = 0; i < 4; ++i) {
+        c[i] = c0[i] + (c[i] - c0[i]) * t;
+    }
+    return ResolvePreparedColor<kFormat>(c);
+}
+
+/**
+ * @brief 按纹理存储格式分派到模板特化版本
+ * @param fn 接收 std::integral_constant<PreparedTextureFormat, F> 的可调用对象
+ */
+template <typename Fn>
+inline decltype(auto) DispatchPreparedFormat(PreparedTextureFormat format, Fn&& fn) {
+    switch (format) {
+    case PreparedTextureFormat::RGBA16Linear:
+        return fn(std::integral_constant<PreparedTextureFormat, PreparedTextureFormat::RGBA16Linear>{});
+    case PreparedTextureFormat::RGBA32FPremultiplied:
+        return fn(std::integral_constant<PreparedTextureFormat, PreparedTextureFormat::RGBA32FPremultiplied>{});
+    case PreparedTextureFormat::BC1:
+        return fn(std::integral_constant<PreparedTextureFormat, PreparedTextureFormat::BC1>{});
+    case PreparedTextureFormat::BC3:
+        return fn(std::integral_constant<PreparedTextureFormat, PreparedTextureFormat::BC3>{});
+    case PreparedTextureFormat::BC4:
+        return fn(std::integral_constant<PreparedTextureFormat, PreparedTextureFormat::BC4>{});
+    case PreparedTextureFormat::BC5:
+        return fn(std::integral_constant<PreparedTextureFormat, PreparedTextureFormat::BC5>{});
+    default:
+        return fn(std::integral_constant<PreparedTextureFormat, PreparedTextureFormat::RGBA8Unorm>{});
+    }
+}
+
+/**
+ * @brief 最近邻采样采样就绪纹理（基础级）
+ * @param texture 采样就绪纹理
+ * @param sampler 采样器（可为 nullptr，则使用 Repeat 模式）
+ * @param uv      纹理坐标
+ * @return 线性空间的采样颜色（非预乘）
+ */
+inline SampledColor SampleTextureNearest(const PreparedTexture& texture, const GLTFSampler* sampler, const Vec2& uv) {
+    return DispatchPreparedFormat(texture.format, [&](auto format) {
+        return SampleTextureBaseT<decltype(format)::value, false>(texture, sampler, uv);
+    });
+}
+
+/**
+ * @brief 双线性采样采样就绪纹理（基础级）
+ * @param texture 采样就绪纹理
+ * @param sampler 采样器（可为 nullptr，则使用 Repeat 模式）
+ * @param uv      纹理坐标
+ * @return 线性空间的采样颜色（非预乘）
+ */
+inline SampledColor SampleTextureBilinear(const PreparedTexture& texture, const GLTFSampler* sampler, const Vec2& uv) {
+    return DispatchPreparedFormat(texture.format, [&](auto format) {
+        return SampleTextureBaseT<decltype(format)::value, true>(texture, sampler, uv);
+    });
+}
+
+/**
+ * @brief 由 UV 屏幕空间导数计算 mip LOD
+ *
+ * λ = log2(ρ)，ρ = max(|∂uv/∂x|, |∂uv/∂y|)（以基础级纹素为单位）。
+ * @param width, height 基础级尺寸
+ * @param dUVdx, dUVdy  纹理坐标对屏幕 x / y 的导数
+ * @return LOD；导数为 0 时返回 -inf（视为放大）
+ */
+inline double ComputeTextureLod(int width, int height, const Vec2& dUVdx, const Vec2& dUVdy) {
+    const double dxU = dUVdx.x * width;
+    const double dxV = dUVdx.y * height;
+    const double dyU = dUVdy.x * width;
+    const double dyV = dUVdy.y * height;
+    const double rho2 = std::max(dxU * dxU + dxV * dxV, dyU * dyU + dyV * dyV);
+    return rho2 > 0.0 ? 0.5 * std::log2(rho2) : -std::numeric_limits<double>::infinity();
+}
+
+/**
+ * @brief 最近 mip 级采样
+ * @param lod      mip LOD（见 ComputeTextureLod）
+ * @param bilinear 级内是否双线性过滤（LinearMipmapNearest），否则最近邻（NearestMipmapNearest）
+ */
+inline SampledColor SampleTextureMipNearest(const PreparedTexture& texture, const GLTFSampler* sampler,
+                                            const Vec2& uv, double lod, bool bilinear) {
+    return DispatchPreparedFormat(texture.format, [&](auto format) {
+        return bilinear ? SampleTextureMipNearestT<decltype(format)::value, true>(texture, sampler, uv, lod)
+                        : SampleTextureMipNearestT<decltype(format)::value, false>(texture, sampler, uv, lod);
+    });
+}
+
+/**
+ * @brief 相邻两级 mip 插值采样
+ * @param lod      mip LOD（见 ComputeTextureLod）
+ * @param bilinear 级内是否双线性过滤（LinearMipmapLinear，即三线性），否则最近邻（NearestMipmapLinear）
+ */
+inline SampledColor SampleTextureTrilinear(const PreparedTexture& texture, const GLTFSampler* sampler,
+                                           const Vec2& uv, double lod, bool bilinear) {
+    return DispatchPreparedFormat(texture.format, [&](auto format) {
+        return bilinear ? SampleTextureTrilinearT<decltype(format)::value, true>(texture, sampler, uv, lod)
+                        : SampleTextureTrilinearT<decltype(format)::value, false>(texture, sampler, uv, lod);
+    });
+}
+
+/**
+ * @brief 按采样器过滤模式采样采样就绪纹理
+ *
+ * LOD <= 0（放大）时使用 magFilter，否则按 minFilter 选择基础级最近邻/双线性或各 mipmap 模式。
+ * 未指定（None）的过滤模式沿用 UseLinearFilter 的规则，只在基础级采样。
+ * 纹理未生成 mip 链时 mipmap 模式退化为基础级采样。
+ * @param dUVdx, dUVdy 纹理坐标的屏幕空间导数（全 0 时按放大处理）
+ */
+inline SampledColor SampleTexture(const PreparedTexture& texture, const GLTFSampler* sampler,
+                                  const Vec2& uv, const Vec2& dUVdx, const Vec2& dUVdy) {
+    const GLTFFilterMode minFilter = sampler ? sampler->minFilter : GLTFFilterMode::None;
+    const GLTFFilterMode magFilter = sampler ? sampler->magFilter : GLTFFilterMode::None;
+    const double lod = ComputeTextureLod(texture.width, texture.height, dUVdx, dUVdy);
+
+    const GLTFFilterMode filter = (lod <= 0.0) ? magFilter : minFilter;
+    switch (filter) {
+    case GLTFFilterMode::Nearest:
+        return SampleTextureNearest(texture, sampler, uv);
+    case GLTFFilterMode::Linear:
+        return SampleTextureBilinear(texture, sampler, uv);
+    case GLTFFilterMode::NearestMipmapNearest:
+        return SampleTextureMipNearest(texture, sampler, uv, lod, false);
+    case GLTFFilterMode::LinearMipmapNearest:
+        return SampleTextureMipNearest(texture, sampler, uv, lod, true);
+    case GLTFFilterMode::NearestMipmapLinear:
+        return SampleTextureTrilinear(texture, sampler, uv, lod, false);
+    case GLTFFilterMode::LinearMipmapLinear:
+        return SampleTextureTrilinear(texture, sampler, uv, lod, true);
+    default:
+        return UseLinearFilter(sampler) ? SampleTextureBilinear(texture, sampler, uv)
+                                        : SampleTextureNearest(texture, sampler, uv);
+    }
+}
+
+// ========== 预解析采样描述符（TextureDescriptor） ==========
+
+/// @brief 编译期回绕模式（供描述符的回绕函数指针使用）
+template <GLTFWrapMode kMode>
+inline double WrapCoordT(double v) {
+    return WrapCoord(v, kMode);
+}
+
+/**
+ * @brief 描述符在单个 mip 级别上采样
+ *
+ * kPow2Repeat（两个方向均为 Repeat 且尺寸为 2 的幂，仅用于级内最近邻）时直接按位与回绕，
+ * 不调用 fmod；否则使用预先回绕好的 (u, v)。
+ */
+template <PreparedTextureFormat kFormat, bool kBilinear, bool kPow2Repeat>
+inline void SampleDescriptorLevelT(const TextureDescriptor& desc, int levelIndex, const Vec2& uv,
+                                   double u, double v, double out[4]) {
+    if constexpr (kPow2Repeat) {
+        const PreparedTextureLevel& level = desc.texture->levels[static_cast<size_t>(levelIndex)];
+        const uint32_t x = static_cast<uint32_t>(static_cast<int64_t>(std::floor(uv.x * level.width))) & (desc.widthMask >> levelIndex);
+        const uint32_t y = static_cast<uint32_t>(static_cast<int64_t>(std::floor(uv.y * level.height))) & (desc.heightMask >> levelIndex);
+        FetchPreparedTexel<kFormat>(*desc.texture, level.TexelIndex(static_cast<int>(x), static_cast<int>(y)), out);
+    } else {
+        SampleTextureLevelT<kFormat, kBilinear>(*desc.texture, levelIndex, u, v, out);
+    }
+}
+
+/**
+ * @brief 描述符采样函数（按存储格式、过滤模式与 2 的幂回绕特化）
+ * @param lod mip LOD，仅 *Mipmap* 过滤模式使用
+ */
+template <PreparedTextureFormat kFormat, GLTFFilterMode kFilter, bool kPow2Repeat>
+inline SampledColor SampleDescriptorT(const TextureDescriptor& desc, const Vec2& uv, double lod) {
+    constexpr bool kBilinear = kFilter == GLTFFilterMode::Linear ||
+                               kFilter == GLTFFilterMode::LinearMipmapNearest ||
+                               kFilter == GLTFFilterMode::LinearMipmapLinear;
+    double u = 0.0, v = 0.0;
+    if constexpr (!kPow2Repeat) {
+        u = desc.wrapS(uv.x);
+        v = desc.wrapT(uv.y);
+    }
+
+    double c[4];
+    const double maxLevel = static_cast<double>(desc.texture->GetLevelCount() - 1);
+    if constexpr (kFilter == GLTFFilterMode::Nearest || kFilter == GLTFFilterMode::Linear) {
+        SampleDescriptorLevelT<kFormat, kBilinear, kPow2Repeat>(desc, 0, uv, u, v, c);
+    } else if constexpr (kFilter == GLTFFilterMode::NearestMipmapNearest || kFilter == GLTFFilterMode::LinearMipmapNearest) {
+        const int level = static_cast<int>(std::floor(std::clamp(lod, 0.0, maxLevel) + 0.5));
+        SampleDescriptorLevelT<kFormat, kBilinear, kPow2Repeat>(desc, level, uv, u, v, c);
+    } else {
+        const double clamped = std::clamp(lod, 0.0, maxLevel);
+        const int level0 = static_cast<int>(clamped);
+        const double t = clamped - level0;
+        SampleDescriptorLevelT<kFormat, kBilinear, kPow2Repeat>(desc, level0, uv, u, v, c);
+        if (t > 0.0) {
+            double c1[4];
+            SampleDescriptorLevelT<kFormat, kBilinear, kPow2Repeat>(desc, level0 + 1, uv, u, v, c1);
+            for (int i = 0; i < 4; ++i) {
+                c[i] += (c1[i] - c[i]) * t;
+            }
+        }
+    }
+    return ResolvePreparedColor<kFormat>(c);
+}
+
+/// @brief 按过滤模式与 2 的幂回绕选择描述符采样函数
+template <PreparedTextureFormat kFormat>
+inline TextureDescriptor::SampleFn SelectDescriptorSampleFn(GLTFFilterMode filter, bool pow2Repeat) {
+    switch (filter) {
+    case GLTFFilterMode::Linear:
+        return &SampleDescriptorT<kFormat, GLTFFilterMode::Linear, false>;
+    case GLTFFilterMode::NearestMipmapNearest:
+        return pow2Repeat ? &SampleDescriptorT<kFormat, GLTFFilterMode::NearestMipmapNearest, true>
+                          : &SampleDescriptorT<kFormat, GLTFFilterMode::NearestMipmapNearest, false>;
+    case GLTFFilterMode::LinearMipmapNearest:
+        return &SampleDescriptorT<kFormat, GLTFFilterMode::LinearMipmapNearest, false>;
+    case GLTFFilterMode::NearestMipmapLinear:
+        return pow2Repeat ? &SampleDescriptorT<kFormat, GLTFFilterMode::NearestMipmapLinear, true>
+                          : &SampleDescriptorT<kFormat, GLTFFilterMode::NearestMipmapLinear, false>;
+    case GLTFFilterMode::LinearMipmapLinear:
+        return &SampleDescriptorT<kFormat, GLTFFilterMode::LinearMipmapLinear, false>;
+    default:
+        return pow2Repeat ? &SampleDescriptorT<kFormat, GLTFFilterMode::Nearest, true>
+                          : &SampleDescriptorT<kFormat, GLTFFilterMode::Nearest, false>;
+    }
+}
+
+/**
+ * @brief 创建纹理采样描述符
+ *
+ * 过滤模式的解析与 SampleTexture(PreparedTexture) 一致：未指定（None）沿用 UseLinearFilter，
+ * 无 mip 链时 *Mipmap* 模式退化为对应的基础级过滤。
+ * @param texture 采样就绪纹理（描述符保存其指针，需保证生命周期）
+ * @param sampler 采样器（可为 nullptr，则使用 Repeat + 默认过滤）
+ */
+inline TextureDescriptor MakeTextureDescriptor(const PreparedTexture& texture, const GLTFSampler* sampler) {
+    auto wrapFn = [](GLTFWrapMode mode) -> TextureDescriptor::WrapFn {
+        switch (mode) {
+        case GLTFWrapMode::ClampToEdge: return &WrapCoordT<GLTFWrapMode::ClampToEdge>;
+        case GLTFWrapMode::MirroredRepeat: return &WrapCoordT<GLTFWrapMode::MirroredRepeat>;
+        default: return &WrapCoordT<GLTFWrapMode::Repeat>;
+        }
+    };
+    const GLTFWrapMode wrapS = sampler ? sampler->wrapS : GLTFWrapMode::Repeat;
+    const GLTFWrapMode wrapT = sampler ? sampler->wrapT : GLTFWrapMode::Repeat;
+    const bool legacyLinear = UseLinearFilter(sampler);
+    const bool hasMips = texture.GetLevelCount() > 1;
+
+    auto resolveFilter = [&](GLTFFilterMode mode) {
+        switch (mode) {
+        case GLTFFilterMode::Nearest:
+        case GLTFFilterMode::Linear:
+            return mode;
+        case GLTFFilterMode::NearestMipmapNearest:
+        case GLTFFilterMode::NearestMipmapLinear:
+            return hasMips ? mode : GLTFFilterMode::Nearest;
+        case GLTFFilterMode::LinearMipmapNearest:
+        case GLTFFilterMode::LinearMipmapLinear:
+            return hasMips ? mode : GLTFFilterMode::Linear;
+        default:
+            return legacyLinear ? GLTFFilterMode::Linear : GLTFFilterMode::Nearest;
+        }
+    };
+    const GLTFFilterMode magFilter = resolveFilter(sampler ? sampler->magFilter : GLTFFilterMode::None);
+    const GLTFFilterMode minFilter = resolveFilter(sampler ? sampler->minFilter : GLTFFilterMode::None);
+
+    auto isPow2 = [](int n) { return n > 0 && (n & (n - 1)) == 0; };
+    const bool pow2Repeat = wrapS == GLTFWrapMode::Repeat && wrapT == GLTFWrapMode::Repeat &&
+                            isPow2(texture.width) && isPow2(texture.height);
+
+    TextureDescriptor desc;
+    desc.texture = &texture;
+    desc.wrapS = wrapFn(wrapS);
+    desc.wrapT = wrapFn(wrapT);
+    desc.widthMask = isPow2(texture.width) ? static_cast<uint32_t>(texture.width - 1) : 0u;
+    desc.heightMask = isPow2(texture.height) ? static_cast<uint32_t>(texture.height - 1) : 0u;
+    DispatchPreparedFormat(texture.format, [&](auto format) {
+        desc.magnify = SelectDescriptorSampleFn<decltype(format)::value>(magFilter, pow2Repeat);
+        desc.minify = SelectDescriptorSampleFn<decltype(format)::value>(minFilter, pow2Repeat);
+    });
+    return desc;
+}
+
+/**
+ * @brief 通过预解析描述符采样
+ * @param desc         纹理描述符
+ * @param uv           纹理坐标
+ * @param dUVdx, dUVdy 纹理坐标的屏幕空间导数（全 0 时按放大处理）
+ * @return 线性空间的采样颜色（非预乘）
+ */
+inline SampledColor SampleTexture(const TextureDescriptor& desc, const Vec2& uv, const Vec2& dUVdx, const Vec2& dUVdy) {
+    if (desc.minify == desc.magnify) {
+        return desc.magnify(desc, uv, 0.0);
+    }
+    const double lod = ComputeTextureLod(desc.texture->width, desc.texture->height, dUVdx, dUVdy);
+    return (lod <= 0.0 ? desc.magnify : desc.minify)(desc, uv, lod);
+}
+
 } // namespace SR
@@ -552,6 +552,35 @@ bool ParseGLTFJson(const JSONValue& root, const std::filesystem::path& basePath,
         }
     }
 
+    // KHR_lights_punctual 扩展：根级光源定义，由节点引用
+    const JSONValue& rootExtensions = root["extensions"];
+    if (rootExtensions.IsObject() && rootExtensions.HasKey("KHR_lights_punctual")) {
+        const JSONValue& lights = rootExtensions["KHR_lights_punctual"]["lights"];
+        if (lights.IsArray()) {
+            outAsset.lights.reserve(lights.arrayValue.size());
+            for (const auto& lightObj : lights.arrayValue) {
+                if (!lightObj.IsObject()) {
+                    outError = "Invalid KHR_lights_punctual light entry";
+                    return false;
+                }
+                GLTFLight light;
+                light.name = ReadString(lightObj["name"], "");
+                const std::string type = ReadString(lightObj["type"], "point");
+                light.type = (type == "directional") ? GLTFLightType::Directional
+                           : (type == "spot") ? GLTFLightType::Spot : GLTFLightType::Point;
+                ReadArray(lightObj["color"], light.color, 3);
+                light.intensity = ReadDouble(lightObj["intensity"], light.intensity);
+                light.range = ReadDouble(lightObj["range"], light.range);
+                const JSONValue& spot = lightObj["spot"];
+                if (spot.IsObject()) {
+                    light.innerConeAngle = ReadDouble(spot["innerConeAngle"], light.innerConeAngle);
+                    light.outerConeAngle = ReadDouble(spot["outerConeAngle"], light.outerConeAngle);
+                }
+                outAsset.lights.push_back(std::move(light));
+            }
+        }
+    }
+
     const JSONValue& nodes = root["nodes"];
     if (nodes.IsArray()) {
         outAsset.nodes.reserve(nodes.arrayValue.size());
@@ -578,6 +607,23 @@ bool ParseGLTFJson(const JSONValue& root, const std::filesystem::path& basePath,
                 ReadArray(nodeObj["matrix"], node.matrix, 16);
                 node.hasMatrix = true;
             }
+            const JSONValue& nodeExtensions = nodeObj["extensions"];
+            if (nodeExtensions.IsObject() && nodeExtensions.HasKey("KHR_lights_punctual")) {
+                node.lightIndex = ReadInt(nodeExtensions["KHR_lights_punctual"]["light"], -1);
+            }
+            if (nodeExtensions.IsObject() && nodeExtensions.HasKey("EXT_mesh_gpu_instancing")) {
+                // EXT_mesh_gpu_instancing 扩展：每实例 TRS 以访问器形式给出
+                const JSONValue& instancingObj = nodeExtensions["EXT_mesh_gpu_instancing"];
+                const JSONValue& instAttributes = instancingObj["attributes"];
+                if (instancingObj.IsObject() && instAttributes.IsObject()) {
+                    node.instancing.translationAccessor = ReadInt(instAttributes["TRANSLATION"], -1);
+                    node.instancing.rotationAccessor = ReadInt(instAttributes["ROTATION"], -1);
+                    node.instancing.scaleAccessor = ReadInt(instAttributes["SCALE"], -1);
+                    node.instancing.hasInstancing = node.instancing.translationAccessor >= 0 ||
+                                                    node.instancing.rotationAccessor >= 0 ||
+                                                    node.instancing.scaleAccessor >= 0;
+                }
+            }
             outAsset.nodes.push_back(node);
         }
     }
@@ -466,17 +466,20 @@ int ExtendSign(int value, int bits) {
 }
 
 void IDCT8x8(const int16_t* inBlock, uint8_t* out, int outStride) {
-    static double cosTable[8][8];
-    static bool initialized = false;
-    constexpr double kPi = 3.14159265358979323846;
-    if (!initialized) {
-        for (int v = 0; v < 8; ++v) {
-            for (int x = 0; x < 8; ++x) {
-                cosTable[v][x] = std::cos(((2.0 * x + 1.0) * v * kPi) / 16.0);
+    // 局部静态对象的初始化是线程安全的（多个线程可同时解码）
+    struct CosTable {
+        double values[8][8];
+        CosTable() {
+            constexpr double kPi = 3.14159265358979323846;
+            for (int v = 0; v < 8; ++v) {
+                for (int x = 0; x < 8; ++x) {
+                    values[v][x] = std::cos(((2.0 * x + 1.0) * v * kPi) / 16.0);
+                }
             }
         }
-        initialized = true;
-    }
+    };
+    static const CosTable kCosTable;
+    const auto& cosTable = kCosTable.values;
 
     for (int y = 0; y < 8; ++y) {
         for (int x = 0; x < 8; ++x) {
@@ -1,6 +1,6 @@
 #include "Core/DepthBuffer.h"
 
-#include <omp.h>
+#include "Core/Parallel.h"
 
 namespace SR {
 
@@ -18,14 +18,9 @@ void DepthBuffer::Resize(int width, int height) {
  */
 void DepthBuffer::Clear(double depthValue) {
     const int n = static_cast<int>(m_depth.size());
-#if defined(SR_INTEL_OMP)
-    #pragma omp parallel for schedule(guided, 4096)
-#else
-    #pragma omp parallel for schedule(dynamic, 4096)
-#endif
-    for (int i = 0; i < n; ++i) {
+    Parallel::For(0, n, 4096, Parallel::kBalanced, [&](int i) {
         m_depth[static_cast<size_t>(i)] = depthValue;
-    }
+    });
 }
 
 /**
@@ -0,0 +1,316 @@
+#include "Core/FrameArena.h"
+
+#include <algorithm>
+#include <atomic>
+#include <new>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+namespace SR {
+
+namespace {
+
+constexpr size_t kPageBytes = 4096;
+constexpr size_t kHugePageBytes = 2 * 1024 * 1024; ///< Linux 透明大页粒度
+constexpr size_t kMinBlockBytes = 64 * 1024;       ///< 首次分配 / 溢出新块的最小字节数
+
+inline size_t RoundUp(size_t value, size_t align) {
+    return (value + align - 1) / align * align;
+}
+
+/// 按帧高水位加 25% 余量确定单块容量
+inline size_t TargetBytes(size_t peak, size_t minBytes) {
+    return std::max(minBytes, peak + peak / 4);
+}
+
+/// 直接向系统申请的页区间
+struct PageSpan {
+    uint8_t* base = nullptr;
+    size_t size = 0;
+    bool huge = false;
+};
+
+#if defined(_WIN32)
+
+/// Large Page 需要 SeLockMemoryPrivilege；首次失败后不再尝试
+std::atomic<bool> g_largePagesUnavailable{false};
+
+PageSpan MapPages(size_t bytes, bool tryHuge) {
+    const size_t largePage = GetLargePageMinimum();
+    if (tryHuge && largePage > 0 && bytes >= largePage &&
+        !g_largePagesUnavailable.load(std::memory_order_relaxed)) {
+        const size_t size = RoundUp(bytes, largePage);
+        void* p = VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+        if (p) {
+            return PageSpan{static_cast<uint8_t*>(p), size, true};
+        }
+        g_largePagesUnavailable.store(true, std::memory_order_relaxed);
+    }
+    const size_t size = RoundUp(bytes, 64 * 1024);
+    void* p = VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+    return p ? PageSpan{static_cast<uint8_t*>(p), size, false} : PageSpan{};
+}
+
+void UnmapPages(const PageSpan& span) {
+    VirtualFree(span.base, 0, MEM_RELEASE);
+}
+
+#else
+
+PageSpan MapPages(size_t bytes, bool tryHuge) {
+#if defined(MADV_HUGEPAGE)
+    if (tryHuge && bytes >= kHugePageBytes) {
+        // 多映射一个大页再裁掉首尾，使起始地址按 2MB 对齐，THP 才能整页替换
+        const size_t size = RoundUp(bytes, kHugePageBytes);
+        void* raw = mmap(nullptr, size + kHugePageBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (raw != MAP_FAILED) {
+            uint8_t* start = static_cast<uint8_t*>(raw);
+            uint8_t* aligned = reinterpret_cast<uint8_t*>(RoundUp(reinterpret_cast<uintptr_t>(start), kHugePageBytes));
+            const size_t head = static_cast<size_t>(aligned - start);
+            if (head > 0) {
+                munmap(start, head);
+            }
+            munmap(aligned + size, kHugePageBytes - head);
+            const bool huge = madvise(aligned, size, MADV_HUGEPAGE) == 0;
+            return PageSpan{aligned, size, huge};
+        }
+    }
+#else
+    (void)tryHuge;
+#endif
+    const size_t size = RoundUp(bytes, kPageBytes);
+    void* p = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    return p != MAP_FAILED ? PageSpan{static_cast<uint8_t*>(p), size, false} : PageSpan{};
+}
+
+void UnmapPages(const PageSpan& span) {
+    munmap(span.base, span.size);
+}
+
+#endif
+
+} // namespace
+
+// ============================================================================
+// ArenaRegion
+// ============================================================================
+
+ArenaRegion::~ArenaRegion() {
+    ReleaseBlocks();
+}
+
+void* ArenaRegion::Allocate(size_t bytes, size_t align) {
+    const size_t start = RoundUp(m_offset, align);
+    if (m_base && start + bytes <= m_size) {
+        m_offset = start + bytes;
+        m_peak = std::max(m_peak, m_usedBase + m_offset);
+        return m_base + start;
+    }
+    return AllocateSlow(bytes, align);
+}
+
+/**
+ * @brief 当前块空间不足：依次尝试后续已有块，仍不够时追加新块（容量至少翻倍）
+ *
+ * 块起始地址按页对齐，因此块首的分配天然满足 align ≤ 页大小。
+ */
+void* ArenaRegion::AllocateSlow(size_t bytes, size_t align) {
+    while (m_block + 1 < m_blocks.size()) {
+        m_usedBase += m_blocks[m_block].size;
+        ++m_block;
+        m_base = m_blocks[m_block].base;
+        m_size = m_blocks[m_block].size;
+        m_offset = 0;
+        if (bytes <= m_size) {
+            m_offset = bytes;
+            m_peak = std::max(m_peak, m_usedBase + m_offset);
+            return m_base;
+        }
+    }
+
+    const size_t want = std::max({bytes + align, GetReserved(), kMinBlockBytes});
+    const PageSpan span = MapPages(want, m_useHugePages);
+    if (!span.base) {
+        throw std::bad_alloc();
+    }
+    if (!m_blocks.empty()) {
+        m_usedBase += m_blocks[m_block].size;
+        m_block = m_blocks.size();
+    }
+    m_blocks.push_back(Block{span.base, span.size, span.huge});
+    m_base = span.base;
+    m_size = span.size;
+    m_offset = bytes;
+    m_peak = std::max(m_peak, m_usedBase + m_offset);
+    return m_base;
+}
+
+bool ArenaRegion::TryExtend(const void* ptr, size_t oldBytes, size_t newBytes) {
+    const uint8_t* p = static_cast<const uint8_t*>(ptr);
+    if (!m_base || p < m_base || p + oldBytes != m_base + m_offset) {
+        return false;
+    }
+    const size_t start = static_cast<size_t>(p - m_base);
+    if (start + newBytes > m_size) {
+        return false;
+    }
+    m_offset = start + newBytes;
+    m_peak = std::max(m_peak, m_usedBase + m_offset);
+    return true;
+}
+
+void ArenaRegion::Restore(const ArenaMarker& marker) {
+    m_block = marker.block;
+    m_offset = marker.offset;
+    m_usedBase = marker.usedBase;
+    if (m_block < m_blocks.size()) {
+        m_base = m_blocks[m_block].base;
+        m_size = m_blocks[m_block].size;
+    } else {
+        m_base = nullptr;
+        m_size = 0;
+    }
+}
+
+/**
+ * @brief 帧末复位
+ *
+ * - 本帧溢出到多块：释放全部块，按高水位 × 1.25 重新申请一块（下一帧起不再切块）
+ * - 单块且容量 > max(最小容量, 窗口高水位 × (1 + headroom)) 连续 shrinkDelayFrames 帧：按窗口高水位收缩
+ */
+int ArenaRegion::EndFrame(const FrameArenaOptions& options) {
+    int result = 0;
+    const size_t minBytes = options.minRegionBytes;
+    m_windowPeak = std::max(m_windowPeak, m_peak);
+
+    if (m_blocks.size() > 1) {
+        ResetTo(TargetBytes(m_peak, minBytes));
+        m_surplusFrames = 0;
+        m_windowPeak = 0;
+        result = 1;
+    } else {
+        const double headroom = 1.0 + std::max(0.0, options.shrinkHeadroom);
+        const size_t limit = std::max(minBytes, static_cast<size_t>(static_cast<double>(m_windowPeak) * headroom));
+        if (GetReserved() > limit) {
+            if (++m_surplusFrames >= std::max(1, options.shrinkDelayFrames)) {
+                ResetTo(TargetBytes(m_windowPeak, minBytes));
+                m_surplusFrames = 0;
+                m_windowPeak = 0;
+                result = -1;
+            }
+        } else {
+            m_surplusFrames = 0;
+            m_windowPeak = 0;
+        }
+    }
+
+    m_peak = 0;
+    Restore(ArenaMarker{});
+    return result;
+}
+
+size_t ArenaRegion::GetReserved() const {
+    size_t total = 0;
+    for (const Block& block : m_blocks) {
+        total += block.size;
+    }
+    return total;
+}
+
+size_t ArenaRegion::GetHugePageBytes() const {
+    size_t total = 0;
+    for (const Block& block : m_blocks) {
+        total += block.huge ? block.size : 0;
+    }
+    return total;
+}
+
+void ArenaRegion::ReleaseBlocks() {
+    for (const Block& block : m_blocks) {
+        UnmapPages(PageSpan{block.base, block.size, block.huge});
+    }
+    m_blocks.clear();
+    Restore(ArenaMarker{});
+}
+
+/// 释放全部块并重新申请一块 bytes 字节（申请失败时保持为空，下次分配再申请）
+void ArenaRegion::ResetTo(size_t bytes) {
+    ReleaseBlocks();
+    const PageSpan span = MapPages(bytes, m_useHugePages);
+    if (span.base) {
+        m_blocks.push_back(Block{span.base, span.size, span.huge});
+    }
+}
+
+// ============================================================================
+// FrameArena
+// ============================================================================
+
+FrameArena::Scope::Scope(FrameArena& arena)
+    : m_arena(arena), m_shared(arena.m_shared->Mark()), m_threadCount(arena.m_threads.size()) {
+    if (m_threadCount > 0) {
+        m_threadMarks = arena.m_shared->AllocateArray<ArenaMarker>(m_threadCount);
+        for (size_t i = 0; i < m_threadCount; ++i) {
+            m_threadMarks[i] = arena.m_threads[i]->Mark();
+        }
+    }
+}
+
+FrameArena::Scope::~Scope() {
+    // 作用域内新建的线程区域起始即为空，回滚到起点
+    for (size_t i = 0; i < m_arena.m_threads.size(); ++i) {
+        m_arena.m_threads[i]->Restore(i < m_threadCount ? m_threadMarks[i] : ArenaMarker{});
+    }
+    m_arena.m_shared->Restore(m_shared);
+}
+
+FrameArena::FrameArena() : FrameArena(FrameArenaOptions{}) {}
+
+FrameArena::FrameArena(const FrameArenaOptions& options)
+    : m_options(options), m_shared(std::make_unique<ArenaRegion>()) {
+    m_shared->SetUseHugePages(options.useHugePages);
+}
+
+FrameArena::~FrameArena() = default;
+
+void FrameArena::SetOptions(const FrameArenaOptions& options) {
+    m_options = options;
+    m_shared->SetUseHugePages(options.useHugePages);
+    for (const std::unique_ptr<ArenaRegion>& region : m_threads) {
+        region->SetUseHugePages(options.useHugePages);
+    }
+}
+
+void FrameArena::EnsureThreadRegions(int count) {
+    while (static_cast<int>(m_threads.size()) < count) {
+        m_threads.push_back(std::make_unique<ArenaRegion>());
+        m_threads.back()->SetUseHugePages(m_options.useHugePages);
+    }
+}
+
+void FrameArena::EndFrame() {
+    FrameArenaStats stats;
+    auto endRegion = [&](ArenaRegion& region) {
+        const size_t highWater = region.GetHighWater();
+        const int change = region.EndFrame(m_options);
+        stats.highWaterBytes += highWater;
+        stats.reservedBytes += region.GetReserved();
+        stats.hugePageBytes += region.GetHugePageBytes();
+        stats.growCount += change > 0 ? 1 : 0;
+        stats.shrinkCount += change < 0 ? 1 : 0;
+        ++stats.regionCount;
+        return highWater;
+    };
+
+    stats.sharedHighWaterBytes = endRegion(*m_shared);
+    for (const std::unique_ptr<ArenaRegion>& region : m_threads) {
+        stats.threadHighWaterBytes = std::max(stats.threadHighWaterBytes, endRegion(*region));
+    }
+    m_lastStats = stats;
+}
+
+} // namespace SR
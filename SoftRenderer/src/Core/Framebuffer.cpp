@@ -1,7 +1,12 @@
 #include "Core/Framebuffer.h"
 
+#include "Core/Parallel.h"
+
+#include <algorithm>
+#include <array>
 #include <cmath>
-#include <omp.h>
+#include <cstring>
+#include <immintrin.h>
 
 namespace SR {
 
@@ -14,6 +19,7 @@ void Framebuffer::Resize(int width, int height) {
     m_pixels.assign(static_cast<size_t>(width) * static_cast<size_t>(height), 0u);
     m_linearPixels.assign(static_cast<size_t>(width) * static_cast<size_t>(height), Vec3{0.0, 0.0, 0.0});
     m_fxaaTemp.assign(static_cast<size_t>(width) * static_cast<size_t>(height), Vec3{0.0, 0.0, 0.0});
+    m_luma.assign(static_cast<size_t>(width) * static_cast<size_t>(height), 0.0f);
 }
 
 /**
@@ -26,28 +32,18 @@ void Framebuffer::Clear(const Color& color) {
         | (static_cast<uint32_t>(color.a) << 24);
 
     const int n = static_cast<int>(m_pixels.size());
-#if defined(SR_INTEL_OMP)
-    #pragma omp parallel for schedule(guided, 4096)
-#else
-    #pragma omp parallel for schedule(dynamic, 4096)
-#endif
-    for (int i = 0; i < n; ++i) {
+    Parallel::For(0, n, 4096, Parallel::kBalanced, [&](int i) {
         m_pixels[static_cast<size_t>(i)] = packed;
-    }
+    });
 }
 
 /**
  * @brief 并行清除线性线性 HDR 缓冲
  */
 void Framebuffer::ClearLinear(const Vec3& color) {
-#if defined(SR_INTEL_OMP)
-    #pragma omp parallel for schedule(guided, 4096)
-#else
-    #pragma omp parallel for schedule(dynamic, 4096)
-#endif
-    for (int i = 0; i < static_cast<int>(m_linearPixels.size()); ++i) {
+    Parallel::For(0, static_cast<int>(m_linearPixels.size()), 4096, Parallel::kBalanced, [&](int i) {
         m_linearPixels[static_cast<size_t>(i)] = color;
-    }
+    });
 }
 
 /**
@@ -77,190 +73,429 @@ void Framebuffer::SetPixelLinear(int x, int y, const Vec3& color) {
     m_linearPixels[static_cast<size_t>(y) * static_cast<size_t>(m_width) + static_cast<size_t>(x)] = color;
 }
 
+namespace {
+
+static_assert(sizeof(Vec3) == 3 * sizeof(double), "Framebuffer post-process gathers assume packed Vec3");
+
+constexpr int kPostLanes = 8;    ///< 每组并行处理的像素数（AVX2 float）
+constexpr int kPostBandRows = 8; ///< 每个并行任务处理的行数
+constexpr int kPostStripBands = 4; ///< FXAA 任务图中每个节点覆盖的行带数（依赖按节点声明）
+
+// FXAA 参数（与原标量实现一致）
+constexpr float kFXAAReduceMin = 1.0f / 128.0f;
+constexpr float kFXAAReduceMul = 1.0f / 8.0f;
+constexpr float kFXAASpanMax = 8.0f;
+constexpr float kFXAAEdgeThresholdMin = 1.0f / 24.0f;
+constexpr float kFXAAEdgeThreshold = 1.0f / 12.0f;
+
 /**
- * @brief 执行 FXAA 抗锯齿算法实现 (快速近似抗锯齿)
+ * @brief 线性 [0,1] → sRGB 8 位查找表（1024 项，32 位存储以便 AVX2 gather）
+ *
+ * 函数内静态初始化保证多线程首次调用安全。
  */
-void Framebuffer::ApplyFXAA() {
-    if (m_linearPixels.empty()) {
-        return;
-    }
+const int32_t* LinearToSRGBTable() {
+    static const auto table = [] {
+        std::array<int32_t, 1024> t{};
+        for (int i = 0; i < 1024; ++i) {
+            double v = i / 1023.0;
+            double srgb = std::pow(v, 1.0 / 2.2);
+            t[static_cast<size_t>(i)] = static_cast<int32_t>(srgb * 255.0 + 0.5);
+        }
+        return t;
+    }();
+    return table.data();
+}
 
-    if (m_fxaaTemp.size() != m_linearPixels.size()) {
-        m_fxaaTemp.assign(m_linearPixels.size(), Vec3{0.0, 0.0, 0.0});
-    }
+/** @brief 8 个像素的 RGB（SoA，float） */
+struct RGB8 {
+    __m256 r, g, b;
+};
 
-    auto clampIndex = [this](int x, int y) {
-        x = (x < 0) ? 0 : (x >= m_width ? m_width - 1 : x);
-        y = (y < 0) ? 0 : (y >= m_height ? m_height - 1 : y);
-        return static_cast<size_t>(y) * static_cast<size_t>(m_width) + static_cast<size_t>(x);
-    };
+inline __m256 Luma(const RGB8& c) {
+    __m256 l = _mm256_mul_ps(c.r, _mm256_set1_ps(0.299f));
+    l = _mm256_fmadd_ps(c.g, _mm256_set1_ps(0.587f), l);
+    return _mm256_fmadd_ps(c.b, _mm256_set1_ps(0.114f), l);
+}
 
-    auto luma = [](const Vec3& c) {
-        return 0.299 * c.x + 0.587 * c.y + 0.114 * c.z;
+/** @brief 按像素下标收集 8 个 Vec3（double AoS）并转为 float SoA */
+inline RGB8 GatherRGB(const Vec3* src, __m256i index) {
+    const double* base = reinterpret_cast<const double*>(src);
+    const __m256i index3 = _mm256_mullo_epi32(index, _mm256_set1_epi32(3));
+    const __m128i lo = _mm256_castsi256_si128(index3);
+    const __m128i hi = _mm256_extracti128_si256(index3, 1);
+    // 全通道掩码的 mask 形式与普通 gather 等价，但显式给出源操作数，避免 GCC 误报 -Wmaybe-uninitialized
+    const __m256d all = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+    auto gather = [&](int channel) {
+        const __m128 l = _mm256_cvtpd_ps(_mm256_mask_i32gather_pd(_mm256_setzero_pd(), base + channel, lo, all, 8));
+        const __m128 h = _mm256_cvtpd_ps(_mm256_mask_i32gather_pd(_mm256_setzero_pd(), base + channel, hi, all, 8));
+        return _mm256_set_m128(h, l);
     };
+    return RGB8{gather(0), gather(1), gather(2)};
+}
 
-    const double reduceMin = 1.0 / 128.0;
-    const double reduceMul = 1.0 / 8.0;
-    const double spanMax = 8.0;
-    const double edgeThresholdMin = 1.0 / 24.0;
-    const double edgeThreshold = 1.0 / 12.0;
-
-#if defined(SR_INTEL_OMP)
-    #pragma omp parallel for schedule(guided, 1)
-#else
-    #pragma omp parallel for schedule(dynamic, 1)
-#endif
-    for (int y = 0; y < m_height; ++y) {
-        for (int x = 0; x < m_width; ++x) {
-            const Vec3& cM = m_linearPixels[clampIndex(x, y)];
-            const Vec3& cNW = m_linearPixels[clampIndex(x - 1, y - 1)];
-            const Vec3& cNE = m_linearPixels[clampIndex(x + 1, y - 1)];
-            const Vec3& cSW = m_linearPixels[clampIndex(x - 1, y + 1)];
-            const Vec3& cSE = m_linearPixels[clampIndex(x + 1, y + 1)];
-
-            double lumaM = luma(cM);
-            double lumaNW = luma(cNW);
-            double lumaNE = luma(cNE);
-            double lumaSW = luma(cSW);
-            double lumaSE = luma(cSE);
-
-            double lumaMin = std::min(lumaM, std::min(std::min(lumaNW, lumaNE), std::min(lumaSW, lumaSE)));
-            double lumaMax = std::max(lumaM, std::max(std::max(lumaNW, lumaNE), std::max(lumaSW, lumaSE)));
-
-            Vec3 result = cM;
-
-            double lumaRange = lumaMax - lumaMin;
-            if (lumaRange >= std::max(edgeThresholdMin, lumaMax * edgeThreshold)) {
-                double dirX = -((lumaNW + lumaNE) - (lumaSW + lumaSE));
-                double dirY =  ((lumaNW + lumaSW) - (lumaNE + lumaSE));
-
-                double dirReduce = std::max((lumaNW + lumaNE + lumaSW + lumaSE) * (0.25 * reduceMul), reduceMin);
-                double rcpDirMin = 1.0 / (std::min(std::abs(dirX), std::abs(dirY)) + dirReduce);
-
-                dirX = std::max(-spanMax, std::min(spanMax, dirX * rcpDirMin));
-                dirY = std::max(-spanMax, std::min(spanMax, dirY * rcpDirMin));
-
-                auto sample = [&](int ox, int oy) {
-                    return m_linearPixels[clampIndex(x + ox, y + oy)];
-                };
-
-                int ox1 = static_cast<int>(dirX * (1.0 / 3.0));
-                int oy1 = static_cast<int>(dirY * (1.0 / 3.0));
-                int ox2 = static_cast<int>(dirX * (2.0 / 3.0));
-                int oy2 = static_cast<int>(dirY * (2.0 / 3.0));
-
-                Vec3 rgbA = (sample(ox1, oy1) + sample(ox2, oy2)) * 0.5;
-
-                int ox3 = static_cast<int>(dirX * 1.0);
-                int oy3 = static_cast<int>(dirY * 1.0);
-                Vec3 rgbB = (rgbA * 0.5) + ((sample(0, 0) + sample(ox3, oy3)) * 0.25);
-
-                double lumaB = luma(rgbB);
-                result = (lumaB < lumaMin || lumaB > lumaMax) ? rgbA : rgbB;
+inline __m256 Blend(__m256 a, __m256 b, __m256 mask) {
+    return _mm256_blendv_ps(a, b, mask);
+}
+
+/**
+ * @brief ACES Filmic 色调映射（Krzysztof Narkowicz 拟合），结果钳制到 [0, 1]
+ */
+inline __m256 ACESToneMap8(__m256 x) {
+    x = _mm256_max_ps(x, _mm256_setzero_ps());
+    const __m256 num = _mm256_mul_ps(x, _mm256_fmadd_ps(x, _mm256_set1_ps(2.51f), _mm256_set1_ps(0.03f)));
+    const __m256 den = _mm256_fmadd_ps(x, _mm256_fmadd_ps(x, _mm256_set1_ps(2.43f), _mm256_set1_ps(0.59f)), _mm256_set1_ps(0.14f));
+    return _mm256_min_ps(_mm256_div_ps(num, den), _mm256_set1_ps(1.0f));
+}
+
+/** @brief [0,1] 线性值经查找表编码为 sRGB 8 位（int32 lanes） */
+inline __m256i EncodeSRGB8(__m256 v, const int32_t* lut) {
+    v = _mm256_min_ps(_mm256_max_ps(v, _mm256_setzero_ps()), _mm256_set1_ps(1.0f));
+    const __m256i index = _mm256_cvttps_epi32(_mm256_fmadd_ps(v, _mm256_set1_ps(1023.0f), _mm256_set1_ps(0.5f)));
+    return _mm256_i32gather_epi32(lut, index, 4);
+}
+
+/**
+ * @brief 融合后处理一次调用的只读参数
+ */
+struct PostProcessJob {
+    const Vec3* src = nullptr;    ///< 线性 HDR 输入
+    const float* luma = nullptr;  ///< 亮度平面（启用 FXAA 时有效）
+    int width = 0;
+    int height = 0;
+    bool fxaa = false;
+    float exposure = 1.0f;
+    bool dither = false;
+    uint32_t* dstSRGB = nullptr;  ///< 非空：色调映射 + sRGB 编码写 BGRA8
+    Vec3* dstLinear = nullptr;    ///< 非空：只写 FXAA 结果到线性缓冲（HDR 模式）
+    const int32_t* srgbLUT = nullptr;
+};
+
+/**
+ * @brief 处理一行中从 x 开始的 count（1..8）个像素
+ *
+ * kInterior 为 true 时调用方保证 1 <= y < height - 1 且 [x - 1, x + 8] 在行内，
+ * 邻域亮度直接非对齐加载；否则按钳制坐标逐 lane 读取，只写回前 count 个像素。
+ * FXAA 的沿边采样偏移最多 ±kFXAASpanMax，始终钳制坐标。
+ */
+template <bool kInterior>
+void PostProcessGroup(const PostProcessJob& job, int x, int y, int count) {
+    const int w = job.width;
+    const int h = job.height;
+    const __m256i laneOffsets = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i maxX = _mm256_set1_epi32(w - 1);
+    const __m256i maxY = _mm256_set1_epi32(h - 1);
+    const __m256i zero = _mm256_setzero_si256();
+
+    __m256i px = _mm256_add_epi32(_mm256_set1_epi32(x), laneOffsets);
+    if constexpr (!kInterior) {
+        px = _mm256_min_epi32(px, maxX);
+    }
+    const __m256i rowBase = _mm256_set1_epi32(y * w);
+    const RGB8 center = GatherRGB(job.src, _mm256_add_epi32(rowBase, px));
+    RGB8 result = center;
+    __m256 edge = _mm256_setzero_ps();
+
+    if (job.fxaa) {
+        __m256 lumaM, lumaNW, lumaNE, lumaSW, lumaSE;
+        if constexpr (kInterior) {
+            const float* row = job.luma + static_cast<size_t>(y) * static_cast<size_t>(w) + static_cast<size_t>(x);
+            const float* up = row - w;
+            const float* down = row + w;
+            lumaM = _mm256_loadu_ps(row);
+            lumaNW = _mm256_loadu_ps(up - 1);
+            lumaNE = _mm256_loadu_ps(up + 1);
+            lumaSW = _mm256_loadu_ps(down - 1);
+            lumaSE = _mm256_loadu_ps(down + 1);
+        } else {
+            alignas(32) float m[kPostLanes], nw[kPostLanes], ne[kPostLanes], sw[kPostLanes], se[kPostLanes];
+            const int yUp = std::max(y - 1, 0);
+            const int yDown = std::min(y + 1, h - 1);
+            for (int lane = 0; lane < kPostLanes; ++lane) {
+                const int cx = std::min(x + lane, w - 1);
+                const int left = std::max(cx - 1, 0);
+                const int right = std::min(cx + 1, w - 1);
+                m[lane] = job.luma[static_cast<size_t>(y) * w + cx];
+                nw[lane] = job.luma[static_cast<size_t>(yUp) * w + left];
+                ne[lane] = job.luma[static_cast<size_t>(yUp) * w + right];
+                sw[lane] = job.luma[static_cast<size_t>(yDown) * w + left];
+                se[lane] = job.luma[static_cast<size_t>(yDown) * w + right];
             }
+            lumaM = _mm256_load_ps(m);
+            lumaNW = _mm256_load_ps(nw);
+            lumaNE = _mm256_load_ps(ne);
+            lumaSW = _mm256_load_ps(sw);
+            lumaSE = _mm256_load_ps(se);
+        }
 
-            m_fxaaTemp[static_cast<size_t>(y) * static_cast<size_t>(m_width) + static_cast<size_t>(x)] = result;
+        const __m256 lumaMin = _mm256_min_ps(lumaM, _mm256_min_ps(_mm256_min_ps(lumaNW, lumaNE), _mm256_min_ps(lumaSW, lumaSE)));
+        const __m256 lumaMax = _mm256_max_ps(lumaM, _mm256_max_ps(_mm256_max_ps(lumaNW, lumaNE), _mm256_max_ps(lumaSW, lumaSE)));
+        const __m256 threshold = _mm256_max_ps(_mm256_set1_ps(kFXAAEdgeThresholdMin),
+                                               _mm256_mul_ps(lumaMax, _mm256_set1_ps(kFXAAEdgeThreshold)));
+        edge = _mm256_cmp_ps(_mm256_sub_ps(lumaMax, lumaMin), threshold, _CMP_GE_OQ);
+
+        // 整组都不在边缘上时跳过沿边搜索
+        if (_mm256_movemask_ps(edge) != 0) {
+            const __m256 north = _mm256_add_ps(lumaNW, lumaNE);
+            const __m256 south = _mm256_add_ps(lumaSW, lumaSE);
+            __m256 dirX = _mm256_sub_ps(south, north);
+            __m256 dirY = _mm256_sub_ps(_mm256_add_ps(lumaNW, lumaSW), _mm256_add_ps(lumaNE, lumaSE));
+
+            const __m256 dirReduce = _mm256_max_ps(_mm256_mul_ps(_mm256_add_ps(north, south), _mm256_set1_ps(0.25f * kFXAAReduceMul)),
+                                                   _mm256_set1_ps(kFXAAReduceMin));
+            const __m256 absMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+            const __m256 rcpDirMin = _mm256_div_ps(_mm256_set1_ps(1.0f),
+                _mm256_add_ps(_mm256_min_ps(_mm256_and_ps(dirX, absMask), _mm256_and_ps(dirY, absMask)), dirReduce));
+            const __m256 spanMax = _mm256_set1_ps(kFXAASpanMax);
+            const __m256 spanMin = _mm256_set1_ps(-kFXAASpanMax);
+            dirX = _mm256_max_ps(spanMin, _mm256_min_ps(spanMax, _mm256_mul_ps(dirX, rcpDirMin)));
+            dirY = _mm256_max_ps(spanMin, _mm256_min_ps(spanMax, _mm256_mul_ps(dirY, rcpDirMin)));
+
+            const __m256i py = _mm256_set1_epi32(y);
+            auto sampleAt = [&](float t) {
+                const __m256i ox = _mm256_cvttps_epi32(_mm256_mul_ps(dirX, _mm256_set1_ps(t)));
+                const __m256i oy = _mm256_cvttps_epi32(_mm256_mul_ps(dirY, _mm256_set1_ps(t)));
+                const __m256i sx = _mm256_max_epi32(zero, _mm256_min_epi32(maxX, _mm256_add_epi32(px, ox)));
+                const __m256i sy = _mm256_max_epi32(zero, _mm256_min_epi32(maxY, _mm256_add_epi32(py, oy)));
+                return GatherRGB(job.src, _mm256_add_epi32(_mm256_mullo_epi32(sy, _mm256_set1_epi32(w)), sx));
+            };
+            const RGB8 s1 = sampleAt(1.0f / 3.0f);
+            const RGB8 s2 = sampleAt(2.0f / 3.0f);
+            const RGB8 s3 = sampleAt(1.0f);
+
+            const __m256 half = _mm256_set1_ps(0.5f);
+            const __m256 quarter = _mm256_set1_ps(0.25f);
+            const RGB8 rgbA{_mm256_mul_ps(_mm256_add_ps(s1.r, s2.r), half),
+                            _mm256_mul_ps(_mm256_add_ps(s1.g, s2.g), half),
+                            _mm256_mul_ps(_mm256_add_ps(s1.b, s2.b), half)};
+            const RGB8 rgbB{_mm256_fmadd_ps(rgbA.r, half, _mm256_mul_ps(_mm256_add_ps(center.r, s3.r), quarter)),
+                            _mm256_fmadd_ps(rgbA.g, half, _mm256_mul_ps(_mm256_add_ps(center.g, s3.g), quarter)),
+                            _mm256_fmadd_ps(rgbA.b, half, _mm256_mul_ps(_mm256_add_ps(center.b, s3.b), quarter))};
+
+            const __m256 lumaB = Luma(rgbB);
+            const __m256 outside = _mm256_or_ps(_mm256_cmp_ps(lumaB, lumaMin, _CMP_LT_OQ),
+                                                _mm256_cmp_ps(lumaB, lumaMax, _CMP_GT_OQ));
+            result.r = Blend(center.r, Blend(rgbB.r, rgbA.r, outside), edge);
+            result.g = Blend(center.g, Blend(rgbB.g, rgbA.g, outside), edge);
+            result.b = Blend(center.b, Blend(rgbB.b, rgbA.b, outside), edge);
         }
     }
 
-    m_linearPixels.swap(m_fxaaTemp);
+    const size_t outBase = static_cast<size_t>(y) * static_cast<size_t>(w) + static_cast<size_t>(x);
+    if (job.dstLinear) {
+        // HDR 模式：非边缘像素保持原 double 精度，只覆盖边缘像素
+        alignas(32) float r[kPostLanes], g[kPostLanes], b[kPostLanes];
+        _mm256_store_ps(r, result.r);
+        _mm256_store_ps(g, result.g);
+        _mm256_store_ps(b, result.b);
+        const int edgeBits = _mm256_movemask_ps(edge);
+        for (int lane = 0; lane < count; ++lane) {
+            job.dstLinear[outBase + lane] = (edgeBits & (1 << lane))
+                ? Vec3{r[lane], g[lane], b[lane]}
+                : job.src[outBase + lane];
+        }
+        return;
+    }
+
+    // 先乘曝光系数，再应用 ACES 色调映射（保持各通道色彩比例）
+    const __m256 exposure = _mm256_set1_ps(job.exposure);
+    __m256 r = ACESToneMap8(_mm256_mul_ps(result.r, exposure));
+    __m256 g = ACESToneMap8(_mm256_mul_ps(result.g, exposure));
+    __m256 b = ACESToneMap8(_mm256_mul_ps(result.b, exposure));
+    if (job.dither) {
+        // 2×2 Bayer 偏移：x 为偶数起始，lane 奇偶即像素奇偶
+        const float t0 = (y & 1) ? 0.125f / 255.0f : -0.375f / 255.0f;
+        const float t1 = (y & 1) ? 0.375f / 255.0f : -0.125f / 255.0f;
+        const float t0x = (x & 1) ? t1 : t0;
+        const float t1x = (x & 1) ? t0 : t1;
+        const __m256 t = _mm256_setr_ps(t0x, t1x, t0x, t1x, t0x, t1x, t0x, t1x);
+        r = _mm256_add_ps(r, t);
+        g = _mm256_add_ps(g, t);
+        b = _mm256_add_ps(b, t);
+    }
+
+    __m256i packed = EncodeSRGB8(b, job.srgbLUT);
+    packed = _mm256_or_si256(packed, _mm256_slli_epi32(EncodeSRGB8(g, job.srgbLUT), 8));
+    packed = _mm256_or_si256(packed, _mm256_slli_epi32(EncodeSRGB8(r, job.srgbLUT), 16));
+    packed = _mm256_or_si256(packed, _mm256_set1_epi32(static_cast<int>(0xFF000000u)));
+    if (count == kPostLanes) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(job.dstSRGB + outBase), packed);
+    } else {
+        alignas(32) uint32_t out[kPostLanes];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(out), packed);
+        std::memcpy(job.dstSRGB + outBase, out, static_cast<size_t>(count) * sizeof(uint32_t));
+    }
 }
 
-// 预计算的线性到 sRGB 查找表（1024 个条目，高精度）
-static uint8_t kLinearToSRGBLUT[1024];
-static bool kLinearToSRGBTableInitialized = false;
+/**
+ * @brief 对 [firstBand, lastBand) 行带执行融合后处理
+ *
+ * 首末行与每行的首列、行尾不足 8 个的剩余像素走钳制坐标的边界路径，
+ * 其余 8 像素组走无钳制加载的内部路径。
+ */
+void PostProcessBands(const PostProcessJob& job, int firstBand, int lastBand) {
+    const int w = job.width;
+    const int h = job.height;
+    const int yEnd = std::min(h, lastBand * kPostBandRows);
+    for (int y = firstBand * kPostBandRows; y < yEnd; ++y) {
+        if (y == 0 || y == h - 1) {
+            for (int x = 0; x < w; x += kPostLanes) {
+                PostProcessGroup<false>(job, x, y, std::min(kPostLanes, w - x));
+            }
+            continue;
+        }
+        // 内部组需要 [x - 1, x + 8] 在行内
+        PostProcessGroup<false>(job, 0, y, 1);
+        int x = 1;
+        for (; x + kPostLanes < w; x += kPostLanes) {
+            PostProcessGroup<true>(job, x, y, kPostLanes);
+        }
+        for (; x < w; x += kPostLanes) {
+            PostProcessGroup<false>(job, x, y, std::min(kPostLanes, w - x));
+        }
+    }
+}
 
 /**
- * @brief 初始化线性到 sRGB 的查找表 (LUT)
+ * @brief 计算 [firstBand, lastBand) 行带的 FXAA 亮度（每像素一次，8 像素一组）
  */
-static void InitLinearToSRGBTable() {
-    if (kLinearToSRGBTableInitialized) return;
-    for (int i = 0; i < 1024; ++i) {
-        double v = i / 1023.0;
-        double srgb = std::pow(v, 1.0 / 2.2);
-        kLinearToSRGBLUT[i] = static_cast<uint8_t>(srgb * 255.0 + 0.5);
+void BuildLumaBands(const PostProcessJob& job, float* luma, int firstBand, int lastBand) {
+    const int w = job.width;
+    const Vec3* src = job.src;
+    const __m256i laneOffsets = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const int yEnd = std::min(job.height, lastBand * kPostBandRows);
+    for (int y = firstBand * kPostBandRows; y < yEnd; ++y) {
+        const size_t rowBase = static_cast<size_t>(y) * static_cast<size_t>(w);
+        int x = 0;
+        for (; x + kPostLanes <= w; x += kPostLanes) {
+            const __m256i index = _mm256_add_epi32(_mm256_set1_epi32(static_cast<int>(rowBase) + x), laneOffsets);
+            _mm256_storeu_ps(luma + rowBase + x, Luma(GatherRGB(src, index)));
+        }
+        for (; x < w; ++x) {
+            const Vec3& c = src[rowBase + x];
+            luma[rowBase + x] = 0.299f * static_cast<float>(c.x) + 0.587f * static_cast<float>(c.y) + 0.114f * static_cast<float>(c.z);
+        }
     }
-    kLinearToSRGBTableInitialized = true;
 }
 
 /**
- * @brief 快速线性到 sRGB 转换
+ * @brief 执行融合后处理；启用 FXAA 时先构建亮度平面
+ *
+ * FXAA 只读取相邻一行的亮度，因此按行带条组成任务图：第 s 条的后处理只依赖第 s-1..s+1 条的亮度，
+ * 亮度与后处理可以交错进行，不需要整帧屏障（OpenMP 后端按层执行，等价于两个并行循环）。
  */
-inline uint8_t LinearToSRGBFast(double v) {
-    if (v <= 0.0) return 0;
-    if (v >= 1.0) return 255;
-    int idx = static_cast<int>(v * 1023.0 + 0.5);
-    return kLinearToSRGBLUT[idx];
+void RunPostProcess(const PostProcessJob& job, float* luma) {
+    const int bandCount = (job.height + kPostBandRows - 1) / kPostBandRows;
+    auto post = [&job](int firstBand, int lastBand) {
+        PostProcessBands(job, firstBand, lastBand);
+    };
+    if (!job.fxaa) {
+        Parallel::ForRange(0, bandCount, 1, post);
+        return;
+    }
+
+    auto lumaBands = [&job, luma](int firstBand, int lastBand) {
+        BuildLumaBands(job, luma, firstBand, lastBand);
+    };
+    const int stripCount = (bandCount + kPostStripBands - 1) / kPostStripBands;
+    JobGraph graph;
+    for (int s = 0; s < stripCount; ++s) {
+        const int first = s * kPostStripBands;
+        Parallel::AddRange(graph, first, std::min(bandCount, first + kPostStripBands), 1, lumaBands);
+    }
+    for (int s = 0; s < stripCount; ++s) {
+        const int first = s * kPostStripBands;
+        const int node = Parallel::AddRange(graph, first, std::min(bandCount, first + kPostStripBands), 1, post);
+        for (int dependency = std::max(0, s - 1); dependency <= std::min(stripCount - 1, s + 1); ++dependency) {
+            graph.Precede(dependency, node);
+        }
+    }
+    Parallel::Run(graph);
 }
 
+} // namespace
+
 /**
- * @brief ACES Filmic 色调映射
+ * @brief 执行 FXAA 抗锯齿算法实现 (快速近似抗锯齿)，结果写回线性缓冲
  *
- * 将 HDR 线性值 [0, ∞) 映射到 [0, 1)。
- * 保持色彩比例，避免逐通道裁剪导致的色移。
- * 参考：Stephen Hill, ACES Filmic Tone Mapping Curve (Krzysztof Narkowicz fit)
+ * 仅在不做色调映射（HDR 输出）时单独使用；SDR 路径由 ResolveToSRGB 融合完成。
  */
-inline double ACESToneMap(double x) {
-    if (x <= 0.0) return 0.0;
-    constexpr double a = 2.51;
-    constexpr double b = 0.03;
-    constexpr double c = 2.43;
-    constexpr double d = 0.59;
-    constexpr double e = 0.14;
-    double mapped = (x * (a * x + b)) / (x * (c * x + d) + e);
-    return (mapped < 0.0) ? 0.0 : ((mapped > 1.0) ? 1.0 : mapped);
+void Framebuffer::ApplyFXAA() {
+    if (m_linearPixels.empty()) {
+        return;
+    }
+
+    if (m_fxaaTemp.size() != m_linearPixels.size()) {
+        m_fxaaTemp.assign(m_linearPixels.size(), Vec3{0.0, 0.0, 0.0});
+    }
+    if (m_luma.size() != m_linearPixels.size()) {
+        m_luma.assign(m_linearPixels.size(), 0.0f);
+    }
+
+    PostProcessJob job;
+    job.src = m_linearPixels.data();
+    job.luma = m_luma.data();
+    job.width = m_width;
+    job.height = m_height;
+    job.fxaa = true;
+    job.dstLinear = m_fxaaTemp.data();
+    RunPostProcess(job, m_luma.data());
+
+    m_linearPixels.swap(m_fxaaTemp);
 }
 
 /**
- * @brief 执行色调映射和 sRGB 空间转换并存入对应像素缓冲区
+ * @brief 执行 (可选 FXAA +) 色调映射和 sRGB 空间转换并存入对应像素缓冲区
+ *
+ * 单趟融合内核：FXAA 沿边搜索、ACES 与查找表 sRGB 编码都以 8 像素为一组向量化，
+ * 直接写 BGRA8；线性缓冲保持不变。
  */
-void Framebuffer::ResolveToSRGB(double exposure, bool dither) {
+void Framebuffer::ResolveToSRGB(double exposure, bool dither, bool fxaa) {
     if (m_linearPixels.empty() || m_pixels.empty()) {
         return;
     }
 
-    InitLinearToSRGBTable();
-
-    const int totalPixels = m_width * m_height;
-    const Vec3* srcPixels = m_linearPixels.data();
-    uint32_t* dstPixels = m_pixels.data();
-
-    // 预计算抖动模式（Bayer 矩阵偏移，减少量化带状噪声）
-    static const double kDitherPattern[4] = {-0.375 / 255.0, -0.125 / 255.0, 0.125 / 255.0, 0.375 / 255.0};
-
-#if defined(SR_INTEL_OMP)
-    #pragma omp parallel for schedule(guided, 1)
-#else
-    #pragma omp parallel for schedule(dynamic, 1)
-#endif
-    for (int y = 0; y < m_height; ++y) {
-        const int rowBase = y * m_width;
-        const int yPattern = (y & 1) << 1;
-        
-        for (int x = 0; x < m_width; ++x) {
-            const int idx = rowBase + x;
-            const Vec3& c = srcPixels[idx];
-            
-            // 先乘曝光系数，再应用 ACES 色调映射（保持各通道色彩比例）
-            double r = ACESToneMap(c.x * exposure);
-            double g = ACESToneMap(c.y * exposure);
-            double b = ACESToneMap(c.z * exposure);
-
-            if (dither) {
-                const double t = kDitherPattern[yPattern | (x & 1)];
-                r += t;
-                g += t;
-                b += t;
-            }
+    if (fxaa && m_luma.size() != m_linearPixels.size()) {
+        m_luma.assign(m_linearPixels.size(), 0.0f);
+    }
+
+    PostProcessJob job;
+    job.src = m_linearPixels.data();
+    job.luma = fxaa ? m_luma.data() : nullptr;
+    job.width = m_width;
+    job.height = m_height;
+    job.fxaa = fxaa;
+    job.exposure = static_cast<float>(exposure);
+    job.dither = dither;
+    job.dstSRGB = m_pixels.data();
+    job.srgbLUT = LinearToSRGBTable();
+    RunPostProcess(job, m_luma.data());
+}
+
+/**
+ * @brief 对像素矩形做色调映射与 sRGB 输出（无 FXAA，不需要邻域，单线程）
+ */
+void Framebuffer::ResolveRectToSRGB(int minX, int minY, int maxX, int maxY, double exposure) {
+    if (m_linearPixels.empty() || m_pixels.empty()) {
+        return;
+    }
+    minX = std::max(minX, 0);
+    minY = std::max(minY, 0);
+    maxX = std::min(maxX, m_width - 1);
+    maxY = std::min(maxY, m_height - 1);
+    if (minX > maxX || minY > maxY) {
+        return;
+    }
 
-            uint8_t rb = LinearToSRGBFast(b);
-            uint8_t rg = LinearToSRGBFast(g);
-            uint8_t rr = LinearToSRGBFast(r);
-            
-            dstPixels[idx] = static_cast<uint32_t>(rb)
-                | (static_cast<uint32_t>(rg) << 8)
-                | (static_cast<uint32_t>(rr) << 16)
-                | 0xFF000000u;
+    PostProcessJob job;
+    job.src = m_linearPixels.data();
+    job.width = m_width;
+    job.height = m_height;
+    job.exposure = static_cast<float>(exposure);
+    job.dstSRGB = m_pixels.data();
+    job.srgbLUT = LinearToSRGBTable();
+    for (int y = minY; y <= maxY; ++y) {
+        for (int x = minX; x <= maxX; x += kPostLanes) {
+            PostProcessGroup<false>(job, x, y, std::min(kPostLanes, maxX + 1 - x));
         }
     }
 }
@@ -0,0 +1,490 @@
+#include "Core/JobSystem.h"
+
+#include <algorithm>
+#include <immintrin.h>
+
+namespace SR {
+
+namespace {
+
+constexpr int64_t kQueueCapacity = 4096; ///< 每线程双端队列容量（2 的幂）
+constexpr uint32_t kJobPoolSize = 4096;  ///< 每线程任务对象池容量（2 的幂）
+constexpr int kSpinRounds = 64;          ///< 空闲工作线程休眠前的自旋轮数
+constexpr int kPausesPerRound = 32;      ///< 每轮自旋的 pause 次数
+constexpr int kWaitSpinsBeforeYield = 256;
+
+thread_local JobSystem* t_system = nullptr;  ///< 当前线程所在的线程池
+thread_local int t_threadIndex = 0;          ///< 在 t_system 内的槽位下标
+
+inline void CpuPause() {
+    _mm_pause();
+}
+
+} // namespace
+
+// ============================================================================
+// 内部结构
+// ============================================================================
+
+/// 队列中的叶任务：某个批次的一段区间（执行开始时即归还任务池）
+struct JobSystem::Job {
+    Batch* batch = nullptr;
+    int begin = 0;
+    int end = 0;
+    std::atomic<bool> free{true};
+};
+
+/// 一次 ParallelFor 或一个图节点：共享完成计数的一组叶任务
+struct JobSystem::Batch {
+    JobRangeFn body = nullptr;
+    void* context = nullptr;
+    int begin = 0;
+    int end = 0;
+    int grain = 1;
+    std::atomic<int> remaining{0}; ///< 已创建但未完成的叶任务数
+    GraphState* graph = nullptr;   ///< 所属任务图（ParallelFor 为空）
+    int node = -1;
+};
+
+/// 一次 Run 的运行状态
+struct JobSystem::GraphState {
+    const JobGraph* graph = nullptr;
+    std::unique_ptr<Batch[]> batches;
+    std::unique_ptr<std::atomic<int>[]> pending; ///< 各节点未完成的前驱数
+    std::atomic<int> remainingNodes{0};
+};
+
+/**
+ * @brief 每线程状态：Chase-Lev 双端队列（本线程在底部压入 / 弹出，其他线程从顶部窃取）+ 任务池
+ *
+ * 队列使用固定容量环形缓冲，满时由调用方就地执行任务（不扩容）。
+ */
+struct alignas(64) JobSystem::Worker {
+    alignas(64) std::atomic<int64_t> top{0};
+    alignas(64) std::atomic<int64_t> bottom{0};
+    std::unique_ptr<std::atomic<Job*>[]> ring;
+    std::unique_ptr<Job[]> jobs;
+    uint32_t nextJob = 0;
+    uint32_t stealSeed = 0;
+
+    Worker() : ring(new std::atomic<Job*>[kQueueCapacity]), jobs(new Job[kJobPoolSize]) {
+        for (int64_t i = 0; i < kQueueCapacity; ++i) {
+            ring[i].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    bool PushBottom(Job* job) {
+        const int64_t b = bottom.load(std::memory_order_relaxed);
+        const int64_t t = top.load(std::memory_order_acquire);
+        if (b - t >= kQueueCapacity) {
+            return false;
+        }
+        ring[b & (kQueueCapacity - 1)].store(job, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom.store(b + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    Job* PopBottom() {
+        const int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+        bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t t = top.load(std::memory_order_relaxed);
+        if (t > b) {
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        Job* job = ring[b & (kQueueCapacity - 1)].load(std::memory_order_relaxed);
+        if (t == b) {
+            // 最后一个元素：与窃取方竞争
+            if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                job = nullptr;
+            }
+            bottom.store(b + 1, std::memory_order_relaxed);
+        }
+        return job;
+    }
+
+    Job* Steal() {
+        int64_t t = top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const int64_t b = bottom.load(std::memory_order_acquire);
+        if (t >= b) {
+            return nullptr;
+        }
+        Job* job = ring[t & (kQueueCapacity - 1)].load(std::memory_order_relaxed);
+        if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return nullptr;
+        }
+        return job;
+    }
+};
+
+/**
+ * @brief 外部线程按到达顺序占用一个提交槽位（本线程池的工作线程与已占用槽位的线程直接通过）
+ *
+ * 释放时恢复之前的线程池归属，因此一个线程池的任务体内也可以向另一个线程池提交。
+ */
+class JobSystem::CallerSlot {
+public:
+    explicit CallerSlot(JobSystem& system) : m_system(system) {
+        if (t_system == &system) {
+            return;
+        }
+        m_previousSystem = t_system;
+        m_previousIndex = t_threadIndex;
+        std::unique_lock<std::mutex> lock(system.m_callerMutex);
+        const uint64_t ticket = system.m_nextTicket++;
+        system.m_callerReleased.wait(lock, [&] {
+            return ticket == system.m_servingTicket && !system.m_freeCallerSlots.empty();
+        });
+        ++system.m_servingTicket;
+        m_slot = system.m_freeCallerSlots.back();
+        system.m_freeCallerSlots.pop_back();
+        lock.unlock();
+        // 下一个排队者可能也有空闲槽位可用
+        system.m_callerReleased.notify_all();
+        t_system = &system;
+        t_threadIndex = m_slot;
+    }
+    ~CallerSlot() {
+        if (m_slot < 0) {
+            return;
+        }
+        t_system = m_previousSystem;
+        t_threadIndex = m_previousIndex;
+        {
+            std::lock_guard<std::mutex> lock(m_system.m_callerMutex);
+            m_system.m_freeCallerSlots.push_back(m_slot);
+        }
+        m_system.m_callerReleased.notify_all();
+    }
+    CallerSlot(const CallerSlot&) = delete;
+    CallerSlot& operator=(const CallerSlot&) = delete;
+
+private:
+    JobSystem& m_system;
+    JobSystem* m_previousSystem = nullptr;
+    int m_previousIndex = 0;
+    int m_slot = -1;
+};
+
+// ============================================================================
+// JobGraph
+// ============================================================================
+
+int JobGraph::Add(JobRangeFn body, void* context, int begin, int end, int grain) {
+    Node node;
+    node.body = body;
+    node.context = context;
+    node.begin = begin;
+    node.end = std::max(begin, end);
+    node.grain = std::max(1, grain);
+    m_nodes.push_back(std::move(node));
+    return static_cast<int>(m_nodes.size()) - 1;
+}
+
+void JobGraph::Precede(int before, int after) {
+    m_nodes[static_cast<size_t>(before)].successors.push_back(after);
+    ++m_nodes[static_cast<size_t>(after)].dependencies;
+}
+
+// ============================================================================
+// JobSystem
+// ============================================================================
+
+JobSystem::JobSystem(int threadCount, int callerSlots) {
+    if (threadCount <= 0) {
+        threadCount = static_cast<int>(std::thread::hardware_concurrency());
+    }
+    m_threadCount = std::max(1, threadCount);
+    callerSlots = std::max(1, callerSlots);
+    const int slotCount = m_threadCount + callerSlots - 1;
+    m_workers.reserve(static_cast<size_t>(slotCount));
+    for (int i = 0; i < slotCount; ++i) {
+        m_workers.push_back(std::make_unique<Worker>());
+        m_workers.back()->stealSeed = 0x9E3779B9u * static_cast<uint32_t>(i + 1);
+    }
+    // 优先分配 0 号槽位（单个提交方时与工作线程下标连续）
+    for (int i = slotCount - 1; i >= m_threadCount; --i) {
+        m_freeCallerSlots.push_back(i);
+    }
+    m_freeCallerSlots.push_back(0);
+    m_threads.reserve(static_cast<size_t>(m_threadCount - 1));
+    for (int i = 1; i < m_threadCount; ++i) {
+        m_threads.emplace_back([this, i] { WorkerLoop(i); });
+    }
+}
+
+JobSystem::~JobSystem() {
+    m_running.store(false, std::memory_order_seq_cst);
+    m_epoch.fetch_add(1, std::memory_order_seq_cst);
+    m_epoch.notify_all();
+    for (std::thread& thread : m_threads) {
+        thread.join();
+    }
+}
+
+JobSystem* JobSystem::Current() {
+    return t_system;
+}
+
+int JobSystem::CurrentThreadIndex() {
+    return t_system ? t_threadIndex : 0;
+}
+
+void JobSystem::ParallelFor(int begin, int end, int grain, JobRangeFn body, void* context) {
+    if (end <= begin) {
+        return;
+    }
+    grain = std::max(1, grain);
+    // 就地执行时任务体同样按槽位下标访问每线程数据，因此先占用槽位
+    CallerSlot slot(*this);
+    if (m_threadCount == 1 || end - begin <= grain) {
+        body(context, begin, end);
+        return;
+    }
+
+    const int thread = t_threadIndex;
+    Batch batch;
+    batch.body = body;
+    batch.context = context;
+    batch.begin = begin;
+    batch.end = end;
+    batch.grain = grain;
+    batch.remaining.store(1, std::memory_order_relaxed);
+
+    // 根区间由提交线程直接拆分执行，右半部分在拆分过程中陆续被窃取
+    Job root;
+    root.batch = &batch;
+    root.begin = begin;
+    root.end = end;
+    root.free.store(false, std::memory_order_relaxed);
+    Execute(&root, thread);
+    WaitUntil(batch.remaining, thread);
+}
+
+void JobSystem::Run(const JobGraph& graph) {
+    const std::vector<JobGraph::Node>& nodes = graph.GetNodes();
+    if (nodes.empty()) {
+        return;
+    }
+
+    CallerSlot slot(*this);
+    const int thread = t_threadIndex;
+    const size_t count = nodes.size();
+    GraphState state;
+    state.graph = &graph;
+    state.batches.reset(new Batch[count]);
+    state.pending.reset(new std::atomic<int>[count]);
+    state.remainingNodes.store(static_cast<int>(count), std::memory_order_relaxed);
+    for (size_t i = 0; i < count; ++i) {
+        const JobGraph::Node& node = nodes[i];
+        Batch& batch = state.batches[i];
+        batch.body = node.body;
+        batch.context = node.context;
+        batch.begin = node.begin;
+        batch.end = node.end;
+        batch.grain = node.grain;
+        batch.graph = &state;
+        batch.node = static_cast<int>(i);
+        state.pending[i].store(node.dependencies, std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+
+    for (size_t i = 0; i < count; ++i) {
+        if (nodes[i].dependencies == 0) {
+            Launch(state.batches[i], thread);
+        }
+    }
+    WaitUntil(state.remainingNodes, thread);
+}
+
+/**
+ * @brief 工作线程主循环：本地弹出 → 窃取 → 自旋 → 休眠
+ *
+ * 休眠前先登记 m_sleepers 再检查一次队列，提交方入队后递增 m_epoch 并在有休眠线程时唤醒，
+ * 因此不会丢失唤醒。
+ */
+void JobSystem::WorkerLoop(int index) {
+    t_system = this;
+    t_threadIndex = index;
+    int idleRounds = 0;
+    while (true) {
+        if (Job* job = FindJob(index)) {
+            Execute(job, index);
+            idleRounds = 0;
+            continue;
+        }
+        if (!m_running.load(std::memory_order_acquire)) {
+            break;
+        }
+        if (++idleRounds < kSpinRounds) {
+            for (int i = 0; i < kPausesPerRound; ++i) {
+                CpuPause();
+            }
+            continue;
+        }
+
+        const uint32_t epoch = m_epoch.load(std::memory_order_seq_cst);
+        m_sleepers.fetch_add(1, std::memory_order_seq_cst);
+        if (Job* job = FindJob(index)) {
+            m_sleepers.fetch_sub(1, std::memory_order_seq_cst);
+            Execute(job, index);
+            idleRounds = 0;
+            continue;
+        }
+        if (m_running.load(std::memory_order_seq_cst)) {
+            m_epoch.wait(epoch, std::memory_order_seq_cst);
+        }
+        m_sleepers.fetch_sub(1, std::memory_order_seq_cst);
+        idleRounds = 0;
+    }
+}
+
+/// 节点的全部前驱已完成：把整个区间作为一个任务入队（空区间直接完成）
+void JobSystem::Launch(Batch& batch, int thread) {
+    batch.remaining.store(1, std::memory_order_relaxed);
+    if (batch.begin < batch.end) {
+        if (Job* job = AllocateJob(thread)) {
+            job->batch = &batch;
+            job->begin = batch.begin;
+            job->end = batch.end;
+            if (Push(thread, job)) {
+                Notify();
+                return;
+            }
+            job->free.store(true, std::memory_order_release);
+        }
+        // 队列或任务池已满：就地执行
+        Job local;
+        local.batch = &batch;
+        local.begin = batch.begin;
+        local.end = batch.end;
+        local.free.store(false, std::memory_order_relaxed);
+        Execute(&local, thread);
+        return;
+    }
+    FinishLeaf(batch, thread);
+}
+
+/**
+ * @brief 执行一个叶任务：区间超过 grain 时二分，右半入队，左半继续拆分，最后执行剩余区间
+ */
+void JobSystem::Execute(Job* job, int thread) {
+    Batch& batch = *job->batch;
+    const int begin = job->begin;
+    int end = job->end;
+    job->free.store(true, std::memory_order_release);
+
+    bool pushed = false;
+    while (end - begin > batch.grain) {
+        Job* child = AllocateJob(thread);
+        if (!child) {
+            break;
+        }
+        const int mid = begin + (end - begin) / 2;
+        child->batch = &batch;
+        child->begin = mid;
+        child->end = end;
+        batch.remaining.fetch_add(1, std::memory_order_relaxed);
+        if (!Push(thread, child)) {
+            child->free.store(true, std::memory_order_release);
+            batch.remaining.fetch_sub(1, std::memory_order_relaxed);
+            break;
+        }
+        pushed = true;
+        end = mid;
+    }
+    if (pushed) {
+        Notify();
+    }
+
+    batch.body(batch.context, begin, end);
+    FinishLeaf(batch, thread);
+}
+
+/// 叶任务完成：批次计数归零时释放后继节点（减计数之后不再访问 ParallelFor 的栈上批次）
+void JobSystem::FinishLeaf(Batch& batch, int thread) {
+    GraphState* graph = batch.graph;
+    const int node = batch.node;
+    if (batch.remaining.fetch_sub(1, std::memory_order_acq_rel) != 1 || !graph) {
+        return;
+    }
+    for (int successor : graph->graph->GetNodes()[static_cast<size_t>(node)].successors) {
+        if (graph->pending[successor].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            Launch(graph->batches[successor], thread);
+        }
+    }
+    graph->remainingNodes.fetch_sub(1, std::memory_order_release);
+}
+
+JobSystem::Job* JobSystem::FindJob(int thread) {
+    Worker& self = *m_workers[static_cast<size_t>(thread)];
+    if (Job* job = self.PopBottom()) {
+        return job;
+    }
+    const int slotCount = GetSlotCount();
+    if (slotCount == 1) {
+        return nullptr;
+    }
+    // xorshift 随机起点：避免所有空闲线程同时窃取同一个队列，并让并发的提交方均分工作线程
+    uint32_t seed = self.stealSeed;
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    self.stealSeed = seed;
+    const int start = static_cast<int>(seed % static_cast<uint32_t>(slotCount));
+    for (int i = 0; i < slotCount; ++i) {
+        const int victim = (start + i) % slotCount;
+        if (victim == thread) {
+            continue;
+        }
+        if (Job* job = m_workers[static_cast<size_t>(victim)]->Steal()) {
+            return job;
+        }
+    }
+    return nullptr;
+}
+
+/// 从本线程任务池取一个空闲任务对象；下一个槽位仍在队列中时返回空（调用方就地执行）
+JobSystem::Job* JobSystem::AllocateJob(int thread) {
+    Worker& self = *m_workers[static_cast<size_t>(thread)];
+    Job& job = self.jobs[self.nextJob & (kJobPoolSize - 1)];
+    if (!job.free.load(std::memory_order_acquire)) {
+        return nullptr;
+    }
+    job.free.store(false, std::memory_order_relaxed);
+    ++self.nextJob;
+    return &job;
+}
+
+bool JobSystem::Push(int thread, Job* job) {
+    return m_workers[static_cast<size_t>(thread)]->PushBottom(job);
+}
+
+/// 等待计数归零；期间执行本地或窃取到的任务
+void JobSystem::WaitUntil(const std::atomic<int>& remaining, int thread) {
+    int idle = 0;
+    while (remaining.load(std::memory_order_acquire) != 0) {
+        if (Job* job = FindJob(thread)) {
+            Execute(job, thread);
+            idle = 0;
+            continue;
+        }
+        if (++idle < kWaitSpinsBeforeYield) {
+            CpuPause();
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void JobSystem::Notify() {
+    m_epoch.fetch_add(1, std::memory_order_seq_cst);
+    if (m_sleepers.load(std::memory_order_seq_cst) > 0) {
+        m_epoch.notify_all();
+    }
+}
+
+} // namespace SR
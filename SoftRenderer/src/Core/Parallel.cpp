@@ -0,0 +1,162 @@
+#include "Core/Parallel.h"
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <omp.h>
+#include <vector>
+
+namespace SR {
+namespace Parallel {
+
+namespace {
+
+constexpr int kLeavesPerThread = 8; ///< JobSystem 后端每线程期望的叶任务数（决定叶任务长度下限）
+
+ParallelContext g_defaultContext;             ///< 进程默认环境（未安装 ContextScope 的线程使用）
+std::mutex g_configureMutex;
+thread_local const ParallelContext* t_context = nullptr;
+
+std::mutex g_sharedMutex;
+std::map<int, std::weak_ptr<JobSystem>> g_sharedJobSystems; ///< 按线程数共享的线程池
+
+/// OpenMP 后端执行任务图的一个工作项：某节点的一个块
+struct GraphChunk {
+    int node = 0;
+    int begin = 0;
+    int end = 0;
+};
+
+/**
+ * @brief OpenMP 后端：按拓扑层（Kahn）逐层执行，同层所有节点的块放进同一个并行循环
+ */
+void RunGraphOpenMP(const JobGraph& graph) {
+    const std::vector<JobGraph::Node>& nodes = graph.GetNodes();
+    std::vector<int> pending(nodes.size());
+    std::vector<int> level;
+    std::vector<int> nextLevel;
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        pending[i] = nodes[i].dependencies;
+        if (pending[i] == 0) {
+            level.push_back(static_cast<int>(i));
+        }
+    }
+
+    std::vector<GraphChunk> chunks;
+    while (!level.empty()) {
+        chunks.clear();
+        for (int index : level) {
+            const JobGraph::Node& node = nodes[static_cast<size_t>(index)];
+            for (int first = node.begin; first < node.end; first += node.grain) {
+                chunks.push_back(GraphChunk{index, first, std::min(node.end, first + node.grain)});
+            }
+        }
+        const int chunkCount = static_cast<int>(chunks.size());
+        #pragma omp parallel for schedule(dynamic, 1)
+        for (int c = 0; c < chunkCount; ++c) {
+            const GraphChunk& chunk = chunks[static_cast<size_t>(c)];
+            const JobGraph::Node& node = nodes[static_cast<size_t>(chunk.node)];
+            node.body(node.context, chunk.begin, chunk.end);
+        }
+
+        nextLevel.clear();
+        for (int index : level) {
+            for (int successor : nodes[static_cast<size_t>(index)].successors) {
+                if (--pending[static_cast<size_t>(successor)] == 0) {
+                    nextLevel.push_back(successor);
+                }
+            }
+        }
+        level.swap(nextLevel);
+    }
+}
+
+} // namespace
+
+std::shared_ptr<JobSystem> GetSharedJobSystem(int threadCount) {
+    std::lock_guard<std::mutex> lock(g_sharedMutex);
+    std::weak_ptr<JobSystem>& entry = g_sharedJobSystems[threadCount];
+    std::shared_ptr<JobSystem> jobs = entry.lock();
+    if (!jobs) {
+        jobs = std::make_shared<JobSystem>(threadCount);
+        entry = jobs;
+    }
+    return jobs;
+}
+
+ParallelContext CreateContext(const ParallelOptions& options) {
+    ParallelContext context;
+    context.backend = options.backend;
+    if (options.backend == ParallelBackend::JobSystem) {
+        context.jobSystem = options.jobSystem;
+        if (!context.jobSystem) {
+            const int threads = options.jobThreads > 0 ? options.jobThreads : std::max(1, omp_get_max_threads());
+            context.jobSystem = GetSharedJobSystem(threads);
+        }
+    }
+    return context;
+}
+
+void Configure(const ParallelOptions& options) {
+    std::lock_guard<std::mutex> lock(g_configureMutex);
+    g_defaultContext = CreateContext(options);
+}
+
+ContextScope::ContextScope(const ParallelContext& context) : m_previous(t_context) {
+    t_context = &context;
+}
+
+ContextScope::~ContextScope() {
+    t_context = m_previous;
+}
+
+ParallelBackend GetBackend() {
+    return Detail::ActiveJobSystem() ? ParallelBackend::JobSystem : ParallelBackend::OpenMP;
+}
+
+int MaxThreads() {
+    if (JobSystem* jobs = Detail::ActiveJobSystem()) {
+        return jobs->GetSlotCount();
+    }
+    return std::max(1, omp_get_max_threads());
+}
+
+int ThreadIndex() {
+    if (JobSystem::Current()) {
+        return JobSystem::CurrentThreadIndex();
+    }
+    return omp_get_thread_num();
+}
+
+void Run(const JobGraph& graph) {
+    if (graph.Empty()) {
+        return;
+    }
+    if (JobSystem* jobs = Detail::ActiveJobSystem()) {
+        jobs->Run(graph);
+        return;
+    }
+    RunGraphOpenMP(graph);
+}
+
+namespace Detail {
+
+JobSystem* ActiveJobSystem() {
+    // 任务体内（工作线程或正在提交的线程）沿用所在线程池，嵌套并行与每线程下标保持一致
+    if (JobSystem* current = JobSystem::Current()) {
+        return current;
+    }
+    const ParallelContext& context = t_context ? *t_context : g_defaultContext;
+    return context.backend == ParallelBackend::JobSystem ? context.jobSystem.get() : nullptr;
+}
+
+void JobFor(JobSystem& jobs, int begin, int end, int grain, JobRangeFn body, void* context) {
+    const int threads = jobs.GetThreadCount();
+    const int target = (end - begin + threads * kLeavesPerThread - 1) / (threads * kLeavesPerThread);
+    jobs.ParallelFor(begin, end, std::max({grain, target, 1}), body, context);
+}
+
+} // namespace Detail
+
+} // namespace Parallel
+} // namespace SR
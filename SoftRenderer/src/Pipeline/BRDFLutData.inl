@@ -0,0 +1,2180 @@
+// BRDF 积分 LUT（Split-Sum 第二项）离线烘焙数据，由 src/Pipeline/EnvironmentMap.cpp 在 kBRDFLut 定义中包含。
+// 128 × 128：行 iy 对应 roughness = max((iy + 0.5) / 128, 0.01)，列 ix 对应 NdotV = max((ix + 0.5) / 128, 1e-4)；
+// 每条目 (scale, bias) 两个 unorm16（值 / 65535）。每条目对 512 个 Hammersley 点做 GGX 重要性采样，
+// 几何项为 GeometrySmith（Utils/PBRUtils.h），Fresnel 为 Schlick。修改积分参数时需重新生成本文件。
+    // roughness row 0
+    0x0001, 0x0039, 0x001B, 0x01BF, 0x0070, 0x043C, 0x0115, 0x0746, 0x0212, 0x0A92, 0x036C, 0x0DF0, 0x0521, 0x113B, 0x072D, 0x145D,
+    0x098B, 0x1747, 0x0C34, 0x19F1, 0x0F22, 0x1C55, 0x124C, 0x1E71, 0x15AD, 0x2047, 0x193E, 0x21D7, 0x1CF8, 0x2326, 0x20D6, 0x2436,
+    0x24D1, 0x250C, 0x28E4, 0x25AB, 0x2D0C, 0x2617, 0x3143, 0x2656, 0x3586, 0x266A, 0x39D1, 0x2658, 0x3E20, 0x2623, 0x4271, 0x25CF,
+    0x46C0, 0x2560, 0x4B0D, 0x24D8, 0x4F53, 0x243B, 0x5392, 0x238B, 0x57C8, 0x22CA, 0x5BF3, 0x21FC, 0x6011, 0x2122, 0x6422, 0x203D,
+    0x6825, 0x1F51, 0x6C18, 0x1E5F, 0x6FFC, 0x1D68, 0x73CE, 0x1C6D, 0x778F, 0x1B70, 0x7B3E, 0x1A73, 0x7EDB, 0x1975, 0x8266, 0x1878,
+    0x85DD, 0x177D, 0x8942, 0x1685, 0x8C94, 0x1590, 0x8FD3, 0x149E, 0x92FF, 0x13B1, 0x9618, 0x12C9, 0x991E, 0x11E6, 0x9C11, 0x1108,
+    0x9EF2, 0x1030, 0xA1C1, 0x0F5E, 0xA47D, 0x0E92, 0xA728, 0x0DCC, 0xA9C1, 0x0D0D, 0xAC48, 0x0C55, 0xAEBF, 0x0BA3, 0xB125, 0x0AF7,
+    0xB37A, 0x0A53, 0xB5BF, 0x09B4, 0xB7F5, 0x091D, 0xBA1B, 0x088B, 0xBC33, 0x0800, 0xBE3B, 0x077C, 0xC036, 0x06FD, 0xC222, 0x0685,
+    0xC401, 0x0612, 0xC5D3, 0x05A6, 0xC797, 0x053F, 0xC950, 0x04DD, 0xCAFC, 0x0481, 0xCC9D, 0x042A, 0xCE32, 0x03D8, 0xCFBC, 0x038A,
+    0xD13B, 0x0342, 0xD2B0, 0x02FD, 0xD41B, 0x02BE, 0xD57D, 0x0282, 0xD6D5, 0x024A, 0xD824, 0x0216, 0xD96A, 0x01E6, 0xDAA8, 0x01B9,
+    0xDBDD, 0x018F, 0xDD0B, 0x0168, 0xDE31, 0x0145, 0xDF50, 0x0124, 0xE068, 0x0106, 0xE179, 0x00EA, 0xE284, 0x00D0, 0xE389, 0x00B9,
+    0xE487, 0x00A4, 0xE580, 0x0091, 0xE673, 0x0080, 0xE760, 0x0070, 0xE849, 0x0062, 0xE92C, 0x0055, 0xEA0B, 0x004A, 0xEAE6, 0x0040,
+    0xEBBB, 0x0037, 0xEC8D, 0x002F, 0xED5B, 0x0028, 0xEE24, 0x0021, 0xEEEA, 0x001C, 0xEFAD, 0x0017, 0xF06C, 0x0013, 0xF127, 0x0010,
+    0xF1DF, 0x000D, 0xF294, 0x000A, 0xF347, 0x0008, 0xF3F6, 0x0007, 0xF4A2, 0x0005, 0xF54C, 0x0004, 0xF5F3, 0x0003, 0xF698, 0x0002,
+    0xF73A, 0x0002, 0xF7DA, 0x0001, 0xF877, 0x0001, 0xF912, 0x0001, 0xF9AB, 0x0000, 0xFA42, 0x0000, 0xFAD7, 0x0000, 0xFB6A, 0x0000,
+    0xFBFB, 0x0000, 0xFC8A, 0x0000, 0xFD17, 0x0000, 0xFDA2, 0x0000, 0xFE2C, 0x0000, 0xFEB3, 0x0000, 0xFF39, 0x0000, 0xFFBE, 0x0000,
+    // roughness row 1
+    0x0001, 0x0039, 0x001B, 0x01BD, 0x0070, 0x0436, 0x0113, 0x073B, 0x0210, 0x0A84, 0x0368, 0x0DDE, 0x051B, 0x1126, 0x0725, 0x1445,
+    0x0981, 0x172D, 0x0C27, 0x19D5, 0x0F12, 0x1C37, 0x123A, 0x1E53, 0x1599, 0x2028, 0x1927, 0x21B9, 0x1CDF, 0x2308, 0x20BA, 0x2418,
+    0x24B3, 0x24EE, 0x28C5, 0x258E, 0x2CEA, 0x25FB, 0x3120, 0x263A, 0x3561, 0x264F, 0x39AA, 0x263E, 0x3DF7, 0x260A, 0x4247, 0x25B8,
+    0x4695, 0x2549, 0x4AE0, 0x24C3, 0x4F26, 0x2426, 0x5364, 0x2377, 0x5799, 0x22B8, 0x5BC3, 0x21EA, 0x5FE1, 0x2111, 0x63F1, 0x202E,
+    0x67F4, 0x1F42, 0x6BE7, 0x1E51, 0x6FC9, 0x1D5B, 0x739C, 0x1C61, 0x775C, 0x1B65, 0x7B0C, 0x1A68, 0x7EA8, 0x196B, 0x8233, 0x186F,
+    0x85AB, 0x1774, 0x8910, 0x167D, 0x8C62, 0x1588, 0x8FA1, 0x1497, 0x92CD, 0x13AB, 0x95E7, 0x12C3, 0x98ED, 0x11E0, 0x9BE1, 0x1103,
+    0x9EC2, 0x102B, 0xA191, 0x0F59, 0xA44E, 0x0E8E, 0xA6F9, 0x0DC9, 0xA993, 0x0D0A, 0xAC1B, 0x0C51, 0xAE92, 0x0BA0, 0xB0F8, 0x0AF5,
+    0xB34F, 0x0A50, 0xB595, 0x09B2, 0xB7CB, 0x091A, 0xB9F2, 0x0889, 0xBC0A, 0x07FF, 0xBE13, 0x077A, 0xC00E, 0x06FC, 0xC1FB, 0x0684,
+    0xC3DB, 0x0611, 0xC5AD, 0x05A5, 0xC773, 0x053E, 0xC92C, 0x04DC, 0xCAD9, 0x0480, 0xCC7A, 0x0429, 0xCE10, 0x03D7, 0xCF9B, 0x038A,
+    0xD11B, 0x0341, 0xD290, 0x02FD, 0xD3FC, 0x02BD, 0xD55E, 0x0281, 0xD6B7, 0x024A, 0xD807, 0x0216, 0xD94E, 0x01E5, 0xDA8C, 0x01B8,
+    0xDBC2, 0x018F, 0xDCF1, 0x0168, 0xDE18, 0x0145, 0xDF37, 0x0124, 0xE050, 0x0105, 0xE162, 0x00EA, 0xE26D, 0x00D0, 0xE372, 0x00B9,
+    0xE471, 0x00A4, 0xE56B, 0x0091, 0xE65E, 0x0080, 0xE74D, 0x0070, 0xE836, 0x0062, 0xE91A, 0x0055, 0xE9FA, 0x004A, 0xEAD5, 0x0040,
+    0xEBAB, 0x0037, 0xEC7D, 0x002F, 0xED4C, 0x0028, 0xEE16, 0x0021, 0xEEDC, 0x001C, 0xEF9F, 0x0017, 0xF05F, 0x0013, 0xF11B, 0x0010,
+    0xF1D3, 0x000D, 0xF289, 0x000A, 0xF33C, 0x0008, 0xF3EC, 0x0007, 0xF499, 0x0005, 0xF543, 0x0004, 0xF5EB, 0x0003, 0xF690, 0x0002,
+    0xF732, 0x0002, 0xF7D3, 0x0001, 0xF871, 0x0001, 0xF90C, 0x0001, 0xF9A6, 0x0000, 0xFA3D, 0x0000, 0xFAD3, 0x0000, 0xFB66, 0x0000,
+    0xFBF7, 0x0000, 0xFC87, 0x0000, 0xFD14, 0x0000, 0xFDA0, 0x0000, 0xFE2A, 0x0000, 0xFEB2, 0x0000, 0xFF39, 0x0000, 0xFFBD, 0x0000,
+    // roughness row 2
+    0x0001, 0x0039, 0x001A, 0x01B1, 0x006D, 0x041A, 0x010D, 0x070D, 0x0203, 0x0A44, 0x0354, 0x0D8D, 0x04FF, 0x10C7, 0x0700, 0x13DA,
+    0x0951, 0x16B8, 0x0BED, 0x1958, 0x0ECD, 0x1BB5, 0x11EA, 0x1DCC, 0x153D, 0x1F9F, 0x18C0, 0x212F, 0x1C6D, 0x227E, 0x203E, 0x238F,
+    0x242D, 0x2467, 0x2835, 0x2509, 0x2C52, 0x257A, 0x307F, 0x25BD, 0x34B8, 0x25D6, 0x38F9, 0x25C9, 0x3D40, 0x259A, 0x4189, 0x254C,
+    0x45D2, 0x24E2, 0x4A18, 0x2460, 0x4E58, 0x23C8, 0x5292, 0x231E, 0x56C3, 0x2263, 0x5AEA, 0x219A, 0x5F05, 0x20C5, 0x6313, 0x1FE6,
+    0x6713, 0x1EFF, 0x6B04, 0x1E11, 0x6EE6, 0x1D1F, 0x72B7, 0x1C29, 0x7677, 0x1B30, 0x7A26, 0x1A37, 0x7DC3, 0x193D, 0x814D, 0x1844,
+    0x84C6, 0x174C, 0x882B, 0x1657, 0x8B7E, 0x1565, 0x8EBF, 0x1477, 0x91EC, 0x138C, 0x9507, 0x12A7, 0x980F, 0x11C6, 0x9B05, 0x10EB,
+    0x9DE8, 0x1015, 0xA0B9, 0x0F45, 0xA378, 0x0E7B, 0xA626, 0x0DB7, 0xA8C2, 0x0CFA, 0xAB4D, 0x0C43, 0xADC6, 0x0B92, 0xB030, 0x0AE8,
+    0xB288, 0x0A45, 0xB4D1, 0x09A8, 0xB70B, 0x0911, 0xB934, 0x0881, 0xBB4F, 0x07F7, 0xBD5C, 0x0773, 0xBF5A, 0x06F5, 0xC14A, 0x067E,
+    0xC32D, 0x060C, 0xC502, 0x05A0, 0xC6CB, 0x0539, 0xC887, 0x04D8, 0xCA38, 0x047D, 0xCBDC, 0x0426, 0xCD75, 0x03D4, 0xCF03, 0x0387,
+    0xD087, 0x033F, 0xD200, 0x02FB, 0xD36F, 0x02BB, 0xD4D4, 0x0280, 0xD630, 0x0248, 0xD783, 0x0214, 0xD8CD, 0x01E4, 0xDA0E, 0x01B7,
+    0xDB48, 0x018E, 0xDC79, 0x0167, 0xDDA3, 0x0144, 0xDEC6, 0x0123, 0xDFE2, 0x0105, 0xE0F7, 0x00E9, 0xE205, 0x00D0, 0xE30D, 0x00B9,
+    0xE40F, 0x00A4, 0xE50C, 0x0091, 0xE602, 0x007F, 0xE6F3, 0x0070, 0xE7E0, 0x0062, 0xE8C7, 0x0055, 0xE9A9, 0x004A, 0xEA87, 0x003F,
+    0xEB60, 0x0036, 0xEC35, 0x002E, 0xED06, 0x0027, 0xEDD3, 0x0021, 0xEE9C, 0x001C, 0xEF62, 0x0017, 0xF024, 0x0013, 0xF0E2, 0x0010,
+    0xF19E, 0x000D, 0xF256, 0x000A, 0xF30B, 0x0008, 0xF3BD, 0x0007, 0xF46D, 0x0005, 0xF51A, 0x0004, 0xF5C4, 0x0003, 0xF66B, 0x0002,
+    0xF710, 0x0002, 0xF7B3, 0x0001, 0xF853, 0x0001, 0xF8F1, 0x0001, 0xF98D, 0x0000, 0xFA27, 0x0000, 0xFABE, 0x0000, 0xFB54, 0x0000,
+    0xFBE8, 0x0000, 0xFC79, 0x0000, 0xFD09, 0x0000, 0xFD97, 0x0000, 0xFE23, 0x0000, 0xFEAD, 0x0000, 0xFF35, 0x0000, 0xFFBC, 0x0000,
+    // roughness row 3
+    0x0001, 0x003D, 0x001B, 0x01AA, 0x006B, 0x0401, 0x0107, 0x06E2, 0x01F8, 0x0A07, 0x0342, 0x0D3F, 0x04E5, 0x106B, 0x06DC, 0x1371,
+    0x0923, 0x1645, 0x0BB4, 0x18DD, 0x0E89, 0x1B34, 0x119B, 0x1D48, 0x14E3, 0x1F18, 0x185C, 0x20A6, 0x1BFE, 0x21F5, 0x1FC4, 0x2308,
+    0x23A9, 0x23E1, 0x27A8, 0x2486, 0x2BBB, 0x24FA, 0x2FE0, 0x2540, 0x3411, 0x255D, 0x384B, 0x2555, 0x3C8A, 0x252A, 0x40CD, 0x24E0,
+    0x4510, 0x247B, 0x4950, 0x23FE, 0x4D8C, 0x236B, 0x51C2, 0x22C5, 0x55EF, 0x220F, 0x5A12, 0x214A, 0x5E2A, 0x2079, 0x6235, 0x1F9F,
+    0x6633, 0x1EBC, 0x6A23, 0x1DD2, 0x6E03, 0x1CE3, 0x71D3, 0x1BF1, 0x7592, 0x1AFC, 0x7941, 0x1A05, 0x7CDD, 0x190F, 0x8068, 0x1819,
+    0x83E1, 0x1724, 0x8747, 0x1632, 0x8A9B, 0x1542, 0x8DDC, 0x1456, 0x910B, 0x136E, 0x9427, 0x128B, 0x9731, 0x11AC, 0x9A29, 0x10D3,
+    0x9D0E, 0x0FFF, 0x9FE1, 0x0F30, 0xA2A2, 0x0E68, 0xA552, 0x0DA6, 0xA7F1, 0x0CEA, 0xAA7E, 0x0C34, 0xACFA, 0x0B85, 0xAF66, 0x0ADC,
+    0xB1C2, 0x0A39, 0xB40D, 0x099D, 0xB64A, 0x0908, 0xB876, 0x0878, 0xBA94, 0x07EF, 0xBCA4, 0x076C, 0xBEA5, 0x06EF, 0xC098, 0x0678,
+    0xC27E, 0x0607, 0xC457, 0x059B, 0xC623, 0x0535, 0xC7E2, 0x04D4, 0xC996, 0x0479, 0xCB3E, 0x0423, 0xCCDA, 0x03D1, 0xCE6B, 0x0385,
+    0xCFF2, 0x033D, 0xD16E, 0x02F9, 0xD2E0, 0x02BA, 0xD449, 0x027E, 0xD5A8, 0x0247, 0xD6FE, 0x0213, 0xD84B, 0x01E3, 0xD990, 0x01B6,
+    0xDACD, 0x018D, 0xDC01, 0x0167, 0xDD2E, 0x0143, 0xDE54, 0x0123, 0xDF73, 0x0105, 0xE08B, 0x00E9, 0xE19C, 0x00D0, 0xE2A8, 0x00B9,
+    0xE3AD, 0x00A4, 0xE4AC, 0x0090, 0xE5A5, 0x007F, 0xE69A, 0x0070, 0xE789, 0x0061, 0xE872, 0x0055, 0xE958, 0x0049, 0xEA38, 0x003F,
+    0xEB14, 0x0036, 0xEBEC, 0x002E, 0xECC0, 0x0027, 0xED8F, 0x0021, 0xEE5B, 0x001C, 0xEF23, 0x0017, 0xEFE8, 0x0013, 0xF0A9, 0x0010,
+    0xF167, 0x000D, 0xF222, 0x000A, 0xF2DA, 0x0008, 0xF38F, 0x0007, 0xF441, 0x0005, 0xF4F0, 0x0004, 0xF59D, 0x0003, 0xF646, 0x0002,
+    0xF6EE, 0x0002, 0xF793, 0x0001, 0xF836, 0x0001, 0xF8D6, 0x0001, 0xF974, 0x0000, 0xFA10, 0x0000, 0xFAAA, 0x0000, 0xFB42, 0x0000,
+    0xFBD8, 0x0000, 0xFC6B, 0x0000, 0xFCFD, 0x0000, 0xFD8D, 0x0000, 0xFE1B, 0x0000, 0xFEA8, 0x0000, 0xFF32, 0x0000, 0xFFBB, 0x0000,
+    // roughness row 4
+    0x0002, 0x0047, 0x001C, 0x01A8, 0x006B, 0x03ED, 0x0103, 0x06BA, 0x01EF, 0x09CC, 0x0333, 0x0CF4, 0x04CD, 0x1010, 0x06BB, 0x130B,
+    0x08F8, 0x15D4, 0x0B7F, 0x1864, 0x0E48, 0x1AB5, 0x114F, 0x1CC4, 0x148C, 0x1E92, 0x17FA, 0x201F, 0x1B91, 0x216D, 0x1F4D, 0x2281,
+    0x2328, 0x235C, 0x271D, 0x2404, 0x2B27, 0x247A, 0x2F43, 0x24C4, 0x336C, 0x24E5, 0x379E, 0x24E1, 0x3BD7, 0x24BA, 0x4013, 0x2475,
+    0x4450, 0x2415, 0x488B, 0x239C, 0x4CC2, 0x230E, 0x50F3, 0x226C, 0x551C, 0x21BA, 0x593B, 0x20FA, 0x5D50, 0x202E, 0x6159, 0x1F57,
+    0x6555, 0x1E79, 0x6942, 0x1D93, 0x6D21, 0x1CA8, 0x70F0, 0x1BB9, 0x74AE, 0x1AC7, 0x785C, 0x19D4, 0x7BF8, 0x18E1, 0x7F83, 0x17EE,
+    0x82FC, 0x16FC, 0x8663, 0x160D, 0x89B8, 0x1520, 0x8CFA, 0x1436, 0x902A, 0x1350, 0x9348, 0x126F, 0x9653, 0x1192, 0x994C, 0x10BB,
+    0x9C33, 0x0FE9, 0x9F09, 0x0F1C, 0xA1CC, 0x0E55, 0xA47E, 0x0D94, 0xA71F, 0x0CDA, 0xA9AF, 0x0C25, 0xAC2E, 0x0B77, 0xAE9C, 0x0AD0,
+    0xB0FA, 0x0A2E, 0xB349, 0x0993, 0xB588, 0x08FE, 0xB7B8, 0x086F, 0xB9D9, 0x07E7, 0xBBEB, 0x0765, 0xBDF0, 0x06E8, 0xBFE6, 0x0672,
+    0xC1CF, 0x0601, 0xC3AB, 0x0596, 0xC57A, 0x0531, 0xC73D, 0x04D0, 0xC8F3, 0x0476, 0xCA9E, 0x0420, 0xCC3E, 0x03CE, 0xCDD2, 0x0382,
+    0xCF5C, 0x033A, 0xD0DC, 0x02F7, 0xD251, 0x02B8, 0xD3BD, 0x027D, 0xD51F, 0x0246, 0xD678, 0x0212, 0xD7C9, 0x01E2, 0xD911, 0x01B6,
+    0xDA51, 0x018C, 0xDB88, 0x0166, 0xDCB9, 0x0143, 0xDDE2, 0x0122, 0xDF04, 0x0104, 0xE01F, 0x00E9, 0xE133, 0x00CF, 0xE241, 0x00B8,
+    0xE349, 0x00A3, 0xE44B, 0x0090, 0xE548, 0x007F, 0xE63F, 0x006F, 0xE731, 0x0061, 0xE81E, 0x0055, 0xE906, 0x0049, 0xE9E9, 0x003F,
+    0xEAC8, 0x0036, 0xEBA2, 0x002E, 0xEC79, 0x0027, 0xED4B, 0x0021, 0xEE1A, 0x001C, 0xEEE5, 0x0017, 0xEFAC, 0x0013, 0xF070, 0x0010,
+    0xF131, 0x000D, 0xF1EE, 0x000A, 0xF2A8, 0x0008, 0xF360, 0x0007, 0xF414, 0x0005, 0xF4C6, 0x0004, 0xF575, 0x0003, 0xF621, 0x0002,
+    0xF6CB, 0x0002, 0xF773, 0x0001, 0xF818, 0x0001, 0xF8BA, 0x0001, 0xF95B, 0x0000, 0xF9F9, 0x0000, 0xFA95, 0x0000, 0xFB2F, 0x0000,
+    0xFBC7, 0x0000, 0xFC5D, 0x0000, 0xFCF1, 0x0000, 0xFD84, 0x0000, 0xFE14, 0x0000, 0xFEA2, 0x0000, 0xFF2F, 0x0000, 0xFFBA, 0x0000,
+    // roughness row 5
+    0x0004, 0x0057, 0x001E, 0x01AD, 0x006D, 0x03E0, 0x0102, 0x0699, 0x01EA, 0x0997, 0x0326, 0x0CAD, 0x04B8, 0x0FB9, 0x069D, 0x12A6,
+    0x08D0, 0x1565, 0x0B4C, 0x17ED, 0x0E0B, 0x1A37, 0x1107, 0x1C42, 0x1439, 0x1E0C, 0x179B, 0x1F98, 0x1B28, 0x20E6, 0x1ED9, 0x21FB,
+    0x22AA, 0x22D8, 0x2695, 0x2382, 0x2A96, 0x23FB, 0x2EA9, 0x2449, 0x32CA, 0x246D, 0x36F4, 0x246D, 0x3B26, 0x244B, 0x3F5B, 0x240A,
+    0x4392, 0x23AE, 0x47C7, 0x233A, 0x4BF9, 0x22B0, 0x5025, 0x2214, 0x544A, 0x2166, 0x5866, 0x20AA, 0x5C78, 0x1FE2, 0x607E, 0x1F10,
+    0x6477, 0x1E35, 0x6863, 0x1D53, 0x6C3F, 0x1C6C, 0x700D, 0x1B81, 0x73CB, 0x1A93, 0x7778, 0x19A3, 0x7B14, 0x18B3, 0x7E9E, 0x17C3,
+    0x8218, 0x16D4, 0x857F, 0x15E7, 0x88D4, 0x14FD, 0x8C18, 0x1416, 0x8F49, 0x1332, 0x9268, 0x1253, 0x9575, 0x1178, 0x986F, 0x10A3,
+    0x9B58, 0x0FD2, 0x9E30, 0x0F08, 0xA0F5, 0x0E42, 0xA3A9, 0x0D83, 0xA64D, 0x0CCA, 0xA8DF, 0x0C17, 0xAB60, 0x0B6A, 0xADD1, 0x0AC3,
+    0xB033, 0x0A23, 0xB284, 0x0989, 0xB4C6, 0x08F5, 0xB6F9, 0x0867, 0xB91C, 0x07DF, 0xBB32, 0x075E, 0xBD39, 0x06E2, 0xBF33, 0x066C,
+    0xC11F, 0x05FC, 0xC2FE, 0x0591, 0xC4D0, 0x052C, 0xC696, 0x04CD, 0xC850, 0x0472, 0xC9FE, 0x041C, 0xCBA1, 0x03CC, 0xCD39, 0x0380,
+    0xCEC6, 0x0338, 0xD048, 0x02F5, 0xD1C1, 0x02B6, 0xD330, 0x027B, 0xD495, 0x0244, 0xD5F2, 0x0211, 0xD745, 0x01E1, 0xD891, 0x01B5,
+    0xD9D4, 0x018B, 0xDB0F, 0x0165, 0xDC42, 0x0142, 0xDD6E, 0x0122, 0xDE93, 0x0104, 0xDFB1, 0x00E8, 0xE0C9, 0x00CF, 0xE1DA, 0x00B8,
+    0xE2E5, 0x00A3, 0xE3EA, 0x0090, 0xE4EA, 0x007F, 0xE5E4, 0x006F, 0xE6D8, 0x0061, 0xE7C8, 0x0055, 0xE8B3, 0x0049, 0xE999, 0x003F,
+    0xEA7B, 0x0036, 0xEB58, 0x002E, 0xEC31, 0x0027, 0xED07, 0x0021, 0xEDD8, 0x001C, 0xEEA6, 0x0017, 0xEF70, 0x0013, 0xF036, 0x0010,
+    0xF0F9, 0x000D, 0xF1B9, 0x000A, 0xF276, 0x0008, 0xF330, 0x0007, 0xF3E7, 0x0005, 0xF49B, 0x0004, 0xF54D, 0x0003, 0xF5FC, 0x0002,
+    0xF6A8, 0x0002, 0xF752, 0x0001, 0xF7F9, 0x0001, 0xF89E, 0x0001, 0xF941, 0x0000, 0xF9E2, 0x0000, 0xFA80, 0x0000, 0xFB1C, 0x0000,
+    0xFBB7, 0x0000, 0xFC4F, 0x0000, 0xFCE5, 0x0000, 0xFD7A, 0x0000, 0xFE0C, 0x0000, 0xFE9D, 0x0000, 0xFF2C, 0x0000, 0xFFB9, 0x0000,
+    // roughness row 6
+    0x0006, 0x0070, 0x0022, 0x01BC, 0x0071, 0x03DC, 0x0105, 0x067F, 0x01E8, 0x0968, 0x031E, 0x0C6B, 0x04A8, 0x0F66, 0x0684, 0x1245,
+    0x08AE, 0x14F8, 0x0B1F, 0x1776, 0x0DD3, 0x19BA, 0x10C4, 0x1BC0, 0x13EA, 0x1D87, 0x1741, 0x1F11, 0x1AC3, 0x205F, 0x1E6A, 0x2174,
+    0x2230, 0x2253, 0x2611, 0x22FF, 0x2A09, 0x237C, 0x2E13, 0x23CC, 0x322B, 0x23F5, 0x364E, 0x23F9, 0x3A78, 0x23DB, 0x3EA6, 0x239F,
+    0x42D7, 0x2347, 0x4706, 0x22D8, 0x4B33, 0x2252, 0x4F5A, 0x21BA, 0x537B, 0x2111, 0x5793, 0x205A, 0x5BA1, 0x1F96, 0x5FA4, 0x1EC8,
+    0x639B, 0x1DF1, 0x6784, 0x1D13, 0x6B5F, 0x1C30, 0x6F2B, 0x1B48, 0x72E8, 0x1A5E, 0x7694, 0x1972, 0x7A30, 0x1884, 0x7DBA, 0x1797,
+    0x8133, 0x16AC, 0x849B, 0x15C1, 0x87F1, 0x14DA, 0x8B35, 0x13F5, 0x8E67, 0x1314, 0x9188, 0x1237, 0x9496, 0x115E, 0x9792, 0x108B,
+    0x9A7D, 0x0FBC, 0x9D56, 0x0EF3, 0xA01E, 0x0E2F, 0xA2D4, 0x0D72, 0xA57A, 0x0CBA, 0xA80E, 0x0C08, 0xAA92, 0x0B5C, 0xAD06, 0x0AB7,
+    0xAF6A, 0x0A17, 0xB1BE, 0x097E, 0xB403, 0x08EB, 0xB638, 0x085E, 0xB85F, 0x07D8, 0xBA78, 0x0757, 0xBC82, 0x06DC, 0xBE7F, 0x0666,
+    0xC06E, 0x05F7, 0xC250, 0x058D, 0xC426, 0x0528, 0xC5EF, 0x04C9, 0xC7AC, 0x046F, 0xC95D, 0x0419, 0xCB03, 0x03C9, 0xCC9E, 0x037D,
+    0xCE2E, 0x0336, 0xCFB4, 0x02F3, 0xD130, 0x02B4, 0xD2A2, 0x027A, 0xD40B, 0x0243, 0xD56A, 0x0210, 0xD6C1, 0x01E0, 0xD810, 0x01B4,
+    0xD956, 0x018B, 0xDA94, 0x0165, 0xDBCB, 0x0141, 0xDCFA, 0x0121, 0xDE22, 0x0103, 0xDF43, 0x00E8, 0xE05E, 0x00CF, 0xE172, 0x00B8,
+    0xE280, 0x00A3, 0xE388, 0x0090, 0xE48B, 0x007F, 0xE588, 0x006F, 0xE67F, 0x0061, 0xE772, 0x0055, 0xE860, 0x0049, 0xE949, 0x003F,
+    0xEA2D, 0x0036, 0xEB0D, 0x002E, 0xEBE9, 0x0027, 0xECC1, 0x0021, 0xED95, 0x001C, 0xEE66, 0x0017, 0xEF32, 0x0013, 0xEFFC, 0x0010,
+    0xF0C1, 0x000D, 0xF184, 0x000A, 0xF244, 0x0008, 0xF300, 0x0007, 0xF3BA, 0x0005, 0xF470, 0x0004, 0xF524, 0x0003, 0xF5D6, 0x0002,
+    0xF684, 0x0002, 0xF731, 0x0001, 0xF7DA, 0x0001, 0xF882, 0x0001, 0xF927, 0x0000, 0xF9CA, 0x0000, 0xFA6B, 0x0000, 0xFB09, 0x0000,
+    0xFBA6, 0x0000, 0xFC40, 0x0000, 0xFCD9, 0x0000, 0xFD6F, 0x0000, 0xFE04, 0x0000, 0xFE97, 0x0000, 0xFF28, 0x0000, 0xFFB7, 0x0000,
+    // roughness row 7
+    0x000B, 0x0091, 0x002A, 0x01D5, 0x0079, 0x03E1, 0x010B, 0x066E, 0x01EB, 0x0940, 0x031B, 0x0C2E, 0x049E, 0x0F18, 0x0672, 0x11E8,
+    0x0891, 0x148F, 0x0AF8, 0x1703, 0x0DA1, 0x193E, 0x1086, 0x1B3E, 0x13A1, 0x1D02, 0x16ED, 0x1E8A, 0x1A63, 0x1FD7, 0x1DFF, 0x20ED,
+    0x21BB, 0x21CD, 0x2592, 0x227B, 0x2980, 0x22FB, 0x2D81, 0x234F, 0x3190, 0x237B, 0x35AB, 0x2383, 0x39CD, 0x2369, 0x3DF5, 0x2332,
+    0x421E, 0x22DF, 0x4648, 0x2274, 0x4A6F, 0x21F3, 0x4E91, 0x2160, 0x52AD, 0x20BB, 0x56C1, 0x2009, 0x5ACC, 0x1F49, 0x5ECC, 0x1E7F,
+    0x62BF, 0x1DAD, 0x66A6, 0x1CD3, 0x6A80, 0x1BF3, 0x6E4A, 0x1B0F, 0x7205, 0x1A28, 0x75B1, 0x1940, 0x794C, 0x1856, 0x7CD6, 0x176C,
+    0x8050, 0x1683, 0x83B7, 0x159B, 0x870E, 0x14B6, 0x8A53, 0x13D4, 0x8D86, 0x12F6, 0x90A7, 0x121B, 0x93B7, 0x1144, 0x96B5, 0x1073,
+    0x99A1, 0x0FA6, 0x9C7C, 0x0EDE, 0x9F46, 0x0E1D, 0xA1FF, 0x0D60, 0xA4A6, 0x0CAA, 0xA73D, 0x0BF9, 0xA9C4, 0x0B4F, 0xAC3A, 0x0AAB,
+    0xAEA0, 0x0A0C, 0xB0F7, 0x0974, 0xB33F, 0x08E2, 0xB577, 0x0856, 0xB7A1, 0x07D0, 0xB9BC, 0x0750, 0xBBCA, 0x06D5, 0xBDC9, 0x0661,
+    0xBFBC, 0x05F2, 0xC1A1, 0x0588, 0xC37A, 0x0524, 0xC546, 0x04C5, 0xC706, 0x046B, 0xC8BB, 0x0416, 0xCA64, 0x03C6, 0xCC02, 0x037B,
+    0xCD96, 0x0334, 0xCF1F, 0x02F1, 0xD09E, 0x02B3, 0xD213, 0x0278, 0xD37F, 0x0242, 0xD4E2, 0x020F, 0xD63C, 0x01DF, 0xD78E, 0x01B3,
+    0xD8D7, 0x018A, 0xDA18, 0x0164, 0xDB52, 0x0141, 0xDC84, 0x0121, 0xDDAF, 0x0103, 0xDED4, 0x00E8, 0xDFF1, 0x00CE, 0xE109, 0x00B8,
+    0xE21A, 0x00A3, 0xE325, 0x0090, 0xE42A, 0x007F, 0xE52A, 0x006F, 0xE625, 0x0061, 0xE71B, 0x0054, 0xE80B, 0x0049, 0xE8F7, 0x003F,
+    0xE9DF, 0x0036, 0xEAC2, 0x002E, 0xEBA0, 0x0027, 0xEC7B, 0x0021, 0xED52, 0x001C, 0xEE25, 0x0017, 0xEEF4, 0x0013, 0xEFC0, 0x0010,
+    0xF089, 0x000D, 0xF14E, 0x000A, 0xF210, 0x0008, 0xF2CF, 0x0007, 0xF38B, 0x0005, 0xF445, 0x0004, 0xF4FB, 0x0003, 0xF5AF, 0x0002,
+    0xF660, 0x0002, 0xF70F, 0x0001, 0xF7BB, 0x0001, 0xF865, 0x0001, 0xF90C, 0x0000, 0xF9B2, 0x0000, 0xFA55, 0x0000, 0xFAF6, 0x0000,
+    0xFB95, 0x0000, 0xFC31, 0x0000, 0xFCCC, 0x0000, 0xFD65, 0x0000, 0xFDFC, 0x0000, 0xFE91, 0x0000, 0xFF24, 0x0000, 0xFFB6, 0x0000,
+    // roughness row 8
+    0x0012, 0x00BB, 0x0034, 0x01F9, 0x0086, 0x03F0, 0x0117, 0x0666, 0x01F4, 0x0921, 0x0320, 0x0BFA, 0x049C, 0x0ECF, 0x0666, 0x118F,
+    0x087C, 0x1428, 0x0AD9, 0x1692, 0x0D77, 0x18C6, 0x1051, 0x1ABF, 0x1360, 0x1C7E, 0x16A0, 0x1E03, 0x1A0B, 0x1F4E, 0x1D9B, 0x2064,
+    0x214C, 0x2145, 0x2519, 0x21F5, 0x28FD, 0x2278, 0x2CF4, 0x22CF, 0x30FA, 0x22FF, 0x350C, 0x230B, 0x3927, 0x22F6, 0x3D47, 0x22C3,
+    0x4169, 0x2275, 0x458C, 0x220F, 0x49AE, 0x2193, 0x4DCB, 0x2104, 0x51E2, 0x2064, 0x55F2, 0x1FB6, 0x59F9, 0x1EFB, 0x5DF5, 0x1E36,
+    0x61E6, 0x1D67, 0x65CA, 0x1C91, 0x69A1, 0x1BB6, 0x6D6A, 0x1AD6, 0x7124, 0x19F2, 0x74CE, 0x190D, 0x7869, 0x1826, 0x7BF3, 0x1740,
+    0x7F6C, 0x165A, 0x82D4, 0x1575, 0x862B, 0x1493, 0x8970, 0x13B3, 0x8CA4, 0x12D7, 0x8FC7, 0x11FE, 0x92D7, 0x112A, 0x95D7, 0x105A,
+    0x98C5, 0x0F8F, 0x9BA2, 0x0ECA, 0x9E6D, 0x0E09, 0xA128, 0x0D4F, 0xA3D2, 0x0C9A, 0xA66B, 0x0BEB, 0xA8F4, 0x0B41, 0xAB6D, 0x0A9E,
+    0xADD6, 0x0A01, 0xB02F, 0x096A, 0xB279, 0x08D9, 0xB4B5, 0x084D, 0xB6E2, 0x07C8, 0xB900, 0x0749, 0xBB10, 0x06CF, 0xBD13, 0x065B,
+    0xBF08, 0x05ED, 0xC0F1, 0x0584, 0xC2CD, 0x0520, 0xC49C, 0x04C2, 0xC65F, 0x0468, 0xC817, 0x0414, 0xC9C4, 0x03C4, 0xCB65, 0x0379,
+    0xCCFC, 0x0332, 0xCE88, 0x02F0, 0xD00A, 0x02B1, 0xD183, 0x0277, 0xD2F2, 0x0241, 0xD458, 0x020E, 0xD5B6, 0x01DE, 0xD70A, 0x01B2,
+    0xD857, 0x0189, 0xD99B, 0x0164, 0xDAD8, 0x0141, 0xDC0E, 0x0120, 0xDD3C, 0x0103, 0xDE63, 0x00E7, 0xDF84, 0x00CE, 0xE09F, 0x00B7,
+    0xE1B3, 0x00A3, 0xE2C1, 0x0090, 0xE3C9, 0x007F, 0xE4CC, 0x006F, 0xE5CA, 0x0061, 0xE6C3, 0x0054, 0xE7B6, 0x0049, 0xE8A5, 0x003F,
+    0xE98F, 0x0036, 0xEA75, 0x002E, 0xEB57, 0x0027, 0xEC34, 0x0021, 0xED0E, 0x001C, 0xEDE4, 0x0017, 0xEEB6, 0x0013, 0xEF84, 0x0010,
+    0xF04F, 0x000D, 0xF117, 0x000A, 0xF1DC, 0x0008, 0xF29E, 0x0007, 0xF35C, 0x0005, 0xF418, 0x0004, 0xF4D1, 0x0003, 0xF588, 0x0002,
+    0xF63B, 0x0002, 0xF6EC, 0x0001, 0xF79B, 0x0001, 0xF847, 0x0001, 0xF8F1, 0x0000, 0xF999, 0x0000, 0xFA3E, 0x0000, 0xFAE2, 0x0000,
+    0xFB83, 0x0000, 0xFC22, 0x0000, 0xFCBF, 0x0000, 0xFD5A, 0x0000, 0xFDF3, 0x0000, 0xFE8A, 0x0000, 0xFF20, 0x0000, 0xFFB4, 0x0000,
+    // roughness row 9
+    0x001D, 0x00EE, 0x0043, 0x0227, 0x0098, 0x040C, 0x012A, 0x0668, 0x0204, 0x090B, 0x032B, 0x0BCC, 0x04A1, 0x0E8F, 0x0663, 0x113C,
+    0x0870, 0x13C5, 0x0AC2, 0x1623, 0x0D55, 0x184D, 0x1023, 0x1A41, 0x1327, 0x1BFB, 0x165C, 0x1D7D, 0x19BB, 0x1EC7, 0x1D40, 0x1FDC,
+    0x20E5, 0x20BD, 0x24A7, 0x216E, 0x2880, 0x21F2, 0x2C6D, 0x224D, 0x306A, 0x2281, 0x3473, 0x2291, 0x3885, 0x2280, 0x3C9D, 0x2252,
+    0x40B9, 0x2208, 0x44D5, 0x21A7, 0x48F0, 0x2130, 0x4D08, 0x20A6, 0x511A, 0x200B, 0x5525, 0x1F61, 0x5928, 0x1EAB, 0x5D20, 0x1DEA,
+    0x610E, 0x1D20, 0x64F0, 0x1C4E, 0x68C5, 0x1B77, 0x6C8B, 0x1A9B, 0x7044, 0x19BB, 0x73ED, 0x18D9, 0x7786, 0x17F6, 0x7B0F, 0x1712,
+    0x7E88, 0x1630, 0x81F0, 0x154E, 0x8547, 0x146E, 0x888D, 0x1391, 0x8BC2, 0x12B7, 0x8EE5, 0x11E1, 0x91F7, 0x110F, 0x94F8, 0x1042,
+    0x97E8, 0x0F79, 0x9AC6, 0x0EB5, 0x9D94, 0x0DF6, 0xA050, 0x0D3D, 0xA2FC, 0x0C8A, 0xA598, 0x0BDC, 0xA823, 0x0B34, 0xAA9E, 0x0A92,
+    0xAD0A, 0x09F6, 0xAF66, 0x0960, 0xB1B3, 0x08CF, 0xB3F1, 0x0845, 0xB621, 0x07C1, 0xB842, 0x0742, 0xBA55, 0x06C9, 0xBC5B, 0x0656,
+    0xBE54, 0x05E8, 0xC03F, 0x057F, 0xC21E, 0x051C, 0xC3F1, 0x04BE, 0xC5B7, 0x0465, 0xC772, 0x0411, 0xC922, 0x03C1, 0xCAC6, 0x0377,
+    0xCC60, 0x0330, 0xCDF0, 0x02EE, 0xCF76, 0x02B0, 0xD0F1, 0x0276, 0xD264, 0x0240, 0xD3CD, 0x020D, 0xD52E, 0x01DE, 0xD686, 0x01B2,
+    0xD7D5, 0x0189, 0xD91D, 0x0163, 0xDA5D, 0x0140, 0xDB96, 0x0120, 0xDCC7, 0x0102, 0xDDF2, 0x00E7, 0xDF16, 0x00CE, 0xE033, 0x00B7,
+    0xE14A, 0x00A3, 0xE25C, 0x0090, 0xE367, 0x007F, 0xE46D, 0x006F, 0xE56E, 0x0061, 0xE669, 0x0054, 0xE760, 0x0049, 0xE851, 0x003F,
+    0xE93F, 0x0036, 0xEA27, 0x002E, 0xEB0C, 0x0027, 0xEBEC, 0x0021, 0xECC9, 0x001C, 0xEDA1, 0x0017, 0xEE76, 0x0013, 0xEF47, 0x0010,
+    0xF015, 0x000D, 0xF0E0, 0x000A, 0xF1A7, 0x0008, 0xF26B, 0x0007, 0xF32D, 0x0005, 0xF3EB, 0x0004, 0xF4A7, 0x0003, 0xF55F, 0x0002,
+    0xF616, 0x0002, 0xF6C9, 0x0001, 0xF77A, 0x0001, 0xF829, 0x0001, 0xF8D6, 0x0000, 0xF980, 0x0000, 0xFA27, 0x0000, 0xFACD, 0x0000,
+    0xFB71, 0x0000, 0xFC12, 0x0000, 0xFCB1, 0x0000, 0xFD4F, 0x0000, 0xFDEA, 0x0000, 0xFE84, 0x0000, 0xFF1B, 0x0000, 0xFFB1, 0x0000,
+    // roughness row 10
+    0x002C, 0x012A, 0x0058, 0x0260, 0x00B0, 0x0432, 0x0143, 0x0675, 0x021C, 0x08FE, 0x033F, 0x0BA7, 0x04AF, 0x0E54, 0x066A, 0x10EF,
+    0x086E, 0x1369, 0x0AB6, 0x15B8, 0x0D3D, 0x17D7, 0x1000, 0x19C2, 0x12F8, 0x1B77, 0x1620, 0x1CF6, 0x1974, 0x1E3E, 0x1CED, 0x1F53,
+    0x2087, 0x2035, 0x243E, 0x20E8, 0x280C, 0x216E, 0x2BEF, 0x21CB, 0x2FE1, 0x2201, 0x33E0, 0x2214, 0x37E9, 0x2207, 0x3BF9, 0x21DD,
+    0x400D, 0x2199, 0x4422, 0x213C, 0x4837, 0x20CA, 0x4C48, 0x2045, 0x5055, 0x1FAF, 0x545B, 0x1F0A, 0x5859, 0x1E59, 0x5C4E, 0x1D9C,
+    0x6039, 0x1CD7, 0x6417, 0x1C09, 0x67E9, 0x1B36, 0x6BAE, 0x1A5E, 0x6F64, 0x1982, 0x730C, 0x18A4, 0x76A4, 0x17C4, 0x7A2D, 0x16E4,
+    0x7DA5, 0x1604, 0x810D, 0x1526, 0x8464, 0x1449, 0x87AA, 0x136F, 0x8ADF, 0x1298, 0x8E04, 0x11C4, 0x9117, 0x10F4, 0x9419, 0x1028,
+    0x970A, 0x0F62, 0x99EA, 0x0EA0, 0x9CB9, 0x0DE3, 0x9F77, 0x0D2B, 0xA225, 0x0C79, 0xA4C3, 0x0BCD, 0xA751, 0x0B26, 0xA9CE, 0x0A86,
+    0xAC3D, 0x09EB, 0xAE9B, 0x0956, 0xB0EB, 0x08C6, 0xB32C, 0x083D, 0xB55E, 0x07B9, 0xB782, 0x073B, 0xB999, 0x06C3, 0xBBA2, 0x0650,
+    0xBD9D, 0x05E3, 0xBF8C, 0x057B, 0xC16E, 0x0518, 0xC343, 0x04BB, 0xC50D, 0x0462, 0xC6CB, 0x040E, 0xC87E, 0x03BF, 0xCA26, 0x0375,
+    0xCBC3, 0x032F, 0xCD56, 0x02ED, 0xCEDF, 0x02AF, 0xD05E, 0x0275, 0xD1D4, 0x023F, 0xD340, 0x020C, 0xD4A4, 0x01DD, 0xD5FF, 0x01B1,
+    0xD752, 0x0189, 0xD89D, 0x0163, 0xD9E1, 0x0140, 0xDB1C, 0x0120, 0xDC51, 0x0102, 0xDD7F, 0x00E7, 0xDEA6, 0x00CE, 0xDFC6, 0x00B7,
+    0xE0E1, 0x00A3, 0xE1F5, 0x0090, 0xE304, 0x007F, 0xE40D, 0x006F, 0xE510, 0x0061, 0xE60F, 0x0055, 0xE708, 0x0049, 0xE7FD, 0x003F,
+    0xE8ED, 0x0036, 0xE9D8, 0x002E, 0xEAC0, 0x0027, 0xEBA3, 0x0021, 0xEC82, 0x001C, 0xED5E, 0x0017, 0xEE35, 0x0013, 0xEF09, 0x0010,
+    0xEFDA, 0x000D, 0xF0A7, 0x000A, 0xF171, 0x0008, 0xF238, 0x0007, 0xF2FC, 0x0005, 0xF3BD, 0x0004, 0xF47B, 0x0003, 0xF537, 0x0002,
+    0xF5EF, 0x0002, 0xF6A5, 0x0001, 0xF759, 0x0001, 0xF80A, 0x0001, 0xF8B9, 0x0000, 0xF966, 0x0000, 0xFA10, 0x0000, 0xFAB8, 0x0000,
+    0xFB5E, 0x0000, 0xFC01, 0x0000, 0xFCA3, 0x0000, 0xFD43, 0x0000, 0xFDE0, 0x0000, 0xFE7C, 0x0000, 0xFF16, 0x0000, 0xFFAE, 0x0000,
+    // roughness row 11
+    0x0041, 0x016F, 0x0073, 0x02A2, 0x00CF, 0x0462, 0x0165, 0x068D, 0x023D, 0x08FB, 0x035D, 0x0B8A, 0x04C8, 0x0E20, 0x067C, 0x10A7,
+    0x0876, 0x1311, 0x0AB4, 0x1553, 0x0D31, 0x1766, 0x0FE8, 0x1947, 0x12D4, 0x1AF4, 0x15F0, 0x1C6D, 0x1937, 0x1DB3, 0x1CA4, 0x1EC6,
+    0x2032, 0x1FA9, 0x23DD, 0x205E, 0x27A1, 0x20E7, 0x2B79, 0x2146, 0x2F61, 0x2180, 0x3357, 0x2197, 0x3757, 0x218E, 0x3B5E, 0x2168,
+    0x3F69, 0x2127, 0x4376, 0x20CE, 0x4783, 0x2060, 0x4B8D, 0x1FE0, 0x4F94, 0x1F4F, 0x5395, 0x1EB0, 0x578E, 0x1E03, 0x5B7F, 0x1D4C,
+    0x5F65, 0x1C8B, 0x6341, 0x1BC2, 0x6710, 0x1AF3, 0x6AD2, 0x1A1F, 0x6E86, 0x1947, 0x722C, 0x186D, 0x75C3, 0x1791, 0x794A, 0x16B4,
+    0x7CC2, 0x15D8, 0x8029, 0x14FD, 0x8380, 0x1423, 0x86C7, 0x134B, 0x89FC, 0x1277, 0x8D21, 0x11A6, 0x9035, 0x10D8, 0x9338, 0x100F,
+    0x962B, 0x0F4A, 0x990C, 0x0E8A, 0x9BDD, 0x0DCF, 0x9E9D, 0x0D19, 0xA14D, 0x0C69, 0xA3ED, 0x0BBE, 0xA67D, 0x0B19, 0xA8FD, 0x0A79,
+    0xAB6D, 0x09DF, 0xADCF, 0x094B, 0xB021, 0x08BD, 0xB265, 0x0835, 0xB49A, 0x07B2, 0xB6C1, 0x0735, 0xB8DA, 0x06BD, 0xBAE6, 0x064B,
+    0xBCE5, 0x05DE, 0xBED6, 0x0577, 0xC0BB, 0x0515, 0xC294, 0x04B8, 0xC461, 0x045F, 0xC623, 0x040C, 0xC7D9, 0x03BD, 0xC984, 0x0373,
+    0xCB24, 0x032D, 0xCCBA, 0x02EB, 0xCE47, 0x02AE, 0xCFC9, 0x0274, 0xD142, 0x023E, 0xD2B2, 0x020C, 0xD419, 0x01DD, 0xD577, 0x01B1,
+    0xD6CD, 0x0188, 0xD81C, 0x0163, 0xD962, 0x0140, 0xDAA1, 0x0120, 0xDBD9, 0x0102, 0xDD0A, 0x00E7, 0xDE34, 0x00CE, 0xDF58, 0x00B7,
+    0xE075, 0x00A3, 0xE18D, 0x0090, 0xE29E, 0x007F, 0xE3AA, 0x006F, 0xE4B1, 0x0061, 0xE5B3, 0x0055, 0xE6AF, 0x0049, 0xE7A7, 0x003F,
+    0xE89A, 0x0037, 0xE988, 0x002F, 0xEA72, 0x0028, 0xEB58, 0x0021, 0xEC3A, 0x001C, 0xED19, 0x0017, 0xEDF3, 0x0013, 0xEECA, 0x0010,
+    0xEF9D, 0x000D, 0xF06D, 0x000B, 0xF13A, 0x0008, 0xF204, 0x0007, 0xF2CA, 0x0005, 0xF38E, 0x0004, 0xF44F, 0x0003, 0xF50D, 0x0002,
+    0xF5C8, 0x0002, 0xF680, 0x0001, 0xF737, 0x0001, 0xF7EA, 0x0001, 0xF89C, 0x0000, 0xF94B, 0x0000, 0xF9F7, 0x0000, 0xFAA2, 0x0000,
+    0xFB4A, 0x0000, 0xFBF0, 0x0000, 0xFC94, 0x0000, 0xFD36, 0x0000, 0xFDD6, 0x0000, 0xFE74, 0x0000, 0xFF10, 0x0000, 0xFFAB, 0x0000,
+    // roughness row 12
+    0x005C, 0x01BC, 0x0095, 0x02ED, 0x00F7, 0x049C, 0x0190, 0x06AE, 0x0268, 0x0902, 0x0386, 0x0B76, 0x04EC, 0x0DF3, 0x0698, 0x1065,
+    0x088B, 0x12BD, 0x0ABF, 0x14F0, 0x0D31, 0x16F8, 0x0FDD, 0x18D0, 0x12BC, 0x1A75, 0x15CC, 0x1BE8, 0x1906, 0x1D28, 0x1C66, 0x1E39,
+    0x1FE8, 0x1F1B, 0x2387, 0x1FD0, 0x273F, 0x205B, 0x2B0C, 0x20BE, 0x2EEA, 0x20FC, 0x32D6, 0x2117, 0x36CC, 0x2112, 0x3ACA, 0x20F1,
+    0x3ECD, 0x20B5, 0x42D2, 0x2061, 0x46D8, 0x1FF8, 0x4ADB, 0x1F7C, 0x4EDB, 0x1EEF, 0x52D5, 0x1E53, 0x56C8, 0x1DAA, 0x5AB3, 0x1CF7,
+    0x5E95, 0x1C3B, 0x626C, 0x1B77, 0x6638, 0x1AAD, 0x69F7, 0x19DD, 0x6DA9, 0x190A, 0x714D, 0x1833, 0x74E2, 0x175B, 0x7868, 0x1683,
+    0x7BDF, 0x15AA, 0x7F46, 0x14D2, 0x829C, 0x13FB, 0x85E3, 0x1327, 0x8919, 0x1255, 0x8C3E, 0x1186, 0x8F53, 0x10BB, 0x9257, 0x0FF4,
+    0x954A, 0x0F32, 0x982D, 0x0E74, 0x9AFF, 0x0DBB, 0x9DC2, 0x0D07, 0xA073, 0x0C58, 0xA315, 0x0BAF, 0xA5A7, 0x0B0B, 0xA82A, 0x0A6D,
+    0xAA9D, 0x09D4, 0xAD00, 0x0941, 0xAF55, 0x08B4, 0xB19C, 0x082C, 0xB3D4, 0x07AA, 0xB5FD, 0x072E, 0xB81A, 0x06B7, 0xBA28, 0x0646,
+    0xBC2A, 0x05DA, 0xBE1F, 0x0573, 0xC007, 0x0511, 0xC1E3, 0x04B5, 0xC3B3, 0x045D, 0xC578, 0x040A, 0xC731, 0x03BB, 0xC8DF, 0x0371,
+    0xCA83, 0x032C, 0xCC1D, 0x02EA, 0xCDAC, 0x02AD, 0xCF32, 0x0273, 0xD0AE, 0x023D, 0xD221, 0x020B, 0xD38B, 0x01DC, 0xD4ED, 0x01B1,
+    0xD647, 0x0188, 0xD798, 0x0163, 0xD8E2, 0x0140, 0xDA24, 0x0120, 0xDB5F, 0x0102, 0xDC93, 0x00E7, 0xDDC0, 0x00CE, 0xDEE7, 0x00B8,
+    0xE008, 0x00A3, 0xE123, 0x0090, 0xE237, 0x007F, 0xE346, 0x006F, 0xE450, 0x0062, 0xE555, 0x0055, 0xE654, 0x004A, 0xE74F, 0x0040,
+    0xE845, 0x0037, 0xE936, 0x002F, 0xEA23, 0x0028, 0xEB0C, 0x0022, 0xEBF1, 0x001C, 0xECD2, 0x0018, 0xEDB0, 0x0014, 0xEE89, 0x0010,
+    0xEF5F, 0x000D, 0xF032, 0x000B, 0xF102, 0x0009, 0xF1CE, 0x0007, 0xF297, 0x0005, 0xF35D, 0x0004, 0xF421, 0x0003, 0xF4E1, 0x0002,
+    0xF59F, 0x0002, 0xF65A, 0x0001, 0xF713, 0x0001, 0xF7C9, 0x0001, 0xF87D, 0x0000, 0xF92E, 0x0000, 0xF9DE, 0x0000, 0xFA8A, 0x0000,
+    0xFB35, 0x0000, 0xFBDE, 0x0000, 0xFC84, 0x0000, 0xFD28, 0x0000, 0xFDCB, 0x0000, 0xFE6B, 0x0000, 0xFF0A, 0x0000, 0xFFA6, 0x0000,
+    // roughness row 13
+    0x0080, 0x0210, 0x00C0, 0x033F, 0x0128, 0x04DE, 0x01C4, 0x06D9, 0x029E, 0x0912, 0x03BA, 0x0B6C, 0x051B, 0x0DCF, 0x06C2, 0x102A,
+    0x08AC, 0x126E, 0x0AD6, 0x1491, 0x0D3E, 0x168C, 0x0FDE, 0x1859, 0x12B2, 0x19F8, 0x15B5, 0x1B65, 0x18E2, 0x1CA1, 0x1C36, 0x1DAE,
+    0x1FAA, 0x1E8D, 0x233C, 0x1F41, 0x26E8, 0x1FCD, 0x2AA9, 0x2032, 0x2E7B, 0x2072, 0x325D, 0x2091, 0x3649, 0x2091, 0x3A3E, 0x2075,
+    0x3E38, 0x203E, 0x4235, 0x1FEF, 0x4633, 0x1F8B, 0x4A2F, 0x1F14, 0x4E28, 0x1E8D, 0x521C, 0x1DF6, 0x560A, 0x1D52, 0x59F0, 0x1CA4,
+    0x5DCC, 0x1BEB, 0x619E, 0x1B2B, 0x6565, 0x1A64, 0x6920, 0x1998, 0x6CCE, 0x18C8, 0x706F, 0x17F7, 0x7402, 0x1723, 0x7787, 0x164E,
+    0x7AFC, 0x1579, 0x7E62, 0x14A4, 0x81B8, 0x13D1, 0x84FE, 0x1300, 0x8834, 0x1231, 0x8B5A, 0x1165, 0x8E6F, 0x109D, 0x9174, 0x0FD9,
+    0x9468, 0x0F18, 0x974D, 0x0E5D, 0x9A20, 0x0DA5, 0x9CE4, 0x0CF3, 0x9F98, 0x0C46, 0xA23B, 0x0B9F, 0xA4CF, 0x0AFD, 0xA754, 0x0A60,
+    0xA9C9, 0x09C8, 0xAC30, 0x0937, 0xAE87, 0x08AB, 0xB0D0, 0x0824, 0xB30B, 0x07A3, 0xB537, 0x0728, 0xB756, 0x06B2, 0xB968, 0x0641,
+    0xBB6D, 0x05D5, 0xBD65, 0x056F, 0xBF50, 0x050E, 0xC12F, 0x04B2, 0xC302, 0x045B, 0xC4CA, 0x0408, 0xC687, 0x03BA, 0xC838, 0x0370,
+    0xC9DF, 0x032B, 0xCB7C, 0x02EA, 0xCD0F, 0x02AC, 0xCE98, 0x0273, 0xD017, 0x023D, 0xD18E, 0x020B, 0xD2FB, 0x01DC, 0xD460, 0x01B1,
+    0xD5BD, 0x0188, 0xD712, 0x0163, 0xD85F, 0x0140, 0xD9A5, 0x0120, 0xDAE3, 0x0103, 0xDC1A, 0x00E8, 0xDD4B, 0x00CF, 0xDE75, 0x00B8,
+    0xDF99, 0x00A3, 0xE0B6, 0x0090, 0xE1CE, 0x007F, 0xE2E1, 0x0070, 0xE3ED, 0x0062, 0xE4F5, 0x0055, 0xE5F8, 0x004A, 0xE6F5, 0x0040,
+    0xE7EE, 0x0037, 0xE8E3, 0x002F, 0xE9D3, 0x0028, 0xEABF, 0x0022, 0xEBA6, 0x001C, 0xEC8A, 0x0018, 0xED6A, 0x0014, 0xEE47, 0x0010,
+    0xEF20, 0x000D, 0xEFF5, 0x000B, 0xF0C8, 0x0009, 0xF197, 0x0007, 0xF262, 0x0005, 0xF32B, 0x0004, 0xF3F1, 0x0003, 0xF4B5, 0x0002,
+    0xF575, 0x0002, 0xF633, 0x0001, 0xF6EE, 0x0001, 0xF7A7, 0x0001, 0xF85D, 0x0000, 0xF911, 0x0000, 0xF9C3, 0x0000, 0xFA72, 0x0000,
+    0xFB1F, 0x0000, 0xFBCA, 0x0000, 0xFC73, 0x0000, 0xFD1A, 0x0000, 0xFDBE, 0x0000, 0xFE61, 0x0000, 0xFF02, 0x0000, 0xFFA1, 0x0000,
+    // roughness row 14
+    0x00AC, 0x026B, 0x00F4, 0x0398, 0x0163, 0x0528, 0x0204, 0x070C, 0x02DF, 0x092A, 0x03FA, 0x0B69, 0x0558, 0x0DB3, 0x06F9, 0x0FF6,
+    0x08DB, 0x1225, 0x0AFC, 0x1436, 0x0D59, 0x1623, 0x0FED, 0x17E5, 0x12B5, 0x197A, 0x15AB, 0x1AE1, 0x18CC, 0x1C1A, 0x1C13, 0x1D24,
+    0x1F7B, 0x1E02, 0x2300, 0x1EB5, 0x269E, 0x1F3F, 0x2A52, 0x1FA4, 0x2E19, 0x1FE7, 0x31EF, 0x2009, 0x35D0, 0x200C, 0x39BA, 0x1FF3,
+    0x3DAA, 0x1FC2, 0x419E, 0x1F78, 0x4594, 0x1F1A, 0x4989, 0x1EA8, 0x4D7B, 0x1E26, 0x5169, 0x1D95, 0x5550, 0x1CF7, 0x5931, 0x1C4D,
+    0x5D08, 0x1B9A, 0x60D6, 0x1ADF, 0x6499, 0x1A1C, 0x6850, 0x1955, 0x6BFB, 0x1889, 0x6F98, 0x17BB, 0x7328, 0x16EA, 0x76A9, 0x1618,
+    0x7A1B, 0x1546, 0x7D7F, 0x1474, 0x80D4, 0x13A4, 0x8419, 0x12D7, 0x874F, 0x120B, 0x8A75, 0x1142, 0x8D8A, 0x107D, 0x9090, 0x0FBB,
+    0x9385, 0x0EFD, 0x966A, 0x0E44, 0x993F, 0x0D8F, 0x9C04, 0x0CDF, 0x9EBA, 0x0C34, 0xA15F, 0x0B8E, 0xA3F5, 0x0AEE, 0xA67C, 0x0A52,
+    0xA8F3, 0x09BC, 0xAB5C, 0x092C, 0xADB6, 0x08A1, 0xB002, 0x081C, 0xB23F, 0x079C, 0xB46E, 0x0721, 0xB690, 0x06AC, 0xB8A5, 0x063C,
+    0xBAAD, 0x05D1, 0xBCA7, 0x056C, 0xBE96, 0x050B, 0xC078, 0x04AF, 0xC24F, 0x0458, 0xC41A, 0x0406, 0xC5DA, 0x03B8, 0xC78E, 0x036F,
+    0xC939, 0x032A, 0xCAD9, 0x02E9, 0xCC6F, 0x02AC, 0xCDFB, 0x0273, 0xCF7E, 0x023D, 0xD0F8, 0x020B, 0xD269, 0x01DC, 0xD3D1, 0x01B1,
+    0xD531, 0x0189, 0xD689, 0x0163, 0xD7DA, 0x0141, 0xD922, 0x0121, 0xDA64, 0x0103, 0xDB9F, 0x00E8, 0xDCD3, 0x00CF, 0xDE00, 0x00B9,
+    0xDF27, 0x00A4, 0xE048, 0x0091, 0xE163, 0x0080, 0xE278, 0x0070, 0xE388, 0x0062, 0xE493, 0x0056, 0xE599, 0x004A, 0xE699, 0x0040,
+    0xE795, 0x0037, 0xE88D, 0x002F, 0xE980, 0x0028, 0xEA6F, 0x0022, 0xEB59, 0x001D, 0xEC40, 0x0018, 0xED23, 0x0014, 0xEE03, 0x0010,
+    0xEEDE, 0x000D, 0xEFB7, 0x000B, 0xF08C, 0x0009, 0xF15D, 0x0007, 0xF22C, 0x0005, 0xF2F8, 0x0004, 0xF3C1, 0x0003, 0xF486, 0x0002,
+    0xF54A, 0x0002, 0xF60A, 0x0001, 0xF6C8, 0x0001, 0xF783, 0x0001, 0xF83C, 0x0000, 0xF8F2, 0x0000, 0xF9A7, 0x0000, 0xFA58, 0x0000,
+    0xFB08, 0x0000, 0xFBB5, 0x0000, 0xFC60, 0x0000, 0xFD0A, 0x0000, 0xFDB1, 0x0000, 0xFE56, 0x0000, 0xFEF9, 0x0000, 0xFF9B, 0x0000,
+    // roughness row 15
+    0x00E3, 0x02CB, 0x0133, 0x03F6, 0x01A9, 0x0578, 0x024F, 0x0746, 0x032C, 0x0949, 0x0447, 0x0B6E, 0x05A2, 0x0D9D, 0x073D, 0x0FC9,
+    0x0918, 0x11E2, 0x0B30, 0x13E0, 0x0D82, 0x15BC, 0x100B, 0x1772, 0x12C7, 0x18FE, 0x15B0, 0x1A5E, 0x18C4, 0x1B91, 0x1BFE, 0x1C98,
+    0x1F59, 0x1D75, 0x22D1, 0x1E28, 0x2663, 0x1EB3, 0x2A0B, 0x1F19, 0x2DC4, 0x1F5D, 0x318D, 0x1F7F, 0x3562, 0x1F85, 0x3941, 0x1F70,
+    0x3D27, 0x1F42, 0x4111, 0x1EFD, 0x44FD, 0x1EA3, 0x48E9, 0x1E37, 0x4CD4, 0x1DBB, 0x50BA, 0x1D2F, 0x549C, 0x1C96, 0x5876, 0x1BF2,
+    0x5C48, 0x1B44, 0x6011, 0x1A8E, 0x63D0, 0x19D1, 0x6783, 0x190E, 0x6B2B, 0x1847, 0x6EC5, 0x177D, 0x7252, 0x16B0, 0x75D1, 0x15E2,
+    0x7942, 0x1514, 0x7CA4, 0x1446, 0x7FF6, 0x1379, 0x8339, 0x12AE, 0x866D, 0x11E4, 0x8991, 0x111E, 0x8CA5, 0x105A, 0x8FA9, 0x0F9B,
+    0x929F, 0x0EE0, 0x9585, 0x0E29, 0x985C, 0x0D77, 0x9B22, 0x0CC9, 0x9DD9, 0x0C20, 0xA080, 0x0B7C, 0xA318, 0x0ADD, 0xA5A1, 0x0A44,
+    0xA81A, 0x09B0, 0xAA85, 0x0921, 0xACE2, 0x0897, 0xAF30, 0x0813, 0xB170, 0x0794, 0xB3A2, 0x071A, 0xB5C7, 0x06A6, 0xB7DE, 0x0637,
+    0xB9E9, 0x05CD, 0xBBE7, 0x0568, 0xBDD8, 0x0508, 0xBFBE, 0x04AD, 0xC198, 0x0456, 0xC366, 0x0404, 0xC529, 0x03B7, 0xC6E1, 0x036E,
+    0xC88F, 0x0329, 0xCA32, 0x02E9, 0xCBCB, 0x02AC, 0xCD5B, 0x0273, 0xCEE1, 0x023D, 0xD05F, 0x020B, 0xD1D3, 0x01DD, 0xD33F, 0x01B2,
+    0xD4A2, 0x0189, 0xD5FE, 0x0164, 0xD751, 0x0141, 0xD89D, 0x0121, 0xD9E2, 0x0104, 0xDB20, 0x00E9, 0xDC57, 0x00D0, 0xDD88, 0x00B9,
+    0xDEB2, 0x00A5, 0xDFD6, 0x0092, 0xE0F5, 0x0081, 0xE20D, 0x0071, 0xE320, 0x0063, 0xE42E, 0x0056, 0xE537, 0x004B, 0xE63B, 0x0041,
+    0xE73A, 0x0038, 0xE835, 0x0030, 0xE92B, 0x0029, 0xEA1D, 0x0022, 0xEB0A, 0x001D, 0xEBF4, 0x0018, 0xECDA, 0x0014, 0xEDBC, 0x0011,
+    0xEE9B, 0x000E, 0xEF76, 0x000B, 0xF04E, 0x0009, 0xF122, 0x0007, 0xF1F4, 0x0006, 0xF2C2, 0x0004, 0xF38E, 0x0003, 0xF456, 0x0002,
+    0xF51C, 0x0002, 0xF5DF, 0x0001, 0xF6A0, 0x0001, 0xF75E, 0x0001, 0xF819, 0x0000, 0xF8D2, 0x0000, 0xF989, 0x0000, 0xFA3D, 0x0000,
+    0xFAEF, 0x0000, 0xFB9F, 0x0000, 0xFC4C, 0x0000, 0xFCF8, 0x0000, 0xFDA2, 0x0000, 0xFE49, 0x0000, 0xFEEF, 0x0000, 0xFF93, 0x0000,
+    // roughness row 16
+    0x0124, 0x0331, 0x017D, 0x0459, 0x01FB, 0x05CE, 0x02A6, 0x0786, 0x0387, 0x0970, 0x04A2, 0x0B79, 0x05FA, 0x0D90, 0x0790, 0x0FA2,
+    0x0964, 0x11A6, 0x0B73, 0x1390, 0x0DBB, 0x155C, 0x1038, 0x1703, 0x12E7, 0x1883, 0x15C4, 0x19DB, 0x18CB, 0x1B08, 0x1BF7, 0x1C0B,
+    0x1F44, 0x1CE5, 0x22AF, 0x1D97, 0x2634, 0x1E24, 0x29CF, 0x1E8C, 0x2D7D, 0x1ED1, 0x313A, 0x1EF7, 0x3503, 0x1EFF, 0x38D6, 0x1EED,
+    0x3CB0, 0x1EC1, 0x408F, 0x1E7F, 0x4471, 0x1E2A, 0x4854, 0x1DC3, 0x4C35, 0x1D4B, 0x5013, 0x1CC4, 0x53EC, 0x1C30, 0x57C0, 0x1B92,
+    0x5B8C, 0x1AEA, 0x5F50, 0x1A39, 0x630A, 0x1981, 0x66B9, 0x18C4, 0x6A5C, 0x1802, 0x6DF3, 0x173C, 0x717E, 0x1674, 0x74FA, 0x15AA,
+    0x7869, 0x14E0, 0x7BC9, 0x1416, 0x7F1A, 0x134C, 0x825D, 0x1284, 0x858F, 0x11BE, 0x88B3, 0x10FB, 0x8BC7, 0x103B, 0x8ECB, 0x0F7E,
+    0x91C0, 0x0EC4, 0x94A5, 0x0E0F, 0x977A, 0x0D5E, 0x9A3F, 0x0CB2, 0x9CF6, 0x0C0A, 0x9F9E, 0x0B68, 0xA237, 0x0ACC, 0xA4C2, 0x0A34,
+    0xA73E, 0x09A1, 0xA9AB, 0x0914, 0xAC0A, 0x088C, 0xAE5A, 0x0809, 0xB09D, 0x078B, 0xB2D2, 0x0713, 0xB4F9, 0x069F, 0xB714, 0x0631,
+    0xB921, 0x05C8, 0xBB22, 0x0564, 0xBD17, 0x0505, 0xBF00, 0x04AA, 0xC0DD, 0x0454, 0xC2AE, 0x0403, 0xC474, 0x03B6, 0xC630, 0x036D,
+    0xC7E1, 0x0329, 0xC988, 0x02E8, 0xCB24, 0x02AC, 0xCCB7, 0x0273, 0xCE41, 0x023E, 0xCFC2, 0x020C, 0xD139, 0x01DE, 0xD2A8, 0x01B2,
+    0xD40F, 0x018A, 0xD56E, 0x0165, 0xD6C5, 0x0142, 0xD815, 0x0122, 0xD95D, 0x0105, 0xDA9E, 0x00EA, 0xDBD9, 0x00D1, 0xDD0D, 0x00BA,
+    0xDE3A, 0x00A5, 0xDF62, 0x0093, 0xE083, 0x0081, 0xE19F, 0x0072, 0xE2B6, 0x0064, 0xE3C7, 0x0057, 0xE4D3, 0x004C, 0xE5DA, 0x0041,
+    0xE6DC, 0x0038, 0xE7D9, 0x0030, 0xE8D3, 0x0029, 0xE9C8, 0x0023, 0xEAB8, 0x001D, 0xEBA5, 0x0019, 0xEC8E, 0x0014, 0xED73, 0x0011,
+    0xEE55, 0x000E, 0xEF33, 0x000B, 0xF00D, 0x0009, 0xF0E5, 0x0007, 0xF1B9, 0x0006, 0xF28A, 0x0004, 0xF359, 0x0003, 0xF424, 0x0003,
+    0xF4EC, 0x0002, 0xF5B2, 0x0001, 0xF675, 0x0001, 0xF736, 0x0001, 0xF7F4, 0x0000, 0xF8AF, 0x0000, 0xF969, 0x0000, 0xFA20, 0x0000,
+    0xFAD4, 0x0000, 0xFB86, 0x0000, 0xFC37, 0x0000, 0xFCE5, 0x0000, 0xFD91, 0x0000, 0xFE3B, 0x0000, 0xFEE3, 0x0000, 0xFF89, 0x0000,
+    // roughness row 17
+    0x0172, 0x039A, 0x01D3, 0x04BF, 0x0259, 0x0627, 0x030A, 0x07CB, 0x03EE, 0x099D, 0x050A, 0x0B8B, 0x0660, 0x0D87, 0x07F2, 0x0F82,
+    0x09BF, 0x116F, 0x0BC6, 0x1346, 0x0E04, 0x14FF, 0x1076, 0x1699, 0x1318, 0x180C, 0x15E8, 0x1959, 0x18E1, 0x1A80, 0x1BFF, 0x1B7F,
+    0x1F3F, 0x1C55, 0x229C, 0x1D05, 0x2613, 0x1D91, 0x29A1, 0x1DFA, 0x2D42, 0x1E42, 0x30F3, 0x1E6C, 0x34B0, 0x1E77, 0x3877, 0x1E68,
+    0x3C46, 0x1E41, 0x401A, 0x1E03, 0x43F1, 0x1DB1, 0x47C9, 0x1D4D, 0x4BA0, 0x1CD8, 0x4F75, 0x1C57, 0x5347, 0x1BC9, 0x5713, 0x1B2F,
+    0x5AD7, 0x1A8C, 0x5E94, 0x19E0, 0x6247, 0x192C, 0x65F2, 0x1874, 0x6991, 0x17B7, 0x6D24, 0x16F7, 0x70AB, 0x1634, 0x7425, 0x156F,
+    0x7791, 0x14A9, 0x7AEF, 0x13E3, 0x7E3E, 0x131D, 0x817F, 0x1259, 0x84B1, 0x1196, 0x87D4, 0x10D6, 0x8AE8, 0x1019, 0x8DEC, 0x0F5F,
+    0x90E1, 0x0EA8, 0x93C6, 0x0DF6, 0x969C, 0x0D47, 0x9963, 0x0C9D, 0x9C1A, 0x0BF8, 0x9EC2, 0x0B57, 0xA15C, 0x0ABB, 0xA3E6, 0x0A24,
+    0xA662, 0x0993, 0xA8CF, 0x0906, 0xAB2E, 0x087F, 0xAD80, 0x07FD, 0xAFC5, 0x0781, 0xB1FD, 0x070A, 0xB427, 0x0698, 0xB644, 0x062B,
+    0xB855, 0x05C3, 0xBA59, 0x055F, 0xBC51, 0x0501, 0xBE3D, 0x04A7, 0xC01D, 0x0452, 0xC1F1, 0x0401, 0xC3BB, 0x03B4, 0xC57A, 0x036C,
+    0xC72E, 0x0328, 0xC8D8, 0x02E8, 0xCA79, 0x02AC, 0xCC0F, 0x0273, 0xCD9C, 0x023E, 0xCF20, 0x020D, 0xD09B, 0x01DE, 0xD20E, 0x01B3,
+    0xD378, 0x018B, 0xD4DB, 0x0166, 0xD635, 0x0143, 0xD788, 0x0124, 0xD8D4, 0x0106, 0xDA19, 0x00EB, 0xDB57, 0x00D2, 0xDC8E, 0x00BB,
+    0xDDBF, 0x00A7, 0xDEEA, 0x0094, 0xE00E, 0x0082, 0xE12E, 0x0073, 0xE247, 0x0065, 0xE35C, 0x0058, 0xE46B, 0x004C, 0xE575, 0x0042,
+    0xE67A, 0x0039, 0xE77B, 0x0031, 0xE877, 0x002A, 0xE96F, 0x0023, 0xEA63, 0x001E, 0xEB53, 0x0019, 0xEC3F, 0x0015, 0xED27, 0x0011,
+    0xEE0C, 0x000E, 0xEEED, 0x000C, 0xEFCA, 0x0009, 0xF0A5, 0x0007, 0xF17C, 0x0006, 0xF250, 0x0005, 0xF321, 0x0004, 0xF3EF, 0x0003,
+    0xF4BA, 0x0002, 0xF583, 0x0001, 0xF648, 0x0001, 0xF70C, 0x0001, 0xF7CC, 0x0001, 0xF88B, 0x0000, 0xF946, 0x0000, 0xFA00, 0x0000,
+    0xFAB7, 0x0000, 0xFB6C, 0x0000, 0xFC1F, 0x0000, 0xFCCF, 0x0000, 0xFD7E, 0x0000, 0xFE2A, 0x0000, 0xFED5, 0x0000, 0xFF7E, 0x0000,
+    // roughness row 18
+    0x01CC, 0x0406, 0x0236, 0x0527, 0x02C4, 0x0683, 0x037B, 0x0814, 0x0463, 0x09CE, 0x0580, 0x0BA3, 0x06D5, 0x0D84, 0x0863, 0x0F67,
+    0x0A2A, 0x113E, 0x0C29, 0x1300, 0x0E5D, 0x14A9, 0x10C3, 0x1631, 0x135A, 0x1799, 0x161C, 0x18DB, 0x1907, 0x19F9, 0x1C17, 0x1AF0,
+    0x1F49, 0x1BC4, 0x2298, 0x1C73, 0x2601, 0x1CFE, 0x2981, 0x1D67, 0x2D14, 0x1DB0, 0x30B7, 0x1DDB, 0x3469, 0x1DEB, 0x3824, 0x1DE1,
+    0x3BE8, 0x1DBE, 0x3FB1, 0x1D84, 0x437D, 0x1D37, 0x474B, 0x1CD7, 0x4B19, 0x1C68, 0x4EE4, 0x1BEA, 0x52AB, 0x1B5E, 0x566D, 0x1AC9,
+    0x5A2A, 0x1A2A, 0x5DE0, 0x1983, 0x618D, 0x18D6, 0x6531, 0x1822, 0x68CA, 0x176A, 0x6C58, 0x16AE, 0x6FDA, 0x15EF, 0x7350, 0x152F,
+    0x76B9, 0x146D, 0x7A15, 0x13AC, 0x7D62, 0x12EB, 0x80A2, 0x122A, 0x83D2, 0x116C, 0x86F4, 0x10AF, 0x8A07, 0x0FF5, 0x8D0B, 0x0F3E,
+    0x9000, 0x0E8A, 0x92E6, 0x0DDA, 0x95BC, 0x0D2F, 0x9884, 0x0C87, 0x9B3C, 0x0BE4, 0x9DE6, 0x0B45, 0xA080, 0x0AAB, 0xA30C, 0x0A16,
+    0xA58A, 0x0986, 0xA7F9, 0x08FB, 0xAA5A, 0x0875, 0xACAD, 0x07F4, 0xAEF2, 0x0779, 0xB12A, 0x0702, 0xB355, 0x0690, 0xB572, 0x0624,
+    0xB783, 0x05BC, 0xB98A, 0x0559, 0xBB84, 0x04FC, 0xBD74, 0x04A3, 0xBF57, 0x044E, 0xC12F, 0x03FE, 0xC2FC, 0x03B3, 0xC4BE, 0x036B,
+    0xC676, 0x0327, 0xC824, 0x02E8, 0xC9C7, 0x02AC, 0xCB61, 0x0273, 0xCCF2, 0x023F, 0xCE7A, 0x020D, 0xCFF8, 0x01DF, 0xD16F, 0x01B4,
+    0xD2DC, 0x018C, 0xD442, 0x0167, 0xD5A0, 0x0145, 0xD6F7, 0x0125, 0xD846, 0x0107, 0xD98E, 0x00EC, 0xDAD0, 0x00D3, 0xDC0A, 0x00BD,
+    0xDD3F, 0x00A8, 0xDE6D, 0x0095, 0xDF95, 0x0083, 0xE0B8, 0x0074, 0xE1D5, 0x0066, 0xE2EC, 0x0059, 0xE3FF, 0x004D, 0xE50C, 0x0043,
+    0xE615, 0x003A, 0xE719, 0x0032, 0xE818, 0x002A, 0xE914, 0x0024, 0xEA0B, 0x001E, 0xEAFD, 0x001A, 0xEBEC, 0x0015, 0xECD8, 0x0012,
+    0xEDBF, 0x000F, 0xEEA3, 0x000C, 0xEF84, 0x000A, 0xF061, 0x0008, 0xF13B, 0x0006, 0xF212, 0x0005, 0xF2E6, 0x0004, 0xF3B7, 0x0003,
+    0xF485, 0x0002, 0xF550, 0x0002, 0xF619, 0x0001, 0xF6DF, 0x0001, 0xF7A2, 0x0001, 0xF863, 0x0000, 0xF921, 0x0000, 0xF9DE, 0x0000,
+    0xFA97, 0x0000, 0xFB4F, 0x0000, 0xFC04, 0x0000, 0xFCB7, 0x0000, 0xFD68, 0x0000, 0xFE17, 0x0000, 0xFEC4, 0x0000, 0xFF70, 0x0000,
+    // roughness row 19
+    0x0234, 0x0475, 0x02A7, 0x0591, 0x033C, 0x06E1, 0x03FA, 0x0860, 0x04E6, 0x0A03, 0x0605, 0x0BBF, 0x0759, 0x0D87, 0x08E3, 0x0F50,
+    0x0AA5, 0x1111, 0x0C9C, 0x12BF, 0x0EC6, 0x1455, 0x1122, 0x15CF, 0x13AC, 0x1728, 0x1662, 0x1861, 0x193F, 0x1975, 0x1C40, 0x1A65,
+    0x1F63, 0x1B33, 0x22A3, 0x1BDF, 0x25FE, 0x1C69, 0x2970, 0x1CD3, 0x2CF5, 0x1D1D, 0x308B, 0x1D4A, 0x342E, 0x1D5C, 0x37DD, 0x1D54,
+    0x3B94, 0x1D35, 0x3F52, 0x1D01, 0x4314, 0x1CB9, 0x46D8, 0x1C5F, 0x4A9B, 0x1BF4, 0x4E5D, 0x1B7B, 0x521B, 0x1AF5, 0x55D5, 0x1A64,
+    0x5989, 0x19CA, 0x5D36, 0x1926, 0x60DB, 0x187C, 0x6477, 0x17CD, 0x680A, 0x1719, 0x6B93, 0x1662, 0x6F10, 0x15A8, 0x7281, 0x14EC,
+    0x75E6, 0x142F, 0x793D, 0x1371, 0x7C87, 0x12B4, 0x7FC4, 0x11F8, 0x82F3, 0x113D, 0x8614, 0x1084, 0x8926, 0x0FCE, 0x8C29, 0x0F1B,
+    0x8F1E, 0x0E6A, 0x9203, 0x0DBD, 0x94DA, 0x0D14, 0x97A2, 0x0C6F, 0x9A5B, 0x0BCE, 0x9D06, 0x0B32, 0x9FA2, 0x0A9A, 0xA22F, 0x0A07,
+    0xA4AE, 0x0979, 0xA71F, 0x08EF, 0xA982, 0x086B, 0xABD7, 0x07EB, 0xAE1F, 0x0771, 0xB059, 0x06FB, 0xB286, 0x068B, 0xB4A7, 0x061F,
+    0xB6BA, 0x05B8, 0xB8C2, 0x0556, 0xBABD, 0x04F8, 0xBCAC, 0x04A0, 0xBE90, 0x044B, 0xC069, 0x03FB, 0xC237, 0x03B0, 0xC3FC, 0x0368,
+    0xC5B7, 0x0325, 0xC768, 0x02E6, 0xC910, 0x02AB, 0xCAAD, 0x0273, 0xCC41, 0x023F, 0xCDCD, 0x020E, 0xCF4F, 0x01E0, 0xD0C9, 0x01B5,
+    0xD23A, 0x018D, 0xD3A4, 0x0168, 0xD506, 0x0146, 0xD660, 0x0126, 0xD7B3, 0x0109, 0xD8FE, 0x00EE, 0xDA43, 0x00D5, 0xDB82, 0x00BE,
+    0xDCB9, 0x00A9, 0xDDEB, 0x0096, 0xDF17, 0x0085, 0xE03D, 0x0075, 0xE15D, 0x0067, 0xE278, 0x005A, 0xE38E, 0x004E, 0xE49F, 0x0044,
+    0xE5AB, 0x003B, 0xE6B2, 0x0033, 0xE7B5, 0x002B, 0xE8B3, 0x0025, 0xE9AE, 0x001F, 0xEAA4, 0x001A, 0xEB96, 0x0016, 0xEC84, 0x0012,
+    0xED6F, 0x000F, 0xEE56, 0x000C, 0xEF39, 0x000A, 0xF01A, 0x0008, 0xF0F7, 0x0006, 0xF1D0, 0x0005, 0xF2A7, 0x0004, 0xF37B, 0x0003,
+    0xF44C, 0x0002, 0xF51A, 0x0002, 0xF5E6, 0x0001, 0xF6AE, 0x0001, 0xF774, 0x0001, 0xF838, 0x0000, 0xF8F9, 0x0000, 0xF9B8, 0x0000,
+    0xFA74, 0x0000, 0xFB2F, 0x0000, 0xFBE7, 0x0000, 0xFC9C, 0x0000, 0xFD50, 0x0000, 0xFE02, 0x0000, 0xFEB1, 0x0000, 0xFF5F, 0x0000,
+    // roughness row 20
+    0x02AA, 0x04E5, 0x0326, 0x05FC, 0x03C3, 0x0740, 0x0487, 0x08AE, 0x0578, 0x0A3C, 0x0698, 0x0BE0, 0x07EC, 0x0D8F, 0x0973, 0x0F3F,
+    0x0B2F, 0x10E8, 0x0D1F, 0x1283, 0x0F40, 0x1407, 0x1191, 0x1570, 0x140F, 0x16BC, 0x16B8, 0x17E8, 0x1987, 0x18F3, 0x1C7B, 0x19DE,
+    0x1F8F, 0x1AA5, 0x22C0, 0x1B4C, 0x260B, 0x1BD3, 0x296E, 0x1C3B, 0x2CE5, 0x1C87, 0x306D, 0x1CB7, 0x3402, 0x1CCB, 0x37A3, 0x1CC6,
+    0x3B4E, 0x1CAB, 0x3EFF, 0x1C7A, 0x42B4, 0x1C36, 0x466D, 0x1BE2, 0x4A27, 0x1B7D, 0x4DDF, 0x1B09, 0x5195, 0x1A89, 0x5546, 0x19FD,
+    0x58F1, 0x1967, 0x5C97, 0x18C9, 0x6034, 0x1824, 0x63C9, 0x1779, 0x6754, 0x16C9, 0x6AD5, 0x1615, 0x6E4B, 0x155F, 0x71B6, 0x14A7,
+    0x7517, 0x13EE, 0x786B, 0x1335, 0x7BB2, 0x127C, 0x7EEB, 0x11C4, 0x8216, 0x110D, 0x8534, 0x1057, 0x8843, 0x0FA4, 0x8B45, 0x0EF4,
+    0x8E39, 0x0E47, 0x911E, 0x0D9D, 0x93F5, 0x0CF7, 0x96BD, 0x0C55, 0x9977, 0x0BB7, 0x9C22, 0x0B1D, 0x9EBF, 0x0A87, 0xA14E, 0x09F6,
+    0xA3CF, 0x096A, 0xA641, 0x08E2, 0xA8A6, 0x085F, 0xAAFD, 0x07E2, 0xAD47, 0x0768, 0xAF84, 0x06F4, 0xB1B3, 0x0685, 0xB3D6, 0x061A,
+    0xB5EC, 0x05B4, 0xB7F6, 0x0553, 0xB9F5, 0x04F6, 0xBBE7, 0x049E, 0xBDCE, 0x044A, 0xBFAA, 0x03FA, 0xC17B, 0x03AF, 0xC341, 0x0368,
+    0xC4FD, 0x0325, 0xC6AE, 0x02E6, 0xC856, 0x02AA, 0xC9F5, 0x0272, 0xCB8A, 0x023E, 0xCD17, 0x020D, 0xCE9E, 0x01E0, 0xD01B, 0x01B5,
+    0xD191, 0x018E, 0xD2FE, 0x0169, 0xD463, 0x0147, 0xD5C1, 0x0127, 0xD718, 0x010A, 0xD867, 0x00EF, 0xD9B0, 0x00D6, 0xDAF2, 0x00BF,
+    0xDC2E, 0x00AB, 0xDD63, 0x0098, 0xDE92, 0x0086, 0xDFBC, 0x0076, 0xE0E0, 0x0068, 0xE1FF, 0x005B, 0xE318, 0x0050, 0xE42C, 0x0045,
+    0xE53C, 0x003C, 0xE646, 0x0034, 0xE74C, 0x002C, 0xE84E, 0x0026, 0xE94B, 0x0020, 0xEA45, 0x001B, 0xEB3A, 0x0017, 0xEC2C, 0x0013,
+    0xED19, 0x0010, 0xEE04, 0x000D, 0xEEEA, 0x000A, 0xEFCE, 0x0008, 0xF0AE, 0x0007, 0xF18B, 0x0005, 0xF264, 0x0004, 0xF33B, 0x0003,
+    0xF40F, 0x0002, 0xF4E0, 0x0002, 0xF5AE, 0x0001, 0xF67A, 0x0001, 0xF743, 0x0001, 0xF809, 0x0000, 0xF8CD, 0x0000, 0xF98F, 0x0000,
+    0xFA4E, 0x0000, 0xFB0B, 0x0000, 0xFBC5, 0x0000, 0xFC7E, 0x0000, 0xFD34, 0x0000, 0xFDE8, 0x0000, 0xFE9B, 0x0000, 0xFF4B, 0x0000,
+    // roughness row 21
+    0x032E, 0x0555, 0x03B3, 0x0667, 0x0458, 0x07A0, 0x0523, 0x08FD, 0x0618, 0x0A76, 0x073A, 0x0C02, 0x088D, 0x0D9A, 0x0A12, 0x0F33,
+    0x0BC9, 0x10C5, 0x0DB1, 0x124A, 0x0FCA, 0x13BD, 0x1211, 0x1516, 0x1483, 0x1653, 0x171F, 0x1774, 0x19E1, 0x1875, 0x1CC6, 0x1956,
+    0x1FCB, 0x1A19, 0x22EE, 0x1ABC, 0x2629, 0x1B3E, 0x297C, 0x1BA5, 0x2CE3, 0x1BEF, 0x305C, 0x1C1F, 0x33E4, 0x1C36, 0x3778, 0x1C36,
+    0x3B15, 0x1C1E, 0x3EB9, 0x1BF1, 0x4262, 0x1BB1, 0x460F, 0x1B61, 0x49BC, 0x1B00, 0x4D6A, 0x1A92, 0x5116, 0x1A18, 0x54BF, 0x1992,
+    0x5862, 0x1902, 0x5BFF, 0x1869, 0x5F95, 0x17C9, 0x6322, 0x1723, 0x66A7, 0x1678, 0x6A22, 0x15C9, 0x6D93, 0x1517, 0x70F7, 0x1463,
+    0x7450, 0x13AD, 0x779E, 0x12F7, 0x7ADF, 0x1241, 0x7E13, 0x118C, 0x813C, 0x10D9, 0x8458, 0x1028, 0x8765, 0x0F79, 0x8A65, 0x0ECC,
+    0x8D56, 0x0E22, 0x903A, 0x0D7B, 0x930F, 0x0CD7, 0x95D5, 0x0C38, 0x988F, 0x0B9C, 0x9B3B, 0x0B05, 0x9DD9, 0x0A72, 0xA068, 0x09E3,
+    0xA2EA, 0x0959, 0xA55E, 0x08D4, 0xA7C5, 0x0853, 0xAA1E, 0x07D6, 0xAC6A, 0x075F, 0xAEA9, 0x06EC, 0xB0DB, 0x067E, 0xB300, 0x0614,
+    0xB519, 0x05AF, 0xB726, 0x054F, 0xB927, 0x04F3, 0xBB1C, 0x049C, 0xBD06, 0x0448, 0xBEE5, 0x03FA, 0xC0B9, 0x03AF, 0xC282, 0x0368,
+    0xC441, 0x0325, 0xC5F6, 0x02E7, 0xC7A1, 0x02AB, 0xC943, 0x0274, 0xCADB, 0x023F, 0xCC6A, 0x020E, 0xCDF1, 0x01E1, 0xCF6F, 0x01B6,
+    0xD0E5, 0x018E, 0xD253, 0x0169, 0xD3B9, 0x0147, 0xD51A, 0x0127, 0xD674, 0x010A, 0xD7C8, 0x00F0, 0xD914, 0x00D7, 0xDA5A, 0x00C0,
+    0xDB9A, 0x00AC, 0xDCD3, 0x0099, 0xDE06, 0x0087, 0xDF34, 0x0078, 0xE05B, 0x0069, 0xE17E, 0x005C, 0xE29A, 0x0051, 0xE3B2, 0x0046,
+    0xE4C5, 0x003D, 0xE5D4, 0x0035, 0xE6DD, 0x002D, 0xE7E2, 0x0027, 0xE8E3, 0x0021, 0xE9E0, 0x001C, 0xEAD9, 0x0017, 0xEBCD, 0x0013,
+    0xECBE, 0x0010, 0xEDAC, 0x000D, 0xEE96, 0x000B, 0xEF7C, 0x0009, 0xF05F, 0x0007, 0xF13F, 0x0006, 0xF21C, 0x0004, 0xF2F6, 0x0003,
+    0xF3CD, 0x0003, 0xF4A1, 0x0002, 0xF572, 0x0002, 0xF641, 0x0001, 0xF70C, 0x0001, 0xF7D6, 0x0001, 0xF89D, 0x0000, 0xF961, 0x0000,
+    0xFA23, 0x0000, 0xFAE2, 0x0000, 0xFBA0, 0x0000, 0xFC5B, 0x0000, 0xFD14, 0x0000, 0xFDCB, 0x0000, 0xFE80, 0x0000, 0xFF33, 0x0000,
+    // roughness row 22
+    0x03C2, 0x05C6, 0x044F, 0x06D1, 0x04FC, 0x07FF, 0x05CD, 0x094C, 0x06C6, 0x0AB1, 0x07EB, 0x0C28, 0x093E, 0x0DA8, 0x0AC1, 0x0F2A,
+    0x0C73, 0x10A6, 0x0E54, 0x1215, 0x1064, 0x1375, 0x12A1, 0x14BF, 0x1508, 0x15EE, 0x1797, 0x1701, 0x1A4B, 0x17F9, 0x1D22, 0x18D2,
+    0x2018, 0x198D, 0x232B, 0x1A2B, 0x2659, 0x1AAD, 0x299C, 0x1B11, 0x2CF3, 0x1B59, 0x305D, 0x1B89, 0x33D5, 0x1BA0, 0x375A, 0x1BA1,
+    0x3AE9, 0x1B8D, 0x3E80, 0x1B65, 0x421D, 0x1B2A, 0x45BC, 0x1ADD, 0x495E, 0x1A82, 0x4D00, 0x1A19, 0x50A1, 0x19A3, 0x543F, 0x1921,
+    0x57D9, 0x1898, 0x5B6E, 0x1805, 0x5EFC, 0x176B, 0x6283, 0x16CB, 0x6600, 0x1625, 0x6975, 0x157A, 0x6CDE, 0x14CD, 0x703E, 0x141D,
+    0x7393, 0x136C, 0x76DC, 0x12BB, 0x7A18, 0x1208, 0x7D47, 0x1157, 0x8069, 0x10A6, 0x8380, 0x0FF7, 0x8688, 0x0F4B, 0x8984, 0x0EA1,
+    0x8C74, 0x0DFA, 0x8F57, 0x0D57, 0x922B, 0x0CB7, 0x94F1, 0x0C1A, 0x97AA, 0x0B81, 0x9A54, 0x0AEC, 0x9CF1, 0x0A5B, 0x9F80, 0x09CE,
+    0xA201, 0x0946, 0xA476, 0x08C3, 0xA6DE, 0x0844, 0xA939, 0x07CA, 0xAB87, 0x0754, 0xADC8, 0x06E2, 0xAFFC, 0x0676, 0xB223, 0x060D,
+    0xB43F, 0x05AA, 0xB64E, 0x054A, 0xB852, 0x04F0, 0xBA4A, 0x0499, 0xBC37, 0x0447, 0xBE19, 0x03F8, 0xBFF0, 0x03AE, 0xC1BC, 0x0368,
+    0xC37F, 0x0326, 0xC537, 0x02E7, 0xC6E5, 0x02AC, 0xC88A, 0x0275, 0xCA26, 0x0241, 0xCBB9, 0x0210, 0xCD43, 0x01E3, 0xCEC4, 0x01B8,
+    0xD03D, 0x0190, 0xD1AF, 0x016B, 0xD318, 0x0149, 0xD47A, 0x0129, 0xD5D5, 0x010C, 0xD729, 0x00F1, 0xD876, 0x00D8, 0xD9BC, 0x00C1,
+    0xDAFC, 0x00AC, 0xDC38, 0x0099, 0xDD70, 0x0088, 0xDEA1, 0x0078, 0xDFCD, 0x006A, 0xE0F3, 0x005D, 0xE214, 0x0052, 0xE330, 0x0047,
+    0xE447, 0x003E, 0xE559, 0x0036, 0xE666, 0x002E, 0xE76F, 0x0028, 0xE873, 0x0022, 0xE973, 0x001D, 0xEA70, 0x0018, 0xEB68, 0x0014,
+    0xEC5C, 0x0011, 0xED4D, 0x000E, 0xEE3A, 0x000B, 0xEF24, 0x0009, 0xF00A, 0x0008, 0xF0EE, 0x0006, 0xF1CE, 0x0005, 0xF2AB, 0x0004,
+    0xF385, 0x0003, 0xF45C, 0x0002, 0xF530, 0x0002, 0xF601, 0x0001, 0xF6D0, 0x0001, 0xF79C, 0x0001, 0xF866, 0x0001, 0xF92D, 0x0000,
+    0xF9F2, 0x0000, 0xFAB5, 0x0000, 0xFB75, 0x0000, 0xFC33, 0x0000, 0xFCEE, 0x0000, 0xFDA8, 0x0000, 0xFE60, 0x0000, 0xFF16, 0x0000,
+    // roughness row 23
+    0x0464, 0x0636, 0x04FA, 0x073A, 0x05AF, 0x085D, 0x0686, 0x099A, 0x0784, 0x0AED, 0x08AB, 0x0C4F, 0x09FE, 0x0DB8, 0x0B7E, 0x0F24,
+    0x0D2C, 0x108A, 0x0F07, 0x11E5, 0x110E, 0x1331, 0x1341, 0x146A, 0x159D, 0x158C, 0x1820, 0x1694, 0x1AC7, 0x177F, 0x1D8F, 0x1850,
+    0x2077, 0x1905, 0x237B, 0x199D, 0x2698, 0x1A19, 0x29CC, 0x1A7C, 0x2D15, 0x1AC5, 0x306E, 0x1AF3, 0x33D6, 0x1B0B, 0x374C, 0x1B0D,
+    0x3ACB, 0x1AFA, 0x3E54, 0x1AD6, 0x41E3, 0x1A9E, 0x4576, 0x1A58, 0x490C, 0x1A01, 0x4CA2, 0x199C, 0x5037, 0x192B, 0x53CA, 0x18B0,
+    0x575A, 0x182A, 0x5AE5, 0x179C, 0x5E69, 0x1707, 0x61E8, 0x166D, 0x655F, 0x15CD, 0x68CD, 0x1528, 0x6C31, 0x1480, 0x6F8B, 0x13D6,
+    0x72D9, 0x1329, 0x761C, 0x127B, 0x7954, 0x11CD, 0x7C80, 0x1120, 0x7F9F, 0x1074, 0x82B1, 0x0FC8, 0x85B6, 0x0F1F, 0x88AE, 0x0E77,
+    0x8B99, 0x0DD3, 0x8E77, 0x0D32, 0x9147, 0x0C94, 0x940A, 0x0BF9, 0x96C2, 0x0B63, 0x996C, 0x0AD1, 0x9C09, 0x0A43, 0x9E99, 0x09B9,
+    0xA11B, 0x0933, 0xA38F, 0x08B2, 0xA5F7, 0x0834, 0xA851, 0x07BB, 0xAA9F, 0x0747, 0xACDF, 0x06D7, 0xAF15, 0x066C, 0xB140, 0x0605,
+    0xB35D, 0x05A3, 0xB56F, 0x0545, 0xB776, 0x04EB, 0xB971, 0x0495, 0xBB61, 0x0444, 0xBD45, 0x03F6, 0xBF1F, 0x03AD, 0xC0EF, 0x0367,
+    0xC2B4, 0x0326, 0xC470, 0x02E8, 0xC622, 0x02AD, 0xC7CA, 0x0276, 0xC969, 0x0242, 0xCAFF, 0x0212, 0xCC8C, 0x01E4, 0xCE11, 0x01BA,
+    0xCF8E, 0x0192, 0xD103, 0x016E, 0xD270, 0x014B, 0xD3D5, 0x012C, 0xD534, 0x010E, 0xD68B, 0x00F3, 0xD7DB, 0x00DA, 0xD925, 0x00C3,
+    0xDA68, 0x00AE, 0xDBA5, 0x009B, 0xDCDC, 0x0089, 0xDE0D, 0x0079, 0xDF39, 0x006B, 0xE05F, 0x005E, 0xE181, 0x0052, 0xE2A2, 0x0048,
+    0xE3BC, 0x003F, 0xE4D3, 0x0036, 0xE5E4, 0x002F, 0xE6F1, 0x0028, 0xE7F9, 0x0022, 0xE8FD, 0x001D, 0xE9FD, 0x0019, 0xEAF9, 0x0015,
+    0xEBF1, 0x0011, 0xECE5, 0x000F, 0xEDD6, 0x000C, 0xEEC3, 0x000A, 0xEFAD, 0x0008, 0xF094, 0x0006, 0xF177, 0x0005, 0xF257, 0x0004,
+    0xF334, 0x0003, 0xF40F, 0x0003, 0xF4E6, 0x0002, 0xF5BB, 0x0002, 0xF68D, 0x0001, 0xF75C, 0x0001, 0xF829, 0x0001, 0xF8F3, 0x0000,
+    0xF9BB, 0x0000, 0xFA80, 0x0000, 0xFB43, 0x0000, 0xFC04, 0x0000, 0xFCC2, 0x0000, 0xFD7F, 0x0000, 0xFE3A, 0x0000, 0xFEF3, 0x0000,
+    // roughness row 24
+    0x0516, 0x06A5, 0x05B5, 0x07A2, 0x0670, 0x08B9, 0x074E, 0x09E8, 0x0850, 0x0B29, 0x097A, 0x0C76, 0x0ACD, 0x0DCB, 0x0C4B, 0x0F21,
+    0x0DF5, 0x1071, 0x0FCA, 0x11B9, 0x11C9, 0x12F2, 0x13F2, 0x1419, 0x1643, 0x152C, 0x18B9, 0x1628, 0x1B53, 0x170A, 0x1E0D, 0x17D0,
+    0x20E6, 0x187E, 0x23DB, 0x1911, 0x26E9, 0x198A, 0x2A0D, 0x19E8, 0x2D44, 0x1A2E, 0x308F, 0x1A5F, 0x33E8, 0x1A77, 0x374E, 0x1A79,
+    0x3ABE, 0x1A68, 0x3E37, 0x1A45, 0x41B7, 0x1A11, 0x453D, 0x19CE, 0x48C5, 0x197C, 0x4C4F, 0x191C, 0x4FD9, 0x18B1, 0x5361, 0x183B,
+    0x56E5, 0x17BA, 0x5A66, 0x1732, 0x5DE1, 0x16A2, 0x6156, 0x160C, 0x64C3, 0x1570, 0x6829, 0x14D1, 0x6B86, 0x142F, 0x6EDA, 0x138A,
+    0x7224, 0x12E2, 0x7562, 0x123A, 0x7895, 0x1190, 0x7BBC, 0x10E7, 0x7ED6, 0x103E, 0x81E4, 0x0F97, 0x84E7, 0x0EF1, 0x87DC, 0x0E4E,
+    0x8AC4, 0x0DAD, 0x8D9F, 0x0D0E, 0x906D, 0x0C73, 0x932D, 0x0BDA, 0x95E0, 0x0B46, 0x9887, 0x0AB6, 0x9B21, 0x0A29, 0x9DAD, 0x09A0,
+    0xA02F, 0x091D, 0xA2A4, 0x089E, 0xA50D, 0x0823, 0xA768, 0x07AC, 0xA9B8, 0x073A, 0xABFA, 0x06CB, 0xAE30, 0x0662, 0xB05A, 0x05FC,
+    0xB278, 0x059A, 0xB48A, 0x053D, 0xB691, 0x04E4, 0xB88E, 0x0490, 0xBA81, 0x043F, 0xBC68, 0x03F3, 0xBE45, 0x03AB, 0xC018, 0x0366,
+    0xC1E1, 0x0325, 0xC39F, 0x02E7, 0xC554, 0x02AD, 0xC700, 0x0277, 0xC8A2, 0x0243, 0xCA3C, 0x0213, 0xCBCD, 0x01E6, 0xCD55, 0x01BC,
+    0xCED5, 0x0194, 0xD04E, 0x0170, 0xD1BE, 0x014D, 0xD327, 0x012E, 0xD489, 0x0110, 0xD5E4, 0x00F5, 0xD737, 0x00DC, 0xD885, 0x00C5,
+    0xD9CB, 0x00B0, 0xDB0C, 0x009D, 0xDC46, 0x008B, 0xDD7B, 0x007B, 0xDEAA, 0x006D, 0xDFD4, 0x0060, 0xE0F8, 0x0054, 0xE217, 0x0049,
+    0xE332, 0x003F, 0xE447, 0x0037, 0xE558, 0x002F, 0xE664, 0x0028, 0xE771, 0x0023, 0xE879, 0x001E, 0xE97E, 0x0019, 0xEA7E, 0x0015,
+    0xEB7A, 0x0012, 0xEC72, 0x000F, 0xED67, 0x000D, 0xEE57, 0x000A, 0xEF45, 0x0008, 0xF02F, 0x0007, 0xF116, 0x0006, 0xF1FA, 0x0005,
+    0xF2DA, 0x0004, 0xF3B8, 0x0003, 0xF493, 0x0002, 0xF56A, 0x0002, 0xF640, 0x0001, 0xF712, 0x0001, 0xF7E2, 0x0001, 0xF8AF, 0x0001,
+    0xF97A, 0x0000, 0xFA42, 0x0000, 0xFB08, 0x0000, 0xFBCC, 0x0000, 0xFC8E, 0x0000, 0xFD4D, 0x0000, 0xFE0B, 0x0000, 0xFEC7, 0x0000,
+    // roughness row 25
+    0x05D8, 0x0712, 0x067E, 0x0807, 0x0741, 0x0914, 0x0824, 0x0A34, 0x092B, 0x0B64, 0x0A57, 0x0C9F, 0x0BAA, 0x0DDF, 0x0D27, 0x0F1F,
+    0x0ECD, 0x105D, 0x109C, 0x1190, 0x1294, 0x12B7, 0x14B3, 0x13CD, 0x16F8, 0x14D0, 0x1963, 0x15BE, 0x1BF0, 0x1697, 0x1E9C, 0x1755,
+    0x2166, 0x17FA, 0x244B, 0x1886, 0x2749, 0x18FB, 0x2A5E, 0x1957, 0x2D86, 0x199C, 0x30C0, 0x19C9, 0x3409, 0x19E1, 0x3760, 0x19E7,
+    0x3AC1, 0x19D8, 0x3E2B, 0x19B6, 0x419B, 0x1984, 0x4512, 0x1943, 0x488C, 0x18F4, 0x4C08, 0x1899, 0x4F85, 0x1833, 0x5301, 0x17C2,
+    0x567B, 0x1747, 0x59F1, 0x16C4, 0x5D62, 0x1639, 0x60CD, 0x15A8, 0x6431, 0x1512, 0x678E, 0x1478, 0x6AE3, 0x13DA, 0x6E2E, 0x1339,
+    0x7170, 0x1296, 0x74A9, 0x11F3, 0x77D7, 0x114F, 0x7AFA, 0x10AB, 0x7E11, 0x1007, 0x811B, 0x0F64, 0x8419, 0x0EC2, 0x870B, 0x0E21,
+    0x89EF, 0x0D83, 0x8CC8, 0x0CE8, 0x8F94, 0x0C50, 0x9253, 0x0BBB, 0x9505, 0x0B2A, 0x97A9, 0x0A9B, 0x9A41, 0x0A11, 0x9CCB, 0x098A,
+    0x9F49, 0x0908, 0xA1BC, 0x088A, 0xA421, 0x0810, 0xA67A, 0x079A, 0xA8C8, 0x0729, 0xAB0C, 0x06BD, 0xAD44, 0x0655, 0xAF70, 0x05F1,
+    0xB190, 0x0592, 0xB3A4, 0x0536, 0xB5AD, 0x04DE, 0xB7AB, 0x048B, 0xB99E, 0x043B, 0xBB86, 0x03EF, 0xBD64, 0x03A7, 0xBF37, 0x0363,
+    0xC101, 0x0322, 0xC2C3, 0x02E5, 0xC47C, 0x02AC, 0xC62B, 0x0276, 0xC7D0, 0x0243, 0xC96D, 0x0214, 0xCB02, 0x01E7, 0xCC8D, 0x01BD,
+    0xCE11, 0x0196, 0xCF8D, 0x0171, 0xD101, 0x014F, 0xD26D, 0x0130, 0xD3D3, 0x0112, 0xD531, 0x00F7, 0xD688, 0x00DE, 0xD7D9, 0x00C7,
+    0xD923, 0x00B2, 0xDA67, 0x009F, 0xDBA5, 0x008D, 0xDCDD, 0x007D, 0xDE10, 0x006F, 0xDF3D, 0x0061, 0xE065, 0x0055, 0xE187, 0x004B,
+    0xE2A5, 0x0041, 0xE3BE, 0x0038, 0xE4D2, 0x0030, 0xE5E1, 0x002A, 0xE6ED, 0x0024, 0xE7F4, 0x001E, 0xE8F7, 0x001A, 0xE9F6, 0x0015,
+    0xEAF1, 0x0012, 0xEBEE, 0x000F, 0xECE7, 0x000D, 0xEDDC, 0x000B, 0xEECE, 0x0009, 0xEFBC, 0x0007, 0xF0A6, 0x0006, 0xF18E, 0x0005,
+    0xF272, 0x0004, 0xF353, 0x0003, 0xF432, 0x0002, 0xF50D, 0x0002, 0xF5E6, 0x0002, 0xF6BB, 0x0001, 0xF78E, 0x0001, 0xF85F, 0x0001,
+    0xF92D, 0x0001, 0xF9F9, 0x0000, 0xFAC2, 0x0000, 0xFB89, 0x0000, 0xFC4D, 0x0000, 0xFD10, 0x0000, 0xFDD1, 0x0000, 0xFE90, 0x0000,
+    // roughness row 26
+    0x06AA, 0x077C, 0x0757, 0x086A, 0x0821, 0x096C, 0x090A, 0x0A7E, 0x0A14, 0x0B9D, 0x0B42, 0x0CC6, 0x0C96, 0x0DF3, 0x0E11, 0x0F20,
+    0x0FB3, 0x1049, 0x117D, 0x116A, 0x136D, 0x1280, 0x1584, 0x1386, 0x17BE, 0x1479, 0x1A1D, 0x1559, 0x1C9C, 0x1626, 0x1F3C, 0x16DD,
+    0x21F7, 0x177B, 0x24CE, 0x1801, 0x27BB, 0x186E, 0x2AC0, 0x18C8, 0x2DD9, 0x190A, 0x3103, 0x1937, 0x343C, 0x194F, 0x3782, 0x1953,
+    0x3AD3, 0x1945, 0x3E2F, 0x1928, 0x4191, 0x18F9, 0x44F8, 0x18BA, 0x4863, 0x186E, 0x4BD1, 0x1816, 0x4F40, 0x17B3, 0x52AF, 0x1746,
+    0x561C, 0x16D1, 0x5986, 0x1653, 0x5CED, 0x15CE, 0x604E, 0x1543, 0x63A9, 0x14B2, 0x66FC, 0x141C, 0x6A48, 0x1383, 0x6D8B, 0x12E7,
+    0x70C6, 0x1249, 0x73F7, 0x11AA, 0x771D, 0x110A, 0x7A39, 0x106A, 0x7D4B, 0x0FCA, 0x8051, 0x0F2C, 0x834C, 0x0E8F, 0x863A, 0x0DF3,
+    0x891C, 0x0D59, 0x8BF2, 0x0CC1, 0x8EBA, 0x0C2C, 0x9176, 0x0B99, 0x9425, 0x0B0A, 0x96C9, 0x0A7F, 0x9960, 0x09F8, 0x9BEA, 0x0974,
+    0x9E67, 0x08F3, 0xA0D8, 0x0877, 0xA33C, 0x07FF, 0xA594, 0x078A, 0xA7E0, 0x071B, 0xAA21, 0x06AF, 0xAC56, 0x0648, 0xAE7F, 0x05E5,
+    0xB09E, 0x0586, 0xB2B3, 0x052C, 0xB4BF, 0x04D5, 0xB6BF, 0x0483, 0xB8B4, 0x0435, 0xBA9F, 0x03EA, 0xBC7F, 0x03A3, 0xBE55, 0x0360,
+    0xC021, 0x0320, 0xC1E3, 0x02E3, 0xC39C, 0x02AA, 0xC54C, 0x0274, 0xC6F2, 0x0242, 0xC890, 0x0212, 0xCA28, 0x01E6, 0xCBB7, 0x01BD,
+    0xCD3E, 0x0196, 0xCEBD, 0x0172, 0xD035, 0x0150, 0xD1A5, 0x0131, 0xD30E, 0x0114, 0xD46F, 0x00F9, 0xD5CA, 0x00E0, 0xD71E, 0x00C9,
+    0xD86C, 0x00B4, 0xD9B4, 0x00A1, 0xDAF5, 0x008F, 0xDC31, 0x007F, 0xDD67, 0x0070, 0xDE97, 0x0063, 0xDFC2, 0x0057, 0xE0E8, 0x004C,
+    0xE209, 0x0042, 0xE325, 0x0039, 0xE43C, 0x0032, 0xE54F, 0x002B, 0xE65E, 0x0024, 0xE768, 0x001F, 0xE86E, 0x001A, 0xE970, 0x0016,
+    0xEA6E, 0x0013, 0xEB69, 0x000F, 0xEC5F, 0x000D, 0xED53, 0x000A, 0xEE43, 0x0008, 0xEF32, 0x0007, 0xF022, 0x0006, 0xF10D, 0x0005,
+    0xF1F6, 0x0004, 0xF2DB, 0x0003, 0xF3BD, 0x0003, 0xF49C, 0x0002, 0xF579, 0x0002, 0xF652, 0x0001, 0xF729, 0x0001, 0xF7FD, 0x0001,
+    0xF8CE, 0x0001, 0xF99D, 0x0000, 0xFA69, 0x0000, 0xFB33, 0x0000, 0xFBFB, 0x0000, 0xFCC1, 0x0000, 0xFD85, 0x0000, 0xFE47, 0x0000,
+    // roughness row 27
+    0x078B, 0x07E4, 0x0840, 0x08CA, 0x0910, 0x09C1, 0x09FE, 0x0AC5, 0x0B0C, 0x0BD5, 0x0C3C, 0x0CED, 0x0D91, 0x0E08, 0x0F0A, 0x0F22,
+    0x10A8, 0x1038, 0x126D, 0x1147, 0x1456, 0x124A, 0x1664, 0x1341, 0x1895, 0x1427, 0x1AE7, 0x14F9, 0x1D59, 0x15B9, 0x1FEB, 0x1665,
+    0x2299, 0x16FE, 0x2560, 0x177E, 0x283F, 0x17E8, 0x2B33, 0x183B, 0x2E3C, 0x187A, 0x3156, 0x18A7, 0x3480, 0x18BE, 0x37B6, 0x18C4,
+    0x3AF8, 0x18B7, 0x3E42, 0x1899, 0x4196, 0x186D, 0x44EF, 0x1833, 0x484D, 0x17EB, 0x4BAC, 0x1796, 0x4F0C, 0x1736, 0x526D, 0x16CD,
+    0x55CE, 0x165C, 0x592C, 0x15E2, 0x5C87, 0x1562, 0x5FDD, 0x14DC, 0x632E, 0x1450, 0x6679, 0x13C0, 0x69BC, 0x132D, 0x6CF7, 0x1296,
+    0x702A, 0x11FC, 0x7353, 0x1162, 0x7673, 0x10C6, 0x7989, 0x102B, 0x7C94, 0x0F8F, 0x7F94, 0x0EF4, 0x8289, 0x0E5A, 0x8574, 0x0DC3,
+    0x8853, 0x0D2D, 0x8B26, 0x0C99, 0x8DED, 0x0C08, 0x90A7, 0x0B79, 0x9355, 0x0AED, 0x95F6, 0x0A64, 0x988B, 0x09DF, 0x9B13, 0x095D,
+    0x9D8F, 0x08DF, 0xA000, 0x0865, 0xA265, 0x07EF, 0xA4BD, 0x077D, 0xA709, 0x070F, 0xA949, 0x06A4, 0xAB7E, 0x063E, 0xADA6, 0x05DC,
+    0xAFC4, 0x057E, 0xB1D9, 0x0524, 0xB3E1, 0x04CE, 0xB5DF, 0x047C, 0xB7D2, 0x042E, 0xB9BD, 0x03E4, 0xBBA0, 0x039F, 0xBD79, 0x035C,
+    0xBF48, 0x031D, 0xC10E, 0x02E2, 0xC2CA, 0x02A9, 0xC47C, 0x0274, 0xC626, 0x0242, 0xC7C7, 0x0213, 0xC95F, 0x01E7, 0xCAEF, 0x01BD,
+    0xCC77, 0x0197, 0xCDF7, 0x0172, 0xCF6F, 0x0151, 0xD0E2, 0x0132, 0xD24F, 0x0115, 0xD3B4, 0x00FA, 0xD513, 0x00E1, 0xD66B, 0x00CB,
+    0xD7BC, 0x00B6, 0xD907, 0x00A2, 0xDA4C, 0x0091, 0xDB8C, 0x0081, 0xDCC5, 0x0072, 0xDDF9, 0x0065, 0xDF28, 0x0058, 0xE051, 0x004E,
+    0xE175, 0x0044, 0xE295, 0x003B, 0xE3B0, 0x0033, 0xE4C6, 0x002C, 0xE5D8, 0x0026, 0xE6E5, 0x0020, 0xE7EE, 0x001B, 0xE8F4, 0x0017,
+    0xE9F5, 0x0013, 0xEAF3, 0x0010, 0xEBEC, 0x000D, 0xECE3, 0x000B, 0xEDD6, 0x0009, 0xEEC5, 0x0007, 0xEFB1, 0x0006, 0xF09A, 0x0005,
+    0xF180, 0x0004, 0xF266, 0x0003, 0xF34D, 0x0002, 0xF430, 0x0002, 0xF511, 0x0002, 0xF5EE, 0x0001, 0xF6C9, 0x0001, 0xF7A0, 0x0001,
+    0xF875, 0x0001, 0xF948, 0x0001, 0xFA17, 0x0000, 0xFAE5, 0x0000, 0xFBB0, 0x0000, 0xFC79, 0x0000, 0xFD3F, 0x0000, 0xFE05, 0x0000,
+    // roughness row 28
+    0x087C, 0x084A, 0x0937, 0x0927, 0x0A0D, 0x0A13, 0x0B00, 0x0B0A, 0x0C12, 0x0C0B, 0x0D44, 0x0D11, 0x0E99, 0x0E1C, 0x1011, 0x0F24,
+    0x11AC, 0x1028, 0x136B, 0x1125, 0x154D, 0x1219, 0x1752, 0x12FE, 0x1979, 0x13D7, 0x1BC0, 0x149D, 0x1E26, 0x1551, 0x20AA, 0x15F2,
+    0x2349, 0x1681, 0x2602, 0x16FC, 0x28D2, 0x1762, 0x2BB8, 0x17B2, 0x2EB0, 0x17EE, 0x31B9, 0x1817, 0x34D3, 0x182F, 0x37F9, 0x1834,
+    0x3B2B, 0x1829, 0x3E67, 0x180E, 0x41AA, 0x17E2, 0x44F3, 0x17AA, 0x4842, 0x1766, 0x4B95, 0x1716, 0x4EE8, 0x16BB, 0x523B, 0x1655,
+    0x558D, 0x15E6, 0x58DE, 0x1571, 0x5C2D, 0x14F5, 0x5F77, 0x1473, 0x62BE, 0x13ED, 0x65FF, 0x1362, 0x6938, 0x12D3, 0x6C6B, 0x1242,
+    0x6F96, 0x11AE, 0x72B7, 0x1118, 0x75D0, 0x1081, 0x78DE, 0x0FE9, 0x7BE3, 0x0F52, 0x7EDE, 0x0EBB, 0x81CE, 0x0E26, 0x84B3, 0x0D91,
+    0x878D, 0x0CFF, 0x8A5B, 0x0C6E, 0x8D1E, 0x0BE0, 0x8FD7, 0x0B55, 0x9283, 0x0ACD, 0x9523, 0x0A48, 0x97B7, 0x09C5, 0x9A3F, 0x0946,
+    0x9CBA, 0x08CB, 0x9F29, 0x0853, 0xA18C, 0x07DE, 0xA3E3, 0x076E, 0xA630, 0x0701, 0xA871, 0x0699, 0xAAA7, 0x0635, 0xACD1, 0x05D4,
+    0xAEF0, 0x0577, 0xB104, 0x051E, 0xB30D, 0x04C9, 0xB50B, 0x0478, 0xB6FF, 0x042A, 0xB8EA, 0x03E1, 0xBACB, 0x039B, 0xBCA2, 0x0359,
+    0xBE6F, 0x031A, 0xC034, 0x02DF, 0xC1F1, 0x02A7, 0xC3A7, 0x0273, 0xC555, 0x0242, 0xC6F9, 0x0213, 0xC895, 0x01E7, 0xCA29, 0x01BE,
+    0xCBB4, 0x0198, 0xCD38, 0x0174, 0xCEB4, 0x0153, 0xD028, 0x0133, 0xD196, 0x0117, 0xD2FC, 0x00FC, 0xD45B, 0x00E3, 0xD5B4, 0x00CC,
+    0xD707, 0x00B7, 0xD857, 0x00A4, 0xD9A0, 0x0092, 0xDAE3, 0x0082, 0xDC21, 0x0074, 0xDD59, 0x0066, 0xDE8B, 0x005A, 0xDFB9, 0x004F,
+    0xE0E1, 0x0045, 0xE204, 0x003C, 0xE323, 0x0034, 0xE43D, 0x002D, 0xE552, 0x0027, 0xE663, 0x0021, 0xE770, 0x001D, 0xE879, 0x0018,
+    0xE97E, 0x0014, 0xEA7F, 0x0011, 0xEB7C, 0x000E, 0xEC76, 0x000C, 0xED6C, 0x000A, 0xEE5F, 0x0008, 0xEF4E, 0x0006, 0xF03B, 0x0005,
+    0xF124, 0x0004, 0xF20A, 0x0003, 0xF2EC, 0x0003, 0xF3CC, 0x0002, 0xF4AA, 0x0002, 0xF58B, 0x0001, 0xF66B, 0x0001, 0xF747, 0x0001,
+    0xF821, 0x0001, 0xF8F8, 0x0001, 0xF9CC, 0x0001, 0xFA9D, 0x0000, 0xFB6C, 0x0000, 0xFC39, 0x0000, 0xFD04, 0x0000, 0xFDCD, 0x0000,
+    // roughness row 29
+    0x097C, 0x08AB, 0x0A3E, 0x0981, 0x0B19, 0x0A61, 0x0C11, 0x0B4C, 0x0D26, 0x0C3E, 0x0E5A, 0x0D35, 0x0FAF, 0x0E2F, 0x1125, 0x0F26,
+    0x12BD, 0x1019, 0x1477, 0x1105, 0x1652, 0x11E8, 0x184F, 0x12C0, 0x1A6C, 0x1389, 0x1CA9, 0x1444, 0x1F03, 0x14ED, 0x2178, 0x1583,
+    0x2409, 0x1608, 0x26B3, 0x167B, 0x2974, 0x16DD, 0x2C4B, 0x172B, 0x2F33, 0x1764, 0x322D, 0x178C, 0x3535, 0x179F, 0x384B, 0x17A5,
+    0x3B6E, 0x179B, 0x3E99, 0x1781, 0x41CE, 0x1759, 0x4508, 0x1724, 0x4847, 0x16E1, 0x4B89, 0x1693, 0x4ECF, 0x163C, 0x5216, 0x15DC,
+    0x555C, 0x1573, 0x58A0, 0x1501, 0x5BE0, 0x1488, 0x5F1E, 0x140A, 0x6258, 0x1388, 0x658E, 0x1301, 0x68BD, 0x1277, 0x6BE7, 0x11EB,
+    0x6F09, 0x115C, 0x7222, 0x10CB, 0x7534, 0x1039, 0x783B, 0x0FA6, 0x7B39, 0x0F13, 0x7E2D, 0x0E80, 0x8117, 0x0DEE, 0x83F6, 0x0D5E,
+    0x86CB, 0x0CCF, 0x8996, 0x0C43, 0x8C55, 0x0BB8, 0x8F08, 0x0B30, 0x91B0, 0x0AAA, 0x944D, 0x0A27, 0x96DF, 0x09A9, 0x9966, 0x092D,
+    0x9BE1, 0x08B4, 0x9E50, 0x083F, 0xA0B4, 0x07CD, 0xA30B, 0x075F, 0xA557, 0x06F4, 0xA797, 0x068D, 0xA9CC, 0x062A, 0xABF6, 0x05CA,
+    0xAE16, 0x056F, 0xB02C, 0x0518, 0xB236, 0x04C4, 0xB436, 0x0474, 0xB62C, 0x0427, 0xB817, 0x03DF, 0xB9F8, 0x0399, 0xBBD0, 0x0357,
+    0xBD9D, 0x0319, 0xBF64, 0x02DE, 0xC121, 0x02A6, 0xC2D5, 0x0272, 0xC481, 0x0240, 0xC624, 0x0212, 0xC7C1, 0x01E7, 0xC956, 0x01BE,
+    0xCAE5, 0x0198, 0xCC6D, 0x0175, 0xCDED, 0x0154, 0xCF65, 0x0135, 0xD0D6, 0x0118, 0xD240, 0x00FE, 0xD3A4, 0x00E5, 0xD500, 0x00CE,
+    0xD656, 0x00B9, 0xD7A6, 0x00A6, 0xD8F0, 0x0094, 0xDA34, 0x0084, 0xDB72, 0x0075, 0xDCAB, 0x0067, 0xDDE2, 0x005B, 0xDF13, 0x0050,
+    0xE040, 0x0047, 0xE167, 0x003E, 0xE28A, 0x0036, 0xE3A7, 0x002F, 0xE4C1, 0x0028, 0xE5D6, 0x0023, 0xE6E7, 0x001E, 0xE7F3, 0x0019,
+    0xE8FC, 0x0015, 0xEA01, 0x0012, 0xEB01, 0x000F, 0xEBFF, 0x000D, 0xECF8, 0x000A, 0xEDEF, 0x0009, 0xEEE1, 0x0007, 0xEFD1, 0x0006,
+    0xF0BD, 0x0005, 0xF1A7, 0x0004, 0xF28D, 0x0003, 0xF370, 0x0002, 0xF450, 0x0002, 0xF52E, 0x0001, 0xF608, 0x0001, 0xF6E0, 0x0001,
+    0xF7BD, 0x0001, 0xF899, 0x0001, 0xF972, 0x0001, 0xFA49, 0x0000, 0xFB1C, 0x0000, 0xFBEE, 0x0000, 0xFCBD, 0x0000, 0xFD8B, 0x0000,
+    // roughness row 30
+    0x0A8C, 0x090A, 0x0B53, 0x09D6, 0x0C34, 0x0AAC, 0x0D30, 0x0B8A, 0x0E48, 0x0C6F, 0x0F7D, 0x0D56, 0x10D2, 0x0E40, 0x1247, 0x0F28,
+    0x13DB, 0x100A, 0x1590, 0x10E7, 0x1765, 0x11B9, 0x195A, 0x1283, 0x1B6E, 0x133F, 0x1D9F, 0x13EC, 0x1FED, 0x148B, 0x2256, 0x1519,
+    0x24D9, 0x1594, 0x2773, 0x15FF, 0x2A25, 0x1659, 0x2CEC, 0x16A3, 0x2FC5, 0x16DB, 0x32AF, 0x1701, 0x35A8, 0x1716, 0x38AD, 0x1719,
+    0x3BBE, 0x170D, 0x3EDA, 0x16F5, 0x41FF, 0x16CF, 0x452A, 0x169C, 0x485A, 0x165D, 0x4B8E, 0x1613, 0x4EC4, 0x15BE, 0x51FC, 0x1561,
+    0x5535, 0x14FC, 0x586C, 0x1490, 0x5BA2, 0x141C, 0x5ED4, 0x13A3, 0x6200, 0x1323, 0x6529, 0x12A0, 0x684D, 0x121A, 0x6B6C, 0x1192,
+    0x6E83, 0x1107, 0x7194, 0x107B, 0x749E, 0x0FEF, 0x779E, 0x0F61, 0x7A96, 0x0ED3, 0x7D84, 0x0E45, 0x8067, 0x0DB7, 0x8340, 0x0D2A,
+    0x860F, 0x0C9E, 0x88D3, 0x0C15, 0x8B8D, 0x0B8D, 0x8E3D, 0x0B09, 0x90E2, 0x0A87, 0x937C, 0x0A07, 0x960A, 0x098A, 0x988C, 0x0910,
+    0x9B05, 0x089A, 0x9D73, 0x0828, 0x9FD6, 0x07B9, 0xA22E, 0x074D, 0xA47A, 0x06E5, 0xA6BB, 0x0680, 0xA8F1, 0x061F, 0xAB1B, 0x05C1,
+    0xAD3B, 0x0567, 0xAF50, 0x0510, 0xB15A, 0x04BE, 0xB35A, 0x046E, 0xB552, 0x0423, 0xB73F, 0x03DB, 0xB923, 0x0397, 0xBAFC, 0x0356,
+    0xBCCC, 0x0318, 0xBE93, 0x02DE, 0xC051, 0x02A6, 0xC205, 0x0272, 0xC3B1, 0x0241, 0xC557, 0x0213, 0xC6F4, 0x01E7, 0xC88A, 0x01BF,
+    0xCA17, 0x0198, 0xCB9C, 0x0175, 0xCD1D, 0x0154, 0xCE97, 0x0135, 0xD009, 0x0119, 0xD177, 0x00FE, 0xD2DF, 0x00E6, 0xD43F, 0x00CF,
+    0xD599, 0x00BB, 0xD6ED, 0x00A7, 0xD83B, 0x0096, 0xD983, 0x0086, 0xDAC5, 0x0077, 0xDC01, 0x0069, 0xDD39, 0x005D, 0xDE6A, 0x0052,
+    0xDF97, 0x0048, 0xE0BF, 0x003F, 0xE1E2, 0x0037, 0xE303, 0x002F, 0xE420, 0x0029, 0xE53A, 0x0024, 0xE64F, 0x001F, 0xE75F, 0x001A,
+    0xE86C, 0x0016, 0xE974, 0x0013, 0xEA79, 0x0010, 0xEB7A, 0x000D, 0xEC77, 0x000B, 0xED71, 0x0009, 0xEE68, 0x0008, 0xEF5B, 0x0006,
+    0xF04B, 0x0005, 0xF137, 0x0004, 0xF221, 0x0003, 0xF307, 0x0003, 0xF3EB, 0x0002, 0xF4CB, 0x0002, 0xF5A9, 0x0001, 0xF684, 0x0001,
+    0xF75C, 0x0001, 0xF831, 0x0001, 0xF906, 0x0000, 0xF9E3, 0x0000, 0xFABC, 0x0000, 0xFB93, 0x0000, 0xFC67, 0x0000, 0xFD3B, 0x0000,
+    // roughness row 31
+    0x0BAA, 0x0964, 0x0C78, 0x0A28, 0x0D5D, 0x0AF4, 0x0E5C, 0x0BC5, 0x0F77, 0x0C9D, 0x10AE, 0x0D76, 0x1203, 0x0E4F, 0x1376, 0x0F28,
+    0x1507, 0x0FFC, 0x16B7, 0x10C9, 0x1886, 0x118D, 0x1A72, 0x1247, 0x1C7D, 0x12F7, 0x1EA3, 0x1398, 0x20E6, 0x142B, 0x2342, 0x14B0,
+    0x25B8, 0x1524, 0x2843, 0x1587, 0x2AE5, 0x15DA, 0x2D9C, 0x161E, 0x3065, 0x1652, 0x3340, 0x1677, 0x3629, 0x168B, 0x391F, 0x168F,
+    0x3C20, 0x1684, 0x3F2A, 0x166A, 0x423E, 0x1645, 0x455A, 0x1615, 0x487B, 0x15D9, 0x4BA0, 0x1592, 0x4EC8, 0x1541, 0x51F2, 0x14E8,
+    0x551B, 0x1485, 0x5844, 0x141C, 0x5B6D, 0x13AD, 0x5E93, 0x1339, 0x61B6, 0x12C0, 0x64D3, 0x1241, 0x67EB, 0x11BF, 0x6AFC, 0x1139,
+    0x6E09, 0x10B2, 0x7110, 0x102B, 0x740F, 0x0FA1, 0x7706, 0x0F18, 0x79F6, 0x0E8E, 0x7CDD, 0x0E05, 0x7FBB, 0x0D7C, 0x828F, 0x0CF4,
+    0x8559, 0x0C6D, 0x8819, 0x0BE7, 0x8ACD, 0x0B63, 0x8D77, 0x0AE1, 0x9015, 0x0A61, 0x92AB, 0x09E4, 0x9536, 0x096A, 0x97B7, 0x08F4,
+    0x9A2D, 0x0880, 0x9C97, 0x0810, 0x9EF6, 0x07A2, 0xA14B, 0x0739, 0xA396, 0x06D2, 0xA5D7, 0x0670, 0xA80E, 0x0611, 0xAA39, 0x05B5,
+    0xAC5A, 0x055D, 0xAE70, 0x0508, 0xB07C, 0x04B7, 0xB27D, 0x0469, 0xB474, 0x041E, 0xB661, 0x03D7, 0xB845, 0x0394, 0xBA20, 0x0353,
+    0xBBF2, 0x0317, 0xBDBB, 0x02DD, 0xBF7C, 0x02A6, 0xC133, 0x0272, 0xC2E1, 0x0242, 0xC487, 0x0213, 0xC625, 0x01E8, 0xC7BB, 0x01C0,
+    0xC949, 0x0199, 0xCAD1, 0x0176, 0xCC52, 0x0155, 0xCDCC, 0x0136, 0xCF3F, 0x011A, 0xD0AB, 0x00FF, 0xD212, 0x00E7, 0xD374, 0x00D0,
+    0xD4CF, 0x00BB, 0xD624, 0x00A8, 0xD776, 0x0097, 0xD8C2, 0x0087, 0xDA08, 0x0078, 0xDB49, 0x006B, 0xDC84, 0x005E, 0xDDB9, 0x0053,
+    0xDEEA, 0x0049, 0xE015, 0x0040, 0xE13C, 0x0038, 0xE25E, 0x0031, 0xE37C, 0x002A, 0xE495, 0x0024, 0xE5AA, 0x001F, 0xE6BA, 0x001B,
+    0xE7C9, 0x0017, 0xE8D6, 0x0013, 0xE9DF, 0x0010, 0xEAE4, 0x000E, 0xEBE6, 0x000C, 0xECE3, 0x000A, 0xEDDD, 0x0008, 0xEED4, 0x0007,
+    0xEFC8, 0x0005, 0xF0B8, 0x0004, 0xF1A5, 0x0004, 0xF28F, 0x0003, 0xF376, 0x0002, 0xF45A, 0x0002, 0xF53B, 0x0001, 0xF619, 0x0001,
+    0xF6F4, 0x0001, 0xF7CC, 0x0001, 0xF8A2, 0x0000, 0xF975, 0x0000, 0xFA45, 0x0000, 0xFB24, 0x0000, 0xFBFF, 0x0000, 0xFCD8, 0x0000,
+    // roughness row 32
+    0x0CD8, 0x09BA, 0x0DAA, 0x0A75, 0x0E94, 0x0B37, 0x0F96, 0x0BFD, 0x10B3, 0x0CC7, 0x11EB, 0x0D93, 0x1340, 0x0E5E, 0x14B1, 0x0F28,
+    0x163F, 0x0FED, 0x17EA, 0x10AB, 0x19B3, 0x1162, 0x1B98, 0x120E, 0x1D99, 0x12B0, 0x1FB5, 0x1347, 0x21EC, 0x13CF, 0x243C, 0x144A,
+    0x26A4, 0x14B6, 0x2922, 0x1513, 0x2BB5, 0x155F, 0x2E5B, 0x159D, 0x3114, 0x15CC, 0x33DE, 0x15ED, 0x36B7, 0x1601, 0x399E, 0x1606,
+    0x3C8F, 0x15FB, 0x3F8A, 0x15E4, 0x428E, 0x15BF, 0x4597, 0x158E, 0x48A8, 0x1554, 0x4BBF, 0x1511, 0x4ED8, 0x14C3, 0x51F3, 0x146D,
+    0x550F, 0x1410, 0x582B, 0x13AB, 0x5B45, 0x133F, 0x5E5D, 0x12CE, 0x6173, 0x1259, 0x6486, 0x11E0, 0x6794, 0x1163, 0x6A9C, 0x10E2,
+    0x6D9D, 0x105F, 0x7097, 0x0FDA, 0x738B, 0x0F54, 0x7679, 0x0ECE, 0x795F, 0x0E49, 0x7C3D, 0x0DC2, 0x7F13, 0x0D3E, 0x81E1, 0x0CBA,
+    0x84A5, 0x0C37, 0x875F, 0x0BB6, 0x8A10, 0x0B36, 0x8CB6, 0x0AB8, 0x8F52, 0x0A3C, 0x91E3, 0x09C2, 0x9468, 0x094A, 0x96E3, 0x08D6,
+    0x9954, 0x0864, 0x9BBB, 0x07F6, 0x9E1A, 0x078B, 0xA06D, 0x0724, 0xA2B6, 0x06C0, 0xA4F4, 0x065F, 0xA727, 0x0601, 0xA952, 0x05A7,
+    0xAB72, 0x0551, 0xAD8A, 0x04FE, 0xAF97, 0x04AE, 0xB19A, 0x0462, 0xB393, 0x0419, 0xB582, 0x03D3, 0xB767, 0x0390, 0xB943, 0x0351,
+    0xBB16, 0x0314, 0xBCDF, 0x02DB, 0xBE9F, 0x02A5, 0xC059, 0x0272, 0xC20A, 0x0242, 0xC3B3, 0x0214, 0xC554, 0x01E9, 0xC6ED, 0x01C1,
+    0xC87D, 0x019B, 0xCA07, 0x0178, 0xCB88, 0x0157, 0xCD03, 0x0138, 0xCE76, 0x011B, 0xCFE5, 0x0101, 0xD14E, 0x00E8, 0xD2B0, 0x00D1,
+    0xD40B, 0x00BD, 0xD561, 0x00A9, 0xD6B2, 0x0098, 0xD7FF, 0x0088, 0xD946, 0x0079, 0xDA87, 0x006B, 0xDBC4, 0x005F, 0xDCFE, 0x0054,
+    0xDE33, 0x004A, 0xDF62, 0x0041, 0xE08D, 0x0039, 0xE1B3, 0x0032, 0xE2D5, 0x002B, 0xE3F2, 0x0025, 0xE50B, 0x0020, 0xE61F, 0x001C,
+    0xE72F, 0x0017, 0xE83C, 0x0014, 0xE944, 0x0011, 0xEA49, 0x000E, 0xEB4A, 0x000C, 0xEC4B, 0x000A, 0xED4A, 0x0008, 0xEE45, 0x0007,
+    0xEF3C, 0x0006, 0xF031, 0x0005, 0xF122, 0x0004, 0xF210, 0x0003, 0xF2FA, 0x0002, 0xF3E2, 0x0002, 0xF4C7, 0x0001, 0xF5A8, 0x0001,
+    0xF687, 0x0001, 0xF763, 0x0001, 0xF83C, 0x0001, 0xF912, 0x0000, 0xF9E6, 0x0000, 0xFAB6, 0x0000, 0xFB8D, 0x0000, 0xFC70, 0x0000,
+    // roughness row 33
+    0x0E14, 0x0A0C, 0x0EEA, 0x0ABF, 0x0FD8, 0x0B76, 0x10DE, 0x0C31, 0x11FD, 0x0CEF, 0x1335, 0x0DAE, 0x1489, 0x0E6A, 0x15F8, 0x0F26,
+    0x1783, 0x0FDE, 0x192A, 0x108E, 0x1AEC, 0x1137, 0x1CC9, 0x11D7, 0x1EC1, 0x126C, 0x20D4, 0x12F7, 0x22FF, 0x1376, 0x2543, 0x13E6,
+    0x279D, 0x144B, 0x2A0E, 0x14A1, 0x2C93, 0x14E8, 0x2F2A, 0x1521, 0x31D3, 0x154B, 0x348C, 0x1568, 0x3754, 0x1578, 0x3A2A, 0x157C,
+    0x3D0D, 0x1574, 0x3FF8, 0x155D, 0x42EC, 0x153B, 0x45E7, 0x150D, 0x48E8, 0x14D3, 0x4BED, 0x1490, 0x4EF7, 0x1446, 0x5204, 0x13F5,
+    0x5512, 0x139A, 0x5820, 0x1339, 0x5B2E, 0x12D3, 0x5E39, 0x1266, 0x6142, 0x11F4, 0x6447, 0x117E, 0x6749, 0x1106, 0x6A48, 0x108B,
+    0x6D40, 0x100D, 0x7032, 0x0F8D, 0x731C, 0x0F0B, 0x75FF, 0x0E88, 0x78DA, 0x0E05, 0x7BAE, 0x0D83, 0x7E7C, 0x0D01, 0x8141, 0x0C81,
+    0x83FD, 0x0C01, 0x86B2, 0x0B84, 0x895E, 0x0B08, 0x8BFF, 0x0A8E, 0x8E97, 0x0A15, 0x9126, 0x099F, 0x93A9, 0x092C, 0x9623, 0x08BA,
+    0x9891, 0x084B, 0x9AF5, 0x07DF, 0x9D4D, 0x0776, 0x9F9C, 0x0710, 0xA1E1, 0x06AD, 0xA41E, 0x064E, 0xA651, 0x05F3, 0xA87A, 0x059B,
+    0xAA99, 0x0545, 0xACAE, 0x04F3, 0xAEBA, 0x04A5, 0xB0BC, 0x045A, 0xB2B7, 0x0413, 0xB4A8, 0x03CE, 0xB690, 0x038D, 0xB86E, 0x034E,
+    0xBA43, 0x0313, 0xBC0F, 0x02DB, 0xBDD2, 0x02A5, 0xBF8C, 0x0272, 0xC13E, 0x0242, 0xC2E7, 0x0215, 0xC489, 0x01EA, 0xC625, 0x01C3,
+    0xC7B9, 0x019D, 0xC945, 0x017A, 0xCACA, 0x0159, 0xCC48, 0x013B, 0xCDBF, 0x011E, 0xCF2F, 0x0103, 0xD098, 0x00EB, 0xD1FB, 0x00D4,
+    0xD357, 0x00BF, 0xD4B0, 0x00AB, 0xD603, 0x009A, 0xD750, 0x0089, 0xD898, 0x007A, 0xD9DA, 0x006D, 0xDB18, 0x0061, 0xDC53, 0x0055,
+    0xDD89, 0x004B, 0xDEBA, 0x0042, 0xDFE5, 0x003A, 0xE10D, 0x0033, 0xE233, 0x002C, 0xE355, 0x0026, 0xE472, 0x0021, 0xE58A, 0x001D,
+    0xE69F, 0x0018, 0xE7AF, 0x0015, 0xE8BC, 0x0012, 0xE9C4, 0x000F, 0xEAC9, 0x000C, 0xEBCB, 0x000A, 0xECC8, 0x0009, 0xEDC2, 0x0007,
+    0xEEB9, 0x0006, 0xEFAF, 0x0005, 0xF0A5, 0x0004, 0xF197, 0x0003, 0xF286, 0x0003, 0xF372, 0x0002, 0xF45B, 0x0002, 0xF541, 0x0001,
+    0xF623, 0x0001, 0xF703, 0x0001, 0xF7E0, 0x0001, 0xF8BA, 0x0000, 0xF990, 0x0000, 0xFA64, 0x0000, 0xFB34, 0x0000, 0xFC0C, 0x0000,
+    // roughness row 34
+    0x0F5E, 0x0A5A, 0x1039, 0x0B03, 0x112A, 0x0BB1, 0x1232, 0x0C61, 0x1352, 0x0D13, 0x148C, 0x0DC5, 0x15DE, 0x0E75, 0x174B, 0x0F23,
+    0x18D3, 0x0FCD, 0x1A75, 0x1071, 0x1C31, 0x110D, 0x1E07, 0x11A1, 0x1FF6, 0x122B, 0x21FF, 0x12AA, 0x241F, 0x131F, 0x2657, 0x1388,
+    0x28A5, 0x13E3, 0x2B08, 0x1433, 0x2D7E, 0x1475, 0x3007, 0x14A9, 0x32A1, 0x14CF, 0x354A, 0x14E9, 0x3801, 0x14F6, 0x3AC7, 0x14F7,
+    0x3D98, 0x14ED, 0x4074, 0x14D9, 0x4359, 0x14B8, 0x4644, 0x148C, 0x4936, 0x1456, 0x4C2D, 0x1416, 0x4F26, 0x13CC, 0x5222, 0x137C,
+    0x5522, 0x1326, 0x5823, 0x12C9, 0x5B23, 0x1266, 0x5E21, 0x11FD, 0x611E, 0x1191, 0x6418, 0x111F, 0x670D, 0x10AA, 0x69FE, 0x1032,
+    0x6CEB, 0x0FB9, 0x6FD4, 0x0F3E, 0x72B6, 0x0EC1, 0x7591, 0x0E43, 0x7864, 0x0DC4, 0x7B2F, 0x0D45, 0x7DF2, 0x0CC6, 0x80AD, 0x0C48,
+    0x8360, 0x0BCC, 0x860D, 0x0B51, 0x88B1, 0x0AD8, 0x8B4C, 0x0A61, 0x8DDF, 0x09EC, 0x9069, 0x097A, 0x92E9, 0x0909, 0x955F, 0x089B,
+    0x97CC, 0x0830, 0x9A2E, 0x07C7, 0x9C86, 0x0761, 0x9ED4, 0x06FD, 0xA117, 0x069D, 0xA350, 0x063F, 0xA57E, 0x05E4, 0xA7A4, 0x058D,
+    0xA9C2, 0x053A, 0xABD5, 0x04E9, 0xADE0, 0x049C, 0xAFE1, 0x0452, 0xB1DA, 0x040C, 0xB3CA, 0x03C8, 0xB5B1, 0x0388, 0xB790, 0x034A,
+    0xB967, 0x0310, 0xBB35, 0x02D9, 0xBCFB, 0x02A4, 0xBEB8, 0x0272, 0xC06D, 0x0243, 0xC219, 0x0216, 0xC3BE, 0x01EC, 0xC55A, 0x01C4,
+    0xC6EF, 0x019F, 0xC87C, 0x017C, 0xCA02, 0x015B, 0xCB84, 0x013D, 0xCCFE, 0x0120, 0xCE72, 0x0106, 0xCFDE, 0x00EE, 0xD144, 0x00D7,
+    0xD2A4, 0x00C2, 0xD3FE, 0x00AE, 0xD552, 0x009C, 0xD69F, 0x008C, 0xD7E7, 0x007C, 0xD92D, 0x006F, 0xDA6E, 0x0062, 0xDBA9, 0x0057,
+    0xDCDF, 0x004D, 0xDE10, 0x0044, 0xDF3F, 0x003B, 0xE06A, 0x0034, 0xE190, 0x002D, 0xE2B2, 0x0027, 0xE3D0, 0x0022, 0xE4E9, 0x001D,
+    0xE601, 0x0019, 0xE715, 0x0016, 0xE826, 0x0012, 0xE933, 0x0010, 0xEA3C, 0x000D, 0xEB42, 0x000B, 0xEC43, 0x0009, 0xED42, 0x0008,
+    0xEE3C, 0x0006, 0xEF33, 0x0005, 0xF027, 0x0004, 0xF118, 0x0003, 0xF205, 0x0003, 0xF2F3, 0x0002, 0xF3E1, 0x0002, 0xF4CB, 0x0001,
+    0xF5B2, 0x0001, 0xF696, 0x0001, 0xF777, 0x0001, 0xF855, 0x0001, 0xF930, 0x0000, 0xFA07, 0x0000, 0xFADA, 0x0000, 0xFBA8, 0x0000,
+    // roughness row 35
+    0x10B5, 0x0AA3, 0x1194, 0x0B44, 0x1288, 0x0BE8, 0x1392, 0x0C8D, 0x14B4, 0x0D33, 0x15ED, 0x0DDA, 0x173F, 0x0E7E, 0x18AA, 0x0F1E,
+    0x1A2E, 0x0FBC, 0x1BCB, 0x1054, 0x1D81, 0x10E4, 0x1F50, 0x116C, 0x2137, 0x11EC, 0x2336, 0x1261, 0x254B, 0x12CB, 0x2778, 0x132B,
+    0x29B9, 0x1380, 0x2C0E, 0x13C7, 0x2E77, 0x1404, 0x30F1, 0x1433, 0x337C, 0x1457, 0x3615, 0x146D, 0x38BD, 0x1477, 0x3B72, 0x1476,
+    0x3E32, 0x146A, 0x40FD, 0x1454, 0x43D2, 0x1435, 0x46AE, 0x140C, 0x4991, 0x13D8, 0x4C78, 0x139A, 0x4F64, 0x1355, 0x5251, 0x1307,
+    0x553F, 0x12B2, 0x5831, 0x1257, 0x5B23, 0x11F9, 0x5E15, 0x1195, 0x6104, 0x112C, 0x63F1, 0x10BF, 0x66DC, 0x104F, 0x69C2, 0x0FDB,
+    0x6CA3, 0x0F65, 0x6F7F, 0x0EED, 0x7256, 0x0E75, 0x7528, 0x0DFB, 0x77F4, 0x0D82, 0x7AB8, 0x0D07, 0x7D74, 0x0C8D, 0x8027, 0x0C12,
+    0x82D1, 0x0B98, 0x8574, 0x0B20, 0x880F, 0x0AA9, 0x8AA2, 0x0A35, 0x8D2D, 0x09C3, 0x8FB0, 0x0953, 0x922A, 0x08E5, 0x949C, 0x087A,
+    0x9705, 0x0812, 0x9965, 0x07AC, 0x9BBB, 0x0749, 0x9E08, 0x06E8, 0xA04A, 0x068A, 0xA283, 0x062F, 0xA4B1, 0x05D7, 0xA6D6, 0x0582,
+    0xA8F0, 0x052F, 0xAB01, 0x04E0, 0xAD09, 0x0493, 0xAF0A, 0x044B, 0xB102, 0x0405, 0xB2F0, 0x03C3, 0xB4D6, 0x0383, 0xB6B2, 0x0346,
+    0xB887, 0x030C, 0xBA56, 0x02D6, 0xBC1C, 0x02A2, 0xBDDA, 0x0270, 0xBF92, 0x0242, 0xC141, 0x0216, 0xC2E9, 0x01ED, 0xC488, 0x01C6,
+    0xC620, 0x01A1, 0xC7B0, 0x017E, 0xC939, 0x015E, 0xCABB, 0x013F, 0xCC36, 0x0123, 0xCDAA, 0x0108, 0xCF19, 0x00F0, 0xD083, 0x00D9,
+    0xD1E7, 0x00C4, 0xD344, 0x00B1, 0xD49C, 0x009F, 0xD5ED, 0x008E, 0xD739, 0x007F, 0xD87F, 0x0071, 0xD9C0, 0x0065, 0xDAFB, 0x0059,
+    0xDC32, 0x004E, 0xDD67, 0x0045, 0xDE97, 0x003D, 0xDFC2, 0x0035, 0xE0E9, 0x002E, 0xE20B, 0x0028, 0xE32D, 0x0023, 0xE44A, 0x001E,
+    0xE564, 0x001A, 0xE679, 0x0016, 0xE78A, 0x0013, 0xE897, 0x0010, 0xE9A0, 0x000E, 0xEAAA, 0x000C, 0xEBB1, 0x000A, 0xECB3, 0x0008,
+    0xEDB2, 0x0007, 0xEEAD, 0x0006, 0xEFA5, 0x0005, 0xF09A, 0x0004, 0xF18B, 0x0003, 0xF279, 0x0002, 0xF364, 0x0002, 0xF44B, 0x0002,
+    0xF530, 0x0001, 0xF61A, 0x0001, 0xF700, 0x0001, 0xF7E2, 0x0001, 0xF8C1, 0x0000, 0xF99C, 0x0000, 0xFA73, 0x0000, 0xFB44, 0x0000,
+    // roughness row 36
+    0x121A, 0x0AE8, 0x12FC, 0x0B80, 0x13F3, 0x0C1A, 0x14FF, 0x0CB6, 0x1621, 0x0D51, 0x175B, 0x0DEB, 0x18AB, 0x0E84, 0x1A14, 0x0F19,
+    0x1B94, 0x0FAA, 0x1D2C, 0x1037, 0x1EDC, 0x10BC, 0x20A4, 0x1139, 0x2283, 0x11AD, 0x2478, 0x1219, 0x2683, 0x127A, 0x28A3, 0x12D1,
+    0x2AD8, 0x131E, 0x2D21, 0x1360, 0x2F7B, 0x1395, 0x31E7, 0x13C0, 0x3463, 0x13E0, 0x36EE, 0x13F4, 0x3986, 0x13FC, 0x3C2A, 0x13F8,
+    0x3EDA, 0x13EB, 0x4194, 0x13D4, 0x4458, 0x13B4, 0x4724, 0x138B, 0x49F7, 0x135A, 0x4CD0, 0x1320, 0x4FAB, 0x12DD, 0x528B, 0x1293,
+    0x556D, 0x1242, 0x584E, 0x11EA, 0x5B30, 0x118C, 0x5E12, 0x112B, 0x60F6, 0x10C7, 0x63D6, 0x105E, 0x66B4, 0x0FF2, 0x698E, 0x0F83,
+    0x6C65, 0x0F12, 0x6F37, 0x0E9E, 0x7202, 0x0E29, 0x74C9, 0x0DB3, 0x7789, 0x0D3C, 0x7A44, 0x0CC6, 0x7CF9, 0x0C51, 0x7FA7, 0x0BDB,
+    0x824C, 0x0B66, 0x84E8, 0x0AF1, 0x877B, 0x0A7D, 0x8A05, 0x0A0A, 0x8C87, 0x099A, 0x8F02, 0x092C, 0x9174, 0x08C1, 0x93E0, 0x0858,
+    0x9642, 0x07F2, 0x989C, 0x078E, 0x9AEF, 0x072E, 0x9D39, 0x06D0, 0x9F79, 0x0675, 0xA1B0, 0x061C, 0xA3DF, 0x05C7, 0xA603, 0x0574,
+    0xA81E, 0x0524, 0xAA30, 0x04D6, 0xAC38, 0x048B, 0xAE36, 0x0444, 0xB02B, 0x03FF, 0xB217, 0x03BD, 0xB3FD, 0x037E, 0xB5DB, 0x0343,
+    0xB7B0, 0x030A, 0xB97D, 0x02D3, 0xBB41, 0x02A0, 0xBCFD, 0x026F, 0xBEB3, 0x0241, 0xC061, 0x0215, 0xC209, 0x01EC, 0xC3AB, 0x01C6,
+    0xC546, 0x01A1, 0xC6DA, 0x017F, 0xC866, 0x015F, 0xC9EB, 0x0141, 0xCB69, 0x0125, 0xCCE1, 0x010B, 0xCE52, 0x00F2, 0xCFBC, 0x00DC,
+    0xD120, 0x00C6, 0xD27E, 0x00B3, 0xD3D9, 0x00A1, 0xD52F, 0x0091, 0xD67E, 0x0082, 0xD7C8, 0x0074, 0xD90D, 0x0067, 0xDA4C, 0x005B,
+    0xDB86, 0x0051, 0xDCBB, 0x0047, 0xDDEB, 0x003E, 0xDF16, 0x0037, 0xE03F, 0x0030, 0xE165, 0x002A, 0xE287, 0x0024, 0xE3A4, 0x001F,
+    0xE4BD, 0x001B, 0xE5D4, 0x0017, 0xE6E9, 0x0014, 0xE7FA, 0x0011, 0xE908, 0x000E, 0xEA11, 0x000C, 0xEB17, 0x000A, 0xEC19, 0x0008,
+    0xED18, 0x0007, 0xEE18, 0x0006, 0xEF14, 0x0005, 0xF00D, 0x0004, 0xF103, 0x0003, 0xF1F5, 0x0003, 0xF2E3, 0x0002, 0xF3CF, 0x0002,
+    0xF4B7, 0x0001, 0xF59B, 0x0001, 0xF67D, 0x0001, 0xF75D, 0x0001, 0xF842, 0x0000, 0xF922, 0x0000, 0xF9FD, 0x0000, 0xFAD1, 0x0000,
+    // roughness row 37
+    0x138C, 0x0B28, 0x1471, 0x0BB8, 0x156A, 0x0C49, 0x1677, 0x0CDA, 0x179A, 0x0D6B, 0x18D3, 0x0DFA, 0x1A22, 0x0E88, 0x1B88, 0x0F12,
+    0x1D04, 0x0F97, 0x1E98, 0x1018, 0x2042, 0x1093, 0x2202, 0x1106, 0x23D9, 0x1170, 0x25C5, 0x11D3, 0x27C6, 0x122C, 0x29DB, 0x127A,
+    0x2C03, 0x12BF, 0x2E3F, 0x12FB, 0x308C, 0x132C, 0x32E9, 0x1350, 0x3556, 0x136C, 0x37D2, 0x137C, 0x3A5B, 0x1383, 0x3CF0, 0x137F,
+    0x3F90, 0x1370, 0x4239, 0x1358, 0x44EC, 0x1337, 0x47A8, 0x130E, 0x4A6A, 0x12DD, 0x4D32, 0x12A5, 0x5000, 0x1266, 0x52D0, 0x121F,
+    0x55A3, 0x11D1, 0x5877, 0x117D, 0x5B4C, 0x1124, 0x5E20, 0x10C5, 0x60F2, 0x1062, 0x63C5, 0x0FFC, 0x6697, 0x0F95, 0x6965, 0x0F2A,
+    0x6C2F, 0x0EBD, 0x6EF6, 0x0E4D, 0x71B8, 0x0DDD, 0x7475, 0x0D6B, 0x772B, 0x0CF9, 0x79DB, 0x0C86, 0x7C85, 0x0C12, 0x7F29, 0x0BA1,
+    0x81C7, 0x0B2F, 0x845E, 0x0ABF, 0x86EC, 0x0A50, 0x8972, 0x09E2, 0x8BEE, 0x0974, 0x8E61, 0x0909, 0x90CC, 0x089F, 0x932E, 0x0838,
+    0x9589, 0x07D3, 0x97DD, 0x0772, 0x9A28, 0x0713, 0x9C6C, 0x06B7, 0x9EA8, 0x065E, 0xA0DD, 0x0608, 0xA309, 0x05B4, 0xA52B, 0x0563,
+    0xA746, 0x0515, 0xA957, 0x04CA, 0xAB60, 0x0482, 0xAD5F, 0x043C, 0xAF55, 0x03F8, 0xB143, 0x03B8, 0xB327, 0x037A, 0xB502, 0x033F,
+    0xB6D5, 0x0306, 0xB8A1, 0x02D1, 0xBA68, 0x029E, 0xBC26, 0x026E, 0xBDDC, 0x0240, 0xBF8A, 0x0215, 0xC130, 0x01EC, 0xC2D0, 0x01C6,
+    0xC46A, 0x01A2, 0xC5FC, 0x0180, 0xC788, 0x0160, 0xC90E, 0x0142, 0xCA90, 0x0126, 0xCC0B, 0x010D, 0xCD80, 0x00F4, 0xCEEE, 0x00DE,
+    0xD055, 0x00C9, 0xD1B7, 0x00B5, 0xD312, 0x00A3, 0xD468, 0x0093, 0xD5B8, 0x0084, 0xD704, 0x0076, 0xD84D, 0x0069, 0xD990, 0x005D,
+    0xDACE, 0x0053, 0xDC06, 0x0049, 0xDD3A, 0x0041, 0xDE69, 0x0039, 0xDF94, 0x0031, 0xE0BA, 0x002B, 0xE1DB, 0x0025, 0xE2F8, 0x0020,
+    0xE415, 0x001C, 0xE52E, 0x0018, 0xE643, 0x0014, 0xE754, 0x0011, 0xE861, 0x000F, 0xE96E, 0x000D, 0xEA79, 0x000B, 0xEB7F, 0x0009,
+    0xEC82, 0x0008, 0xED80, 0x0006, 0xEE7C, 0x0005, 0xEF73, 0x0004, 0xF069, 0x0003, 0xF160, 0x0003, 0xF253, 0x0002, 0xF343, 0x0002,
+    0xF42F, 0x0002, 0xF517, 0x0001, 0xF5FC, 0x0001, 0xF6DD, 0x0001, 0xF7BA, 0x0001, 0xF893, 0x0000, 0xF974, 0x0000, 0xFA4C, 0x0000,
+    // roughness row 38
+    0x150A, 0x0B63, 0x15F1, 0x0BEB, 0x16EC, 0x0C73, 0x17FA, 0x0CFB, 0x191D, 0x0D82, 0x1A55, 0x0E07, 0x1BA3, 0x0E8A, 0x1D06, 0x0F09,
+    0x1E7E, 0x0F83, 0x200D, 0x0FF9, 0x21B1, 0x106A, 0x236A, 0x10D4, 0x2538, 0x1135, 0x271B, 0x118D, 0x2912, 0x11DE, 0x2B1C, 0x1225,
+    0x2D39, 0x1263, 0x2F67, 0x1298, 0x31A7, 0x12C3, 0x33F7, 0x12E4, 0x3655, 0x12FA, 0x38C1, 0x1308, 0x3B3B, 0x130C, 0x3DC1, 0x1307,
+    0x4052, 0x12F8, 0x42EB, 0x12DE, 0x458E, 0x12BD, 0x4839, 0x1294, 0x4AEA, 0x1264, 0x4DA2, 0x122D, 0x505F, 0x11EF, 0x5321, 0x11AB,
+    0x55E5, 0x1160, 0x58AA, 0x1110, 0x5B71, 0x10BA, 0x5E39, 0x1060, 0x60FF, 0x1001, 0x63C2, 0x0F9E, 0x6684, 0x0F38, 0x6944, 0x0ED0,
+    0x6C04, 0x0E68, 0x6EBF, 0x0DFD, 0x7175, 0x0D90, 0x7427, 0x0D22, 0x76D4, 0x0CB4, 0x797C, 0x0C45, 0x7C1D, 0x0BD6, 0x7EB7, 0x0B67,
+    0x814A, 0x0AF8, 0x83D7, 0x0A8B, 0x865F, 0x0A20, 0x88DE, 0x09B5, 0x8B57, 0x094C, 0x8DC6, 0x08E5, 0x902D, 0x087E, 0x928A, 0x081A,
+    0x94DF, 0x07B7, 0x972B, 0x0757, 0x996F, 0x06FA, 0x9BAB, 0x069F, 0x9DDF, 0x0647, 0xA00D, 0x05F2, 0xA232, 0x05A0, 0xA452, 0x0551,
+    0xA66A, 0x0505, 0xA87A, 0x04BC, 0xAA81, 0x0475, 0xAC80, 0x0431, 0xAE77, 0x03F0, 0xB066, 0x03B1, 0xB24B, 0x0375, 0xB428, 0x033B,
+    0xB5FD, 0x0304, 0xB7C9, 0x02CF, 0xB98D, 0x029D, 0xBB49, 0x026D, 0xBCFD, 0x023F, 0xBEAD, 0x0215, 0xC056, 0x01ED, 0xC1F8, 0x01C7,
+    0xC392, 0x01A3, 0xC524, 0x0181, 0xC6B0, 0x0161, 0xC837, 0x0144, 0xC9B8, 0x0128, 0xCB31, 0x010E, 0xCCA6, 0x00F6, 0xCE16, 0x00E0,
+    0xCF7F, 0x00CB, 0xD0E2, 0x00B7, 0xD241, 0x00A6, 0xD39A, 0x0095, 0xD4EE, 0x0086, 0xD63C, 0x0078, 0xD785, 0x006B, 0xD8C8, 0x005F,
+    0xDA07, 0x0055, 0xDB44, 0x004B, 0xDC7B, 0x0042, 0xDDAF, 0x003A, 0xDEDD, 0x0033, 0xE006, 0x002D, 0xE12C, 0x0027, 0xE24C, 0x0022,
+    0xE369, 0x001D, 0xE481, 0x0019, 0xE595, 0x0015, 0xE6A8, 0x0012, 0xE7B9, 0x0010, 0xE8C6, 0x000D, 0xE9CF, 0x000B, 0xEAD5, 0x0009,
+    0xEBDB, 0x0008, 0xECDE, 0x0007, 0xEDDE, 0x0006, 0xEEDA, 0x0005, 0xEFD2, 0x0004, 0xF0C6, 0x0003, 0xF1B7, 0x0002, 0xF2A5, 0x0002,
+    0xF395, 0x0002, 0xF482, 0x0001, 0xF56B, 0x0001, 0xF650, 0x0001, 0xF730, 0x0001, 0xF80B, 0x0000, 0xF8DE, 0x0000, 0xF9B0, 0x0000,
+    // roughness row 39
+    0x1694, 0x0B9A, 0x177D, 0x0C1A, 0x1879, 0x0C99, 0x1988, 0x0D18, 0x1AAB, 0x0D95, 0x1BE2, 0x0E10, 0x1D2D, 0x0E89, 0x1E8D, 0x0EFF,
+    0x2002, 0x0F6E, 0x218B, 0x0FDA, 0x2329, 0x1041, 0x24DB, 0x10A1, 0x26A2, 0x10FA, 0x287B, 0x114A, 0x2A68, 0x1192, 0x2C68, 0x11D3,
+    0x2E78, 0x120A, 0x309A, 0x1237, 0x32CC, 0x125D, 0x350E, 0x127A, 0x375F, 0x128E, 0x39BC, 0x1297, 0x3C27, 0x1298, 0x3E9D, 0x1291,
+    0x411E, 0x1281, 0x43A9, 0x1268, 0x463C, 0x1247, 0x48D6, 0x121D, 0x4B77, 0x11ED, 0x4E1F, 0x11B7, 0x50CC, 0x117A, 0x537D, 0x1138,
+    0x5632, 0x10F0, 0x58EA, 0x10A4, 0x5BA2, 0x1051, 0x5E5A, 0x0FFA, 0x6113, 0x0F9F, 0x63CB, 0x0F41, 0x6680, 0x0EDF, 0x6932, 0x0E79,
+    0x6BE2, 0x0E12, 0x6E90, 0x0DAB, 0x713C, 0x0D43, 0x73E4, 0x0CD9, 0x7685, 0x0C6E, 0x7922, 0x0C03, 0x7BBA, 0x0B98, 0x7E4C, 0x0B2D,
+    0x80D7, 0x0AC2, 0x835C, 0x0A58, 0x85D9, 0x09EF, 0x884F, 0x0987, 0x8AC0, 0x0922, 0x8D2A, 0x08BD, 0x8F8C, 0x085B, 0x91E7, 0x07FA,
+    0x9438, 0x079B, 0x9680, 0x073E, 0x98C0, 0x06E2, 0x9AF7, 0x0689, 0x9D26, 0x0633, 0x9F4D, 0x05DF, 0xA16C, 0x058E, 0xA384, 0x0540,
+    0xA593, 0x04F5, 0xA79C, 0x04AC, 0xA9A0, 0x0467, 0xAB9E, 0x0425, 0xAD94, 0x03E5, 0xAF81, 0x03A8, 0xB167, 0x036D, 0xB345, 0x0335,
+    0xB51B, 0x02FF, 0xB6E9, 0x02CC, 0xB8AF, 0x029B, 0xBA6C, 0x026C, 0xBC22, 0x023F, 0xBDD1, 0x0215, 0xBF77, 0x01ED, 0xC116, 0x01C7,
+    0xC2B2, 0x01A3, 0xC447, 0x0182, 0xC5D6, 0x0163, 0xC75D, 0x0145, 0xC8DE, 0x012A, 0xCA58, 0x0110, 0xCBCE, 0x00F8, 0xCD3E, 0x00E2,
+    0xCEA8, 0x00CD, 0xD00C, 0x00B9, 0xD16D, 0x00A8, 0xD2C8, 0x0097, 0xD41D, 0x0088, 0xD56C, 0x007A, 0xD6B7, 0x006D, 0xD7FB, 0x0061,
+    0xD93C, 0x0056, 0xDA79, 0x004D, 0xDBB1, 0x0044, 0xDCE4, 0x003C, 0xDE16, 0x0035, 0xDF44, 0x002E, 0xE06D, 0x0028, 0xE191, 0x0023,
+    0xE2B2, 0x001E, 0xE3CE, 0x001A, 0xE4E6, 0x0016, 0xE5F9, 0x0013, 0xE709, 0x0010, 0xE815, 0x000E, 0xE920, 0x000C, 0xEA29, 0x000A,
+    0xEB2E, 0x0008, 0xEC30, 0x0007, 0xED2E, 0x0006, 0xEE2E, 0x0005, 0xEF2B, 0x0004, 0xF023, 0x0003, 0xF118, 0x0003, 0xF209, 0x0002,
+    0xF2F6, 0x0002, 0xF3DF, 0x0001, 0xF4C5, 0x0001, 0xF5AE, 0x0001, 0xF692, 0x0001, 0xF770, 0x0001, 0xF844, 0x0000, 0xF904, 0x0000,
+    // roughness row 40
+    0x182A, 0x0BCD, 0x1914, 0x0C44, 0x1A11, 0x0CBB, 0x1B20, 0x0D31, 0x1C42, 0x0DA5, 0x1D78, 0x0E17, 0x1EC1, 0x0E86, 0x201E, 0x0EF2,
+    0x218E, 0x0F59, 0x2312, 0x0FB9, 0x24AA, 0x1017, 0x2655, 0x106F, 0x2813, 0x10BF, 0x29E4, 0x1107, 0x2BC7, 0x1148, 0x2DBC, 0x1181,
+    0x2FC1, 0x11B3, 0x31D7, 0x11DB, 0x33FC, 0x11FA, 0x3630, 0x1213, 0x3873, 0x1223, 0x3AC2, 0x122A, 0x3D1D, 0x1227, 0x3F84, 0x121E,
+    0x41F6, 0x120C, 0x4471, 0x11F3, 0x46F5, 0x11D3, 0x4980, 0x11AA, 0x4C11, 0x117A, 0x4EA8, 0x1144, 0x5145, 0x1108, 0x53E6, 0x10C7,
+    0x568B, 0x1082, 0x5933, 0x1037, 0x5BDD, 0x0FE9, 0x5E88, 0x0F96, 0x6132, 0x0F3E, 0x63DC, 0x0EE2, 0x6684, 0x0E84, 0x692C, 0x0E24,
+    0x6BD0, 0x0DC1, 0x6E6F, 0x0D5B, 0x710C, 0x0CF5, 0x73A7, 0x0C8E, 0x763F, 0x0C28, 0x78D2, 0x0BC1, 0x7B5F, 0x0B59, 0x7DE7, 0x0AF2,
+    0x8069, 0x0A8B, 0x82E6, 0x0A24, 0x855C, 0x09BF, 0x87CB, 0x095B, 0x8A33, 0x08F7, 0x8C93, 0x0895, 0x8EEE, 0x0835, 0x9142, 0x07D8,
+    0x938F, 0x077C, 0x95D4, 0x0722, 0x9811, 0x06CA, 0x9A45, 0x0674, 0x9C71, 0x061F, 0x9E94, 0x05CD, 0xA0AF, 0x057E, 0xA2C2, 0x0531,
+    0xA4CD, 0x04E7, 0xA6D2, 0x04A0, 0xA8CE, 0x045B, 0xAAC2, 0x0419, 0xACAF, 0x03D9, 0xAE98, 0x039D, 0xB07D, 0x0364, 0xB25A, 0x032D,
+    0xB430, 0x02F8, 0xB5FE, 0x02C6, 0xB7C6, 0x0297, 0xB986, 0x0269, 0xBB3D, 0x023E, 0xBCEE, 0x0214, 0xBE97, 0x01ED, 0xC038, 0x01C8,
+    0xC1D2, 0x01A4, 0xC365, 0x0183, 0xC4F2, 0x0164, 0xC679, 0x0146, 0xC7FD, 0x012B, 0xC97B, 0x0112, 0xCAF1, 0x00FA, 0xCC62, 0x00E4,
+    0xCDCC, 0x00CF, 0xCF32, 0x00BC, 0xD094, 0x00AA, 0xD1EF, 0x0099, 0xD345, 0x008A, 0xD497, 0x007C, 0xD5E4, 0x006F, 0xD72D, 0x0064,
+    0xD870, 0x0059, 0xD9AF, 0x004F, 0xDAE8, 0x0046, 0xDC1C, 0x003E, 0xDD4C, 0x0036, 0xDE77, 0x002F, 0xDF9E, 0x0029, 0xE0C5, 0x0024,
+    0xE1E9, 0x001F, 0xE309, 0x001B, 0xE425, 0x0017, 0xE53D, 0x0014, 0xE650, 0x0011, 0xE760, 0x000F, 0xE86B, 0x000C, 0xE973, 0x000A,
+    0xEA77, 0x0009, 0xEB7A, 0x0007, 0xEC7C, 0x0006, 0xED7A, 0x0005, 0xEE74, 0x0004, 0xEF6C, 0x0003, 0xF065, 0x0003, 0xF15B, 0x0002,
+    0xF24C, 0x0002, 0xF338, 0x0002, 0xF420, 0x0001, 0xF502, 0x0001, 0xF5DE, 0x0001, 0xF6BD, 0x0001, 0xF792, 0x0000, 0xF864, 0x0000,
+    // roughness row 41
+    0x19CA, 0x0BFA, 0x1AB5, 0x0C6A, 0x1BB2, 0x0CD9, 0x1CC2, 0x0D46, 0x1DE3, 0x0DB2, 0x1F17, 0x0E1A, 0x205D, 0x0E80, 0x21B7, 0x0EE3,
+    0x2323, 0x0F41, 0x24A2, 0x0F99, 0x2633, 0x0FED, 0x27D7, 0x103C, 0x298E, 0x1085, 0x2B55, 0x10C6, 0x2D2F, 0x1100, 0x2F18, 0x1132,
+    0x3113, 0x115D, 0x331D, 0x1181, 0x3535, 0x119B, 0x375B, 0x11AE, 0x3990, 0x11BA, 0x3BD2, 0x11BE, 0x3E1F, 0x11BB, 0x4076, 0x11AE,
+    0x42D8, 0x119B, 0x4544, 0x1181, 0x47B8, 0x1160, 0x4A33, 0x1138, 0x4CB6, 0x110A, 0x4F3D, 0x10D5, 0x51C9, 0x1099, 0x545A, 0x105A,
+    0x56EF, 0x1015, 0x5987, 0x0FCD, 0x5C22, 0x0F81, 0x5EBE, 0x0F30, 0x615C, 0x0EDD, 0x63F8, 0x0E86, 0x6693, 0x0E2B, 0x692D, 0x0DCE,
+    0x6BC5, 0x0D6F, 0x6E5A, 0x0D0E, 0x70EB, 0x0CAB, 0x7378, 0x0C46, 0x7602, 0x0BE2, 0x7888, 0x0B7D, 0x7B0C, 0x0B1A, 0x7D8B, 0x0AB6,
+    0x8003, 0x0A53, 0x8276, 0x09F0, 0x84E2, 0x098D, 0x874A, 0x092C, 0x89AB, 0x08CD, 0x8C05, 0x086E, 0x8E58, 0x0811, 0x90A4, 0x07B5,
+    0x92E8, 0x075B, 0x9528, 0x0704, 0x9760, 0x06AF, 0x9991, 0x065B, 0x9BBA, 0x060A, 0x9DDB, 0x05BB, 0x9FF3, 0x056E, 0xA203, 0x0523,
+    0xA40B, 0x04DA, 0xA60C, 0x0494, 0xA804, 0x0450, 0xA9F6, 0x040F, 0xABE1, 0x03D1, 0xADC5, 0x0395, 0xAFA0, 0x035C, 0xB174, 0x0325,
+    0xB343, 0x02F1, 0xB50E, 0x02C0, 0xB6D4, 0x0291, 0xB894, 0x0264, 0xBA4D, 0x023A, 0xBBFF, 0x0212, 0xBDAA, 0x01EB, 0xBF4E, 0x01C7,
+    0xC0EB, 0x01A5, 0xC280, 0x0184, 0xC40F, 0x0165, 0xC597, 0x0148, 0xC718, 0x012D, 0xC893, 0x0113, 0xCA09, 0x00FB, 0xCB7D, 0x00E5,
+    0xCCEA, 0x00D1, 0xCE52, 0x00BE, 0xCFB3, 0x00AC, 0xD10F, 0x009B, 0xD267, 0x008C, 0xD3BB, 0x007E, 0xD509, 0x0071, 0xD652, 0x0065,
+    0xD796, 0x005A, 0xD8D8, 0x0051, 0xDA15, 0x0048, 0xDB4D, 0x003F, 0xDC81, 0x0038, 0xDDAF, 0x0031, 0xDED9, 0x002B, 0xDFFF, 0x0026,
+    0xE120, 0x0021, 0xE23C, 0x001C, 0xE358, 0x0018, 0xE471, 0x0015, 0xE586, 0x0012, 0xE698, 0x000F, 0xE7A7, 0x000D, 0xE8B2, 0x000B,
+    0xE9BA, 0x0009, 0xEABD, 0x0008, 0xEBBC, 0x0006, 0xECB8, 0x0005, 0xEDB5, 0x0004, 0xEEAF, 0x0004, 0xEFA5, 0x0003, 0xF096, 0x0002,
+    0xF18A, 0x0002, 0xF27B, 0x0002, 0xF366, 0x0001, 0xF44A, 0x0001, 0xF528, 0x0001, 0xF5FC, 0x0001, 0xF6CE, 0x0000, 0xF7B9, 0x0000,
+    // roughness row 42
+    0x1B74, 0x0C24, 0x1C60, 0x0C8C, 0x1D5E, 0x0CF3, 0x1E6C, 0x0D58, 0x1F8C, 0x0DBB, 0x20BE, 0x0E1B, 0x2202, 0x0E78, 0x2358, 0x0ED2,
+    0x24BF, 0x0F28, 0x2639, 0x0F78, 0x27C4, 0x0FC2, 0x2961, 0x1009, 0x2B0F, 0x104B, 0x2CCE, 0x1086, 0x2E9E, 0x10B8, 0x307D, 0x10E4,
+    0x326C, 0x1109, 0x346B, 0x1128, 0x3677, 0x113E, 0x3890, 0x114D, 0x3AB7, 0x1154, 0x3CEA, 0x1156, 0x3F29, 0x1150, 0x4172, 0x1143,
+    0x43C4, 0x112D, 0x4620, 0x1111, 0x4885, 0x10F1, 0x4AF1, 0x10C8, 0x4D64, 0x109B, 0x4FDC, 0x1067, 0x525A, 0x102E, 0x54DB, 0x0FEF,
+    0x575F, 0x0FAC, 0x59E8, 0x0F65, 0x5C73, 0x0F1A, 0x5F00, 0x0ECD, 0x618E, 0x0E7C, 0x641D, 0x0E28, 0x66AC, 0x0DD2, 0x6939, 0x0D78,
+    0x6BC3, 0x0D1C, 0x6E4C, 0x0CBF, 0x70D2, 0x0C60, 0x7355, 0x0C01, 0x75D3, 0x0B9F, 0x784C, 0x0B3C, 0x7AC2, 0x0ADB, 0x7D34, 0x0A7A,
+    0x7FA4, 0x0A1A, 0x820E, 0x09BB, 0x8472, 0x095C, 0x86D0, 0x08FE, 0x8927, 0x08A0, 0x8B7A, 0x0845, 0x8DC6, 0x07EB, 0x900C, 0x0792,
+    0x924A, 0x073B, 0x9482, 0x06E6, 0x96B2, 0x0692, 0x98DD, 0x0641, 0x9B01, 0x05F2, 0x9D1F, 0x05A6, 0x9F34, 0x055B, 0xA142, 0x0513,
+    0xA348, 0x04CC, 0xA547, 0x0488, 0xA73D, 0x0446, 0xA92B, 0x0406, 0xAB12, 0x03C9, 0xACF2, 0x038E, 0xAECC, 0x0356, 0xB0A0, 0x0320,
+    0xB26B, 0x02EC, 0xB42F, 0x02BB, 0xB5EC, 0x028C, 0xB7A4, 0x025F, 0xB959, 0x0235, 0xBB09, 0x020E, 0xBCB2, 0x01E8, 0xBE56, 0x01C5,
+    0xBFF5, 0x01A3, 0xC18D, 0x0183, 0xC31F, 0x0165, 0xC4A9, 0x0149, 0xC62E, 0x012E, 0xC7AB, 0x0115, 0xC922, 0x00FD, 0xCA93, 0x00E7,
+    0xCBFE, 0x00D2, 0xCD65, 0x00BF, 0xCEC9, 0x00AE, 0xD028, 0x009D, 0xD182, 0x008E, 0xD2D6, 0x0080, 0xD424, 0x0073, 0xD56F, 0x0067,
+    0xD6B6, 0x005C, 0xD7F9, 0x0053, 0xD936, 0x0049, 0xDA6E, 0x0041, 0xDBA4, 0x003A, 0xDCD7, 0x0033, 0xDE04, 0x002D, 0xDF2D, 0x0027,
+    0xE052, 0x0022, 0xE172, 0x001E, 0xE28E, 0x001A, 0xE3A5, 0x0016, 0xE4B9, 0x0013, 0xE5CC, 0x0010, 0xE6DC, 0x000E, 0xE7E8, 0x000C,
+    0xE8EF, 0x000A, 0xE9F3, 0x0008, 0xEAF2, 0x0007, 0xEBF0, 0x0006, 0xECEA, 0x0005, 0xEDE1, 0x0004, 0xEED6, 0x0003, 0xEFCB, 0x0003,
+    0xF0BB, 0x0002, 0xF1A5, 0x0002, 0xF291, 0x0001, 0xF379, 0x0001, 0xF457, 0x0001, 0xF536, 0x0001, 0xF61B, 0x0001, 0xF6F5, 0x0000,
+    // roughness row 43
+    0x1D28, 0x0C49, 0x1E15, 0x0CAA, 0x1F12, 0x0D09, 0x2020, 0x0D66, 0x213E, 0x0DC1, 0x226E, 0x0E19, 0x23AE, 0x0E6E, 0x2500, 0x0EBF,
+    0x2663, 0x0F0D, 0x27D7, 0x0F56, 0x295C, 0x0F99, 0x2AF1, 0x0FD7, 0x2C98, 0x1011, 0x2E4F, 0x1045, 0x3015, 0x1072, 0x31EA, 0x1098,
+    0x33CE, 0x10B8, 0x35C0, 0x10D0, 0x37C0, 0x10E3, 0x39CD, 0x10EE, 0x3BE6, 0x10F2, 0x3E0B, 0x10EF, 0x403C, 0x10E7, 0x4277, 0x10D9,
+    0x44BB, 0x10C3, 0x4707, 0x10A6, 0x495C, 0x1083, 0x4BB9, 0x105C, 0x4E1C, 0x102E, 0x5085, 0x0FFC, 0x52F3, 0x0FC4, 0x5566, 0x0F87,
+    0x57DB, 0x0F46, 0x5A53, 0x0EFF, 0x5CCF, 0x0EB7, 0x5F4C, 0x0E6B, 0x61CB, 0x0E1C, 0x644B, 0x0DCB, 0x66CC, 0x0D78, 0x694C, 0x0D22,
+    0x6BCB, 0x0CCB, 0x6E47, 0x0C71, 0x70C1, 0x0C15, 0x7338, 0x0BB9, 0x75AC, 0x0B5C, 0x781C, 0x0AFE, 0x7A87, 0x0AA0, 0x7CEC, 0x0A40,
+    0x7F4D, 0x09E2, 0x81AB, 0x0984, 0x8406, 0x0929, 0x865C, 0x08CE, 0x88AC, 0x0874, 0x8AF5, 0x081C, 0x8D39, 0x07C4, 0x8F76, 0x076E,
+    0x91AF, 0x071A, 0x93E1, 0x06C7, 0x960B, 0x0677, 0x982F, 0x0627, 0x9A4C, 0x05DA, 0x9C62, 0x058F, 0x9E73, 0x0547, 0xA07E, 0x0501,
+    0xA282, 0x04BC, 0xA47D, 0x047A, 0xA672, 0x043A, 0xA85F, 0x03FC, 0xAA44, 0x03C0, 0xAC22, 0x0387, 0xADF8, 0x034F, 0xAFC8, 0x031A,
+    0xB191, 0x02E8, 0xB355, 0x02B7, 0xB512, 0x0289, 0xB6C8, 0x025D, 0xB876, 0x0233, 0xBA1F, 0x020B, 0xBBC1, 0x01E5, 0xBD61, 0x01C2,
+    0xBEFC, 0x01A1, 0xC092, 0x0182, 0xC224, 0x0164, 0xC3AF, 0x0149, 0xC534, 0x012E, 0xC6B4, 0x0116, 0xC82E, 0x00FE, 0xC9A2, 0x00E9,
+    0xCB10, 0x00D4, 0xCC78, 0x00C1, 0xCDDA, 0x00AF, 0xCF36, 0x009F, 0xD08E, 0x0090, 0xD1E4, 0x0082, 0xD336, 0x0075, 0xD483, 0x0069,
+    0xD5CA, 0x005E, 0xD70D, 0x0054, 0xD84C, 0x004B, 0xD988, 0x0043, 0xDABF, 0x003B, 0xDBF1, 0x0034, 0xDD1F, 0x002E, 0xDE49, 0x0028,
+    0xDF71, 0x0023, 0xE095, 0x001F, 0xE1B5, 0x001B, 0xE2D0, 0x0017, 0xE3E6, 0x0014, 0xE4F8, 0x0011, 0xE606, 0x000F, 0xE711, 0x000C,
+    0xE81C, 0x000B, 0xE923, 0x0009, 0xEA25, 0x0007, 0xEB23, 0x0006, 0xEC1D, 0x0005, 0xED11, 0x0004, 0xEE01, 0x0003, 0xEEEC, 0x0003,
+    0xEFD7, 0x0002, 0xF0C4, 0x0002, 0xF1AA, 0x0001, 0xF287, 0x0001, 0xF37A, 0x0001, 0xF46B, 0x0001, 0xF554, 0x0001, 0xF62B, 0x0000,
+    // roughness row 44
+    0x1EE6, 0x0C6A, 0x1FD2, 0x0CC4, 0x20CE, 0x0D1B, 0x21DB, 0x0D71, 0x22F8, 0x0DC4, 0x2425, 0x0E15, 0x2562, 0x0E62, 0x26B0, 0x0EAB,
+    0x280E, 0x0EF1, 0x297D, 0x0F33, 0x2AFB, 0x0F6E, 0x2C89, 0x0FA4, 0x2E27, 0x0FD7, 0x2FD5, 0x1005, 0x3192, 0x102D, 0x335D, 0x104E,
+    0x3536, 0x1068, 0x371D, 0x107C, 0x3911, 0x108A, 0x3B12, 0x1092, 0x3D1E, 0x1093, 0x3F35, 0x108D, 0x4157, 0x1081, 0x4384, 0x1071,
+    0x45BA, 0x105A, 0x47F8, 0x103E, 0x4A3D, 0x101A, 0x4C8A, 0x0FF1, 0x4EDE, 0x0FC4, 0x5138, 0x0F93, 0x5397, 0x0F5C, 0x55FA, 0x0F21,
+    0x5861, 0x0EE1, 0x5ACA, 0x0E9D, 0x5D36, 0x0E56, 0x5FA3, 0x0E0B, 0x6214, 0x0DBF, 0x6484, 0x0D70, 0x66F6, 0x0D1F, 0x6968, 0x0CCC,
+    0x6BD9, 0x0C78, 0x6E4A, 0x0C22, 0x70B8, 0x0BCB, 0x7322, 0x0B72, 0x758A, 0x0B18, 0x77EF, 0x0ABD, 0x7A51, 0x0A63, 0x7CAF, 0x0A09,
+    0x7F06, 0x09AD, 0x8158, 0x0952, 0x83A6, 0x08F8, 0x85EF, 0x089F, 0x8836, 0x0848, 0x8A77, 0x07F2, 0x8CB2, 0x079D, 0x8EE8, 0x074A,
+    0x9117, 0x06F8, 0x9341, 0x06A7, 0x9565, 0x0659, 0x9784, 0x060D, 0x999C, 0x05C2, 0x9BAD, 0x0579, 0x9DB7, 0x0532, 0x9FBA, 0x04ED,
+    0xA1B8, 0x04AB, 0xA3B1, 0x046B, 0xA5A3, 0x042D, 0xA78E, 0x03F1, 0xA971, 0x03B7, 0xAB4D, 0x037F, 0xAD23, 0x0349, 0xAEF1, 0x0315,
+    0xB0B7, 0x02E3, 0xB278, 0x02B3, 0xB432, 0x0286, 0xB5E6, 0x025A, 0xB795, 0x0231, 0xB93D, 0x020A, 0xBADF, 0x01E5, 0xBC79, 0x01C2,
+    0xBE0E, 0x01A0, 0xBF9E, 0x0181, 0xC129, 0x0163, 0xC2B3, 0x0148, 0xC435, 0x012E, 0xC5B6, 0x0115, 0xC731, 0x00FF, 0xC8A6, 0x00E9,
+    0xCA15, 0x00D5, 0xCB7D, 0x00C3, 0xCCE1, 0x00B1, 0xCE40, 0x00A1, 0xCF9A, 0x0092, 0xD0EE, 0x0083, 0xD23D, 0x0076, 0xD388, 0x006A,
+    0xD4D0, 0x0060, 0xD616, 0x0056, 0xD757, 0x004D, 0xD893, 0x0044, 0xD9CA, 0x003D, 0xDAFE, 0x0036, 0xDC2F, 0x002F, 0xDD5C, 0x002A,
+    0xDE83, 0x0025, 0xDFA7, 0x0020, 0xE0C7, 0x001C, 0xE1E5, 0x0018, 0xE2FF, 0x0015, 0xE415, 0x0012, 0xE526, 0x0010, 0xE632, 0x000D,
+    0xE73B, 0x000B, 0xE83E, 0x0009, 0xE942, 0x0008, 0xEA43, 0x0007, 0xEB3F, 0x0006, 0xEC36, 0x0005, 0xED27, 0x0004, 0xEE13, 0x0003,
+    0xEEF8, 0x0002, 0xEFD7, 0x0002, 0xF0BA, 0x0001, 0xF1A8, 0x0001, 0xF294, 0x0001, 0xF384, 0x0001, 0xF46F, 0x0001, 0xF562, 0x0000,
+    // roughness row 45
+    0x20AC, 0x0C87, 0x2198, 0x0CD9, 0x2293, 0x0D2A, 0x239E, 0x0D79, 0x24B8, 0x0DC5, 0x25E2, 0x0E0E, 0x271C, 0x0E53, 0x2866, 0x0E95,
+    0x29BF, 0x0ED3, 0x2B28, 0x0F0E, 0x2CA0, 0x0F44, 0x2E27, 0x0F73, 0x2FBD, 0x0F9E, 0x3162, 0x0FC6, 0x3316, 0x0FE9, 0x34D7, 0x1005,
+    0x36A6, 0x101A, 0x3881, 0x1029, 0x3A69, 0x1032, 0x3C5D, 0x1037, 0x3E5C, 0x1036, 0x4066, 0x102D, 0x427A, 0x101F, 0x4498, 0x100B,
+    0x46C0, 0x0FF4, 0x48F0, 0x0FD7, 0x4B27, 0x0FB4, 0x4D65, 0x0F8B, 0x4FA9, 0x0F5D, 0x51F3, 0x0F2B, 0x5443, 0x0EF6, 0x5697, 0x0EBC,
+    0x58EF, 0x0E7E, 0x5B4A, 0x0E3D, 0x5DA7, 0x0DF8, 0x6006, 0x0DB0, 0x6266, 0x0D64, 0x64C8, 0x0D17, 0x672A, 0x0CC8, 0x698D, 0x0C78,
+    0x6BF1, 0x0C26, 0x6E54, 0x0BD3, 0x70B5, 0x0B7F, 0x7315, 0x0B2A, 0x7572, 0x0AD5, 0x77CB, 0x0A7D, 0x7A20, 0x0A25, 0x7C73, 0x09CE,
+    0x7EC2, 0x0977, 0x810D, 0x0920, 0x8352, 0x08C9, 0x8590, 0x0872, 0x87CA, 0x081D, 0x8A01, 0x07C9, 0x8C33, 0x0777, 0x8E62, 0x0726,
+    0x9089, 0x06D7, 0x92AA, 0x0689, 0x94C6, 0x063C, 0x96DB, 0x05F1, 0x98EB, 0x05A8, 0x9AF7, 0x0562, 0x9CFD, 0x051E, 0x9EFC, 0x04DB,
+    0xA0F4, 0x049A, 0xA2E6, 0x045B, 0xA4D1, 0x041E, 0xA6B8, 0x03E3, 0xA89A, 0x03AB, 0xAA74, 0x0375, 0xAC48, 0x0341, 0xAE14, 0x030E,
+    0xAFD9, 0x02DD, 0xB199, 0x02AF, 0xB351, 0x0282, 0xB502, 0x0258, 0xB6AF, 0x022F, 0xB854, 0x0208, 0xB9F3, 0x01E4, 0xBB8F, 0x01C1,
+    0xBD25, 0x01A0, 0xBEB3, 0x0181, 0xC03B, 0x0164, 0xC1BF, 0x0148, 0xC33D, 0x012E, 0xC4B7, 0x0115, 0xC62E, 0x00FF, 0xC7A0, 0x00E9,
+    0xC90F, 0x00D6, 0xCA7B, 0x00C3, 0xCBE1, 0x00B2, 0xCD41, 0x00A2, 0xCE9C, 0x0093, 0xCFF1, 0x0085, 0xD141, 0x0078, 0xD28B, 0x006C,
+    0xD3D1, 0x0061, 0xD513, 0x0057, 0xD653, 0x004E, 0xD78F, 0x0045, 0xD8C9, 0x003E, 0xD9FE, 0x0037, 0xDB2F, 0x0031, 0xDC5B, 0x002B,
+    0xDD85, 0x0026, 0xDEAC, 0x0021, 0xDFCE, 0x001D, 0xE0EB, 0x0019, 0xE204, 0x0016, 0xE31A, 0x0013, 0xE42E, 0x0010, 0xE53E, 0x000E,
+    0xE649, 0x000C, 0xE74F, 0x000A, 0xE850, 0x0009, 0xE94D, 0x0007, 0xEA47, 0x0006, 0xEB40, 0x0005, 0xEC32, 0x0004, 0xED1E, 0x0003,
+    0xEE05, 0x0003, 0xEEF7, 0x0002, 0xEFE3, 0x0002, 0xF0C9, 0x0001, 0xF1B1, 0x0001, 0xF295, 0x0001, 0xF386, 0x0001, 0xF481, 0x0000,
+    // roughness row 46
+    0x227A, 0x0C9F, 0x2365, 0x0CEB, 0x245F, 0x0D35, 0x2568, 0x0D7D, 0x2680, 0x0DC2, 0x27A7, 0x0E04, 0x28DD, 0x0E42, 0x2A22, 0x0E7D,
+    0x2B76, 0x0EB5, 0x2CD9, 0x0EE8, 0x2E4B, 0x0F18, 0x2FCB, 0x0F42, 0x3158, 0x0F66, 0x32F4, 0x0F87, 0x349F, 0x0FA4, 0x3656, 0x0FBC,
+    0x381B, 0x0FCD, 0x39EB, 0x0FD9, 0x3BC7, 0x0FDE, 0x3DAE, 0x0FDE, 0x3FA1, 0x0FDA, 0x419F, 0x0FD0, 0x43A5, 0x0FC0, 0x45B5, 0x0FAA,
+    0x47CE, 0x0F90, 0x49EF, 0x0F72, 0x4C18, 0x0F4F, 0x4E48, 0x0F27, 0x507E, 0x0EFA, 0x52B8, 0x0EC8, 0x54F8, 0x0E92, 0x573E, 0x0E5A,
+    0x5986, 0x0E1D, 0x5BD2, 0x0DDE, 0x5E21, 0x0D9B, 0x6072, 0x0D55, 0x62C3, 0x0D0C, 0x6516, 0x0CC1, 0x6769, 0x0C73, 0x69BE, 0x0C25,
+    0x6C12, 0x0BD6, 0x6E66, 0x0B85, 0x70BA, 0x0B34, 0x730D, 0x0AE2, 0x755E, 0x0A90, 0x77AD, 0x0A3D, 0x79F8, 0x09E9, 0x7C3F, 0x0994,
+    0x7E82, 0x0940, 0x80C2, 0x08EC, 0x8300, 0x0899, 0x8538, 0x0846, 0x876A, 0x07F4, 0x8995, 0x07A2, 0x8BBC, 0x0751, 0x8DE0, 0x0702,
+    0x8FFE, 0x06B5, 0x921A, 0x066A, 0x942F, 0x0620, 0x963E, 0x05D7, 0x9846, 0x0590, 0x9A49, 0x054B, 0x9C45, 0x0508, 0x9E3E, 0x04C7,
+    0xA031, 0x0488, 0xA21E, 0x044B, 0xA405, 0x0410, 0xA5E6, 0x03D6, 0xA7C0, 0x039F, 0xA995, 0x036A, 0xAB66, 0x0337, 0xAD32, 0x0306,
+    0xAEF6, 0x02D7, 0xB0B4, 0x02AA, 0xB26A, 0x027E, 0xB41A, 0x0254, 0xB5C5, 0x022D, 0xB768, 0x0207, 0xB907, 0x01E2, 0xBA9F, 0x01C0,
+    0xBC31, 0x01A0, 0xBDBF, 0x0181, 0xBF49, 0x0164, 0xC0CC, 0x0149, 0xC249, 0x012F, 0xC3C0, 0x0116, 0xC533, 0x0100, 0xC6A1, 0x00EA,
+    0xC80B, 0x00D6, 0xC972, 0x00C4, 0xCAD4, 0x00B3, 0xCC35, 0x00A3, 0xCD90, 0x0094, 0xCEE7, 0x0086, 0xD03A, 0x007A, 0xD187, 0x006E,
+    0xD2CF, 0x0063, 0xD412, 0x0059, 0xD550, 0x004F, 0xD689, 0x0047, 0xD7BD, 0x003F, 0xD8F0, 0x0038, 0xDA1E, 0x0032, 0xDB4C, 0x002C,
+    0xDC77, 0x0027, 0xDD9C, 0x0022, 0xDEBE, 0x001E, 0xDFDE, 0x001A, 0xE0FA, 0x0017, 0xE211, 0x0014, 0xE324, 0x0011, 0xE431, 0x000F,
+    0xE53C, 0x000D, 0xE645, 0x000B, 0xE748, 0x0009, 0xE846, 0x0008, 0xE93E, 0x0006, 0xEA31, 0x0005, 0xEB1F, 0x0004, 0xEC1D, 0x0004,
+    0xED16, 0x0003, 0xEE0A, 0x0002, 0xEEF8, 0x0002, 0xEFDE, 0x0001, 0xF0CB, 0x0001, 0xF1B8, 0x0001, 0xF2A3, 0x0001, 0xF38C, 0x0000,
+    // roughness row 47
+    0x244F, 0x0CB4, 0x2539, 0x0CFA, 0x2631, 0x0D3D, 0x2738, 0x0D7E, 0x284D, 0x0DBC, 0x2971, 0x0DF8, 0x2AA3, 0x0E30, 0x2BE4, 0x0E64,
+    0x2D32, 0x0E95, 0x2E8F, 0x0EC2, 0x2FFA, 0x0EEB, 0x3173, 0x0F10, 0x32F9, 0x0F2F, 0x348C, 0x0F49, 0x362D, 0x0F61, 0x37DB, 0x0F74,
+    0x3995, 0x0F82, 0x3B5A, 0x0F8A, 0x3D2B, 0x0F8C, 0x3F07, 0x0F89, 0x40EC, 0x0F80, 0x42DD, 0x0F74, 0x44D7, 0x0F63, 0x46D9, 0x0F4C,
+    0x48E3, 0x0F30, 0x4AF6, 0x0F10, 0x4D10, 0x0EED, 0x4F32, 0x0EC5, 0x5159, 0x0E99, 0x5385, 0x0E68, 0x55B6, 0x0E32, 0x57EB, 0x0DFA,
+    0x5A26, 0x0DC0, 0x5C63, 0x0D81, 0x5EA3, 0x0D40, 0x60E5, 0x0CFC, 0x6329, 0x0CB6, 0x656D, 0x0C6D, 0x67B3, 0x0C22, 0x69F8, 0x0BD5,
+    0x6C3D, 0x0B87, 0x6E83, 0x0B39, 0x70C8, 0x0AEA, 0x730D, 0x0A9A, 0x7551, 0x0A4B, 0x7793, 0x09FB, 0x79D4, 0x09AB, 0x7C11, 0x095A,
+    0x7E4B, 0x0909, 0x8080, 0x08B8, 0x82B1, 0x0867, 0x84DE, 0x0817, 0x8709, 0x07C9, 0x892F, 0x077B, 0x8B4F, 0x072D, 0x8D68, 0x06E0,
+    0x8F7C, 0x0694, 0x918D, 0x064A, 0x9398, 0x0602, 0x95A2, 0x05BD, 0x97A5, 0x0578, 0x99A2, 0x0535, 0x9B99, 0x04F4, 0x9D89, 0x04B4,
+    0x9F74, 0x0476, 0xA159, 0x043A, 0xA33B, 0x0401, 0xA518, 0x03C9, 0xA6ED, 0x0393, 0xA8BE, 0x035F, 0xAA87, 0x032D, 0xAC4A, 0x02FD,
+    0xAE0A, 0x02CF, 0xAFC6, 0x02A3, 0xB17D, 0x0279, 0xB32C, 0x0250, 0xB4D5, 0x022A, 0xB678, 0x0204, 0xB813, 0x01E1, 0xB9AA, 0x01BF,
+    0xBB3B, 0x019F, 0xBCC7, 0x0181, 0xBE4D, 0x0164, 0xBFCD, 0x0149, 0xC14B, 0x012F, 0xC2C4, 0x0118, 0xC436, 0x0101, 0xC5A3, 0x00EC,
+    0xC70A, 0x00D8, 0xC86E, 0x00C5, 0xC9CC, 0x00B4, 0xCB27, 0x00A4, 0xCC7F, 0x0095, 0xCDD3, 0x0087, 0xCF24, 0x007B, 0xD072, 0x006F,
+    0xD1BA, 0x0064, 0xD2FF, 0x005A, 0xD43F, 0x0051, 0xD57B, 0x0048, 0xD6B2, 0x0041, 0xD7E3, 0x0039, 0xD910, 0x0033, 0xDA39, 0x002D,
+    0xDB60, 0x0028, 0xDC82, 0x0023, 0xDDA3, 0x001F, 0xDEBF, 0x001B, 0xDFD7, 0x0017, 0xE0EF, 0x0014, 0xE204, 0x0012, 0xE313, 0x000F,
+    0xE41E, 0x000D, 0xE523, 0x000B, 0xE622, 0x000A, 0xE721, 0x0008, 0xE819, 0x0007, 0xE91C, 0x0006, 0xEA1A, 0x0005, 0xEB14, 0x0004,
+    0xEC0B, 0x0003, 0xED01, 0x0003, 0xEDFD, 0x0002, 0xEEF4, 0x0002, 0xEFE4, 0x0001, 0xF0CB, 0x0001, 0xF1AE, 0x0001, 0xF297, 0x0000,
+    // roughness row 48
+    0x262C, 0x0CC5, 0x2714, 0x0D05, 0x280A, 0x0D42, 0x290E, 0x0D7C, 0x2A21, 0x0DB4, 0x2B41, 0x0DE9, 0x2C6F, 0x0E1B, 0x2DAA, 0x0E49,
+    0x2EF4, 0x0E73, 0x304B, 0x0E9B, 0x31AF, 0x0EBE, 0x3320, 0x0EDE, 0x349F, 0x0EF8, 0x3629, 0x0F0C, 0x37C0, 0x0F1E, 0x3964, 0x0F2D,
+    0x3B14, 0x0F38, 0x3CCF, 0x0F3C, 0x3E94, 0x0F3B, 0x4064, 0x0F35, 0x423E, 0x0F2A, 0x4421, 0x0F1B, 0x460D, 0x0F08, 0x4803, 0x0EF0,
+    0x49FF, 0x0ED3, 0x4C04, 0x0EB2, 0x4E0F, 0x0E8C, 0x5022, 0x0E65, 0x523B, 0x0E39, 0x5459, 0x0E09, 0x567C, 0x0DD5, 0x58A3, 0x0D9E,
+    0x5ACD, 0x0D63, 0x5CFC, 0x0D26, 0x5F2E, 0x0CE8, 0x6161, 0x0CA5, 0x6396, 0x0C61, 0x65CD, 0x0C1B, 0x6804, 0x0BD2, 0x6A3B, 0x0B88,
+    0x6C73, 0x0B3C, 0x6EAA, 0x0AEF, 0x70E1, 0x0AA2, 0x7317, 0x0A55, 0x754D, 0x0A07, 0x7782, 0x09B9, 0x79B5, 0x096C, 0x7BE7, 0x091F,
+    0x7E16, 0x08D1, 0x8042, 0x0884, 0x826A, 0x0837, 0x848D, 0x07E9, 0x86AC, 0x079D, 0x88C7, 0x0751, 0x8AE0, 0x0707, 0x8CF4, 0x06BD,
+    0x8F02, 0x0675, 0x9109, 0x062D, 0x930A, 0x05E6, 0x9509, 0x05A1, 0x9703, 0x055E, 0x98F9, 0x051E, 0x9AEC, 0x04DF, 0x9CD8, 0x04A1,
+    0x9EBD, 0x0465, 0xA09D, 0x042B, 0xA276, 0x03F2, 0xA449, 0x03BB, 0xA61A, 0x0387, 0xA7E7, 0x0354, 0xA9AD, 0x0324, 0xAB6D, 0x02F5,
+    0xAD28, 0x02C8, 0xAEDC, 0x029C, 0xB08C, 0x0272, 0xB237, 0x024B, 0xB3DF, 0x0225, 0xB581, 0x0201, 0xB71C, 0x01DF, 0xB8B0, 0x01BE,
+    0xBA3F, 0x019E, 0xBBC8, 0x0180, 0xBD4C, 0x0164, 0xBECB, 0x0149, 0xC046, 0x0130, 0xC1BB, 0x0118, 0xC32B, 0x0101, 0xC499, 0x00ED,
+    0xC602, 0x00D9, 0xC764, 0x00C7, 0xC8C1, 0x00B5, 0xCA1A, 0x00A5, 0xCB6F, 0x0096, 0xCCBE, 0x0089, 0xCE0B, 0x007C, 0xCF56, 0x0070,
+    0xD09D, 0x0065, 0xD1E0, 0x005B, 0xD31E, 0x0052, 0xD45A, 0x004A, 0xD590, 0x0042, 0xD6C3, 0x003B, 0xD7F2, 0x0034, 0xD91C, 0x002E,
+    0xDA41, 0x0029, 0xDB61, 0x0024, 0xDC7F, 0x0020, 0xDD99, 0x001C, 0xDEAF, 0x0018, 0xDFC3, 0x0015, 0xE0D2, 0x0012, 0xE1DD, 0x0010,
+    0xE2E6, 0x000E, 0xE3E8, 0x000C, 0xE4E7, 0x000A, 0xE5F2, 0x0009, 0xE6F7, 0x0007, 0xE7FB, 0x0006, 0xE8FC, 0x0005, 0xE9FA, 0x0004,
+    0xEAFB, 0x0003, 0xEBF7, 0x0003, 0xECF6, 0x0002, 0xEDEF, 0x0002, 0xEEE2, 0x0001, 0xEFCB, 0x0001, 0xF0B4, 0x0001, 0xF1A0, 0x0001,
+    // roughness row 49
+    0x280E, 0x0CD2, 0x28F5, 0x0D0C, 0x29E9, 0x0D43, 0x2AEA, 0x0D78, 0x2BF9, 0x0DAA, 0x2D15, 0x0DD9, 0x2E3F, 0x0E05, 0x2F76, 0x0E2D,
+    0x30B9, 0x0E51, 0x320A, 0x0E73, 0x3368, 0x0E91, 0x34D2, 0x0EAB, 0x3648, 0x0EC1, 0x37CA, 0x0ED1, 0x3958, 0x0EDD, 0x3AF2, 0x0EE7,
+    0x3C97, 0x0EEE, 0x3E48, 0x0EF0, 0x4002, 0x0EEC, 0x41C6, 0x0EE4, 0x4394, 0x0ED6, 0x456A, 0x0EC5, 0x474A, 0x0EAF, 0x4932, 0x0E96,
+    0x4B21, 0x0E78, 0x4D18, 0x0E56, 0x4F15, 0x0E30, 0x5119, 0x0E06, 0x5323, 0x0DDB, 0x5533, 0x0DAC, 0x5748, 0x0D7A, 0x5961, 0x0D44,
+    0x5B7D, 0x0D0A, 0x5D9B, 0x0CCE, 0x5FBE, 0x0C90, 0x61E4, 0x0C51, 0x640B, 0x0C0E, 0x6634, 0x0BCA, 0x685E, 0x0B84, 0x6A88, 0x0B3C,
+    0x6CB1, 0x0AF3, 0x6EDA, 0x0AA8, 0x7103, 0x0A5D, 0x732B, 0x0A11, 0x7552, 0x09C5, 0x7779, 0x0979, 0x799E, 0x092E, 0x7BC3, 0x08E3,
+    0x7DE7, 0x0899, 0x8007, 0x084E, 0x8225, 0x0804, 0x8440, 0x07BB, 0x8656, 0x0771, 0x8868, 0x0728, 0x8A75, 0x06E0, 0x8C7E, 0x0699,
+    0x8E85, 0x0653, 0x9087, 0x060E, 0x9283, 0x05CB, 0x9479, 0x0588, 0x9669, 0x0546, 0x9855, 0x0506, 0x9A3E, 0x04C9, 0x9C22, 0x048D,
+    0x9E04, 0x0453, 0x9FDF, 0x041B, 0xA1B4, 0x03E4, 0xA384, 0x03AF, 0xA54E, 0x037B, 0xA710, 0x0349, 0xA8CE, 0x0319, 0xAA8B, 0x02EB,
+    0xAC42, 0x02C0, 0xADF4, 0x0295, 0xAFA0, 0x026D, 0xB147, 0x0246, 0xB2E7, 0x0220, 0xB484, 0x01FD, 0xB61D, 0x01DB, 0xB7B2, 0x01BC,
+    0xB941, 0x019D, 0xBACA, 0x0180, 0xBC4C, 0x0164, 0xBDC8, 0x0149, 0xBF3F, 0x0130, 0xC0B0, 0x0118, 0xC21E, 0x0102, 0xC387, 0x00EE,
+    0xC4EB, 0x00DA, 0xC64B, 0x00C8, 0xC7AA, 0x00B7, 0xC903, 0x00A7, 0xCA57, 0x0098, 0xCBA5, 0x008A, 0xCCF0, 0x007D, 0xCE36, 0x0071,
+    0xCF78, 0x0066, 0xD0B7, 0x005C, 0xD1F4, 0x0053, 0xD32E, 0x004B, 0xD464, 0x0043, 0xD595, 0x003C, 0xD6C1, 0x0035, 0xD7EA, 0x002F,
+    0xD90E, 0x002A, 0xDA2E, 0x0025, 0xDB4B, 0x0021, 0xDC62, 0x001C, 0xDD75, 0x0019, 0xDE86, 0x0016, 0xDF91, 0x0013, 0xE098, 0x0010,
+    0xE19F, 0x000E, 0xE2AD, 0x000C, 0xE3BC, 0x000A, 0xE4C6, 0x0009, 0xE5CA, 0x0008, 0xE6D1, 0x0006, 0xE7D5, 0x0005, 0xE8DA, 0x0004,
+    0xE9DF, 0x0004, 0xEADE, 0x0003, 0xEBD7, 0x0002, 0xECCC, 0x0002, 0xEDC4, 0x0002, 0xEEBF, 0x0001, 0xEFB0, 0x0001, 0xF09A, 0x0001,
+    // roughness row 50
+    0x29F7, 0x0CDC, 0x2ADB, 0x0D10, 0x2BCD, 0x0D42, 0x2CCB, 0x0D70, 0x2DD6, 0x0D9D, 0x2EEE, 0x0DC6, 0x3014, 0x0DEC, 0x3145, 0x0E0F,
+    0x3283, 0x0E2E, 0x33CD, 0x0E4A, 0x3524, 0x0E63, 0x3687, 0x0E78, 0x37F5, 0x0E8A, 0x396F, 0x0E96, 0x3AF3, 0x0E9E, 0x3C83, 0x0EA3,
+    0x3E1E, 0x0EA5, 0x3FC4, 0x0EA4, 0x4174, 0x0E9E, 0x432C, 0x0E93, 0x44EE, 0x0E84, 0x46B9, 0x0E71, 0x488B, 0x0E59, 0x4A66, 0x0E3E,
+    0x4C48, 0x0E1F, 0x4E32, 0x0DFD, 0x5021, 0x0DD7, 0x5216, 0x0DAD, 0x5412, 0x0D80, 0x5613, 0x0D51, 0x5819, 0x0D20, 0x5A24, 0x0CEB,
+    0x5C33, 0x0CB4, 0x5E44, 0x0C79, 0x6057, 0x0C3B, 0x626D, 0x0BFC, 0x6487, 0x0BBD, 0x66A2, 0x0B7B, 0x68BE, 0x0B37, 0x6ADB, 0x0AF2,
+    0x6CF7, 0x0AAC, 0x6F14, 0x0A64, 0x712E, 0x0A1A, 0x7348, 0x09D0, 0x7561, 0x0986, 0x777A, 0x093C, 0x7992, 0x08F2, 0x7BA8, 0x08A9,
+    0x7DBD, 0x0860, 0x7FD2, 0x0818, 0x81E5, 0x07D1, 0x83F4, 0x078A, 0x8601, 0x0744, 0x880A, 0x06FF, 0x8A0F, 0x06B9, 0x8C0F, 0x0674,
+    0x8E0B, 0x0631, 0x9004, 0x05EE, 0x91F8, 0x05AD, 0x93E9, 0x056D, 0x95D4, 0x052E, 0x97B9, 0x04F1, 0x9998, 0x04B4, 0x9B72, 0x0479,
+    0x9D4B, 0x0440, 0x9F1E, 0x0409, 0xA0EE, 0x03D5, 0xA2BA, 0x03A1, 0xA47F, 0x036F, 0xA63F, 0x033F, 0xA7FA, 0x0310, 0xA9AE, 0x02E3,
+    0xAB5B, 0x02B7, 0xAD05, 0x028E, 0xAEAE, 0x0266, 0xB051, 0x0240, 0xB1F0, 0x021C, 0xB389, 0x01F9, 0xB51C, 0x01D8, 0xB6AB, 0x01B8,
+    0xB835, 0x019A, 0xB9BE, 0x017E, 0xBB41, 0x0163, 0xBCBE, 0x0149, 0xBE35, 0x0131, 0xBFA6, 0x011A, 0xC111, 0x0104, 0xC276, 0x00EF,
+    0xC3D6, 0x00DB, 0xC535, 0x00C9, 0xC68E, 0x00B8, 0xC7E2, 0x00A8, 0xC935, 0x0099, 0xCA83, 0x008C, 0xCBCC, 0x007F, 0xCD0F, 0x0073,
+    0xCE4E, 0x0068, 0xCF8A, 0x005E, 0xD0C2, 0x0054, 0xD1F5, 0x004C, 0xD326, 0x0044, 0xD457, 0x003D, 0xD583, 0x0036, 0xD6AB, 0x0030,
+    0xD7CD, 0x002B, 0xD8EA, 0x0026, 0xDA03, 0x0021, 0xDB17, 0x001D, 0xDC26, 0x001A, 0xDD31, 0x0016, 0xDE3D, 0x0013, 0xDF53, 0x0011,
+    0xE064, 0x000F, 0xE16F, 0x000D, 0xE27E, 0x000B, 0xE38E, 0x0009, 0xE4A0, 0x0008, 0xE5AC, 0x0007, 0xE6B3, 0x0006, 0xE7B5, 0x0005,
+    0xE8B1, 0x0004, 0xE9AA, 0x0003, 0xEAA1, 0x0002, 0xEBA1, 0x0002, 0xEC9D, 0x0002, 0xEDA6, 0x0001, 0xEEA5, 0x0001, 0xEF94, 0x0001,
+    // roughness row 51
+    0x2BE5, 0x0CE3, 0x2CC6, 0x0D11, 0x2DB5, 0x0D3D, 0x2EB0, 0x0D66, 0x2FB8, 0x0D8D, 0x30CC, 0x0DB1, 0x31EC, 0x0DD2, 0x3318, 0x0DF0,
+    0x3450, 0x0E0A, 0x3594, 0x0E21, 0x36E4, 0x0E35, 0x383F, 0x0E45, 0x39A6, 0x0E53, 0x3B17, 0x0E5C, 0x3C92, 0x0E60, 0x3E18, 0x0E60,
+    0x3FA9, 0x0E5E, 0x4144, 0x0E59, 0x42E9, 0x0E52, 0x4496, 0x0E45, 0x464C, 0x0E34, 0x480B, 0x0E1F, 0x49D1, 0x0E06, 0x4B9F, 0x0DE9,
+    0x4D74, 0x0DC9, 0x4F50, 0x0DA6, 0x5132, 0x0D80, 0x531A, 0x0D56, 0x5507, 0x0D29, 0x56F9, 0x0CF9, 0x58F0, 0x0CC7, 0x5AED, 0x0C94,
+    0x5CEE, 0x0C5E, 0x5EF1, 0x0C25, 0x60F7, 0x0BEA, 0x62FE, 0x0BAC, 0x6508, 0x0B6C, 0x6715, 0x0B2C, 0x6924, 0x0AEC, 0x6B33, 0x0AA8,
+    0x6D42, 0x0A64, 0x6F52, 0x0A20, 0x7161, 0x09D9, 0x736F, 0x0992, 0x757A, 0x094A, 0x7785, 0x0901, 0x798E, 0x08B9, 0x7B97, 0x0871,
+    0x7D9E, 0x082A, 0x7FA4, 0x07E4, 0x81A9, 0x079E, 0x83AD, 0x075A, 0x85AF, 0x0716, 0x87AE, 0x06D3, 0x89AA, 0x0691, 0x8BA2, 0x0650,
+    0x8D96, 0x060E, 0x8F85, 0x05CE, 0x9170, 0x058F, 0x9357, 0x0551, 0x953B, 0x0514, 0x971A, 0x04D9, 0x98F5, 0x049F, 0x9AC9, 0x0466,
+    0x9C98, 0x042F, 0x9E61, 0x03F8, 0xA029, 0x03C5, 0xA1EB, 0x0392, 0xA3AB, 0x0362, 0xA567, 0x0333, 0xA71E, 0x0306, 0xA8CE, 0x02DB,
+    0xAA7A, 0x02B0, 0xAC20, 0x0288, 0xADBF, 0x0260, 0xAF5A, 0x023A, 0xB0F1, 0x0217, 0xB286, 0x01F5, 0xB417, 0x01D4, 0xB5A3, 0x01B6,
+    0xB729, 0x0198, 0xB8AA, 0x017C, 0xBA28, 0x0161, 0xBBA2, 0x0148, 0xBD19, 0x0130, 0xBE8B, 0x011A, 0xBFF7, 0x0105, 0xC15D, 0x00F0,
+    0xC2BE, 0x00DD, 0xC418, 0x00CB, 0xC56D, 0x00BA, 0xC6BF, 0x00AA, 0xC80D, 0x009B, 0xC956, 0x008D, 0xCA9B, 0x0080, 0xCBE0, 0x0075,
+    0xCD1F, 0x006A, 0xCE59, 0x005F, 0xCF8D, 0x0056, 0xD0BE, 0x004D, 0xD1EB, 0x0045, 0xD313, 0x003E, 0xD437, 0x0037, 0xD558, 0x0031,
+    0xD679, 0x002C, 0xD794, 0x0027, 0xD8AA, 0x0022, 0xD9BA, 0x001E, 0xDACF, 0x001B, 0xDBE4, 0x0017, 0xDCF8, 0x0014, 0xDE08, 0x0011,
+    0xDF1C, 0x000F, 0xE033, 0x000D, 0xE146, 0x000B, 0xE253, 0x0009, 0xE35F, 0x0008, 0xE468, 0x0007, 0xE572, 0x0006, 0xE677, 0x0005,
+    0xE776, 0x0004, 0xE87D, 0x0003, 0xE980, 0x0003, 0xEA84, 0x0002, 0xEB84, 0x0002, 0xEC7B, 0x0001, 0xED7E, 0x0001, 0xEE6F, 0x0001,
+    // roughness row 52
+    0x2DD7, 0x0CE6, 0x2EB6, 0x0D0F, 0x2FA2, 0x0D36, 0x3099, 0x0D5A, 0x319D, 0x0D7C, 0x32AC, 0x0D9B, 0x33C7, 0x0DB7, 0x34EE, 0x0DD0,
+    0x3620, 0x0DE5, 0x375E, 0x0DF7, 0x38A6, 0x0E06, 0x39FA, 0x0E12, 0x3B58, 0x0E1C, 0x3CC1, 0x0E21, 0x3E34, 0x0E22, 0x3FB1, 0x0E1F,
+    0x4137, 0x0E18, 0x42C7, 0x0E11, 0x4461, 0x0E06, 0x4604, 0x0DF8, 0x47AE, 0x0DE5, 0x4961, 0x0DCE, 0x4B1B, 0x0DB4, 0x4CDC, 0x0D97,
+    0x4EA4, 0x0D75, 0x5072, 0x0D51, 0x5247, 0x0D2B, 0x5422, 0x0D02, 0x5601, 0x0CD4, 0x57E5, 0x0CA4, 0x59CE, 0x0C72, 0x5BBB, 0x0C3E,
+    0x5DAE, 0x0C0A, 0x5FA3, 0x0BD3, 0x619C, 0x0B9A, 0x6396, 0x0B5E, 0x6592, 0x0B20, 0x678F, 0x0AE0, 0x698E, 0x0AA0, 0x6B91, 0x0A60,
+    0x6D93, 0x0A1E, 0x6F95, 0x09DC, 0x7198, 0x0998, 0x739A, 0x0954, 0x759A, 0x090F, 0x7799, 0x08C9, 0x7996, 0x0883, 0x7B91, 0x083D,
+    0x7D8A, 0x07F7, 0x7F82, 0x07B2, 0x8178, 0x076D, 0x836D, 0x072A, 0x8561, 0x06E8, 0x8755, 0x06A7, 0x8947, 0x0668, 0x8B35, 0x0629,
+    0x8D21, 0x05EB, 0x8F08, 0x05AD, 0x90EA, 0x0570, 0x92C9, 0x0535, 0x94A3, 0x04FA, 0x967A, 0x04C1, 0x984D, 0x0489, 0x9A1C, 0x0452,
+    0x9BE5, 0x041D, 0x9DAA, 0x03E9, 0x9F68, 0x03B6, 0xA121, 0x0384, 0xA2D9, 0x0355, 0xA48C, 0x0327, 0xA63C, 0x02FB, 0xA7E8, 0x02D1,
+    0xA990, 0x02A8, 0xAB32, 0x0280, 0xACD0, 0x025A, 0xAE67, 0x0236, 0xAFF9, 0x0213, 0xB185, 0x01F1, 0xB30E, 0x01D0, 0xB493, 0x01B2,
+    0xB615, 0x0195, 0xB794, 0x017A, 0xB90E, 0x015F, 0xBA82, 0x0147, 0xBBF2, 0x012F, 0xBD60, 0x0119, 0xBECA, 0x0104, 0xC031, 0x00F0,
+    0xC191, 0x00DE, 0xC2ED, 0x00CC, 0xC442, 0x00BB, 0xC592, 0x00AC, 0xC6DD, 0x009D, 0xC822, 0x008F, 0xC964, 0x0082, 0xCAA1, 0x0076,
+    0xCBDB, 0x006B, 0xCD13, 0x0061, 0xCE48, 0x0057, 0xCF77, 0x004F, 0xD0A1, 0x0047, 0xD1C6, 0x003F, 0xD2E8, 0x0039, 0xD403, 0x0032,
+    0xD51A, 0x002D, 0xD62E, 0x0028, 0xD74D, 0x0023, 0xD86C, 0x001F, 0xD987, 0x001B, 0xDAA6, 0x0018, 0xDBC0, 0x0015, 0xDCD4, 0x0012,
+    0xDDE4, 0x0010, 0xDEF1, 0x000D, 0xDFFB, 0x000B, 0xE105, 0x000A, 0xE20D, 0x0008, 0xE315, 0x0007, 0xE421, 0x0006, 0xE534, 0x0005,
+    0xE646, 0x0004, 0xE753, 0x0003, 0xE85A, 0x0003, 0xE95B, 0x0002, 0xEA57, 0x0002, 0xEB52, 0x0001, 0xEC41, 0x0001, 0xED29, 0x0001,
+    // roughness row 53
+    0x2FCD, 0x0CE6, 0x30AA, 0x0D0B, 0x3192, 0x0D2C, 0x3285, 0x0D4C, 0x3385, 0x0D68, 0x348F, 0x0D82, 0x35A6, 0x0D9A, 0x36C7, 0x0DAE,
+    0x37F3, 0x0DBF, 0x392A, 0x0DCC, 0x3A6B, 0x0DD7, 0x3BB7, 0x0DDF, 0x3D0E, 0x0DE5, 0x3E6E, 0x0DE7, 0x3FD8, 0x0DE5, 0x414B, 0x0DDF,
+    0x42C7, 0x0DD5, 0x444D, 0x0DC9, 0x45DB, 0x0DBC, 0x4773, 0x0DAC, 0x4913, 0x0D98, 0x4AB9, 0x0D80, 0x4C67, 0x0D65, 0x4E1C, 0x0D46,
+    0x4FD8, 0x0D24, 0x5199, 0x0CFF, 0x5360, 0x0CD8, 0x552E, 0x0CAF, 0x5700, 0x0C83, 0x58D7, 0x0C53, 0x5AB1, 0x0C21, 0x5C90, 0x0BED,
+    0x5E72, 0x0BB7, 0x605A, 0x0B82, 0x6244, 0x0B4A, 0x6432, 0x0B11, 0x6620, 0x0AD5, 0x6810, 0x0A97, 0x6A01, 0x0A58, 0x6BF3, 0x0A18,
+    0x6DE8, 0x09D9, 0x6FDD, 0x0999, 0x71D3, 0x0958, 0x73C8, 0x0916, 0x75BD, 0x08D4, 0x77B0, 0x0891, 0x79A2, 0x084E, 0x7B91, 0x080A,
+    0x7D7F, 0x07C7, 0x7F6A, 0x0783, 0x8154, 0x0741, 0x833C, 0x06FF, 0x8521, 0x06BD, 0x8704, 0x067D, 0x88E7, 0x063E, 0x8ACA, 0x0601,
+    0x8CAC, 0x05C6, 0x8E89, 0x058B, 0x9065, 0x0551, 0x923C, 0x0518, 0x940D, 0x04DF, 0x95DC, 0x04A8, 0x97A6, 0x0472, 0x996C, 0x043D,
+    0x9B2F, 0x0409, 0x9CEE, 0x03D7, 0x9EA8, 0x03A6, 0xA05B, 0x0376, 0xA20A, 0x0348, 0xA3B4, 0x031B, 0xA55B, 0x02EF, 0xA6FF, 0x02C6,
+    0xA8A0, 0x029E, 0xAA3D, 0x0278, 0xABD6, 0x0253, 0xAD6A, 0x0230, 0xAEF9, 0x020E, 0xB083, 0x01ED, 0xB208, 0x01CE, 0xB386, 0x01AF,
+    0xB500, 0x0192, 0xB678, 0x0177, 0xB7EB, 0x015D, 0xB95C, 0x0145, 0xBAC8, 0x012E, 0xBC30, 0x0118, 0xBD93, 0x0103, 0xBEF4, 0x00F0,
+    0xC051, 0x00DD, 0xC1AC, 0x00CC, 0xC301, 0x00BC, 0xC451, 0x00AD, 0xC59C, 0x009E, 0xC6E1, 0x0091, 0xC820, 0x0084, 0xC95A, 0x0078,
+    0xCA90, 0x006D, 0xCBC2, 0x0062, 0xCCED, 0x0059, 0xCE17, 0x0050, 0xCF40, 0x0048, 0xD064, 0x0041, 0xD181, 0x003A, 0xD29A, 0x0034,
+    0xD3BE, 0x002E, 0xD4DD, 0x0029, 0xD600, 0x0024, 0xD721, 0x0020, 0xD840, 0x001C, 0xD961, 0x0019, 0xDA7D, 0x0016, 0xDB93, 0x0013,
+    0xDCA6, 0x0010, 0xDDB6, 0x000E, 0xDEC2, 0x000C, 0xDFC8, 0x000A, 0xE0D4, 0x0009, 0xE1E5, 0x0007, 0xE2F0, 0x0006, 0xE3FA, 0x0005,
+    0xE503, 0x0004, 0xE610, 0x0004, 0xE719, 0x0003, 0xE81C, 0x0002, 0xE918, 0x0002, 0xEA09, 0x0001, 0xEAF8, 0x0001, 0xEBE8, 0x0001,
+    // roughness row 54
+    0x31C8, 0x0CE4, 0x32A1, 0x0D03, 0x3385, 0x0D20, 0x3475, 0x0D3B, 0x3570, 0x0D53, 0x3675, 0x0D68, 0x3786, 0x0D7B, 0x38A2, 0x0D8B,
+    0x39C8, 0x0D98, 0x3AF8, 0x0DA2, 0x3C32, 0x0DA8, 0x3D76, 0x0DAC, 0x3EC5, 0x0DAE, 0x401D, 0x0DAD, 0x417E, 0x0DA8, 0x42E8, 0x0DA0,
+    0x445A, 0x0D93, 0x45D5, 0x0D84, 0x4758, 0x0D73, 0x48E4, 0x0D61, 0x4A79, 0x0D4C, 0x4C14, 0x0D33, 0x4DB6, 0x0D17, 0x4F5F, 0x0CF7,
+    0x510E, 0x0CD5, 0x52C3, 0x0CB0, 0x547D, 0x0C88, 0x563D, 0x0C5E, 0x5802, 0x0C32, 0x59CC, 0x0C04, 0x5B99, 0x0BD3, 0x5D6A, 0x0B9F,
+    0x5F3F, 0x0B6A, 0x6116, 0x0B33, 0x62F2, 0x0AFC, 0x64D1, 0x0AC4, 0x66B3, 0x0A8B, 0x6896, 0x0A50, 0x6A79, 0x0A13, 0x6C5E, 0x09D5,
+    0x6E43, 0x0996, 0x7029, 0x0956, 0x7212, 0x0918, 0x73FA, 0x08D9, 0x75E2, 0x0899, 0x77CA, 0x0859, 0x79B0, 0x0818, 0x7B95, 0x07D8,
+    0x7D78, 0x0797, 0x7F58, 0x0756, 0x8136, 0x0715, 0x8312, 0x06D5, 0x84EB, 0x0695, 0x86C3, 0x0657, 0x8897, 0x0619, 0x8A6A, 0x05DC,
+    0x8C3C, 0x05A1, 0x8E0F, 0x0568, 0x8FDF, 0x0530, 0x91AB, 0x04F9, 0x9376, 0x04C3, 0x953D, 0x048E, 0x96FF, 0x045A, 0x98BD, 0x0427,
+    0x9A77, 0x03F5, 0x9C2D, 0x03C4, 0x9DE0, 0x0395, 0x9F90, 0x0368, 0xA13A, 0x033B, 0xA2DF, 0x030F, 0xA47E, 0x02E5, 0xA618, 0x02BC,
+    0xA7AE, 0x0294, 0xA944, 0x026F, 0xAAD6, 0x024B, 0xAC64, 0x0229, 0xADEE, 0x0208, 0xAF74, 0x01E8, 0xB0F5, 0x01C9, 0xB273, 0x01AC,
+    0xB3EA, 0x0190, 0xB55B, 0x0175, 0xB6C7, 0x015C, 0xB831, 0x0143, 0xB997, 0x012C, 0xBAF9, 0x0117, 0xBC59, 0x0103, 0xBDB3, 0x00EF,
+    0xBF08, 0x00DD, 0xC05C, 0x00CC, 0xC1AC, 0x00BC, 0xC2FA, 0x00AD, 0xC443, 0x009F, 0xC588, 0x0092, 0xC6C7, 0x0085, 0xC800, 0x0079,
+    0xC933, 0x006E, 0xCA60, 0x0064, 0xCB89, 0x005A, 0xCCAE, 0x0052, 0xCDCC, 0x0049, 0xCEEC, 0x0042, 0xD015, 0x003B, 0xD143, 0x0035,
+    0xD26E, 0x002F, 0xD394, 0x002A, 0xD4B7, 0x0025, 0xD5D7, 0x0021, 0xD6F6, 0x001D, 0xD811, 0x0019, 0xD92C, 0x0016, 0xDA46, 0x0013,
+    0xDB5E, 0x0011, 0xDC76, 0x000F, 0xDD8D, 0x000D, 0xDEA0, 0x000B, 0xDFAD, 0x0009, 0xE0B6, 0x0008, 0xE1BB, 0x0006, 0xE2C2, 0x0005,
+    0xE3C5, 0x0004, 0xE4C2, 0x0004, 0xE5C6, 0x0003, 0xE6CC, 0x0002, 0xE7C7, 0x0002, 0xE8B6, 0x0002, 0xE99A, 0x0001, 0xEA86, 0x0001,
+    // roughness row 55
+    0x33C5, 0x0CDE, 0x349A, 0x0CF9, 0x357B, 0x0D12, 0x3666, 0x0D28, 0x375D, 0x0D3C, 0x385D, 0x0D4D, 0x3969, 0x0D5B, 0x3A7E, 0x0D67,
+    0x3B9E, 0x0D70, 0x3CC7, 0x0D76, 0x3DFA, 0x0D79, 0x3F37, 0x0D79, 0x407D, 0x0D78, 0x41CD, 0x0D73, 0x4325, 0x0D6C, 0x4486, 0x0D61,
+    0x45EE, 0x0D53, 0x475F, 0x0D41, 0x48D7, 0x0D2D, 0x4A58, 0x0D18, 0x4BE1, 0x0D01, 0x4D71, 0x0CE8, 0x4F08, 0x0CCB, 0x50A4, 0x0CAA,
+    0x5247, 0x0C87, 0x53EF, 0x0C62, 0x559D, 0x0C3A, 0x5750, 0x0C10, 0x5907, 0x0BE3, 0x5AC4, 0x0BB5, 0x5C84, 0x0B86, 0x5E48, 0x0B53,
+    0x600F, 0x0B1F, 0x61D9, 0x0AE9, 0x63A5, 0x0AB2, 0x6575, 0x0A7A, 0x6749, 0x0A42, 0x691F, 0x0A09, 0x6AF6, 0x09CF, 0x6CCD, 0x0992,
+    0x6EA4, 0x0955, 0x707D, 0x0917, 0x7256, 0x08D9, 0x7430, 0x089C, 0x760C, 0x085E, 0x77E6, 0x0820, 0x79C1, 0x07E2, 0x7B9A, 0x07A5,
+    0x7D72, 0x0766, 0x7F48, 0x0729, 0x811B, 0x06EA, 0x82EC, 0x06AC, 0x84BA, 0x066E, 0x8687, 0x0632, 0x8851, 0x05F6, 0x8A18, 0x05BB,
+    0x8BDD, 0x0581, 0x8D9E, 0x0547, 0x8F5F, 0x0510, 0x9120, 0x04DA, 0x92E1, 0x04A7, 0x949D, 0x0473, 0x9658, 0x0442, 0x980F, 0x0411,
+    0x99C0, 0x03E1, 0x9B6C, 0x03B1, 0x9D17, 0x0384, 0x9EBD, 0x0357, 0xA061, 0x032C, 0xA202, 0x0303, 0xA39D, 0x02DA, 0xA533, 0x02B3,
+    0xA6C3, 0x028C, 0xA84D, 0x0267, 0xA9D3, 0x0243, 0xAB5B, 0x0221, 0xACDD, 0x0201, 0xAE5E, 0x01E2, 0xAFD9, 0x01C4, 0xB151, 0x01A8,
+    0xB2C4, 0x018D, 0xB434, 0x0173, 0xB59E, 0x015A, 0xB702, 0x0142, 0xB861, 0x012B, 0xB9BD, 0x0116, 0xBB15, 0x0102, 0xBC69, 0x00EF,
+    0xBDBA, 0x00DD, 0xBF08, 0x00CC, 0xC051, 0x00BC, 0xC194, 0x00AD, 0xC2D7, 0x009F, 0xC416, 0x0092, 0xC552, 0x0085, 0xC68A, 0x007A,
+    0xC7BC, 0x006F, 0xC8E7, 0x0065, 0xCA0D, 0x005C, 0xCB37, 0x0053, 0xCC67, 0x004B, 0xCD98, 0x0043, 0xCEC5, 0x003C, 0xCFEE, 0x0036,
+    0xD117, 0x0030, 0xD242, 0x002B, 0xD369, 0x0026, 0xD48B, 0x0022, 0xD5A9, 0x001E, 0xD6C5, 0x001A, 0xD7DD, 0x0017, 0xD8F8, 0x0014,
+    0xDA13, 0x0011, 0xDB2E, 0x000F, 0xDC48, 0x000D, 0xDD5E, 0x000B, 0xDE6E, 0x000A, 0xDF79, 0x0008, 0xE07F, 0x0007, 0xE17E, 0x0006,
+    0xE27C, 0x0005, 0xE375, 0x0004, 0xE46D, 0x0003, 0xE55C, 0x0002, 0xE658, 0x0002, 0xE74E, 0x0002, 0xE842, 0x0001, 0xE936, 0x0001,
+    // roughness row 56
+    0x35C4, 0x0CD6, 0x3696, 0x0CED, 0x3773, 0x0D01, 0x385A, 0x0D13, 0x394B, 0x0D23, 0x3A47, 0x0D30, 0x3B4D, 0x0D3A, 0x3C5C, 0x0D42,
+    0x3D75, 0x0D48, 0x3E98, 0x0D4A, 0x3FC4, 0x0D4A, 0x40F9, 0x0D46, 0x4237, 0x0D42, 0x437D, 0x0D3A, 0x44CD, 0x0D30, 0x4624, 0x0D23,
+    0x4784, 0x0D13, 0x48EA, 0x0CFF, 0x4A58, 0x0CE8, 0x4BCD, 0x0CD0, 0x4D4B, 0x0CB7, 0x4ECF, 0x0C9D, 0x505B, 0x0C80, 0x51EC, 0x0C5F,
+    0x5382, 0x0C3B, 0x551E, 0x0C16, 0x56BF, 0x0BEE, 0x5865, 0x0BC4, 0x5A0F, 0x0B98, 0x5BBE, 0x0B6A, 0x5D71, 0x0B3A, 0x5F29, 0x0B09,
+    0x60E2, 0x0AD6, 0x629F, 0x0AA1, 0x645E, 0x0A6B, 0x661F, 0x0A33, 0x67E3, 0x09FB, 0x69AB, 0x09C4, 0x6B75, 0x098B, 0x6D40, 0x0952,
+    0x6F0B, 0x0917, 0x70D6, 0x08DB, 0x72A1, 0x089E, 0x746D, 0x0861, 0x7639, 0x0824, 0x7807, 0x07E9, 0x79D4, 0x07AD, 0x7BA1, 0x0771,
+    0x7D6D, 0x0736, 0x7F38, 0x06FA, 0x8101, 0x06BF, 0x82C8, 0x0684, 0x848C, 0x0648, 0x864D, 0x060E, 0x880C, 0x05D3, 0x89C9, 0x059A,
+    0x8B83, 0x0562, 0x8D3B, 0x052A, 0x8EEF, 0x04F4, 0x90A1, 0x04BE, 0x9250, 0x048A, 0x9401, 0x0458, 0x95B1, 0x0428, 0x975D, 0x03F9,
+    0x9908, 0x03CB, 0x9AAF, 0x039E, 0x9C51, 0x0372, 0x9DEE, 0x0347, 0x9F88, 0x031D, 0xA11E, 0x02F4, 0xA2B2, 0x02CD, 0xA443, 0x02A7,
+    0xA5CF, 0x0283, 0xA756, 0x025F, 0xA8D7, 0x023C, 0xAA53, 0x021B, 0xABCA, 0x01FA, 0xAD40, 0x01DC, 0xAEB5, 0x01BF, 0xB027, 0x01A3,
+    0xB194, 0x0189, 0xB2FE, 0x016F, 0xB462, 0x0157, 0xB5C4, 0x0140, 0xB721, 0x012A, 0xB878, 0x0115, 0xB9CA, 0x0101, 0xBB17, 0x00EE,
+    0xBC62, 0x00DC, 0xBDA7, 0x00CB, 0xBEEA, 0x00BC, 0xC029, 0x00AD, 0xC164, 0x009F, 0xC299, 0x0092, 0xC3CC, 0x0086, 0xC4FB, 0x007A,
+    0xC627, 0x0070, 0xC762, 0x0066, 0xC8A0, 0x005D, 0xC9DD, 0x0054, 0xCB15, 0x004C, 0xCC48, 0x0045, 0xCD76, 0x003E, 0xCEA2, 0x0037,
+    0xCFC9, 0x0031, 0xD0EC, 0x002C, 0xD20C, 0x0027, 0xD32B, 0x0023, 0xD450, 0x001F, 0xD572, 0x001B, 0xD691, 0x0018, 0xD7AE, 0x0015,
+    0xD8C7, 0x0012, 0xD9DA, 0x0010, 0xDAEE, 0x000E, 0xDC02, 0x000C, 0xDD13, 0x000A, 0xDE21, 0x0009, 0xDF28, 0x0007, 0xE029, 0x0006,
+    0xE123, 0x0005, 0xE217, 0x0004, 0xE309, 0x0003, 0xE3F0, 0x0003, 0xE4D7, 0x0002, 0xE5D5, 0x0002, 0xE6D7, 0x0001, 0xE7DD, 0x0001,
+    // roughness row 57
+    0x37C6, 0x0CCC, 0x3894, 0x0CDE, 0x396C, 0x0CEF, 0x3A4F, 0x0CFD, 0x3B3B, 0x0D08, 0x3C32, 0x0D11, 0x3D31, 0x0D18, 0x3E3B, 0x0D1D,
+    0x3F4E, 0x0D1F, 0x4069, 0x0D1E, 0x418E, 0x0D1A, 0x42BB, 0x0D14, 0x43F1, 0x0D0C, 0x452F, 0x0D01, 0x4675, 0x0CF5, 0x47C4, 0x0CE6,
+    0x4919, 0x0CD4, 0x4A76, 0x0CBF, 0x4BDA, 0x0CA6, 0x4D44, 0x0C8B, 0x4EB6, 0x0C70, 0x502E, 0x0C54, 0x51AE, 0x0C36, 0x5334, 0x0C16,
+    0x54BE, 0x0BF2, 0x564E, 0x0BCB, 0x57E3, 0x0BA4, 0x597C, 0x0B79, 0x5B1A, 0x0B4E, 0x5CBB, 0x0B20, 0x5E61, 0x0AF1, 0x600A, 0x0AC0,
+    0x61B8, 0x0A8F, 0x6368, 0x0A5B, 0x6519, 0x0A26, 0x66CE, 0x09F0, 0x6884, 0x09B8, 0x6A3C, 0x0980, 0x6BF7, 0x0948, 0x6DB5, 0x0911,
+    0x6F74, 0x08D9, 0x7133, 0x089F, 0x72F2, 0x0865, 0x74B0, 0x0829, 0x766E, 0x07EE, 0x782D, 0x07B3, 0x79EC, 0x0779, 0x7BAC, 0x073F,
+    0x7D6B, 0x0705, 0x7F29, 0x06CC, 0x80E7, 0x0693, 0x82A3, 0x065A, 0x845D, 0x0621, 0x8615, 0x05E9, 0x87C9, 0x05B1, 0x897B, 0x057A,
+    0x8B2A, 0x0543, 0x8CD8, 0x050D, 0x8E83, 0x04D9, 0x902B, 0x04A5, 0x91CF, 0x0472, 0x9371, 0x0440, 0x9511, 0x0410, 0x96B1, 0x03E2,
+    0x9850, 0x03B5, 0x99EB, 0x038A, 0x9B85, 0x035F, 0x9D1D, 0x0336, 0x9EAF, 0x030E, 0xA03D, 0x02E7, 0xA1C7, 0x02C0, 0xA34F, 0x029B,
+    0xA4D3, 0x0278, 0xA655, 0x0256, 0xA7D2, 0x0234, 0xA94A, 0x0214, 0xAABC, 0x01F5, 0xAC29, 0x01D7, 0xAD90, 0x01B9, 0xAEF5, 0x019E,
+    0xB05A, 0x0184, 0xB1BD, 0x016B, 0xB31D, 0x0154, 0xB478, 0x013D, 0xB5CE, 0x0128, 0xB720, 0x0113, 0xB870, 0x0100, 0xB9B9, 0x00EE,
+    0xBAFD, 0x00DC, 0xBC3B, 0x00CB, 0xBD77, 0x00BC, 0xBEAE, 0x00AD, 0xBFE0, 0x009F, 0xC110, 0x0092, 0xC242, 0x0086, 0xC385, 0x007A,
+    0xC4C7, 0x0070, 0xC606, 0x0066, 0xC744, 0x005D, 0xC87C, 0x0055, 0xC9B4, 0x004D, 0xCAE8, 0x0046, 0xCC17, 0x003F, 0xCD41, 0x0038,
+    0xCE66, 0x0032, 0xCF8E, 0x002D, 0xD0B5, 0x0028, 0xD1D8, 0x0024, 0xD2F8, 0x001F, 0xD417, 0x001C, 0xD533, 0x0018, 0xD64D, 0x0015,
+    0xD764, 0x0013, 0xD87A, 0x0010, 0xD98A, 0x000E, 0xDA95, 0x000C, 0xDBA1, 0x000A, 0xDCAB, 0x0009, 0xDDB3, 0x0008, 0xDEB5, 0x0006,
+    0xDFB0, 0x0005, 0xE0A3, 0x0004, 0xE18D, 0x0003, 0xE283, 0x0003, 0xE378, 0x0002, 0xE461, 0x0002, 0xE572, 0x0001, 0xE67E, 0x0001,
+    // roughness row 58
+    0x39C9, 0x0CBF, 0x3A93, 0x0CCE, 0x3B67, 0x0CDA, 0x3C45, 0x0CE4, 0x3D2C, 0x0CEC, 0x3E1D, 0x0CF2, 0x3F17, 0x0CF5, 0x401A, 0x0CF6,
+    0x4126, 0x0CF5, 0x423B, 0x0CF1, 0x4358, 0x0CEB, 0x447D, 0x0CE2, 0x45AB, 0x0CD6, 0x46E1, 0x0CCA, 0x481E, 0x0CBA, 0x4963, 0x0CAA,
+    0x4AAF, 0x0C96, 0x4C03, 0x0C7F, 0x4D5C, 0x0C65, 0x4EBC, 0x0C49, 0x5022, 0x0C2B, 0x518F, 0x0C0D, 0x5302, 0x0BED, 0x547C, 0x0BCD,
+    0x55FC, 0x0BAA, 0x577F, 0x0B83, 0x5907, 0x0B5B, 0x5A94, 0x0B31, 0x5C25, 0x0B05, 0x5DBA, 0x0AD8, 0x5F53, 0x0AAA, 0x60F0, 0x0A79,
+    0x628F, 0x0A48, 0x6432, 0x0A16, 0x65D7, 0x09E3, 0x677E, 0x09AE, 0x6928, 0x0978, 0x6AD3, 0x0941, 0x6C7E, 0x0909, 0x6E2C, 0x08D2,
+    0x6FDE, 0x089B, 0x7191, 0x0864, 0x7344, 0x082C, 0x74F6, 0x07F3, 0x76A8, 0x07BA, 0x7859, 0x0780, 0x7A0B, 0x0747, 0x7BBC, 0x070E,
+    0x7D6E, 0x06D6, 0x7F1F, 0x069E, 0x80D0, 0x0667, 0x8280, 0x0630, 0x842F, 0x05FA, 0x85DC, 0x05C4, 0x8787, 0x058F, 0x892E, 0x0559,
+    0x8AD3, 0x0525, 0x8C76, 0x04F1, 0x8E16, 0x04BD, 0x8FB3, 0x048B, 0x914F, 0x045A, 0x92E7, 0x042A, 0x947C, 0x03FB, 0x960E, 0x03CD,
+    0x979E, 0x03A1, 0x992E, 0x0376, 0x9ABD, 0x034D, 0x9C48, 0x0324, 0x9DD2, 0x02FE, 0x9F58, 0x02D8, 0xA0DB, 0x02B3, 0xA25A, 0x028F,
+    0xA3D4, 0x026D, 0xA54C, 0x024B, 0xA6C1, 0x022B, 0xA835, 0x020C, 0xA9A3, 0x01EE, 0xAB0C, 0x01D1, 0xAC70, 0x01B5, 0xADCE, 0x019A,
+    0xAF27, 0x0180, 0xB07C, 0x0167, 0xB1D0, 0x0150, 0xB322, 0x013A, 0xB471, 0x0125, 0xB5BC, 0x0111, 0xB703, 0x00FE, 0xB845, 0x00EC,
+    0xB985, 0x00DB, 0xBABF, 0x00CB, 0xBBF8, 0x00BB, 0xBD2A, 0x00AD, 0xBE68, 0x009F, 0xBFAE, 0x0092, 0xC0F0, 0x0086, 0xC231, 0x007B,
+    0xC36D, 0x0070, 0xC4A6, 0x0066, 0xC5DD, 0x005D, 0xC712, 0x0055, 0xC846, 0x004D, 0xC975, 0x0046, 0xCAA2, 0x003F, 0xCBD4, 0x0039,
+    0xCD02, 0x0033, 0xCE2C, 0x002E, 0xCF51, 0x0029, 0xD074, 0x0024, 0xD194, 0x0020, 0xD2AE, 0x001C, 0xD3C7, 0x0019, 0xD4DD, 0x0016,
+    0xD5F1, 0x0013, 0xD6FF, 0x0011, 0xD80D, 0x000E, 0xD91A, 0x000D, 0xDA20, 0x000B, 0xDB20, 0x0009, 0xDC26, 0x0008, 0xDD2A, 0x0007,
+    0xDE2C, 0x0006, 0xDF27, 0x0005, 0xE027, 0x0004, 0xE11E, 0x0003, 0xE213, 0x0002, 0xE310, 0x0002, 0xE401, 0x0001, 0xE502, 0x0001,
+    // roughness row 59
+    0x3BCE, 0x0CB0, 0x3C93, 0x0CBB, 0x3D63, 0x0CC4, 0x3E3B, 0x0CCB, 0x3F1D, 0x0CCF, 0x4008, 0x0CD1, 0x40FC, 0x0CD1, 0x41F9, 0x0CCF,
+    0x42FF, 0x0CCB, 0x440C, 0x0CC4, 0x4522, 0x0CBB, 0x4640, 0x0CB0, 0x4765, 0x0CA1, 0x4892, 0x0C92, 0x49C6, 0x0C81, 0x4B02, 0x0C6E,
+    0x4C45, 0x0C58, 0x4D8F, 0x0C41, 0x4EDE, 0x0C26, 0x5033, 0x0C08, 0x518E, 0x0BE8, 0x52F0, 0x0BC8, 0x5458, 0x0BA7, 0x55C5, 0x0B85,
+    0x5739, 0x0B62, 0x58B1, 0x0B3D, 0x5A2D, 0x0B15, 0x5BAD, 0x0AEA, 0x5D32, 0x0ABF, 0x5EBA, 0x0A92, 0x6047, 0x0A64, 0x61D6, 0x0A35,
+    0x6369, 0x0A04, 0x64FE, 0x09D2, 0x6696, 0x09A0, 0x6831, 0x096D, 0x69CD, 0x0938, 0x6B6B, 0x0903, 0x6D0A, 0x08CD, 0x6EAA, 0x0896,
+    0x704C, 0x085F, 0x71F0, 0x0829, 0x7396, 0x07F3, 0x753D, 0x07BD, 0x76E4, 0x0787, 0x7889, 0x074F, 0x7A2D, 0x0717, 0x7BD1, 0x06DF,
+    0x7D75, 0x06A9, 0x7F19, 0x0672, 0x80BE, 0x063D, 0x8260, 0x0607, 0x8403, 0x05D3, 0x85A4, 0x059F, 0x8745, 0x056C, 0x88E2, 0x0539,
+    0x8A7E, 0x0506, 0x8C16, 0x04D4, 0x8DAC, 0x04A3, 0x8F3E, 0x0472, 0x90CE, 0x0443, 0x925C, 0x0414, 0x93E7, 0x03E6, 0x956F, 0x03BA,
+    0x96F5, 0x038E, 0x9878, 0x0364, 0x99F8, 0x033B, 0x9B77, 0x0313, 0x9CF6, 0x02EE, 0x9E71, 0x02C9, 0x9FEC, 0x02A5, 0xA163, 0x0283,
+    0xA2D5, 0x0262, 0xA442, 0x0241, 0xA5AD, 0x0221, 0xA715, 0x0203, 0xA87A, 0x01E6, 0xA9DE, 0x01CA, 0xAB3E, 0x01B0, 0xAC98, 0x0196,
+    0xADED, 0x017D, 0xAF3C, 0x0164, 0xB085, 0x014D, 0xB1CB, 0x0137, 0xB30F, 0x0122, 0xB451, 0x010E, 0xB594, 0x00FC, 0xB6D2, 0x00EA,
+    0xB80D, 0x00D9, 0xB947, 0x00CA, 0xBA8C, 0x00BB, 0xBBD5, 0x00AC, 0xBD1A, 0x009F, 0xBE5A, 0x0092, 0xBF96, 0x0086, 0xC0D1, 0x007B,
+    0xC207, 0x0071, 0xC33C, 0x0067, 0xC46F, 0x005E, 0xC59D, 0x0055, 0xC6D0, 0x004D, 0xC804, 0x0046, 0xC936, 0x0040, 0xCA65, 0x003A,
+    0xCB8F, 0x0034, 0xCCB7, 0x002F, 0xCDDB, 0x002A, 0xCEFB, 0x0025, 0xD018, 0x0021, 0xD132, 0x001D, 0xD24A, 0x001A, 0xD35D, 0x0017,
+    0xD46F, 0x0014, 0xD57D, 0x0011, 0xD68A, 0x000F, 0xD794, 0x000D, 0xD89C, 0x000B, 0xD9A4, 0x000A, 0xDAA4, 0x0008, 0xDBA0, 0x0007,
+    0xDCA4, 0x0006, 0xDDA9, 0x0005, 0xDEAC, 0x0004, 0xDFA7, 0x0003, 0xE0A6, 0x0003, 0xE1A4, 0x0002, 0xE292, 0x0001, 0xE36E, 0x0001,
+    // roughness row 60
+    0x3DD2, 0x0C9F, 0x3E94, 0x0CA7, 0x3F5E, 0x0CAC, 0x4032, 0x0CAF, 0x410E, 0x0CB0, 0x41F4, 0x0CAF, 0x42E2, 0x0CAC, 0x43D8, 0x0CA7,
+    0x44D7, 0x0CA0, 0x45DD, 0x0C97, 0x46EB, 0x0C8C, 0x4801, 0x0C7E, 0x491E, 0x0C6D, 0x4A43, 0x0C5B, 0x4B6E, 0x0C48, 0x4CA1, 0x0C32,
+    0x4DDA, 0x0C1C, 0x4F1A, 0x0C03, 0x5060, 0x0BE8, 0x51AB, 0x0BC9, 0x52FB, 0x0BA8, 0x5451, 0x0B86, 0x55AD, 0x0B63, 0x570F, 0x0B40,
+    0x5876, 0x0B1C, 0x59E3, 0x0AF7, 0x5B54, 0x0AD0, 0x5CC8, 0x0AA6, 0x5E40, 0x0A7A, 0x5FBC, 0x0A4E, 0x613A, 0x0A20, 0x62BD, 0x09F2,
+    0x6443, 0x09C2, 0x65CB, 0x0991, 0x6756, 0x095F, 0x68E4, 0x092D, 0x6A73, 0x08FA, 0x6C04, 0x08C6, 0x6D96, 0x0892, 0x6F2B, 0x085D,
+    0x70BF, 0x0827, 0x7254, 0x07F1, 0x73EB, 0x07BC, 0x7584, 0x0787, 0x771F, 0x0753, 0x78B9, 0x071E, 0x7A51, 0x06E8, 0x7BE9, 0x06B2,
+    0x7D7F, 0x067C, 0x7F16, 0x0648, 0x80AD, 0x0613, 0x8244, 0x05E0, 0x83D9, 0x05AD, 0x856E, 0x057A, 0x8701, 0x0548, 0x8894, 0x0518,
+    0x8A26, 0x04E7, 0x8BB4, 0x04B8, 0x8D41, 0x0488, 0x8ECA, 0x0459, 0x9050, 0x042C, 0x91D3, 0x03FE, 0x9354, 0x03D2, 0x94D2, 0x03A7,
+    0x964D, 0x037C, 0x97C6, 0x0353, 0x993B, 0x032B, 0x9AAE, 0x0304, 0x9C1F, 0x02DF, 0x9D8D, 0x02BA, 0x9EFB, 0x0298, 0xA066, 0x0276,
+    0xA1D0, 0x0256, 0xA337, 0x0237, 0xA49A, 0x0218, 0xA5F8, 0x01FB, 0xA752, 0x01DE, 0xA8A8, 0x01C3, 0xA9FB, 0x01A8, 0xAB4F, 0x018F,
+    0xAC9F, 0x0177, 0xADEA, 0x0160, 0xAF32, 0x014A, 0xB076, 0x0135, 0xB1B4, 0x0120, 0xB2ED, 0x010C, 0xB425, 0x00F9, 0xB565, 0x00E8,
+    0xB6AD, 0x00D8, 0xB7F7, 0x00C8, 0xB93C, 0x00BA, 0xBA7F, 0x00AC, 0xBBC1, 0x009F, 0xBCFD, 0x0092, 0xBE37, 0x0086, 0xBF6C, 0x007B,
+    0xC09D, 0x0071, 0xC1D3, 0x0067, 0xC307, 0x005E, 0xC438, 0x0056, 0xC568, 0x004E, 0xC694, 0x0047, 0xC7BD, 0x0040, 0xC8E6, 0x003A,
+    0xCA10, 0x0034, 0xCB38, 0x002F, 0xCC5B, 0x002A, 0xCD7B, 0x0026, 0xCE97, 0x0022, 0xCFAF, 0x001E, 0xD0C3, 0x001A, 0xD1DA, 0x0017,
+    0xD2ED, 0x0014, 0xD3FA, 0x0012, 0xD507, 0x000F, 0xD60F, 0x000D, 0xD714, 0x000C, 0xD812, 0x000A, 0xD90E, 0x0008, 0xDA14, 0x0007,
+    0xDB14, 0x0006, 0xDC17, 0x0005, 0xDD1A, 0x0004, 0xDE22, 0x0003, 0xDF24, 0x0003, 0xE019, 0x0002, 0xE106, 0x0002, 0xE1D3, 0x0001,
+    // roughness row 61
+    0x3FD7, 0x0C8C, 0x4094, 0x0C90, 0x415A, 0x0C93, 0x4228, 0x0C93, 0x42FF, 0x0C90, 0x43DF, 0x0C8D, 0x44C6, 0x0C87, 0x45B6, 0x0C7F,
+    0x46AE, 0x0C75, 0x47AD, 0x0C6A, 0x48B4, 0x0C5C, 0x49C2, 0x0C4C, 0x4AD7, 0x0C3A, 0x4BF2, 0x0C25, 0x4D15, 0x0C0F, 0x4E3E, 0x0BF8,
+    0x4F6E, 0x0BE0, 0x50A4, 0x0BC6, 0x51E0, 0x0BAA, 0x5321, 0x0B8B, 0x5467, 0x0B69, 0x55B2, 0x0B45, 0x5703, 0x0B21, 0x5858, 0x0AFD,
+    0x59B3, 0x0AD7, 0x5B14, 0x0AB2, 0x5C79, 0x0A8C, 0x5DE2, 0x0A63, 0x5F4E, 0x0A38, 0x60BD, 0x0A0C, 0x6230, 0x09DF, 0x63A5, 0x09B0,
+    0x651E, 0x0981, 0x669A, 0x0951, 0x6818, 0x0921, 0x6998, 0x08EF, 0x6B1A, 0x08BD, 0x6C9F, 0x088B, 0x6E24, 0x0858, 0x6FAB, 0x0824,
+    0x7133, 0x07F0, 0x72BC, 0x07BC, 0x7444, 0x0787, 0x75CF, 0x0753, 0x775A, 0x071F, 0x78E7, 0x06EC, 0x7A75, 0x06B9, 0x7C02, 0x0686,
+    0x7D8D, 0x0652, 0x7F16, 0x061E, 0x809F, 0x05EB, 0x8228, 0x05B9, 0x83B0, 0x0587, 0x853A, 0x0557, 0x86C1, 0x0526, 0x8847, 0x04F7,
+    0x89CC, 0x04C8, 0x8B50, 0x049A, 0x8CD2, 0x046D, 0x8E52, 0x0440, 0x8FCF, 0x0414, 0x9148, 0x03E8, 0x92BF, 0x03BE, 0x9433, 0x0394,
+    0x95A4, 0x036B, 0x9713, 0x0343, 0x987E, 0x031C, 0x99E7, 0x02F6, 0x9B4D, 0x02D1, 0x9CB0, 0x02AE, 0x9E11, 0x028B, 0x9F70, 0x026A,
+    0xA0CD, 0x024A, 0xA228, 0x022C, 0xA381, 0x020E, 0xA4D7, 0x01F2, 0xA629, 0x01D6, 0xA777, 0x01BC, 0xA8C3, 0x01A2, 0xAA0D, 0x0189,
+    0xAB52, 0x0172, 0xAC97, 0x015B, 0xADD9, 0x0146, 0xAF15, 0x0131, 0xB054, 0x011D, 0xB192, 0x010A, 0xB2D7, 0x00F8, 0xB41C, 0x00E6,
+    0xB55F, 0x00D6, 0xB6A2, 0x00C7, 0xB7E5, 0x00B8, 0xB923, 0x00AB, 0xBA5D, 0x009E, 0xBB93, 0x0092, 0xBCCB, 0x0086, 0xBE06, 0x007B,
+    0xBF3E, 0x0071, 0xC073, 0x0068, 0xC1A4, 0x005E, 0xC2D4, 0x0056, 0xC400, 0x004E, 0xC52B, 0x0047, 0xC651, 0x0040, 0xC775, 0x003A,
+    0xC896, 0x0035, 0xC9B4, 0x002F, 0xCAD7, 0x002B, 0xCBF9, 0x0026, 0xCD16, 0x0022, 0xCE2D, 0x001E, 0xCF43, 0x001B, 0xD053, 0x0018,
+    0xD15E, 0x0015, 0xD268, 0x0012, 0xD36E, 0x0010, 0xD472, 0x000E, 0xD572, 0x000C, 0xD676, 0x000A, 0xD77A, 0x0009, 0xD87A, 0x0007,
+    0xD976, 0x0006, 0xDA77, 0x0005, 0xDB7C, 0x0004, 0xDC83, 0x0004, 0xDD80, 0x0003, 0xDE76, 0x0002, 0xDF56, 0x0002, 0xE036, 0x0001,
+    // roughness row 62
+    0x41DC, 0x0C77, 0x4294, 0x0C79, 0x4355, 0x0C78, 0x441E, 0x0C75, 0x44EF, 0x0C70, 0x45C8, 0x0C69, 0x46AA, 0x0C61, 0x4793, 0x0C56,
+    0x4884, 0x0C4A, 0x497C, 0x0C3C, 0x4A7B, 0x0C2C, 0x4B81, 0x0C1A, 0x4C8E, 0x0C06, 0x4DA1, 0x0BF0, 0x4EBB, 0x0BD8, 0x4FDB, 0x0BBF,
+    0x5101, 0x0BA5, 0x522D, 0x0B8A, 0x535F, 0x0B6D, 0x5497, 0x0B4E, 0x55D3, 0x0B2C, 0x5713, 0x0B07, 0x5858, 0x0AE2, 0x59A2, 0x0ABC,
+    0x5AF1, 0x0A96, 0x5C45, 0x0A6F, 0x5D9D, 0x0A48, 0x5EFB, 0x0A21, 0x605B, 0x09F7, 0x61BE, 0x09CB, 0x6324, 0x099E, 0x648E, 0x0971,
+    0x65F9, 0x0942, 0x6768, 0x0913, 0x68DA, 0x08E3, 0x6A4D, 0x08B3, 0x6BC2, 0x0882, 0x6D39, 0x0851, 0x6EB2, 0x081F, 0x702C, 0x07ED,
+    0x71A7, 0x07BA, 0x7323, 0x0788, 0x74A0, 0x0755, 0x761D, 0x0721, 0x779A, 0x06EE, 0x7919, 0x06BC, 0x7A97, 0x068A, 0x7C18, 0x0659,
+    0x7D99, 0x0628, 0x7F17, 0x05F6, 0x8094, 0x05C5, 0x820F, 0x0593, 0x838B, 0x0563, 0x8506, 0x0533, 0x8680, 0x0504, 0x87FB, 0x04D7,
+    0x8973, 0x04A9, 0x8AEA, 0x047D, 0x8C61, 0x0451, 0x8DD5, 0x0426, 0x8F48, 0x03FB, 0x90B9, 0x03D2, 0x9226, 0x03A9, 0x9390, 0x0381,
+    0x94F8, 0x0359, 0x965C, 0x0332, 0x97BE, 0x030D, 0x991C, 0x02E8, 0x9A78, 0x02C4, 0x9BD0, 0x02A1, 0x9D26, 0x0280, 0x9E7A, 0x025F,
+    0x9FCB, 0x0240, 0xA11A, 0x0222, 0xA266, 0x0205, 0xA3B3, 0x01E9, 0xA500, 0x01CE, 0xA64A, 0x01B5, 0xA78F, 0x019C, 0xA8D1, 0x0184,
+    0xAA0F, 0x016D, 0xAB49, 0x0157, 0xAC88, 0x0142, 0xADC6, 0x012D, 0xAF10, 0x011A, 0xB058, 0x0108, 0xB19C, 0x00F6, 0xB2DC, 0x00E5,
+    0xB418, 0x00D5, 0xB552, 0x00C5, 0xB68A, 0x00B7, 0xB7C1, 0x00A9, 0xB901, 0x009D, 0xBA3E, 0x0091, 0xBB76, 0x0086, 0xBCAB, 0x007B,
+    0xBDDF, 0x0071, 0xBF0F, 0x0068, 0xC03B, 0x005F, 0xC165, 0x0056, 0xC28D, 0x004F, 0xC3B3, 0x0048, 0xC4DA, 0x0041, 0xC5FE, 0x003B,
+    0xC71E, 0x0035, 0xC83C, 0x0030, 0xC956, 0x002B, 0xCA6E, 0x0026, 0xCB87, 0x0022, 0xCC9F, 0x001F, 0xCDB2, 0x001B, 0xCEBF, 0x0018,
+    0xCFC9, 0x0015, 0xD0CE, 0x0013, 0xD1CE, 0x0010, 0xD2CE, 0x000E, 0xD3D1, 0x000C, 0xD4D3, 0x000A, 0xD5D1, 0x0009, 0xD6CF, 0x0008,
+    0xD7D1, 0x0006, 0xD8D3, 0x0005, 0xD9CD, 0x0004, 0xDAC5, 0x0004, 0xDBC2, 0x0003, 0xDCAE, 0x0002, 0xDD93, 0x0002, 0xDE8D, 0x0001,
+    // roughness row 63
+    0x43E0, 0x0C61, 0x4493, 0x0C5F, 0x454E, 0x0C5C, 0x4612, 0x0C56, 0x46DE, 0x0C4E, 0x47B1, 0x0C45, 0x488C, 0x0C3A, 0x496E, 0x0C2D,
+    0x4A58, 0x0C1E, 0x4B49, 0x0C0E, 0x4C40, 0x0BFC, 0x4D3E, 0x0BE9, 0x4E43, 0x0BD3, 0x4F4E, 0x0BBB, 0x505E, 0x0BA1, 0x5175, 0x0B87,
+    0x5292, 0x0B6B, 0x53B5, 0x0B4E, 0x54DD, 0x0B31, 0x560A, 0x0B11, 0x573C, 0x0AF0, 0x5872, 0x0ACB, 0x59AC, 0x0AA5, 0x5AEA, 0x0A7D,
+    0x5C2E, 0x0A56, 0x5D76, 0x0A2F, 0x5EC2, 0x0A07, 0x6012, 0x09DF, 0x6167, 0x09B7, 0x62BF, 0x098C, 0x6419, 0x0960, 0x6575, 0x0933,
+    0x66D5, 0x0905, 0x6837, 0x08D6, 0x699B, 0x08A7, 0x6B02, 0x0878, 0x6C6B, 0x0849, 0x6DD5, 0x0818, 0x6F40, 0x07E7, 0x70AD, 0x07B6,
+    0x721C, 0x0785, 0x738B, 0x0754, 0x74FB, 0x0723, 0x766C, 0x06F1, 0x77DC, 0x06C0, 0x794C, 0x068E, 0x7ABE, 0x065D, 0x7C30, 0x062D,
+    0x7DA3, 0x05FD, 0x7F16, 0x05CE, 0x8088, 0x059F, 0x81F8, 0x056F, 0x8367, 0x0540, 0x84D4, 0x0511, 0x8641, 0x04E3, 0x87AE, 0x04B7,
+    0x891A, 0x048B, 0x8A86, 0x0460, 0x8BEF, 0x0435, 0x8D58, 0x040B, 0x8EBF, 0x03E3, 0x9024, 0x03BB, 0x9187, 0x0393, 0x92E8, 0x036D,
+    0x9446, 0x0347, 0x95A0, 0x0321, 0x96F8, 0x02FD, 0x984D, 0x02D9, 0x999F, 0x02B7, 0x9AED, 0x0295, 0x9C38, 0x0274, 0x9D7F, 0x0254,
+    0x9ECA, 0x0236, 0xA011, 0x0218, 0xA156, 0x01FC, 0xA29A, 0x01E1, 0xA3D9, 0x01C6, 0xA516, 0x01AD, 0xA652, 0x0195, 0xA78E, 0x017E,
+    0xA8CD, 0x0168, 0xAA0A, 0x0152, 0xAB52, 0x013E, 0xAC9A, 0x012A, 0xADDF, 0x0117, 0xAF22, 0x0105, 0xB064, 0x00F4, 0xB1A2, 0x00E4,
+    0xB2DC, 0x00D4, 0xB414, 0x00C5, 0xB54D, 0x00B7, 0xB681, 0x00A9, 0xB7B4, 0x009C, 0xB8E6, 0x0090, 0xBA1B, 0x0085, 0xBB4F, 0x007B,
+    0xBC7D, 0x0071, 0xBDA9, 0x0068, 0xBED6, 0x005F, 0xBFFF, 0x0057, 0xC123, 0x004F, 0xC243, 0x0048, 0xC363, 0x0041, 0xC481, 0x003B,
+    0xC59D, 0x0035, 0xC6B7, 0x0030, 0xC7CD, 0x002B, 0xC8DF, 0x0027, 0xC9EF, 0x0023, 0xCAFC, 0x001F, 0xCC09, 0x001C, 0xCD15, 0x0019,
+    0xCE1C, 0x0016, 0xCF1C, 0x0013, 0xD025, 0x0011, 0xD12A, 0x000F, 0xD22B, 0x000D, 0xD327, 0x000B, 0xD425, 0x0009, 0xD526, 0x0008,
+    0xD625, 0x0007, 0xD720, 0x0005, 0xD816, 0x0005, 0xD903, 0x0004, 0xD9E4, 0x0003, 0xDACE, 0x0002, 0xDBC9, 0x0002, 0xDCCA, 0x0001,
+    // roughness row 64
+    0x45E3, 0x0C49, 0x4691, 0x0C45, 0x4747, 0x0C3E, 0x4805, 0x0C36, 0x48CA, 0x0C2C, 0x4998, 0x0C20, 0x4A6C, 0x0C13, 0x4B48, 0x0C03,
+    0x4C2A, 0x0BF3, 0x4D14, 0x0BE0, 0x4E03, 0x0BCD, 0x4EFA, 0x0BB7, 0x4FF6, 0x0BA0, 0x50F8, 0x0B87, 0x5200, 0x0B6C, 0x530E, 0x0B50,
+    0x5421, 0x0B33, 0x553A, 0x0B14, 0x5658, 0x0AF6, 0x577B, 0x0AD5, 0x58A3, 0x0AB4, 0x59CF, 0x0A90, 0x5AFF, 0x0A69, 0x5C32, 0x0A42,
+    0x5D6A, 0x0A19, 0x5EA6, 0x09F1, 0x5FE6, 0x09C8, 0x612A, 0x09A0, 0x6272, 0x0977, 0x63BE, 0x094E, 0x650D, 0x0923, 0x665D, 0x08F6,
+    0x67B0, 0x08C9, 0x6906, 0x089C, 0x6A5C, 0x086D, 0x6BB6, 0x083F, 0x6D12, 0x0810, 0x6E70, 0x07E1, 0x6FCF, 0x07B1, 0x712F, 0x0781,
+    0x7290, 0x0752, 0x73F2, 0x0721, 0x7555, 0x06F2, 0x76B9, 0x06C1, 0x781E, 0x0692, 0x7982, 0x0662, 0x7AE5, 0x0632, 0x7C4A, 0x0603,
+    0x7DAF, 0x05D4, 0x7F14, 0x05A6, 0x807A, 0x0578, 0x81DF, 0x054B, 0x8342, 0x051E, 0x84A3, 0x04F0, 0x8603, 0x04C4, 0x8763, 0x0498,
+    0x88C1, 0x046D, 0x8A1F, 0x0443, 0x8B7D, 0x041A, 0x8CD9, 0x03F1, 0x8E33, 0x03CA, 0x8F8D, 0x03A3, 0x90E5, 0x037D, 0x923B, 0x0358,
+    0x938E, 0x0334, 0x94DE, 0x0310, 0x962B, 0x02ED, 0x9776, 0x02CA, 0x98BD, 0x02A9, 0x9A07, 0x0289, 0x9B4D, 0x0269, 0x9C8F, 0x024A,
+    0x9DCE, 0x022C, 0x9F09, 0x020F, 0xA043, 0x01F3, 0xA17C, 0x01D9, 0xA2B2, 0x01BF, 0xA3ED, 0x01A6, 0xA527, 0x018F, 0xA660, 0x0178,
+    0xA7A5, 0x0162, 0xA8EB, 0x014E, 0xAA2F, 0x013A, 0xAB71, 0x0126, 0xACAE, 0x0114, 0xADE9, 0x0102, 0xAF22, 0x00F2, 0xB061, 0x00E2,
+    0xB19F, 0x00D3, 0xB2D9, 0x00C4, 0xB411, 0x00B6, 0xB543, 0x00A9, 0xB671, 0x009C, 0xB79D, 0x0090, 0xB8C9, 0x0085, 0xB9F3, 0x007A,
+    0xBB1F, 0x0071, 0xBC48, 0x0068, 0xBD6D, 0x005F, 0xBE8F, 0x0057, 0xBFB2, 0x0050, 0xC0D1, 0x0049, 0xC1EC, 0x0042, 0xC301, 0x003C,
+    0xC414, 0x0036, 0xC526, 0x0031, 0xC638, 0x002C, 0xC747, 0x0027, 0xC852, 0x0023, 0xC957, 0x001F, 0xCA5C, 0x001C, 0xCB5D, 0x0019,
+    0xCC67, 0x0016, 0xCD70, 0x0013, 0xCE76, 0x0011, 0xCF75, 0x000F, 0xD072, 0x000D, 0xD176, 0x000B, 0xD277, 0x000A, 0xD371, 0x0008,
+    0xD468, 0x0007, 0xD557, 0x0006, 0xD643, 0x0005, 0xD72A, 0x0004, 0xD809, 0x0003, 0xD8F7, 0x0002, 0xD9FF, 0x0002, 0xDAFC, 0x0001,
+    // roughness row 65
+    0x47E4, 0x0C30, 0x488D, 0x0C29, 0x493D, 0x0C20, 0x49F6, 0x0C15, 0x4AB5, 0x0C09, 0x4B7C, 0x0BFA, 0x4C4A, 0x0BEB, 0x4D1F, 0x0BDA,
+    0x4DFA, 0x0BC7, 0x4EDC, 0x0BB3, 0x4FC4, 0x0B9D, 0x50B3, 0x0B86, 0x51A7, 0x0B6E, 0x52A1, 0x0B53, 0x53A0, 0x0B37, 0x54A4, 0x0B19,
+    0x55AE, 0x0AFB, 0x56BD, 0x0ADC, 0x57D1, 0x0ABC, 0x58EB, 0x0A9B, 0x5A08, 0x0A79, 0x5B2A, 0x0A55, 0x5C50, 0x0A2F, 0x5D78, 0x0A07,
+    0x5EA5, 0x09DE, 0x5FD5, 0x09B5, 0x6109, 0x098C, 0x6241, 0x0963, 0x637C, 0x0939, 0x64BB, 0x0910, 0x65FE, 0x08E7, 0x6743, 0x08BC,
+    0x688A, 0x088F, 0x69D2, 0x0862, 0x6B1E, 0x0835, 0x6C6A, 0x0807, 0x6DB9, 0x07D9, 0x6F0A, 0x07AB, 0x705C, 0x077D, 0x71B0, 0x074E,
+    0x7304, 0x071F, 0x745A, 0x06F1, 0x75AF, 0x06C2, 0x7706, 0x0693, 0x785E, 0x0664, 0x79B5, 0x0636, 0x7B0E, 0x0608, 0x7C65, 0x05DA,
+    0x7DBC, 0x05AC, 0x7F14, 0x057F, 0x806C, 0x0552, 0x81C4, 0x0526, 0x831B, 0x04FB, 0x8472, 0x04D0, 0x85C6, 0x04A5, 0x8718, 0x047A,
+    0x8869, 0x0450, 0x89BA, 0x0427, 0x8B09, 0x03FF, 0x8C58, 0x03D7, 0x8DA7, 0x03B1, 0x8EF4, 0x038C, 0x903F, 0x0367, 0x9189, 0x0343,
+    0x92D1, 0x0320, 0x9416, 0x02FE, 0x955D, 0x02DC, 0x96A1, 0x02BB, 0x97E2, 0x029B, 0x9921, 0x027C, 0x9A5F, 0x025D, 0x9B9A, 0x023F,
+    0x9CD1, 0x0223, 0x9E05, 0x0207, 0x9F35, 0x01EB, 0xA068, 0x01D1, 0xA19D, 0x01B8, 0xA2D1, 0x01A0, 0xA40F, 0x0189, 0xA551, 0x0173,
+    0xA68F, 0x015D, 0xA7CC, 0x0149, 0xA907, 0x0135, 0xAA40, 0x0123, 0xAB78, 0x0111, 0xACB6, 0x00FF, 0xADF0, 0x00EF, 0xAF28, 0x00DF,
+    0xB05C, 0x00D0, 0xB194, 0x00C2, 0xB2CA, 0x00B5, 0xB3FC, 0x00A8, 0xB52C, 0x009C, 0xB657, 0x0090, 0xB77E, 0x0085, 0xB8A1, 0x007B,
+    0xB9C2, 0x0071, 0xBAE1, 0x0068, 0xBC02, 0x005F, 0xBD22, 0x0057, 0xBE3C, 0x0050, 0xBF52, 0x0049, 0xC067, 0x0042, 0xC178, 0x003C,
+    0xC286, 0x0036, 0xC390, 0x0031, 0xC496, 0x002C, 0xC59B, 0x0028, 0xC69F, 0x0023, 0xC7A2, 0x0020, 0xC8A7, 0x001C, 0xC9AA, 0x0019,
+    0xCAAF, 0x0016, 0xCBB0, 0x0014, 0xCCB1, 0x0011, 0xCDB7, 0x000F, 0xCEBB, 0x000D, 0xCFB9, 0x000B, 0xD0B3, 0x000A, 0xD1AC, 0x0008,
+    0xD29C, 0x0007, 0xD387, 0x0006, 0xD469, 0x0005, 0xD54A, 0x0004, 0xD63A, 0x0003, 0xD733, 0x0002, 0xD828, 0x0002, 0xD91D, 0x0001,
+    // roughness row 66
+    0x49E3, 0x0C15, 0x4A87, 0x0C0C, 0x4B32, 0x0C01, 0x4BE4, 0x0BF4, 0x4C9E, 0x0BE5, 0x4D5E, 0x0BD4, 0x4E26, 0x0BC3, 0x4EF4, 0x0BB0,
+    0x4FC8, 0x0B9B, 0x50A2, 0x0B85, 0x5182, 0x0B6E, 0x5269, 0x0B56, 0x5355, 0x0B3C, 0x5446, 0x0B20, 0x553D, 0x0B03, 0x5638, 0x0AE4,
+    0x5738, 0x0AC4, 0x583E, 0x0AA5, 0x5948, 0x0A83, 0x5A57, 0x0A62, 0x5B6B, 0x0A3F, 0x5C82, 0x0A1B, 0x5D9E, 0x09F6, 0x5EBC, 0x09CE,
+    0x5FDD, 0x09A5, 0x6102, 0x097C, 0x622A, 0x0952, 0x6356, 0x0929, 0x6485, 0x08FF, 0x65B8, 0x08D5, 0x66EE, 0x08AC, 0x6827, 0x0881,
+    0x6962, 0x0856, 0x6A9F, 0x082A, 0x6BDD, 0x07FD, 0x6D1E, 0x07D1, 0x6E60, 0x07A3, 0x6FA3, 0x0776, 0x70E9, 0x0749, 0x722F, 0x071C,
+    0x7378, 0x06EE, 0x74C0, 0x06C0, 0x7609, 0x0693, 0x7753, 0x0665, 0x789D, 0x0638, 0x79E8, 0x060B, 0x7B33, 0x05DE, 0x7C7F, 0x05B2,
+    0x7DC9, 0x0585, 0x7F13, 0x0559, 0x805D, 0x052E, 0x81A8, 0x0503, 0x82F2, 0x04D9, 0x843C, 0x04AF, 0x8585, 0x0486, 0x86CD, 0x045D,
+    0x8811, 0x0434, 0x8955, 0x040C, 0x8A97, 0x03E5, 0x8BD8, 0x03BF, 0x8D17, 0x0399, 0x8E57, 0x0374, 0x8F96, 0x0351, 0x90D5, 0x032E,
+    0x9215, 0x030C, 0x9355, 0x02EB, 0x9493, 0x02CB, 0x95CF, 0x02AC, 0x9709, 0x028D, 0x983F, 0x026F, 0x9971, 0x0251, 0x9AA1, 0x0235,
+    0x9BCD, 0x0219, 0x9D01, 0x01FE, 0x9E33, 0x01E4, 0x9F61, 0x01CA, 0xA096, 0x01B1, 0xA1CF, 0x0199, 0xA307, 0x0182, 0xA43F, 0x016D,
+    0xA575, 0x0158, 0xA6AB, 0x0144, 0xA7E1, 0x0131, 0xA919, 0x011E, 0xAA50, 0x010D, 0xAB88, 0x00FC, 0xACBD, 0x00EC, 0xADF2, 0x00DD,
+    0xAF25, 0x00CF, 0xB055, 0x00C1, 0xB181, 0x00B3, 0xB2AD, 0x00A7, 0xB3D8, 0x009B, 0xB500, 0x0090, 0xB623, 0x0085, 0xB744, 0x007B,
+    0xB860, 0x0071, 0xB978, 0x0068, 0xBA8E, 0x005F, 0xBBA2, 0x0057, 0xBCB8, 0x0050, 0xBDCD, 0x0049, 0xBEDC, 0x0043, 0xBFE6, 0x003D,
+    0xC0EF, 0x0037, 0xC1F4, 0x0032, 0xC2F4, 0x002D, 0xC3EE, 0x0028, 0xC4EA, 0x0024, 0xC5EA, 0x0020, 0xC6EC, 0x001D, 0xC7EC, 0x0019,
+    0xC8E7, 0x0016, 0xC9E4, 0x0014, 0xCAE8, 0x0011, 0xCBEB, 0x000F, 0xCCEC, 0x000D, 0xCDE5, 0x000C, 0xCEDA, 0x000A, 0xCFC7, 0x0008,
+    0xD0B5, 0x0007, 0xD1A1, 0x0006, 0xD283, 0x0005, 0xD376, 0x0004, 0xD470, 0x0003, 0xD566, 0x0003, 0xD650, 0x0002, 0xD744, 0x0001,
+    // roughness row 67
+    0x4BE0, 0x0BF9, 0x4C7E, 0x0BEE, 0x4D24, 0x0BE0, 0x4DD0, 0x0BD1, 0x4E84, 0x0BC0, 0x4F3E, 0x0BAE, 0x4FFE, 0x0B9A, 0x50C5, 0x0B86,
+    0x5192, 0x0B6F, 0x5265, 0x0B58, 0x533E, 0x0B3F, 0x541C, 0x0B25, 0x5500, 0x0B0A, 0x55E8, 0x0AED, 0x56D6, 0x0ACF, 0x57C9, 0x0AB0,
+    0x58C0, 0x0A8F, 0x59BC, 0x0A6E, 0x5ABC, 0x0A4C, 0x5BC1, 0x0A29, 0x5CCB, 0x0A06, 0x5DD8, 0x09E2, 0x5EE9, 0x09BD, 0x5FFD, 0x0997,
+    0x6114, 0x096E, 0x622D, 0x0944, 0x634A, 0x091A, 0x646A, 0x08F0, 0x658D, 0x08C6, 0x66B3, 0x089C, 0x67DD, 0x0872, 0x690A, 0x0849,
+    0x6A39, 0x081F, 0x6B69, 0x07F4, 0x6C9B, 0x07C8, 0x6DCF, 0x079B, 0x6F05, 0x0770, 0x703B, 0x0743, 0x7174, 0x0716, 0x72AE, 0x06EA,
+    0x73E9, 0x06BE, 0x7525, 0x0692, 0x7661, 0x0665, 0x779E, 0x0639, 0x78DC, 0x060D, 0x7A19, 0x05E0, 0x7B57, 0x05B5, 0x7C95, 0x0589,
+    0x7DD4, 0x055F, 0x7F12, 0x0534, 0x804F, 0x050A, 0x818B, 0x04E0, 0x82C9, 0x04B7, 0x8405, 0x048F, 0x8542, 0x0467, 0x867D, 0x0440,
+    0x87B7, 0x0419, 0x88EE, 0x03F2, 0x8A23, 0x03CC, 0x8B57, 0x03A6, 0x8C8A, 0x0382, 0x8DC1, 0x035E, 0x8EF6, 0x033B, 0x902D, 0x0319,
+    0x9162, 0x02F9, 0x9296, 0x02D9, 0x93C8, 0x02BA, 0x94F9, 0x029C, 0x9627, 0x027E, 0x9753, 0x0261, 0x987D, 0x0245, 0x99AB, 0x0229,
+    0x9AD9, 0x020E, 0x9C03, 0x01F4, 0x9D31, 0x01DB, 0x9E69, 0x01C2, 0x9F9F, 0x01AA, 0xA0D2, 0x0193, 0xA201, 0x017D, 0xA32D, 0x0167,
+    0xA45E, 0x0152, 0xA592, 0x013F, 0xA6C9, 0x012C, 0xA7FE, 0x011B, 0xA930, 0x0109, 0xAA60, 0x00F9, 0xAB8E, 0x00E9, 0xACBB, 0x00DB,
+    0xADE5, 0x00CC, 0xAF0E, 0x00BF, 0xB034, 0x00B2, 0xB15A, 0x00A6, 0xB27B, 0x009A, 0xB39C, 0x008F, 0xB4BB, 0x0085, 0xB5D6, 0x007B,
+    0xB6EE, 0x0071, 0xB802, 0x0068, 0xB913, 0x0060, 0xBA1F, 0x0058, 0xBB29, 0x0050, 0xBC32, 0x0049, 0xBD3C, 0x0043, 0xBE44, 0x003D,
+    0xBF47, 0x0037, 0xC044, 0x0032, 0xC143, 0x002D, 0xC247, 0x0029, 0xC345, 0x0025, 0xC43D, 0x0021, 0xC533, 0x001D, 0xC626, 0x001A,
+    0xC725, 0x0017, 0xC820, 0x0014, 0xC916, 0x0012, 0xCA09, 0x000F, 0xCAFF, 0x000D, 0xCBF7, 0x000C, 0xCCEA, 0x000A, 0xCDD9, 0x0009,
+    0xCEC4, 0x0007, 0xCFAB, 0x0006, 0xD0AF, 0x0005, 0xD1AE, 0x0004, 0xD2A7, 0x0003, 0xD395, 0x0003, 0xD481, 0x0002, 0xD569, 0x0002,
+    // roughness row 68
+    0x4DDA, 0x0BDC, 0x4E73, 0x0BCF, 0x4F13, 0x0BBF, 0x4FB9, 0x0BAE, 0x5067, 0x0B9B, 0x511A, 0x0B87, 0x51D4, 0x0B72, 0x5294, 0x0B5B,
+    0x5359, 0x0B43, 0x5425, 0x0B2A, 0x54F5, 0x0B10, 0x55CC, 0x0AF5, 0x56A7, 0x0AD9, 0x5787, 0x0ABB, 0x586D, 0x0A9C, 0x5956, 0x0A7C,
+    0x5A44, 0x0A5A, 0x5B36, 0x0A38, 0x5C2D, 0x0A16, 0x5D28, 0x09F3, 0x5E27, 0x09CF, 0x5F2A, 0x09AB, 0x6031, 0x0986, 0x613B, 0x0960,
+    0x6247, 0x0938, 0x6356, 0x090E, 0x6467, 0x08E4, 0x657B, 0x08B9, 0x6693, 0x0890, 0x67AE, 0x0866, 0x68CA, 0x083B, 0x69EA, 0x0811,
+    0x6B0D, 0x07E8, 0x6C32, 0x07BF, 0x6D58, 0x0794, 0x6E7F, 0x0768, 0x6FA8, 0x073D, 0x70D3, 0x0711, 0x71FE, 0x06E5, 0x732A, 0x06BA,
+    0x7459, 0x068F, 0x7588, 0x0664, 0x76B8, 0x0639, 0x77E8, 0x060D, 0x7918, 0x05E2, 0x7A49, 0x05B8, 0x7B7A, 0x058D, 0x7CAB, 0x0562,
+    0x7DDC, 0x0539, 0x7F0D, 0x0510, 0x803F, 0x04E7, 0x816E, 0x04BE, 0x829D, 0x0496, 0x83CC, 0x046F, 0x84FB, 0x0448, 0x862A, 0x0422,
+    0x8758, 0x03FD, 0x8885, 0x03D8, 0x89B1, 0x03B4, 0x8ADE, 0x038F, 0x8C0B, 0x036C, 0x8D36, 0x0349, 0x8E61, 0x0328, 0x8F89, 0x0306,
+    0x90AE, 0x02E6, 0x91D4, 0x02C7, 0x92F9, 0x02A8, 0x941E, 0x028B, 0x953F, 0x026F, 0x9669, 0x0253, 0x9792, 0x0238, 0x98B9, 0x021D,
+    0x99E0, 0x0204, 0x9B14, 0x01EA, 0x9C46, 0x01D2, 0x9D75, 0x01BA, 0x9EA2, 0x01A3, 0x9FCC, 0x018D, 0xA0FE, 0x0177, 0xA22F, 0x0162,
+    0xA35E, 0x014E, 0xA48B, 0x013B, 0xA5B5, 0x0128, 0xA6E0, 0x0116, 0xA80A, 0x0106, 0xA934, 0x00F6, 0xAA5A, 0x00E6, 0xAB7E, 0x00D8,
+    0xACA1, 0x00CA, 0xADC2, 0x00BD, 0xAEDF, 0x00B0, 0xAFFC, 0x00A4, 0xB117, 0x0099, 0xB230, 0x008E, 0xB345, 0x0083, 0xB45B, 0x007A,
+    0xB56F, 0x0071, 0xB67D, 0x0068, 0xB787, 0x0060, 0xB88D, 0x0058, 0xB991, 0x0050, 0xBA92, 0x0049, 0xBB8F, 0x0043, 0xBC8B, 0x003D,
+    0xBD89, 0x0037, 0xBE90, 0x0032, 0xBF91, 0x002E, 0xC08C, 0x0029, 0xC187, 0x0025, 0xC27E, 0x0021, 0xC37A, 0x001E, 0xC472, 0x001A,
+    0xC568, 0x0017, 0xC65A, 0x0014, 0xC74F, 0x0012, 0xC83D, 0x0010, 0xC929, 0x000E, 0xCA14, 0x000C, 0xCB01, 0x000A, 0xCBEE, 0x0009,
+    0xCCE0, 0x0007, 0xCDDD, 0x0006, 0xCED9, 0x0005, 0xCFD6, 0x0004, 0xD0CA, 0x0004, 0xD1B5, 0x0003, 0xD29E, 0x0002, 0xD380, 0x0002,
+    // roughness row 69
+    0x4FD2, 0x0BBF, 0x5065, 0x0BAF, 0x50FF, 0x0B9E, 0x519F, 0x0B8B, 0x5246, 0x0B76, 0x52F3, 0x0B60, 0x53A6, 0x0B49, 0x545F, 0x0B31,
+    0x551D, 0x0B18, 0x55E1, 0x0AFD, 0x56AA, 0x0AE2, 0x5778, 0x0AC5, 0x584B, 0x0AA8, 0x5923, 0x0A8A, 0x59FF, 0x0A6A, 0x5AE0, 0x0A49,
+    0x5BC5, 0x0A27, 0x5CAD, 0x0A04, 0x5D9A, 0x09E1, 0x5E8C, 0x09BD, 0x5F80, 0x0999, 0x6079, 0x0974, 0x6175, 0x094F, 0x6275, 0x0929,
+    0x6377, 0x0902, 0x647C, 0x08DA, 0x6582, 0x08AF, 0x668B, 0x0885, 0x6796, 0x085A, 0x68A5, 0x0831, 0x69B6, 0x0807, 0x6AC9, 0x07DD,
+    0x6BDF, 0x07B3, 0x6CF8, 0x078A, 0x6E12, 0x0761, 0x6F2E, 0x0737, 0x704A, 0x070C, 0x7168, 0x06E1, 0x7287, 0x06B6, 0x73A7, 0x068B,
+    0x74C7, 0x0660, 0x75EA, 0x0636, 0x770D, 0x060D, 0x7830, 0x05E3, 0x7954, 0x05B9, 0x7A77, 0x058F, 0x7B9B, 0x0566, 0x7CBF, 0x053D,
+    0x7DE2, 0x0514, 0x7F06, 0x04EC, 0x8029, 0x04C4, 0x814E, 0x049D, 0x8271, 0x0476, 0x8392, 0x0450, 0x84B4, 0x042A, 0x85D7, 0x0405,
+    0x86FB, 0x03E1, 0x8822, 0x03BE, 0x8947, 0x039B, 0x8A6A, 0x0379, 0x8B8B, 0x0357, 0x8CA9, 0x0335, 0x8DC6, 0x0314, 0x8EE2, 0x02F4,
+    0x8FFD, 0x02D5, 0x9114, 0x02B6, 0x922A, 0x0298, 0x9347, 0x027B, 0x9466, 0x025F, 0x9586, 0x0244, 0x96A3, 0x022A, 0x97D0, 0x0211,
+    0x98FD, 0x01F8, 0x9A29, 0x01E0, 0x9B53, 0x01C8, 0x9C7C, 0x01B2, 0x9DAD, 0x019B, 0x9EDC, 0x0186, 0xA00A, 0x0171, 0xA134, 0x015D,
+    0xA25D, 0x0149, 0xA382, 0x0137, 0xA4A3, 0x0124, 0xA5C3, 0x0113, 0xA6E2, 0x0102, 0xA800, 0x00F2, 0xA91E, 0x00E3, 0xAA3C, 0x00D5,
+    0xAB56, 0x00C7, 0xAC6E, 0x00BA, 0xAD84, 0x00AE, 0xAE99, 0x00A2, 0xAFA9, 0x0097, 0xB0BA, 0x008C, 0xB1C9, 0x0082, 0xB2D5, 0x0079,
+    0xB3DE, 0x0070, 0xB4E9, 0x0067, 0xB5F0, 0x0060, 0xB6F3, 0x0058, 0xB7F1, 0x0051, 0xB8E9, 0x004A, 0xB9DD, 0x0043, 0xBADD, 0x003D,
+    0xBBDA, 0x0038, 0xBCD7, 0x0032, 0xBDD5, 0x002E, 0xBED0, 0x002A, 0xBFCE, 0x0025, 0xC0CB, 0x0022, 0xC1C6, 0x001E, 0xC2BD, 0x001B,
+    0xC3AD, 0x0018, 0xC49C, 0x0015, 0xC589, 0x0012, 0xC674, 0x0010, 0xC75F, 0x000E, 0xC841, 0x000C, 0xC925, 0x000A, 0xCA13, 0x0009,
+    0xCB11, 0x0008, 0xCC09, 0x0006, 0xCCF9, 0x0005, 0xCDE1, 0x0004, 0xCED2, 0x0004, 0xCFC4, 0x0003, 0xD0A9, 0x0002, 0xD188, 0x0002,
+    // roughness row 70
+    0x51C5, 0x0BA0, 0x5253, 0x0B8E, 0x52E7, 0x0B7B, 0x5381, 0x0B67, 0x5422, 0x0B50, 0x54C8, 0x0B39, 0x5574, 0x0B20, 0x5626, 0x0B07,
+    0x56DD, 0x0AEC, 0x5799, 0x0AD0, 0x585A, 0x0AB4, 0x5920, 0x0A96, 0x59EB, 0x0A78, 0x5ABA, 0x0A59, 0x5B8E, 0x0A38, 0x5C66, 0x0A17,
+    0x5D41, 0x09F5, 0x5E21, 0x09D1, 0x5F04, 0x09AC, 0x5FEB, 0x0988, 0x60D6, 0x0964, 0x61C4, 0x093F, 0x62B6, 0x091A, 0x63AB, 0x08F4,
+    0x64A3, 0x08CD, 0x659D, 0x08A6, 0x6699, 0x087C, 0x6797, 0x0852, 0x6897, 0x0828, 0x699A, 0x07FD, 0x6A9F, 0x07D4, 0x6BA6, 0x07AA,
+    0x6CAF, 0x0780, 0x6DBB, 0x0757, 0x6EC9, 0x072F, 0x6FD9, 0x0706, 0x70EA, 0x06DC, 0x71FB, 0x06B2, 0x730D, 0x0688, 0x7421, 0x065E,
+    0x7535, 0x0634, 0x7649, 0x060A, 0x775F, 0x05E2, 0x7876, 0x05B9, 0x798E, 0x0591, 0x7AA5, 0x0568, 0x7BBB, 0x0540, 0x7CD1, 0x0518,
+    0x7DE8, 0x04F0, 0x7EFE, 0x04C9, 0x8014, 0x04A2, 0x812B, 0x047C, 0x8243, 0x0456, 0x835B, 0x0432, 0x8471, 0x040D, 0x858B, 0x03E9,
+    0x86A5, 0x03C6, 0x87BF, 0x03A4, 0x88D8, 0x0383, 0x89F0, 0x0362, 0x8B06, 0x0341, 0x8C19, 0x0321, 0x8D29, 0x0301, 0x8E38, 0x02E1,
+    0x8F45, 0x02C3, 0x9056, 0x02A5, 0x916D, 0x0289, 0x927F, 0x026C, 0x9391, 0x0251, 0x94AC, 0x0236, 0x95D0, 0x021C, 0x96F4, 0x0204,
+    0x9819, 0x01EC, 0x993E, 0x01D5, 0x9A6B, 0x01BE, 0x9B97, 0x01A8, 0x9CC2, 0x0193, 0x9DE9, 0x017E, 0x9F0E, 0x016A, 0xA031, 0x0157,
+    0xA152, 0x0144, 0xA271, 0x0132, 0xA38D, 0x0120, 0xA4A5, 0x010F, 0xA5BB, 0x00FF, 0xA6CF, 0x00EF, 0xA7E2, 0x00E0, 0xA8F3, 0x00D2,
+    0xAA06, 0x00C5, 0xAB17, 0x00B8, 0xAC25, 0x00AC, 0xAD32, 0x00A1, 0xAE3C, 0x0096, 0xAF44, 0x008B, 0xB049, 0x0081, 0xB14D, 0x0078,
+    0xB250, 0x006F, 0xB351, 0x0067, 0xB44E, 0x005F, 0xB54C, 0x0058, 0xB648, 0x0051, 0xB749, 0x004A, 0xB845, 0x0044, 0xB93D, 0x003E,
+    0xBA2F, 0x0038, 0xBB20, 0x0033, 0xBC17, 0x002E, 0xBD12, 0x002A, 0xBE0F, 0x0026, 0xBF09, 0x0022, 0xBFFD, 0x001E, 0xC0F3, 0x001B,
+    0xC1E5, 0x0018, 0xC2D3, 0x0015, 0xC3BB, 0x0013, 0xC4A0, 0x0011, 0xC583, 0x000E, 0xC668, 0x000C, 0xC75C, 0x000B, 0xC84D, 0x0009,
+    0xC938, 0x0008, 0xCA29, 0x0007, 0xCB11, 0x0006, 0xCBF3, 0x0005, 0xCCD2, 0x0004, 0xCDB5, 0x0003, 0xCEA1, 0x0002, 0xCF6F, 0x0002,
+    // roughness row 71
+    0x53B6, 0x0B81, 0x543D, 0x0B6D, 0x54CB, 0x0B58, 0x5560, 0x0B42, 0x55FA, 0x0B2A, 0x5699, 0x0B11, 0x573E, 0x0AF7, 0x57E9, 0x0ADC,
+    0x5898, 0x0AC1, 0x594D, 0x0AA4, 0x5A06, 0x0A86, 0x5AC4, 0x0A67, 0x5B87, 0x0A48, 0x5C4D, 0x0A28, 0x5D18, 0x0A07, 0x5DE7, 0x09E5,
+    0x5EBA, 0x09C3, 0x5F90, 0x099F, 0x606A, 0x097A, 0x6147, 0x0955, 0x6228, 0x0930, 0x630C, 0x090A, 0x63F3, 0x08E5, 0x64DE, 0x08BF,
+    0x65CB, 0x0899, 0x66BB, 0x0872, 0x67AD, 0x084A, 0x68A0, 0x0821, 0x6995, 0x07F6, 0x6A8C, 0x07CC, 0x6B85, 0x07A2, 0x6C81, 0x0779,
+    0x6D7E, 0x0750, 0x6E7D, 0x0726, 0x6F7E, 0x06FE, 0x7082, 0x06D6, 0x7186, 0x06AD, 0x728B, 0x0685, 0x7392, 0x065C, 0x7498, 0x0632,
+    0x75A0, 0x060A, 0x76A8, 0x05E1, 0x77AF, 0x05B8, 0x78B9, 0x0590, 0x79C4, 0x0569, 0x7ACF, 0x0542, 0x7BD9, 0x051B, 0x7CE3, 0x04F4,
+    0x7DED, 0x04CD, 0x7EF7, 0x04A7, 0x8002, 0x0481, 0x810B, 0x045C, 0x8216, 0x0438, 0x8324, 0x0414, 0x8433, 0x03F1, 0x8541, 0x03CE,
+    0x864D, 0x03AC, 0x8759, 0x038B, 0x8865, 0x036A, 0x8970, 0x034A, 0x8A7A, 0x032B, 0x8B82, 0x030C, 0x8C88, 0x02EE, 0x8D8D, 0x02D0,
+    0x8E99, 0x02B2, 0x8FA3, 0x0295, 0x90AC, 0x0279, 0x91B7, 0x025D, 0x92D2, 0x0243, 0x93EC, 0x0229, 0x9507, 0x020F, 0x9621, 0x01F7,
+    0x9745, 0x01E0, 0x9869, 0x01C9, 0x998D, 0x01B4, 0x9AAF, 0x019F, 0x9BD0, 0x018A, 0x9CF0, 0x0176, 0x9E0E, 0x0163, 0x9F2A, 0x0150,
+    0xA043, 0x013E, 0xA15B, 0x012D, 0xA271, 0x011C, 0xA384, 0x010C, 0xA495, 0x00FC, 0xA5A1, 0x00ED, 0xA6AA, 0x00DE, 0xA7B2, 0x00D0,
+    0xA8B8, 0x00C2, 0xA9BD, 0x00B6, 0xAAC4, 0x00AA, 0xABC8, 0x009F, 0xACCA, 0x0094, 0xADCB, 0x008A, 0xAEC9, 0x0080, 0xAFC6, 0x0077,
+    0xB0BF, 0x006E, 0xB1B5, 0x0066, 0xB2AB, 0x005E, 0xB3A8, 0x0057, 0xB4A3, 0x0050, 0xB59F, 0x004A, 0xB697, 0x0044, 0xB78C, 0x003E,
+    0xB87E, 0x0039, 0xB972, 0x0033, 0xBA63, 0x002E, 0xBB51, 0x002A, 0xBC43, 0x0026, 0xBD37, 0x0022, 0xBE2C, 0x001F, 0xBF1D, 0x001C,
+    0xC009, 0x0019, 0xC0F5, 0x0016, 0xC1DE, 0x0013, 0xC2C1, 0x0011, 0xC3AB, 0x000F, 0xC499, 0x000D, 0xC588, 0x000B, 0xC671, 0x0009,
+    0xC756, 0x0008, 0xC835, 0x0007, 0xC91B, 0x0006, 0xCA01, 0x0005, 0xCAD5, 0x0004, 0xCBAA, 0x0003, 0xCC80, 0x0002, 0xCD56, 0x0002,
+    // roughness row 72
+    0x55A2, 0x0B60, 0x5624, 0x0B4B, 0x56AC, 0x0B35, 0x573A, 0x0B1D, 0x57CD, 0x0B04, 0x5866, 0x0AEA, 0x5904, 0x0ACF, 0x59A8, 0x0AB2,
+    0x5A50, 0x0A95, 0x5AFD, 0x0A77, 0x5BAE, 0x0A59, 0x5C64, 0x0A39, 0x5D1E, 0x0A19, 0x5DDC, 0x09F8, 0x5E9E, 0x09D7, 0x5F64, 0x09B5,
+    0x602E, 0x0991, 0x60FB, 0x096D, 0x61CB, 0x0948, 0x629E, 0x0922, 0x6375, 0x08FD, 0x644F, 0x08D8, 0x652C, 0x08B2, 0x660C, 0x088C,
+    0x66EF, 0x0866, 0x67D4, 0x0840, 0x68BC, 0x0819, 0x69A5, 0x07F0, 0x6A8F, 0x07C7, 0x6B7A, 0x079D, 0x6C68, 0x0773, 0x6D57, 0x0749,
+    0x6E49, 0x0721, 0x6F3D, 0x06F8, 0x7031, 0x06CF, 0x7127, 0x06A7, 0x7220, 0x0680, 0x731A, 0x0658, 0x7414, 0x0630, 0x750E, 0x0608,
+    0x7608, 0x05E0, 0x7704, 0x05B8, 0x77FF, 0x0590, 0x78FA, 0x0568, 0x79F7, 0x0542, 0x7AF5, 0x051C, 0x7BF5, 0x04F6, 0x7CF5, 0x04D1,
+    0x7DF3, 0x04AC, 0x7EF1, 0x0487, 0x7FEF, 0x0462, 0x80F0, 0x043E, 0x81F1, 0x041A, 0x82F2, 0x03F7, 0x83F3, 0x03D5, 0x84F5, 0x03B4,
+    0x85F4, 0x0393, 0x86F2, 0x0372, 0x87EF, 0x0352, 0x88EC, 0x0333, 0x89E9, 0x0315, 0x8AE4, 0x02F7, 0x8BE9, 0x02DA, 0x8CEE, 0x02BE,
+    0x8DEF, 0x02A1, 0x8EEE, 0x0285, 0x8FFB, 0x0269, 0x910E, 0x024F, 0x9223, 0x0235, 0x9336, 0x021C, 0x944F, 0x0204, 0x9568, 0x01EC,
+    0x9681, 0x01D5, 0x979A, 0x01BF, 0x98B3, 0x01AA, 0x99CB, 0x0195, 0x9AE2, 0x0181, 0x9BF7, 0x016E, 0x9D0B, 0x015B, 0x9E1F, 0x014A,
+    0x9F30, 0x0138, 0xA03F, 0x0127, 0xA14B, 0x0117, 0xA258, 0x0107, 0xA363, 0x00F8, 0xA46B, 0x00EA, 0xA570, 0x00DC, 0xA671, 0x00CE,
+    0xA76F, 0x00C1, 0xA86A, 0x00B4, 0xA966, 0x00A8, 0xAA5E, 0x009D, 0xAB58, 0x0093, 0xAC4F, 0x0089, 0xAD41, 0x007F, 0xAE32, 0x0076,
+    0xAF23, 0x006D, 0xB017, 0x0065, 0xB10F, 0x005E, 0xB203, 0x0056, 0xB2F6, 0x0050, 0xB3E7, 0x0049, 0xB4D6, 0x0043, 0xB5D0, 0x003E,
+    0xB6C5, 0x0039, 0xB7B8, 0x0034, 0xB8AA, 0x002F, 0xB996, 0x002A, 0xBA7F, 0x0026, 0xBB64, 0x0022, 0xBC4C, 0x001F, 0xBD38, 0x001C,
+    0xBE23, 0x0019, 0xBF0A, 0x0016, 0xBFF1, 0x0014, 0xC0E0, 0x0011, 0xC1D0, 0x000F, 0xC2BB, 0x000D, 0xC3A0, 0x000B, 0xC481, 0x000A,
+    0xC55E, 0x0008, 0xC63B, 0x0007, 0xC718, 0x0006, 0xC7F0, 0x0005, 0xC8CC, 0x0004, 0xC997, 0x0003, 0xCA4E, 0x0002, 0xCB44, 0x0002,
+    // roughness row 73
+    0x578A, 0x0B40, 0x5806, 0x0B29, 0x5888, 0x0B11, 0x590F, 0x0AF8, 0x599C, 0x0ADE, 0x5A2F, 0x0AC2, 0x5AC6, 0x0AA6, 0x5B62, 0x0A88,
+    0x5C02, 0x0A6A, 0x5CA8, 0x0A4C, 0x5D51, 0x0A2C, 0x5DFF, 0x0A0B, 0x5EB0, 0x09EA, 0x5F66, 0x09C9, 0x6020, 0x09A7, 0x60DD, 0x0984,
+    0x619E, 0x0961, 0x6261, 0x093D, 0x6328, 0x0918, 0x63F2, 0x08F1, 0x64BE, 0x08CC, 0x658E, 0x08A6, 0x6661, 0x0880, 0x6736, 0x085A,
+    0x680F, 0x0834, 0x68E9, 0x080E, 0x69C6, 0x07E8, 0x6AA5, 0x07C0, 0x6B84, 0x0798, 0x6C65, 0x076E, 0x6D47, 0x0745, 0x6E2B, 0x071B,
+    0x6F10, 0x06F3, 0x6FF8, 0x06CB, 0x70E1, 0x06A3, 0x71CB, 0x067B, 0x72B6, 0x0653, 0x73A4, 0x062D, 0x7492, 0x0606, 0x7581, 0x05DF,
+    0x766F, 0x05B8, 0x775D, 0x0591, 0x784C, 0x056A, 0x793C, 0x0544, 0x7A2C, 0x051D, 0x7B1E, 0x04F8, 0x7C11, 0x04D3, 0x7D03, 0x04AF,
+    0x7DF6, 0x048B, 0x7EEB, 0x0467, 0x7FE1, 0x0444, 0x80D7, 0x0421, 0x81CB, 0x03FE, 0x82BF, 0x03DC, 0x83B2, 0x03BA, 0x84A4, 0x0399,
+    0x8597, 0x037A, 0x868A, 0x035A, 0x8779, 0x033B, 0x8869, 0x031D, 0x895E, 0x02FF, 0x8A59, 0x02E2, 0x8B53, 0x02C6, 0x8C4D, 0x02AB,
+    0x8D4D, 0x0290, 0x8E5B, 0x0276, 0x8F66, 0x025B, 0x9070, 0x0241, 0x917E, 0x0228, 0x928F, 0x020F, 0x93A1, 0x01F8, 0x94B1, 0x01E1,
+    0x95BE, 0x01CA, 0x96CB, 0x01B5, 0x97D7, 0x01A0, 0x98E3, 0x018B, 0x99F0, 0x0178, 0x9AFD, 0x0166, 0x9C08, 0x0154, 0x9D11, 0x0142,
+    0x9E1B, 0x0132, 0x9F24, 0x0122, 0xA029, 0x0112, 0xA12C, 0x0103, 0xA22D, 0x00F4, 0xA32C, 0x00E6, 0xA429, 0x00D8, 0xA525, 0x00CB,
+    0xA61C, 0x00BF, 0xA710, 0x00B2, 0xA800, 0x00A7, 0xA8EF, 0x009C, 0xA9DC, 0x0091, 0xAAC7, 0x0087, 0xABB3, 0x007E, 0xACA1, 0x0075,
+    0xAD91, 0x006D, 0xAE7E, 0x0065, 0xAF6B, 0x005D, 0xB054, 0x0056, 0xB13D, 0x004F, 0xB22C, 0x0049, 0xB31D, 0x0043, 0xB40F, 0x003D,
+    0xB503, 0x0038, 0xB5F5, 0x0034, 0xB6E2, 0x002F, 0xB7C9, 0x002B, 0xB8AF, 0x0026, 0xB993, 0x0023, 0xBA73, 0x001F, 0xBB51, 0x001C,
+    0xBC2E, 0x0019, 0xBD16, 0x0016, 0xBE07, 0x0014, 0xBEF4, 0x0011, 0xBFDE, 0x000F, 0xC0C2, 0x000D, 0xC1A1, 0x000C, 0xC27D, 0x000A,
+    0xC35A, 0x0009, 0xC434, 0x0007, 0xC501, 0x0006, 0xC5D2, 0x0005, 0xC6A4, 0x0004, 0xC76E, 0x0003, 0xC846, 0x0002, 0xC918, 0x0002,
+    // roughness row 74
+    0x596D, 0x0B1E, 0x59E3, 0x0B06, 0x5A5F, 0x0AED, 0x5AE0, 0x0AD3, 0x5B67, 0x0AB7, 0x5BF2, 0x0A9B, 0x5C82, 0x0A7D, 0x5D17, 0x0A5F,
+    0x5DB0, 0x0A3F, 0x5E4E, 0x0A20, 0x5EEF, 0x09FF, 0x5F95, 0x09DE, 0x603E, 0x09BC, 0x60EC, 0x099B, 0x619C, 0x0978, 0x6251, 0x0955,
+    0x6308, 0x0931, 0x63C3, 0x090D, 0x6480, 0x08E8, 0x6540, 0x08C2, 0x6603, 0x089B, 0x66C9, 0x0875, 0x6791, 0x084F, 0x685C, 0x0829,
+    0x692A, 0x0804, 0x69F9, 0x07DD, 0x6ACC, 0x07B7, 0x6BA0, 0x0791, 0x6C75, 0x076A, 0x6D4B, 0x0741, 0x6E22, 0x0718, 0x6EFA, 0x06EF,
+    0x6FD4, 0x06C6, 0x70B0, 0x069F, 0x718D, 0x0678, 0x726B, 0x0650, 0x734A, 0x0629, 0x742A, 0x0602, 0x750C, 0x05DC, 0x75EF, 0x05B7,
+    0x76D2, 0x0591, 0x77B4, 0x056B, 0x7898, 0x0545, 0x797D, 0x0520, 0x7A62, 0x04FB, 0x7B46, 0x04D5, 0x7C2A, 0x04B1, 0x7D11, 0x048E,
+    0x7DFC, 0x046B, 0x7EE7, 0x0449, 0x7FD2, 0x0427, 0x80BA, 0x0405, 0x81A3, 0x03E3, 0x828A, 0x03C2, 0x8370, 0x03A1, 0x8456, 0x0381,
+    0x853B, 0x0362, 0x861F, 0x0343, 0x8704, 0x0325, 0x87F4, 0x0308, 0x88E1, 0x02EB, 0x89CE, 0x02CE, 0x8ABF, 0x02B3, 0x8BC0, 0x0298,
+    0x8CC5, 0x027F, 0x8DCA, 0x0266, 0x8ED2, 0x024D, 0x8FDD, 0x0234, 0x90E6, 0x021C, 0x91ED, 0x0204, 0x92F2, 0x01ED, 0x93F8, 0x01D6,
+    0x94FE, 0x01C1, 0x9603, 0x01AC, 0x9705, 0x0197, 0x9806, 0x0183, 0x9905, 0x0170, 0x9A06, 0x015E, 0x9B07, 0x014C, 0x9C07, 0x013C,
+    0x9D05, 0x012B, 0x9E00, 0x011B, 0x9EFC, 0x010C, 0x9FF8, 0x00FE, 0xA0F0, 0x00F0, 0xA1E6, 0x00E2, 0xA2DB, 0x00D5, 0xA3CD, 0x00C8,
+    0xA4BC, 0x00BC, 0xA5A9, 0x00B1, 0xA692, 0x00A5, 0xA776, 0x009A, 0xA858, 0x0090, 0xA93C, 0x0086, 0xAA27, 0x007D, 0xAB10, 0x0074,
+    0xABF8, 0x006C, 0xACDE, 0x0064, 0xADC1, 0x005C, 0xAEA6, 0x0055, 0xAF91, 0x004F, 0xB07C, 0x0048, 0xB167, 0x0043, 0xB24F, 0x003D,
+    0xB337, 0x0038, 0xB41C, 0x0033, 0xB509, 0x002F, 0xB5F3, 0x002B, 0xB6D6, 0x0027, 0xB7B4, 0x0023, 0xB88B, 0x001F, 0xB967, 0x001C,
+    0xBA46, 0x0019, 0xBB2C, 0x0016, 0xBC11, 0x0014, 0xBCF6, 0x0012, 0xBDD6, 0x000F, 0xBEB3, 0x000E, 0xBF90, 0x000C, 0xC06B, 0x000A,
+    0xC143, 0x0009, 0xC210, 0x0007, 0xC2DE, 0x0006, 0xC3A7, 0x0005, 0xC46C, 0x0004, 0xC548, 0x0003, 0xC62A, 0x0003, 0xC6EC, 0x0002,
+    // roughness row 75
+    0x5B4C, 0x0AFD, 0x5BBC, 0x0AE3, 0x5C32, 0x0AC9, 0x5CAC, 0x0AAD, 0x5D2C, 0x0A91, 0x5DB1, 0x0A73, 0x5E3A, 0x0A54, 0x5EC7, 0x0A35,
+    0x5F59, 0x0A15, 0x5FEF, 0x09F5, 0x6088, 0x09D3, 0x6126, 0x09B1, 0x61C7, 0x098F, 0x626C, 0x096D, 0x6314, 0x094A, 0x63BF, 0x0926,
+    0x646E, 0x0902, 0x651F, 0x08DE, 0x65D3, 0x08B9, 0x668A, 0x0893, 0x6743, 0x086C, 0x67FE, 0x0846, 0x68BC, 0x0820, 0x697D, 0x07FA,
+    0x6A40, 0x07D4, 0x6B05, 0x07AE, 0x6BCD, 0x0788, 0x6C96, 0x0762, 0x6D61, 0x073C, 0x6E2C, 0x0715, 0x6EF9, 0x06ED, 0x6FC6, 0x06C4,
+    0x7094, 0x069C, 0x7163, 0x0674, 0x7234, 0x064D, 0x7307, 0x0626, 0x73DA, 0x0600, 0x74AD, 0x05D9, 0x7582, 0x05B3, 0x7658, 0x058F,
+    0x7731, 0x056A, 0x780A, 0x0546, 0x78E3, 0x0521, 0x79BB, 0x04FD, 0x7A93, 0x04D9, 0x7B6C, 0x04B5, 0x7C47, 0x0491, 0x7D23, 0x046E,
+    0x7E01, 0x044C, 0x7EE0, 0x042B, 0x7FBF, 0x040A, 0x809D, 0x03EA, 0x817A, 0x03C9, 0x8255, 0x03A9, 0x832F, 0x0389, 0x8408, 0x036A,
+    0x84DF, 0x034B, 0x85BE, 0x032D, 0x86A0, 0x0310, 0x8784, 0x02F3, 0x886A, 0x02D7, 0x8952, 0x02BC, 0x8A4A, 0x02A1, 0x8B43, 0x0287,
+    0x8C3E, 0x026D, 0x8D42, 0x0255, 0x8E45, 0x023D, 0x8F4A, 0x0226, 0x904C, 0x020F, 0x914B, 0x01F8, 0x9248, 0x01E2, 0x9344, 0x01CC,
+    0x943E, 0x01B7, 0x9538, 0x01A2, 0x9632, 0x018F, 0x972A, 0x017B, 0x981F, 0x0169, 0x9913, 0x0157, 0x9A06, 0x0145, 0x9AF9, 0x0135,
+    0x9BED, 0x0125, 0x9CE0, 0x0116, 0x9DD1, 0x0107, 0x9EBF, 0x00F8, 0x9FAC, 0x00EB, 0xA09A, 0x00DE, 0xA185, 0x00D1, 0xA26D, 0x00C5,
+    0xA353, 0x00B9, 0xA437, 0x00AE, 0xA519, 0x00A3, 0xA5F7, 0x0099, 0xA6DC, 0x008F, 0xA7BC, 0x0085, 0xA89A, 0x007B, 0xA977, 0x0073,
+    0xAA52, 0x006A, 0xAB32, 0x0063, 0xAC1D, 0x005C, 0xAD04, 0x0055, 0xADEA, 0x004E, 0xAECB, 0x0048, 0xAFAA, 0x0042, 0xB08C, 0x003D,
+    0xB16D, 0x0038, 0xB24D, 0x0033, 0xB32B, 0x002E, 0xB405, 0x002A, 0xB4E3, 0x0026, 0xB5C2, 0x0023, 0xB69F, 0x0020, 0xB781, 0x001C,
+    0xB85D, 0x0019, 0xB937, 0x0016, 0xBA10, 0x0014, 0xBAE6, 0x0012, 0xBBBC, 0x0010, 0xBC9A, 0x000E, 0xBD74, 0x000C, 0xBE45, 0x000A,
+    0xBF0E, 0x0009, 0xBFDB, 0x0008, 0xC0A6, 0x0006, 0xC174, 0x0005, 0xC244, 0x0004, 0xC31D, 0x0003, 0xC3FA, 0x0003, 0xC4CB, 0x0002,
+    // roughness row 76
+    0x5D25, 0x0ADA, 0x5D8F, 0x0AC0, 0x5DFF, 0x0AA4, 0x5E73, 0x0A88, 0x5EEC, 0x0A6A, 0x5F6A, 0x0A4B, 0x5FEC, 0x0A2C, 0x6072, 0x0A0C,
+    0x60FC, 0x09EB, 0x618A, 0x09CA, 0x621C, 0x09A8, 0x62B1, 0x0985, 0x634A, 0x0962, 0x63E6, 0x093F, 0x6486, 0x091C, 0x6528, 0x08F8,
+    0x65CE, 0x08D4, 0x6676, 0x08AF, 0x6721, 0x088A, 0x67CE, 0x0865, 0x687D, 0x083E, 0x692F, 0x0818, 0x69E3, 0x07F1, 0x6A99, 0x07CB,
+    0x6B51, 0x07A5, 0x6C0C, 0x077F, 0x6CC9, 0x075A, 0x6D87, 0x0734, 0x6E47, 0x070F, 0x6F08, 0x06E9, 0x6FCA, 0x06C2, 0x708D, 0x069A,
+    0x714F, 0x0672, 0x7213, 0x064A, 0x72D8, 0x0623, 0x739E, 0x05FD, 0x7466, 0x05D8, 0x752D, 0x05B2, 0x75F7, 0x058D, 0x76C1, 0x0568,
+    0x778E, 0x0545, 0x785B, 0x0521, 0x7928, 0x04FE, 0x79F5, 0x04DB, 0x7AC2, 0x04B8, 0x7B94, 0x0495, 0x7C66, 0x0473, 0x7D37, 0x0451,
+    0x7E07, 0x042F, 0x7ED8, 0x040E, 0x7FAB, 0x03EE, 0x807C, 0x03CF, 0x814D, 0x03B0, 0x821C, 0x0391, 0x82EA, 0x0372, 0x83B7, 0x0354,
+    0x848E, 0x0336, 0x8566, 0x0318, 0x8640, 0x02FB, 0x8719, 0x02DF, 0x87FF, 0x02C4, 0x88EE, 0x02AA, 0x89DD, 0x0290, 0x8AD3, 0x0276,
+    0x8BCA, 0x025D, 0x8CC3, 0x0245, 0x8DBD, 0x022E, 0x8EB6, 0x0218, 0x8FAF, 0x0202, 0x90A7, 0x01ED, 0x919D, 0x01D7, 0x928F, 0x01C2,
+    0x937F, 0x01AE, 0x946E, 0x019A, 0x955C, 0x0186, 0x964A, 0x0174, 0x9736, 0x0162, 0x9820, 0x0150, 0x9907, 0x013F, 0x99EF, 0x012F,
+    0x9AD4, 0x011F, 0x9BBB, 0x0110, 0x9CA0, 0x0101, 0x9D84, 0x00F4, 0x9E66, 0x00E6, 0x9F47, 0x00D9, 0xA026, 0x00CD, 0xA104, 0x00C1,
+    0xA1E1, 0x00B6, 0xA2BA, 0x00AB, 0xA39B, 0x00A1, 0xA47D, 0x0097, 0xA55C, 0x008D, 0xA637, 0x0084, 0xA70D, 0x007B, 0xA7E3, 0x0072,
+    0xA8C3, 0x006A, 0xA9A3, 0x0062, 0xAA81, 0x005B, 0xAB5E, 0x0054, 0xAC3A, 0x004E, 0xAD18, 0x0048, 0xADF4, 0x0042, 0xAECC, 0x003C,
+    0xAFA1, 0x0037, 0xB075, 0x0033, 0xB147, 0x002E, 0xB21A, 0x002A, 0xB2F0, 0x0026, 0xB3CD, 0x0023, 0xB4AE, 0x001F, 0xB58B, 0x001C,
+    0xB662, 0x0019, 0xB733, 0x0017, 0xB800, 0x0014, 0xB8CD, 0x0012, 0xB9A0, 0x0010, 0xBA6F, 0x000E, 0xBB3C, 0x000C, 0xBC07, 0x000A,
+    0xBCD5, 0x0009, 0xBDA0, 0x0008, 0xBE6F, 0x0006, 0xBF42, 0x0005, 0xC01F, 0x0004, 0xC0F1, 0x0003, 0xC1BC, 0x0003, 0xC28E, 0x0002,
+    // roughness row 77
+    0x5EF9, 0x0AB8, 0x5F5D, 0x0A9C, 0x5FC7, 0x0A80, 0x6035, 0x0A62, 0x60A7, 0x0A43, 0x611E, 0x0A24, 0x6199, 0x0A04, 0x6217, 0x09E3,
+    0x629A, 0x09C1, 0x6320, 0x099F, 0x63AA, 0x097D, 0x6438, 0x095A, 0x64C8, 0x0936, 0x655C, 0x0913, 0x65F2, 0x08EF, 0x668C, 0x08CB,
+    0x6729, 0x08A7, 0x67C8, 0x0882, 0x6869, 0x085D, 0x690D, 0x0838, 0x69B3, 0x0811, 0x6A5A, 0x07EB, 0x6B04, 0x07C4, 0x6BB0, 0x079E,
+    0x6C5E, 0x0778, 0x6D0E, 0x0752, 0x6DC0, 0x072D, 0x6E73, 0x0708, 0x6F29, 0x06E2, 0x6FDF, 0x06BD, 0x7096, 0x0697, 0x714E, 0x0671,
+    0x7206, 0x064A, 0x72BE, 0x0622, 0x7377, 0x05FC, 0x7431, 0x05D5, 0x74ED, 0x05B0, 0x75AB, 0x058C, 0x7669, 0x0568, 0x7728, 0x0544,
+    0x77E7, 0x0520, 0x78A7, 0x04FD, 0x7969, 0x04DB, 0x7A2E, 0x04BA, 0x7AF5, 0x0498, 0x7BBB, 0x0476, 0x7C81, 0x0455, 0x7D47, 0x0434,
+    0x7E0B, 0x0413, 0x7ECE, 0x03F2, 0x7F92, 0x03D3, 0x8057, 0x03B4, 0x811B, 0x0396, 0x81DE, 0x0378, 0x82A6, 0x035B, 0x8374, 0x033D,
+    0x8445, 0x0321, 0x8513, 0x0304, 0x85E1, 0x02E8, 0x86C4, 0x02CD, 0x87A9, 0x02B2, 0x8890, 0x0298, 0x897F, 0x027F, 0x8A6D, 0x0267,
+    0x8B5B, 0x024E, 0x8C47, 0x0237, 0x8D33, 0x0220, 0x8E20, 0x020A, 0x8F0D, 0x01F4, 0x8FFB, 0x01E0, 0x90E7, 0x01CC, 0x91D3, 0x01B8,
+    0x92BB, 0x01A5, 0x93A1, 0x0191, 0x9484, 0x017E, 0x9565, 0x016C, 0x9647, 0x015A, 0x9728, 0x0149, 0x9807, 0x0139, 0x98E2, 0x0129,
+    0x99BC, 0x0119, 0x9A96, 0x010A, 0x9B6F, 0x00FC, 0x9C47, 0x00EF, 0x9D1E, 0x00E2, 0x9DF3, 0x00D5, 0x9EC6, 0x00C9, 0x9F98, 0x00BE,
+    0xA06F, 0x00B3, 0xA149, 0x00A8, 0xA222, 0x009E, 0xA2F9, 0x0094, 0xA3CF, 0x008B, 0xA4A7, 0x0082, 0xA586, 0x007A, 0xA662, 0x0071,
+    0xA73A, 0x0069, 0xA80D, 0x0061, 0xA8E4, 0x005A, 0xA9BC, 0x0053, 0xAA92, 0x004D, 0xAB66, 0x0047, 0xAC37, 0x0042, 0xAD07, 0x003C,
+    0xADD3, 0x0037, 0xAE99, 0x0032, 0xAF67, 0x002E, 0xB034, 0x002A, 0xB10B, 0x0026, 0xB1E0, 0x0022, 0xB2B3, 0x001F, 0xB389, 0x001C,
+    0xB459, 0x0019, 0xB526, 0x0017, 0xB5F3, 0x0014, 0xB6B9, 0x0012, 0xB77D, 0x0010, 0xB840, 0x000E, 0xB903, 0x000C, 0xB9CD, 0x000A,
+    0xBA9E, 0x0009, 0xBB71, 0x0008, 0xBC3F, 0x0006, 0xBD14, 0x0005, 0xBDE4, 0x0004, 0xBEAD, 0x0004, 0xBF71, 0x0003, 0xC036, 0x0002,
+    // roughness row 78
+    0x60C8, 0x0A95, 0x6126, 0x0A79, 0x6189, 0x0A5B, 0x61F0, 0x0A3C, 0x625C, 0x0A1D, 0x62CC, 0x09FD, 0x6340, 0x09DC, 0x63B7, 0x09BA,
+    0x6432, 0x0998, 0x64B1, 0x0975, 0x6533, 0x0952, 0x65B8, 0x092F, 0x6640, 0x090B, 0x66CB, 0x08E7, 0x6759, 0x08C3, 0x67EA, 0x089F,
+    0x687E, 0x087A, 0x6913, 0x0855, 0x69AC, 0x0830, 0x6A46, 0x080B, 0x6AE2, 0x07E5, 0x6B81, 0x07BF, 0x6C20, 0x0798, 0x6CC2, 0x0772,
+    0x6D65, 0x074C, 0x6E0A, 0x0726, 0x6EB1, 0x0701, 0x6F5A, 0x06DC, 0x7005, 0x06B7, 0x70B0, 0x0692, 0x715D, 0x066D, 0x720A, 0x0648,
+    0x72B7, 0x0622, 0x7364, 0x05FC, 0x7411, 0x05D5, 0x74C1, 0x05AF, 0x7572, 0x058B, 0x7624, 0x0567, 0x76D7, 0x0544, 0x778B, 0x0521,
+    0x783E, 0x04FE, 0x78F2, 0x04DB, 0x79AC, 0x04BA, 0x7A67, 0x0499, 0x7B22, 0x0479, 0x7BDD, 0x0458, 0x7C97, 0x0438, 0x7D51, 0x0418,
+    0x7E0A, 0x03F8, 0x7EC1, 0x03D8, 0x7F77, 0x03B9, 0x802D, 0x039A, 0x80E4, 0x037D, 0x81A5, 0x0360, 0x826D, 0x0344, 0x8335, 0x0328,
+    0x83FB, 0x030C, 0x84C7, 0x02F1, 0x85A2, 0x02D7, 0x867B, 0x02BC, 0x875C, 0x02A2, 0x8840, 0x0288, 0x8923, 0x026F, 0x8A06, 0x0257,
+    0x8AE9, 0x0240, 0x8BCB, 0x0229, 0x8CAC, 0x0213, 0x8D8B, 0x01FD, 0x8E6B, 0x01E8, 0x8F4C, 0x01D3, 0x902D, 0x01C0, 0x910C, 0x01AD,
+    0x91ED, 0x019A, 0x92CB, 0x0188, 0x93A5, 0x0176, 0x947D, 0x0164, 0x9553, 0x0153, 0x9628, 0x0142, 0x96FC, 0x0133, 0x97D0, 0x0123,
+    0x98A0, 0x0114, 0x996E, 0x0106, 0x9A39, 0x00F7, 0x9B05, 0x00EA, 0x9BD0, 0x00DD, 0x9C9A, 0x00D1, 0x9D64, 0x00C5, 0x9E35, 0x00BA,
+    0x9F05, 0x00AF, 0x9FD3, 0x00A5, 0xA0A4, 0x009B, 0xA175, 0x0092, 0xA249, 0x0089, 0xA322, 0x0080, 0xA3FB, 0x0078, 0xA4D1, 0x0070,
+    0xA5A9, 0x0068, 0xA67C, 0x0061, 0xA74B, 0x005A, 0xA815, 0x0053, 0xA8E1, 0x004D, 0xA9AB, 0x0047, 0xAA74, 0x0041, 0xAB38, 0x003C,
+    0xAC01, 0x0037, 0xACCB, 0x0032, 0xAD96, 0x002E, 0xAE61, 0x002A, 0xAF2C, 0x0026, 0xAFF4, 0x0022, 0xB0B8, 0x001F, 0xB17A, 0x001C,
+    0xB24A, 0x0019, 0xB31A, 0x0017, 0xB3E1, 0x0014, 0xB4A4, 0x0012, 0xB563, 0x0010, 0xB61E, 0x000E, 0xB6E2, 0x000C, 0xB7A9, 0x000A,
+    0xB873, 0x0009, 0xB93F, 0x0008, 0xBA12, 0x0007, 0xBADC, 0x0005, 0xBBA0, 0x0004, 0xBC61, 0x0004, 0xBD21, 0x0003, 0xBDDF, 0x0002,
+    // roughness row 79
+    0x6291, 0x0A72, 0x62E9, 0x0A55, 0x6345, 0x0A36, 0x63A6, 0x0A17, 0x640B, 0x09F7, 0x6474, 0x09D6, 0x64E1, 0x09B4, 0x6551, 0x0992,
+    0x65C4, 0x096F, 0x663B, 0x094C, 0x66B5, 0x0929, 0x6732, 0x0905, 0x67B2, 0x08E0, 0x6835, 0x08BC, 0x68BA, 0x0897, 0x6942, 0x0873,
+    0x69CD, 0x084E, 0x6A5A, 0x0829, 0x6AE8, 0x0804, 0x6B7A, 0x07DF, 0x6C0C, 0x07BA, 0x6CA1, 0x0794, 0x6D37, 0x076D, 0x6DCE, 0x0747,
+    0x6E67, 0x0721, 0x6F02, 0x06FB, 0x6F9E, 0x06D6, 0x703C, 0x06B1, 0x70DB, 0x068C, 0x717C, 0x0668, 0x721E, 0x0644, 0x72C0, 0x0620,
+    0x7362, 0x05FB, 0x7405, 0x05D6, 0x74A9, 0x05B0, 0x754D, 0x058B, 0x75F3, 0x0566, 0x7699, 0x0543, 0x7741, 0x0520, 0x77E9, 0x04FE,
+    0x7891, 0x04DC, 0x793F, 0x04BB, 0x79ED, 0x049A, 0x7A9C, 0x0479, 0x7B4B, 0x0459, 0x7BFA, 0x043A, 0x7CA8, 0x041B, 0x7D55, 0x03FC,
+    0x7E02, 0x03DD, 0x7EAE, 0x03BF, 0x7F59, 0x03A0, 0x8002, 0x0382, 0x80BC, 0x0365, 0x8178, 0x0349, 0x8236, 0x032D, 0x82F2, 0x0313,
+    0x83BB, 0x02F8, 0x848D, 0x02DE, 0x8561, 0x02C4, 0x863D, 0x02AB, 0x8717, 0x0292, 0x87EF, 0x0279, 0x88C6, 0x0260, 0x899E, 0x0249,
+    0x8A75, 0x0232, 0x8B4C, 0x021B, 0x8C22, 0x0206, 0x8CF7, 0x01F0, 0x8DCB, 0x01DC, 0x8E9E, 0x01C8, 0x8F72, 0x01B4, 0x9046, 0x01A2,
+    0x9119, 0x0190, 0x91EB, 0x017E, 0x92BD, 0x016D, 0x938C, 0x015C, 0x9459, 0x014C, 0x9523, 0x013C, 0x95EC, 0x012C, 0x96B2, 0x011D,
+    0x9779, 0x010F, 0x983E, 0x0101, 0x98FF, 0x00F3, 0x99BE, 0x00E6, 0x9A7B, 0x00D9, 0x9B42, 0x00CD, 0x9C0A, 0x00C2, 0x9CD2, 0x00B7,
+    0x9D9B, 0x00AC, 0x9E62, 0x00A2, 0x9F2B, 0x0098, 0x9FFB, 0x008F, 0xA0CA, 0x0086, 0xA19A, 0x007E, 0xA26B, 0x0076, 0xA33C, 0x006E,
+    0xA40B, 0x0067, 0xA4D8, 0x0060, 0xA5A2, 0x0059, 0xA667, 0x0053, 0xA726, 0x004C, 0xA7E2, 0x0046, 0xA8A3, 0x0041, 0xA968, 0x003C,
+    0xAA2C, 0x0037, 0xAAF5, 0x0032, 0xABBC, 0x002E, 0xAC83, 0x002A, 0xAD44, 0x0026, 0xAE02, 0x0022, 0xAEC4, 0x001F, 0xAF87, 0x001C,
+    0xB044, 0x0019, 0xB104, 0x0016, 0xB1CD, 0x0014, 0xB28E, 0x0012, 0xB348, 0x0010, 0xB40D, 0x000E, 0xB4CE, 0x000C, 0xB58F, 0x000A,
+    0xB64F, 0x0009, 0xB711, 0x0008, 0xB7D5, 0x0007, 0xB899, 0x0005, 0xB956, 0x0004, 0xBA15, 0x0004, 0xBAD1, 0x0003, 0xBB8F, 0x0002,
+    // roughness row 80
+    0x6454, 0x0A4F, 0x64A6, 0x0A31, 0x64FC, 0x0A11, 0x6556, 0x09F1, 0x65B4, 0x09D0, 0x6616, 0x09AF, 0x667C, 0x098C, 0x66E4, 0x0969,
+    0x6751, 0x0946, 0x67C0, 0x0923, 0x6832, 0x08FF, 0x68A7, 0x08DB, 0x691E, 0x08B6, 0x6999, 0x0891, 0x6A15, 0x086D, 0x6A95, 0x0848,
+    0x6B16, 0x0823, 0x6B9A, 0x07FE, 0x6C1F, 0x07D9, 0x6CA7, 0x07B4, 0x6D30, 0x078F, 0x6DBB, 0x0769, 0x6E47, 0x0743, 0x6ED5, 0x071D,
+    0x6F63, 0x06F7, 0x6FF4, 0x06D1, 0x7085, 0x06AC, 0x7118, 0x0687, 0x71AD, 0x0663, 0x7242, 0x063F, 0x72D9, 0x061B, 0x7370, 0x05F8,
+    0x7408, 0x05D4, 0x74A2, 0x05B1, 0x753D, 0x058D, 0x75D7, 0x0568, 0x7671, 0x0544, 0x770B, 0x0521, 0x77A6, 0x04FE, 0x7844, 0x04DD,
+    0x78E7, 0x04BC, 0x7989, 0x049B, 0x7A2B, 0x047B, 0x7ACD, 0x045B, 0x7B6F, 0x043B, 0x7C11, 0x041D, 0x7CB3, 0x03FE, 0x7D54, 0x03E0,
+    0x7DF5, 0x03C2, 0x7E95, 0x03A5, 0x7F3C, 0x0388, 0x7FED, 0x036C, 0x809D, 0x034F, 0x814C, 0x0333, 0x81FB, 0x0318, 0x82BF, 0x02FE,
+    0x8387, 0x02E4, 0x8456, 0x02CB, 0x8529, 0x02B2, 0x85FA, 0x0299, 0x86CB, 0x0282, 0x879A, 0x026A, 0x8867, 0x0252, 0x8933, 0x023B,
+    0x89FF, 0x0224, 0x8ACA, 0x020E, 0x8B95, 0x01F9, 0x8C60, 0x01E5, 0x8D29, 0x01D1, 0x8DF1, 0x01BD, 0x8EB7, 0x01AA, 0x8F7E, 0x0197,
+    0x9045, 0x0186, 0x910C, 0x0175, 0x91D1, 0x0164, 0x9296, 0x0154, 0x9358, 0x0144, 0x9418, 0x0135, 0x94D5, 0x0126, 0x9590, 0x0117,
+    0x964A, 0x0109, 0x9702, 0x00FB, 0x97BA, 0x00EE, 0x9876, 0x00E1, 0x9934, 0x00D5, 0x99F1, 0x00C9, 0x9AB1, 0x00BE, 0x9B70, 0x00B3,
+    0x9C2E, 0x00A9, 0x9CF7, 0x009F, 0x9DBD, 0x0095, 0x9E83, 0x008C, 0x9F4D, 0x0084, 0xA015, 0x007B, 0xA0DC, 0x0074, 0xA19F, 0x006C,
+    0xA262, 0x0065, 0xA325, 0x005E, 0xA3E5, 0x0058, 0xA4A2, 0x0052, 0xA55E, 0x004C, 0xA61B, 0x0046, 0xA6D3, 0x0040, 0xA795, 0x003B,
+    0xA858, 0x0036, 0xA91C, 0x0032, 0xA9DC, 0x002E, 0xAA98, 0x002A, 0xAB53, 0x0026, 0xAC13, 0x0022, 0xACCF, 0x001F, 0xAD8D, 0x001C,
+    0xAE4A, 0x0019, 0xAF01, 0x0017, 0xAFB3, 0x0014, 0xB073, 0x0012, 0xB13A, 0x0010, 0xB1FA, 0x000E, 0xB2B7, 0x000C, 0xB371, 0x000B,
+    0xB42B, 0x0009, 0xB4E8, 0x0008, 0xB59E, 0x0007, 0xB654, 0x0006, 0xB70E, 0x0005, 0xB7CD, 0x0004, 0xB885, 0x0003, 0xB94B, 0x0002,
+    // roughness row 81
+    0x6611, 0x0A2C, 0x665C, 0x0A0D, 0x66AC, 0x09ED, 0x6700, 0x09CC, 0x6757, 0x09AA, 0x67B2, 0x0988, 0x6810, 0x0965, 0x6872, 0x0942,
+    0x68D6, 0x091E, 0x693E, 0x08FB, 0x69A8, 0x08D6, 0x6A15, 0x08B2, 0x6A84, 0x088D, 0x6AF6, 0x0868, 0x6B6A, 0x0843, 0x6BE1, 0x081E,
+    0x6C59, 0x07F9, 0x6CD4, 0x07D4, 0x6D50, 0x07AF, 0x6DCE, 0x078A, 0x6E4E, 0x0765, 0x6ECF, 0x073F, 0x6F52, 0x071A, 0x6FD5, 0x06F4,
+    0x705A, 0x06CE, 0x70E0, 0x06A8, 0x7167, 0x0683, 0x71EF, 0x065E, 0x7278, 0x063B, 0x7303, 0x0617, 0x738E, 0x05F3, 0x741B, 0x05D1,
+    0x74AB, 0x05AF, 0x753B, 0x058C, 0x75CB, 0x056A, 0x765B, 0x0546, 0x76E9, 0x0523, 0x7778, 0x0500, 0x7809, 0x04DD, 0x789F, 0x04BC,
+    0x7936, 0x049C, 0x79CD, 0x047C, 0x7A63, 0x045D, 0x7AF9, 0x043D, 0x7B8E, 0x041E, 0x7C24, 0x0400, 0x7CB9, 0x03E2, 0x7D4F, 0x03C5,
+    0x7DE5, 0x03A8, 0x7E85, 0x038C, 0x7F2D, 0x0370, 0x7FD3, 0x0355, 0x8079, 0x033A, 0x811D, 0x031E, 0x81D8, 0x0303, 0x8294, 0x02E9,
+    0x835B, 0x02D0, 0x8423, 0x02B8, 0x84EB, 0x02A0, 0x85B2, 0x0288, 0x8678, 0x0271, 0x873E, 0x025A, 0x8803, 0x0244, 0x88C5, 0x022D,
+    0x8986, 0x0217, 0x8A45, 0x0202, 0x8B04, 0x01ED, 0x8BC3, 0x01D9, 0x8C81, 0x01C5, 0x8D3F, 0x01B2, 0x8DFB, 0x01A0, 0x8EB5, 0x018E,
+    0x8F6F, 0x017C, 0x9029, 0x016B, 0x90E3, 0x015B, 0x919C, 0x014C, 0x9253, 0x013D, 0x9309, 0x012E, 0x93BC, 0x0120, 0x946C, 0x0111,
+    0x9519, 0x0103, 0x95C7, 0x00F6, 0x967C, 0x00E9, 0x9734, 0x00DD, 0x97EC, 0x00D1, 0x98A3, 0x00C5, 0x9957, 0x00BA, 0x9A0F, 0x00AF,
+    0x9ACC, 0x00A5, 0x9B8F, 0x009C, 0x9C50, 0x0093, 0x9D10, 0x008A, 0x9DCD, 0x0081, 0x9E87, 0x0079, 0x9F42, 0x0071, 0x9FFB, 0x006A,
+    0xA0B4, 0x0063, 0xA168, 0x005C, 0xA21D, 0x0056, 0xA2DB, 0x0050, 0xA396, 0x004A, 0xA452, 0x0045, 0xA511, 0x0040, 0xA5CC, 0x003B,
+    0xA684, 0x0036, 0xA73C, 0x0031, 0xA7F5, 0x002D, 0xA8B4, 0x0029, 0xA972, 0x0026, 0xAA2F, 0x0022, 0xAAE8, 0x001F, 0xAB9D, 0x001C,
+    0xAC4D, 0x0019, 0xAD01, 0x0017, 0xADB9, 0x0014, 0xAE6E, 0x0012, 0xAF29, 0x0010, 0xAFE9, 0x000E, 0xB0A2, 0x000C, 0xB158, 0x000B,
+    0xB20C, 0x0009, 0xB2BA, 0x0008, 0xB36C, 0x0007, 0xB41B, 0x0006, 0xB4CF, 0x0005, 0xB576, 0x0004, 0xB636, 0x0003, 0xB6F4, 0x0002,
+    // roughness row 82
+    0x67C7, 0x0A09, 0x680D, 0x09E9, 0x6856, 0x09C8, 0x68A3, 0x09A6, 0x68F4, 0x0984, 0x6948, 0x0962, 0x699F, 0x093E, 0x69F9, 0x091B,
+    0x6A56, 0x08F7, 0x6AB6, 0x08D3, 0x6B18, 0x08AE, 0x6B7D, 0x0889, 0x6BE4, 0x0864, 0x6C4D, 0x083F, 0x6CB9, 0x0819, 0x6D26, 0x07F4,
+    0x6D96, 0x07CF, 0x6E07, 0x07AA, 0x6E7B, 0x0785, 0x6EEF, 0x0760, 0x6F66, 0x073B, 0x6FDD, 0x0717, 0x7056, 0x06F1, 0x70D0, 0x06CC,
+    0x714A, 0x06A6, 0x71C6, 0x0681, 0x7242, 0x065C, 0x72C0, 0x0637, 0x733E, 0x0613, 0x73BE, 0x05F0, 0x7440, 0x05CD, 0x74C4, 0x05AB,
+    0x7549, 0x058A, 0x75CE, 0x0568, 0x7653, 0x0547, 0x76D8, 0x0525, 0x775C, 0x0503, 0x77E2, 0x04E0, 0x786B, 0x04BE, 0x78F5, 0x049D,
+    0x797F, 0x047D, 0x7A0A, 0x045E, 0x7A95, 0x043F, 0x7B1F, 0x0421, 0x7BA9, 0x0402, 0x7C33, 0x03E5, 0x7CBD, 0x03C8, 0x7D49, 0x03AB,
+    0x7DE1, 0x038F, 0x7E7D, 0x0374, 0x7F19, 0x0359, 0x7FB3, 0x033E, 0x8052, 0x0324, 0x8105, 0x030A, 0x81BA, 0x02F0, 0x8275, 0x02D6,
+    0x8331, 0x02BD, 0x83ED, 0x02A5, 0x84AA, 0x028E, 0x8567, 0x0277, 0x8622, 0x0261, 0x86DC, 0x024B, 0x8796, 0x0235, 0x884F, 0x0220,
+    0x8907, 0x020B, 0x89BC, 0x01F6, 0x8A70, 0x01E1, 0x8B23, 0x01CE, 0x8BD5, 0x01BB, 0x8C87, 0x01A8, 0x8D37, 0x0196, 0x8DE7, 0x0184,
+    0x8E96, 0x0173, 0x8F42, 0x0163, 0x8FEE, 0x0153, 0x909A, 0x0144, 0x9147, 0x0135, 0x91F1, 0x0127, 0x929B, 0x0119, 0x9340, 0x010C,
+    0x93EE, 0x00FE, 0x949E, 0x00F1, 0x954E, 0x00E5, 0x95FC, 0x00D9, 0x96A9, 0x00CD, 0x9756, 0x00C2, 0x980B, 0x00B7, 0x98C3, 0x00AC,
+    0x9978, 0x00A2, 0x9A2D, 0x0099, 0x9AE3, 0x0090, 0x9B99, 0x0087, 0x9C4C, 0x007F, 0x9CFD, 0x0077, 0x9DAC, 0x006F, 0x9E5B, 0x0068,
+    0x9F09, 0x0061, 0x9FBC, 0x005B, 0xA071, 0x0055, 0xA122, 0x004F, 0xA1DC, 0x0049, 0xA298, 0x0044, 0xA352, 0x003F, 0xA407, 0x003A,
+    0xA4B8, 0x0036, 0xA568, 0x0031, 0xA620, 0x002D, 0xA6D8, 0x0029, 0xA790, 0x0026, 0xA844, 0x0022, 0xA8F3, 0x001F, 0xA9A4, 0x001C,
+    0xAA50, 0x0019, 0xAB02, 0x0017, 0xABB4, 0x0014, 0xAC6B, 0x0012, 0xAD1B, 0x0010, 0xADC5, 0x000E, 0xAE7E, 0x000D, 0xAF31, 0x000B,
+    0xAFDE, 0x0009, 0xB08B, 0x0008, 0xB134, 0x0007, 0xB1E0, 0x0006, 0xB283, 0x0005, 0xB332, 0x0004, 0xB3E0, 0x0003, 0xB48F, 0x0002,
+    // roughness row 83
+    0x6977, 0x09E6, 0x69B6, 0x09C5, 0x69F9, 0x09A3, 0x6A40, 0x0981, 0x6A8A, 0x095F, 0x6AD7, 0x093C, 0x6B27, 0x0918, 0x6B79, 0x08F4,
+    0x6BCF, 0x08CF, 0x6C27, 0x08AB, 0x6C81, 0x0886, 0x6CDE, 0x0862, 0x6D3D, 0x083C, 0x6D9E, 0x0817, 0x6E01, 0x07F1, 0x6E66, 0x07CC,
+    0x6ECC, 0x07A7, 0x6F35, 0x0782, 0x6F9F, 0x075D, 0x700A, 0x0738, 0x7077, 0x0713, 0x70E5, 0x06EE, 0x7154, 0x06CA, 0x71C4, 0x06A4,
+    0x7235, 0x067F, 0x72A6, 0x065A, 0x7318, 0x0635, 0x738B, 0x0611, 0x73FF, 0x05ED, 0x7475, 0x05CA, 0x74EE, 0x05A8, 0x7567, 0x0587,
+    0x75E1, 0x0566, 0x765B, 0x0545, 0x76D5, 0x0524, 0x774F, 0x0504, 0x77CC, 0x04E3, 0x784B, 0x04C2, 0x78C9, 0x04A0, 0x7947, 0x047F,
+    0x79C4, 0x045F, 0x7A43, 0x0440, 0x7AC2, 0x0422, 0x7B42, 0x0405, 0x7BC1, 0x03E7, 0x7C3F, 0x03CA, 0x7CC1, 0x03AE, 0x7D4F, 0x0392,
+    0x7DE0, 0x0377, 0x7E70, 0x035C, 0x7EFF, 0x0342, 0x7F97, 0x0328, 0x803F, 0x030E, 0x80EE, 0x02F5, 0x81A1, 0x02DC, 0x8253, 0x02C4,
+    0x8303, 0x02AB, 0x83B3, 0x0293, 0x8464, 0x027C, 0x8515, 0x0266, 0x85C7, 0x0251, 0x8677, 0x023B, 0x8726, 0x0226, 0x87D2, 0x0211,
+    0x887F, 0x01FD, 0x892C, 0x01EA, 0x89D6, 0x01D6, 0x8A7E, 0x01C3, 0x8B25, 0x01B0, 0x8BCA, 0x019E, 0x8C70, 0x018C, 0x8D14, 0x017B,
+    0x8DB7, 0x016B, 0x8E59, 0x015B, 0x8EF9, 0x014B, 0x8F98, 0x013C, 0x9037, 0x012D, 0x90D6, 0x0120, 0x9178, 0x0112, 0x9225, 0x0106,
+    0x92D2, 0x00F9, 0x937C, 0x00ED, 0x9423, 0x00E1, 0x94C7, 0x00D5, 0x9572, 0x00C9, 0x9623, 0x00BE, 0x96D4, 0x00B4, 0x9783, 0x00AA,
+    0x982E, 0x00A0, 0x98D8, 0x0096, 0x9981, 0x008D, 0x9A29, 0x0085, 0x9AD3, 0x007D, 0x9B7B, 0x0075, 0x9C20, 0x006E, 0x9CC5, 0x0067,
+    0x9D6D, 0x0060, 0x9E14, 0x0059, 0x9EC1, 0x0053, 0x9F74, 0x004E, 0xA027, 0x0048, 0xA0D8, 0x0043, 0xA187, 0x003E, 0xA23A, 0x003A,
+    0xA2F1, 0x0035, 0xA3A2, 0x0031, 0xA44E, 0x002D, 0xA4F4, 0x0029, 0xA59C, 0x0025, 0xA64A, 0x0022, 0xA6F7, 0x001F, 0xA7A1, 0x001C,
+    0xA850, 0x0019, 0xA8FF, 0x0017, 0xA9AB, 0x0014, 0xAA55, 0x0012, 0xAAFC, 0x0010, 0xABA8, 0x000E, 0xAC50, 0x000D, 0xACFC, 0x000B,
+    0xADAC, 0x000A, 0xAE50, 0x0008, 0xAEF3, 0x0007, 0xAF91, 0x0006, 0xB036, 0x0005, 0xB0E3, 0x0004, 0xB18A, 0x0003, 0xB219, 0x0002,
+    // roughness row 84
+    0x6B21, 0x09C2, 0x6B5A, 0x09A1, 0x6B96, 0x097F, 0x6BD6, 0x095D, 0x6C19, 0x0939, 0x6C5F, 0x0916, 0x6CA8, 0x08F2, 0x6CF3, 0x08CD,
+    0x6D41, 0x08A9, 0x6D91, 0x0884, 0x6DE4, 0x085F, 0x6E39, 0x083A, 0x6E90, 0x0815, 0x6EE8, 0x07EF, 0x6F43, 0x07CA, 0x6F9F, 0x07A4,
+    0x6FFC, 0x077F, 0x705C, 0x075A, 0x70BC, 0x0735, 0x711E, 0x0710, 0x7182, 0x06EB, 0x71E6, 0x06C7, 0x724C, 0x06A2, 0x72B2, 0x067E,
+    0x7319, 0x0659, 0x7380, 0x0634, 0x73E7, 0x060F, 0x7450, 0x05EC, 0x74BB, 0x05C9, 0x7528, 0x05A6, 0x7595, 0x0584, 0x7604, 0x0563,
+    0x7672, 0x0543, 0x76E1, 0x0523, 0x7751, 0x0503, 0x77C3, 0x04E3, 0x7838, 0x04C3, 0x78AD, 0x04A3, 0x7920, 0x0483, 0x7993, 0x0463,
+    0x7A05, 0x0443, 0x7A78, 0x0424, 0x7AEB, 0x0406, 0x7B5F, 0x03E9, 0x7BD4, 0x03CD, 0x7C4B, 0x03B1, 0x7CCF, 0x0395, 0x7D54, 0x037A,
+    0x7DD9, 0x035F, 0x7E5D, 0x0345, 0x7EED, 0x032B, 0x7F8A, 0x0312, 0x8031, 0x02F9, 0x80DA, 0x02E1, 0x8183, 0x02C9, 0x822A, 0x02B1,
+    0x82D1, 0x029A, 0x8377, 0x0282, 0x841C, 0x026B, 0x84C1, 0x0255, 0x8566, 0x0240, 0x860C, 0x022C, 0x86B1, 0x0218, 0x8755, 0x0204,
+    0x87F7, 0x01F0, 0x8897, 0x01DD, 0x8937, 0x01CA, 0x89D6, 0x01B8, 0x8A73, 0x01A6, 0x8B0E, 0x0194, 0x8BA8, 0x0183, 0x8C40, 0x0172,
+    0x8CD8, 0x0162, 0x8D6E, 0x0153, 0x8E03, 0x0143, 0x8E97, 0x0135, 0x8F28, 0x0126, 0x8FC8, 0x0119, 0x906A, 0x010C, 0x910D, 0x00FF,
+    0x91AF, 0x00F3, 0x9250, 0x00E8, 0x92F3, 0x00DC, 0x939F, 0x00D1, 0x9448, 0x00C6, 0x94F0, 0x00BB, 0x9596, 0x00B1, 0x963B, 0x00A7,
+    0x96E0, 0x009E, 0x9783, 0x0095, 0x9821, 0x008C, 0x98BD, 0x0083, 0x9957, 0x007B, 0x99F4, 0x0073, 0x9A9A, 0x006C, 0x9B3F, 0x0065,
+    0x9BDE, 0x005F, 0x9C84, 0x0058, 0x9D29, 0x0052, 0x9DCD, 0x004C, 0x9E73, 0x0047, 0x9F1A, 0x0042, 0x9FC7, 0x003D, 0xA074, 0x0039,
+    0xA11F, 0x0035, 0xA1C9, 0x0031, 0xA26E, 0x002D, 0xA312, 0x0029, 0xA3B2, 0x0025, 0xA44F, 0x0022, 0xA4F0, 0x001F, 0xA59B, 0x001C,
+    0xA648, 0x0019, 0xA6F0, 0x0017, 0xA794, 0x0014, 0xA831, 0x0012, 0xA8DA, 0x0010, 0xA980, 0x000E, 0xAA21, 0x000D, 0xAAC4, 0x000B,
+    0xAB65, 0x000A, 0xAC09, 0x0008, 0xACA5, 0x0007, 0xAD3D, 0x0006, 0xADE2, 0x0005, 0xAE8B, 0x0004, 0xAF22, 0x0003, 0xAFB2, 0x0002,
+    // roughness row 85
+    0x6CC3, 0x099F, 0x6CF6, 0x097D, 0x6D2C, 0x095B, 0x6D65, 0x0938, 0x6DA2, 0x0914, 0x6DE0, 0x08F1, 0x6E22, 0x08CC, 0x6E66, 0x08A7,
+    0x6EAD, 0x0882, 0x6EF5, 0x085E, 0x6F40, 0x0839, 0x6F8D, 0x0814, 0x6FDB, 0x07EE, 0x702C, 0x07C8, 0x707D, 0x07A3, 0x70D1, 0x077D,
+    0x7126, 0x0758, 0x717C, 0x0733, 0x71D3, 0x070E, 0x722C, 0x06E9, 0x7286, 0x06C4, 0x72E1, 0x06A0, 0x733C, 0x067C, 0x7399, 0x0658,
+    0x73F6, 0x0634, 0x7453, 0x060F, 0x74B1, 0x05EB, 0x7511, 0x05C8, 0x7572, 0x05A5, 0x75D5, 0x0583, 0x7637, 0x0561, 0x769A, 0x0541,
+    0x76FE, 0x0521, 0x7762, 0x0501, 0x77C8, 0x04E1, 0x7833, 0x04C3, 0x789E, 0x04A4, 0x7908, 0x0485, 0x7971, 0x0466, 0x79DA, 0x0447,
+    0x7A42, 0x0428, 0x7AA9, 0x0409, 0x7B10, 0x03EB, 0x7B7A, 0x03CF, 0x7BE5, 0x03B3, 0x7C60, 0x0398, 0x7CDB, 0x037D, 0x7D54, 0x0362,
+    0x7DCE, 0x0348, 0x7E54, 0x032F, 0x7EE7, 0x0316, 0x7F86, 0x02FD, 0x8025, 0x02E5, 0x80C3, 0x02CD, 0x8161, 0x02B5, 0x81FF, 0x029F,
+    0x829C, 0x0288, 0x8338, 0x0272, 0x83D2, 0x025C, 0x846B, 0x0246, 0x8504, 0x0231, 0x859F, 0x021D, 0x8639, 0x0209, 0x86D3, 0x01F7,
+    0x876B, 0x01E4, 0x8802, 0x01D2, 0x8897, 0x01BF, 0x892B, 0x01AE, 0x89BD, 0x019C, 0x8A4D, 0x018B, 0x8ADB, 0x017A, 0x8B68, 0x016A,
+    0x8BF4, 0x015A, 0x8C7D, 0x014B, 0x8D06, 0x013C, 0x8D95, 0x012E, 0x8E2D, 0x0120, 0x8EC4, 0x0112, 0x8F5A, 0x0105, 0x8FEF, 0x00F9,
+    0x9086, 0x00ED, 0x9129, 0x00E2, 0x91D0, 0x00D7, 0x9276, 0x00CD, 0x9319, 0x00C2, 0x93B8, 0x00B8, 0x9456, 0x00AE, 0x94F1, 0x00A4,
+    0x958A, 0x009B, 0x9622, 0x0092, 0x96BB, 0x008A, 0x974E, 0x0082, 0x97E5, 0x0079, 0x987D, 0x0072, 0x9913, 0x006A, 0x99B0, 0x0064,
+    0x9A54, 0x005E, 0x9AF4, 0x0057, 0x9B93, 0x0052, 0x9C30, 0x004C, 0x9CCD, 0x0046, 0x9D6E, 0x0041, 0x9E0D, 0x003C, 0x9EAB, 0x0038,
+    0x9F4B, 0x0034, 0x9FEE, 0x0030, 0xA08E, 0x002C, 0xA12D, 0x0029, 0xA1C4, 0x0025, 0xA260, 0x0022, 0xA2FD, 0x001F, 0xA39A, 0x001C,
+    0xA438, 0x0019, 0xA4D3, 0x0017, 0xA56F, 0x0014, 0xA614, 0x0012, 0xA6B0, 0x0010, 0xA749, 0x000E, 0xA7E8, 0x000D, 0xA880, 0x000B,
+    0xA917, 0x000A, 0xA9B3, 0x0008, 0xAA4C, 0x0007, 0xAAEB, 0x0006, 0xAB89, 0x0005, 0xAC1B, 0x0004, 0xACAD, 0x0003, 0xAD4D, 0x0002,
+    // roughness row 86
+    0x6E5F, 0x097C, 0x6E8B, 0x095A, 0x6EBB, 0x0937, 0x6EEE, 0x0914, 0x6F23, 0x08F0, 0x6F5B, 0x08CC, 0x6F95, 0x08A7, 0x6FD2, 0x0882,
+    0x7011, 0x085D, 0x7052, 0x0838, 0x7095, 0x0812, 0x70DA, 0x07ED, 0x7120, 0x07C8, 0x7168, 0x07A2, 0x71B1, 0x077D, 0x71FC, 0x0757,
+    0x7248, 0x0732, 0x7295, 0x070D, 0x72E4, 0x06E8, 0x7333, 0x06C3, 0x7383, 0x069E, 0x73D5, 0x067A, 0x7427, 0x0656, 0x747A, 0x0633,
+    0x74CD, 0x060F, 0x7521, 0x05EB, 0x7576, 0x05C8, 0x75CC, 0x05A5, 0x7623, 0x0583, 0x767B, 0x0561, 0x76D3, 0x0540, 0x772B, 0x051F,
+    0x7783, 0x04FF, 0x77DE, 0x04E0, 0x783D, 0x04C1, 0x789E, 0x04A3, 0x78FD, 0x0485, 0x795D, 0x0467, 0x79BD, 0x044A, 0x7A1B, 0x042C,
+    0x7A79, 0x040D, 0x7AD4, 0x03EF, 0x7B33, 0x03D2, 0x7B93, 0x03B6, 0x7C02, 0x039A, 0x7C72, 0x037F, 0x7CE2, 0x0366, 0x7D50, 0x034C,
+    0x7DCD, 0x0332, 0x7E58, 0x0319, 0x7EED, 0x0301, 0x7F81, 0x02E9, 0x8015, 0x02D1, 0x80A9, 0x02BA, 0x813C, 0x02A3, 0x81CF, 0x028D,
+    0x8261, 0x0277, 0x82F4, 0x0262, 0x8385, 0x024D, 0x8414, 0x0238, 0x84A1, 0x0223, 0x852E, 0x020F, 0x85BD, 0x01FC, 0x864A, 0x01E9,
+    0x86D8, 0x01D7, 0x8765, 0x01C6, 0x87F0, 0x01B4, 0x8878, 0x01A3, 0x8900, 0x0192, 0x8986, 0x0182, 0x8A09, 0x0172, 0x8A8A, 0x0162,
+    0x8B09, 0x0152, 0x8B8A, 0x0143, 0x8C16, 0x0135, 0x8CA3, 0x0127, 0x8D30, 0x0119, 0x8DBA, 0x010C, 0x8E46, 0x00FF, 0x8ED9, 0x00F3,
+    0x8F74, 0x00E8, 0x9010, 0x00DD, 0x90AB, 0x00D2, 0x9144, 0x00C8, 0x91DF, 0x00BE, 0x9277, 0x00B4, 0x930C, 0x00AB, 0x939F, 0x00A2,
+    0x9431, 0x0099, 0x94C0, 0x0090, 0x9550, 0x0088, 0x95E4, 0x0080, 0x9676, 0x0078, 0x9703, 0x0071, 0x9795, 0x0069, 0x982A, 0x0062,
+    0x98C2, 0x005C, 0x995D, 0x0056, 0x99F6, 0x0051, 0x9A92, 0x004B, 0x9B2A, 0x0046, 0x9BC0, 0x0041, 0x9C53, 0x003C, 0x9CE9, 0x0037,
+    0x9D7D, 0x0033, 0x9E10, 0x002F, 0x9EA4, 0x002C, 0x9F39, 0x0028, 0x9FD6, 0x0025, 0xA072, 0x0022, 0xA109, 0x001F, 0xA19D, 0x001C,
+    0xA22E, 0x0019, 0xA2C4, 0x0017, 0xA35F, 0x0014, 0xA3F1, 0x0012, 0xA484, 0x0010, 0xA517, 0x000E, 0xA5A1, 0x000D, 0xA631, 0x000B,
+    0xA6C5, 0x000A, 0xA752, 0x0008, 0xA7EE, 0x0007, 0xA88D, 0x0006, 0xA920, 0x0005, 0xA9A6, 0x0004, 0xAA3E, 0x0003, 0xAAE2, 0x0003,
+    // roughness row 87
+    0x6FF4, 0x0959, 0x701A, 0x0937, 0x7043, 0x0913, 0x706F, 0x08F0, 0x709D, 0x08CB, 0x70CE, 0x08A7, 0x7102, 0x0882, 0x7137, 0x085D,
+    0x716E, 0x0837, 0x71A8, 0x0812, 0x71E3, 0x07ED, 0x7220, 0x07C8, 0x725E, 0x07A2, 0x729E, 0x077D, 0x72DE, 0x0757, 0x7321, 0x0732,
+    0x7364, 0x070C, 0x73A8, 0x06E7, 0x73EE, 0x06C3, 0x7434, 0x069E, 0x747A, 0x0679, 0x74C2, 0x0655, 0x750A, 0x0631, 0x7553, 0x060E,
+    0x759D, 0x05EB, 0x75E8, 0x05C8, 0x7635, 0x05A6, 0x7681, 0x0584, 0x76CE, 0x0561, 0x771B, 0x0540, 0x7768, 0x051F, 0x77B5, 0x04FE,
+    0x7803, 0x04DE, 0x7858, 0x04C0, 0x78AC, 0x04A1, 0x7901, 0x0484, 0x7957, 0x0467, 0x79AD, 0x044A, 0x7A03, 0x042D, 0x7A57, 0x0411,
+    0x7AAA, 0x03F4, 0x7AFF, 0x03D7, 0x7B54, 0x03BA, 0x7BB7, 0x039E, 0x7C1B, 0x0383, 0x7C7F, 0x0368, 0x7CE3, 0x034E, 0x7D56, 0x0336,
+    0x7DD9, 0x031D, 0x7E64, 0x0304, 0x7EEE, 0x02ED, 0x7F78, 0x02D5, 0x8002, 0x02BE, 0x808B, 0x02A7, 0x8114, 0x0291, 0x819C, 0x027C,
+    0x8223, 0x0266, 0x82AA, 0x0251, 0x8331, 0x023D, 0x83B6, 0x0229, 0x843A, 0x0215, 0x84BC, 0x0202, 0x853C, 0x01EE, 0x85BD, 0x01DC,
+    0x863E, 0x01CA, 0x86BF, 0x01B9, 0x8740, 0x01A9, 0x87BE, 0x0198, 0x883B, 0x0188, 0x88B5, 0x0178, 0x892F, 0x0169, 0x89A7, 0x015A,
+    0x8A24, 0x014B, 0x8AA8, 0x013C, 0x8B2B, 0x012E, 0x8BAD, 0x0120, 0x8C30, 0x0113, 0x8CB5, 0x0106, 0x8D44, 0x00FA, 0x8DD3, 0x00EE,
+    0x8E63, 0x00E2, 0x8EF2, 0x00D7, 0x8F80, 0x00CD, 0x9011, 0x00C3, 0x90A0, 0x00B9, 0x912E, 0x00B0, 0x91BC, 0x00A7, 0x9247, 0x009E,
+    0x92CE, 0x0096, 0x935B, 0x008E, 0x93E6, 0x0085, 0x946F, 0x007E, 0x94FB, 0x0076, 0x9590, 0x006F, 0x9621, 0x0068, 0x96AD, 0x0062,
+    0x9735, 0x005B, 0x97C2, 0x0055, 0x9854, 0x004F, 0x98E9, 0x004A, 0x997A, 0x0045, 0x9A0B, 0x0040, 0x9A98, 0x003C, 0x9B23, 0x0037,
+    0x9BAB, 0x0033, 0x9C32, 0x002F, 0x9CBC, 0x002B, 0x9D51, 0x0028, 0x9DE6, 0x0024, 0x9E7D, 0x0021, 0x9F0E, 0x001F, 0x9F99, 0x001C,
+    0xA026, 0x0019, 0xA0B2, 0x0017, 0xA13B, 0x0014, 0xA1CD, 0x0012, 0xA259, 0x0010, 0xA2DE, 0x000E, 0xA366, 0x000D, 0xA3EC, 0x000B,
+    0xA470, 0x000A, 0xA4FF, 0x0008, 0xA593, 0x0007, 0xA627, 0x0006, 0xA6B0, 0x0005, 0xA741, 0x0004, 0xA7D4, 0x0003, 0xA869, 0x0003,
+    // roughness row 88
+    0x7181, 0x0937, 0x71A1, 0x0914, 0x71C4, 0x08F0, 0x71E9, 0x08CC, 0x7211, 0x08A7, 0x723B, 0x0883, 0x7267, 0x085E, 0x7295, 0x0838,
+    0x72C5, 0x0813, 0x72F6, 0x07ED, 0x732A, 0x07C8, 0x735E, 0x07A3, 0x7395, 0x077E, 0x73CC, 0x0758, 0x7404, 0x0733, 0x743E, 0x070D,
+    0x7478, 0x06E8, 0x74B4, 0x06C3, 0x74F0, 0x069E, 0x752D, 0x067A, 0x756B, 0x0655, 0x75A9, 0x0631, 0x75E7, 0x060D, 0x7627, 0x05EA,
+    0x7667, 0x05C8, 0x76AA, 0x05A6, 0x76ED, 0x0584, 0x7730, 0x0563, 0x7772, 0x0541, 0x77B5, 0x0520, 0x77F7, 0x04FF, 0x783A, 0x04DF,
+    0x7882, 0x04BF, 0x78CC, 0x04A1, 0x7915, 0x0483, 0x7961, 0x0466, 0x79AC, 0x0449, 0x79F8, 0x042E, 0x7A42, 0x0412, 0x7A8C, 0x03F6,
+    0x7AD9, 0x03DB, 0x7B25, 0x03BF, 0x7B7E, 0x03A3, 0x7BD7, 0x0387, 0x7C2F, 0x036C, 0x7C88, 0x0352, 0x7CF0, 0x0339, 0x7D6A, 0x0320,
+    0x7DEB, 0x0308, 0x7E6C, 0x02F1, 0x7EEC, 0x02D9, 0x7F6C, 0x02C2, 0x7FEA, 0x02AC, 0x8069, 0x0296, 0x80E6, 0x0280, 0x8163, 0x026B,
+    0x81E0, 0x0256, 0x825B, 0x0242, 0x82D6, 0x022E, 0x8351, 0x021A, 0x83CA, 0x0207, 0x8442, 0x01F5, 0x84B8, 0x01E2, 0x852C, 0x01CF,
+    0x859F, 0x01BE, 0x8614, 0x01AD, 0x8687, 0x019D, 0x86FB, 0x018D, 0x876D, 0x017E, 0x87DD, 0x016F, 0x8850, 0x0160, 0x88CA, 0x0151,
+    0x8947, 0x0143, 0x89C4, 0x0135, 0x8A3E, 0x0128, 0x8ABC, 0x011A, 0x8B3A, 0x010D, 0x8BC1, 0x0101, 0x8C47, 0x00F5, 0x8CCB, 0x00E9,
+    0x8D50, 0x00DD, 0x8DD3, 0x00D2, 0x8E56, 0x00C8, 0x8EDA, 0x00BE, 0x8F5D, 0x00B5, 0x8FE0, 0x00AC, 0x9060, 0x00A3, 0x90E6, 0x009B,
+    0x916D, 0x0093, 0x91F1, 0x008B, 0x9273, 0x0083, 0x92FE, 0x007C, 0x938A, 0x0074, 0x9413, 0x006D, 0x949D, 0x0067, 0x9525, 0x0061,
+    0x95AE, 0x005A, 0x9633, 0x0054, 0x96B4, 0x004E, 0x973B, 0x0049, 0x97C4, 0x0044, 0x984C, 0x003F, 0x98D2, 0x003B, 0x9952, 0x0037,
+    0x99CF, 0x0032, 0x9A57, 0x002E, 0x9AE5, 0x002B, 0x9B6F, 0x0027, 0x9BF7, 0x0024, 0x9C7F, 0x0021, 0x9D04, 0x001E, 0x9D90, 0x001C,
+    0x9E16, 0x0019, 0x9E98, 0x0017, 0x9F1C, 0x0014, 0x9F9D, 0x0012, 0xA01C, 0x0010, 0xA0A4, 0x000E, 0xA127, 0x000D, 0xA1A2, 0x000B,
+    0xA222, 0x000A, 0xA2AF, 0x0008, 0xA33E, 0x0007, 0xA3C5, 0x0006, 0xA453, 0x0005, 0xA4E1, 0x0004, 0xA56A, 0x0003, 0xA5E1, 0x0003,
+    // roughness row 89
+    0x7307, 0x0914, 0x7321, 0x08F1, 0x733D, 0x08CD, 0x735C, 0x08A8, 0x737D, 0x0884, 0x73A0, 0x085F, 0x73C5, 0x083A, 0x73EB, 0x0814,
+    0x7414, 0x07EE, 0x743E, 0x07C9, 0x7469, 0x07A4, 0x7496, 0x077E, 0x74C4, 0x0759, 0x74F3, 0x0734, 0x7523, 0x070F, 0x7554, 0x06E9,
+    0x7586, 0x06C4, 0x75B9, 0x069F, 0x75EC, 0x067A, 0x7620, 0x0656, 0x7654, 0x0632, 0x7689, 0x060E, 0x76BE, 0x05EB, 0x76F4, 0x05C8,
+    0x772C, 0x05A6, 0x7765, 0x0585, 0x779E, 0x0563, 0x77D7, 0x0542, 0x780F, 0x0521, 0x7848, 0x0500, 0x7880, 0x04E0, 0x78BC, 0x04C0,
+    0x78FB, 0x04A1, 0x793A, 0x0483, 0x797B, 0x0466, 0x79BB, 0x0449, 0x79FB, 0x042D, 0x7A3B, 0x0412, 0x7A7B, 0x03F7, 0x7ABF, 0x03DC,
+    0x7B02, 0x03C2, 0x7B52, 0x03A7, 0x7BA3, 0x038D, 0x7BF2, 0x0372, 0x7C40, 0x0357, 0x7C9B, 0x033D, 0x7D0A, 0x0324, 0x7D81, 0x030C,
+    0x7DF7, 0x02F4, 0x7E6D, 0x02DD, 0x7EE3, 0x02C6, 0x7F58, 0x02B0, 0x7FCD, 0x029A, 0x8041, 0x0285, 0x80B4, 0x0270, 0x8126, 0x025B,
+    0x8197, 0x0246, 0x8207, 0x0232, 0x8277, 0x021F, 0x82E5, 0x020C, 0x8353, 0x01F9, 0x83C1, 0x01E7, 0x842C, 0x01D5, 0x8496, 0x01C4,
+    0x84FE, 0x01B2, 0x8564, 0x01A1, 0x85CB, 0x0191, 0x8631, 0x0182, 0x869B, 0x0173, 0x8705, 0x0165, 0x877C, 0x0157, 0x87F2, 0x0149,
+    0x8866, 0x013B, 0x88DE, 0x012E, 0x8953, 0x0121, 0x89CF, 0x0114, 0x8A4D, 0x0107, 0x8ACC, 0x00FB, 0x8B49, 0x00F0, 0x8BC5, 0x00E4,
+    0x8C3D, 0x00D9, 0x8CB5, 0x00CE, 0x8D2B, 0x00C4, 0x8DA0, 0x00BA, 0x8E15, 0x00B0, 0x8E8A, 0x00A7, 0x8F09, 0x009F, 0x8F85, 0x0097,
+    0x9003, 0x008F, 0x9085, 0x0088, 0x910B, 0x0080, 0x918E, 0x0079, 0x920F, 0x0072, 0x928E, 0x006C, 0x9312, 0x0065, 0x9396, 0x005F,
+    0x9419, 0x0059, 0x949B, 0x0053, 0x9519, 0x004E, 0x9592, 0x0048, 0x9609, 0x0043, 0x9682, 0x003E, 0x96FD, 0x003A, 0x977C, 0x0036,
+    0x9802, 0x0032, 0x9886, 0x002E, 0x9906, 0x002A, 0x9983, 0x0027, 0x9A00, 0x0024, 0x9A7A, 0x0021, 0x9AFC, 0x001E, 0x9B7C, 0x001B,
+    0x9BFB, 0x0019, 0x9C79, 0x0016, 0x9CF0, 0x0014, 0x9D67, 0x0012, 0x9DE5, 0x0010, 0x9E62, 0x000E, 0x9EDC, 0x000D, 0x9F63, 0x000B,
+    0x9FEF, 0x000A, 0xA070, 0x0008, 0xA0EA, 0x0007, 0xA164, 0x0006, 0xA1F0, 0x0005, 0xA277, 0x0004, 0xA2F4, 0x0003, 0xA36F, 0x0003,
+    // roughness row 90
+    0x7486, 0x08F2, 0x7499, 0x08CE, 0x74AF, 0x08AA, 0x74C7, 0x0885, 0x74E1, 0x0861, 0x74FD, 0x083B, 0x751B, 0x0816, 0x753B, 0x07F1,
+    0x755B, 0x07CB, 0x757E, 0x07A5, 0x75A1, 0x0780, 0x75C6, 0x075B, 0x75EC, 0x0735, 0x7613, 0x0710, 0x763B, 0x06EB, 0x7663, 0x06C6,
+    0x768C, 0x06A0, 0x76B6, 0x067C, 0x76E0, 0x0657, 0x770B, 0x0633, 0x7736, 0x0610, 0x7762, 0x05EC, 0x778E, 0x05C9, 0x77BB, 0x05A6,
+    0x77EA, 0x0585, 0x781A, 0x0564, 0x7849, 0x0544, 0x7878, 0x0523, 0x78A6, 0x0502, 0x78D4, 0x04E2, 0x7905, 0x04C2, 0x793A, 0x04A3,
+    0x796F, 0x0484, 0x79A4, 0x0466, 0x79DA, 0x044A, 0x7A0F, 0x042D, 0x7A45, 0x0412, 0x7A79, 0x03F6, 0x7AB3, 0x03DC, 0x7AED, 0x03C3,
+    0x7B31, 0x03A9, 0x7B7A, 0x0390, 0x7BC1, 0x0376, 0x7C06, 0x035C, 0x7C57, 0x0343, 0x7CBB, 0x0329, 0x7D27, 0x0310, 0x7D92, 0x02F8,
+    0x7DFE, 0x02E0, 0x7E6A, 0x02CA, 0x7ED5, 0x02B3, 0x7F3F, 0x029E, 0x7FA9, 0x0288, 0x8013, 0x0274, 0x807B, 0x025F, 0x80E3, 0x024B,
+    0x8149, 0x0237, 0x81AE, 0x0224, 0x8212, 0x0210, 0x8275, 0x01FE, 0x82D7, 0x01EC, 0x8338, 0x01DA, 0x8399, 0x01C9, 0x83F8, 0x01B8,
+    0x8455, 0x01A7, 0x84B0, 0x0197, 0x850B, 0x0187, 0x856A, 0x0177, 0x85CF, 0x0169, 0x863C, 0x015B, 0x86A9, 0x014D, 0x8717, 0x0140,
+    0x8785, 0x0133, 0x87F3, 0x0126, 0x886D, 0x011A, 0x88E6, 0x010D, 0x895D, 0x0101, 0x89D2, 0x00F6, 0x8A45, 0x00EA, 0x8AB6, 0x00DF,
+    0x8B25, 0x00D5, 0x8B92, 0x00CA, 0x8BFB, 0x00C0, 0x8C63, 0x00B6, 0x8CD1, 0x00AD, 0x8D40, 0x00A4, 0x8DB3, 0x009B, 0x8E26, 0x0093,
+    0x8EA1, 0x008C, 0x8F1C, 0x0084, 0x8F99, 0x007D, 0x9014, 0x0077, 0x908F, 0x0070, 0x910A, 0x0069, 0x9184, 0x0063, 0x9200, 0x005D,
+    0x927B, 0x0057, 0x92F7, 0x0052, 0x936E, 0x004D, 0x93E0, 0x0048, 0x944C, 0x0042, 0x94B7, 0x003E, 0x9533, 0x0039, 0x95B3, 0x0035,
+    0x9631, 0x0031, 0x96A9, 0x002E, 0x971E, 0x002A, 0x978F, 0x0027, 0x9800, 0x0023, 0x9878, 0x0020, 0x98EA, 0x001E, 0x9960, 0x001B,
+    0x99D9, 0x0019, 0x9A50, 0x0016, 0x9AC4, 0x0014, 0x9B3A, 0x0012, 0x9BAA, 0x0010, 0x9C1F, 0x000E, 0x9CA4, 0x000D, 0x9D30, 0x000B,
+    0x9DB1, 0x000A, 0x9E27, 0x0008, 0x9E97, 0x0007, 0x9F15, 0x0006, 0x9F88, 0x0005, 0xA003, 0x0004, 0xA07D, 0x0003, 0xA103, 0x0003,
+    // roughness row 91
+    0x75FD, 0x08D0, 0x760B, 0x08AC, 0x761A, 0x0888, 0x762B, 0x0863, 0x763F, 0x083E, 0x7654, 0x0818, 0x766A, 0x07F3, 0x7682, 0x07CD,
+    0x769C, 0x07A8, 0x76B6, 0x0782, 0x76D2, 0x075D, 0x76EF, 0x0737, 0x770D, 0x0712, 0x772C, 0x06ED, 0x774B, 0x06C8, 0x776B, 0x06A3,
+    0x778C, 0x067E, 0x77AC, 0x0659, 0x77CE, 0x0635, 0x77F0, 0x0611, 0x7812, 0x05EE, 0x7835, 0x05CB, 0x7858, 0x05A8, 0x787C, 0x0586,
+    0x78A2, 0x0565, 0x78C7, 0x0544, 0x78ED, 0x0524, 0x7912, 0x0504, 0x7937, 0x04E4, 0x795C, 0x04C5, 0x7987, 0x04A5, 0x79B2, 0x0487,
+    0x79DE, 0x0469, 0x7A08, 0x044B, 0x7A33, 0x042E, 0x7A5E, 0x0412, 0x7A88, 0x03F7, 0x7AB7, 0x03DD, 0x7AE5, 0x03C3, 0x7B1D, 0x03A9,
+    0x7B5C, 0x0391, 0x7B9A, 0x0378, 0x7BD7, 0x0360, 0x7C1D, 0x0347, 0x7C79, 0x032E, 0x7CDC, 0x0316, 0x7D3E, 0x02FD, 0x7D9F, 0x02E5,
+    0x7DFF, 0x02CD, 0x7E61, 0x02B7, 0x7EC1, 0x02A1, 0x7F21, 0x028C, 0x7F80, 0x0277, 0x7FDE, 0x0263, 0x803C, 0x024F, 0x8099, 0x023B,
+    0x80F5, 0x0228, 0x814F, 0x0215, 0x81A8, 0x0203, 0x8200, 0x01F0, 0x8256, 0x01DF, 0x82AB, 0x01CD, 0x82FF, 0x01BC, 0x8352, 0x01AC,
+    0x83A4, 0x019C, 0x83FC, 0x018C, 0x8451, 0x017C, 0x84AC, 0x016D, 0x850C, 0x015F, 0x856F, 0x0151, 0x85D5, 0x0144, 0x863C, 0x0137,
+    0x86A7, 0x012A, 0x8718, 0x011E, 0x8788, 0x0112, 0x87F6, 0x0106, 0x8863, 0x00FB, 0x88CE, 0x00F0, 0x8937, 0x00E5, 0x899D, 0x00DA,
+    0x8A02, 0x00D0, 0x8A65, 0x00C6, 0x8AC7, 0x00BC, 0x8B2E, 0x00B3, 0x8B95, 0x00A9, 0x8BFA, 0x00A0, 0x8C60, 0x0098, 0x8CD1, 0x0090,
+    0x8D41, 0x0088, 0x8DB1, 0x0081, 0x8E21, 0x007A, 0x8E96, 0x0074, 0x8F0D, 0x006D, 0x8F82, 0x0067, 0x8FF6, 0x0061, 0x9067, 0x005B,
+    0x90D6, 0x0056, 0x9143, 0x0050, 0x91B2, 0x004B, 0x9220, 0x0046, 0x928F, 0x0042, 0x9303, 0x003D, 0x9373, 0x0039, 0x93E0, 0x0034,
+    0x944E, 0x0030, 0x94BF, 0x002D, 0x952A, 0x002A, 0x9597, 0x0026, 0x9604, 0x0023, 0x966B, 0x0020, 0x96D9, 0x001D, 0x9746, 0x001B,
+    0x97B4, 0x0018, 0x9825, 0x0016, 0x989C, 0x0014, 0x990F, 0x0012, 0x997A, 0x0010, 0x99F6, 0x000E, 0x9A71, 0x000D, 0x9AEA, 0x000B,
+    0x9B63, 0x000A, 0x9BD8, 0x0008, 0x9C51, 0x0007, 0x9CC0, 0x0006, 0x9D30, 0x0005, 0x9D99, 0x0004, 0x9E10, 0x0003, 0x9E8F, 0x0003,
+    // roughness row 92
+    0x776D, 0x08AF, 0x7774, 0x088A, 0x777D, 0x0866, 0x7788, 0x0841, 0x7794, 0x081B, 0x77A2, 0x07F6, 0x77B2, 0x07D0, 0x77C2, 0x07AB,
+    0x77D4, 0x0785, 0x77E7, 0x075F, 0x77FC, 0x073A, 0x7811, 0x0715, 0x7826, 0x06F0, 0x783D, 0x06CB, 0x7854, 0x06A6, 0x786C, 0x0681,
+    0x7884, 0x065C, 0x789C, 0x0638, 0x78B4, 0x0613, 0x78CD, 0x05F0, 0x78E6, 0x05CD, 0x7900, 0x05AB, 0x791B, 0x0589, 0x7937, 0x0567,
+    0x7952, 0x0546, 0x796E, 0x0525, 0x798A, 0x0506, 0x79A5, 0x04E6, 0x79C0, 0x04C7, 0x79E1, 0x04A8, 0x7A03, 0x048A, 0x7A25, 0x046C,
+    0x7A46, 0x044E, 0x7A67, 0x0432, 0x7A87, 0x0415, 0x7AA7, 0x03F9, 0x7ACB, 0x03DE, 0x7AEF, 0x03C4, 0x7B19, 0x03AB, 0x7B4D, 0x0392,
+    0x7B81, 0x0379, 0x7BB4, 0x0361, 0x7BEE, 0x0349, 0x7C41, 0x0332, 0x7C9D, 0x031A, 0x7CF6, 0x0302, 0x7D4F, 0x02EA, 0x7DA6, 0x02D3,
+    0x7DFB, 0x02BB, 0x7E51, 0x02A5, 0x7EA7, 0x0290, 0x7EFC, 0x027B, 0x7F51, 0x0267, 0x7FA4, 0x0253, 0x7FF7, 0x023F, 0x8049, 0x022C,
+    0x8099, 0x0219, 0x80E9, 0x0207, 0x8137, 0x01F5, 0x8184, 0x01E3, 0x81CF, 0x01D2, 0x8219, 0x01C1, 0x8262, 0x01B0, 0x82AE, 0x01A0,
+    0x82FB, 0x0191, 0x8347, 0x0181, 0x839C, 0x0172, 0x83F3, 0x0164, 0x844C, 0x0155, 0x84A7, 0x0147, 0x8503, 0x013A, 0x8567, 0x012E,
+    0x85CF, 0x0122, 0x8636, 0x0116, 0x869B, 0x010B, 0x86FF, 0x0100, 0x8761, 0x00F5, 0x87C1, 0x00EA, 0x881F, 0x00DF, 0x887C, 0x00D5,
+    0x88D5, 0x00CB, 0x8934, 0x00C1, 0x8997, 0x00B8, 0x89F8, 0x00AF, 0x8A56, 0x00A6, 0x8AB7, 0x009D, 0x8B1A, 0x0095, 0x8B7C, 0x008D,
+    0x8BDD, 0x0085, 0x8C44, 0x007E, 0x8CAE, 0x0077, 0x8D1B, 0x0071, 0x8D87, 0x006A, 0x8DF5, 0x0065, 0x8E60, 0x005F, 0x8EC7, 0x0059,
+    0x8F2E, 0x0054, 0x8F91, 0x004F, 0x8FF3, 0x004A, 0x9060, 0x0045, 0x90D2, 0x0041, 0x913F, 0x003C, 0x91A7, 0x0038, 0x920A, 0x0034,
+    0x9267, 0x0030, 0x92C8, 0x002C, 0x9333, 0x0029, 0x939C, 0x0026, 0x9403, 0x0023, 0x9469, 0x0020, 0x94D0, 0x001D, 0x9533, 0x001A,
+    0x959D, 0x0018, 0x960A, 0x0016, 0x9674, 0x0014, 0x96E1, 0x0012, 0x975E, 0x0010, 0x97D2, 0x000E, 0x983E, 0x000D, 0x98A7, 0x000B,
+    0x9914, 0x000A, 0x998D, 0x0008, 0x9A00, 0x0007, 0x9A6A, 0x0006, 0x9AD3, 0x0005, 0x9B39, 0x0004, 0x9BAA, 0x0003, 0x9C0F, 0x0003,
+    // roughness row 93
+    0x78D5, 0x088D, 0x78D6, 0x0869, 0x78D8, 0x0844, 0x78DC, 0x081F, 0x78E2, 0x07F9, 0x78E9, 0x07D4, 0x78F2, 0x07AE, 0x78FB, 0x0789,
+    0x7906, 0x0763, 0x7911, 0x073D, 0x791D, 0x0718, 0x792B, 0x06F3, 0x7938, 0x06CE, 0x7947, 0x06A9, 0x7956, 0x0684, 0x7965, 0x0660,
+    0x7974, 0x063B, 0x7983, 0x0617, 0x7993, 0x05F3, 0x79A3, 0x05CF, 0x79B4, 0x05AD, 0x79C4, 0x058B, 0x79D7, 0x056A, 0x79EA, 0x0549,
+    0x79FC, 0x0528, 0x7A0E, 0x0508, 0x7A20, 0x04E8, 0x7A32, 0x04C9, 0x7A47, 0x04AB, 0x7A5F, 0x048D, 0x7A78, 0x046F, 0x7A91, 0x0452,
+    0x7AA8, 0x0435, 0x7ABF, 0x0418, 0x7AD5, 0x03FC, 0x7AEE, 0x03E1, 0x7B07, 0x03C6, 0x7B24, 0x03AD, 0x7B4F, 0x0394, 0x7B78, 0x037B,
+    0x7BA1, 0x0363, 0x7BCB, 0x034B, 0x7C15, 0x0333, 0x7C68, 0x031D, 0x7CBA, 0x0306, 0x7D0B, 0x02EF, 0x7D5A, 0x02D8, 0x7DA7, 0x02C1,
+    0x7DF3, 0x02AB, 0x7E3D, 0x0294, 0x7E87, 0x027F, 0x7ED2, 0x026A, 0x7F1C, 0x0256, 0x7F64, 0x0243, 0x7FAC, 0x0230, 0x7FF2, 0x021D,
+    0x8038, 0x020B, 0x807C, 0x01F9, 0x80C0, 0x01E7, 0x8102, 0x01D6, 0x8143, 0x01C6, 0x8184, 0x01B5, 0x81C7, 0x01A5, 0x820A, 0x0195,
+    0x824D, 0x0186, 0x829C, 0x0177, 0x82EC, 0x0169, 0x833F, 0x015B, 0x8390, 0x014D, 0x83E0, 0x013F, 0x843A, 0x0132, 0x8495, 0x0125,
+    0x84F0, 0x0119, 0x854D, 0x010E, 0x85A7, 0x0103, 0x85FF, 0x00F8, 0x8657, 0x00EE, 0x86AC, 0x00E4, 0x86FF, 0x00D9, 0x8753, 0x00D0,
+    0x87AF, 0x00C6, 0x8809, 0x00BD, 0x8861, 0x00B4, 0x88B7, 0x00AB, 0x8915, 0x00A2, 0x8973, 0x009A, 0x89CD, 0x0092, 0x8A25, 0x008A,
+    0x8A81, 0x0082, 0x8ADE, 0x007B, 0x8B3E, 0x0074, 0x8B9E, 0x006E, 0x8BFF, 0x0068, 0x8C5F, 0x0062, 0x8CBF, 0x005C, 0x8D21, 0x0057,
+    0x8D7F, 0x0052, 0x8DDD, 0x004D, 0x8E45, 0x0048, 0x8EA9, 0x0044, 0x8F09, 0x003F, 0x8F6E, 0x003B, 0x8FD0, 0x0037, 0x902C, 0x0033,
+    0x9087, 0x002F, 0x90E1, 0x002C, 0x913B, 0x0028, 0x919F, 0x0025, 0x9207, 0x0022, 0x926C, 0x001F, 0x92CD, 0x001D, 0x9330, 0x001A,
+    0x938F, 0x0018, 0x93EF, 0x0016, 0x9456, 0x0014, 0x94C7, 0x0012, 0x9538, 0x0010, 0x95A3, 0x000E, 0x960A, 0x000D, 0x966B, 0x000B,
+    0x96D0, 0x000A, 0x9736, 0x0008, 0x97A1, 0x0007, 0x980B, 0x0006, 0x986F, 0x0005, 0x98D4, 0x0004, 0x9938, 0x0003, 0x9991, 0x0003,
+    // roughness row 94
+    0x7A36, 0x086C, 0x7A30, 0x0848, 0x7A2C, 0x0823, 0x7A2A, 0x07FD, 0x7A28, 0x07D8, 0x7A29, 0x07B2, 0x7A2A, 0x078D, 0x7A2C, 0x0767,
+    0x7A2F, 0x0741, 0x7A33, 0x071C, 0x7A38, 0x06F6, 0x7A3D, 0x06D1, 0x7A43, 0x06AC, 0x7A49, 0x0688, 0x7A50, 0x0663, 0x7A56, 0x063F,
+    0x7A5D, 0x061B, 0x7A64, 0x05F6, 0x7A6B, 0x05D3, 0x7A72, 0x05B0, 0x7A7A, 0x058D, 0x7A82, 0x056C, 0x7A8C, 0x054B, 0x7A96, 0x052B,
+    0x7A9F, 0x050B, 0x7AA7, 0x04EB, 0x7AAF, 0x04CB, 0x7AB8, 0x04AD, 0x7AC8, 0x048F, 0x7AD8, 0x0472, 0x7AE7, 0x0455, 0x7AF6, 0x0438,
+    0x7B03, 0x041C, 0x7B10, 0x0400, 0x7B1F, 0x03E5, 0x7B2F, 0x03CA, 0x7B3D, 0x03AF, 0x7B5D, 0x0395, 0x7B7D, 0x037D, 0x7B9C, 0x0365,
+    0x7BBB, 0x034D, 0x7BF6, 0x0336, 0x7C3F, 0x031E, 0x7C88, 0x0308, 0x7CD0, 0x02F2, 0x7D18, 0x02DC, 0x7D5E, 0x02C6, 0x7DA2, 0x02B0,
+    0x7DE4, 0x029A, 0x7E25, 0x0284, 0x7E64, 0x026F, 0x7EA2, 0x025A, 0x7EE1, 0x0247, 0x7F20, 0x0234, 0x7F5C, 0x0221, 0x7F98, 0x020F,
+    0x7FD2, 0x01FD, 0x800B, 0x01EB, 0x8045, 0x01DA, 0x807E, 0x01CA, 0x80B7, 0x01BA, 0x80F2, 0x01AA, 0x812C, 0x019A, 0x8167, 0x018B,
+    0x81AC, 0x017C, 0x81F6, 0x016D, 0x8240, 0x015F, 0x8289, 0x0152, 0x82D1, 0x0144, 0x8323, 0x0137, 0x8373, 0x012A, 0x83C2, 0x011E,
+    0x8410, 0x0112, 0x845E, 0x0106, 0x84AC, 0x00FB, 0x84F9, 0x00F1, 0x8544, 0x00E7, 0x858F, 0x00DD, 0x85E0, 0x00D3, 0x8634, 0x00CA,
+    0x8686, 0x00C1, 0x86D6, 0x00B8, 0x8726, 0x00AF, 0x877C, 0x00A7, 0x87D0, 0x009E, 0x8823, 0x0096, 0x8879, 0x008F, 0x88D0, 0x0087,
+    0x8927, 0x0080, 0x897C, 0x0079, 0x89CF, 0x0072, 0x8A22, 0x006B, 0x8A76, 0x0065, 0x8ACB, 0x005F, 0x8B20, 0x005A, 0x8B74, 0x0055,
+    0x8BD0, 0x0050, 0x8C34, 0x004B, 0x8C94, 0x0047, 0x8CF1, 0x0042, 0x8D4A, 0x003E, 0x8D9F, 0x003A, 0x8DF2, 0x0036, 0x8E4D, 0x0032,
+    0x8EA8, 0x002F, 0x8EFF, 0x002B, 0x8F58, 0x0028, 0x8FB2, 0x0024, 0x900E, 0x0022, 0x906B, 0x001F, 0x90CD, 0x001C, 0x912A, 0x001A,
+    0x9181, 0x0018, 0x91DE, 0x0015, 0x9243, 0x0013, 0x92A8, 0x0011, 0x9308, 0x0010, 0x936C, 0x000E, 0x93CE, 0x000D, 0x942D, 0x000B,
+    0x9488, 0x000A, 0x94E1, 0x0008, 0x953E, 0x0007, 0x95A2, 0x0006, 0x9605, 0x0005, 0x9666, 0x0004, 0x96C3, 0x0004, 0x9722, 0x0003,
+    // roughness row 95
+    0x7B8F, 0x084B, 0x7B83, 0x0827, 0x7B78, 0x0802, 0x7B6F, 0x07DC, 0x7B67, 0x07B7, 0x7B60, 0x0791, 0x7B5A, 0x076C, 0x7B55, 0x0746,
+    0x7B51, 0x0720, 0x7B4E, 0x06FB, 0x7B4A, 0x06D5, 0x7B48, 0x06B0, 0x7B46, 0x068C, 0x7B44, 0x0667, 0x7B42, 0x0643, 0x7B40, 0x061F,
+    0x7B3F, 0x05FB, 0x7B3D, 0x05D7, 0x7B3C, 0x05B4, 0x7B3A, 0x0591, 0x7B39, 0x056F, 0x7B3A, 0x054E, 0x7B3A, 0x052E, 0x7B3A, 0x050E,
+    0x7B3A, 0x04EE, 0x7B39, 0x04CE, 0x7B38, 0x04AF, 0x7B3C, 0x0491, 0x7B43, 0x0475, 0x7B4A, 0x0458, 0x7B4F, 0x043C, 0x7B53, 0x041F,
+    0x7B57, 0x0403, 0x7B5C, 0x03E8, 0x7B63, 0x03CD, 0x7B68, 0x03B3, 0x7B7A, 0x0399, 0x7B8F, 0x037F, 0x7BA4, 0x0366, 0x7BB9, 0x034F,
+    0x7BE3, 0x0337, 0x7C23, 0x0320, 0x7C63, 0x030A, 0x7CA2, 0x02F4, 0x7CE0, 0x02DE, 0x7D1D, 0x02C9, 0x7D5A, 0x02B4, 0x7D95, 0x029F,
+    0x7DCE, 0x028A, 0x7E05, 0x0275, 0x7E3A, 0x0260, 0x7E6E, 0x024B, 0x7EA1, 0x0237, 0x7ED4, 0x0225, 0x7F06, 0x0213, 0x7F37, 0x0201,
+    0x7F68, 0x01F0, 0x7F98, 0x01DE, 0x7FC6, 0x01CE, 0x7FF9, 0x01BE, 0x802B, 0x01AE, 0x805B, 0x019F, 0x8092, 0x0190, 0x80D2, 0x0181,
+    0x8114, 0x0173, 0x8154, 0x0165, 0x8192, 0x0157, 0x81D5, 0x0149, 0x821F, 0x013D, 0x8266, 0x0130, 0x82AB, 0x0123, 0x82ED, 0x0117,
+    0x832F, 0x010B, 0x8370, 0x00FF, 0x83B1, 0x00F4, 0x83F1, 0x00EA, 0x8435, 0x00E0, 0x847F, 0x00D7, 0x84C8, 0x00CD, 0x8510, 0x00C4,
+    0x8557, 0x00BB, 0x85A2, 0x00B3, 0x85F0, 0x00AA, 0x863C, 0x00A2, 0x8686, 0x009A, 0x86D6, 0x0093, 0x8729, 0x008B, 0x877A, 0x0084,
+    0x87C9, 0x007D, 0x8817, 0x0076, 0x8863, 0x006F, 0x88AC, 0x0069, 0x88F3, 0x0063, 0x893A, 0x005D, 0x8987, 0x0058, 0x89DC, 0x0053,
+    0x8A33, 0x004E, 0x8A88, 0x0049, 0x8ADC, 0x0045, 0x8B2F, 0x0041, 0x8B7F, 0x003D, 0x8BCE, 0x0039, 0x8C22, 0x0035, 0x8C72, 0x0031,
+    0x8CC9, 0x002E, 0x8D25, 0x002A, 0x8D7C, 0x0027, 0x8DCD, 0x0024, 0x8E1A, 0x0021, 0x8E6E, 0x001E, 0x8EC3, 0x001C, 0x8F18, 0x001A,
+    0x8F76, 0x0017, 0x8FD5, 0x0015, 0x902C, 0x0013, 0x9081, 0x0011, 0x90D7, 0x000F, 0x9131, 0x000E, 0x918C, 0x000C, 0x91E9, 0x000B,
+    0x923C, 0x000A, 0x928D, 0x0008, 0x92DF, 0x0007, 0x9336, 0x0006, 0x9394, 0x0005, 0x93F1, 0x0004, 0x9449, 0x0004, 0x94A8, 0x0003,
+    // roughness row 96
+    0x7CE0, 0x082B, 0x7CCD, 0x0806, 0x7CBC, 0x07E1, 0x7CAD, 0x07BC, 0x7C9E, 0x0796, 0x7C90, 0x0770, 0x7C83, 0x074B, 0x7C77, 0x0725,
+    0x7C6B, 0x0700, 0x7C60, 0x06DA, 0x7C55, 0x06B5, 0x7C4B, 0x0690, 0x7C41, 0x066B, 0x7C37, 0x0647, 0x7C2D, 0x0623, 0x7C23, 0x05FF,
+    0x7C19, 0x05DB, 0x7C0F, 0x05B8, 0x7C05, 0x0595, 0x7BFA, 0x0573, 0x7BF2, 0x0551, 0x7BE9, 0x0531, 0x7BE1, 0x0511, 0x7BD8, 0x04F1,
+    0x7BCE, 0x04D2, 0x7BC4, 0x04B3, 0x7BBC, 0x0494, 0x7BBA, 0x0477, 0x7BB7, 0x045B, 0x7BB4, 0x043F, 0x7BB0, 0x0423, 0x7BAA, 0x0407,
+    0x7BA5, 0x03EC, 0x7BA3, 0x03D1, 0x7BA0, 0x03B7, 0x7BA3, 0x039D, 0x7BB0, 0x0383, 0x7BBC, 0x036A, 0x7BC6, 0x0351, 0x7BDE, 0x0339,
+    0x7C13, 0x0322, 0x7C4A, 0x030C, 0x7C80, 0x02F6, 0x7CB5, 0x02E1, 0x7CE9, 0x02CB, 0x7D1D, 0x02B6, 0x7D4F, 0x02A2, 0x7D80, 0x028D,
+    0x7DB0, 0x0279, 0x7DDD, 0x0265, 0x7E09, 0x0251, 0x7E33, 0x023D, 0x7E5B, 0x0229, 0x7E82, 0x0216, 0x7EAA, 0x0204, 0x7ED2, 0x01F3,
+    0x7EF9, 0x01E2, 0x7F1F, 0x01D2, 0x7F48, 0x01C2, 0x7F70, 0x01B2, 0x7F99, 0x01A3, 0x7FC9, 0x0194, 0x8002, 0x0185, 0x803C, 0x0177,
+    0x8074, 0x0169, 0x80AA, 0x015C, 0x80E7, 0x014E, 0x8126, 0x0141, 0x8165, 0x0134, 0x81A3, 0x0128, 0x81DE, 0x011C, 0x8217, 0x0110,
+    0x824D, 0x0105, 0x8280, 0x00F9, 0x82B6, 0x00EE, 0x82F0, 0x00E4, 0x8330, 0x00DA, 0x836F, 0x00D1, 0x83AE, 0x00C8, 0x83E9, 0x00BF,
+    0x842E, 0x00B6, 0x8475, 0x00AE, 0x84B9, 0x00A6, 0x8500, 0x009E, 0x854B, 0x0097, 0x8596, 0x008F, 0x85DE, 0x0088, 0x8628, 0x0081,
+    0x8670, 0x007A, 0x86B7, 0x0074, 0x86FA, 0x006D, 0x873A, 0x0067, 0x877A, 0x0061, 0x87BC, 0x005B, 0x8806, 0x0056, 0x8850, 0x0051,
+    0x889A, 0x004C, 0x88E4, 0x0047, 0x892D, 0x0043, 0x8974, 0x003F, 0x89BC, 0x003B, 0x8A07, 0x0037, 0x8A52, 0x0034, 0x8AA7, 0x0030,
+    0x8AF8, 0x002D, 0x8B4A, 0x002A, 0x8B97, 0x0027, 0x8BE2, 0x0024, 0x8C2C, 0x0021, 0x8C71, 0x001E, 0x8CBB, 0x001B, 0x8D13, 0x0019,
+    0x8D6B, 0x0017, 0x8DBF, 0x0015, 0x8E13, 0x0013, 0x8E5F, 0x0011, 0x8EAA, 0x000F, 0x8EF5, 0x000E, 0x8F47, 0x000C, 0x8F98, 0x000B,
+    0x8FEB, 0x000A, 0x9037, 0x0008, 0x9083, 0x0007, 0x90CD, 0x0006, 0x9120, 0x0005, 0x917B, 0x0004, 0x91D1, 0x0004, 0x922C, 0x0003,
+    // roughness row 97
+    0x7E29, 0x080B, 0x7E10, 0x07E6, 0x7DF9, 0x07C1, 0x7DE2, 0x079B, 0x7DCD, 0x0776, 0x7DB8, 0x0750, 0x7DA4, 0x072B, 0x7D91, 0x0705,
+    0x7D7E, 0x06E0, 0x7D6B, 0x06BA, 0x7D59, 0x0695, 0x7D47, 0x0670, 0x7D34, 0x064C, 0x7D22, 0x0628, 0x7D10, 0x0604, 0x7CFE, 0x05E0,
+    0x7CEB, 0x05BD, 0x7CD9, 0x059A, 0x7CC7, 0x0577, 0x7CB4, 0x0555, 0x7CA3, 0x0535, 0x7C92, 0x0514, 0x7C80, 0x04F5, 0x7C6E, 0x04D5,
+    0x7C5B, 0x04B6, 0x7C48, 0x0498, 0x7C3C, 0x047B, 0x7C31, 0x045E, 0x7C24, 0x0442, 0x7C17, 0x0426, 0x7C09, 0x040B, 0x7BFA, 0x03EF,
+    0x7BEF, 0x03D5, 0x7BE3, 0x03BA, 0x7BD9, 0x03A0, 0x7BDC, 0x0387, 0x7BDF, 0x036E, 0x7BE1, 0x0355, 0x7BE8, 0x033D, 0x7C10, 0x0325,
+    0x7C3D, 0x030E, 0x7C6A, 0x02F8, 0x7C96, 0x02E2, 0x7CC1, 0x02CD, 0x7CEC, 0x02B9, 0x7D15, 0x02A4, 0x7D3E, 0x0290, 0x7D65, 0x027C,
+    0x7D8A, 0x0269, 0x7DAE, 0x0255, 0x7DD0, 0x0242, 0x7DF0, 0x022F, 0x7E0F, 0x021C, 0x7E2D, 0x0209, 0x7E4A, 0x01F7, 0x7E66, 0x01E6,
+    0x7E84, 0x01D5, 0x7EA5, 0x01C5, 0x7EC6, 0x01B6, 0x7EE5, 0x01A7, 0x7F0D, 0x0198, 0x7F3F, 0x0189, 0x7F6F, 0x017B, 0x7F9E, 0x016D,
+    0x7FCC, 0x0160, 0x8003, 0x0153, 0x803B, 0x0146, 0x8071, 0x0139, 0x80A4, 0x012D, 0x80D6, 0x0121, 0x8107, 0x0115, 0x8137, 0x010A,
+    0x8167, 0x00FF, 0x8194, 0x00F3, 0x81C5, 0x00E9, 0x81F8, 0x00DE, 0x822B, 0x00D4, 0x825E, 0x00CB, 0x8293, 0x00C2, 0x82D0, 0x00BA,
+    0x830B, 0x00B1, 0x8344, 0x00A9, 0x8386, 0x00A1, 0x83CA, 0x009A, 0x840E, 0x0092, 0x8453, 0x008B, 0x8497, 0x0085, 0x84D8, 0x007E,
+    0x8518, 0x0077, 0x8555, 0x0071, 0x8590, 0x006B, 0x85CE, 0x0065, 0x860B, 0x005F, 0x864B, 0x005A, 0x868B, 0x0054, 0x86C9, 0x004F,
+    0x8705, 0x004A, 0x8741, 0x0046, 0x877C, 0x0042, 0x87BC, 0x003D, 0x87FF, 0x003A, 0x8849, 0x0036, 0x8896, 0x0033, 0x88DF, 0x002F,
+    0x8925, 0x002C, 0x8968, 0x0029, 0x89AF, 0x0026, 0x89F6, 0x0023, 0x8A39, 0x0020, 0x8A7F, 0x001E, 0x8AC8, 0x001B, 0x8B11, 0x0019,
+    0x8B60, 0x0017, 0x8BAC, 0x0015, 0x8BF7, 0x0013, 0x8C42, 0x0011, 0x8C87, 0x000F, 0x8CCD, 0x000E, 0x8D0B, 0x000C, 0x8D4E, 0x000B,
+    0x8D9D, 0x0009, 0x8DEB, 0x0008, 0x8E2E, 0x0007, 0x8E73, 0x0006, 0x8EBE, 0x0005, 0x8F0C, 0x0004, 0x8F63, 0x0004, 0x8FB4, 0x0003,
+    // roughness row 98
+    0x7F6A, 0x07EB, 0x7F4B, 0x07C6, 0x7F2D, 0x07A1, 0x7F10, 0x077C, 0x7EF4, 0x0756, 0x7ED9, 0x0731, 0x7EBE, 0x070B, 0x7EA3, 0x06E6,
+    0x7E89, 0x06C0, 0x7E6F, 0x069B, 0x7E54, 0x0676, 0x7E3A, 0x0651, 0x7E20, 0x062D, 0x7E06, 0x0609, 0x7DEC, 0x05E5, 0x7DD1, 0x05C1,
+    0x7DB7, 0x059F, 0x7D9C, 0x057C, 0x7D81, 0x055A, 0x7D67, 0x0539, 0x7D4D, 0x0518, 0x7D33, 0x04F8, 0x7D18, 0x04D9, 0x7CFD, 0x04BA,
+    0x7CE1, 0x049C, 0x7CC9, 0x047E, 0x7CB5, 0x0462, 0x7CA0, 0x0445, 0x7C8A, 0x0429, 0x7C73, 0x040E, 0x7C5C, 0x03F3, 0x7C47, 0x03D8,
+    0x7C32, 0x03BE, 0x7C1C, 0x03A4, 0x7C14, 0x038B, 0x7C0E, 0x0372, 0x7C07, 0x0359, 0x7BFE, 0x0341, 0x7C1A, 0x0329, 0x7C3E, 0x0311,
+    0x7C61, 0x02FA, 0x7C83, 0x02E4, 0x7CA5, 0x02CF, 0x7CC7, 0x02BA, 0x7CE7, 0x02A6, 0x7D07, 0x0292, 0x7D25, 0x027F, 0x7D42, 0x026B,
+    0x7D5E, 0x0258, 0x7D78, 0x0246, 0x7D8F, 0x0233, 0x7DA7, 0x0220, 0x7DBD, 0x020E, 0x7DD2, 0x01FC, 0x7DE4, 0x01EA, 0x7DF8, 0x01D9,
+    0x7E0F, 0x01C8, 0x7E27, 0x01B9, 0x7E3E, 0x01AA, 0x7E60, 0x019B, 0x7E89, 0x018D, 0x7EB0, 0x017F, 0x7ED5, 0x0171, 0x7EF9, 0x0163,
+    0x7F29, 0x0156, 0x7F59, 0x014A, 0x7F86, 0x013D, 0x7FB2, 0x0131, 0x7FDC, 0x0125, 0x8004, 0x0119, 0x802C, 0x010E, 0x8055, 0x0103,
+    0x807C, 0x00F8, 0x80AB, 0x00EE, 0x80D6, 0x00E4, 0x80FF, 0x00D9, 0x8125, 0x00CF, 0x814F, 0x00C6, 0x8180, 0x00BD, 0x81B1, 0x00B4,
+    0x81E5, 0x00AC, 0x8222, 0x00A5, 0x825E, 0x009D, 0x829C, 0x0096, 0x82D9, 0x008F, 0x8314, 0x0088, 0x834D, 0x0081, 0x8385, 0x007B,
+    0x83B9, 0x0075, 0x83EE, 0x006F, 0x8425, 0x0069, 0x8462, 0x0063, 0x84A0, 0x005E, 0x84D9, 0x0058, 0x850E, 0x0053, 0x8541, 0x004E,
+    0x8570, 0x0049, 0x859D, 0x0044, 0x85D5, 0x0040, 0x860F, 0x003C, 0x864F, 0x0038, 0x8690, 0x0035, 0x86D1, 0x0031, 0x870F, 0x002E,
+    0x8749, 0x002B, 0x8788, 0x0028, 0x87C4, 0x0025, 0x8800, 0x0022, 0x8845, 0x0020, 0x888E, 0x001D, 0x88D3, 0x001B, 0x8914, 0x0019,
+    0x8951, 0x0016, 0x8996, 0x0014, 0x89DC, 0x0013, 0x8A1F, 0x0011, 0x8A64, 0x000F, 0x8A9F, 0x000E, 0x8ADB, 0x000C, 0x8B1B, 0x000B,
+    0x8B59, 0x0009, 0x8B9E, 0x0008, 0x8BE0, 0x0007, 0x8C27, 0x0006, 0x8C70, 0x0005, 0x8CB4, 0x0004, 0x8CFE, 0x0004, 0x8D48, 0x0003,
+    // roughness row 99
+    0x80A3, 0x07CC, 0x807E, 0x07A7, 0x805A, 0x0782, 0x8036, 0x075C, 0x8014, 0x0737, 0x7FF1, 0x0711, 0x7FCF, 0x06EC, 0x7FAD, 0x06C7,
+    0x7F8C, 0x06A1, 0x7F6A, 0x067C, 0x7F48, 0x0657, 0x7F27, 0x0632, 0x7F05, 0x060E, 0x7EE2, 0x05EA, 0x7EC0, 0x05C7, 0x7E9D, 0x05A4,
+    0x7E7B, 0x0581, 0x7E58, 0x055F, 0x7E34, 0x053E, 0x7E12, 0x051D, 0x7DF0, 0x04FD, 0x7DCD, 0x04DD, 0x7DA9, 0x04BE, 0x7D85, 0x049F,
+    0x7D61, 0x0482, 0x7D44, 0x0465, 0x7D27, 0x0449, 0x7D09, 0x042D, 0x7CE9, 0x0411, 0x7CC9, 0x03F6, 0x7CA9, 0x03DC, 0x7C8C, 0x03C2,
+    0x7C6E, 0x03A8, 0x7C58, 0x038F, 0x7C49, 0x0376, 0x7C39, 0x035D, 0x7C28, 0x0345, 0x7C2F, 0x032D, 0x7C4B, 0x0315, 0x7C65, 0x02FE,
+    0x7C7E, 0x02E7, 0x7C96, 0x02D1, 0x7CAE, 0x02BC, 0x7CC5, 0x02A8, 0x7CDB, 0x0294, 0x7CF1, 0x0280, 0x7D05, 0x026D, 0x7D18, 0x025B,
+    0x7D2A, 0x0248, 0x7D3B, 0x0236, 0x7D4B, 0x0224, 0x7D59, 0x0212, 0x7D65, 0x0201, 0x7D6E, 0x01EF, 0x7D7C, 0x01DE, 0x7D8A, 0x01CD,
+    0x7D97, 0x01BC, 0x7DA3, 0x01AD, 0x7DBE, 0x019E, 0x7DDF, 0x0190, 0x7DFD, 0x0182, 0x7E19, 0x0174, 0x7E36, 0x0167, 0x7E5C, 0x015A,
+    0x7E83, 0x014D, 0x7EA8, 0x0141, 0x7ECC, 0x0135, 0x7EEE, 0x0129, 0x7F0F, 0x011D, 0x7F31, 0x0112, 0x7F51, 0x0107, 0x7F71, 0x00FC,
+    0x7F97, 0x00F2, 0x7FBC, 0x00E8, 0x7FDD, 0x00DE, 0x7FFD, 0x00D4, 0x8023, 0x00CB, 0x8049, 0x00C1, 0x806E, 0x00B8, 0x809D, 0x00B0,
+    0x80D1, 0x00A8, 0x8108, 0x00A0, 0x813D, 0x0099, 0x816F, 0x0092, 0x81A0, 0x008B, 0x81D0, 0x0084, 0x81FE, 0x007E, 0x822A, 0x0078,
+    0x825C, 0x0072, 0x828C, 0x006C, 0x82C4, 0x0066, 0x82FA, 0x0061, 0x832E, 0x005C, 0x835F, 0x0057, 0x838C, 0x0052, 0x83B5, 0x004D,
+    0x83DE, 0x0048, 0x840C, 0x0043, 0x843F, 0x003F, 0x8476, 0x003B, 0x84AB, 0x0037, 0x84DF, 0x0034, 0x8510, 0x0030, 0x8540, 0x002D,
+    0x8574, 0x002A, 0x85A9, 0x0027, 0x85E1, 0x0024, 0x861E, 0x0022, 0x865C, 0x001F, 0x86A0, 0x001D, 0x86DE, 0x001B, 0x871A, 0x0018,
+    0x8757, 0x0016, 0x878E, 0x0014, 0x87C8, 0x0012, 0x8806, 0x0011, 0x883D, 0x000F, 0x8879, 0x000D, 0x88B4, 0x000C, 0x88EA, 0x000B,
+    0x8921, 0x0009, 0x8957, 0x0008, 0x89A1, 0x0007, 0x89EB, 0x0006, 0x8A22, 0x0005, 0x8A62, 0x0004, 0x8AA2, 0x0004, 0x8AE0, 0x0003,
+    // roughness row 100
+    0x81D4, 0x07AD, 0x81A9, 0x0788, 0x817F, 0x0763, 0x8155, 0x073E, 0x812B, 0x0718, 0x8102, 0x06F3, 0x80D9, 0x06CD, 0x80B0, 0x06A8,
+    0x8087, 0x0683, 0x805E, 0x065E, 0x8034, 0x0639, 0x800B, 0x0614, 0x7FE1, 0x05F0, 0x7FB7, 0x05CD, 0x7F8C, 0x05A9, 0x7F62, 0x0586,
+    0x7F37, 0x0565, 0x7F0B, 0x0543, 0x7EE1, 0x0522, 0x7EB6, 0x0502, 0x7E8B, 0x04E2, 0x7E5F, 0x04C2, 0x7E32, 0x04A4, 0x7E05, 0x0485,
+    0x7DDD, 0x0469, 0x7DB8, 0x044D, 0x7D91, 0x0431, 0x7D69, 0x0415, 0x7D40, 0x03FA, 0x7D17, 0x03DF, 0x7CF1, 0x03C5, 0x7CCA, 0x03AC,
+    0x7CA5, 0x0393, 0x7C8F, 0x037A, 0x7C77, 0x0361, 0x7C5D, 0x0349, 0x7C4F, 0x0331, 0x7C62, 0x0319, 0x7C74, 0x0302, 0x7C85, 0x02EC,
+    0x7C95, 0x02D5, 0x7CA3, 0x02BF, 0x7CB0, 0x02AA, 0x7CBD, 0x0296, 0x7CC8, 0x0282, 0x7CD3, 0x026F, 0x7CDE, 0x025C, 0x7CE7, 0x024A,
+    0x7CF0, 0x0238, 0x7CF8, 0x0227, 0x7CFF, 0x0215, 0x7D03, 0x0204, 0x7D05, 0x01F3, 0x7D0D, 0x01E2, 0x7D13, 0x01D2, 0x7D16, 0x01C1,
+    0x7D18, 0x01B1, 0x7D2B, 0x01A2, 0x7D41, 0x0193, 0x7D55, 0x0184, 0x7D69, 0x0177, 0x7D7F, 0x016A, 0x7D9F, 0x015D, 0x7DBC, 0x0150,
+    0x7DD8, 0x0144, 0x7DF3, 0x0138, 0x7E0C, 0x012C, 0x7E26, 0x0121, 0x7E40, 0x0116, 0x7E58, 0x010B, 0x7E73, 0x0100, 0x7E91, 0x00F6,
+    0x7EAE, 0x00EC, 0x7EC8, 0x00E2, 0x7EE1, 0x00D9, 0x7F04, 0x00CF, 0x7F25, 0x00C6, 0x7F46, 0x00BD, 0x7F70, 0x00B5, 0x7F9B, 0x00AC,
+    0x7FC6, 0x00A4, 0x7FF0, 0x009C, 0x8019, 0x0095, 0x8042, 0x008E, 0x8067, 0x0088, 0x808B, 0x0081, 0x80B2, 0x007B, 0x80DC, 0x0075,
+    0x8107, 0x006F, 0x8137, 0x006A, 0x8165, 0x0064, 0x818F, 0x005F, 0x81B8, 0x005A, 0x81E1, 0x0055, 0x8207, 0x0050, 0x822F, 0x004C,
+    0x825A, 0x0047, 0x8287, 0x0043, 0x82B4, 0x003E, 0x82DF, 0x003A, 0x8307, 0x0036, 0x832D, 0x0033, 0x8354, 0x0030, 0x837D, 0x002C,
+    0x83A8, 0x0029, 0x83D6, 0x0026, 0x8409, 0x0024, 0x8444, 0x0021, 0x847E, 0x001F, 0x84B3, 0x001C, 0x84F0, 0x001A, 0x8529, 0x0018,
+    0x8559, 0x0016, 0x8588, 0x0014, 0x85B6, 0x0012, 0x85E3, 0x0010, 0x8619, 0x000F, 0x864E, 0x000D, 0x8682, 0x000C, 0x86B6, 0x000B,
+    0x86E6, 0x0009, 0x8725, 0x0008, 0x8765, 0x0007, 0x879F, 0x0006, 0x87DA, 0x0005, 0x8811, 0x0004, 0x8842, 0x0004, 0x8877, 0x0003,
+    // roughness row 101
+    0x82FE, 0x078F, 0x82CC, 0x076A, 0x829B, 0x0745, 0x826B, 0x071F, 0x823B, 0x06FA, 0x820A, 0x06D4, 0x81DA, 0x06AF, 0x81AA, 0x068A,
+    0x817A, 0x0665, 0x814A, 0x0640, 0x8119, 0x061C, 0x80E8, 0x05F7, 0x80B6, 0x05D3, 0x8084, 0x05AF, 0x8051, 0x058C, 0x801E, 0x056A,
+    0x7FEB, 0x0548, 0x7FB8, 0x0527, 0x7F85, 0x0507, 0x7F53, 0x04E7, 0x7F1F, 0x04C8, 0x7EEA, 0x04A9, 0x7EB5, 0x048A, 0x7E80, 0x046D,
+    0x7E52, 0x0450, 0x7E24, 0x0434, 0x7DF4, 0x0419, 0x7DC3, 0x03FE, 0x7D91, 0x03E3, 0x7D61, 0x03C9, 0x7D32, 0x03AF, 0x7D01, 0x0396,
+    0x7CDF, 0x037E, 0x7CBF, 0x0365, 0x7C9D, 0x034D, 0x7C7D, 0x0335, 0x7C83, 0x031E, 0x7C8D, 0x0306, 0x7C96, 0x02F0, 0x7C9E, 0x02D9,
+    0x7CA4, 0x02C3, 0x7CA9, 0x02AE, 0x7CAC, 0x0299, 0x7CAE, 0x0284, 0x7CB0, 0x0271, 0x7CB0, 0x025E, 0x7CB0, 0x024B, 0x7CB1, 0x023A,
+    0x7CB1, 0x0228, 0x7CAE, 0x0217, 0x7CAB, 0x0207, 0x7CA6, 0x01F6, 0x7CA7, 0x01E6, 0x7CA6, 0x01D6, 0x7CA3, 0x01C6, 0x7C9D, 0x01B6,
+    0x7CA9, 0x01A6, 0x7CB5, 0x0197, 0x7CC0, 0x0188, 0x7CCA, 0x017A, 0x7CD7, 0x016D, 0x7CEE, 0x0160, 0x7D04, 0x0153, 0x7D18, 0x0147,
+    0x7D2A, 0x013B, 0x7D3B, 0x012F, 0x7D4D, 0x0124, 0x7D5E, 0x0119, 0x7D6F, 0x010E, 0x7D84, 0x0104, 0x7D9B, 0x00FA, 0x7DAF, 0x00F0,
+    0x7DC3, 0x00E6, 0x7DD6, 0x00DD, 0x7DF2, 0x00D3, 0x7E0C, 0x00CB, 0x7E2B, 0x00C2, 0x7E53, 0x00B9, 0x7E76, 0x00B1, 0x7E98, 0x00A9,
+    0x7EB7, 0x00A1, 0x7ED5, 0x0099, 0x7EF3, 0x0092, 0x7F11, 0x008B, 0x7F2D, 0x0085, 0x7F4D, 0x007E, 0x7F6C, 0x0078, 0x7F8F, 0x0072,
+    0x7FB6, 0x006D, 0x7FDA, 0x0067, 0x7FFC, 0x0062, 0x8020, 0x005D, 0x8040, 0x0058, 0x805E, 0x0053, 0x8083, 0x004F, 0x80AA, 0x004A,
+    0x80D6, 0x0046, 0x80FE, 0x0042, 0x8120, 0x003E, 0x813F, 0x003A, 0x815C, 0x0036, 0x817A, 0x0032, 0x819A, 0x002F, 0x81BF, 0x002C,
+    0x81E6, 0x0029, 0x8212, 0x0026, 0x8243, 0x0023, 0x8271, 0x0020, 0x82A4, 0x001E, 0x82D7, 0x001C, 0x8305, 0x001A, 0x832F, 0x0018,
+    0x835A, 0x0016, 0x8382, 0x0014, 0x83A6, 0x0012, 0x83CB, 0x0010, 0x83F6, 0x000F, 0x8424, 0x000D, 0x8451, 0x000C, 0x8480, 0x000A,
+    0x84B9, 0x0009, 0x84F3, 0x0008, 0x8522, 0x0007, 0x8556, 0x0006, 0x858D, 0x0005, 0x85BC, 0x0004, 0x85E2, 0x0004, 0x8612, 0x0003,
+    // roughness row 102
+    0x841F, 0x0771, 0x83E7, 0x074C, 0x83B0, 0x0727, 0x8379, 0x0701, 0x8342, 0x06DC, 0x830B, 0x06B7, 0x82D4, 0x0692, 0x829D, 0x066D,
+    0x8265, 0x0648, 0x822E, 0x0623, 0x81F5, 0x05FE, 0x81BC, 0x05DA, 0x8183, 0x05B6, 0x8149, 0x0593, 0x810E, 0x0570, 0x80D4, 0x054E,
+    0x8098, 0x052D, 0x805D, 0x050C, 0x8023, 0x04EC, 0x7FE7, 0x04CD, 0x7FAB, 0x04AE, 0x7F6E, 0x048F, 0x7F30, 0x0471, 0x7EF7, 0x0454,
+    0x7EC0, 0x0438, 0x7E88, 0x041D, 0x7E4F, 0x0402, 0x7E15, 0x03E7, 0x7DDB, 0x03CD, 0x7DA4, 0x03B3, 0x7D6B, 0x039A, 0x7D39, 0x0381,
+    0x7D11, 0x0369, 0x7CE8, 0x0351, 0x7CBD, 0x033A, 0x7CAE, 0x0322, 0x7CB1, 0x030B, 0x7CB2, 0x02F4, 0x7CB1, 0x02DE, 0x7CB0, 0x02C8,
+    0x7CAC, 0x02B2, 0x7CA7, 0x029D, 0x7CA1, 0x0288, 0x7C9A, 0x0274, 0x7C91, 0x0260, 0x7C89, 0x024E, 0x7C80, 0x023C, 0x7C76, 0x022A,
+    0x7C6B, 0x0219, 0x7C5F, 0x0209, 0x7C54, 0x01F9, 0x7C4D, 0x01E9, 0x7C45, 0x01D9, 0x7C3A, 0x01CA, 0x7C2E, 0x01BA, 0x7C34, 0x01AB,
+    0x7C3A, 0x019C, 0x7C3C, 0x018E, 0x7C3D, 0x017F, 0x7C40, 0x0171, 0x7C4C, 0x0163, 0x7C58, 0x0156, 0x7C62, 0x014A, 0x7C6C, 0x013E,
+    0x7C78, 0x0133, 0x7C83, 0x0127, 0x7C8C, 0x011C, 0x7C93, 0x0112, 0x7CA1, 0x0107, 0x7CAF, 0x00FD, 0x7CBD, 0x00F3, 0x7CC9, 0x00EA,
+    0x7CD6, 0x00E0, 0x7CEA, 0x00D7, 0x7CFC, 0x00CE, 0x7D1B, 0x00C6, 0x7D3B, 0x00BD, 0x7D59, 0x00B5, 0x7D74, 0x00AD, 0x7D8C, 0x00A5,
+    0x7DA3, 0x009D, 0x7DB7, 0x0096, 0x7DCA, 0x008F, 0x7DDE, 0x0088, 0x7DF6, 0x0081, 0x7E0D, 0x007B, 0x7E29, 0x0075, 0x7E44, 0x0070,
+    0x7E5E, 0x006A, 0x7E7A, 0x0065, 0x7E94, 0x005F, 0x7EAB, 0x005B, 0x7EC1, 0x0056, 0x7EE2, 0x0051, 0x7F03, 0x004D, 0x7F28, 0x0049,
+    0x7F49, 0x0045, 0x7F67, 0x0041, 0x7F81, 0x003D, 0x7F97, 0x0039, 0x7FB0, 0x0035, 0x7FCC, 0x0032, 0x7FE7, 0x002E, 0x8006, 0x002B,
+    0x802E, 0x0028, 0x8057, 0x0025, 0x807E, 0x0023, 0x80A7, 0x0020, 0x80CE, 0x001E, 0x80F2, 0x001B, 0x8115, 0x0019, 0x8138, 0x0017,
+    0x815C, 0x0015, 0x817E, 0x0014, 0x819F, 0x0012, 0x81BF, 0x0010, 0x81DD, 0x000E, 0x81FF, 0x000D, 0x8229, 0x000C, 0x825A, 0x000A,
+    0x828E, 0x0009, 0x82B9, 0x0008, 0x82E1, 0x0007, 0x830A, 0x0006, 0x833A, 0x0005, 0x835D, 0x0004, 0x8387, 0x0004, 0x83AC, 0x0003,
+    // roughness row 103
+    0x8538, 0x0753, 0x84FA, 0x072E, 0x84BD, 0x0709, 0x847F, 0x06E4, 0x8442, 0x06BF, 0x8404, 0x0699, 0x83C6, 0x0674, 0x8388, 0x0650,
+    0x8349, 0x062B, 0x830A, 0x0606, 0x82CA, 0x05E2, 0x828A, 0x05BE, 0x8248, 0x059A, 0x8206, 0x0576, 0x81C4, 0x0554, 0x8182, 0x0533,
+    0x813E, 0x0512, 0x80FB, 0x04F2, 0x80B8, 0x04D2, 0x8075, 0x04B3, 0x8030, 0x0495, 0x7FEA, 0x0476, 0x7FA4, 0x0459, 0x7F66, 0x043D,
+    0x7F26, 0x0421, 0x7EE5, 0x0406, 0x7EA3, 0x03EB, 0x7E60, 0x03D1, 0x7E20, 0x03B7, 0x7DE0, 0x039E, 0x7D9E, 0x0385, 0x7D6E, 0x036D,
+    0x7D3C, 0x0355, 0x7D0A, 0x033D, 0x7CE3, 0x0326, 0x7CDE, 0x030F, 0x7CD7, 0x02F9, 0x7CCF, 0x02E2, 0x7CC6, 0x02CC, 0x7CBB, 0x02B7,
+    0x7CAF, 0x02A2, 0x7CA1, 0x028D, 0x7C91, 0x0278, 0x7C7F, 0x0264, 0x7C6F, 0x0251, 0x7C5D, 0x023F, 0x7C4A, 0x022D, 0x7C36, 0x021C,
+    0x7C21, 0x020B, 0x7C0E, 0x01FB, 0x7BFF, 0x01EB, 0x7BEE, 0x01DC, 0x7BDD, 0x01CD, 0x7BCA, 0x01BE, 0x7BC8, 0x01AF, 0x7BC6, 0x01A1,
+    0x7BC2, 0x0192, 0x7BBC, 0x0184, 0x7BB8, 0x0176, 0x7BBC, 0x0168, 0x7BBE, 0x015B, 0x7BBE, 0x014E, 0x7BBF, 0x0141, 0x7BC2, 0x0136,
+    0x7BC4, 0x012A, 0x7BC4, 0x011F, 0x7BC4, 0x0115, 0x7BCC, 0x010A, 0x7BD2, 0x0100, 0x7BD6, 0x00F6, 0x7BD9, 0x00ED, 0x7BE1, 0x00E4,
+    0x7BED, 0x00DB, 0x7BFB, 0x00D2, 0x7C14, 0x00C9, 0x7C2C, 0x00C1, 0x7C42, 0x00B9, 0x7C57, 0x00B1, 0x7C6B, 0x00A9, 0x7C7C, 0x00A2,
+    0x7C8A, 0x009A, 0x7C94, 0x0093, 0x7CA0, 0x008C, 0x7CAC, 0x0085, 0x7CB9, 0x007E, 0x7CCE, 0x0078, 0x7CE4, 0x0073, 0x7CF8, 0x006D,
+    0x7D0A, 0x0068, 0x7D17, 0x0062, 0x7D23, 0x005D, 0x7D35, 0x0058, 0x7D4D, 0x0054, 0x7D69, 0x004F, 0x7D85, 0x004B, 0x7D9F, 0x0047,
+    0x7DB6, 0x0043, 0x7DCA, 0x003F, 0x7DDD, 0x003C, 0x7DF3, 0x0038, 0x7E09, 0x0034, 0x7E1C, 0x0031, 0x7E35, 0x002D, 0x7E57, 0x002A,
+    0x7E79, 0x0027, 0x7E99, 0x0025, 0x7EBB, 0x0022, 0x7ED9, 0x0020, 0x7EF2, 0x001D, 0x7F09, 0x001B, 0x7F20, 0x0019, 0x7F41, 0x0017,
+    0x7F5C, 0x0015, 0x7F7A, 0x0013, 0x7F9C, 0x0012, 0x7FB6, 0x0010, 0x7FCE, 0x000E, 0x7FE9, 0x000D, 0x8010, 0x000B, 0x803F, 0x000A,
+    0x8065, 0x0009, 0x8082, 0x0008, 0x80A2, 0x0007, 0x80C3, 0x0006, 0x80E0, 0x0005, 0x80FE, 0x0004, 0x8128, 0x0004, 0x814E, 0x0003,
+    // roughness row 104
+    0x864A, 0x0736, 0x8606, 0x0711, 0x85C2, 0x06EC, 0x857E, 0x06C7, 0x8539, 0x06A2, 0x84F5, 0x067D, 0x84B0, 0x0658, 0x846B, 0x0633,
+    0x8425, 0x060E, 0x83DE, 0x05EA, 0x8397, 0x05C6, 0x834F, 0x05A2, 0x8306, 0x057E, 0x82BC, 0x055B, 0x8272, 0x0539, 0x8228, 0x0518,
+    0x81DC, 0x04F7, 0x8192, 0x04D8, 0x8147, 0x04B9, 0x80FB, 0x049A, 0x80AD, 0x047C, 0x805F, 0x045E, 0x8015, 0x0442, 0x7FCE, 0x0426,
+    0x7F85, 0x040A, 0x7F3B, 0x03EF, 0x7EF0, 0x03D5, 0x7EA6, 0x03BB, 0x7E5E, 0x03A2, 0x7E14, 0x0389, 0x7DD4, 0x0371, 0x7D9B, 0x0358,
+    0x7D60, 0x0341, 0x7D25, 0x032A, 0x7D14, 0x0313, 0x7D06, 0x02FD, 0x7CF7, 0x02E7, 0x7CE7, 0x02D1, 0x7CD4, 0x02BC, 0x7CC0, 0x02A7,
+    0x7CAB, 0x0292, 0x7C94, 0x027D, 0x7C7B, 0x026A, 0x7C62, 0x0256, 0x7C48, 0x0243, 0x7C2C, 0x0231, 0x7C0E, 0x021E, 0x7BF1, 0x020D,
+    0x7BD5, 0x01FD, 0x7BBD, 0x01ED, 0x7BA4, 0x01DE, 0x7B8A, 0x01CF, 0x7B70, 0x01C1, 0x7B66, 0x01B2, 0x7B5D, 0x01A4, 0x7B51, 0x0196,
+    0x7B43, 0x0188, 0x7B39, 0x017B, 0x7B37, 0x016D, 0x7B31, 0x0160, 0x7B2A, 0x0152, 0x7B23, 0x0146, 0x7B1C, 0x0139, 0x7B14, 0x012E,
+    0x7B0A, 0x0122, 0x7B03, 0x0118, 0x7B03, 0x010D, 0x7B00, 0x0103, 0x7AFD, 0x00F9, 0x7AF6, 0x00F0, 0x7AF7, 0x00E6, 0x7AFB, 0x00DD,
+    0x7B07, 0x00D5, 0x7B19, 0x00CC, 0x7B29, 0x00C4, 0x7B37, 0x00BC, 0x7B45, 0x00B4, 0x7B50, 0x00AC, 0x7B5A, 0x00A5, 0x7B62, 0x009E,
+    0x7B67, 0x0097, 0x7B6F, 0x0090, 0x7B74, 0x0089, 0x7B79, 0x0082, 0x7B83, 0x007C, 0x7B8F, 0x0076, 0x7B9A, 0x0070, 0x7BA5, 0x006B,
+    0x7BAC, 0x0065, 0x7BB2, 0x0060, 0x7BBD, 0x005B, 0x7BCA, 0x0056, 0x7BDD, 0x0052, 0x7BF1, 0x004D, 0x7C01, 0x0049, 0x7C11, 0x0045,
+    0x7C1D, 0x0042, 0x7C29, 0x003E, 0x7C3A, 0x003A, 0x7C4B, 0x0037, 0x7C5E, 0x0033, 0x7C76, 0x0030, 0x7C91, 0x002D, 0x7CA8, 0x002A,
+    0x7CC1, 0x0027, 0x7CDA, 0x0024, 0x7CF0, 0x0022, 0x7D01, 0x001F, 0x7D11, 0x001D, 0x7D25, 0x001B, 0x7D39, 0x0018, 0x7D49, 0x0016,
+    0x7D5D, 0x0015, 0x7D76, 0x0013, 0x7D8D, 0x0011, 0x7DAA, 0x0010, 0x7DC6, 0x000E, 0x7DE3, 0x000D, 0x7E01, 0x000B, 0x7E20, 0x000A,
+    0x7E3A, 0x0009, 0x7E55, 0x0008, 0x7E67, 0x0007, 0x7E7A, 0x0006, 0x7E8D, 0x0005, 0x7EB3, 0x0004, 0x7ED1, 0x0004, 0x7EF1, 0x0003,
+    // roughness row 105
+    0x8753, 0x0719, 0x8709, 0x06F4, 0x86BF, 0x06CF, 0x8674, 0x06AA, 0x8629, 0x0685, 0x85DE, 0x0660, 0x8592, 0x063B, 0x8546, 0x0617,
+    0x84F9, 0x05F2, 0x84AB, 0x05CE, 0x845C, 0x05AA, 0x840D, 0x0587, 0x83BC, 0x0563, 0x836A, 0x0540, 0x8319, 0x051F, 0x82C6, 0x04FE,
+    0x8273, 0x04DE, 0x8221, 0x04BE, 0x81CE, 0x04A0, 0x8179, 0x0482, 0x8123, 0x0464, 0x80CE, 0x0447, 0x807E, 0x042B, 0x802E, 0x040F,
+    0x7FDC, 0x03F4, 0x7F89, 0x03D9, 0x7F35, 0x03BF, 0x7EE6, 0x03A6, 0x7E94, 0x038D, 0x7E44, 0x0374, 0x7E04, 0x035D, 0x7DC1, 0x0345,
+    0x7D7E, 0x032E, 0x7D53, 0x0317, 0x7D3E, 0x0301, 0x7D28, 0x02EC, 0x7D10, 0x02D6, 0x7CF7, 0x02C1, 0x7CDC, 0x02AC, 0x7CBE, 0x0297,
+    0x7C9F, 0x0282, 0x7C80, 0x026E, 0x7C5F, 0x025B, 0x7C3E, 0x0248, 0x7C19, 0x0235, 0x7BF4, 0x0223, 0x7BCF, 0x0212, 0x7BA9, 0x0200,
+    0x7B89, 0x01F0, 0x7B67, 0x01E1, 0x7B43, 0x01D2, 0x7B21, 0x01C3, 0x7B0D, 0x01B5, 0x7AFC, 0x01A7, 0x7AEA, 0x0199, 0x7AD6, 0x018C,
+    0x7AC5, 0x017E, 0x7ABB, 0x0171, 0x7AAF, 0x0164, 0x7AA0, 0x0157, 0x7A93, 0x014A, 0x7A84, 0x013E, 0x7A73, 0x0132, 0x7A61, 0x0126,
+    0x7A52, 0x011B, 0x7A48, 0x0111, 0x7A3D, 0x0106, 0x7A30, 0x00FC, 0x7A20, 0x00F3, 0x7A1A, 0x00E9, 0x7A19, 0x00E0, 0x7A1E, 0x00D7,
+    0x7A27, 0x00CF, 0x7A30, 0x00C7, 0x7A38, 0x00BF, 0x7A3E, 0x00B7, 0x7A41, 0x00AF, 0x7A43, 0x00A8, 0x7A41, 0x00A1, 0x7A40, 0x009A,
+    0x7A43, 0x0093, 0x7A43, 0x008D, 0x7A44, 0x0086, 0x7A4A, 0x0080, 0x7A4D, 0x0079, 0x7A4C, 0x0073, 0x7A4A, 0x006D, 0x7A49, 0x0068,
+    0x7A4B, 0x0063, 0x7A53, 0x005E, 0x7A5C, 0x0059, 0x7A68, 0x0055, 0x7A70, 0x0050, 0x7A75, 0x004C, 0x7A77, 0x0047, 0x7A79, 0x0044,
+    0x7A7F, 0x0040, 0x7A8A, 0x003C, 0x7A94, 0x0039, 0x7AA5, 0x0036, 0x7ABD, 0x0032, 0x7AD5, 0x002F, 0x7AE7, 0x002C, 0x7AFA, 0x0029,
+    0x7B07, 0x0026, 0x7B14, 0x0024, 0x7B1E, 0x0021, 0x7B27, 0x001F, 0x7B36, 0x001C, 0x7B43, 0x001A, 0x7B4B, 0x0018, 0x7B54, 0x0016,
+    0x7B63, 0x0014, 0x7B70, 0x0013, 0x7B85, 0x0011, 0x7BA0, 0x0010, 0x7BC1, 0x000E, 0x7BE0, 0x000D, 0x7BF2, 0x000B, 0x7BFB, 0x000A,
+    0x7C0D, 0x0009, 0x7C1E, 0x0008, 0x7C33, 0x0007, 0x7C3D, 0x0006, 0x7C4B, 0x0005, 0x7C68, 0x0004, 0x7C86, 0x0004, 0x7C9B, 0x0003,
+    // roughness row 106
+    0x8854, 0x06FD, 0x8804, 0x06D8, 0x87B4, 0x06B3, 0x8763, 0x068E, 0x8711, 0x0669, 0x86BF, 0x0644, 0x866D, 0x0620, 0x8619, 0x05FB,
+    0x85C5, 0x05D7, 0x8570, 0x05B3, 0x851A, 0x058F, 0x84C2, 0x056C, 0x846A, 0x0548, 0x8411, 0x0526, 0x83B8, 0x0505, 0x835D, 0x04E4,
+    0x8303, 0x04C5, 0x82A8, 0x04A6, 0x824D, 0x0488, 0x81F0, 0x046A, 0x8192, 0x044C, 0x8137, 0x0430, 0x80E0, 0x0414, 0x8087, 0x03F9,
+    0x802D, 0x03DE, 0x7FD1, 0x03C3, 0x7F77, 0x03AA, 0x7F1E, 0x0391, 0x7EC4, 0x0379, 0x7E76, 0x0361, 0x7E2C, 0x0349, 0x7DE1, 0x0332,
+    0x7D9B, 0x031B, 0x7D7E, 0x0305, 0x7D61, 0x02EF, 0x7D42, 0x02DA, 0x7D22, 0x02C5, 0x7CFF, 0x02B0, 0x7CDB, 0x029C, 0x7CB5, 0x0287,
+    0x7C8E, 0x0273, 0x7C66, 0x0260, 0x7C3D, 0x024D, 0x7C11, 0x023A, 0x7BE5, 0x0228, 0x7BB8, 0x0216, 0x7B8A, 0x0205, 0x7B61, 0x01F4,
+    0x7B36, 0x01E4, 0x7B0A, 0x01D5, 0x7ADF, 0x01C6, 0x7AC1, 0x01B7, 0x7AA8, 0x01A9, 0x7A8E, 0x019C, 0x7A72, 0x018E, 0x7A59, 0x0182,
+    0x7A48, 0x0175, 0x7A35, 0x0168, 0x7A20, 0x015B, 0x7A0D, 0x014F, 0x79F7, 0x0143, 0x79E0, 0x0137, 0x79C6, 0x012B, 0x79AF, 0x011F,
+    0x799C, 0x0114, 0x7988, 0x010A, 0x7972, 0x0100, 0x795A, 0x00F6, 0x794D, 0x00EC, 0x7945, 0x00E3, 0x7944, 0x00DA, 0x7946, 0x00D2,
+    0x7946, 0x00C9, 0x7944, 0x00C1, 0x7941, 0x00B9, 0x793C, 0x00B2, 0x7936, 0x00AB, 0x792D, 0x00A3, 0x7926, 0x009D, 0x791F, 0x0096,
+    0x7917, 0x008F, 0x7917, 0x0089, 0x7917, 0x0083, 0x7915, 0x007D, 0x7910, 0x0077, 0x7907, 0x0071, 0x78FD, 0x006B, 0x78F2, 0x0065,
+    0x78F2, 0x0060, 0x78F4, 0x005C, 0x78FA, 0x0057, 0x78FC, 0x0053, 0x78F9, 0x004E, 0x78F4, 0x004A, 0x78EB, 0x0046, 0x78E7, 0x0042,
+    0x78E8, 0x003E, 0x78EA, 0x003B, 0x78F7, 0x0037, 0x7909, 0x0034, 0x791A, 0x0031, 0x792A, 0x002E, 0x793A, 0x002B, 0x7946, 0x0029,
+    0x794C, 0x0026, 0x794C, 0x0023, 0x794E, 0x0020, 0x7954, 0x001E, 0x7959, 0x001C, 0x7958, 0x001A, 0x795B, 0x0018, 0x7965, 0x0016,
+    0x796A, 0x0014, 0x7977, 0x0012, 0x7988, 0x0011, 0x799D, 0x000F, 0x79B7, 0x000E, 0x79CC, 0x000D, 0x79D7, 0x000B, 0x79DE, 0x000A,
+    0x79E1, 0x0009, 0x79ED, 0x0008, 0x79FA, 0x0007, 0x7A0A, 0x0006, 0x7A1F, 0x0005, 0x7A28, 0x0004, 0x7A39, 0x0004, 0x7A4B, 0x0003,
+    // roughness row 107
+    0x894E, 0x06E1, 0x88F7, 0x06BC, 0x88A1, 0x0697, 0x8849, 0x0672, 0x87F1, 0x064E, 0x8798, 0x0629, 0x873F, 0x0605, 0x86E5, 0x05E0,
+    0x8689, 0x05BC, 0x862D, 0x0598, 0x85CF, 0x0575, 0x8571, 0x0551, 0x8511, 0x052E, 0x84B0, 0x050D, 0x844F, 0x04EB, 0x83EC, 0x04CB,
+    0x838B, 0x04AC, 0x8329, 0x048E, 0x82C5, 0x0470, 0x825F, 0x0452, 0x81FA, 0x0435, 0x819A, 0x0419, 0x813A, 0x03FE, 0x80D9, 0x03E3,
+    0x8076, 0x03C9, 0x8012, 0x03AF, 0x7FB1, 0x0396, 0x7F50, 0x037D, 0x7EF1, 0x0365, 0x7EA0, 0x034E, 0x7E4D, 0x0336, 0x7DF9, 0x0320,
+    0x7DC8, 0x0309, 0x7DA3, 0x02F3, 0x7D7D, 0x02DE, 0x7D55, 0x02C9, 0x7D2C, 0x02B4, 0x7D01, 0x02A0, 0x7CD3, 0x028C, 0x7CA5, 0x0278,
+    0x7C76, 0x0265, 0x7C45, 0x0251, 0x7C13, 0x023F, 0x7BDF, 0x022D, 0x7BAC, 0x021B, 0x7B76, 0x020A, 0x7B44, 0x01F9, 0x7B12, 0x01E8,
+    0x7ADD, 0x01D9, 0x7AA9, 0x01C9, 0x7A81, 0x01BA, 0x7A60, 0x01AC, 0x7A3E, 0x019E, 0x7A1A, 0x0191, 0x79F8, 0x0184, 0x79DF, 0x0177,
+    0x79C5, 0x016B, 0x79AA, 0x015F, 0x7990, 0x0153, 0x7974, 0x0147, 0x7956, 0x013B, 0x7936, 0x012F, 0x7918, 0x0124, 0x78FD, 0x0119,
+    0x78E0, 0x010E, 0x78C1, 0x0103, 0x78A1, 0x00F9, 0x788D, 0x00F0, 0x787F, 0x00E6, 0x7879, 0x00DD, 0x7872, 0x00D5, 0x786A, 0x00CC,
+    0x7861, 0x00C4, 0x7855, 0x00BC, 0x7846, 0x00B5, 0x7836, 0x00AD, 0x7825, 0x00A6, 0x7818, 0x009F, 0x7809, 0x0098, 0x77FB, 0x0092,
+    0x77F4, 0x008B, 0x77ED, 0x0085, 0x77E5, 0x007F, 0x77D9, 0x007A, 0x77CB, 0x0074, 0x77BD, 0x006E, 0x77AE, 0x0069, 0x77A3, 0x0063,
+    0x779B, 0x005E, 0x7795, 0x0059, 0x778E, 0x0055, 0x7785, 0x0051, 0x777A, 0x004C, 0x776A, 0x0048, 0x7763, 0x0044, 0x775C, 0x0041,
+    0x775A, 0x003D, 0x775B, 0x0039, 0x7763, 0x0036, 0x7768, 0x0033, 0x7773, 0x0030, 0x777E, 0x002D, 0x7785, 0x002A, 0x7789, 0x0028,
+    0x778A, 0x0025, 0x7786, 0x0023, 0x7783, 0x0020, 0x777D, 0x001E, 0x7773, 0x001B, 0x7773, 0x0019, 0x7775, 0x0017, 0x7777, 0x0015,
+    0x777E, 0x0014, 0x7786, 0x0012, 0x7790, 0x0010, 0x779C, 0x000F, 0x77A7, 0x000E, 0x77B0, 0x000C, 0x77B9, 0x000B, 0x77BD, 0x000A,
+    0x77BD, 0x0009, 0x77C1, 0x0008, 0x77C8, 0x0007, 0x77DB, 0x0006, 0x77EC, 0x0005, 0x77F6, 0x0004, 0x77F6, 0x0003, 0x7803, 0x0003,
+    // roughness row 108
+    0x8A3F, 0x06C5, 0x89E3, 0x06A0, 0x8986, 0x067C, 0x8928, 0x0657, 0x88C9, 0x0633, 0x886A, 0x060E, 0x880A, 0x05EA, 0x87A8, 0x05C6,
+    0x8746, 0x05A2, 0x86E2, 0x057E, 0x867D, 0x055B, 0x8617, 0x0538, 0x85B0, 0x0515, 0x8548, 0x04F4, 0x84DE, 0x04D2, 0x8475, 0x04B3,
+    0x840C, 0x0494, 0x83A1, 0x0476, 0x8335, 0x0458, 0x82C8, 0x043B, 0x825C, 0x041F, 0x81F5, 0x0403, 0x818D, 0x03E9, 0x8123, 0x03CE,
+    0x80B8, 0x03B4, 0x804E, 0x039B, 0x7FE5, 0x0382, 0x7F7A, 0x036A, 0x7F1D, 0x0352, 0x7EC3, 0x033B, 0x7E68, 0x0324, 0x7E19, 0x030D,
+    0x7DED, 0x02F7, 0x7DC0, 0x02E2, 0x7D91, 0x02CD, 0x7D60, 0x02B8, 0x7D2E, 0x02A4, 0x7CFA, 0x0290, 0x7CC5, 0x027C, 0x7C8F, 0x0269,
+    0x7C58, 0x0256, 0x7C1F, 0x0244, 0x7BE4, 0x0231, 0x7BA9, 0x0220, 0x7B6B, 0x020E, 0x7B32, 0x01FE, 0x7AF8, 0x01ED, 0x7ABB, 0x01DD,
+    0x7A80, 0x01CD, 0x7A4E, 0x01BE, 0x7A24, 0x01AF, 0x79F9, 0x01A1, 0x79CC, 0x0194, 0x79A1, 0x0187, 0x7981, 0x017A, 0x795F, 0x016E,
+    0x793D, 0x0162, 0x791D, 0x0156, 0x78FB, 0x014A, 0x78D6, 0x013F, 0x78AE, 0x0133, 0x788A, 0x0128, 0x7868, 0x011D, 0x7844, 0x0112,
+    0x781D, 0x0107, 0x77F6, 0x00FD, 0x77DC, 0x00F3, 0x77C8, 0x00EA, 0x77BA, 0x00E1, 0x77AC, 0x00D8, 0x779C, 0x00CF, 0x7789, 0x00C7,
+    0x7775, 0x00BF, 0x7760, 0x00B8, 0x7747, 0x00B0, 0x772D, 0x00A9, 0x7718, 0x00A2, 0x7705, 0x009B, 0x76EF, 0x0094, 0x76E3, 0x008E,
+    0x76D4, 0x0088, 0x76C1, 0x0082, 0x76AD, 0x007C, 0x7699, 0x0076, 0x7686, 0x0071, 0x7672, 0x006C, 0x7663, 0x0066, 0x7656, 0x0061,
+    0x7646, 0x005C, 0x7632, 0x0057, 0x761D, 0x0053, 0x7607, 0x004E, 0x75F3, 0x004A, 0x75E8, 0x0047, 0x75DC, 0x0043, 0x75D7, 0x003F,
+    0x75D3, 0x003B, 0x75D2, 0x0038, 0x75D1, 0x0035, 0x75D2, 0x0032, 0x75D0, 0x002F, 0x75CC, 0x002C, 0x75C8, 0x0029, 0x75C4, 0x0027,
+    0x75BF, 0x0024, 0x75BB, 0x0022, 0x75B0, 0x0020, 0x75A0, 0x001D, 0x7599, 0x001B, 0x7597, 0x0019, 0x7593, 0x0017, 0x7592, 0x0015,
+    0x7597, 0x0013, 0x759A, 0x0012, 0x759E, 0x0010, 0x759E, 0x000F, 0x7599, 0x000D, 0x7594, 0x000C, 0x7596, 0x000B, 0x759D, 0x000A,
+    0x75A4, 0x0009, 0x75A2, 0x0008, 0x75A5, 0x0007, 0x75B4, 0x0006, 0x75BE, 0x0005, 0x75C1, 0x0004, 0x75BF, 0x0004, 0x75C4, 0x0003,
+    // roughness row 109
+    0x8B29, 0x06AA, 0x8AC6, 0x0685, 0x8A63, 0x0661, 0x89FF, 0x063C, 0x899A, 0x0618, 0x8933, 0x05F4, 0x88CC, 0x05CF, 0x8864, 0x05AB,
+    0x87FA, 0x0588, 0x8790, 0x0564, 0x8723, 0x0541, 0x86B6, 0x051E, 0x8647, 0x04FC, 0x85D8, 0x04DB, 0x8567, 0x04BA, 0x84F6, 0x049B,
+    0x8485, 0x047C, 0x8412, 0x045F, 0x839E, 0x0441, 0x8329, 0x0425, 0x82B8, 0x0409, 0x8249, 0x03EE, 0x81D9, 0x03D4, 0x8166, 0x03BA,
+    0x80F3, 0x03A0, 0x8083, 0x0387, 0x8011, 0x036F, 0x7FA2, 0x0357, 0x7F42, 0x033F, 0x7EDF, 0x0328, 0x7E7B, 0x0312, 0x7E40, 0x02FC,
+    0x7E0B, 0x02E6, 0x7DD6, 0x02D1, 0x7D9E, 0x02BC, 0x7D64, 0x02A7, 0x7D29, 0x0293, 0x7CED, 0x0280, 0x7CB1, 0x026D, 0x7C73, 0x025A,
+    0x7C33, 0x0248, 0x7BF1, 0x0236, 0x7BAF, 0x0224, 0x7B6B, 0x0213, 0x7B29, 0x0202, 0x7AE8, 0x01F2, 0x7AA5, 0x01E1, 0x7A61, 0x01D2,
+    0x7A24, 0x01C2, 0x79F3, 0x01B3, 0x79C0, 0x01A5, 0x798A, 0x0197, 0x7955, 0x0189, 0x792C, 0x017D, 0x7902, 0x0170, 0x78DC, 0x0164,
+    0x78B4, 0x0159, 0x788A, 0x014D, 0x785E, 0x0142, 0x7830, 0x0137, 0x7806, 0x012C, 0x77DD, 0x0121, 0x77B2, 0x0116, 0x7783, 0x010C,
+    0x7756, 0x0101, 0x7738, 0x00F7, 0x771B, 0x00ED, 0x7706, 0x00E4, 0x76F0, 0x00DB, 0x76D8, 0x00D3, 0x76BE, 0x00CA, 0x76A2, 0x00C2,
+    0x7683, 0x00BA, 0x7663, 0x00B3, 0x7644, 0x00AC, 0x762A, 0x00A5, 0x760F, 0x009E, 0x75F3, 0x0097, 0x75DE, 0x0091, 0x75C7, 0x008B,
+    0x75AD, 0x0085, 0x7591, 0x007F, 0x7577, 0x0079, 0x755A, 0x0073, 0x7541, 0x006E, 0x752D, 0x0069, 0x751B, 0x0064, 0x7505, 0x005F,
+    0x74EA, 0x005A, 0x74CD, 0x0055, 0x74AB, 0x0051, 0x748D, 0x004C, 0x747B, 0x0048, 0x746B, 0x0045, 0x7462, 0x0041, 0x7459, 0x003E,
+    0x7451, 0x003A, 0x744B, 0x0037, 0x7444, 0x0034, 0x7438, 0x0030, 0x742A, 0x002D, 0x741D, 0x002B, 0x740D, 0x0028, 0x73FD, 0x0025,
+    0x73F1, 0x0023, 0x73E4, 0x0021, 0x73D7, 0x001F, 0x73CF, 0x001D, 0x73C8, 0x001A, 0x73BC, 0x0018, 0x73B5, 0x0016, 0x73B6, 0x0015,
+    0x73B3, 0x0013, 0x73B1, 0x0011, 0x73AC, 0x0010, 0x73A0, 0x000E, 0x7394, 0x000D, 0x738D, 0x000C, 0x7382, 0x000B, 0x738A, 0x000A,
+    0x738D, 0x0009, 0x738A, 0x0008, 0x738B, 0x0007, 0x738E, 0x0006, 0x738F, 0x0005, 0x738B, 0x0004, 0x738A, 0x0004, 0x7384, 0x0003,
+    // roughness row 110
+    0x8C0A, 0x068F, 0x8BA2, 0x066B, 0x8B38, 0x0646, 0x8ACE, 0x0622, 0x8A62, 0x05FE, 0x89F5, 0x05DA, 0x8987, 0x05B6, 0x8918, 0x0592,
+    0x88A7, 0x056E, 0x8835, 0x054B, 0x87C2, 0x0528, 0x874D, 0x0506, 0x86D7, 0x04E4, 0x8660, 0x04C3, 0x85E7, 0x04A2, 0x8570, 0x0483,
+    0x84F7, 0x0465, 0x847C, 0x0448, 0x8400, 0x042B, 0x8384, 0x040F, 0x830D, 0x03F4, 0x8296, 0x03D9, 0x821D, 0x03BF, 0x81A2, 0x03A5,
+    0x8129, 0x038C, 0x80B1, 0x0374, 0x8036, 0x035C, 0x7FC9, 0x0344, 0x7F5F, 0x032D, 0x7EF4, 0x0316, 0x7E9B, 0x0300, 0x7E60, 0x02EA,
+    0x7E22, 0x02D5, 0x7DE4, 0x02C0, 0x7DA3, 0x02AB, 0x7D61, 0x0297, 0x7D1E, 0x0283, 0x7CDB, 0x0271, 0x7C96, 0x025E, 0x7C4F, 0x024C,
+    0x7C06, 0x023A, 0x7BBE, 0x0229, 0x7B73, 0x0218, 0x7B29, 0x0207, 0x7AE1, 0x01F6, 0x7A97, 0x01E6, 0x7A4C, 0x01D6, 0x7A04, 0x01C7,
+    0x79CC, 0x01B8, 0x7990, 0x01A9, 0x7954, 0x019B, 0x7915, 0x018D, 0x78E4, 0x0180, 0x78B2, 0x0173, 0x7883, 0x0167, 0x7854, 0x015B,
+    0x7823, 0x0150, 0x77F0, 0x0144, 0x77BA, 0x013A, 0x7789, 0x012F, 0x775A, 0x0124, 0x7728, 0x011A, 0x76F5, 0x0110, 0x76C3, 0x0105,
+    0x769F, 0x00FB, 0x767C, 0x00F2, 0x765F, 0x00E8, 0x7640, 0x00DF, 0x761F, 0x00D6, 0x75FD, 0x00CD, 0x75D9, 0x00C5, 0x75B3, 0x00BD,
+    0x758C, 0x00B6, 0x7568, 0x00AE, 0x7547, 0x00A7, 0x7524, 0x00A0, 0x7501, 0x009A, 0x74E4, 0x0093, 0x74C5, 0x008D, 0x74A3, 0x0087,
+    0x7482, 0x0081, 0x7461, 0x007C, 0x743C, 0x0076, 0x741C, 0x0071, 0x7400, 0x006B, 0x73E7, 0x0066, 0x73CB, 0x0062, 0x73AC, 0x005D,
+    0x7389, 0x0058, 0x7361, 0x0054, 0x7342, 0x004F, 0x7325, 0x004B, 0x730B, 0x0046, 0x72F9, 0x0043, 0x72EB, 0x003F, 0x72DF, 0x003C,
+    0x72D5, 0x0039, 0x72C5, 0x0035, 0x72B2, 0x0032, 0x729E, 0x002F, 0x7288, 0x002C, 0x726F, 0x002A, 0x7256, 0x0027, 0x723F, 0x0025,
+    0x722C, 0x0022, 0x7218, 0x0020, 0x720F, 0x001E, 0x7206, 0x001C, 0x71F8, 0x001A, 0x71EC, 0x0018, 0x71E5, 0x0016, 0x71DB, 0x0014,
+    0x71D5, 0x0013, 0x71CB, 0x0011, 0x71BB, 0x0010, 0x71AD, 0x000E, 0x719E, 0x000D, 0x718D, 0x000C, 0x7187, 0x000A, 0x7177, 0x0009,
+    0x7174, 0x0008, 0x7174, 0x0007, 0x7170, 0x0007, 0x7165, 0x0006, 0x715E, 0x0005, 0x7158, 0x0004, 0x7151, 0x0003, 0x7145, 0x0003,
+    // roughness row 111
+    0x8CE4, 0x0675, 0x8C75, 0x0651, 0x8C06, 0x062C, 0x8B95, 0x0608, 0x8B23, 0x05E4, 0x8AAF, 0x05C0, 0x8A3B, 0x059C, 0x89C4, 0x0579,
+    0x894D, 0x0555, 0x88D4, 0x0532, 0x8859, 0x050F, 0x87DD, 0x04ED, 0x8760, 0x04CC, 0x86E1, 0x04AB, 0x8661, 0x048B, 0x85E2, 0x046D,
+    0x8561, 0x044F, 0x84DE, 0x0431, 0x845B, 0x0415, 0x83D9, 0x03FA, 0x835B, 0x03DF, 0x82DC, 0x03C5, 0x825A, 0x03AB, 0x81D7, 0x0392,
+    0x8158, 0x0379, 0x80D7, 0x0361, 0x8058, 0x0349, 0x7FE8, 0x0332, 0x7F76, 0x031B, 0x7F01, 0x0305, 0x7EBB, 0x02EF, 0x7E78, 0x02D9,
+    0x7E32, 0x02C4, 0x7DEB, 0x02AF, 0x7DA2, 0x029B, 0x7D57, 0x0287, 0x7D0D, 0x0274, 0x7CC1, 0x0262, 0x7C74, 0x0250, 0x7C24, 0x023E,
+    0x7BD5, 0x022D, 0x7B83, 0x021C, 0x7B32, 0x020B, 0x7AE4, 0x01FB, 0x7A93, 0x01EB, 0x7A40, 0x01DB, 0x79F1, 0x01CC, 0x79AE, 0x01BC,
+    0x796C, 0x01AD, 0x7928, 0x019F, 0x78E1, 0x0191, 0x78A6, 0x0183, 0x786D, 0x0176, 0x7837, 0x0169, 0x77FF, 0x015D, 0x77C6, 0x0152,
+    0x778B, 0x0147, 0x774E, 0x013C, 0x7715, 0x0131, 0x76DF, 0x0127, 0x76A7, 0x011D, 0x766E, 0x0113, 0x7636, 0x0109, 0x760E, 0x00FF,
+    0x75E6, 0x00F6, 0x75C3, 0x00EC, 0x759D, 0x00E3, 0x7574, 0x00DA, 0x754A, 0x00D1, 0x751E, 0x00C8, 0x74F1, 0x00C0, 0x74C2, 0x00B9,
+    0x7499, 0x00B1, 0x7470, 0x00AA, 0x7444, 0x00A3, 0x741A, 0x009C, 0x73F5, 0x0096, 0x73CE, 0x008F, 0x73A4, 0x0089, 0x737C, 0x0083,
+    0x7353, 0x007E, 0x7328, 0x0078, 0x7302, 0x0073, 0x72E2, 0x006E, 0x72C0, 0x0069, 0x729A, 0x0064, 0x7274, 0x005F, 0x724B, 0x005B,
+    0x7221, 0x0056, 0x7200, 0x0052, 0x71E2, 0x004E, 0x71C6, 0x0049, 0x71A9, 0x0045, 0x718E, 0x0041, 0x7177, 0x003E, 0x7164, 0x003A,
+    0x714F, 0x0037, 0x7138, 0x0034, 0x711F, 0x0031, 0x7101, 0x002E, 0x70E1, 0x002B, 0x70C3, 0x0029, 0x70AB, 0x0026, 0x7090, 0x0024,
+    0x7074, 0x0021, 0x7065, 0x001F, 0x7055, 0x001D, 0x7043, 0x001B, 0x7036, 0x0019, 0x702B, 0x0018, 0x701A, 0x0016, 0x700A, 0x0014,
+    0x6FF8, 0x0012, 0x6FE9, 0x0011, 0x6FD8, 0x000F, 0x6FC3, 0x000E, 0x6FAC, 0x000D, 0x6F9D, 0x000C, 0x6F8A, 0x000A, 0x6F77, 0x0009,
+    0x6F62, 0x0008, 0x6F5F, 0x0007, 0x6F55, 0x0006, 0x6F42, 0x0006, 0x6F2E, 0x0005, 0x6F24, 0x0004, 0x6F1C, 0x0003, 0x6F14, 0x0003,
+    // roughness row 112
+    0x8DB6, 0x065B, 0x8D41, 0x0637, 0x8CCB, 0x0613, 0x8C54, 0x05EF, 0x8BDB, 0x05CB, 0x8B61, 0x05A7, 0x8AE6, 0x0583, 0x8A69, 0x0560,
+    0x89EB, 0x053D, 0x896A, 0x051A, 0x88E8, 0x04F7, 0x8865, 0x04D6, 0x87E1, 0x04B5, 0x875A, 0x0494, 0x86D4, 0x0475, 0x864D, 0x0456,
+    0x85C4, 0x0439, 0x8539, 0x041C, 0x84AF, 0x0400, 0x8428, 0x03E5, 0x83A2, 0x03CB, 0x831A, 0x03B1, 0x8290, 0x0397, 0x8208, 0x037F,
+    0x8180, 0x0366, 0x80F6, 0x034E, 0x8079, 0x0337, 0x8000, 0x0320, 0x7F85, 0x0309, 0x7F1E, 0x02F3, 0x7ED5, 0x02DE, 0x7E89, 0x02C8,
+    0x7E3B, 0x02B4, 0x7DEB, 0x029F, 0x7D9A, 0x028B, 0x7D49, 0x0278, 0x7CF6, 0x0265, 0x7CA1, 0x0253, 0x7C4A, 0x0241, 0x7BF4, 0x0230,
+    0x7B9C, 0x021F, 0x7B43, 0x020F, 0x7AEE, 0x01FF, 0x7A96, 0x01EF, 0x7A3D, 0x01DF, 0x79E6, 0x01D0, 0x7999, 0x01C1, 0x7951, 0x01B2,
+    0x7906, 0x01A3, 0x78B8, 0x0195, 0x7873, 0x0187, 0x7833, 0x017A, 0x77F5, 0x016D, 0x77B6, 0x0160, 0x7774, 0x0154, 0x7730, 0x0149,
+    0x76EB, 0x013E, 0x76AB, 0x0133, 0x766D, 0x0129, 0x762E, 0x011F, 0x75F1, 0x0115, 0x75B2, 0x010C, 0x7584, 0x0102, 0x7556, 0x00F9,
+    0x752D, 0x00F0, 0x7501, 0x00E6, 0x74D4, 0x00DD, 0x74A3, 0x00D5, 0x7470, 0x00CC, 0x743A, 0x00C4, 0x7404, 0x00BC, 0x73D4, 0x00B4,
+    0x73A4, 0x00AD, 0x7371, 0x00A6, 0x7340, 0x009F, 0x7314, 0x0098, 0x72E4, 0x0092, 0x72B3, 0x008C, 0x7284, 0x0086, 0x7252, 0x0080,
+    0x721E, 0x007A, 0x71F1, 0x0075, 0x71CB, 0x0070, 0x71A3, 0x006B, 0x7177, 0x0066, 0x7148, 0x0061, 0x7117, 0x005D, 0x70E9, 0x0058,
+    0x70C7, 0x0054, 0x70A6, 0x0050, 0x7087, 0x004C, 0x7065, 0x0048, 0x7047, 0x0044, 0x7029, 0x0040, 0x7009, 0x003C, 0x6FE7, 0x0039,
+    0x6FC8, 0x0036, 0x6FAC, 0x0033, 0x6F8D, 0x0030, 0x6F69, 0x002D, 0x6F4A, 0x002A, 0x6F2A, 0x0028, 0x6F06, 0x0025, 0x6EE5, 0x0023,
+    0x6ECF, 0x0021, 0x6EB3, 0x001E, 0x6E98, 0x001C, 0x6E86, 0x001B, 0x6E77, 0x0019, 0x6E63, 0x0017, 0x6E52, 0x0015, 0x6E3B, 0x0014,
+    0x6E22, 0x0012, 0x6E08, 0x0011, 0x6DEF, 0x000F, 0x6DD7, 0x000E, 0x6DC4, 0x000D, 0x6DAD, 0x000B, 0x6D90, 0x000A, 0x6D78, 0x0009,
+    0x6D68, 0x0008, 0x6D54, 0x0007, 0x6D43, 0x0006, 0x6D28, 0x0006, 0x6D10, 0x0005, 0x6CF9, 0x0004, 0x6CF0, 0x0003, 0x6CE4, 0x0003,
+    // roughness row 113
+    0x8E80, 0x0641, 0x8E05, 0x061D, 0x8D89, 0x05FA, 0x8D0B, 0x05D6, 0x8C8D, 0x05B2, 0x8C0C, 0x058E, 0x8B8A, 0x056B, 0x8B06, 0x0548,
+    0x8A81, 0x0525, 0x89F9, 0x0502, 0x8970, 0x04E0, 0x88E6, 0x04BE, 0x885A, 0x049E, 0x87CC, 0x047D, 0x873F, 0x045F, 0x86B0, 0x0441,
+    0x861F, 0x0423, 0x858E, 0x0407, 0x84FB, 0x03EB, 0x846F, 0x03D1, 0x83E1, 0x03B7, 0x8351, 0x039D, 0x82BF, 0x0384, 0x8231, 0x036C,
+    0x81A1, 0x0354, 0x8111, 0x033C, 0x8092, 0x0325, 0x8011, 0x030E, 0x7F8D, 0x02F8, 0x7F39, 0x02E2, 0x7EE7, 0x02CD, 0x7E93, 0x02B8,
+    0x7E3C, 0x02A4, 0x7DE5, 0x0290, 0x7D8C, 0x027C, 0x7D33, 0x0269, 0x7CD7, 0x0257, 0x7C79, 0x0245, 0x7C1C, 0x0233, 0x7BBD, 0x0223,
+    0x7B5D, 0x0212, 0x7B00, 0x0202, 0x7AA2, 0x01F3, 0x7A42, 0x01E3, 0x79E4, 0x01D4, 0x798C, 0x01C5, 0x793D, 0x01B6, 0x78EC, 0x01A8,
+    0x7898, 0x019A, 0x784A, 0x018C, 0x7803, 0x017E, 0x77BE, 0x0171, 0x7776, 0x0164, 0x772D, 0x0158, 0x76E2, 0x014C, 0x7695, 0x0140,
+    0x764B, 0x0135, 0x7605, 0x012B, 0x75C0, 0x0121, 0x757C, 0x0117, 0x7536, 0x010E, 0x7502, 0x0104, 0x74CD, 0x00FB, 0x749F, 0x00F2,
+    0x746E, 0x00EA, 0x743B, 0x00E1, 0x7404, 0x00D8, 0x73CB, 0x00D0, 0x738F, 0x00C7, 0x7354, 0x00BF, 0x731D, 0x00B7, 0x72E3, 0x00B0,
+    0x72A8, 0x00A8, 0x7270, 0x00A1, 0x723C, 0x009B, 0x7205, 0x0094, 0x71CF, 0x008E, 0x7198, 0x0088, 0x715F, 0x0082, 0x7122, 0x007D,
+    0x70EF, 0x0077, 0x70C1, 0x0072, 0x7090, 0x006D, 0x705D, 0x0068, 0x7028, 0x0063, 0x6FF4, 0x005F, 0x6FC2, 0x005A, 0x6F99, 0x0056,
+    0x6F6F, 0x0052, 0x6F4C, 0x004E, 0x6F28, 0x004A, 0x6F07, 0x0046, 0x6EE8, 0x0043, 0x6EC6, 0x003F, 0x6EA0, 0x003B, 0x6E78, 0x0038,
+    0x6E4E, 0x0034, 0x6E22, 0x0031, 0x6DFC, 0x002F, 0x6DDB, 0x002C, 0x6DB6, 0x002A, 0x6D8F, 0x0027, 0x6D69, 0x0025, 0x6D49, 0x0022,
+    0x6D24, 0x0020, 0x6D01, 0x001E, 0x6CE6, 0x001C, 0x6CCD, 0x001A, 0x6CB3, 0x0018, 0x6CA0, 0x0017, 0x6C88, 0x0015, 0x6C6E, 0x0013,
+    0x6C4D, 0x0012, 0x6C27, 0x0010, 0x6C06, 0x000F, 0x6BEF, 0x000E, 0x6BD6, 0x000C, 0x6BB7, 0x000B, 0x6B97, 0x000A, 0x6B80, 0x0009,
+    0x6B6D, 0x0008, 0x6B50, 0x0007, 0x6B33, 0x0006, 0x6B1A, 0x0005, 0x6AFC, 0x0005, 0x6AE3, 0x0004, 0x6AD0, 0x0003, 0x6AC2, 0x0003,
+    // roughness row 114
+    0x8F42, 0x0628, 0x8EC1, 0x0605, 0x8E3F, 0x05E1, 0x8DBB, 0x05BD, 0x8D36, 0x059A, 0x8CAF, 0x0576, 0x8C26, 0x0553, 0x8B9C, 0x0530,
+    0x8B0F, 0x050D, 0x8A81, 0x04EA, 0x89F1, 0x04C8, 0x895F, 0x04A8, 0x88CC, 0x0487, 0x8837, 0x0467, 0x87A2, 0x0449, 0x870C, 0x042B,
+    0x8674, 0x040E, 0x85DB, 0x03F2, 0x8543, 0x03D7, 0x84AF, 0x03BD, 0x8419, 0x03A3, 0x8381, 0x038A, 0x82E9, 0x0371, 0x8253, 0x0359,
+    0x81BA, 0x0342, 0x812C, 0x032A, 0x80A4, 0x0314, 0x801A, 0x02FD, 0x7FA5, 0x02E7, 0x7F4C, 0x02D2, 0x7EF2, 0x02BC, 0x7E95, 0x02A8,
+    0x7E37, 0x0294, 0x7DD8, 0x0280, 0x7D78, 0x026D, 0x7D16, 0x025B, 0x7CB1, 0x0249, 0x7C4D, 0x0237, 0x7BE7, 0x0226, 0x7B80, 0x0216,
+    0x7B1B, 0x0206, 0x7AB7, 0x01F6, 0x7A50, 0x01E6, 0x79EA, 0x01D7, 0x7987, 0x01C9, 0x7932, 0x01BA, 0x78DA, 0x01AB, 0x7880, 0x019D,
+    0x7829, 0x0190, 0x77DC, 0x0182, 0x7790, 0x0175, 0x7742, 0x0168, 0x76F2, 0x015C, 0x769F, 0x014F, 0x764A, 0x0143, 0x75F7, 0x0138,
+    0x75A9, 0x012D, 0x755C, 0x0123, 0x7511, 0x0119, 0x74C5, 0x010F, 0x7488, 0x0106, 0x744D, 0x00FD, 0x7419, 0x00F4, 0x73E2, 0x00EC,
+    0x73A8, 0x00E4, 0x736C, 0x00DB, 0x732D, 0x00D3, 0x72ED, 0x00CB, 0x72AC, 0x00C3, 0x726F, 0x00BB, 0x722F, 0x00B3, 0x71EC, 0x00AC,
+    0x71AD, 0x00A4, 0x7170, 0x009D, 0x7132, 0x0097, 0x70F4, 0x0090, 0x70B5, 0x008A, 0x7075, 0x0084, 0x7033, 0x007F, 0x6FFA, 0x0079,
+    0x6FC3, 0x0074, 0x6F8A, 0x006F, 0x6F4E, 0x006A, 0x6F15, 0x0065, 0x6EDB, 0x0060, 0x6EA7, 0x005C, 0x6E7A, 0x0058, 0x6E4D, 0x0054,
+    0x6E22, 0x0050, 0x6DF6, 0x004C, 0x6DD2, 0x0048, 0x6DB0, 0x0045, 0x6D8A, 0x0041, 0x6D63, 0x003E, 0x6D37, 0x003A, 0x6D08, 0x0037,
+    0x6CD7, 0x0034, 0x6CA3, 0x0030, 0x6C76, 0x002E, 0x6C49, 0x002B, 0x6C1D, 0x0028, 0x6BF5, 0x0026, 0x6BCF, 0x0024, 0x6BA6, 0x0022,
+    0x6B7B, 0x001F, 0x6B5C, 0x001D, 0x6B3D, 0x001B, 0x6B1A, 0x0019, 0x6AFB, 0x0018, 0x6ADA, 0x0016, 0x6ABC, 0x0014, 0x6A98, 0x0013,
+    0x6A72, 0x0011, 0x6A4D, 0x0010, 0x6A29, 0x000F, 0x6A06, 0x000D, 0x69E3, 0x000C, 0x69C1, 0x000B, 0x69A7, 0x000A, 0x6991, 0x0009,
+    0x6972, 0x0008, 0x6952, 0x0007, 0x692D, 0x0006, 0x6910, 0x0005, 0x68F2, 0x0005, 0x68DD, 0x0004, 0x68BF, 0x0003, 0x68A3, 0x0003,
+    // roughness row 115
+    0x8FFD, 0x0610, 0x8F76, 0x05EC, 0x8EEE, 0x05C8, 0x8E64, 0x05A5, 0x8DD8, 0x0582, 0x8D4A, 0x055E, 0x8CBB, 0x053B, 0x8C29, 0x0518,
+    0x8B96, 0x04F6, 0x8B01, 0x04D3, 0x8A6A, 0x04B2, 0x89D1, 0x0491, 0x8936, 0x0471, 0x889B, 0x0452, 0x87FF, 0x0434, 0x8761, 0x0417,
+    0x86C1, 0x03FA, 0x8621, 0x03DE, 0x8584, 0x03C4, 0x84E8, 0x03AA, 0x844A, 0x0390, 0x83AA, 0x0377, 0x830C, 0x035F, 0x826E, 0x0347,
+    0x81CD, 0x0330, 0x813F, 0x0319, 0x80AF, 0x0302, 0x801D, 0x02EC, 0x7FB9, 0x02D7, 0x7F58, 0x02C1, 0x7EF6, 0x02AC, 0x7E91, 0x0298,
+    0x7E2B, 0x0285, 0x7DC5, 0x0272, 0x7D5C, 0x025F, 0x7CF1, 0x024C, 0x7C86, 0x023B, 0x7C1A, 0x022A, 0x7BAC, 0x0219, 0x7B3E, 0x0209,
+    0x7AD3, 0x01F9, 0x7A66, 0x01EA, 0x79F8, 0x01DB, 0x798C, 0x01CC, 0x792E, 0x01BD, 0x78D0, 0x01AF, 0x7870, 0x01A1, 0x780F, 0x0193,
+    0x77BB, 0x0186, 0x776A, 0x0179, 0x7716, 0x016C, 0x76BF, 0x0160, 0x7666, 0x0153, 0x760A, 0x0147, 0x75AE, 0x013B, 0x7559, 0x0130,
+    0x7506, 0x0125, 0x74B2, 0x011B, 0x745D, 0x0111, 0x7418, 0x0107, 0x73D7, 0x00FF, 0x739B, 0x00F6, 0x735D, 0x00EE, 0x731D, 0x00E5,
+    0x72DB, 0x00DD, 0x7296, 0x00D5, 0x7252, 0x00CD, 0x720C, 0x00C6, 0x71C8, 0x00BE, 0x7182, 0x00B6, 0x7139, 0x00AF, 0x70F4, 0x00A8,
+    0x70B0, 0x00A0, 0x706A, 0x009A, 0x7026, 0x0093, 0x6FE0, 0x008D, 0x6F98, 0x0087, 0x6F4F, 0x0081, 0x6F0F, 0x007B, 0x6ED2, 0x0076,
+    0x6E93, 0x0071, 0x6E53, 0x006C, 0x6E12, 0x0067, 0x6DD1, 0x0062, 0x6D97, 0x005E, 0x6D65, 0x0059, 0x6D34, 0x0055, 0x6D04, 0x0052,
+    0x6CD5, 0x004E, 0x6CAC, 0x004A, 0x6C80, 0x0046, 0x6C54, 0x0043, 0x6C29, 0x0040, 0x6BFB, 0x003C, 0x6BCB, 0x0039, 0x6B98, 0x0036,
+    0x6B60, 0x0033, 0x6B2B, 0x0030, 0x6AF5, 0x002D, 0x6ABE, 0x002A, 0x6A8E, 0x0028, 0x6A61, 0x0025, 0x6A33, 0x0023, 0x6A07, 0x0021,
+    0x69E5, 0x001F, 0x69BF, 0x001D, 0x6994, 0x001B, 0x6970, 0x0019, 0x6946, 0x0017, 0x691C, 0x0015, 0x68F0, 0x0014, 0x68C4, 0x0012,
+    0x689F, 0x0011, 0x6879, 0x0010, 0x6852, 0x000E, 0x6824, 0x000D, 0x67F7, 0x000C, 0x67DA, 0x000B, 0x67C4, 0x000A, 0x67A5, 0x0009,
+    0x677E, 0x0008, 0x6756, 0x0007, 0x6733, 0x0006, 0x670F, 0x0005, 0x66FA, 0x0005, 0x66D6, 0x0004, 0x66B8, 0x0003, 0x6690, 0x0003,
+    // roughness row 116
+    0x90B0, 0x05F7, 0x9023, 0x05D4, 0x8F94, 0x05B1, 0x8F04, 0x058D, 0x8E72, 0x056A, 0x8DDE, 0x0547, 0x8D48, 0x0524, 0x8CB0, 0x0501,
+    0x8C16, 0x04DF, 0x8B79, 0x04BD, 0x8ADB, 0x049C, 0x8A3B, 0x047B, 0x8999, 0x045B, 0x88F7, 0x043D, 0x8854, 0x041F, 0x87AF, 0x0402,
+    0x8708, 0x03E6, 0x865F, 0x03CB, 0x85BE, 0x03B0, 0x851A, 0x0397, 0x8474, 0x037D, 0x83CC, 0x0365, 0x8328, 0x034D, 0x8281, 0x0336,
+    0x81E1, 0x031E, 0x814B, 0x0308, 0x80B3, 0x02F1, 0x802C, 0x02DC, 0x7FC6, 0x02C6, 0x7F5D, 0x02B1, 0x7EF3, 0x029D, 0x7E86, 0x0289,
+    0x7E1A, 0x0276, 0x7DAB, 0x0263, 0x7D3A, 0x0251, 0x7CC8, 0x023F, 0x7C55, 0x022D, 0x7BE1, 0x021D, 0x7B6A, 0x020C, 0x7AF8, 0x01FC,
+    0x7A84, 0x01ED, 0x7A0E, 0x01DE, 0x799D, 0x01CF, 0x7932, 0x01C1, 0x78CE, 0x01B2, 0x7868, 0x01A4, 0x7800, 0x0197, 0x77A3, 0x018A,
+    0x774B, 0x017C, 0x76F1, 0x0170, 0x7694, 0x0163, 0x7635, 0x0157, 0x75D2, 0x014B, 0x756F, 0x013F, 0x7514, 0x0134, 0x74BA, 0x0129,
+    0x745F, 0x011E, 0x7403, 0x0114, 0x73B5, 0x010A, 0x736A, 0x0100, 0x7327, 0x00F7, 0x72E2, 0x00EF, 0x729B, 0x00E7, 0x7252, 0x00DF,
+    0x7208, 0x00D7, 0x71BC, 0x00CF, 0x7171, 0x00C8, 0x7129, 0x00C0, 0x70DD, 0x00B9, 0x708E, 0x00B2, 0x7043, 0x00AA, 0x6FF9, 0x00A3,
+    0x6FAE, 0x009D, 0x6F63, 0x0096, 0x6F16, 0x008F, 0x6EC7, 0x0089, 0x6E78, 0x0083, 0x6E33, 0x007E, 0x6DEF, 0x0078, 0x6DA9, 0x0073,
+    0x6D65, 0x006E, 0x6D1E, 0x0069, 0x6CD8, 0x0064, 0x6C99, 0x0060, 0x6C5E, 0x005B, 0x6C24, 0x0057, 0x6BEE, 0x0053, 0x6BBA, 0x004F,
+    0x6B8D, 0x004C, 0x6B5D, 0x0048, 0x6B2C, 0x0045, 0x6AFA, 0x0041, 0x6AC6, 0x003E, 0x6A92, 0x003B, 0x6A5C, 0x0038, 0x6A22, 0x0035,
+    0x69EC, 0x0032, 0x69B3, 0x002F, 0x6974, 0x002C, 0x693D, 0x0029, 0x6908, 0x0027, 0x68D3, 0x0024, 0x68A3, 0x0022, 0x687D, 0x0020,
+    0x6852, 0x001E, 0x6824, 0x001C, 0x67F7, 0x001A, 0x67C5, 0x0018, 0x6796, 0x0017, 0x6761, 0x0015, 0x672A, 0x0013, 0x66FB, 0x0012,
+    0x66D0, 0x0011, 0x66A9, 0x000F, 0x667C, 0x000E, 0x664B, 0x000D, 0x6626, 0x000C, 0x6607, 0x000B, 0x65E3, 0x000A, 0x65B9, 0x0009,
+    0x6590, 0x0008, 0x6561, 0x0007, 0x653B, 0x0006, 0x6517, 0x0005, 0x64FB, 0x0005, 0x64D9, 0x0004, 0x64AE, 0x0003, 0x6489, 0x0003,
+    // roughness row 117
+    0x915B, 0x05E0, 0x90C8, 0x05BC, 0x9034, 0x0599, 0x8F9D, 0x0576, 0x8F05, 0x0553, 0x8E6A, 0x0530, 0x8DCD, 0x050D, 0x8D2F, 0x04EB,
+    0x8C8E, 0x04C8, 0x8BEA, 0x04A7, 0x8B45, 0x0486, 0x8A9F, 0x0466, 0x89F5, 0x0446, 0x894D, 0x0429, 0x88A2, 0x040B, 0x87F5, 0x03EE,
+    0x8747, 0x03D3, 0x869A, 0x03B8, 0x85F0, 0x039E, 0x8545, 0x0384, 0x8497, 0x036B, 0x83EA, 0x0353, 0x833D, 0x033B, 0x828E, 0x0324,
+    0x81EF, 0x030D, 0x8151, 0x02F7, 0x80B0, 0x02E1, 0x803A, 0x02CB, 0x7FCC, 0x02B6, 0x7F5C, 0x02A2, 0x7EE9, 0x028E, 0x7E76, 0x027A,
+    0x7E01, 0x0267, 0x7D8A, 0x0255, 0x7D11, 0x0243, 0x7C99, 0x0231, 0x7C1E, 0x0220, 0x7BA0, 0x0210, 0x7B26, 0x0200, 0x7AAC, 0x01F0,
+    0x7A2E, 0x01E1, 0x79B5, 0x01D2, 0x793F, 0x01C4, 0x78D4, 0x01B5, 0x7869, 0x01A8, 0x77FA, 0x019A, 0x7792, 0x018D, 0x7734, 0x0180,
+    0x76D3, 0x0173, 0x7670, 0x0167, 0x760B, 0x015A, 0x75A3, 0x014F, 0x7538, 0x0143, 0x74D8, 0x0137, 0x7477, 0x012C, 0x7416, 0x0121,
+    0x73B4, 0x0117, 0x735D, 0x010D, 0x730A, 0x0103, 0x72BF, 0x00FA, 0x7272, 0x00F1, 0x7223, 0x00E8, 0x71D2, 0x00E0, 0x7182, 0x00D8,
+    0x7130, 0x00D1, 0x70DF, 0x00C9, 0x708F, 0x00C2, 0x703E, 0x00BB, 0x6FEA, 0x00B4, 0x6F9A, 0x00AD, 0x6F4B, 0x00A6, 0x6EFC, 0x009F,
+    0x6EAB, 0x0099, 0x6E58, 0x0092, 0x6E02, 0x008C, 0x6DAB, 0x0086, 0x6D61, 0x0080, 0x6D19, 0x007A, 0x6CD0, 0x0075, 0x6C85, 0x0070,
+    0x6C37, 0x006B, 0x6BEB, 0x0066, 0x6BAA, 0x0062, 0x6B69, 0x005D, 0x6B29, 0x0059, 0x6AE8, 0x0055, 0x6AAD, 0x0051, 0x6A77, 0x004D,
+    0x6A43, 0x0049, 0x6A0F, 0x0046, 0x69D8, 0x0043, 0x69A0, 0x0040, 0x6965, 0x003C, 0x6927, 0x0039, 0x68E8, 0x0036, 0x68AF, 0x0034,
+    0x6873, 0x0031, 0x6834, 0x002E, 0x67FC, 0x002B, 0x67C1, 0x0029, 0x6783, 0x0026, 0x6750, 0x0024, 0x6722, 0x0022, 0x66F1, 0x0020,
+    0x66BE, 0x001E, 0x668B, 0x001C, 0x6658, 0x001A, 0x6621, 0x0018, 0x65E3, 0x0016, 0x65A9, 0x0015, 0x6575, 0x0013, 0x6541, 0x0012,
+    0x650F, 0x0010, 0x64DD, 0x000F, 0x64A9, 0x000E, 0x6482, 0x000D, 0x645E, 0x000C, 0x6433, 0x000A, 0x6406, 0x0009, 0x63D8, 0x0009,
+    0x63A5, 0x0008, 0x6376, 0x0007, 0x6348, 0x0006, 0x6326, 0x0005, 0x62FE, 0x0005, 0x62D8, 0x0004, 0x62A7, 0x0003, 0x627B, 0x0003,
+    // roughness row 118
+    0x91FF, 0x05C8, 0x9166, 0x05A5, 0x90CB, 0x0582, 0x902F, 0x055F, 0x8F90, 0x053C, 0x8EEF, 0x0519, 0x8E4C, 0x04F7, 0x8DA6, 0x04D5,
+    0x8CFE, 0x04B3, 0x8C54, 0x0491, 0x8BA8, 0x0471, 0x8AFA, 0x0451, 0x8A4B, 0x0432, 0x899B, 0x0415, 0x88E9, 0x03F8, 0x8835, 0x03DB,
+    0x8780, 0x03C0, 0x86CD, 0x03A5, 0x861C, 0x038B, 0x8568, 0x0372, 0x84B2, 0x0359, 0x8400, 0x0341, 0x834B, 0x032A, 0x8299, 0x0313,
+    0x81F6, 0x02FD, 0x814F, 0x02E6, 0x80B5, 0x02D0, 0x8041, 0x02BB, 0x7FCB, 0x02A7, 0x7F53, 0x0292, 0x7ED9, 0x027F, 0x7E5E, 0x026C,
+    0x7DE1, 0x0259, 0x7D62, 0x0247, 0x7CE3, 0x0235, 0x7C62, 0x0224, 0x7BDF, 0x0214, 0x7B5C, 0x0203, 0x7ADB, 0x01F4, 0x7A58, 0x01E4,
+    0x79D5, 0x01D5, 0x7954, 0x01C6, 0x78E2, 0x01B8, 0x7871, 0x01AA, 0x77FD, 0x019D, 0x778A, 0x0190, 0x7725, 0x0183, 0x76BE, 0x0176,
+    0x7655, 0x016A, 0x75E9, 0x015D, 0x757B, 0x0151, 0x750B, 0x0146, 0x74A3, 0x013B, 0x743D, 0x0130, 0x73D6, 0x0125, 0x736E, 0x011A,
+    0x730E, 0x0110, 0x72B5, 0x0106, 0x7262, 0x00FD, 0x720D, 0x00F3, 0x71B7, 0x00EA, 0x715E, 0x00E2, 0x7107, 0x00D9, 0x70AE, 0x00D2,
+    0x7056, 0x00CB, 0x7000, 0x00C3, 0x6FA9, 0x00BC, 0x6F4E, 0x00B6, 0x6EF8, 0x00AF, 0x6EA4, 0x00A8, 0x6E51, 0x00A2, 0x6DFC, 0x009B,
+    0x6DA4, 0x0095, 0x6D49, 0x008F, 0x6CEE, 0x0089, 0x6C9F, 0x0083, 0x6C4E, 0x007D, 0x6C00, 0x0077, 0x6BAF, 0x0072, 0x6B5D, 0x006D,
+    0x6B0D, 0x0069, 0x6AC5, 0x0064, 0x6A7D, 0x005F, 0x6A38, 0x005B, 0x69F2, 0x0057, 0x69B2, 0x0053, 0x6973, 0x004F, 0x6937, 0x004B,
+    0x68FB, 0x0047, 0x68BE, 0x0044, 0x6882, 0x0041, 0x6842, 0x003E, 0x67FF, 0x003B, 0x67BB, 0x0038, 0x677D, 0x0035, 0x673D, 0x0032,
+    0x66F9, 0x0030, 0x66BF, 0x002D, 0x6683, 0x002B, 0x6643, 0x0028, 0x660D, 0x0026, 0x65D6, 0x0023, 0x659C, 0x0021, 0x6562, 0x001F,
+    0x652A, 0x001D, 0x64F2, 0x001B, 0x64B6, 0x0019, 0x6477, 0x0018, 0x6439, 0x0016, 0x63FC, 0x0014, 0x63C0, 0x0013, 0x638C, 0x0011,
+    0x6352, 0x0010, 0x6317, 0x000F, 0x62EB, 0x000E, 0x62C5, 0x000C, 0x6297, 0x000B, 0x6264, 0x000A, 0x622D, 0x0009, 0x61F4, 0x0008,
+    0x61C5, 0x0008, 0x6196, 0x0007, 0x6167, 0x0006, 0x6139, 0x0005, 0x6108, 0x0004, 0x60D9, 0x0004, 0x60A5, 0x0003, 0x6075, 0x0003,
+    // roughness row 119
+    0x929B, 0x05B1, 0x91FC, 0x058E, 0x915C, 0x056B, 0x90B9, 0x0548, 0x9014, 0x0526, 0x8F6C, 0x0503, 0x8EC3, 0x04E1, 0x8E16, 0x04BF,
+    0x8D68, 0x049D, 0x8CB7, 0x047C, 0x8C04, 0x045C, 0x8B4F, 0x043C, 0x8A99, 0x041E, 0x89E2, 0x0401, 0x8929, 0x03E4, 0x886E, 0x03C8,
+    0x87B1, 0x03AD, 0x86F9, 0x0393, 0x8641, 0x0379, 0x8585, 0x0360, 0x84C9, 0x0348, 0x840F, 0x0330, 0x8353, 0x0319, 0x82A1, 0x0302,
+    0x81F5, 0x02EC, 0x8147, 0x02D6, 0x80BC, 0x02C1, 0x8041, 0x02AC, 0x7FC3, 0x0297, 0x7F43, 0x0283, 0x7EC2, 0x0270, 0x7E40, 0x025D,
+    0x7DBB, 0x024B, 0x7D36, 0x0239, 0x7CAF, 0x0228, 0x7C25, 0x0217, 0x7B9A, 0x0207, 0x7B13, 0x01F7, 0x7A89, 0x01E7, 0x79FF, 0x01D8,
+    0x7977, 0x01C9, 0x78F8, 0x01BB, 0x7881, 0x01AD, 0x7806, 0x01A0, 0x778A, 0x0193, 0x771D, 0x0186, 0x76B1, 0x0179, 0x7641, 0x016C,
+    0x75D0, 0x0160, 0x755C, 0x0155, 0x74E5, 0x0149, 0x7475, 0x013D, 0x740A, 0x0133, 0x739E, 0x0128, 0x732F, 0x011E, 0x72C7, 0x0113,
+    0x7267, 0x0109, 0x720E, 0x0100, 0x71B4, 0x00F6, 0x7156, 0x00ED, 0x70F7, 0x00E4, 0x7098, 0x00DC, 0x7038, 0x00D3, 0x6FD8, 0x00CC,
+    0x6F7C, 0x00C5, 0x6F1E, 0x00BE, 0x6EBE, 0x00B7, 0x6E62, 0x00B0, 0x6E08, 0x00AA, 0x6DAF, 0x00A3, 0x6D54, 0x009D, 0x6CF7, 0x0097,
+    0x6C96, 0x0091, 0x6C38, 0x008B, 0x6BE5, 0x0085, 0x6B92, 0x0080, 0x6B3D, 0x007A, 0x6AE5, 0x0075, 0x6A8B, 0x006F, 0x6A37, 0x006B,
+    0x69EA, 0x0066, 0x699C, 0x0061, 0x6952, 0x005D, 0x6905, 0x0059, 0x68C1, 0x0055, 0x6881, 0x0051, 0x6840, 0x004D, 0x67FB, 0x0049,
+    0x67B6, 0x0045, 0x6770, 0x0042, 0x6729, 0x003F, 0x66DE, 0x003C, 0x6699, 0x0039, 0x6657, 0x0036, 0x6610, 0x0034, 0x65C6, 0x0031,
+    0x6589, 0x002E, 0x6549, 0x002C, 0x6506, 0x002A, 0x64CF, 0x0027, 0x6495, 0x0025, 0x6455, 0x0023, 0x6413, 0x0020, 0x63D2, 0x001E,
+    0x6396, 0x001C, 0x6357, 0x001B, 0x6313, 0x0019, 0x62D1, 0x0017, 0x6293, 0x0016, 0x6252, 0x0014, 0x6214, 0x0012, 0x61D3, 0x0011,
+    0x6196, 0x0010, 0x6163, 0x000F, 0x6136, 0x000D, 0x6108, 0x000C, 0x60D4, 0x000B, 0x6095, 0x000A, 0x6057, 0x0009, 0x601C, 0x0008,
+    0x5FE5, 0x0007, 0x5FBA, 0x0007, 0x5F8D, 0x0006, 0x5F53, 0x0005, 0x5F17, 0x0004, 0x5EDD, 0x0004, 0x5EAE, 0x0003, 0x5E7D, 0x0003,
+    // roughness row 120
+    0x932F, 0x059A, 0x928B, 0x0578, 0x91E4, 0x0555, 0x913B, 0x0532, 0x9090, 0x0510, 0x8FE2, 0x04EE, 0x8F32, 0x04CB, 0x8E7F, 0x04AA,
+    0x8DCA, 0x0488, 0x8D12, 0x0467, 0x8C59, 0x0447, 0x8B9D, 0x0428, 0x8AE0, 0x040A, 0x8A22, 0x03EE, 0x8962, 0x03D1, 0x889F, 0x03B5,
+    0x87DD, 0x039B, 0x871F, 0x0381, 0x865E, 0x0368, 0x859B, 0x034F, 0x84DA, 0x0337, 0x8418, 0x0320, 0x8353, 0x0308, 0x82A2, 0x02F2,
+    0x81EE, 0x02DC, 0x813E, 0x02C6, 0x80BD, 0x02B1, 0x803A, 0x029C, 0x7FB4, 0x0288, 0x7F2D, 0x0275, 0x7EA5, 0x0262, 0x7E1B, 0x024F,
+    0x7D8F, 0x023E, 0x7D02, 0x022C, 0x7C73, 0x021B, 0x7BE1, 0x020B, 0x7B52, 0x01FB, 0x7AC3, 0x01EB, 0x7A31, 0x01DB, 0x79A2, 0x01CD,
+    0x7917, 0x01BE, 0x7899, 0x01B0, 0x7818, 0x01A2, 0x7795, 0x0195, 0x771D, 0x0188, 0x76AB, 0x017C, 0x7636, 0x016F, 0x75BE, 0x0163,
+    0x7544, 0x0157, 0x74C8, 0x014C, 0x744F, 0x0140, 0x73DF, 0x0135, 0x736D, 0x012B, 0x72F8, 0x0121, 0x7289, 0x0116, 0x7223, 0x010C,
+    0x71C3, 0x0103, 0x7162, 0x00F9, 0x70FF, 0x00F0, 0x709C, 0x00E7, 0x7037, 0x00DE, 0x6FCF, 0x00D6, 0x6F68, 0x00CE, 0x6F03, 0x00C6,
+    0x6E9D, 0x00BF, 0x6E37, 0x00B8, 0x6DD4, 0x00B2, 0x6D74, 0x00AB, 0x6D17, 0x00A5, 0x6CB6, 0x009F, 0x6C52, 0x0099, 0x6BED, 0x0093,
+    0x6B8A, 0x008D, 0x6B33, 0x0088, 0x6ADC, 0x0082, 0x6A82, 0x007C, 0x6A25, 0x0077, 0x69C6, 0x0072, 0x696D, 0x006D, 0x6919, 0x0068,
+    0x68C5, 0x0063, 0x6876, 0x005F, 0x6823, 0x005B, 0x67DC, 0x0057, 0x6796, 0x0053, 0x6750, 0x004F, 0x6708, 0x004B, 0x66BF, 0x0047,
+    0x6671, 0x0044, 0x661F, 0x0040, 0x65CE, 0x003D, 0x6583, 0x003A, 0x6539, 0x0037, 0x64ED, 0x0035, 0x64A0, 0x0032, 0x645D, 0x0030,
+    0x6416, 0x002D, 0x63D0, 0x002B, 0x6395, 0x0029, 0x6357, 0x0026, 0x6315, 0x0024, 0x62D0, 0x0022, 0x628C, 0x0020, 0x6248, 0x001E,
+    0x6200, 0x001C, 0x61B8, 0x001A, 0x6171, 0x0018, 0x612E, 0x0017, 0x60EA, 0x0015, 0x60AB, 0x0014, 0x6068, 0x0012, 0x6024, 0x0011,
+    0x5FEA, 0x000F, 0x5FB8, 0x000E, 0x5F83, 0x000D, 0x5F48, 0x000C, 0x5F09, 0x000B, 0x5ECC, 0x000A, 0x5E87, 0x0009, 0x5E46, 0x0008,
+    0x5E15, 0x0007, 0x5DE4, 0x0007, 0x5DB0, 0x0006, 0x5D71, 0x0005, 0x5D2D, 0x0004, 0x5CEC, 0x0004, 0x5CC3, 0x0003, 0x5C8E, 0x0003,
+    // roughness row 121
+    0x93BD, 0x0584, 0x9313, 0x0561, 0x9266, 0x053F, 0x91B7, 0x051D, 0x9105, 0x04FA, 0x9051, 0x04D8, 0x8F9A, 0x04B6, 0x8EE1, 0x0495,
+    0x8E25, 0x0473, 0x8D67, 0x0453, 0x8CA6, 0x0433, 0x8BE3, 0x0414, 0x8B20, 0x03F7, 0x8A5B, 0x03DB, 0x8993, 0x03BE, 0x88CA, 0x03A3,
+    0x8802, 0x0389, 0x873D, 0x036F, 0x8675, 0x0356, 0x85AA, 0x033E, 0x84E3, 0x0326, 0x841A, 0x030F, 0x8355, 0x02F8, 0x829C, 0x02E2,
+    0x81E1, 0x02CC, 0x8140, 0x02B7, 0x80B7, 0x02A2, 0x802C, 0x028E, 0x7F9F, 0x027A, 0x7F11, 0x0266, 0x7E81, 0x0254, 0x7DEF, 0x0242,
+    0x7D5D, 0x0230, 0x7CC8, 0x021F, 0x7C31, 0x020F, 0x7B99, 0x01FF, 0x7B04, 0x01EF, 0x7A6C, 0x01DF, 0x79D5, 0x01D0, 0x7940, 0x01C1,
+    0x78B9, 0x01B3, 0x7833, 0x01A5, 0x77A9, 0x0197, 0x7724, 0x018A, 0x76AC, 0x017E, 0x7632, 0x0172, 0x75B4, 0x0166, 0x7534, 0x015A,
+    0x74B3, 0x014E, 0x7432, 0x0143, 0x73BC, 0x0138, 0x7345, 0x012E, 0x72CA, 0x0123, 0x7252, 0x0119, 0x71E7, 0x010F, 0x7180, 0x0106,
+    0x711A, 0x00FC, 0x70B1, 0x00F3, 0x7048, 0x00EA, 0x6FDD, 0x00E1, 0x6F70, 0x00D9, 0x6F02, 0x00D1, 0x6E97, 0x00C9, 0x6E2B, 0x00C1,
+    0x6DBB, 0x00BA, 0x6D4F, 0x00B3, 0x6CEA, 0x00AC, 0x6C86, 0x00A6, 0x6C20, 0x00A0, 0x6BB9, 0x009A, 0x6B50, 0x0095, 0x6AE7, 0x008F,
+    0x6A8B, 0x008A, 0x6A2F, 0x0084, 0x69CF, 0x007F, 0x696D, 0x0079, 0x6909, 0x0074, 0x68AC, 0x006F, 0x6853, 0x006A, 0x67F8, 0x0066,
+    0x67A2, 0x0061, 0x674B, 0x005D, 0x6701, 0x0059, 0x66B7, 0x0055, 0x666A, 0x0051, 0x661C, 0x004D, 0x65CD, 0x0049, 0x657A, 0x0046,
+    0x6526, 0x0042, 0x64D2, 0x003F, 0x647D, 0x003C, 0x6429, 0x0039, 0x63D5, 0x0036, 0x6383, 0x0033, 0x633A, 0x0031, 0x62EF, 0x002E,
+    0x62A4, 0x002C, 0x6264, 0x002A, 0x6222, 0x0028, 0x61DC, 0x0025, 0x6194, 0x0023, 0x614D, 0x0021, 0x6106, 0x001F, 0x60B8, 0x001D,
+    0x606A, 0x001B, 0x6019, 0x0019, 0x5FD1, 0x0018, 0x5F8B, 0x0016, 0x5F49, 0x0015, 0x5F05, 0x0013, 0x5EC0, 0x0012, 0x5E82, 0x0011,
+    0x5E48, 0x000F, 0x5E0D, 0x000E, 0x5DCD, 0x000D, 0x5D88, 0x000C, 0x5D42, 0x000B, 0x5CFD, 0x000A, 0x5CBF, 0x0009, 0x5C84, 0x0008,
+    0x5C46, 0x0007, 0x5C0C, 0x0006, 0x5BCF, 0x0006, 0x5B8F, 0x0005, 0x5B4F, 0x0004, 0x5B15, 0x0004, 0x5ADC, 0x0003, 0x5AA4, 0x0003,
+    // roughness row 122
+    0x9443, 0x056E, 0x9393, 0x054C, 0x92E0, 0x0529, 0x922B, 0x0507, 0x9173, 0x04E5, 0x90B9, 0x04C3, 0x8FFB, 0x04A2, 0x8F3C, 0x0480,
+    0x8E79, 0x045F, 0x8DB4, 0x043F, 0x8CED, 0x0420, 0x8C23, 0x0401, 0x8B5A, 0x03E4, 0x8A8D, 0x03C8, 0x89BF, 0x03AC, 0x88EE, 0x0391,
+    0x8822, 0x0377, 0x8755, 0x035E, 0x8685, 0x0345, 0x85B5, 0x032D, 0x84E6, 0x0316, 0x8415, 0x02FF, 0x8351, 0x02E9, 0x8290, 0x02D2,
+    0x81CD, 0x02BD, 0x813B, 0x02A8, 0x80AB, 0x0293, 0x8018, 0x027F, 0x7F84, 0x026B, 0x7EEF, 0x0259, 0x7E57, 0x0246, 0x7DBF, 0x0235,
+    0x7D24, 0x0224, 0x7C87, 0x0213, 0x7BE8, 0x0202, 0x7B4D, 0x01F2, 0x7AAF, 0x01E3, 0x7A10, 0x01D3, 0x7975, 0x01C4, 0x78E1, 0x01B6,
+    0x7855, 0x01A8, 0x77C6, 0x019A, 0x7734, 0x018D, 0x76B6, 0x0180, 0x7635, 0x0174, 0x75B2, 0x0168, 0x752D, 0x015C, 0x74A6, 0x0151,
+    0x741E, 0x0146, 0x73A1, 0x013B, 0x7324, 0x0130, 0x72A4, 0x0126, 0x7226, 0x011C, 0x71B1, 0x0112, 0x7144, 0x0109, 0x70D9, 0x00FF,
+    0x706B, 0x00F6, 0x6FFD, 0x00ED, 0x6F8C, 0x00E4, 0x6F19, 0x00DC, 0x6EA5, 0x00D4, 0x6E36, 0x00CC, 0x6DC3, 0x00C4, 0x6D4D, 0x00BC,
+    0x6CDA, 0x00B5, 0x6C6C, 0x00AE, 0x6C00, 0x00A7, 0x6B94, 0x00A1, 0x6B28, 0x009C, 0x6AB9, 0x0096, 0x6A4A, 0x0091, 0x69EA, 0x008B,
+    0x6989, 0x0086, 0x6924, 0x0081, 0x68BD, 0x007C, 0x6856, 0x0076, 0x67F2, 0x0071, 0x6794, 0x006C, 0x6734, 0x0068, 0x66D8, 0x0063,
+    0x667D, 0x005F, 0x662E, 0x005A, 0x65DE, 0x0056, 0x658E, 0x0052, 0x653C, 0x004F, 0x64E6, 0x004B, 0x648E, 0x0047, 0x6435, 0x0044,
+    0x63DB, 0x0041, 0x6382, 0x003D, 0x632B, 0x003A, 0x62D0, 0x0037, 0x6275, 0x0034, 0x6224, 0x0032, 0x61D1, 0x002F, 0x6183, 0x002D,
+    0x613F, 0x002B, 0x60F7, 0x0029, 0x60AA, 0x0026, 0x605F, 0x0024, 0x6015, 0x0022, 0x5FCA, 0x0020, 0x5F7A, 0x001E, 0x5F28, 0x001D,
+    0x5ED2, 0x001B, 0x5E83, 0x0019, 0x5E36, 0x0017, 0x5DF0, 0x0016, 0x5DAA, 0x0014, 0x5D60, 0x0013, 0x5D1E, 0x0011, 0x5CE6, 0x0010,
+    0x5CA7, 0x000F, 0x5C5F, 0x000E, 0x5C14, 0x000D, 0x5BCA, 0x000C, 0x5B7B, 0x000B, 0x5B3A, 0x000A, 0x5AFE, 0x0009, 0x5AC1, 0x0008,
+    0x5A7E, 0x0007, 0x5A37, 0x0006, 0x59F3, 0x0006, 0x59BA, 0x0005, 0x597C, 0x0004, 0x5943, 0x0004, 0x58FE, 0x0003, 0x58BE, 0x0003,
+    // roughness row 123
+    0x94C2, 0x0559, 0x940C, 0x0536, 0x9353, 0x0514, 0x9298, 0x04F2, 0x91DA, 0x04D0, 0x9119, 0x04AF, 0x9056, 0x048D, 0x8F8F, 0x046C,
+    0x8EC6, 0x044B, 0x8DFA, 0x042B, 0x8D2C, 0x040C, 0x8C5C, 0x03EF, 0x8B8C, 0x03D2, 0x8AB8, 0x03B6, 0x89E3, 0x039B, 0x890B, 0x0380,
+    0x883A, 0x0366, 0x8766, 0x034D, 0x868F, 0x0335, 0x85B9, 0x031D, 0x84E3, 0x0306, 0x840B, 0x02EF, 0x8346, 0x02D9, 0x827D, 0x02C3,
+    0x81C4, 0x02AE, 0x812F, 0x0299, 0x8098, 0x0285, 0x7FFE, 0x0271, 0x7F63, 0x025E, 0x7EC6, 0x024B, 0x7E27, 0x0239, 0x7D88, 0x0228,
+    0x7CE5, 0x0217, 0x7C40, 0x0206, 0x7B9C, 0x01F6, 0x7AFA, 0x01E6, 0x7A54, 0x01D7, 0x79B1, 0x01C8, 0x7911, 0x01B9, 0x787F, 0x01AB,
+    0x77EA, 0x019D, 0x7752, 0x0190, 0x76C8, 0x0183, 0x7641, 0x0176, 0x75B8, 0x016A, 0x752C, 0x015E, 0x74A0, 0x0153, 0x7413, 0x0148,
+    0x738E, 0x013D, 0x730B, 0x0133, 0x7285, 0x0128, 0x7201, 0x011E, 0x7184, 0x0115, 0x710F, 0x010B, 0x709E, 0x0102, 0x702B, 0x00F9,
+    0x6FB9, 0x00F0, 0x6F44, 0x00E7, 0x6ECC, 0x00DF, 0x6E52, 0x00D6, 0x6DDC, 0x00CE, 0x6D64, 0x00C7, 0x6CE9, 0x00BF, 0x6C6E, 0x00B8,
+    0x6BFA, 0x00B0, 0x6B88, 0x00AA, 0x6B16, 0x00A3, 0x6AA1, 0x009D, 0x6A2B, 0x0097, 0x69B5, 0x0092, 0x6950, 0x008C, 0x68EA, 0x0087,
+    0x6880, 0x0082, 0x6813, 0x007D, 0x67A8, 0x0078, 0x6740, 0x0073, 0x66DD, 0x006F, 0x6679, 0x006A, 0x6618, 0x0065, 0x65BA, 0x0061,
+    0x6565, 0x005C, 0x650F, 0x0058, 0x64BA, 0x0054, 0x6461, 0x0050, 0x6408, 0x004D, 0x63AC, 0x0049, 0x634F, 0x0046, 0x62EE, 0x0042,
+    0x6291, 0x003F, 0x6235, 0x003C, 0x61D6, 0x0039, 0x6178, 0x0036, 0x6121, 0x0033, 0x60C5, 0x0030, 0x6071, 0x002E, 0x6024, 0x002C,
+    0x5FD5, 0x0029, 0x5F83, 0x0027, 0x5F31, 0x0025, 0x5EE1, 0x0023, 0x5E92, 0x0021, 0x5E41, 0x0020, 0x5DED, 0x001E, 0x5D96, 0x001C,
+    0x5D45, 0x001A, 0x5CF5, 0x0018, 0x5CA7, 0x0017, 0x5C57, 0x0015, 0x5C07, 0x0014, 0x5BC4, 0x0012, 0x5B87, 0x0011, 0x5B44, 0x0010,
+    0x5AFF, 0x000F, 0x5AB2, 0x000D, 0x5A5E, 0x000C, 0x5A0C, 0x000B, 0x59C5, 0x000A, 0x5980, 0x0009, 0x5941, 0x0009, 0x5902, 0x0008,
+    0x58BE, 0x0007, 0x5873, 0x0006, 0x5829, 0x0005, 0x57E6, 0x0005, 0x57B1, 0x0004, 0x5774, 0x0004, 0x572F, 0x0003, 0x56EC, 0x0003,
+    // roughness row 124
+    0x9539, 0x0543, 0x947D, 0x0521, 0x93BF, 0x04FF, 0x92FE, 0x04DE, 0x9239, 0x04BC, 0x9172, 0x049A, 0x90A9, 0x0479, 0x8FDC, 0x0458,
+    0x8F0C, 0x0438, 0x8E3A, 0x0418, 0x8D65, 0x03FA, 0x8C8F, 0x03DC, 0x8BB7, 0x03C0, 0x8ADD, 0x03A4, 0x8A01, 0x0389, 0x8924, 0x036F,
+    0x884C, 0x0356, 0x8770, 0x033D, 0x8692, 0x0325, 0x85B6, 0x030D, 0x84D9, 0x02F6, 0x8401, 0x02E0, 0x8334, 0x02CA, 0x8264, 0x02B4,
+    0x81B9, 0x02A0, 0x811D, 0x028B, 0x807E, 0x0277, 0x7FDD, 0x0264, 0x7F3B, 0x0251, 0x7E97, 0x023E, 0x7DF1, 0x022C, 0x7D4A, 0x021B,
+    0x7CA0, 0x020B, 0x7BF3, 0x01FA, 0x7B4B, 0x01EA, 0x7AA0, 0x01DB, 0x79F5, 0x01CC, 0x794E, 0x01BD, 0x78B0, 0x01AF, 0x7816, 0x01A1,
+    0x7779, 0x0193, 0x76E1, 0x0186, 0x7655, 0x0179, 0x75C7, 0x016D, 0x7535, 0x0161, 0x74A3, 0x0155, 0x740F, 0x014A, 0x7381, 0x013F,
+    0x72F9, 0x0135, 0x726E, 0x012B, 0x71E4, 0x0121, 0x715E, 0x0117, 0x70E1, 0x010D, 0x706C, 0x0104, 0x6FF4, 0x00FB, 0x6F7C, 0x00F2,
+    0x6F02, 0x00EA, 0x6E85, 0x00E2, 0x6E06, 0x00D9, 0x6D8B, 0x00D1, 0x6D0C, 0x00C9, 0x6C8B, 0x00C2, 0x6C0B, 0x00BA, 0x6B93, 0x00B3,
+    0x6B1C, 0x00AC, 0x6AA3, 0x00A5, 0x6A28, 0x009F, 0x69AA, 0x0099, 0x692C, 0x0093, 0x68C0, 0x008D, 0x6853, 0x0088, 0x67E3, 0x0083,
+    0x6770, 0x007E, 0x6702, 0x0079, 0x6695, 0x0075, 0x662C, 0x0070, 0x65C4, 0x006B, 0x6560, 0x0067, 0x64FD, 0x0062, 0x64A5, 0x005E,
+    0x644B, 0x005A, 0x63F0, 0x0056, 0x6393, 0x0052, 0x6334, 0x004E, 0x62D1, 0x004A, 0x6270, 0x0047, 0x620C, 0x0044, 0x61AA, 0x0041,
+    0x6149, 0x003D, 0x60E4, 0x003A, 0x6083, 0x0038, 0x6028, 0x0035, 0x5FC8, 0x0032, 0x5F6E, 0x002F, 0x5F19, 0x002D, 0x5EC2, 0x002A,
+    0x5E67, 0x0028, 0x5E0E, 0x0026, 0x5DBB, 0x0024, 0x5D64, 0x0022, 0x5D0E, 0x0020, 0x5CB7, 0x001F, 0x5C5F, 0x001D, 0x5C0D, 0x001B,
+    0x5BBB, 0x001A, 0x5B6B, 0x0018, 0x5B18, 0x0016, 0x5AC2, 0x0015, 0x5A74, 0x0013, 0x5A32, 0x0012, 0x59EE, 0x0011, 0x59A4, 0x000F,
+    0x5954, 0x000E, 0x5903, 0x000D, 0x58B0, 0x000C, 0x5860, 0x000B, 0x5813, 0x000A, 0x57D1, 0x0009, 0x578C, 0x0008, 0x5749, 0x0008,
+    0x56FF, 0x0007, 0x56B0, 0x0006, 0x5669, 0x0005, 0x561F, 0x0005, 0x55E8, 0x0004, 0x55A7, 0x0004, 0x5562, 0x0003, 0x551C, 0x0003,
+    // roughness row 125
+    0x95A9, 0x052F, 0x94E8, 0x050D, 0x9424, 0x04EB, 0x935C, 0x04C9, 0x9292, 0x04A8, 0x91C5, 0x0487, 0x90F5, 0x0465, 0x9021, 0x0445,
+    0x8F4B, 0x0424, 0x8E72, 0x0405, 0x8D97, 0x03E7, 0x8CBB, 0x03CA, 0x8BDC, 0x03AE, 0x8AFB, 0x0393, 0x8A18, 0x0378, 0x8936, 0x035E,
+    0x8857, 0x0345, 0x8774, 0x032D, 0x8690, 0x0315, 0x85AD, 0x02FE, 0x84C8, 0x02E7, 0x83F1, 0x02D1, 0x831C, 0x02BB, 0x8248, 0x02A6,
+    0x81A8, 0x0291, 0x8104, 0x027D, 0x805E, 0x0269, 0x7FB7, 0x0256, 0x7F0E, 0x0244, 0x7E62, 0x0232, 0x7DB6, 0x0220, 0x7D06, 0x020F,
+    0x7C54, 0x01FF, 0x7BA4, 0x01EE, 0x7AF4, 0x01DF, 0x7A41, 0x01CF, 0x7993, 0x01C1, 0x78E9, 0x01B3, 0x784A, 0x01A5, 0x77A8, 0x0197,
+    0x7703, 0x0189, 0x7671, 0x017C, 0x75DD, 0x0170, 0x7546, 0x0164, 0x74AE, 0x0158, 0x7415, 0x014C, 0x737D, 0x0141, 0x72EF, 0x0137,
+    0x725F, 0x012D, 0x71CE, 0x0123, 0x7140, 0x0119, 0x70BD, 0x0110, 0x7041, 0x0107, 0x6FC5, 0x00FE, 0x6F48, 0x00F5, 0x6EC8, 0x00EC,
+    0x6E45, 0x00E4, 0x6DC0, 0x00DC, 0x6D40, 0x00D4, 0x6CBD, 0x00CC, 0x6C37, 0x00C4, 0x6BAF, 0x00BD, 0x6B31, 0x00B6, 0x6AB7, 0x00AF,
+    0x6A39, 0x00A8, 0x69B8, 0x00A1, 0x6934, 0x009B, 0x68B0, 0x0095, 0x683D, 0x008F, 0x67C8, 0x0089, 0x6750, 0x0084, 0x66D7, 0x007F,
+    0x6664, 0x007A, 0x65F0, 0x0076, 0x6582, 0x0071, 0x6517, 0x006D, 0x64AE, 0x0068, 0x6448, 0x0064, 0x63EC, 0x0060, 0x638F, 0x005C,
+    0x6330, 0x0058, 0x62CE, 0x0054, 0x6268, 0x0050, 0x6201, 0x004C, 0x619A, 0x0048, 0x6131, 0x0045, 0x60CC, 0x0042, 0x6068, 0x003F,
+    0x5FFE, 0x003C, 0x5F98, 0x0039, 0x5F35, 0x0036, 0x5ED2, 0x0033, 0x5E76, 0x0031, 0x5E1C, 0x002E, 0x5DBE, 0x002C, 0x5D5C, 0x0029,
+    0x5CFC, 0x0027, 0x5CA0, 0x0025, 0x5C45, 0x0023, 0x5BEA, 0x0021, 0x5B8C, 0x001F, 0x5B2D, 0x001D, 0x5AD9, 0x001C, 0x5A86, 0x001A,
+    0x5A36, 0x0019, 0x59E1, 0x0017, 0x598A, 0x0016, 0x593A, 0x0014, 0x58F1, 0x0013, 0x58A4, 0x0011, 0x5854, 0x0010, 0x5804, 0x000F,
+    0x57AD, 0x000E, 0x5759, 0x000D, 0x5706, 0x000C, 0x56B9, 0x000B, 0x5672, 0x000A, 0x5625, 0x0009, 0x55DB, 0x0008, 0x558F, 0x0007,
+    0x5545, 0x0007, 0x54FF, 0x0006, 0x54AF, 0x0005, 0x5467, 0x0005, 0x5420, 0x0004, 0x53DE, 0x0004, 0x5395, 0x0003, 0x5348, 0x0002,
+    // roughness row 126
+    0x9613, 0x051A, 0x954C, 0x04F9, 0x9481, 0x04D7, 0x93B4, 0x04B6, 0x92E4, 0x0494, 0x9210, 0x0473, 0x913A, 0x0452, 0x9060, 0x0432,
+    0x8F83, 0x0412, 0x8EA4, 0x03F3, 0x8DC2, 0x03D5, 0x8CDF, 0x03B9, 0x8BFA, 0x039D, 0x8B12, 0x0381, 0x8A28, 0x0367, 0x8942, 0x034E,
+    0x885B, 0x0335, 0x8771, 0x031D, 0x8688, 0x0305, 0x859E, 0x02EE, 0x84B3, 0x02D8, 0x83DA, 0x02C2, 0x82FE, 0x02AD, 0x8238, 0x0298,
+    0x8190, 0x0283, 0x80E4, 0x026F, 0x8038, 0x025C, 0x7F8A, 0x024A, 0x7EDA, 0x0237, 0x7E28, 0x0226, 0x7D74, 0x0214, 0x7CBC, 0x0203,
+    0x7C03, 0x01F3, 0x7B4E, 0x01E3, 0x7A96, 0x01D4, 0x79E0, 0x01C5, 0x792C, 0x01B6, 0x7884, 0x01A8, 0x77DD, 0x019B, 0x7733, 0x018D,
+    0x7694, 0x0180, 0x75FA, 0x0173, 0x755E, 0x0167, 0x74C1, 0x015B, 0x7423, 0x014F, 0x7383, 0x0144, 0x72EE, 0x0139, 0x7258, 0x012F,
+    0x71C1, 0x0125, 0x712D, 0x011C, 0x70A1, 0x0112, 0x701F, 0x0109, 0x6F9D, 0x0100, 0x6F1B, 0x00F7, 0x6E96, 0x00EF, 0x6E0E, 0x00E6,
+    0x6D83, 0x00DE, 0x6CFC, 0x00D6, 0x6C74, 0x00CF, 0x6BEA, 0x00C7, 0x6B5D, 0x00C0, 0x6ADA, 0x00B8, 0x6A59, 0x00B1, 0x69D6, 0x00AA,
+    0x6951, 0x00A4, 0x68C8, 0x009E, 0x683E, 0x0097, 0x67C4, 0x0091, 0x6749, 0x008B, 0x66CB, 0x0086, 0x664A, 0x0080, 0x65D0, 0x007B,
+    0x6557, 0x0077, 0x64E4, 0x0072, 0x6473, 0x006E, 0x6404, 0x0069, 0x639A, 0x0065, 0x633A, 0x0061, 0x62DA, 0x005D, 0x6276, 0x0059,
+    0x6210, 0x0055, 0x61A5, 0x0051, 0x613C, 0x004E, 0x60D1, 0x004A, 0x6062, 0x0047, 0x5FF7, 0x0043, 0x5F8B, 0x0040, 0x5F1D, 0x003D,
+    0x5EB4, 0x003A, 0x5E4E, 0x0038, 0x5DE6, 0x0035, 0x5D84, 0x0032, 0x5D26, 0x002F, 0x5CC5, 0x002D, 0x5C5F, 0x002B, 0x5BFA, 0x0028,
+    0x5B99, 0x0026, 0x5B38, 0x0024, 0x5AD6, 0x0022, 0x5A70, 0x0020, 0x5A0D, 0x001E, 0x59B5, 0x001D, 0x5959, 0x001B, 0x5905, 0x0019,
+    0x58AE, 0x0018, 0x5857, 0x0017, 0x5805, 0x0015, 0x57BA, 0x0014, 0x576A, 0x0012, 0x5716, 0x0011, 0x56BD, 0x0010, 0x5661, 0x000F,
+    0x560D, 0x000E, 0x55B8, 0x000D, 0x5568, 0x000C, 0x5520, 0x000B, 0x54D1, 0x000A, 0x5482, 0x0009, 0x5430, 0x0008, 0x53DC, 0x0007,
+    0x5391, 0x0007, 0x5347, 0x0006, 0x52FA, 0x0005, 0x52B1, 0x0005, 0x5264, 0x0004, 0x5215, 0x0003, 0x51CC, 0x0003, 0x5185, 0x0002,
+    // roughness row 127
+    0x9675, 0x0506, 0x95A8, 0x04E5, 0x94D8, 0x04C3, 0x9405, 0x04A2, 0x932F, 0x0481, 0x9255, 0x0460, 0x9178, 0x043F, 0x9098, 0x041F,
+    0x8FB5, 0x03FF, 0x8ECF, 0x03E1, 0x8DE7, 0x03C3, 0x8CFE, 0x03A7, 0x8C12, 0x038C, 0x8B23, 0x0371, 0x8A32, 0x0357, 0x8947, 0x033E,
+    0x8859, 0x0325, 0x8768, 0x030D, 0x8679, 0x02F6, 0x8588, 0x02DF, 0x849D, 0x02C9, 0x83BC, 0x02B3, 0x82D9, 0x029E, 0x8220, 0x028A,
+    0x8171, 0x0276, 0x80BF, 0x0262, 0x800C, 0x024F, 0x7F57, 0x023D, 0x7EA0, 0x022B, 0x7DE7, 0x021A, 0x7D2B, 0x0209, 0x7C6C, 0x01F8,
+    0x7BB0, 0x01E8, 0x7AF3, 0x01D8, 0x7A34, 0x01C9, 0x797B, 0x01BA, 0x78C5, 0x01AC, 0x7819, 0x019E, 0x776A, 0x0191, 0x76BE, 0x0184,
+    0x761F, 0x0177, 0x757E, 0x016A, 0x74DC, 0x015E, 0x7439, 0x0152, 0x7393, 0x0147, 0x72F5, 0x013D, 0x725A, 0x0132, 0x71BC, 0x0128,
+    0x7122, 0x011E, 0x708D, 0x0115, 0x7003, 0x010C, 0x6F7C, 0x0103, 0x6EF5, 0x00FA, 0x6E6B, 0x00F1, 0x6DDE, 0x00E9, 0x6D4E, 0x00E1,
+    0x6CC0, 0x00D9, 0x6C34, 0x00D1, 0x6BA5, 0x00C9, 0x6B13, 0x00C2, 0x6A8A, 0x00BB, 0x6A05, 0x00B4, 0x697D, 0x00AD, 0x68F1, 0x00A6,
+    0x6863, 0x00A0, 0x67D5, 0x009A, 0x6755, 0x0094, 0x66D4, 0x008E, 0x6650, 0x0088, 0x65CA, 0x0082, 0x654B, 0x007D, 0x64CA, 0x0078,
+    0x6451, 0x0073, 0x63DA, 0x006F, 0x6366, 0x006B, 0x62F8, 0x0066, 0x6295, 0x0062, 0x622F, 0x005E, 0x61C7, 0x005A, 0x615B, 0x0057,
+    0x60EE, 0x0053, 0x6082, 0x004F, 0x6013, 0x004C, 0x5FA0, 0x0048, 0x5F2F, 0x0045, 0x5EBE, 0x0042, 0x5E49, 0x003E, 0x5DD9, 0x003B,
+    0x5D6E, 0x0039, 0x5D04, 0x0036, 0x5CA0, 0x0033, 0x5C3D, 0x0031, 0x5BD6, 0x002E, 0x5B6E, 0x002C, 0x5B07, 0x002A, 0x5AA3, 0x0027,
+    0x5A3E, 0x0025, 0x59D4, 0x0023, 0x5968, 0x0021, 0x5900, 0x001F, 0x58A0, 0x001D, 0x583E, 0x001C, 0x57E3, 0x001A, 0x5784, 0x0019,
+    0x572B, 0x0017, 0x56D7, 0x0016, 0x568B, 0x0015, 0x5639, 0x0013, 0x55E3, 0x0012, 0x5588, 0x0011, 0x552B, 0x000F, 0x54CF, 0x000E,
+    0x5475, 0x000D, 0x5422, 0x000C, 0x53D6, 0x000B, 0x5386, 0x000A, 0x5334, 0x0009, 0x52E2, 0x0009, 0x528A, 0x0008, 0x5235, 0x0007,
+    0x51E0, 0x0006, 0x5191, 0x0006, 0x514D, 0x0005, 0x5100, 0x0004, 0x50AB, 0x0004, 0x5056, 0x0003, 0x500E, 0x0003, 0x4FC9, 0x0002,
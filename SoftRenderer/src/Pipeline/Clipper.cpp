@@ -22,24 +22,25 @@ double PlaneValue(const ClipVertex& v, int plane) {
 }
 
 /**
- * @brief 使用单个裁剪平面对多边形进行裁剪
+ * @brief 使用单个裁剪平面对多边形进行裁剪（input 与 output 不能是同一对象）
  */
-std::vector<ClipVertex> ClipPolygonAgainstPlane(const std::vector<ClipVertex>& input, int plane) {
-    std::vector<ClipVertex> output;
+void ClipPolygonAgainstPlane(const ClipPolygon& input, int plane, ClipPolygon& output) {
+    output.count = 0;
     if (input.empty()) {
-        return output;
+        return;
     }
 
-    ClipVertex prev = input.back();
+    ClipVertex prev = input.vertices[input.count - 1];
     double prevValue = PlaneValue(prev, plane);
     bool prevInside = prevValue >= 0.0;
 
-    for (const ClipVertex& curr : input) {
+    for (int i = 0; i < input.count; ++i) {
+        const ClipVertex& curr = input.vertices[i];
         double currValue = PlaneValue(curr, plane);
         bool currInside = currValue >= 0.0;
 
         if (prevInside && currInside) {
-            output.push_back(curr);
+            output.vertices[output.count++] = curr;
         } else if (prevInside && !currInside) {
             double t = prevValue / (prevValue - currValue);
             ClipVertex intersect{};
@@ -50,7 +51,7 @@ std::vector<ClipVertex> ClipPolygonAgainstPlane(const std::vector<ClipVertex>& i
             intersect.texCoord1 = Lerp(prev.texCoord1, curr.texCoord1, t);
             intersect.color = Lerp(prev.color, curr.color, t);
             intersect.tangent = Lerp(prev.tangent, curr.tangent, t);
-            output.push_back(intersect);
+            output.vertices[output.count++] = intersect;
         } else if (!prevInside && currInside) {
             double t = prevValue / (prevValue - currValue);
             ClipVertex intersect{};
@@ -61,34 +62,49 @@ std::vector<ClipVertex> ClipPolygonAgainstPlane(const std::vector<ClipVertex>& i
             intersect.texCoord1 = Lerp(prev.texCoord1, curr.texCoord1, t);
             intersect.color = Lerp(prev.color, curr.color, t);
             intersect.tangent = Lerp(prev.tangent, curr.tangent, t);
-            output.push_back(intersect);
-            output.push_back(curr);
+            output.vertices[output.count++] = intersect;
+            output.vertices[output.count++] = curr;
         }
 
         prev = curr;
         prevValue = currValue;
         prevInside = currInside;
     }
-
-    return output;
 }
 
 } // namespace
 
 /**
  * @brief 对三角形进行视锥体裁剪 (六个平面全裁剪)
+ *
+ * 两个定长多边形交替作为输入 / 输出，整个过程无堆分配；
+ * 所有顶点都在内侧的平面直接跳过（裁剪结果与输入相同）。
  */
-std::vector<ClipVertex> Clipper::ClipTriangle(const ClipVertex& a,
-                                              const ClipVertex& b,
-                                              const ClipVertex& c) const {
-    std::vector<ClipVertex> poly{a, b, c};
+ClipPolygon Clipper::ClipTriangle(const ClipVertex& a,
+                                  const ClipVertex& b,
+                                  const ClipVertex& c) const {
+    ClipPolygon polys[2];
+    polys[0].vertices[0] = a;
+    polys[0].vertices[1] = b;
+    polys[0].vertices[2] = c;
+    polys[0].count = 3;
+    int current = 0;
     for (int plane = 0; plane < 6; ++plane) {
-        poly = ClipPolygonAgainstPlane(poly, plane);
-        if (poly.empty()) {
+        const ClipPolygon& input = polys[current];
+        bool allInside = true;
+        for (int i = 0; i < input.count && allInside; ++i) {
+            allInside = PlaneValue(input.vertices[i], plane) >= 0.0;
+        }
+        if (allInside) {
+            continue;
+        }
+        ClipPolygonAgainstPlane(input, plane, polys[current ^ 1]);
+        current ^= 1;
+        if (polys[current].empty()) {
             break;
         }
     }
-    return poly;
+    return polys[current];
 }
 
 } // namespace SR
@@ -1,11 +1,17 @@
 #include "Pipeline/EnvironmentMap.h"
 #include "Asset/EXRDecoder.h"
 #include "Utils/DebugLog.h"
-#include "Utils/PBRUtils.h"
+#include "Utils/MappedFile.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <immintrin.h>
 #include <omp.h>
+#include <random>
 
 
 namespace SR {
@@ -16,6 +22,81 @@ constexpr double kPi  = 3.14159265358979323846;
 constexpr double kInvPi = 0.31830988618379067154;
 constexpr double k2Pi = 6.28318530717958647693;
 
+// 预计算参数（参与缓存键）
+constexpr int kSpecularBaseWidth = 256;     ///< 镜面 mip 0 宽度
+constexpr uint32_t kPrefilterSamples = 256; ///< 每纹素 GGX 重要性样本数
+constexpr int kSkyMaxSize = 2048;           ///< 八面体天空盒边长上限
+
+// ============================================================================
+// BRDF 积分 LUT（离线烘焙，见 BRDFLutData.inl）
+// ============================================================================
+
+constexpr int kBRDFLutSize = 128;
+constexpr uint16_t kBRDFLut[kBRDFLutSize * kBRDFLutSize * 2] = {
+#include "BRDFLutData.inl"
+};
+
+// ============================================================================
+// IBL 磁盘缓存格式
+// ============================================================================
+
+constexpr uint32_t kIBLCacheMagic = 0x4C424953u; // "SIBL"
+constexpr uint32_t kIBLCacheVersion = 2;
+constexpr int kIBLCacheMaxMips = 8;
+constexpr uint64_t kIBLCacheAlignment = 64;
+
+struct IBLCacheImage {
+    int32_t width = 0;
+    int32_t height = 0;
+    uint64_t offset = 0; ///< 相对文件头的字节偏移（kIBLCacheAlignment 对齐）
+    uint64_t bytes = 0;
+};
+
+struct IBLCacheHeader {
+    uint32_t magic = kIBLCacheMagic;
+    uint32_t version = kIBLCacheVersion;
+    uint64_t key = 0;
+    uint32_t layout = 0;
+    uint32_t mipCount = 0;
+    uint64_t payloadHash = 0;               ///< 各图像数据依次的 FNV-1a 哈希（加载时校验）
+    double sh[9][3]{};
+    IBLCacheImage sky;                      ///< 八面体天空盒（Equirect 布局为空）
+    IBLCacheImage mips[kIBLCacheMaxMips];   ///< 镜面 mip 链
+};
+
+constexpr uint64_t kFNVOffsetBasis = 1469598103934665603ull;
+
+// FNV-1a 按 64 位字处理（尾部逐字节），用于 EXR 内容与缓存数据哈希
+uint64_t HashBytes(const uint8_t* data, size_t size, uint64_t hash = kFNVOffsetBasis) {
+    constexpr uint64_t kPrime = 1099511628211ull;
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        uint64_t word;
+        std::memcpy(&word, data + i, sizeof(word));
+        hash = (hash ^ word) * kPrime;
+    }
+    for (; i < size; ++i) {
+        hash = (hash ^ data[i]) * kPrime;
+    }
+    return hash;
+}
+
+template <typename T>
+uint64_t HashValue(uint64_t hash, const T& value) {
+    return HashBytes(reinterpret_cast<const uint8_t*>(&value), sizeof(T), hash);
+}
+
+// <目录>/<EXR 文件名>.sribl
+std::string IBLCachePath(const std::string& exrPath, const std::string& cacheDirectory) {
+    const std::filesystem::path source(exrPath);
+    const std::filesystem::path dir = cacheDirectory.empty() ? source.parent_path() : std::filesystem::path(cacheDirectory);
+    return (dir / (source.filename().string() + ".sribl")).string();
+}
+
+inline uint64_t AlignCacheOffset(uint64_t offset) {
+    return (offset + kIBLCacheAlignment - 1) & ~(kIBLCacheAlignment - 1);
+}
+
 // ============================================================================
 // 低差异序列 (Hammersley)
 // ============================================================================
@@ -79,6 +160,96 @@ Vec2 DirToEquirectUV(const Vec3& dir) {
     return Vec2{u, v};
 }
 
+// ============================================================================
+// 八面体映射（+Y 半球位于中心，-Y 半球折叠到四角）
+// ============================================================================
+
+// 方向 → 八面体 UV：L1 归一化 + 下半球折叠，无超越函数
+inline Vec2 DirToOctahedralUV(const Vec3& dir) {
+    const double invL1 = 1.0 / (std::abs(dir.x) + std::abs(dir.y) + std::abs(dir.z) + 1e-30);
+    double px = dir.x * invL1;
+    double pz = dir.z * invL1;
+    if (dir.y < 0.0) {
+        const double fx = (1.0 - std::abs(pz)) * (px >= 0.0 ? 1.0 : -1.0);
+        const double fz = (1.0 - std::abs(px)) * (pz >= 0.0 ? 1.0 : -1.0);
+        px = fx;
+        pz = fz;
+    }
+    return Vec2{px * 0.5 + 0.5, pz * 0.5 + 0.5};
+}
+
+// 八面体纹素中心 → 方向（DirToOctahedralUV 的逆）
+Vec3 OctahedralTexelToDir(int x, int y, int size) {
+    double px = (static_cast<double>(x) + 0.5) / size * 2.0 - 1.0;
+    double pz = (static_cast<double>(y) + 0.5) / size * 2.0 - 1.0;
+    const double py = 1.0 - std::abs(px) - std::abs(pz);
+    if (py < 0.0) {
+        const double fx = (1.0 - std::abs(pz)) * (px >= 0.0 ? 1.0 : -1.0);
+        const double fz = (1.0 - std::abs(px)) * (pz >= 0.0 ? 1.0 : -1.0);
+        px = fx;
+        pz = fz;
+    }
+    return Vec3{px, py, pz}.Normalized();
+}
+
+// RGB → RGBA16F（钳制到 half 可表示的 [0, 65504]，避免 inf）
+inline void StoreHalf4(uint16_t* dst, const Vec3& c) {
+    __m128 v = _mm_setr_ps(static_cast<float>(c.x), static_cast<float>(c.y), static_cast<float>(c.z), 0.0f);
+    v = _mm_min_ps(_mm_max_ps(v, _mm_setzero_ps()), _mm_set1_ps(65504.0f));
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT));
+}
+
+// 按八面体折叠规则填充 1 纹素边框：边 (0, v) 与 (0, 1 - v) 是同一方向，四角都是 -Y
+void FillOctahedralBorder(OctahedralImage& img) {
+    const int n = img.size;
+    auto copy = [&](int dx, int dy, int sx, int sy) {
+        std::memcpy(img.Texel(dx, dy), img.Texel(sx, sy), 4 * sizeof(uint16_t));
+    };
+    for (int i = 0; i < n; ++i) {
+        copy(i, -1, n - 1 - i, 0);
+        copy(i, n, n - 1 - i, n - 1);
+        copy(-1, i, 0, n - 1 - i);
+        copy(n, i, n - 1, n - 1 - i);
+    }
+    copy(-1, -1, n - 1, n - 1);
+    copy(n, -1, 0, n - 1);
+    copy(-1, n, n - 1, 0);
+    copy(n, n, 0, 0);
+}
+
+/**
+ * @brief 八面体 RGBA16F 双线性采样，返回 (r, g, b, 0)
+ *
+ * 边框保证 floor 纹素与其右 / 下邻居总在图像内；同一行相邻两纹素共 16 字节，
+ * 每行一次 F16C 转换，两行先按 ty 插值，再按 tx 合并左右两半。
+ */
+inline __m128 SampleOctahedralBilinear(const OctahedralImage& img, const Vec2& uv) {
+    // NaN 方向落到 0
+    const double u = uv.x > 0.0 ? (uv.x < 1.0 ? uv.x : 1.0) : 0.0;
+    const double v = uv.y > 0.0 ? (uv.y < 1.0 ? uv.y : 1.0) : 0.0;
+    const float fx = static_cast<float>(u * img.size - 0.5); // [-0.5, size - 0.5]
+    const float fy = static_cast<float>(v * img.size - 0.5);
+    const int x0 = static_cast<int>(fx + 1.0f) - 1;          // fx >= -1 时等价于 floor
+    const int y0 = static_cast<int>(fy + 1.0f) - 1;
+    const float tx = fx - static_cast<float>(x0);
+    const float ty = fy - static_cast<float>(y0);
+
+    const uint16_t* row0 = img.Texel(x0, y0);
+    const uint16_t* row1 = row0 + static_cast<size_t>(img.stride) * 4;
+    const __m256 top = _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(row0)));
+    const __m256 bottom = _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(row1)));
+    const __m256 rows = _mm256_fmadd_ps(_mm256_sub_ps(bottom, top), _mm256_set1_ps(ty), top);
+    const __m128 left = _mm256_castps256_ps128(rows);
+    const __m128 right = _mm256_extractf128_ps(rows, 1);
+    return _mm_fmadd_ps(_mm_sub_ps(right, left), _mm_set1_ps(tx), left);
+}
+
+inline Vec3 ToVec3(__m128 c) {
+    alignas(16) float rgba[4];
+    _mm_store_ps(rgba, c);
+    return Vec3{static_cast<double>(rgba[0]), static_cast<double>(rgba[1]), static_cast<double>(rgba[2])};
+}
+
 } // namespace
 
 // ============================================================================
@@ -129,22 +300,62 @@ Vec3 EnvironmentMap::SampleEquirectBilinear(const HDRImage& img, const Vec3& dir
 // 公开接口
 // ============================================================================
 
-bool EnvironmentMap::LoadFromEXR(const std::string& path) {
+bool EnvironmentMap::LoadFromEXR(const std::string& path, const EnvironmentLoadOptions& options) {
     m_loaded = false;
+    m_fromCache = false;
+    m_layout = options.layout;
+    m_cacheMapping.reset();
 
-    EXRDecoder decoder;
-    if (!decoder.LoadFromFile(path, m_envMap)) {
-        m_lastError = decoder.GetLastError();
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        m_lastError = "Failed to open file: " + path;
         return false;
     }
+    auto fileSize = file.tellg();
+    file.seekg(0, std::ios::beg);
+    std::vector<uint8_t> data(static_cast<size_t>(fileSize));
+    file.read(reinterpret_cast<char*>(data.data()), fileSize);
+
+    // 缓存键：EXR 内容 + 影响预计算结果的全部参数
+    uint64_t key = HashBytes(data.data(), data.size());
+    key = HashValue(key, kIBLCacheVersion);
+    key = HashValue(key, static_cast<uint32_t>(m_layout));
+    key = HashValue(key, kSpecularMipCount);
+    key = HashValue(key, kSpecularBaseWidth);
+    key = HashValue(key, kPrefilterSamples);
+    key = HashValue(key, kSkyMaxSize);
+    key = HashValue(key, kMipRoughness);
+
+    const std::string cachePath = options.useCache ? IBLCachePath(path, options.cacheDirectory) : std::string{};
+    m_fromCache = !cachePath.empty() && LoadCache(cachePath, key);
+
+    // Equirect 布局的天空盒直接采样原图，命中缓存也需要解码
+    if (!m_fromCache || m_layout == EnvironmentLayout::Equirect) {
+        EXRDecoder decoder;
+        if (!decoder.Decode(data, m_envMap)) {
+            m_lastError = decoder.GetLastError();
+            return false;
+        }
+        SR_DEBUG_LOG(("EnvironmentMap: loaded " + std::to_string(m_envMap.width) + "x"
+            + std::to_string(m_envMap.height) + " from " + path + "\n").c_str());
+    }
 
-    SR_DEBUG_LOG(("EnvironmentMap: loaded " + std::to_string(m_envMap.width) + "x"
-        + std::to_string(m_envMap.height) + " from " + path + "\n").c_str());
-
-    // 预计算 IBL 数据
-    ComputeSH9();
-    ComputePrefilteredSpecular();
-    ComputeBRDFLUT();
+    if (m_fromCache) {
+        SR_DEBUG_LOG(("EnvironmentMap: IBL data mapped from cache " + cachePath + "\n").c_str());
+    } else {
+        // 预计算 IBL 数据
+        ComputeSH9();
+        ComputePrefilteredSpecular();
+        if (m_layout == EnvironmentLayout::Octahedral) {
+            ComputeOctahedralSky();
+        }
+        if (!cachePath.empty() && !SaveCache(cachePath, key)) {
+            SR_DEBUG_LOG(("EnvironmentMap: failed to write IBL cache " + cachePath + "\n").c_str());
+        }
+    }
+    if (m_layout == EnvironmentLayout::Octahedral) {
+        m_envMap = HDRImage{}; // 运行时只读八面体图像
+    }
 
     m_loaded = true;
     SR_DEBUG_LOG("EnvironmentMap: all precomputation done\n");
@@ -153,6 +364,9 @@ bool EnvironmentMap::LoadFromEXR(const std::string& path) {
 
 Vec3 EnvironmentMap::SampleDirection(const Vec3& dir) const {
     if (!m_loaded) return Vec3{0.0, 0.0, 0.0};
+    if (m_layout == EnvironmentLayout::Octahedral) {
+        return ToVec3(SampleOctahedralBilinear(m_skyOcta, DirToOctahedralUV(dir)));
+    }
     return SampleEquirectBilinear(m_envMap, dir);
 }
 
@@ -193,6 +407,65 @@ Vec3 EnvironmentMap::EvalDiffuseSH(const Vec3& normal) const {
     return irr;
 }
 
+/**
+ * @brief 4 个法线同时评估 SH 辐照度
+ *
+ * 与 EvalDiffuseSH 公式相同：法线分量与二次基函数项在 4 个通道间共享，
+ * 逐颜色通道只需 9 次乘加。
+ */
+void EnvironmentMap::EvalDiffuseSH4(const double* nx, const double* ny, const double* nz,
+                                    double* outR, double* outG, double* outB) const {
+    if (!m_loaded) {
+        for (int i = 0; i < 4; ++i) {
+            outR[i] = 0.03;
+            outG[i] = 0.03;
+            outB[i] = 0.03;
+        }
+        return;
+    }
+
+    constexpr double c1 = 0.429043;
+    constexpr double c2 = 0.511664;
+    constexpr double c3 = 0.743125;
+    constexpr double c4 = 0.886227;
+    constexpr double c5 = 0.247708;
+
+    const __m256d x = _mm256_loadu_pd(nx);
+    const __m256d y = _mm256_loadu_pd(ny);
+    const __m256d z = _mm256_loadu_pd(nz);
+    const __m256d xy = _mm256_mul_pd(x, y);
+    const __m256d yz = _mm256_mul_pd(y, z);
+    const __m256d xz = _mm256_mul_pd(x, z);
+    const __m256d zz = _mm256_mul_pd(z, z);
+    const __m256d xxMinusYy = _mm256_sub_pd(_mm256_mul_pd(x, x), _mm256_mul_pd(y, y));
+    const __m256d zero = _mm256_setzero_pd();
+
+    auto evalChannel = [&](double sh0, double sh1, double sh2, double sh3, double sh4,
+                           double sh5, double sh6, double sh7, double sh8, double* out) {
+        __m256d linear = _mm256_mul_pd(_mm256_set1_pd(sh3), x);
+        linear = _mm256_fmadd_pd(_mm256_set1_pd(sh1), y, linear);
+        linear = _mm256_fmadd_pd(_mm256_set1_pd(sh2), z, linear);
+        __m256d quad = _mm256_mul_pd(_mm256_set1_pd(sh4), xy);
+        quad = _mm256_fmadd_pd(_mm256_set1_pd(sh5), yz, quad);
+        quad = _mm256_fmadd_pd(_mm256_set1_pd(sh7), xz, quad);
+
+        __m256d irr = _mm256_set1_pd(c4 * sh0 - c5 * sh6);
+        irr = _mm256_fmadd_pd(_mm256_set1_pd(2.0 * c2), linear, irr);
+        irr = _mm256_fmadd_pd(_mm256_set1_pd(2.0 * c1), quad, irr);
+        irr = _mm256_fmadd_pd(_mm256_set1_pd(c3 * sh6), zz, irr);
+        irr = _mm256_fmadd_pd(_mm256_set1_pd(c1 * sh8), xxMinusYy, irr);
+        // 钳制负值（SH 可能产生极小负值）
+        _mm256_storeu_pd(out, _mm256_max_pd(irr, zero));
+    };
+
+    evalChannel(m_sh[0].x, m_sh[1].x, m_sh[2].x, m_sh[3].x, m_sh[4].x,
+                m_sh[5].x, m_sh[6].x, m_sh[7].x, m_sh[8].x, outR);
+    evalChannel(m_sh[0].y, m_sh[1].y, m_sh[2].y, m_sh[3].y, m_sh[4].y,
+                m_sh[5].y, m_sh[6].y, m_sh[7].y, m_sh[8].y, outG);
+    evalChannel(m_sh[0].z, m_sh[1].z, m_sh[2].z, m_sh[3].z, m_sh[4].z,
+                m_sh[5].z, m_sh[6].z, m_sh[7].z, m_sh[8].z, outB);
+}
+
 Vec3 EnvironmentMap::SampleSpecular(const Vec3& R, double roughness) const {
     if (!m_loaded) return Vec3{0.0, 0.0, 0.0};
 
@@ -202,6 +475,14 @@ Vec3 EnvironmentMap::SampleSpecular(const Vec3& R, double roughness) const {
     int mip1 = std::min(mip0 + 1, kSpecularMipCount - 1);
     double frac = t - mip0;
 
+    if (m_layout == EnvironmentLayout::Octahedral) {
+        // 两级共用同一 UV
+        const Vec2 uv = DirToOctahedralUV(R);
+        const __m128 c0 = SampleOctahedralBilinear(m_specularOcta[mip0], uv);
+        const __m128 c1 = SampleOctahedralBilinear(m_specularOcta[mip1], uv);
+        return ToVec3(_mm_fmadd_ps(_mm_sub_ps(c1, c0), _mm_set1_ps(static_cast<float>(frac)), c0));
+    }
+
     Vec3 c0 = SampleEquirectBilinear(m_specularMips[mip0], R);
     Vec3 c1 = SampleEquirectBilinear(m_specularMips[mip1], R);
 
@@ -213,15 +494,14 @@ Vec3 EnvironmentMap::SampleSpecular(const Vec3& R, double roughness) const {
 }
 
 Vec2 EnvironmentMap::LookupBRDF(double NdotV, double roughness) const {
-    if (m_brdfLUT.empty()) return Vec2{1.0, 0.0};
-
     double fx = NdotV * (kBRDFLutSize - 1);
     double fy = roughness * (kBRDFLutSize - 1);
     int x0 = std::max(0, std::min(static_cast<int>(fx), kBRDFLutSize - 1));
     int y0 = std::max(0, std::min(static_cast<int>(fy), kBRDFLutSize - 1));
 
+    constexpr double kUnorm16 = 1.0 / 65535.0;
     size_t idx = (static_cast<size_t>(y0) * kBRDFLutSize + x0) * 2;
-    return Vec2{static_cast<double>(m_brdfLUT[idx]), static_cast<double>(m_brdfLUT[idx + 1])};
+    return Vec2{kBRDFLut[idx] * kUnorm16, kBRDFLut[idx + 1] * kUnorm16};
 }
 
 // ============================================================================
@@ -312,84 +592,90 @@ void EnvironmentMap::ComputeSH9() {
 // Split-Sum 预过滤镜面反射 mip 链
 // ============================================================================
 
+Vec3 EnvironmentMap::PrefilterSpecular(const Vec3& N, double roughness) const {
+    constexpr uint32_t numSamples = kPrefilterSamples;
+
+    Vec3 R = N; // 假设 V = N（Split-Sum 近似）
+    Vec3 V = R;
+
+    Vec3 prefilteredColor{0.0, 0.0, 0.0};
+    double totalWeight = 0.0;
+
+    for (uint32_t i = 0; i < numSamples; ++i) {
+        Vec2 Xi = Hammersley(i, numSamples);
+        Vec3 H = ImportanceSampleGGX(Xi, N, roughness);
+        double VdotH = V.x * H.x + V.y * H.y + V.z * H.z;
+        Vec3 L{2.0 * VdotH * H.x - V.x,
+               2.0 * VdotH * H.y - V.y,
+               2.0 * VdotH * H.z - V.z};
+
+        double NdotL = N.x * L.x + N.y * L.y + N.z * L.z;
+        if (NdotL > 0.0) {
+            Vec3 s = SampleEquirectBilinear(m_envMap, L);
+            prefilteredColor.x += s.x * NdotL;
+            prefilteredColor.y += s.y * NdotL;
+            prefilteredColor.z += s.z * NdotL;
+            totalWeight += NdotL;
+        }
+    }
+
+    if (totalWeight > 0.0) {
+        double invW = 1.0 / totalWeight;
+        prefilteredColor.x *= invW;
+        prefilteredColor.y *= invW;
+        prefilteredColor.z *= invW;
+    }
+    return prefilteredColor;
+}
+
 void EnvironmentMap::ComputePrefilteredSpecular() {
     SR_DEBUG_LOG("EnvironmentMap: computing prefiltered specular...\n");
 
-    constexpr int baseMipWidth = 256;
-    constexpr uint32_t numSamples = 256;
+    constexpr int baseMipWidth = kSpecularBaseWidth;
 
     for (int mip = 0; mip < kSpecularMipCount; ++mip) {
         double roughness = kMipRoughness[mip];
         int mipW = std::max(16, baseMipWidth >> mip);
         int mipH = mipW / 2;
 
-        HDRImage& mipImg = m_specularMips[mip];
-        mipImg.width = mipW;
-        mipImg.height = mipH;
-        mipImg.pixels.resize(static_cast<size_t>(mipW) * mipH * 3);
-
-        // 像素→方向映射（匹配 DirToEquirectUV 的逆）
-        auto pixelToDir = [&](int px, int py, int pw, int ph) -> Vec3 {
-            double u = (static_cast<double>(px) + 0.5) / pw;
-            double v = (static_cast<double>(py) + 0.5) / ph;
-            double azimuth = (u - 0.5) * k2Pi;
-            double elevation = (0.5 - v) * kPi;
-            double cosElev = std::cos(elevation);
-            return Vec3{cosElev * std::sin(azimuth), std::sin(elevation), cosElev * std::cos(azimuth)};
+        // Mip 0 (roughness≈0): 直接从原图降采样（完美反射）；其余级 GGX 重要性采样预过滤
+        auto shade = [&](const Vec3& dir) -> Vec3 {
+            return roughness < 1e-6 ? SampleEquirectBilinear(m_envMap, dir) : PrefilterSpecular(dir, roughness);
         };
 
-        if (roughness < 1e-6) {
-            // Mip 0 (roughness≈0): 直接从原图降采样（完美反射）
-            #pragma omp parallel for schedule(guided, 1)
-            for (int y = 0; y < mipH; ++y) {
+        if (m_layout == EnvironmentLayout::Octahedral) {
+            // 八面体边长取等距柱形宽度，两者纹素数同量级
+            OctahedralImage& octa = m_specularOcta[mip];
+            octa.Resize(mipW);
+            #pragma omp parallel for schedule(dynamic, 1)
+            for (int y = 0; y < mipW; ++y) {
                 for (int x = 0; x < mipW; ++x) {
-                    Vec3 dir = pixelToDir(x, y, mipW, mipH);
-                    Vec3 c = SampleEquirectBilinear(m_envMap, dir);
-                    mipImg.SetPixel(x, y, static_cast<float>(c.x), static_cast<float>(c.y), static_cast<float>(c.z));
+                    StoreHalf4(octa.Texel(x, y), shade(OctahedralTexelToDir(x, y, mipW)));
                 }
             }
+            FillOctahedralBorder(octa);
+            mipH = mipW;
         } else {
-            // GGX 重要性采样预过滤
+            HDRImage& mipImg = m_specularMips[mip];
+            mipImg.width = mipW;
+            mipImg.height = mipH;
+            mipImg.pixels.resize(static_cast<size_t>(mipW) * mipH * 3);
+
+            // 像素→方向映射（匹配 DirToEquirectUV 的逆）
+            auto pixelToDir = [&](int px, int py, int pw, int ph) -> Vec3 {
+                double u = (static_cast<double>(px) + 0.5) / pw;
+                double v = (static_cast<double>(py) + 0.5) / ph;
+                double azimuth = (u - 0.5) * k2Pi;
+                double elevation = (0.5 - v) * kPi;
+                double cosElev = std::cos(elevation);
+                return Vec3{cosElev * std::sin(azimuth), std::sin(elevation), cosElev * std::cos(azimuth)};
+            };
+
             #pragma omp parallel for schedule(dynamic, 1)
             for (int y = 0; y < mipH; ++y) {
                 for (int x = 0; x < mipW; ++x) {
-                    Vec3 N = pixelToDir(x, y, mipW, mipH);
-
-                    Vec3 R = N; // 假设 V = N（Split-Sum 近似）
-                    Vec3 V = R;
-
-                    Vec3 prefilteredColor{0.0, 0.0, 0.0};
-                    double totalWeight = 0.0;
-
-                    for (uint32_t i = 0; i < numSamples; ++i) {
-                        Vec2 Xi = Hammersley(i, numSamples);
-                        Vec3 H = ImportanceSampleGGX(Xi, N, roughness);
-                        double VdotH = V.x * H.x + V.y * H.y + V.z * H.z;
-                        Vec3 L{2.0 * VdotH * H.x - V.x,
-                               2.0 * VdotH * H.y - V.y,
-                               2.0 * VdotH * H.z - V.z};
-
-                        double NdotL = N.x * L.x + N.y * L.y + N.z * L.z;
-                        if (NdotL > 0.0) {
-                            Vec3 s = SampleEquirectBilinear(m_envMap, L);
-                            prefilteredColor.x += s.x * NdotL;
-                            prefilteredColor.y += s.y * NdotL;
-                            prefilteredColor.z += s.z * NdotL;
-                            totalWeight += NdotL;
-                        }
-                    }
-
-                    if (totalWeight > 0.0) {
-                        double invW = 1.0 / totalWeight;
-                        prefilteredColor.x *= invW;
-                        prefilteredColor.y *= invW;
-                        prefilteredColor.z *= invW;
-                    }
-
-                    mipImg.SetPixel(x, y,
-                        static_cast<float>(prefilteredColor.x),
-                        static_cast<float>(prefilteredColor.y),
-                        static_cast<float>(prefilteredColor.z));
+                    Vec3 c = shade(pixelToDir(x, y, mipW, mipH));
+                    mipImg.SetPixel(x, y, static_cast<float>(c.x), static_cast<float>(c.y), static_cast<float>(c.z));
                 }
             }
         }
@@ -404,63 +690,191 @@ void EnvironmentMap::ComputePrefilteredSpecular() {
 }
 
 // ============================================================================
-// BRDF 积分 LUT (Split-Sum 第二项)
+// 八面体天空盒
 // ============================================================================
 
-void EnvironmentMap::ComputeBRDFLUT() {
-    SR_DEBUG_LOG("EnvironmentMap: computing BRDF LUT...\n");
-
-    constexpr int size = kBRDFLutSize;
-    constexpr uint32_t numSamples = 512;
-
-    m_brdfLUT.resize(static_cast<size_t>(size) * size * 2);
-
-    #pragma omp parallel for schedule(guided)
-    for (int iy = 0; iy < size; ++iy) {
-        double roughness = (static_cast<double>(iy) + 0.5) / size;
-        roughness = std::max(roughness, 0.01); // 避免 roughness=0 导致的数值问题
+void EnvironmentMap::ComputeOctahedralSky() {
+    // 边长取不超过原图宽度一半的 2 的幂（纹素数与原图同量级），上限 2048
+    const int limit = std::min(kSkyMaxSize, m_envMap.width / 2);
+    int size = 64;
+    while (size * 2 <= limit) size *= 2;
+
+    m_skyOcta.Resize(size);
+    #pragma omp parallel for schedule(guided, 1)
+    for (int y = 0; y < size; ++y) {
+        for (int x = 0; x < size; ++x) {
+            StoreHalf4(m_skyOcta.Texel(x, y), SampleEquirectBilinear(m_envMap, OctahedralTexelToDir(x, y, size)));
+        }
+    }
+    FillOctahedralBorder(m_skyOcta);
 
-        for (int ix = 0; ix < size; ++ix) {
-            double NdotV = (static_cast<double>(ix) + 0.5) / size;
-            NdotV = std::max(NdotV, 1e-4);
+    char buf[96];
+    std::snprintf(buf, sizeof(buf), "EnvironmentMap: octahedral sky %dx%d RGBA16F done\n", size, size);
+    SR_DEBUG_LOG(buf);
+}
 
-            Vec3 V{std::sqrt(1.0 - NdotV * NdotV), 0.0, NdotV};
-            Vec3 N{0.0, 0.0, 1.0};
+// ============================================================================
+// IBL 磁盘缓存
+// ============================================================================
 
-            double A = 0.0, B = 0.0;
+bool EnvironmentMap::LoadCache(const std::string& cachePath, uint64_t key) {
+    static_assert(kSpecularMipCount <= kIBLCacheMaxMips, "IBL cache header has too few mip slots");
 
-            for (uint32_t i = 0; i < numSamples; ++i) {
-                Vec2 Xi = Hammersley(i, numSamples);
-                Vec3 H = ImportanceSampleGGX(Xi, N, roughness);
-                double VdotH = V.x * H.x + V.y * H.y + V.z * H.z;
-                Vec3 L{2.0 * VdotH * H.x - V.x,
-                       2.0 * VdotH * H.y - V.y,
-                       2.0 * VdotH * H.z - V.z};
+    auto mapping = std::make_shared<MappedFile>();
+    if (!mapping->Open(cachePath) || mapping->Size() < sizeof(IBLCacheHeader)) {
+        return false;
+    }
+    IBLCacheHeader header;
+    std::memcpy(&header, mapping->Data(), sizeof(header));
+    if (header.magic != kIBLCacheMagic || header.version != kIBLCacheVersion || header.key != key ||
+        header.layout != static_cast<uint32_t>(m_layout) || header.mipCount != static_cast<uint32_t>(kSpecularMipCount)) {
+        return false;
+    }
 
-                double NdotL = std::max(L.z, 0.0);
-                double NdotH = std::max(H.z, 0.0);
-                VdotH = std::max(VdotH, 0.0);
+    // 校验各图像的尺寸、对齐与范围
+    const bool octahedral = m_layout == EnvironmentLayout::Octahedral;
+    auto expectedBytes = [&](const IBLCacheImage& img) -> uint64_t {
+        if (octahedral) {
+            const uint64_t stride = static_cast<uint64_t>(img.width) + 2;
+            return stride * stride * 4 * sizeof(uint16_t);
+        }
+        return static_cast<uint64_t>(img.width) * static_cast<uint64_t>(img.height) * 3 * sizeof(float);
+    };
+    auto valid = [&](const IBLCacheImage& img) {
+        return img.width > 0 && img.height > 0 && (!octahedral || img.width == img.height) &&
+               img.offset % kIBLCacheAlignment == 0 && img.bytes == expectedBytes(img) &&
+               img.bytes <= mapping->Size() && img.offset <= mapping->Size() - img.bytes;
+    };
+    if (octahedral && !valid(header.sky)) {
+        return false;
+    }
+    for (int mip = 0; mip < kSpecularMipCount; ++mip) {
+        if (!valid(header.mips[mip])) {
+            return false;
+        }
+    }
 
-                if (NdotL > 0.0) {
-                    double G = GeometrySmith(NdotV, NdotL, roughness);
-                    double G_Vis = (G * VdotH) / (NdotH * NdotV + 1e-12);
-                    double Fc = std::pow(1.0 - VdotH, 5.0);
+    // 校验数据哈希：写了一半或被并发写坏的文件不能被映射复用
+    const uint8_t* base = mapping->Data();
+    uint64_t payloadHash = kFNVOffsetBasis;
+    if (octahedral) {
+        payloadHash = HashBytes(base + header.sky.offset, static_cast<size_t>(header.sky.bytes), payloadHash);
+    }
+    for (int mip = 0; mip < kSpecularMipCount; ++mip) {
+        const IBLCacheImage& img = header.mips[mip];
+        payloadHash = HashBytes(base + img.offset, static_cast<size_t>(img.bytes), payloadHash);
+    }
+    if (payloadHash != header.payloadHash) {
+        return false;
+    }
 
-                    A += (1.0 - Fc) * G_Vis;
-                    B += Fc * G_Vis;
-                }
-            }
+    for (int i = 0; i < 9; ++i) {
+        m_sh[i] = Vec3{header.sh[i][0], header.sh[i][1], header.sh[i][2]};
+    }
+    if (octahedral) {
+        // 直接引用映射内存，不复制
+        m_skyOcta.Attach(reinterpret_cast<const uint16_t*>(base + header.sky.offset), header.sky.width);
+        for (int mip = 0; mip < kSpecularMipCount; ++mip) {
+            const IBLCacheImage& img = header.mips[mip];
+            m_specularOcta[mip].Attach(reinterpret_cast<const uint16_t*>(base + img.offset), img.width);
+        }
+        m_cacheMapping = std::move(mapping);
+    } else {
+        for (int mip = 0; mip < kSpecularMipCount; ++mip) {
+            const IBLCacheImage& img = header.mips[mip];
+            HDRImage& mipImg = m_specularMips[mip];
+            mipImg.width = img.width;
+            mipImg.height = img.height;
+            mipImg.pixels.resize(static_cast<size_t>(img.bytes / sizeof(float)));
+            std::memcpy(mipImg.pixels.data(), base + img.offset, static_cast<size_t>(img.bytes));
+        }
+    }
+    return true;
+}
 
-            A /= numSamples;
-            B /= numSamples;
+bool EnvironmentMap::SaveCache(const std::string& cachePath, uint64_t key) const {
+    const bool octahedral = m_layout == EnvironmentLayout::Octahedral;
+
+    IBLCacheHeader header;
+    header.key = key;
+    header.layout = static_cast<uint32_t>(m_layout);
+    header.mipCount = static_cast<uint32_t>(kSpecularMipCount);
+    for (int i = 0; i < 9; ++i) {
+        header.sh[i][0] = m_sh[i].x;
+        header.sh[i][1] = m_sh[i].y;
+        header.sh[i][2] = m_sh[i].z;
+    }
 
-            size_t idx = (static_cast<size_t>(iy) * size + ix) * 2;
-            m_brdfLUT[idx + 0] = static_cast<float>(A);
-            m_brdfLUT[idx + 1] = static_cast<float>(B);
+    // 布局：文件头之后各图像按 kIBLCacheAlignment 对齐依次排列
+    const void* payloads[kIBLCacheMaxMips + 1] = {};
+    IBLCacheImage* entries[kIBLCacheMaxMips + 1] = {};
+    int imageCount = 0;
+    uint64_t offset = AlignCacheOffset(sizeof(IBLCacheHeader));
+    auto place = [&](IBLCacheImage& entry, int width, int height, uint64_t bytes, const void* payload) {
+        entry.width = width;
+        entry.height = height;
+        entry.offset = offset;
+        entry.bytes = bytes;
+        offset = AlignCacheOffset(offset + bytes);
+        payloads[imageCount] = payload;
+        entries[imageCount] = &entry;
+        ++imageCount;
+    };
+    if (octahedral) {
+        place(header.sky, m_skyOcta.size, m_skyOcta.size, m_skyOcta.ElementCount() * sizeof(uint16_t), m_skyOcta.Data());
+    }
+    for (int mip = 0; mip < kSpecularMipCount; ++mip) {
+        if (octahedral) {
+            const OctahedralImage& img = m_specularOcta[mip];
+            place(header.mips[mip], img.size, img.size, img.ElementCount() * sizeof(uint16_t), img.Data());
+        } else {
+            const HDRImage& img = m_specularMips[mip];
+            place(header.mips[mip], img.width, img.height, img.pixels.size() * sizeof(float), img.pixels.data());
         }
     }
+    header.payloadHash = kFNVOffsetBasis;
+    for (int i = 0; i < imageCount; ++i) {
+        header.payloadHash = HashBytes(static_cast<const uint8_t*>(payloads[i]),
+                                       static_cast<size_t>(entries[i]->bytes), header.payloadHash);
+    }
 
-    SR_DEBUG_LOG("EnvironmentMap: BRDF LUT done\n");
+    // 先写临时文件再替换，避免并发进程读到写了一半的缓存；
+    // 临时文件名带随机后缀，同时冷启动的多个进程各写各的，最终以原子 rename 覆盖
+    std::error_code ec;
+    const std::filesystem::path target(cachePath);
+    if (target.has_parent_path()) {
+        std::filesystem::create_directories(target.parent_path(), ec);
+    }
+    const uint64_t nonce = (static_cast<uint64_t>(std::random_device{}()) << 32) ^
+                           static_cast<uint64_t>(std::chrono::high_resolution_clock::now().time_since_epoch().count());
+    char suffix[32];
+    std::snprintf(suffix, sizeof(suffix), ".%016llx.tmp", static_cast<unsigned long long>(nonce));
+    const std::filesystem::path temp = target.string() + suffix;
+    {
+        std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) {
+            return false;
+        }
+        static const char kPadding[kIBLCacheAlignment] = {};
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        uint64_t written = sizeof(header);
+        for (int i = 0; i < imageCount; ++i) {
+            out.write(kPadding, static_cast<std::streamsize>(entries[i]->offset - written));
+            out.write(static_cast<const char*>(payloads[i]), static_cast<std::streamsize>(entries[i]->bytes));
+            written = entries[i]->offset + entries[i]->bytes;
+        }
+        if (!out.good()) {
+            out.close();
+            std::filesystem::remove(temp, ec);
+            return false;
+        }
+    }
+    std::filesystem::rename(temp, target, ec);
+    if (ec) {
+        std::filesystem::remove(temp, ec);
+        return false;
+    }
+    return true;
 }
 
 } // namespace SR
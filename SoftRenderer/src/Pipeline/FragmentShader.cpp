@@ -1,12 +1,16 @@
 #include "Pipeline/FragmentShader.h"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstdint>
+#include <utility>
+#include <vector>
 #include <immintrin.h>
 
 #include "Asset/GLTFTypes.h"
 #include "Pipeline/EnvironmentMap.h"
+#include "Pipeline/ShadowMap.h"
 #include "Utils/MathUtils.h"
 #include "Utils/PBRUtils.h"
 #include "Utils/TextureSampler.h"
@@ -155,116 +159,120 @@ inline Vec3 MultiscatterCompensation(const Vec3& F0, const Vec2& dfg) {
 
 namespace {
 
-// 简化的纹理采样辅助函数，根据采样器配置自动选择最近邻或双线性过滤
-SampledColor SampleImageFast(const std::vector<GLTFImage>* images,
-                             const std::vector<GLTFSampler>* samplers,
-                             int imageIndex, int samplerIndex,
-                             const Vec2& texCoord, bool srgb) {
-    if (!images || imageIndex < 0 || imageIndex >= static_cast<int>(images->size())) {
+/// @brief 一组纹理坐标及其屏幕空间导数（导数全 0 时按放大处理，只采样基础级）
+struct TexCoordSample {
+    Vec2 uv;
+    Vec2 dx;
+    Vec2 dy;
+};
+
+/// @brief 取片元的主 / 次 UV 及导数
+inline TexCoordSample GetTexCoordSample(const FragmentVarying& varying, int texCoordSet) {
+    return (texCoordSet == 1) ? TexCoordSample{varying.texCoord1, varying.texCoord1Dx, varying.texCoord1Dy}
+                              : TexCoordSample{varying.texCoord, varying.texCoordDx, varying.texCoordDy};
+}
+
+/// @brief 取批次中第 lane 个片元的主 / 次 UV 及导数
+inline TexCoordSample GetTexCoordSample(const FragmentVaryingBatch& in, int lane, int texCoordSet) {
+    return (texCoordSet == 1)
+        ? TexCoordSample{Vec2{in.u1[lane], in.v1[lane]}, Vec2{in.du1dx[lane], in.dv1dx[lane]}, Vec2{in.du1dy[lane], in.dv1dy[lane]}}
+        : TexCoordSample{Vec2{in.u0[lane], in.v0[lane]}, Vec2{in.du0dx[lane], in.dv0dx[lane]}, Vec2{in.du0dy[lane], in.dv0dy[lane]}};
+}
+
+// 简化的纹理采样辅助函数
+// 优先使用光栅化器按三角形解析好的采样描述符（无逐样本索引校验/采样器查找，按 min/mag 过滤模式与 LOD 选择 mip 级），
+// 缺失时回退到原始图像的基础级采样
+SampledColor SampleImageFast(const FragmentContext& ctx, TextureSlot slot, const TexCoordSample& texCoord, bool srgb) {
+    if (const TextureDescriptor* desc = ctx.textureDescriptors[static_cast<size_t>(slot)]) {
+        return SampleTexture(*desc, texCoord.uv, texCoord.dx, texCoord.dy);
+    }
+
+    const TextureBinding& binding = ctx.textures[static_cast<size_t>(slot)];
+    const std::vector<GLTFImage>* images = ctx.images;
+    if (!images || binding.imageIndex < 0 || binding.imageIndex >= static_cast<int>(images->size())) {
         return {};
     }
-    const GLTFImage& image = (*images)[imageIndex];
+    const std::vector<GLTFSampler>* samplers = ctx.samplers;
     const GLTFSampler* sampler = nullptr;
-    if (samplers && samplerIndex >= 0 && samplerIndex < static_cast<int>(samplers->size())) {
-        sampler = &(*samplers)[samplerIndex];
+    if (samplers && binding.samplerIndex >= 0 && binding.samplerIndex < static_cast<int>(samplers->size())) {
+        sampler = &(*samplers)[binding.samplerIndex];
     }
-    
+
+    const GLTFImage& image = (*images)[binding.imageIndex];
     if (UseLinearFilter(sampler)) {
-        return SampleImageBilinear(image, sampler, texCoord, srgb);
+        return SampleImageBilinear(image, sampler, texCoord.uv, srgb);
     }
-    return SampleImageNearest(image, sampler, texCoord, srgb);
+    return SampleImageNearest(image, sampler, texCoord.uv, srgb);
 }
 
-} // namespace
+/// @brief 纹理采样阶段输出（逐片元表面参数）
+struct SurfaceInputs {
+    Vec3 albedo;      ///< 反照率（含基础色贴图与顶点色）
+    double alpha;     ///< 材质 alpha（含贴图、顶点色与透射）
+    double metallic;  ///< 金属度
+    double roughness; ///< 粗糙度（已钳制到 >= 0.04）
+};
 
 /**
- * @brief 高性能片元着色实现
+ * @brief 纹理采样阶段：基础色、透射、金属度-粗糙度与法线贴图
+ *
+ * ShadeFast 与 ShadeBatch 共用（后者逐通道调用），保证两条路径的表面参数一致。
+ * 贴图分支由特性掩码在编译期裁剪，变体内不再逐像素检查绑定。
+ * @param N 输入为归一化（已按双面规则翻转）的几何法线，输出为应用法线贴图后的法线
  */
-Vec3 FragmentShader::ShadeFast(const FragmentContext& ctx, const FragmentVarying& varying, double* outEffectiveAlpha) const {
-    // 内联归一化法线 N（避免函数调用开销，热路径优化）
-    Vec3 N = varying.normal;
-    double nLenSq = N.x * N.x + N.y * N.y + N.z * N.z;
-    if (nLenSq > 1e-12) {
-        double invNLen = 1.0 / std::sqrt(nLenSq);
-        N.x *= invNLen; N.y *= invNLen; N.z *= invNLen;
-    }
-
-    // 计算视线方向 V（世界空间，从片元指向相机）
-    Vec3 V{ctx.cameraPos.x - varying.worldPos.x,
-           ctx.cameraPos.y - varying.worldPos.y,
-           ctx.cameraPos.z - varying.worldPos.z};
-    double vLenSq = V.x * V.x + V.y * V.y + V.z * V.z;
-    if (vLenSq > 1e-12) {
-        double invVLen = 1.0 / std::sqrt(vLenSq);
-        V.x *= invVLen; V.y *= invVLen; V.z *= invVLen;
-    }
-
-    // 双面渲染：若法线背向视线则翻转（符合 glTF 规范要求）
-    if (ctx.doubleSided) {
-        double ndotv_raw = N.x * V.x + N.y * V.y + N.z * V.z;
-        if (ndotv_raw < 0.0) {
-            N.x = -N.x; N.y = -N.y; N.z = -N.z;
-        }
-    }
-
+template <ShaderFeatureMask kFeatures>
+SurfaceInputs EvaluateSurfaceInputs(const FragmentContext& ctx, const TexCoordSample& texCoord, const TexCoordSample& texCoord1,
+                                    const Vec4& color, const Vec3& tangent, Vec3& N) {
     double roughness = std::max(0.04, ctx.roughness);
     double metallic = Saturate(ctx.metallic);
     Vec3 albedo = Clamp01(ctx.albedo);
     const TextureBinding& baseColorBinding = ctx.textures[static_cast<size_t>(TextureSlot::BaseColor)];
     const TextureBinding& metallicRoughnessBinding = ctx.textures[static_cast<size_t>(TextureSlot::MetallicRoughness)];
     const TextureBinding& normalBinding = ctx.textures[static_cast<size_t>(TextureSlot::Normal)];
-    const TextureBinding& occlusionBinding = ctx.textures[static_cast<size_t>(TextureSlot::Occlusion)];
-    const TextureBinding& emissiveBinding = ctx.textures[static_cast<size_t>(TextureSlot::Emissive)];
     const TextureBinding& transmissionBinding = ctx.textures[static_cast<size_t>(TextureSlot::Transmission)];
 
-    // ---- 纹理采样阶段 ----
     // 采样基础颜色贴图（sRGB 解码）并与顶点颜色相乘
     double alpha = ctx.alpha;
-    if (baseColorBinding.imageIndex >= 0) {
-        Vec2 baseUv = (baseColorBinding.texCoordSet == 1) ? varying.texCoord1 : varying.texCoord;
-        SampledColor baseColor = SampleImageFast(ctx.images, ctx.samplers,
-            baseColorBinding.imageIndex, baseColorBinding.samplerIndex, baseUv, true);
-        Vec3 vertexColor = Clamp01(Vec3{varying.color.x, varying.color.y, varying.color.z});
+    if constexpr ((kFeatures & ShaderFeature::BaseColorMap) != 0) {
+        const TexCoordSample& baseUv = (baseColorBinding.texCoordSet == 1) ? texCoord1 : texCoord;
+        SampledColor baseColor = SampleImageFast(ctx, TextureSlot::BaseColor, baseUv, true);
+        Vec3 vertexColor = Clamp01(Vec3{color.x, color.y, color.z});
         albedo = Mul(Mul(albedo, baseColor.rgb), vertexColor);
-        alpha *= baseColor.a * Clamp01(varying.color.w);
-    }
-    if (baseColorBinding.imageIndex < 0) {
-        Vec3 vertexColor = Clamp01(Vec3{varying.color.x, varying.color.y, varying.color.z});
+        alpha *= baseColor.a * Clamp01(color.w);
+    } else {
+        Vec3 vertexColor = Clamp01(Vec3{color.x, color.y, color.z});
         albedo = Mul(albedo, vertexColor);
-        alpha *= Clamp01(varying.color.w);
+        alpha *= Clamp01(color.w);
     }
-    if (ctx.transmissionFactor > 0.0 || transmissionBinding.imageIndex >= 0) {
+    if constexpr ((kFeatures & ShaderFeature::Transmission) != 0) {
         double t = Saturate(ctx.transmissionFactor);
         if (transmissionBinding.imageIndex >= 0) {
-            Vec2 tUv = (transmissionBinding.texCoordSet == 1) ? varying.texCoord1 : varying.texCoord;
-            SampledColor transmission = SampleImageFast(ctx.images, ctx.samplers,
-                transmissionBinding.imageIndex, transmissionBinding.samplerIndex, tUv, false);
+            const TexCoordSample& tUv = (transmissionBinding.texCoordSet == 1) ? texCoord1 : texCoord;
+            SampledColor transmission = SampleImageFast(ctx, TextureSlot::Transmission, tUv, false);
             t *= transmission.rgb.x;
         }
         alpha *= (1.0 - Saturate(t));
     }
 
     // 采样金属度-粗糙度贴图（线性空间：B=金属度, G=粗糙度）
-    if (metallicRoughnessBinding.imageIndex >= 0) {
-        Vec2 mrUv = (metallicRoughnessBinding.texCoordSet == 1) ? varying.texCoord1 : varying.texCoord;
-        SampledColor mr = SampleImageFast(ctx.images, ctx.samplers,
-            metallicRoughnessBinding.imageIndex, metallicRoughnessBinding.samplerIndex, mrUv, false);
+    if constexpr ((kFeatures & ShaderFeature::MetallicRoughnessMap) != 0) {
+        const TexCoordSample& mrUv = (metallicRoughnessBinding.texCoordSet == 1) ? texCoord1 : texCoord;
+        SampledColor mr = SampleImageFast(ctx, TextureSlot::MetallicRoughness, mrUv, false);
         metallic = Saturate(metallic * mr.rgb.z);
         roughness = std::max(0.04, mr.rgb.y * roughness);
     }
 
     // 法线贴图：将切线空间法线变换到世界空间，更新 N 向量
-    if (normalBinding.imageIndex >= 0) {
+    if constexpr ((kFeatures & ShaderFeature::NormalMap) != 0) {
         // 内联归一化切线 T（避免函数调用开销）
-        Vec3 T = varying.tangent;
+        Vec3 T = tangent;
         double tLenSq = T.x * T.x + T.y * T.y + T.z * T.z;
         if (tLenSq > 1e-12) {
             double invTLen = 1.0 / std::sqrt(tLenSq);
             T.x *= invTLen; T.y *= invTLen; T.z *= invTLen;
 
-            Vec2 nUv = (normalBinding.texCoordSet == 1) ? varying.texCoord1 : varying.texCoord;
-            SampledColor nm = SampleImageFast(ctx.images, ctx.samplers,
-                normalBinding.imageIndex, normalBinding.samplerIndex, nUv, false);
+            const TexCoordSample& nUv = (normalBinding.texCoordSet == 1) ? texCoord1 : texCoord;
+            SampledColor nm = SampleImageFast(ctx, TextureSlot::Normal, nUv, false);
             Vec3 tangentNormal{nm.rgb.x * 2.0 - 1.0, nm.rgb.y * 2.0 - 1.0, nm.rgb.z * 2.0 - 1.0};
 
             // 计算副切线 B = cross(N, T) * tangentW（tangentW 决定坐标系手性）
@@ -292,6 +300,75 @@ Vec3 FragmentShader::ShadeFast(const FragmentContext& ctx, const FragmentVarying
         }
     }
 
+    return SurfaceInputs{albedo, alpha, metallic, roughness};
+}
+
+/// 局部光源距离平方下限（避免片元贴近光源时平方反比发散）
+constexpr double kMinLocalLightDistSq = 1e-4;
+
+/**
+ * @brief 计算局部光源的衰减（距离窗口 × 平方反比 × 聚光锥角）
+ * @param L 输入为片元指向光源的向量，输出归一化方向
+ * @return 衰减系数，0 表示不受该光源影响
+ */
+inline double EvaluateLocalLight(const PrecomputedLocalLight& light, Vec3& L) {
+    const double distSq = L.x * L.x + L.y * L.y + L.z * L.z;
+    const double t = distSq * light.invRangeSq;
+    if (t >= 1.0) {
+        return 0.0;
+    }
+    const double invDist = 1.0 / std::sqrt(std::max(distSq, 1e-24));
+    L.x *= invDist; L.y *= invDist; L.z *= invDist;
+    const double window = 1.0 - t * t;
+    const double spot = Saturate(-(L.x * light.direction.x + L.y * light.direction.y + L.z * light.direction.z) *
+                                 light.spotScale + light.spotOffset);
+    return window * window * spot * spot / std::max(distSq, kMinLocalLightDistSq);
+}
+
+/**
+ * @brief 高性能片元着色实现（按特性掩码特化的变体）
+ *
+ * 光照只读取 ctx.precomputedLights 与 ctx.localLights；旧版 ctx.lights 由 FragmentShader::ShadeFast 在分派前转换。
+ */
+template <ShaderFeatureMask kFeatures>
+Vec3 ShadeFastT(const FragmentContext& ctx, const FragmentVarying& varying, double* outEffectiveAlpha) {
+    // 内联归一化法线 N（避免函数调用开销，热路径优化）
+    Vec3 N = varying.normal;
+    double nLenSq = N.x * N.x + N.y * N.y + N.z * N.z;
+    if (nLenSq > 1e-12) {
+        double invNLen = 1.0 / std::sqrt(nLenSq);
+        N.x *= invNLen; N.y *= invNLen; N.z *= invNLen;
+    }
+
+    // 计算视线方向 V（世界空间，从片元指向相机）
+    Vec3 V{ctx.cameraPos.x - varying.worldPos.x,
+           ctx.cameraPos.y - varying.worldPos.y,
+           ctx.cameraPos.z - varying.worldPos.z};
+    double vLenSq = V.x * V.x + V.y * V.y + V.z * V.z;
+    if (vLenSq > 1e-12) {
+        double invVLen = 1.0 / std::sqrt(vLenSq);
+        V.x *= invVLen; V.y *= invVLen; V.z *= invVLen;
+    }
+
+    // 双面渲染：若法线背向视线则翻转（符合 glTF 规范要求）
+    if constexpr ((kFeatures & ShaderFeature::DoubleSided) != 0) {
+        double ndotv_raw = N.x * V.x + N.y * V.y + N.z * V.z;
+        if (ndotv_raw < 0.0) {
+            N.x = -N.x; N.y = -N.y; N.z = -N.z;
+        }
+    }
+
+    const TextureBinding& occlusionBinding = ctx.textures[static_cast<size_t>(TextureSlot::Occlusion)];
+    const TextureBinding& emissiveBinding = ctx.textures[static_cast<size_t>(TextureSlot::Emissive)];
+
+    // ---- 纹理采样阶段 ----
+    SurfaceInputs surface = EvaluateSurfaceInputs<kFeatures>(ctx,
+        GetTexCoordSample(varying, 0), GetTexCoordSample(varying, 1), varying.color, varying.tangent, N);
+    double roughness = surface.roughness;
+    double metallic = surface.metallic;
+    Vec3 albedo = surface.albedo;
+    double alpha = surface.alpha;
+
     // ========================================================================
     // PBR 计算阶段 — AVX2 SIMD 优化
     // Vec3 运算全部使用 __m256d {r, g, b, 0}，在寄存器域内完成光照计算。
@@ -336,84 +413,75 @@ Vec3 FragmentShader::ShadeFast(const FragmentContext& ctx, const FragmentVarying
 
     __m256d s_Lo = _mm256_setzero_pd();
 
-    // 使用预计算的光照数据（指针访问，避免 vector 拷贝开销）
-    if (ctx.precomputedLights && ctx.precomputedLightCount > 0) {
-        for (size_t i = 0; i < ctx.precomputedLightCount; ++i) {
-            const PrecomputedLight& pl = ctx.precomputedLights[i];
-            __m256d s_L = v3_load(pl.L);
-
-            double ndotl = v3_dot(s_N, s_L);
-            // 光源在背面时跳过（早期退出）
-            if (ndotl <= 0.0) continue;
+    // 单个光源贡献（s_L 为归一化的指向光源方向，s_radiance 为到达片元的辐射亮度）
+    auto accumulateLight = [&](__m256d s_L, __m256d s_radiance) {
+        double ndotl = v3_dot(s_N, s_L);
+        // 光源在背面时跳过（早期退出）
+        if (ndotl <= 0.0) return;
+
+        // H = normalize(L + V)
+        __m256d s_H = _mm256_add_pd(s_L, s_V);
+        double hLenSq = v3_dot(s_H, s_H);
+        if (hLenSq > 1e-12) {
+            s_H = _mm256_mul_pd(s_H, _mm256_set1_pd(1.0 / std::sqrt(hLenSq)));
+        }
 
-            // H = normalize(L + V)
-            __m256d s_H = _mm256_add_pd(s_L, s_V);
-            double hLenSq = v3_dot(s_H, s_H);
-            if (hLenSq > 1e-12) {
-                s_H = _mm256_mul_pd(s_H, _mm256_set1_pd(1.0 / std::sqrt(hLenSq)));
-            }
+        double ndoth = std::max(0.0, v3_dot(s_N, s_H));
+        double vdoth = std::max(0.0, v3_dot(s_V, s_H));
 
-            double ndoth = std::max(0.0, v3_dot(s_N, s_H));
-            double vdoth = std::max(0.0, v3_dot(s_V, s_H));
-
-            // Cook-Torrance BRDF（标量 D/G + SIMD F/specular/diffuse）
-            __m256d s_F = FresnelSchlick_SIMD(vdoth, s_F0);
-            double D = DistributionGGX(ndoth, roughness);
-            double G = GeometrySmith(ndotv, ndotl, roughness);
-
-            // specular = F * (D*G / (4*ndotv*ndotl+eps)) * Fms
-            double specCoeff = (D * G) / (4.0 * ndotv * ndotl + 1e-12);
-            __m256d s_specular = _mm256_mul_pd(
-                _mm256_mul_pd(s_F, _mm256_set1_pd(specCoeff)), s_Fms);
-
-            // kD = (1 - F) * (1 - metallic)
-            __m256d s_kD = _mm256_mul_pd(
-                _mm256_sub_pd(s_one, s_F), s_oneMinusMetallic);
-            // diffuse = kD * albedo / π
-            __m256d s_diffuse = _mm256_mul_pd(s_kD, s_albedoOverPi);
-            if (premulAlpha < 1.0) {
-                s_diffuse = _mm256_mul_pd(s_diffuse, s_premulAlpha);
-            }
+        // Cook-Torrance BRDF（标量 D/G + SIMD F/specular/diffuse）
+        __m256d s_F = FresnelSchlick_SIMD(vdoth, s_F0);
+        double D = DistributionGGX(ndoth, roughness);
+        double G = GeometrySmith(ndotv, ndotl, roughness);
 
-            // contrib = (diffuse + specular) * ndotl * radiance
-            __m256d s_contrib = _mm256_mul_pd(
-                _mm256_add_pd(s_diffuse, s_specular), _mm256_set1_pd(ndotl));
-            s_contrib = _mm256_mul_pd(s_contrib, v3_load(pl.radiance));
+        // specular = F * (D*G / (4*ndotv*ndotl+eps)) * Fms
+        double specCoeff = (D * G) / (4.0 * ndotv * ndotl + 1e-12);
+        __m256d s_specular = _mm256_mul_pd(
+            _mm256_mul_pd(s_F, _mm256_set1_pd(specCoeff)), s_Fms);
 
-            s_Lo = _mm256_add_pd(s_Lo, s_contrib);
+        // kD = (1 - F) * (1 - metallic)
+        __m256d s_kD = _mm256_mul_pd(
+            _mm256_sub_pd(s_one, s_F), s_oneMinusMetallic);
+        // diffuse = kD * albedo / π
+        __m256d s_diffuse = _mm256_mul_pd(s_kD, s_albedoOverPi);
+        if (premulAlpha < 1.0) {
+            s_diffuse = _mm256_mul_pd(s_diffuse, s_premulAlpha);
         }
-    } else if (ctx.lights) {
-        // 回退路径（向后兼容旧版光照数据）
-        for (const DirectionalLight& light : *ctx.lights) {
-            Vec3 L = Vec3{-light.direction.x, -light.direction.y, -light.direction.z}.Normalized();
-            __m256d s_L = v3_load(L);
-            __m256d s_H = v3_load((L + V).Normalized());
-
-            double ndotl = std::max(0.0, v3_dot(s_N, s_L));
-            double ndoth = std::max(0.0, v3_dot(s_N, s_H));
-            double vdoth = std::max(0.0, v3_dot(s_V, s_H));
-
-            __m256d s_F = FresnelSchlick_SIMD(vdoth, s_F0);
-            double D = DistributionGGX(ndoth, roughness);
-            double G = GeometrySmith(ndotv, ndotl, roughness);
-
-            double specCoeff = (D * G) / (4.0 * ndotv * ndotl + 1e-12);
-            __m256d s_specular = _mm256_mul_pd(
-                _mm256_mul_pd(s_F, _mm256_set1_pd(specCoeff)), s_Fms);
-
-            __m256d s_kD = _mm256_mul_pd(
-                _mm256_sub_pd(s_one, s_F), s_oneMinusMetallic);
-            __m256d s_diffuse = _mm256_mul_pd(s_kD, s_albedoOverPi);
-            if (premulAlpha < 1.0) {
-                s_diffuse = _mm256_mul_pd(s_diffuse, s_premulAlpha);
-            }
 
-            __m256d s_radiance = _mm256_mul_pd(v3_load(light.color), _mm256_set1_pd(light.intensity));
-            __m256d s_contrib = _mm256_mul_pd(
-                _mm256_add_pd(s_diffuse, s_specular), _mm256_set1_pd(ndotl));
-            s_contrib = _mm256_mul_pd(s_contrib, s_radiance);
+        // contrib = (diffuse + specular) * ndotl * radiance
+        __m256d s_contrib = _mm256_mul_pd(
+            _mm256_add_pd(s_diffuse, s_specular), _mm256_set1_pd(ndotl));
+        s_contrib = _mm256_mul_pd(s_contrib, s_radiance);
+
+        s_Lo = _mm256_add_pd(s_Lo, s_contrib);
+    };
+
+    // 使用预计算的光照数据（指针访问，避免 vector 拷贝开销）
+    if (ctx.precomputedLights && ctx.precomputedLightCount > 0) {
+        for (size_t i = 0; i < ctx.precomputedLightCount; ++i) {
+            const PrecomputedLight& pl = ctx.precomputedLights[i];
+            // 投射阴影的平行光：仅对朝向光源的片元查询阴影贴图
+            double visibility = 1.0;
+            if (ctx.shadow && i == ctx.shadow->lightIndex && Vec3::Dot(N, pl.L) > 0.0) {
+                visibility = SampleShadow(*ctx.shadow, varying.worldPos, N);
+                if (visibility <= 0.0) {
+                    continue;
+                }
+            }
+            accumulateLight(v3_load(pl.L), v3_load(pl.radiance * visibility));
+        }
+    }
 
-            s_Lo = _mm256_add_pd(s_Lo, s_contrib);
+    // 局部光源：只遍历片元所在 Tile 的列表
+    for (size_t i = 0; i < ctx.localLightCount; ++i) {
+        const PrecomputedLocalLight& light =
+            ctx.localLights[ctx.localLightIndices ? ctx.localLightIndices[i] : i];
+        Vec3 L{light.position.x - varying.worldPos.x,
+               light.position.y - varying.worldPos.y,
+               light.position.z - varying.worldPos.z};
+        const double attenuation = EvaluateLocalLight(light, L);
+        if (attenuation > 0.0) {
+            accumulateLight(v3_load(L), v3_load(light.radiance * attenuation));
         }
     }
 
@@ -424,7 +492,7 @@ Vec3 FragmentShader::ShadeFast(const FragmentContext& ctx, const FragmentVarying
     __m256d s_ambientDiffuse;
     __m256d s_ambientSpecular;
 
-    if (ctx.environmentMap) {
+    if constexpr ((kFeatures & ShaderFeature::EnvironmentMap) != 0) {
         // --- IBL 路径 (Split-Sum) ---
         __m256d s_irradiance = v3_load(ctx.environmentMap->EvalDiffuseSH(N));
         s_ambientDiffuse = _mm256_mul_pd(
@@ -459,10 +527,9 @@ Vec3 FragmentShader::ShadeFast(const FragmentContext& ctx, const FragmentVarying
             _mm256_mul_pd(s_ambient, _mm256_set1_pd(envSmooth)));
     }
 
-    if (occlusionBinding.imageIndex >= 0) {
-        Vec2 occUv = (occlusionBinding.texCoordSet == 1) ? varying.texCoord1 : varying.texCoord;
-        SampledColor occ = SampleImageFast(ctx.images, ctx.samplers,
-            occlusionBinding.imageIndex, occlusionBinding.samplerIndex, occUv, false);
+    if constexpr ((kFeatures & ShaderFeature::OcclusionMap) != 0) {
+        const TexCoordSample occUv = GetTexCoordSample(varying, occlusionBinding.texCoordSet);
+        SampledColor occ = SampleImageFast(ctx, TextureSlot::Occlusion, occUv, false);
         // 仅对漫反射环境光应用 AO
         s_ambientDiffuse = _mm256_mul_pd(s_ambientDiffuse, _mm256_set1_pd(occ.rgb.x));
     }
@@ -471,10 +538,9 @@ Vec3 FragmentShader::ShadeFast(const FragmentContext& ctx, const FragmentVarying
 
     // 自发光
     __m256d s_emissive = v3_load(ctx.emissiveFactor);
-    if (emissiveBinding.imageIndex >= 0) {
-        Vec2 emUv = (emissiveBinding.texCoordSet == 1) ? varying.texCoord1 : varying.texCoord;
-        SampledColor emissive = SampleImageFast(ctx.images, ctx.samplers,
-            emissiveBinding.imageIndex, emissiveBinding.samplerIndex, emUv, true);
+    if constexpr ((kFeatures & ShaderFeature::EmissiveMap) != 0) {
+        const TexCoordSample emUv = GetTexCoordSample(varying, emissiveBinding.texCoordSet);
+        SampledColor emissive = SampleImageFast(ctx, TextureSlot::Emissive, emUv, true);
         s_emissive = _mm256_mul_pd(v3_load(emissive.rgb), s_emissive);
     }
     s_color = _mm256_add_pd(s_color, s_emissive);
@@ -486,4 +552,475 @@ Vec3 FragmentShader::ShadeFast(const FragmentContext& ctx, const FragmentVarying
     return v3_store(s_color);
 }
 
+} // namespace
+
+// ============================================================================
+// ShadeBatch — 4 片元 SoA 批量着色
+// 每个 __m256d 保存 4 个片元的同一分量（x/y/z 或 r/g/b 分开存放），
+// 与 ShadeFast 的 {r,g,b,0} 布局不同，标量中间量（ndotl、D、G 等）也按通道并行。
+// ============================================================================
+
+namespace {
+
+/// @brief 4 通道 SoA 三维向量
+struct Vec3x4 {
+    __m256d x;
+    __m256d y;
+    __m256d z;
+};
+
+inline __m256d Dot3x4(const Vec3x4& a, const Vec3x4& b) {
+    return _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(a.x, b.x), _mm256_mul_pd(a.y, b.y)),
+                         _mm256_mul_pd(a.z, b.z));
+}
+
+/// @brief 长度平方大于 1e-12 的通道归一化，其余通道保持原值（与标量路径一致）
+inline Vec3x4 NormalizeGuarded3x4(const Vec3x4& v) {
+    const __m256d lenSq = Dot3x4(v, v);
+    const __m256d valid = _mm256_cmp_pd(lenSq, _mm256_set1_pd(1e-12), _CMP_GT_OQ);
+    const __m256d inv = _mm256_blendv_pd(_mm256_set1_pd(1.0),
+        _mm256_div_pd(_mm256_set1_pd(1.0), _mm256_sqrt_pd(lenSq)), valid);
+    return Vec3x4{_mm256_mul_pd(v.x, inv), _mm256_mul_pd(v.y, inv), _mm256_mul_pd(v.z, inv)};
+}
+
+inline __m256d Clamp01x4(__m256d v) {
+    return _mm256_min_pd(_mm256_max_pd(v, _mm256_setzero_pd()), _mm256_set1_pd(1.0));
+}
+
+/// @brief (1 - saturate(cosθ))^5
+inline __m256d SchlickWeight4(__m256d cosTheta) {
+    const __m256d t = _mm256_sub_pd(_mm256_set1_pd(1.0), Clamp01x4(cosTheta));
+    const __m256d t2 = _mm256_mul_pd(t, t);
+    return _mm256_mul_pd(_mm256_mul_pd(t2, t2), t);
+}
+
+/// @brief GGX 法线分布（与 DistributionGGX 相同）
+inline __m256d DistributionGGX4(__m256d ndoth, __m256d a2) {
+    const __m256d denom = _mm256_add_pd(
+        _mm256_mul_pd(_mm256_mul_pd(ndoth, ndoth), _mm256_sub_pd(a2, _mm256_set1_pd(1.0))),
+        _mm256_set1_pd(1.0));
+    return _mm256_div_pd(_mm256_mul_pd(a2, _mm256_set1_pd(kInvPiPBR)),
+                         _mm256_add_pd(_mm256_mul_pd(denom, denom), _mm256_set1_pd(1e-12)));
+}
+
+/// @brief Schlick-GGX 单向遮蔽（k 为按通道预计算的 (r+1)^2/8）
+inline __m256d GeometrySchlickGGX4(__m256d ndotx, __m256d k) {
+    const __m256d denom = _mm256_add_pd(
+        _mm256_add_pd(_mm256_mul_pd(ndotx, _mm256_sub_pd(_mm256_set1_pd(1.0), k)), k),
+        _mm256_set1_pd(1e-12));
+    return _mm256_div_pd(ndotx, denom);
+}
+
+/**
+ * @brief 4 片元批量着色（按特性掩码特化的变体）
+ *
+ * 阶段划分：
+ *   1. SIMD：N/V 归一化与双面翻转
+ *   2. 逐通道：纹理采样（基础色/透射/金属度-粗糙度/法线贴图），与 ShadeFast 共用 EvaluateSurfaceInputs
+ *   3. SIMD：F0、DFG 多重散射补偿、逐光源 GGX/Smith/Fresnel、SH 辐照度与环境光组合
+ *   4. 逐通道：IBL 镜面预过滤与 BRDF LUT 查表、AO/自发光贴图
+ */
+template <ShaderFeatureMask kFeatures>
+void ShadeBatchT(const FragmentContext& ctx, const FragmentVaryingBatch& in, int activeMask,
+                 FragmentOutputBatch& out) {
+    constexpr int kLanes = FragmentVaryingBatch::kLanes;
+    const __m256d one = _mm256_set1_pd(1.0);
+    const __m256d zero = _mm256_setzero_pd();
+
+    // ---- 1. 几何法线与视线方向 ----
+    Vec3x4 N = NormalizeGuarded3x4(Vec3x4{
+        _mm256_load_pd(in.normalX), _mm256_load_pd(in.normalY), _mm256_load_pd(in.normalZ)});
+    Vec3x4 V = NormalizeGuarded3x4(Vec3x4{
+        _mm256_sub_pd(_mm256_set1_pd(ctx.cameraPos.x), _mm256_load_pd(in.worldX)),
+        _mm256_sub_pd(_mm256_set1_pd(ctx.cameraPos.y), _mm256_load_pd(in.worldY)),
+        _mm256_sub_pd(_mm256_set1_pd(ctx.cameraPos.z), _mm256_load_pd(in.worldZ))});
+    if constexpr ((kFeatures & ShaderFeature::DoubleSided) != 0) {
+        // 双面渲染：法线背向视线的通道翻转
+        const __m256d flip = _mm256_cmp_pd(Dot3x4(N, V), zero, _CMP_LT_OQ);
+        const __m256d signMask = _mm256_and_pd(flip, _mm256_set1_pd(-0.0));
+        N.x = _mm256_xor_pd(N.x, signMask);
+        N.y = _mm256_xor_pd(N.y, signMask);
+        N.z = _mm256_xor_pd(N.z, signMask);
+    }
+
+    // ---- 2. 纹理采样（逐通道） ----
+    alignas(32) double nX[kLanes], nY[kLanes], nZ[kLanes];
+    _mm256_store_pd(nX, N.x);
+    _mm256_store_pd(nY, N.y);
+    _mm256_store_pd(nZ, N.z);
+
+    alignas(32) double albR[kLanes], albG[kLanes], albB[kLanes];
+    alignas(32) double alphaL[kLanes], metalL[kLanes], roughL[kLanes];
+    for (int lane = 0; lane < kLanes; ++lane) {
+        if (!(activeMask & (1 << lane))) {
+            // 无效通道填充材质常量，避免无意义数据进入后续 SIMD 计算
+            albR[lane] = albG[lane] = albB[lane] = 0.0;
+            alphaL[lane] = 1.0;
+            metalL[lane] = 0.0;
+            roughL[lane] = 0.5;
+            continue;
+        }
+        Vec3 laneN{nX[lane], nY[lane], nZ[lane]};
+        SurfaceInputs surface = EvaluateSurfaceInputs<kFeatures>(ctx,
+            GetTexCoordSample(in, lane, 0), GetTexCoordSample(in, lane, 1),
+            Vec4{in.colorR[lane], in.colorG[lane], in.colorB[lane], in.colorA[lane]},
+            Vec3{in.tangentX[lane], in.tangentY[lane], in.tangentZ[lane]}, laneN);
+        nX[lane] = laneN.x;
+        nY[lane] = laneN.y;
+        nZ[lane] = laneN.z;
+        albR[lane] = surface.albedo.x;
+        albG[lane] = surface.albedo.y;
+        albB[lane] = surface.albedo.z;
+        alphaL[lane] = surface.alpha;
+        metalL[lane] = surface.metallic;
+        roughL[lane] = surface.roughness;
+    }
+    N = Vec3x4{_mm256_load_pd(nX), _mm256_load_pd(nY), _mm256_load_pd(nZ)};
+    const Vec3x4 albedo{_mm256_load_pd(albR), _mm256_load_pd(albG), _mm256_load_pd(albB)};
+    const __m256d alpha = _mm256_load_pd(alphaL);
+    const __m256d metallic = _mm256_load_pd(metalL);
+    const __m256d roughness = _mm256_load_pd(roughL);
+
+    // ---- 3. PBR 计算（SIMD 跨通道） ----
+    // 电介质 F0 = ((ior-1)/(ior+1))^2 × KHR_materials_specular 修正；F0 = lerp(dielectricF0, albedo, metallic)
+    double iorF0 = (ctx.ior - 1.0) / (ctx.ior + 1.0);
+    iorF0 = iorF0 * iorF0;
+    const double specScale = iorF0 * ctx.specularFactor;
+    const __m256d dielectricR = _mm256_set1_pd(ctx.specularColorFactor.x * specScale);
+    const __m256d dielectricG = _mm256_set1_pd(ctx.specularColorFactor.y * specScale);
+    const __m256d dielectricB = _mm256_set1_pd(ctx.specularColorFactor.z * specScale);
+    const Vec3x4 F0{
+        _mm256_fmadd_pd(_mm256_sub_pd(albedo.x, dielectricR), metallic, dielectricR),
+        _mm256_fmadd_pd(_mm256_sub_pd(albedo.y, dielectricG), metallic, dielectricG),
+        _mm256_fmadd_pd(_mm256_sub_pd(albedo.z, dielectricB), metallic, dielectricB)};
+
+    // BLEND 模式下预乘 Alpha（非 Blend 时为 1，乘法不改变结果）
+    const __m256d premulAlpha = (ctx.alphaMode == GLTFAlphaMode::Blend) ? Clamp01x4(alpha) : one;
+
+    const __m256d ndotv = _mm256_max_pd(zero, Dot3x4(N, V));
+    alignas(32) double ndotvL[kLanes];
+    _mm256_store_pd(ndotvL, ndotv);
+
+    // 多重散射 GGX 能量补偿：DFG 近似中的 2^x 逐通道计算，其余 SIMD
+    alignas(32) double pow2L[kLanes];
+    for (int lane = 0; lane < kLanes; ++lane) {
+        pow2L[lane] = std::pow(2.0, -9.28 * ndotvL[lane]);
+    }
+    const __m256d rA = _mm256_sub_pd(one, roughness);
+    const __m256d rB = _mm256_fmadd_pd(roughness, _mm256_set1_pd(-0.0275), _mm256_set1_pd(0.0425));
+    const __m256d rC = _mm256_fmadd_pd(roughness, _mm256_set1_pd(-0.572), _mm256_set1_pd(1.04));
+    const __m256d rD = _mm256_fmadd_pd(roughness, _mm256_set1_pd(0.022), _mm256_set1_pd(-0.04));
+    const __m256d a004 = _mm256_fmadd_pd(
+        _mm256_min_pd(_mm256_mul_pd(rA, rA), _mm256_load_pd(pow2L)), rA, rB);
+    const __m256d dfgScale = _mm256_fmadd_pd(_mm256_set1_pd(-1.04), a004, rC);
+    const __m256d dfgBias = _mm256_add_pd(a004, rD);
+
+    auto multiscatter = [&](__m256d f0) {
+        const __m256d ess = _mm256_max_pd(_mm256_fmadd_pd(f0, dfgScale, dfgBias), _mm256_set1_pd(1e-4));
+        return _mm256_fmadd_pd(f0, _mm256_sub_pd(_mm256_div_pd(one, ess), one), one);
+    };
+    const Vec3x4 Fms{multiscatter(F0.x), multiscatter(F0.y), multiscatter(F0.z)};
+
+    const __m256d invPi = _mm256_set1_pd(1.0 / kPi);
+    const Vec3x4 albedoOverPi{_mm256_mul_pd(albedo.x, invPi), _mm256_mul_pd(albedo.y, invPi),
+                              _mm256_mul_pd(albedo.z, invPi)};
+    const __m256d oneMinusMetallic = _mm256_sub_pd(one, metallic);
+
+    // 粗糙度相关的 GGX / Smith 常量（逐通道）
+    const __m256d a = _mm256_mul_pd(roughness, roughness);
+    const __m256d a2 = _mm256_mul_pd(a, a);
+    const __m256d rPlusOne = _mm256_add_pd(roughness, one);
+    const __m256d kSmith = _mm256_mul_pd(_mm256_mul_pd(rPlusOne, rPlusOne), _mm256_set1_pd(0.125));
+    const __m256d gView = GeometrySchlickGGX4(ndotv, kSmith);
+
+    Vec3x4 Lo{zero, zero, zero};
+    const int allLanes = (1 << kLanes) - 1;
+
+    // 单个光源贡献（逐通道方向与辐射亮度）；ndotl <= 0 的通道不累加（与标量路径的 return 一致）
+    auto accumulateLight = [&](const Vec3x4& Lv, const Vec3x4& radiance) {
+        const __m256d ndotl = Dot3x4(N, Lv);
+        const __m256d lit = _mm256_cmp_pd(ndotl, zero, _CMP_GT_OQ);
+        if ((_mm256_movemask_pd(lit) & activeMask & allLanes) == 0) {
+            return;
+        }
+
+        const Vec3x4 H = NormalizeGuarded3x4(Vec3x4{
+            _mm256_add_pd(Lv.x, V.x), _mm256_add_pd(Lv.y, V.y), _mm256_add_pd(Lv.z, V.z)});
+        const __m256d ndoth = _mm256_max_pd(zero, Dot3x4(N, H));
+        const __m256d vdoth = _mm256_max_pd(zero, Dot3x4(V, H));
+
+        const __m256d fw = SchlickWeight4(vdoth);
+        const Vec3x4 F{_mm256_fmadd_pd(_mm256_sub_pd(one, F0.x), fw, F0.x),
+                       _mm256_fmadd_pd(_mm256_sub_pd(one, F0.y), fw, F0.y),
+                       _mm256_fmadd_pd(_mm256_sub_pd(one, F0.z), fw, F0.z)};
+        const __m256d D = DistributionGGX4(ndoth, a2);
+        const __m256d G = _mm256_mul_pd(gView, GeometrySchlickGGX4(ndotl, kSmith));
+        const __m256d specCoeff = _mm256_div_pd(_mm256_mul_pd(D, G),
+            _mm256_add_pd(_mm256_mul_pd(_mm256_mul_pd(_mm256_set1_pd(4.0), ndotv), ndotl), _mm256_set1_pd(1e-12)));
+
+        auto channel = [&](__m256d f, __m256d fms, __m256d albOverPi, __m256d rad, __m256d lo) {
+            const __m256d specular = _mm256_mul_pd(_mm256_mul_pd(f, specCoeff), fms);
+            const __m256d kD = _mm256_mul_pd(_mm256_sub_pd(one, f), oneMinusMetallic);
+            const __m256d diffuse = _mm256_mul_pd(_mm256_mul_pd(kD, albOverPi), premulAlpha);
+            __m256d contrib = _mm256_mul_pd(_mm256_add_pd(diffuse, specular), ndotl);
+            contrib = _mm256_mul_pd(contrib, rad);
+            return _mm256_add_pd(lo, _mm256_and_pd(contrib, lit));
+        };
+        Lo.x = channel(F.x, Fms.x, albedoOverPi.x, radiance.x, Lo.x);
+        Lo.y = channel(F.y, Fms.y, albedoOverPi.y, radiance.y, Lo.y);
+        Lo.z = channel(F.z, Fms.z, albedoOverPi.z, radiance.z, Lo.z);
+    };
+
+    if (ctx.precomputedLights && ctx.precomputedLightCount > 0) {
+        for (size_t i = 0; i < ctx.precomputedLightCount; ++i) {
+            const PrecomputedLight& pl = ctx.precomputedLights[i];
+            // 投射阴影的平行光：逐通道查询阴影贴图（背光通道不查询）
+            __m256d visibility = one;
+            if (ctx.shadow && i == ctx.shadow->lightIndex) {
+                alignas(32) double visL[kLanes];
+                for (int lane = 0; lane < kLanes; ++lane) {
+                    const Vec3 laneN{nX[lane], nY[lane], nZ[lane]};
+                    visL[lane] = ((activeMask & (1 << lane)) && Vec3::Dot(laneN, pl.L) > 0.0)
+                        ? SampleShadow(*ctx.shadow, Vec3{in.worldX[lane], in.worldY[lane], in.worldZ[lane]}, laneN)
+                        : 1.0;
+                }
+                visibility = _mm256_load_pd(visL);
+            }
+            accumulateLight(Vec3x4{_mm256_set1_pd(pl.L.x), _mm256_set1_pd(pl.L.y), _mm256_set1_pd(pl.L.z)},
+                            Vec3x4{_mm256_mul_pd(_mm256_set1_pd(pl.radiance.x), visibility),
+                                   _mm256_mul_pd(_mm256_set1_pd(pl.radiance.y), visibility),
+                                   _mm256_mul_pd(_mm256_set1_pd(pl.radiance.z), visibility)});
+        }
+    }
+
+    // 局部光源：衰减与方向逐通道 SIMD 计算，只遍历片元所在 Tile 的列表
+    if (ctx.localLightCount > 0) {
+        const __m256d worldX = _mm256_load_pd(in.worldX);
+        const __m256d worldY = _mm256_load_pd(in.worldY);
+        const __m256d worldZ = _mm256_load_pd(in.worldZ);
+        for (size_t i = 0; i < ctx.localLightCount; ++i) {
+            const PrecomputedLocalLight& light =
+                ctx.localLights[ctx.localLightIndices ? ctx.localLightIndices[i] : i];
+            const Vec3x4 toLight{_mm256_sub_pd(_mm256_set1_pd(light.position.x), worldX),
+                                 _mm256_sub_pd(_mm256_set1_pd(light.position.y), worldY),
+                                 _mm256_sub_pd(_mm256_set1_pd(light.position.z), worldZ)};
+            const __m256d distSq = Dot3x4(toLight, toLight);
+            const __m256d t = _mm256_mul_pd(distSq, _mm256_set1_pd(light.invRangeSq));
+            const __m256d inRange = _mm256_cmp_pd(t, one, _CMP_LT_OQ);
+            if ((_mm256_movemask_pd(inRange) & activeMask & allLanes) == 0) {
+                continue;
+            }
+            const __m256d invDist = _mm256_div_pd(one, _mm256_sqrt_pd(_mm256_max_pd(distSq, _mm256_set1_pd(1e-24))));
+            const Vec3x4 Lv{_mm256_mul_pd(toLight.x, invDist), _mm256_mul_pd(toLight.y, invDist),
+                            _mm256_mul_pd(toLight.z, invDist)};
+            const __m256d window = _mm256_max_pd(zero, _mm256_fnmadd_pd(t, t, one));
+            const __m256d spot = Clamp01x4(_mm256_fmadd_pd(
+                _mm256_sub_pd(zero, Dot3x4(Lv, Vec3x4{_mm256_set1_pd(light.direction.x),
+                                                      _mm256_set1_pd(light.direction.y),
+                                                      _mm256_set1_pd(light.direction.z)})),
+                _mm256_set1_pd(light.spotScale), _mm256_set1_pd(light.spotOffset)));
+            const __m256d attenuation = _mm256_div_pd(
+                _mm256_mul_pd(_mm256_mul_pd(window, window), _mm256_mul_pd(spot, spot)),
+                _mm256_max_pd(distSq, _mm256_set1_pd(kMinLocalLightDistSq)));
+            accumulateLight(Lv, Vec3x4{_mm256_mul_pd(_mm256_set1_pd(light.radiance.x), attenuation),
+                                       _mm256_mul_pd(_mm256_set1_pd(light.radiance.y), attenuation),
+                                       _mm256_mul_pd(_mm256_set1_pd(light.radiance.z), attenuation)});
+        }
+    }
+
+    // === Ambient: diffuse + specular ===
+    const __m256d envWeight = SchlickWeight4(ndotv);
+    const Vec3x4 kSEnv{_mm256_fmadd_pd(_mm256_sub_pd(one, F0.x), envWeight, F0.x),
+                       _mm256_fmadd_pd(_mm256_sub_pd(one, F0.y), envWeight, F0.y),
+                       _mm256_fmadd_pd(_mm256_sub_pd(one, F0.z), envWeight, F0.z)};
+    const Vec3x4 kDEnv{_mm256_mul_pd(_mm256_sub_pd(one, kSEnv.x), oneMinusMetallic),
+                       _mm256_mul_pd(_mm256_sub_pd(one, kSEnv.y), oneMinusMetallic),
+                       _mm256_mul_pd(_mm256_sub_pd(one, kSEnv.z), oneMinusMetallic)};
+
+    Vec3x4 ambientDiffuse;
+    Vec3x4 ambientSpecular;
+    if constexpr ((kFeatures & ShaderFeature::EnvironmentMap) != 0) {
+        // --- IBL 路径 (Split-Sum)：SH 辐照度 SIMD，镜面预过滤与 LUT 逐通道查表 ---
+        alignas(32) double irrR[kLanes], irrG[kLanes], irrB[kLanes];
+        ctx.environmentMap->EvalDiffuseSH4(nX, nY, nZ, irrR, irrG, irrB);
+        auto diffuseChannel = [&](__m256d kd, __m256d alb, const double* irr) {
+            return _mm256_mul_pd(_mm256_mul_pd(_mm256_mul_pd(kd, alb),
+                _mm256_mul_pd(_mm256_load_pd(irr), invPi)), premulAlpha);
+        };
+        ambientDiffuse = Vec3x4{diffuseChannel(kDEnv.x, albedo.x, irrR),
+                                diffuseChannel(kDEnv.y, albedo.y, irrG),
+                                diffuseChannel(kDEnv.z, albedo.z, irrB)};
+
+        // 反射方向 R = 2*ndotv*N - V
+        const __m256d twoNdotV = _mm256_mul_pd(_mm256_set1_pd(2.0), ndotv);
+        const Vec3x4 R = NormalizeGuarded3x4(Vec3x4{
+            _mm256_fmsub_pd(twoNdotV, N.x, V.x),
+            _mm256_fmsub_pd(twoNdotV, N.y, V.y),
+            _mm256_fmsub_pd(twoNdotV, N.z, V.z)});
+        alignas(32) double rX[kLanes], rY[kLanes], rZ[kLanes];
+        _mm256_store_pd(rX, R.x);
+        _mm256_store_pd(rY, R.y);
+        _mm256_store_pd(rZ, R.z);
+
+        alignas(32) double preR[kLanes], preG[kLanes], preB[kLanes], brdfX[kLanes], brdfY[kLanes];
+        for (int lane = 0; lane < kLanes; ++lane) {
+            if (!(activeMask & (1 << lane))) {
+                preR[lane] = preG[lane] = preB[lane] = brdfX[lane] = brdfY[lane] = 0.0;
+                continue;
+            }
+            Vec3 prefiltered = ctx.environmentMap->SampleSpecular(Vec3{rX[lane], rY[lane], rZ[lane]}, roughL[lane]);
+            Vec2 brdf = ctx.environmentMap->LookupBRDF(ndotvL[lane], roughL[lane]);
+            preR[lane] = prefiltered.x;
+            preG[lane] = prefiltered.y;
+            preB[lane] = prefiltered.z;
+            brdfX[lane] = brdf.x;
+            brdfY[lane] = brdf.y;
+        }
+        const __m256d bx = _mm256_load_pd(brdfX);
+        const __m256d by = _mm256_load_pd(brdfY);
+        auto specularChannel = [&](__m256d f0, __m256d fms, const double* pre) {
+            return _mm256_mul_pd(_mm256_mul_pd(_mm256_load_pd(pre), _mm256_fmadd_pd(f0, bx, by)), fms);
+        };
+        ambientSpecular = Vec3x4{specularChannel(F0.x, Fms.x, preR),
+                                 specularChannel(F0.y, Fms.y, preG),
+                                 specularChannel(F0.z, Fms.z, preB)};
+    } else {
+        // --- 回退：常量环境光 ---
+        const __m256d envSmooth = _mm256_sub_pd(one, _mm256_mul_pd(roughness, roughness));
+        auto ambientChannel = [&](double ambient, __m256d kd, __m256d ks, __m256d fms, __m256d alb,
+                                  __m256d& outDiffuse, __m256d& outSpecular) {
+            const __m256d amb = _mm256_set1_pd(ambient);
+            outDiffuse = _mm256_mul_pd(_mm256_mul_pd(amb, _mm256_mul_pd(kd, alb)), premulAlpha);
+            outSpecular = _mm256_mul_pd(_mm256_mul_pd(ks, fms), _mm256_mul_pd(amb, envSmooth));
+        };
+        ambientChannel(ctx.ambientColor.x, kDEnv.x, kSEnv.x, Fms.x, albedo.x, ambientDiffuse.x, ambientSpecular.x);
+        ambientChannel(ctx.ambientColor.y, kDEnv.y, kSEnv.y, Fms.y, albedo.y, ambientDiffuse.y, ambientSpecular.y);
+        ambientChannel(ctx.ambientColor.z, kDEnv.z, kSEnv.z, Fms.z, albedo.z, ambientDiffuse.z, ambientSpecular.z);
+    }
+
+    // ---- 4. AO 与自发光贴图（逐通道采样） ----
+    const TextureBinding& occlusionBinding = ctx.textures[static_cast<size_t>(TextureSlot::Occlusion)];
+    const TextureBinding& emissiveBinding = ctx.textures[static_cast<size_t>(TextureSlot::Emissive)];
+    if constexpr ((kFeatures & ShaderFeature::OcclusionMap) != 0) {
+        alignas(32) double occL[kLanes];
+        for (int lane = 0; lane < kLanes; ++lane) {
+            occL[lane] = 1.0;
+            if (activeMask & (1 << lane)) {
+                const TexCoordSample occUv = GetTexCoordSample(in, lane, occlusionBinding.texCoordSet);
+                occL[lane] = SampleImageFast(ctx, TextureSlot::Occlusion, occUv, false).rgb.x;
+            }
+        }
+        // 仅对漫反射环境光应用 AO
+        const __m256d occ = _mm256_load_pd(occL);
+        ambientDiffuse.x = _mm256_mul_pd(ambientDiffuse.x, occ);
+        ambientDiffuse.y = _mm256_mul_pd(ambientDiffuse.y, occ);
+        ambientDiffuse.z = _mm256_mul_pd(ambientDiffuse.z, occ);
+    }
+
+    Vec3x4 color{_mm256_add_pd(_mm256_add_pd(ambientDiffuse.x, ambientSpecular.x), Lo.x),
+                 _mm256_add_pd(_mm256_add_pd(ambientDiffuse.y, ambientSpecular.y), Lo.y),
+                 _mm256_add_pd(_mm256_add_pd(ambientDiffuse.z, ambientSpecular.z), Lo.z)};
+
+    if constexpr ((kFeatures & ShaderFeature::EmissiveMap) != 0) {
+        alignas(32) double emR[kLanes], emG[kLanes], emB[kLanes];
+        for (int lane = 0; lane < kLanes; ++lane) {
+            emR[lane] = emG[lane] = emB[lane] = 0.0;
+            if (activeMask & (1 << lane)) {
+                const TexCoordSample emUv = GetTexCoordSample(in, lane, emissiveBinding.texCoordSet);
+                Vec3 emissive = SampleImageFast(ctx, TextureSlot::Emissive, emUv, true).rgb;
+                emR[lane] = emissive.x * ctx.emissiveFactor.x;
+                emG[lane] = emissive.y * ctx.emissiveFactor.y;
+                emB[lane] = emissive.z * ctx.emissiveFactor.z;
+            }
+        }
+        color.x = _mm256_add_pd(color.x, _mm256_load_pd(emR));
+        color.y = _mm256_add_pd(color.y, _mm256_load_pd(emG));
+        color.z = _mm256_add_pd(color.z, _mm256_load_pd(emB));
+    } else {
+        color.x = _mm256_add_pd(color.x, _mm256_set1_pd(ctx.emissiveFactor.x));
+        color.y = _mm256_add_pd(color.y, _mm256_set1_pd(ctx.emissiveFactor.y));
+        color.z = _mm256_add_pd(color.z, _mm256_set1_pd(ctx.emissiveFactor.z));
+    }
+
+    _mm256_store_pd(out.r, color.x);
+    _mm256_store_pd(out.g, color.y);
+    _mm256_store_pd(out.b, color.z);
+    _mm256_store_pd(out.alpha, alpha);
+}
+
+// ============================================================================
+// 着色器变体表：特性掩码 → 模板特化函数指针（编译期生成全部组合）
+// ============================================================================
+
+template <size_t... kMasks>
+constexpr std::array<ShaderPermutation, kShaderPermutationCount> MakePermutationTable(std::index_sequence<kMasks...>) {
+    return {{ShaderPermutation{&ShadeFastT<static_cast<ShaderFeatureMask>(kMasks)>,
+                               &ShadeBatchT<static_cast<ShaderFeatureMask>(kMasks)>}...}};
+}
+
+constexpr std::array<ShaderPermutation, kShaderPermutationCount> kPermutationTable =
+    MakePermutationTable(std::make_index_sequence<kShaderPermutationCount>{});
+
+/**
+ * @brief 旧版光照数据转换为预计算光照
+ *
+ * 变体只读取 precomputedLights；调用方仅提供 ctx.lights 时在此转换一次，
+ * 返回指向 storage 的上下文副本（无需转换时返回原上下文）。
+ */
+const FragmentContext& ResolveLights(const FragmentContext& ctx, FragmentContext& storage,
+                                     std::vector<PrecomputedLight>& lights) {
+    if ((ctx.precomputedLights && ctx.precomputedLightCount > 0) || !ctx.lights || ctx.lights->empty()) {
+        return ctx;
+    }
+    lights.clear();
+    lights.reserve(ctx.lights->size());
+    for (const DirectionalLight& light : *ctx.lights) {
+        PrecomputedLight pl;
+        pl.L = Vec3{-light.direction.x, -light.direction.y, -light.direction.z}.Normalized();
+        pl.radiance = light.color * light.intensity;
+        lights.push_back(pl);
+    }
+    storage = ctx;
+    storage.precomputedLights = lights.data();
+    storage.precomputedLightCount = lights.size();
+    return storage;
+}
+
+} // namespace
+
+ShaderFeatureMask FragmentShader::ComputeFeatureMask(const FragmentContext& ctx) {
+    auto hasImage = [&ctx](TextureSlot slot) {
+        return ctx.textures[static_cast<size_t>(slot)].imageIndex >= 0;
+    };
+    ShaderFeatureMask mask = 0;
+    if (hasImage(TextureSlot::BaseColor)) mask |= ShaderFeature::BaseColorMap;
+    if (hasImage(TextureSlot::MetallicRoughness)) mask |= ShaderFeature::MetallicRoughnessMap;
+    if (hasImage(TextureSlot::Normal)) mask |= ShaderFeature::NormalMap;
+    if (hasImage(TextureSlot::Occlusion)) mask |= ShaderFeature::OcclusionMap;
+    if (hasImage(TextureSlot::Emissive)) mask |= ShaderFeature::EmissiveMap;
+    if (ctx.transmissionFactor > 0.0 || hasImage(TextureSlot::Transmission)) mask |= ShaderFeature::Transmission;
+    if (ctx.doubleSided) mask |= ShaderFeature::DoubleSided;
+    if (ctx.environmentMap) mask |= ShaderFeature::EnvironmentMap;
+    return mask;
+}
+
+const ShaderPermutation& FragmentShader::GetPermutation(ShaderFeatureMask features) {
+    return kPermutationTable[features & (kShaderPermutationCount - 1)];
+}
+
+Vec3 FragmentShader::ShadeFast(const FragmentContext& ctx, const FragmentVarying& varying, double* outEffectiveAlpha) const {
+    FragmentContext resolved;
+    std::vector<PrecomputedLight> lights;
+    const FragmentContext& shadeCtx = ResolveLights(ctx, resolved, lights);
+    return GetPermutation(ComputeFeatureMask(shadeCtx)).shadeFast(shadeCtx, varying, outEffectiveAlpha);
+}
+
+void FragmentShader::ShadeBatch(const FragmentContext& ctx, const FragmentVaryingBatch& batch, int activeMask,
+                                FragmentOutputBatch& out) const {
+    FragmentContext resolved;
+    std::vector<PrecomputedLight> lights;
+    const FragmentContext& shadeCtx = ResolveLights(ctx, resolved, lights);
+    GetPermutation(ComputeFeatureMask(shadeCtx)).shadeBatch(shadeCtx, batch, activeMask, out);
+}
+
 } // namespace SR
@@ -1,10 +1,219 @@
 #include "Pipeline/GeometryProcessor.h"
 
+#include <algorithm>
+#include <bit>
+
+#include "Pipeline/PreClipCuller.h"
 #include "Pipeline/Rasterizer.h"
 #include "Pipeline/VertexShader.h"
 
 namespace SR {
 
+namespace {
+
+/// 双精度源顶点读取（未打包网格）
+struct SourceVertexFetch {
+    const Vertex* vertices = nullptr;
+
+    Vec4 Position(uint32_t i) const {
+        const Vec3& p = vertices[i].position;
+        return Vec4{p.x, p.y, p.z, 1.0};
+    }
+
+    Vec3 Normal(uint32_t i) const {
+        return vertices[i].normal;
+    }
+
+    void Attributes(uint32_t i, Triangle& tri, int corner) const {
+        const Vertex& v = vertices[i];
+        Vec2* uv0[3] = {&tri.t0, &tri.t1, &tri.t2};
+        Vec2* uv1[3] = {&tri.t0_1, &tri.t1_1, &tri.t2_1};
+        Vec4* color[3] = {&tri.c0, &tri.c1, &tri.c2};
+        Vec3* tangent[3] = {&tri.tg0, &tri.tg1, &tri.tg2};
+        *uv0[corner] = v.texCoord;
+        *uv1[corner] = v.texCoord1;
+        *color[corner] = v.color;
+        *tangent[corner] = v.tangent;
+        if (corner == 0) {
+            tri.tangentW = v.tangentW;
+        }
+    }
+};
+
+/// 打包顶点读取：位置保持原始存储值（UNorm16 反量化已并入矩阵），其余属性在此解码
+struct PackedVertexFetch {
+    const PackedVertexBuffer* buffer = nullptr;
+
+    Vec4 Position(uint32_t i) const {
+        return buffer->GetRawPosition(i);
+    }
+
+    Vec3 Normal(uint32_t i) const {
+        const PackedVertex& a = buffer->attributes[i];
+        return DecodeOctahedral(a.normalOct[0], a.normalOct[1]);
+    }
+
+    void Attributes(uint32_t i, Triangle& tri, int corner) const {
+        const PackedVertex& a = buffer->attributes[i];
+        Vec2* uv0[3] = {&tri.t0, &tri.t1, &tri.t2};
+        Vec2* uv1[3] = {&tri.t0_1, &tri.t1_1, &tri.t2_1};
+        Vec4* color[3] = {&tri.c0, &tri.c1, &tri.c2};
+        Vec3* tangent[3] = {&tri.tg0, &tri.tg1, &tri.tg2};
+        *uv0[corner] = Vec2{HalfToFloat(a.texCoord[0]), HalfToFloat(a.texCoord[1])};
+        *uv1[corner] = Vec2{HalfToFloat(a.texCoord1[0]), HalfToFloat(a.texCoord1[1])};
+        *color[corner] = UnpackRGBA8(a.color);
+        *tangent[corner] = DecodeOctahedral(a.tangentOct[0], a.tangentOct[1]);
+        if (corner == 0) {
+            bool negative = a.tangentOct[1] != kOctZeroSentinel && (a.tangentOct[1] & 1) != 0;
+            tri.tangentW = negative ? -1.0 : 1.0;
+        }
+    }
+};
+
+/**
+ * @brief 单个渲染项的三角形构建（顶点读取方式由 Fetch 决定）
+ *
+ * positionModel / positionMVP 已包含网格的反量化变换，可直接作用于 Fetch::Position 的原始值。
+ * preClipCull 为 false 时跳过裁剪前剔除，所有索引有效的三角形都会输出。
+ */
+template <typename Fetch>
+void BuildTrianglesT(const Fetch& fetch,
+                     size_t vertexCount,
+                     const std::vector<uint32_t>& indices,
+                     const Mat4& positionModel,
+                     const Mat4& positionMVP,
+                     const Mat4& normalMatrix,
+                     bool preClipCull,
+                     bool cullBackface,
+                     MaterialHandle materialHandle,
+                     ArenaVector<Triangle>& outTriangles,
+                     RasterStats& cullStats) {
+    VertexShader vertexShader;
+    vertexShader.SetMVP(positionMVP);
+
+    PreClipCuller culler;
+    PreClipCullBatch batch;
+    uint32_t batchIndices[PreClipCullBatch::kSize][3];
+    Vec4 batchClip[PreClipCullBatch::kSize][3];
+    int lane = 0;
+
+    auto emitTriangle = [&](const uint32_t* idx, const Vec4* clip) {
+        Triangle tri{};
+        tri.v0 = clip[0];
+        tri.v1 = clip[1];
+        tri.v2 = clip[2];
+
+        fetch.Attributes(idx[0], tri, 0);
+        fetch.Attributes(idx[1], tri, 1);
+        fetch.Attributes(idx[2], tri, 2);
+
+        Vec4 wp0 = positionModel.Multiply(fetch.Position(idx[0]));
+        Vec4 wp1 = positionModel.Multiply(fetch.Position(idx[1]));
+        Vec4 wp2 = positionModel.Multiply(fetch.Position(idx[2]));
+
+        Vec3 n0 = fetch.Normal(idx[0]);
+        Vec3 n1 = fetch.Normal(idx[1]);
+        Vec3 n2 = fetch.Normal(idx[2]);
+        Vec4 wn0 = normalMatrix.Multiply(Vec4{n0.x, n0.y, n0.z, 0.0});
+        Vec4 wn1 = normalMatrix.Multiply(Vec4{n1.x, n1.y, n1.z, 0.0});
+        Vec4 wn2 = normalMatrix.Multiply(Vec4{n2.x, n2.y, n2.z, 0.0});
+
+        tri.w0 = Vec3{wp0.x, wp0.y, wp0.z};
+        tri.w1 = Vec3{wp1.x, wp1.y, wp1.z};
+        tri.w2 = Vec3{wp2.x, wp2.y, wp2.z};
+
+        tri.n0 = Vec3{wn0.x, wn0.y, wn0.z}.Normalized();
+        tri.n1 = Vec3{wn1.x, wn1.y, wn1.z}.Normalized();
+        tri.n2 = Vec3{wn2.x, wn2.y, wn2.z}.Normalized();
+
+        tri.materialId = materialHandle;
+
+        outTriangles.push_back(tri);
+    };
+
+    auto flushBatch = [&]() {
+        uint32_t alive = culler.CullBatch(batch, lane, cullBackface, cullStats);
+        while (alive != 0u) {
+            int l = std::countr_zero(alive);
+            alive &= alive - 1u;
+            emitTriangle(batchIndices[l], batchClip[l]);
+        }
+        lane = 0;
+    };
+
+    for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+        uint32_t i0 = indices[i];
+        uint32_t i1 = indices[i + 1];
+        uint32_t i2 = indices[i + 2];
+        if (i0 >= vertexCount || i1 >= vertexCount || i2 >= vertexCount) {
+            continue;
+        }
+
+        batchIndices[lane][0] = i0;
+        batchIndices[lane][1] = i1;
+        batchIndices[lane][2] = i2;
+        batchClip[lane][0] = vertexShader.TransformPosition(fetch.Position(i0));
+        batchClip[lane][1] = vertexShader.TransformPosition(fetch.Position(i1));
+        batchClip[lane][2] = vertexShader.TransformPosition(fetch.Position(i2));
+        if (!preClipCull) {
+            emitTriangle(batchIndices[lane], batchClip[lane]);
+            continue;
+        }
+        batch.Set(lane, batchClip[lane][0], batchClip[lane][1], batchClip[lane][2]);
+
+        if (++lane == PreClipCullBatch::kSize) {
+            flushBatch();
+        }
+    }
+    if (lane > 0) {
+        flushBatch();
+    }
+}
+
+/**
+ * @brief 构建实例共享的三角形模板及物体空间顶点缓存（顶点读取方式由 Fetch 决定）
+ */
+template <typename Fetch>
+void FillInstanceTemplatesT(const Fetch& fetch,
+                            size_t vertexCount,
+                            const std::vector<uint32_t>& indices,
+                            MaterialHandle materialHandle,
+                            std::vector<Triangle>& templates,
+                            std::vector<uint32_t>& templateIndices,
+                            std::vector<Vec4>& positions,
+                            std::vector<Vec3>& normals) {
+    positions.resize(vertexCount);
+    normals.resize(vertexCount);
+    for (size_t v = 0; v < vertexCount; ++v) {
+        positions[v] = fetch.Position(static_cast<uint32_t>(v));
+        normals[v] = fetch.Normal(static_cast<uint32_t>(v));
+    }
+
+    templates.reserve(indices.size() / 3);
+    templateIndices.reserve(indices.size());
+    for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+        uint32_t i0 = indices[i];
+        uint32_t i1 = indices[i + 1];
+        uint32_t i2 = indices[i + 2];
+        if (i0 >= vertexCount || i1 >= vertexCount || i2 >= vertexCount) {
+            continue;
+        }
+
+        Triangle tri{};
+        fetch.Attributes(i0, tri, 0);
+        fetch.Attributes(i1, tri, 1);
+        fetch.Attributes(i2, tri, 2);
+        tri.materialId = materialHandle;
+
+        templates.push_back(tri);
+        templateIndices.push_back(i0);
+        templateIndices.push_back(i1);
+        templateIndices.push_back(i2);
+    }
+}
+
+} // namespace
+
 MaterialParams BuildMaterialParams(const PBRMaterial& material, const DrawItem& item) {
     MaterialParams params;
     params.albedo = material.albedo;
@@ -67,9 +276,12 @@ MaterialParams BuildMaterialParams(const PBRMaterial& material, const DrawItem&
  * @brief 构建经过变换的三角形集合
  *
  * 流程：
- *   1. 对每个三角形：执行 MVP 变换（裁剪空间）+ 模型矩阵变换（世界空间位置）
- *   2. 使用法线矩阵（模型矩阵逆转置）变换法线，正确处理非等比缩放
- *   3. 每个 Triangle 仅存储 MaterialHandle（uint32_t），由调用者预先注册
+ *   1. 对每个三角形：执行 MVP 变换（裁剪空间），每凑满 8 个三角形做一次裁剪前剔除
+ *   2. 存活三角形再执行模型矩阵变换（世界空间位置）并解码/拷贝其余顶点属性
+ *   3. 使用法线矩阵（模型矩阵逆转置）变换法线，正确处理非等比缩放
+ *   4. 每个 Triangle 仅存储 MaterialHandle（uint32_t），由调用者预先注册
+ *
+ * 已打包网格直接读取打包顶点并在此解码，UNorm16 位置的反量化并入模型矩阵与 MVP。
  */
 void GeometryProcessor::BuildTriangles(const Mesh& mesh,
                                        const DrawItem& item,
@@ -77,95 +289,212 @@ void GeometryProcessor::BuildTriangles(const Mesh& mesh,
                                        const Mat4& normalMatrix,
                                        const FrameContext& frameContext,
                                        MaterialHandle materialHandle,
-                                       std::vector<Triangle>& outTriangles) const {
-    outTriangles.clear();
+                                       ArenaVector<Triangle>& outTriangles) const {
+    const Mat4 mvp = modelMatrix * frameContext.view * frameContext.projection;
+    BuildTrianglesWith(mesh, item, modelMatrix, normalMatrix, mvp, true, materialHandle, outTriangles);
+}
+
+/**
+ * @brief 构建世界空间三角形：位置只乘模型矩阵，不做视图相关剔除
+ */
+void GeometryProcessor::BuildWorldTriangles(const Mesh& mesh,
+                                            const DrawItem& item,
+                                            const Mat4& modelMatrix,
+                                            const Mat4& normalMatrix,
+                                            MaterialHandle materialHandle,
+                                            ArenaVector<Triangle>& outTriangles) const {
+    BuildTrianglesWith(mesh, item, modelMatrix, normalMatrix, modelMatrix, false, materialHandle, outTriangles);
+}
+
+void GeometryProcessor::BuildTrianglesWith(const Mesh& mesh,
+                                           const DrawItem& item,
+                                           const Mat4& modelMatrix,
+                                           const Mat4& normalMatrix,
+                                           const Mat4& positionMVP,
+                                           bool preClipCull,
+                                           MaterialHandle materialHandle,
+                                           ArenaVector<Triangle>& outTriangles) const {
+    const size_t firstTriangle = outTriangles.size();
     m_lastTriangleCount = 0;
+    m_lastCullStats = RasterStats{};
 
-    const auto& vertices = mesh.GetVertices();
+    const size_t vertexCount = mesh.GetVertexCount();
     const auto& indices = mesh.GetIndices();
-    if (vertices.empty() || indices.size() < 3) {
+    if (vertexCount == 0 || indices.size() < 3) {
         return;
     }
 
-    outTriangles.reserve(indices.size() / 3);
+    outTriangles.reserve(firstTriangle + indices.size() / 3);
 
-    Mat4 mvp = modelMatrix * frameContext.view * frameContext.projection;
+    const bool cullBackface = item.material && !item.material->doubleSided;
 
-    VertexShader vertexShader;
-    vertexShader.SetMVP(mvp);
+    if (mesh.IsPacked()) {
+        const PackedVertexBuffer& packed = mesh.GetPackedVertices();
+        const Mat4 dequant = packed.GetDequantizationMatrix();
+        BuildTrianglesT(PackedVertexFetch{&packed}, vertexCount, indices,
+                        dequant * modelMatrix, dequant * positionMVP, normalMatrix,
+                        preClipCull, cullBackface, materialHandle, outTriangles, m_lastCullStats);
+    } else {
+        BuildTrianglesT(SourceVertexFetch{mesh.GetVertices().data()}, vertexCount, indices,
+                        modelMatrix, positionMVP, normalMatrix,
+                        preClipCull, cullBackface, materialHandle, outTriangles, m_lastCullStats);
+    }
 
-    for (size_t i = 0; i + 2 < indices.size(); i += 3) {
-        uint32_t i0 = indices[i];
-        uint32_t i1 = indices[i + 1];
-        uint32_t i2 = indices[i + 2];
-        if (i0 >= vertices.size() || i1 >= vertices.size() || i2 >= vertices.size()) {
-            continue;
-        }
+    m_lastTriangleCount = static_cast<uint64_t>(outTriangles.size() - firstTriangle);
+}
 
-        const Vec3& p0 = vertices[i0].position;
-        const Vec3& p1 = vertices[i1].position;
-        const Vec3& p2 = vertices[i2].position;
+/**
+ * @brief 构建实例共享的三角形模板
+ *
+ * 索引越界检查、UV/颜色/切线解码与材质句柄写入均与实例无关；
+ * 物体空间位置（原始存储值）和法线也只读取/解码一次。
+ * 同一 GeometryProcessor 连续处理同一网格的多个实例分块时直接复用。
+ */
+void GeometryProcessor::PrepareInstanceTemplates(const Mesh& mesh, MaterialHandle materialHandle) const {
+    if (m_templateMesh == &mesh && m_templateMaterial == materialHandle) {
+        return;
+    }
+    m_templateMesh = &mesh;
+    m_templateMaterial = materialHandle;
+    m_templateTriangles.clear();
+    m_templateIndices.clear();
+
+    const size_t vertexCount = mesh.GetVertexCount();
+    if (mesh.IsPacked()) {
+        const PackedVertexBuffer& packed = mesh.GetPackedVertices();
+        m_templateDequant = packed.GetDequantizationMatrix();
+        FillInstanceTemplatesT(PackedVertexFetch{&packed}, vertexCount, mesh.GetIndices(), materialHandle,
+                               m_templateTriangles, m_templateIndices, m_templatePositions, m_templateNormals);
+    } else {
+        m_templateDequant = Mat4::Identity();
+        FillInstanceTemplatesT(SourceVertexFetch{mesh.GetVertices().data()}, vertexCount, mesh.GetIndices(), materialHandle,
+                               m_templateTriangles, m_templateIndices, m_templatePositions, m_templateNormals);
+    }
+}
 
-        const Vec3& n0 = vertices[i0].normal;
-        const Vec3& n1 = vertices[i1].normal;
-        const Vec3& n2 = vertices[i2].normal;
+/**
+ * @brief 批量构建多个实例的三角形
+ *
+ * 流程：
+ *   1. 准备（或复用）三角形模板，完成一次性的索引校验、顶点解码和静态属性拷贝
+ *   2. View * Projection 只计算一次，逐实例仅做一次矩阵乘得到 MVP
+ *   3. 逐实例对唯一顶点执行变换（而非逐三角形角点），按 8 个一批做裁剪前剔除后再组装
+ */
+void GeometryProcessor::BuildTrianglesInstanced(const Mesh& mesh,
+                                                const DrawItem& item,
+                                                const InstanceTransform* instances,
+                                                size_t instanceCount,
+                                                const FrameContext& frameContext,
+                                                MaterialHandle materialHandle,
+                                                ArenaVector<Triangle>& outTriangles) const {
+    const Mat4 viewProjection = frameContext.view * frameContext.projection;
+    BuildTrianglesInstancedWith(mesh, item, instances, instanceCount, &viewProjection, materialHandle, outTriangles);
+}
 
-        const Vec2& t0 = vertices[i0].texCoord;
-        const Vec2& t1 = vertices[i1].texCoord;
-        const Vec2& t2 = vertices[i2].texCoord;
-        const Vec2& t0_1 = vertices[i0].texCoord1;
-        const Vec2& t1_1 = vertices[i1].texCoord1;
-        const Vec2& t2_1 = vertices[i2].texCoord1;
-        const Vec4& c0 = vertices[i0].color;
-        const Vec4& c1 = vertices[i1].color;
-        const Vec4& c2 = vertices[i2].color;
+/**
+ * @brief 批量构建多个实例的世界空间三角形（裁剪空间位置即世界坐标，不剔除）
+ */
+void GeometryProcessor::BuildWorldTrianglesInstanced(const Mesh& mesh,
+                                                     const DrawItem& item,
+                                                     const InstanceTransform* instances,
+                                                     size_t instanceCount,
+                                                     MaterialHandle materialHandle,
+                                                     ArenaVector<Triangle>& outTriangles) const {
+    BuildTrianglesInstancedWith(mesh, item, instances, instanceCount, nullptr, materialHandle, outTriangles);
+}
 
-        const Vec3& tg0 = vertices[i0].tangent;
-        const Vec3& tg1 = vertices[i1].tangent;
-        const Vec3& tg2 = vertices[i2].tangent;
+void GeometryProcessor::BuildTrianglesInstancedWith(const Mesh& mesh,
+                                                    const DrawItem& item,
+                                                    const InstanceTransform* instances,
+                                                    size_t instanceCount,
+                                                    const Mat4* viewProjection,
+                                                    MaterialHandle materialHandle,
+                                                    ArenaVector<Triangle>& outTriangles) const {
+    const size_t firstTriangle = outTriangles.size();
+    m_lastTriangleCount = 0;
+    m_lastCullStats = RasterStats{};
 
-        Triangle tri{};
-        tri.v0 = vertexShader.TransformPosition(Vec4{p0.x, p0.y, p0.z, 1.0});
-        tri.v1 = vertexShader.TransformPosition(Vec4{p1.x, p1.y, p1.z, 1.0});
-        tri.v2 = vertexShader.TransformPosition(Vec4{p2.x, p2.y, p2.z, 1.0});
-
-        tri.t0 = t0;
-        tri.t1 = t1;
-        tri.t2 = t2;
-        tri.t0_1 = t0_1;
-        tri.t1_1 = t1_1;
-        tri.t2_1 = t2_1;
-        tri.c0 = c0;
-        tri.c1 = c1;
-        tri.c2 = c2;
-
-        tri.tg0 = tg0;
-        tri.tg1 = tg1;
-        tri.tg2 = tg2;
-        tri.tangentW = vertices[i0].tangentW;
-
-        Vec4 wp0 = modelMatrix.Multiply(Vec4{p0.x, p0.y, p0.z, 1.0});
-        Vec4 wp1 = modelMatrix.Multiply(Vec4{p1.x, p1.y, p1.z, 1.0});
-        Vec4 wp2 = modelMatrix.Multiply(Vec4{p2.x, p2.y, p2.z, 1.0});
+    const size_t vertexCount = mesh.GetVertexCount();
+    if (!instances || instanceCount == 0 || vertexCount == 0 || mesh.GetIndices().size() < 3) {
+        return;
+    }
 
-        Vec4 wn0 = normalMatrix.Multiply(Vec4{n0.x, n0.y, n0.z, 0.0});
-        Vec4 wn1 = normalMatrix.Multiply(Vec4{n1.x, n1.y, n1.z, 0.0});
-        Vec4 wn2 = normalMatrix.Multiply(Vec4{n2.x, n2.y, n2.z, 0.0});
+    PrepareInstanceTemplates(mesh, materialHandle);
+    const size_t triCount = m_templateTriangles.size();
+    if (triCount == 0) {
+        return;
+    }
 
-        tri.w0 = Vec3{wp0.x, wp0.y, wp0.z};
-        tri.w1 = Vec3{wp1.x, wp1.y, wp1.z};
-        tri.w2 = Vec3{wp2.x, wp2.y, wp2.z};
+    outTriangles.reserve(firstTriangle + triCount * instanceCount);
+    m_instanceClip.resize(vertexCount);
+    m_instanceWorld.resize(vertexCount);
+    m_instanceNormal.resize(vertexCount);
 
-        tri.n0 = Vec3{wn0.x, wn0.y, wn0.z}.Normalized();
-        tri.n1 = Vec3{wn1.x, wn1.y, wn1.z}.Normalized();
-        tri.n2 = Vec3{wn2.x, wn2.y, wn2.z}.Normalized();
+    const bool cullBackface = item.material && !item.material->doubleSided;
+    VertexShader vertexShader;
+    PreClipCuller culler;
+    PreClipCullBatch batch;
+
+    for (size_t inst = 0; inst < instanceCount; ++inst) {
+        const InstanceTransform& instance = instances[inst];
+        const Mat4 positionModel = m_templateDequant * instance.modelMatrix;
+        vertexShader.SetMVP(viewProjection ? positionModel * *viewProjection : positionModel);
+
+        for (size_t v = 0; v < vertexCount; ++v) {
+            const Vec4& pos = m_templatePositions[v];
+            const Vec3& n = m_templateNormals[v];
+            m_instanceClip[v] = vertexShader.TransformPosition(pos);
+            Vec4 wp = positionModel.Multiply(pos);
+            Vec4 wn = instance.normalMatrix.Multiply(Vec4{n.x, n.y, n.z, 0.0});
+            m_instanceWorld[v] = Vec3{wp.x, wp.y, wp.z};
+            m_instanceNormal[v] = Vec3{wn.x, wn.y, wn.z}.Normalized();
+        }
 
-        tri.materialId = materialHandle;
+        if (!viewProjection) {
+            for (size_t t = 0; t < triCount; ++t) {
+                const uint32_t* idx = m_templateIndices.data() + t * 3;
+                Triangle& tri = outTriangles.emplace_back(m_templateTriangles[t]);
+                tri.v0 = m_instanceClip[idx[0]];
+                tri.v1 = m_instanceClip[idx[1]];
+                tri.v2 = m_instanceClip[idx[2]];
+                tri.w0 = m_instanceWorld[idx[0]];
+                tri.w1 = m_instanceWorld[idx[1]];
+                tri.w2 = m_instanceWorld[idx[2]];
+                tri.n0 = m_instanceNormal[idx[0]];
+                tri.n1 = m_instanceNormal[idx[1]];
+                tri.n2 = m_instanceNormal[idx[2]];
+            }
+            continue;
+        }
 
-        outTriangles.push_back(tri);
+        for (size_t base = 0; base < triCount; base += PreClipCullBatch::kSize) {
+            const int lanes = static_cast<int>(std::min<size_t>(PreClipCullBatch::kSize, triCount - base));
+            for (int l = 0; l < lanes; ++l) {
+                const uint32_t* idx = m_templateIndices.data() + (base + static_cast<size_t>(l)) * 3;
+                batch.Set(l, m_instanceClip[idx[0]], m_instanceClip[idx[1]], m_instanceClip[idx[2]]);
+            }
+
+            uint32_t alive = culler.CullBatch(batch, lanes, cullBackface, m_lastCullStats);
+            while (alive != 0u) {
+                const size_t t = base + static_cast<size_t>(std::countr_zero(alive));
+                alive &= alive - 1u;
+                const uint32_t* idx = m_templateIndices.data() + t * 3;
+
+                Triangle& tri = outTriangles.emplace_back(m_templateTriangles[t]);
+                tri.v0 = m_instanceClip[idx[0]];
+                tri.v1 = m_instanceClip[idx[1]];
+                tri.v2 = m_instanceClip[idx[2]];
+                tri.w0 = m_instanceWorld[idx[0]];
+                tri.w1 = m_instanceWorld[idx[1]];
+                tri.w2 = m_instanceWorld[idx[2]];
+                tri.n0 = m_instanceNormal[idx[0]];
+                tri.n1 = m_instanceNormal[idx[1]];
+                tri.n2 = m_instanceNormal[idx[2]];
+            }
+        }
     }
 
-    m_lastTriangleCount = static_cast<uint64_t>(outTriangles.size());
+    m_lastTriangleCount = static_cast<uint64_t>(outTriangles.size() - firstTriangle);
 }
 
 /**
@@ -175,4 +504,11 @@ uint64_t GeometryProcessor::GetLastTriangleCount() const {
     return m_lastTriangleCount;
 }
 
+/**
+ * @brief 获取最后一次构建的裁剪前剔除统计
+ */
+const RasterStats& GeometryProcessor::GetLastCullStats() const {
+    return m_lastCullStats;
+}
+
 } // namespace SR
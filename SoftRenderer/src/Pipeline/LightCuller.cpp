@@ -0,0 +1,185 @@
+#include "Pipeline/LightCuller.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Math/Vec4.h"
+
+namespace SR {
+
+namespace {
+
+/// 近平面推导失败（非透视投影）时使用的最小视空间深度
+constexpr double kMinNearDepth = 1e-4;
+
+/// @brief 世界空间包围球
+struct LightBounds {
+    Vec3 center;
+    double radius;
+};
+
+/**
+ * @brief 计算光源的有效影响半径
+ *
+ * 指定了 range 时直接使用（着色端施加 window 衰减）；未指定时按平方反比衰减到截断亮度的距离，
+ * 着色端不施加 window，仅用于剔除。
+ */
+double EffectiveRange(const Vec3& color, double intensity, double range) {
+    if (range > 0.0) {
+        return range;
+    }
+    const double peak = std::max({color.x, color.y, color.z}) * std::max(0.0, intensity);
+    return std::sqrt(peak / LightCuller::kLightCutoffRadiance);
+}
+
+PrecomputedLocalLight PrecomputePointLight(const PointLight& light) {
+    PrecomputedLocalLight pl;
+    pl.position = light.position;
+    pl.radiance = light.color * light.intensity;
+    pl.range = EffectiveRange(light.color, light.intensity, light.range);
+    pl.invRangeSq = (light.range > 0.0) ? 1.0 / (light.range * light.range) : 0.0;
+    return pl;
+}
+
+PrecomputedLocalLight PrecomputeSpotLight(const SpotLight& light) {
+    PrecomputedLocalLight pl;
+    pl.position = light.position;
+    pl.radiance = light.color * light.intensity;
+    pl.direction = light.direction.Normalized();
+    pl.range = EffectiveRange(light.color, light.intensity, light.range);
+    pl.invRangeSq = (light.range > 0.0) ? 1.0 / (light.range * light.range) : 0.0;
+    const double cosOuter = std::cos(light.outerConeAngle);
+    const double cosInner = std::cos(std::min(light.innerConeAngle, light.outerConeAngle));
+    pl.spotScale = 1.0 / std::max(1e-3, cosInner - cosOuter);
+    pl.spotOffset = -cosOuter * pl.spotScale;
+    return pl;
+}
+
+/**
+ * @brief 光锥（顶点 position、轴 direction、斜高 range、半角 angle）的最小包围球
+ *
+ * 半角不超过 45° 时外接球经过顶点与底面圆；否则以底面圆为大圆。半角超过 90° 时退化为整球。
+ */
+LightBounds SpotLightBounds(const PrecomputedLocalLight& light, double outerConeAngle) {
+    constexpr double kQuarterPi = 0.7853981633974483;
+    constexpr double kHalfPi = 1.5707963267948966;
+    if (outerConeAngle >= kHalfPi) {
+        return {light.position, light.range};
+    }
+    const double cosAngle = std::cos(outerConeAngle);
+    if (outerConeAngle <= kQuarterPi) {
+        const double radius = light.range / (2.0 * cosAngle);
+        return {light.position + light.direction * radius, radius};
+    }
+    return {light.position + light.direction * (light.range * cosAngle), light.range * std::sin(outerConeAngle)};
+}
+
+} // namespace
+
+void LightCuller::Clear() {
+    m_lights.clear();
+    m_lightRects.clear();
+    m_tileOffsets.assign(static_cast<size_t>(m_tilesX) * static_cast<size_t>(m_tilesY) + 1, 0);
+    m_tileIndices.clear();
+}
+
+/**
+ * @brief 两遍 CSR 构建：先按投影矩形统计每 Tile 光源数并求前缀和，再按光源顺序填充索引
+ */
+void LightCuller::Build(const std::vector<PointLight>& pointLights, const std::vector<SpotLight>& spotLights,
+                        const Mat4& view, const Mat4& projection, int width, int height, int tileSize) {
+    m_width = width;
+    m_height = height;
+    m_tileSize = std::max(1, tileSize);
+    m_tilesX = (std::max(0, width) + m_tileSize - 1) / m_tileSize;
+    m_tilesY = (std::max(0, height) + m_tileSize - 1) / m_tileSize;
+    Clear();
+    if (m_tilesX == 0 || m_tilesY == 0) {
+        return;
+    }
+
+    std::vector<LightBounds> bounds;
+    bounds.reserve(pointLights.size() + spotLights.size());
+    m_lights.reserve(pointLights.size() + spotLights.size());
+    for (const PointLight& light : pointLights) {
+        m_lights.push_back(PrecomputePointLight(light));
+        bounds.push_back({light.position, m_lights.back().range});
+    }
+    for (const SpotLight& light : spotLights) {
+        m_lights.push_back(PrecomputeSpotLight(light));
+        bounds.push_back(SpotLightBounds(m_lights.back(), light.outerConeAngle));
+    }
+
+    // 透视投影 z' = (z·m22 + m32) / z，近平面 z = -m32 / m22
+    const double nearDepth = (std::abs(projection.m[2][2]) > 1e-12)
+        ? std::max(kMinNearDepth, -projection.m[3][2] / projection.m[2][2]) : kMinNearDepth;
+    const TileRect fullScreen{0, 0, m_tilesX - 1, m_tilesY - 1};
+    const TileRect culled{1, 1, 0, 0};
+
+    m_lightRects.resize(m_lights.size());
+    for (size_t i = 0; i < m_lights.size(); ++i) {
+        const LightBounds& sphere = bounds[i];
+        const Vec4 c = view.Multiply(Vec4{sphere.center.x, sphere.center.y, sphere.center.z, 1.0});
+        if (sphere.radius <= 0.0 || c.z + sphere.radius <= nearDepth) {
+            m_lightRects[i] = culled;
+            continue;
+        }
+        if (c.z - sphere.radius <= nearDepth) {
+            m_lightRects[i] = fullScreen;
+            continue;
+        }
+
+        // 视空间 AABB 的 8 个角点都在近平面之前，投影后的包围矩形保守覆盖整个球
+        double minSx = 1e30, minSy = 1e30, maxSx = -1e30, maxSy = -1e30;
+        for (int corner = 0; corner < 8; ++corner) {
+            const Vec4 p{c.x + ((corner & 1) ? sphere.radius : -sphere.radius),
+                         c.y + ((corner & 2) ? sphere.radius : -sphere.radius),
+                         c.z + ((corner & 4) ? sphere.radius : -sphere.radius), 1.0};
+            const Vec4 clip = projection.Multiply(p);
+            const double invW = 1.0 / clip.w;
+            // 与 Rasterizer 的视口映射一致
+            const double sx = (clip.x * invW * 0.5 + 0.5) * static_cast<double>(width - 1);
+            const double sy = (1.0 - (clip.y * invW * 0.5 + 0.5)) * static_cast<double>(height - 1);
+            minSx = std::min(minSx, sx);
+            maxSx = std::max(maxSx, sx);
+            minSy = std::min(minSy, sy);
+            maxSy = std::max(maxSy, sy);
+        }
+        // 外扩 1 像素覆盖像素中心采样的舍入
+        if (maxSx < -1.0 || maxSy < -1.0 || minSx > width || minSy > height) {
+            m_lightRects[i] = culled;
+            continue;
+        }
+        const double tileScale = 1.0 / static_cast<double>(m_tileSize);
+        TileRect rect;
+        rect.minX = std::clamp(static_cast<int>(std::floor((minSx - 1.0) * tileScale)), 0, m_tilesX - 1);
+        rect.minY = std::clamp(static_cast<int>(std::floor((minSy - 1.0) * tileScale)), 0, m_tilesY - 1);
+        rect.maxX = std::clamp(static_cast<int>(std::floor((maxSx + 1.0) * tileScale)), 0, m_tilesX - 1);
+        rect.maxY = std::clamp(static_cast<int>(std::floor((maxSy + 1.0) * tileScale)), 0, m_tilesY - 1);
+        m_lightRects[i] = rect;
+    }
+
+    for (const TileRect& rect : m_lightRects) {
+        for (int ty = rect.minY; ty <= rect.maxY; ++ty) {
+            for (int tx = rect.minX; tx <= rect.maxX; ++tx) {
+                m_tileOffsets[static_cast<size_t>(ty * m_tilesX + tx) + 1]++;
+            }
+        }
+    }
+    for (size_t t = 1; t < m_tileOffsets.size(); ++t) {
+        m_tileOffsets[t] += m_tileOffsets[t - 1];
+    }
+    m_tileIndices.resize(m_tileOffsets.back());
+
+    std::vector<uint32_t> cursor(m_tileOffsets.begin(), m_tileOffsets.end() - 1);
+    for (size_t i = 0; i < m_lightRects.size(); ++i) {
+        const TileRect& rect = m_lightRects[i];
+        for (int ty = rect.minY; ty <= rect.maxY; ++ty) {
+            for (int tx = rect.minX; tx <= rect.maxX; ++tx) {
+                m_tileIndices[cursor[static_cast<size_t>(ty * m_tilesX + tx)]++] = static_cast<uint32_t>(i);
+            }
+        }
+    }
+}
+
+} // namespace SR
@@ -60,9 +60,24 @@ void MaterialTable::InitializeDefaultMaterial() {
     m_primitiveIndex.push_back(-1);
     m_nodeIndex.push_back(-1);
 
+    // 着色器特性（默认材质无贴图、单面）
+    m_shaderFeatures.push_back(0);
+
     m_count = 1;
 }
 
+ShaderFeatureMask MaterialTable::ComputeShaderFeatures(const MaterialParams& params) {
+    ShaderFeatureMask mask = 0;
+    if (params.baseColorImageIndex >= 0) mask |= ShaderFeature::BaseColorMap;
+    if (params.metallicRoughnessImageIndex >= 0) mask |= ShaderFeature::MetallicRoughnessMap;
+    if (params.normalImageIndex >= 0) mask |= ShaderFeature::NormalMap;
+    if (params.occlusionImageIndex >= 0) mask |= ShaderFeature::OcclusionMap;
+    if (params.emissiveImageIndex >= 0) mask |= ShaderFeature::EmissiveMap;
+    if (params.transmissionFactor > 0.0 || params.transmissionImageIndex >= 0) mask |= ShaderFeature::Transmission;
+    if (params.doubleSided) mask |= ShaderFeature::DoubleSided;
+    return mask;
+}
+
 MaterialHandle MaterialTable::AddMaterial(const MaterialParams& params) {
     MaterialHandle handle;
 
@@ -129,6 +144,9 @@ MaterialHandle MaterialTable::AddMaterial(const MaterialParams& params) {
         m_primitiveIndex.push_back(params.primitiveIndex);
         m_nodeIndex.push_back(params.nodeIndex);
 
+        // 着色器特性
+        m_shaderFeatures.push_back(ComputeShaderFeatures(params));
+
         return handle;
     }
 
@@ -187,6 +205,9 @@ MaterialHandle MaterialTable::AddMaterial(const MaterialParams& params) {
     m_primitiveIndex[handle] = params.primitiveIndex;
     m_nodeIndex[handle] = params.nodeIndex;
 
+    // 着色器特性
+    m_shaderFeatures[handle] = ComputeShaderFeatures(params);
+
     return handle;
 }
 
@@ -423,6 +444,13 @@ int32_t MaterialTable::GetNodeIndex(MaterialHandle handle) const {
     return GetProperty(handle, m_nodeIndex, defaultIndex);
 }
 
+// ========== 着色器变体 ==========
+
+ShaderFeatureMask MaterialTable::GetShaderFeatures(MaterialHandle handle) const {
+    static const ShaderFeatureMask defaultFeatures = 0;
+    return GetProperty(handle, m_shaderFeatures, defaultFeatures);
+}
+
 PBRMaterial MaterialTable::GetPBRMaterial(MaterialHandle handle) const {
     PBRMaterial mat;
     if (!IsValid(handle)) {
@@ -493,6 +521,7 @@ void MaterialTable::Clear() {
     m_materialIndex.clear();
     m_primitiveIndex.clear();
     m_nodeIndex.clear();
+    m_shaderFeatures.clear();
 
     m_freeSlots.clear();
     m_count = 0;
@@ -0,0 +1,292 @@
+#include "Pipeline/MultiViewGeometry.h"
+
+#include "Core/Parallel.h"
+#include "Pipeline/FrameContext.h"
+#include "Pipeline/GeometryProcessor.h"
+#include "Pipeline/PreClipCuller.h"
+#include "Pipeline/VertexShader.h"
+#include "Scene/RenderQueue.h"
+#include "Utils/DebugLog.h"
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+namespace SR {
+
+namespace {
+
+/// 实例化渲染项的拆分粒度（与 OpaquePass 一致）
+constexpr size_t kInstanceChunkTriangles = 16384;
+
+/// 逐视图投影的并行块长度（三角形数）
+constexpr size_t kProjectChunk = 1024;
+
+/// 构建任务及其输出位置：任务在所在线程的列表中追加，之后按任务顺序合并
+struct BuildTask {
+    int itemIndex = 0;
+    size_t instanceBegin = 0;
+    size_t instanceCount = 0;
+    int thread = 0;            ///< 执行该任务的线程
+    size_t begin = 0;          ///< 在该线程列表中的起点
+    size_t count = 0;          ///< 构建出的三角形数
+    size_t destination = 0;    ///< 合并后在不透明 / 半透明数组中的起点
+    bool blend = false;
+    bool cullBackface = false;
+};
+
+/**
+ * @brief 把世界空间三角形投影到一个视图：并行块内变换 + 裁剪前剔除，前缀和后按原顺序压缩输出
+ *
+ * 单面 / 双面三角形分别凑批剔除，存活标记按三角形记录，因此输出保持输入顺序。
+ */
+std::span<Triangle> ProjectTriangles(const Triangle* source, const uint8_t* cullBackface, size_t count,
+                                     const Mat4& viewProjection, ArenaRegion& shared, ProjectedGeometry& result) {
+    if (count == 0) {
+        return {};
+    }
+    const int chunkCount = static_cast<int>((count + kProjectChunk - 1) / kProjectChunk);
+    Vec4* clip = shared.AllocateArray<Vec4>(count * 3);
+    uint8_t* alive = shared.AllocateArray<uint8_t>(count);
+    size_t* chunkOffsets = shared.AllocateArray<size_t>(static_cast<size_t>(chunkCount) + 1);
+    std::vector<RasterStats> chunkStats(static_cast<size_t>(chunkCount));
+
+    Parallel::For(0, chunkCount, 1, Parallel::kBalanced, [&](int chunk) {
+        const size_t begin = static_cast<size_t>(chunk) * kProjectChunk;
+        const size_t end = std::min(count, begin + kProjectChunk);
+        VertexShader vertexShader;
+        vertexShader.SetMVP(viewProjection);
+        PreClipCuller culler;
+        PreClipCullBatch batches[2];
+        size_t lanesToTriangle[2][PreClipCullBatch::kSize];
+        int lanes[2] = {0, 0};
+        size_t survivors = 0;
+        RasterStats& stats = chunkStats[static_cast<size_t>(chunk)];
+
+        auto flush = [&](int kind) {
+            const uint32_t mask = culler.CullBatch(batches[kind], lanes[kind], kind == 1, stats);
+            for (int l = 0; l < lanes[kind]; ++l) {
+                alive[lanesToTriangle[kind][l]] = static_cast<uint8_t>((mask >> l) & 1u);
+            }
+            survivors += static_cast<size_t>(std::popcount(mask));
+            lanes[kind] = 0;
+        };
+
+        for (size_t i = begin; i < end; ++i) {
+            const Triangle& tri = source[i];
+            Vec4* c = clip + i * 3;
+            c[0] = vertexShader.TransformPosition(tri.v0);
+            c[1] = vertexShader.TransformPosition(tri.v1);
+            c[2] = vertexShader.TransformPosition(tri.v2);
+            const int kind = cullBackface[i] ? 1 : 0;
+            batches[kind].Set(lanes[kind], c[0], c[1], c[2]);
+            lanesToTriangle[kind][lanes[kind]] = i;
+            if (++lanes[kind] == PreClipCullBatch::kSize) {
+                flush(kind);
+            }
+        }
+        for (int kind = 0; kind < 2; ++kind) {
+            if (lanes[kind] > 0) {
+                flush(kind);
+            }
+        }
+        chunkOffsets[chunk + 1] = survivors;
+    });
+
+    chunkOffsets[0] = 0;
+    for (int chunk = 0; chunk < chunkCount; ++chunk) {
+        chunkOffsets[chunk + 1] += chunkOffsets[chunk];
+        const RasterStats& stats = chunkStats[static_cast<size_t>(chunk)];
+        result.trianglesCulledBackface += stats.trianglesCulledBackface;
+        result.trianglesCulledDegenerate += stats.trianglesCulledDegenerate;
+        result.trianglesCulledOffscreen += stats.trianglesCulledOffscreen;
+    }
+    const size_t total = chunkOffsets[chunkCount];
+    if (total == 0) {
+        return {};
+    }
+
+    Triangle* output = shared.AllocateArray<Triangle>(total);
+    Parallel::For(0, chunkCount, 1, OpenMPSchedulePolicy::Static, [&](int chunk) {
+        const size_t begin = static_cast<size_t>(chunk) * kProjectChunk;
+        const size_t end = std::min(count, begin + kProjectChunk);
+        size_t out = chunkOffsets[chunk];
+        for (size_t i = begin; i < end; ++i) {
+            if (!alive[i]) {
+                continue;
+            }
+            Triangle& tri = output[out++];
+            tri = source[i];
+            tri.v0 = clip[i * 3];
+            tri.v1 = clip[i * 3 + 1];
+            tri.v2 = clip[i * 3 + 2];
+        }
+    });
+    return std::span<Triangle>(output, total);
+}
+
+} // namespace
+
+/**
+ * @brief 构建共享几何
+ *
+ * 材质注册与任务拆分同 OpaquePass；每个任务的三角形追加到执行线程的列表，
+ * 最后按任务顺序（即队列排序顺序）合并为不透明 / 半透明两个连续数组。
+ */
+void MultiViewGeometry::Build(const RenderQueue& queue, const FrameContext& frame, FrameArena& arena) {
+    using Clock = std::chrono::high_resolution_clock;
+    auto buildStart = Clock::now();
+
+    m_materials.Clear();
+    m_opaque = {};
+    m_opaqueCull = {};
+    m_blend = {};
+    m_blendCull = {};
+    m_blendGroups.clear();
+
+    ArenaRegion& shared = arena.Shared();
+    const int numItems = static_cast<int>(queue.GetSortedEntries().size());
+    const int maxThreads = Parallel::MaxThreads();
+    arena.EnsureThreadRegions(maxThreads);
+
+    ArenaVector<MaterialHandle> materialHandles(shared);
+    materialHandles.assign(static_cast<size_t>(numItems), InvalidMaterialHandle);
+    ArenaVector<BuildTask> tasks(shared);
+    tasks.reserve(static_cast<size_t>(numItems));
+    for (int i = 0; i < numItems; ++i) {
+        const DrawItem& item = queue.GetSortedItem(static_cast<size_t>(i));
+        if (!item.mesh || !item.material) {
+            continue;
+        }
+        materialHandles[static_cast<size_t>(i)] = m_materials.AddMaterial(BuildMaterialParams(*item.material, item));
+
+        BuildTask task;
+        task.itemIndex = i;
+        task.blend = item.material->alphaMode == GLTFAlphaMode::Blend;
+        task.cullBackface = !item.material->doubleSided;
+        if (!item.instances || item.instanceCount == 0) {
+            tasks.push_back(task);
+            continue;
+        }
+        size_t meshTris = std::max<size_t>(1, item.mesh->GetIndices().size() / 3);
+        size_t perTask = std::max<size_t>(1, kInstanceChunkTriangles / meshTris);
+        for (size_t begin = 0; begin < item.instanceCount; begin += perTask) {
+            task.instanceBegin = begin;
+            task.instanceCount = std::min(perTask, item.instanceCount - begin);
+            tasks.push_back(task);
+        }
+    }
+    const int numTasks = static_cast<int>(tasks.size());
+
+    ArenaVector<Triangle>* threadTriangles = shared.AllocateArray<ArenaVector<Triangle>>(static_cast<size_t>(maxThreads));
+    for (int t = 0; t < maxThreads; ++t) {
+        threadTriangles[t] = ArenaVector<Triangle>(arena.ThreadRegion(t));
+    }
+    std::vector<GeometryProcessor> threadProcessors(static_cast<size_t>(maxThreads));
+    Parallel::ForRange(0, numTasks, frame.openmp.drawItemBuildChunk, [&](int firstTask, int lastTask) {
+        const int tid = Parallel::ThreadIndex();
+        ArenaVector<Triangle>& local = threadTriangles[tid];
+        const GeometryProcessor& processor = threadProcessors[static_cast<size_t>(tid)];
+        for (int taskIndex = firstTask; taskIndex < lastTask; ++taskIndex) {
+            BuildTask& task = tasks[static_cast<size_t>(taskIndex)];
+            const DrawItem& item = queue.GetSortedItem(static_cast<size_t>(task.itemIndex));
+            const MaterialHandle handle = materialHandles[static_cast<size_t>(task.itemIndex)];
+            task.thread = tid;
+            task.begin = local.size();
+            if (task.instanceCount > 0) {
+                processor.BuildWorldTrianglesInstanced(*item.mesh, item, item.instances + task.instanceBegin,
+                                                       task.instanceCount, handle, local);
+            } else {
+                processor.BuildWorldTriangles(*item.mesh, item, item.modelMatrix, item.normalMatrix, handle, local);
+            }
+            task.count = local.size() - task.begin;
+        }
+    });
+
+    size_t totalOpaque = 0;
+    size_t totalBlend = 0;
+    for (BuildTask& task : tasks) {
+        size_t& total = task.blend ? totalBlend : totalOpaque;
+        task.destination = total;
+        total += task.count;
+    }
+    Triangle* opaque = shared.AllocateArray<Triangle>(totalOpaque);
+    uint8_t* opaqueCull = shared.AllocateArray<uint8_t>(totalOpaque);
+    Triangle* blend = shared.AllocateArray<Triangle>(totalBlend);
+    uint8_t* blendCull = shared.AllocateArray<uint8_t>(totalBlend);
+    Parallel::For(0, numTasks, 1, Parallel::kBalanced, [&](int taskIndex) {
+        const BuildTask& task = tasks[static_cast<size_t>(taskIndex)];
+        if (task.count == 0) {
+            return;
+        }
+        const Triangle* source = threadTriangles[task.thread].data() + task.begin;
+        std::memcpy((task.blend ? blend : opaque) + task.destination, source, task.count * sizeof(Triangle));
+        std::memset((task.blend ? blendCull : opaqueCull) + task.destination, task.cullBackface ? 1 : 0, task.count);
+    });
+
+    // 半透明分组锚点与渲染队列的排序键一致：模型矩阵平移（实例区间取首个实例）
+    for (const BuildTask& task : tasks) {
+        if (!task.blend || task.count == 0) {
+            continue;
+        }
+        const DrawItem& item = queue.GetSortedItem(static_cast<size_t>(task.itemIndex));
+        const Mat4& model = task.instanceCount > 0 ? item.instances[task.instanceBegin].modelMatrix : item.modelMatrix;
+        m_blendGroups.push_back(BlendGroup{task.destination, task.destination + task.count,
+                                           Vec3{model.m[3][0], model.m[3][1], model.m[3][2]}});
+    }
+
+    m_opaque = std::span<const Triangle>(opaque, totalOpaque);
+    m_opaqueCull = std::span<const uint8_t>(opaqueCull, totalOpaque);
+    m_blend = std::span<const Triangle>(blend, totalBlend);
+    m_blendCull = std::span<const uint8_t>(blendCull, totalBlend);
+    m_buildMs = std::chrono::duration<double, std::milli>(Clock::now() - buildStart).count();
+
+    char buffer[256];
+    std::snprintf(buffer, sizeof(buffer),
+        "[SR-PERF] MultiViewGeometry build: items=%d tasks=%d opaqueT=%zu blendT=%zu materials=%zu ms=%.3f\n",
+        numItems, numTasks, totalOpaque, totalBlend, m_materials.GetMaterialCount(), m_buildMs);
+    SR_PERF_LOG(buffer);
+}
+
+ProjectedGeometry MultiViewGeometry::Project(const Mat4& viewProjection, const Vec3& cameraPos, FrameArena& arena) const {
+    ProjectedGeometry result;
+    ArenaRegion& shared = arena.Shared();
+    result.opaque = ProjectTriangles(m_opaque.data(), m_opaqueCull.data(), m_opaque.size(),
+                                     viewProjection, shared, result);
+    if (m_blend.empty()) {
+        return result;
+    }
+
+    const Triangle* blend = m_blend.data();
+    const uint8_t* blendCull = m_blendCull.data();
+    if (m_blendGroups.size() > 1) {
+        // 半透明按该视点从远到近重新排列（分组整体移动，组内保持网格顺序）
+        std::vector<size_t> order(m_blendGroups.size());
+        std::vector<double> distance(m_blendGroups.size());
+        for (size_t g = 0; g < m_blendGroups.size(); ++g) {
+            const Vec3 d = m_blendGroups[g].anchor - cameraPos;
+            distance[g] = d.x * d.x + d.y * d.y + d.z * d.z;
+            order[g] = g;
+        }
+        std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return distance[a] > distance[b]; });
+
+        Triangle* orderedTriangles = shared.AllocateArray<Triangle>(m_blend.size());
+        uint8_t* orderedCull = shared.AllocateArray<uint8_t>(m_blend.size());
+        size_t out = 0;
+        for (size_t g : order) {
+            const BlendGroup& group = m_blendGroups[g];
+            const size_t count = group.end - group.begin;
+            std::memcpy(orderedTriangles + out, blend + group.begin, count * sizeof(Triangle));
+            std::memcpy(orderedCull + out, blendCull + group.begin, count);
+            out += count;
+        }
+        blend = orderedTriangles;
+        blendCull = orderedCull;
+    }
+    result.blend = ProjectTriangles(blend, blendCull, m_blend.size(), viewProjection, shared, result);
+    return result;
+}
+
+} // namespace SR
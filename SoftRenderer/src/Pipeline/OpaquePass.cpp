@@ -4,9 +4,13 @@
 #include "Pipeline/FrameContext.h"
 #include "Pipeline/GeometryProcessor.h"
 #include "Pipeline/MaterialTable.h"
+#include "Pipeline/MultiViewGeometry.h"
 #include "Pipeline/Rasterizer.h"
+#include "Pipeline/TileEpilogue.h"
 #include "Core/Framebuffer.h"
 #include "Core/DepthBuffer.h"
+#include "Core/Parallel.h"
+#include "Core/FrameArena.h"
 #include "Scene/RenderQueue.h"
 #include "Utils/DebugLog.h"
 
@@ -14,9 +18,8 @@
 #include <chrono>
 #include <cmath>
 #include <cstdio>
-#include <cstdlib>
 #include <cstring>
-#include <omp.h>
+#include <vector>
 
 namespace SR {
 
@@ -31,13 +34,66 @@ const char* ScheduleName(OpenMPSchedulePolicy policy) {
     }
 }
 
-} // namespace
+/// 实例化渲染项的拆分粒度：每个构建任务约包含的三角形数（避免单个大批次拖慢整个并行区）
+constexpr size_t kInstanceChunkTriangles = 16384;
+
+/// 几何构建任务：普通渲染项对应一个任务，实例化渲染项按实例区间拆分为多个任务
+struct BuildTask {
+    int itemIndex = 0;         ///< 对应渲染队列排序后的下标
+    size_t instanceBegin = 0;  ///< 实例区间起点
+    size_t instanceCount = 0;  ///< 实例区间长度（0 表示非实例化）
+};
+
+/// 每线程构建输出：三角形列表位于该线程的帧级内存区域，本身存放在共享区域
+struct ThreadBuildOutput {
+    ArenaVector<Triangle> opaque;        ///< 不透明 / Mask 三角形
+    ArenaVector<Triangle> blend;         ///< 半透明三角形
+    uint64_t built = 0;                  ///< 构建的三角形数
+    uint64_t culledBackface = 0;         ///< 裁剪前剔除：背面
+    uint64_t culledDegenerate = 0;       ///< 裁剪前剔除：退化
+    uint64_t culledOffscreen = 0;        ///< 裁剪前剔除：视锥外
+};
+
+/**
+ * @brief 光栅化不透明 / Mask 三角形（启用 Early-Z），按需在 Tile 内完成收尾，统计累加到 stats
+ *
+ * 天空总可在 Tile 内填充（透明物体之后才混合在其上）；
+ * 仅当本帧没有半透明三角形时才能在 Tile 内直接写出 SDR 结果。
+ */
+void RasterizeOpaque(RenderContext& context, const FrameContext& frame, Rasterizer& rasterizer,
+                     const Triangle* triangles, size_t count, bool hasBlend, PassStats& stats) {
+    using Clock = std::chrono::high_resolution_clock;
+
+    TileEpilogue tileEpilogue;
+    if (context.tileEpilogue) {
+        const EnvironmentMap* sky = frame.environmentMap;
+        const bool resolve = context.tileEpilogue->resolveOutput && !hasBlend;
+        tileEpilogue.Setup(frame, context.framebuffer, context.depthBuffer,
+                           sky, resolve, context.tileEpilogue->exposure);
+        if (tileEpilogue.IsActive()) {
+            rasterizer.SetTileEpilogue(&tileEpilogue);
+        }
+    }
+
+    if (count == 0) {
+        return;
+    }
+    auto rastStart = Clock::now();
+    RasterStats rastStats = rasterizer.RasterizeTriangles(triangles, count);
+    if (rastStats.tileEpilogueDone) {
+        context.skyboxFilled = tileEpilogue.FillsSky();
+        context.outputResolved = tileEpilogue.ResolvesOutput();
+    }
+    auto rastEnd = Clock::now();
+    stats.rastMs += std::chrono::duration<double, std::milli>(rastEnd - rastStart).count();
+    stats.trianglesClipped += rastStats.trianglesClipped;
+    stats.trianglesRendered += rastStats.trianglesRaster;
+    stats.pixelsTested += rastStats.pixelsTested;
+    stats.pixelsShaded += rastStats.pixelsShaded;
+    stats.shaderUsage.Accumulate(rastStats.shaderUsage);
+}
 
-/// 持久化的每线程构建缓冲区（避免每帧 malloc/free 32 个大 vector）
-static constexpr int kMaxBuildThreads = 64;
-static std::vector<Triangle> g_perThreadOpaque[kMaxBuildThreads];
-static std::vector<Triangle> g_perThreadBlend[kMaxBuildThreads];
-static uint64_t g_perThreadBuilt[kMaxBuildThreads] = {};
+} // namespace
 
 PassStats OpaquePass::Execute(RenderContext& context) {
     PassStats stats;
@@ -53,56 +109,89 @@ PassStats OpaquePass::Execute(RenderContext& context) {
     FrameContext frameWithMaterials = *context.frameContext;
     frameWithMaterials.materialTable = context.materialTable;
 
+    // 本 Pass 的临时数据全部来自帧级内存（帧末统一复位）；未提供时退回局部分配器
+    FrameArena localArena;
+    if (!frameWithMaterials.frameArena) {
+        frameWithMaterials.frameArena = &localArena;
+    }
+    FrameArena& arena = *frameWithMaterials.frameArena;
+    ArenaRegion& shared = arena.Shared();
+
     Rasterizer rasterizer;
     rasterizer.SetTargets(context.framebuffer, context.depthBuffer);
     rasterizer.SetFrameContext(frameWithMaterials);
 
-    std::vector<Triangle> blendTriangles;
-    std::vector<DrawItem> sortedItems = context.renderQueue->GetItems();
-    auto copyEnd = Clock::now();
-
-    // 排序键：取模型矩阵的平移列到相机的距离平方（避免开方以节省时间）
-    const Vec3 cameraPos = frameWithMaterials.cameraPos;
-    auto getItemSortKey = [&cameraPos](const DrawItem& item) {
-        Vec3 pos{item.modelMatrix.m[3][0], item.modelMatrix.m[3][1], item.modelMatrix.m[3][2]};
-        Vec3 d = pos - cameraPos;
-        return d.x * d.x + d.y * d.y + d.z * d.z;
-    };
-
-    // 排序策略：
+    // 半透明三角形写入帧图临时资源（位于帧级内存，TransparentPass 消费）
+    ArenaVector<Triangle> localBlendTriangles(shared);
+    ArenaVector<Triangle>& blendTriangles =
+        context.deferredBlendTriangles ? *context.deferredBlendTriangles : localBlendTriangles;
+    // 绘制顺序由持久渲染队列的 64 位排序键决定（调用方已执行 UpdateSortKeys）：
     //   1. 不透明/Mask 物体先于半透明物体（alphaMode 枚举值：Opaque=0 < Mask=1 < Blend=2）
     //   2. 半透明物体按从远到近排序（正确的 Alpha 混合需后绘远处）
-    //   3. 同材质、同网格的物体合批（减少状态切换，提升 CPU 局部性）
-    std::stable_sort(sortedItems.begin(), sortedItems.end(), [&getItemSortKey](const DrawItem& a, const DrawItem& b) {
-        GLTFAlphaMode alphaModeA = a.material ? a.material->alphaMode : GLTFAlphaMode::Opaque;
-        GLTFAlphaMode alphaModeB = b.material ? b.material->alphaMode : GLTFAlphaMode::Opaque;
-        if (alphaModeA != alphaModeB) {
-            return alphaModeA < alphaModeB;  // 不透明排前
-        }
-        if (alphaModeA == GLTFAlphaMode::Blend) {
-            return getItemSortKey(a) > getItemSortKey(b);  // 半透明从远到近
-        }
-        // 不透明物体按材质/网格分组，减少状态切换
-        if (a.material != b.material) {
-            return a.material < b.material;
-        }
-        return a.mesh < b.mesh;
-    });
-    auto sortEnd = Clock::now();
+    //   3. 不透明物体同材质、同网格合批，组内从近到远
+    const RenderQueue& queue = *context.renderQueue;
+    auto setupEnd = Clock::now();
+
+    // 多视图：世界空间几何已在所有视图间共享构建，本视图只做裁剪空间变换与裁剪前剔除
+    if (context.multiViewGeometry) {
+        const MultiViewGeometry& geometry = *context.multiViewGeometry;
+        ProjectedGeometry projected = geometry.Project(
+            frameWithMaterials.view * frameWithMaterials.projection, frameWithMaterials.cameraPos, arena);
+        blendTriangles.clear();
+        blendTriangles.append(projected.blend.data(), projected.blend.size());
+        auto projectEnd = Clock::now();
+        stats.buildMs = std::chrono::duration<double, std::milli>(projectEnd - setupEnd).count();
+        stats.trianglesBuilt = geometry.GetOpaqueCount() + geometry.GetBlendCount();
+        stats.trianglesCulledBackface = projected.trianglesCulledBackface;
+        stats.trianglesCulledDegenerate = projected.trianglesCulledDegenerate;
+        stats.trianglesCulledOffscreen = projected.trianglesCulledOffscreen;
+
+        RasterizeOpaque(context, frameWithMaterials, rasterizer, projected.opaque.data(), projected.opaque.size(),
+                        !blendTriangles.empty(), stats);
+
+        char buf[256];
+        std::snprintf(buf, sizeof(buf),
+            "[SR-PERF] OpaquePass multi-view(ms): project=%.3f rast=%.3f opaqueT=%zu blendT=%zu\n",
+            stats.buildMs, stats.rastMs, projected.opaque.size(), blendTriangles.size());
+        SR_PERF_LOG(buf);
+        return stats;
+    }
 
-    const int numItems = static_cast<int>(sortedItems.size());
-    const int maxThreads = std::min(omp_get_max_threads(), kMaxBuildThreads);
+    const int numItems = static_cast<int>(queue.GetSortedEntries().size());
+    const int maxThreads = Parallel::MaxThreads();
+    arena.EnsureThreadRegions(maxThreads);
 
     // 单线程预注册：为每个 DrawItem 注册材质到 MaterialTable，获取预计算的 MaterialHandle
-    std::vector<MaterialHandle> materialHandles(static_cast<size_t>(numItems), InvalidMaterialHandle);
+    ArenaVector<MaterialHandle> materialHandles(shared);
+    materialHandles.assign(static_cast<size_t>(numItems), InvalidMaterialHandle);
     for (int i = 0; i < numItems; ++i) {
-        const DrawItem& item = sortedItems[static_cast<size_t>(i)];
+        const DrawItem& item = queue.GetSortedItem(static_cast<size_t>(i));
         if (!item.mesh || !item.material) {
             continue;
         }
         MaterialParams params = BuildMaterialParams(*item.material, item);
         materialHandles[static_cast<size_t>(i)] = context.materialTable->AddMaterial(params);
     }
+
+    // 拆分构建任务：实例化项按三角形规模切分实例区间，共享同一材质句柄
+    ArenaVector<BuildTask> buildTasks(shared);
+    buildTasks.reserve(static_cast<size_t>(numItems));
+    for (int i = 0; i < numItems; ++i) {
+        const DrawItem& item = queue.GetSortedItem(static_cast<size_t>(i));
+        if (!item.mesh || !item.material) {
+            continue;
+        }
+        if (!item.instances || item.instanceCount == 0) {
+            buildTasks.push_back(BuildTask{i, 0, 0});
+            continue;
+        }
+        size_t meshTris = std::max<size_t>(1, item.mesh->GetIndices().size() / 3);
+        size_t perTask = std::max<size_t>(1, kInstanceChunkTriangles / meshTris);
+        for (size_t begin = 0; begin < item.instanceCount; begin += perTask) {
+            buildTasks.push_back(BuildTask{i, begin, std::min(perTask, item.instanceCount - begin)});
+        }
+    }
+    const int numTasks = static_cast<int>(buildTasks.size());
     auto matRegEnd = Clock::now();
 
     using Clock = std::chrono::high_resolution_clock;
@@ -110,63 +199,67 @@ PassStats OpaquePass::Execute(RenderContext& context) {
 
     const OpenMPTuningOptions& ompCfg = frameWithMaterials.openmp;
 
-    // 并行几何处理：每个线程使用独立的 GeometryProcessor 和持久化三角形缓冲
-    // schedule(dynamic, 1) 适合不同 DrawItem 耗时差异较大的场景
-    #pragma omp parallel
-    {
-        const int tid = omp_get_thread_num();
-        auto& localOpaque = g_perThreadOpaque[tid];
-        auto& localBlend = g_perThreadBlend[tid];
-        localOpaque.clear();
-        localBlend.clear();
-        g_perThreadBuilt[tid] = 0;
-        GeometryProcessor localGP;
-        std::vector<Triangle> localItemTriangles;
-
-#if defined(SR_INTEL_OMP)
-        #pragma omp for schedule(guided, 1)
-#else
-        #pragma omp for schedule(dynamic, 1)
-#endif
-        for (int i = 0; i < numItems; ++i) {
-            const DrawItem& item = sortedItems[static_cast<size_t>(i)];
-            if (!item.mesh || !item.material) {
-                continue;
-            }
-
-            localGP.BuildTriangles(
-                *item.mesh,
-                item,
-                item.modelMatrix,
-                item.normalMatrix,
-                frameWithMaterials,
-                materialHandles[static_cast<size_t>(i)],
-                localItemTriangles);
-
-            g_perThreadBuilt[tid] += localGP.GetLastTriangleCount();
-            if (localItemTriangles.empty()) {
-                continue;
-            }
+    // 每线程输出槽位（共享区域）；三角形列表在各线程自己的区域中增长
+    ThreadBuildOutput* threadOutputs = shared.AllocateArray<ThreadBuildOutput>(static_cast<size_t>(maxThreads));
+    for (int t = 0; t < maxThreads; ++t) {
+        ArenaRegion& region = arena.ThreadRegion(t);
+        threadOutputs[t] = ThreadBuildOutput{ArenaVector<Triangle>(region), ArenaVector<Triangle>(region)};
+    }
 
-            GLTFAlphaMode alphaMode = item.material ? item.material->alphaMode : GLTFAlphaMode::Opaque;
-            if (alphaMode == GLTFAlphaMode::Blend) {
-                localBlend.insert(localBlend.end(), localItemTriangles.begin(), localItemTriangles.end());
+    // 并行几何处理：每个线程使用独立的 GeometryProcessor（实例模板跨任务复用），按 alphaMode 直接追加到本线程的列表
+    // 逐任务动态调度适合不同 DrawItem 耗时差异较大的场景
+    std::vector<GeometryProcessor> threadProcessors(static_cast<size_t>(maxThreads));
+    Parallel::ForRange(0, numTasks, ompCfg.drawItemBuildChunk, [&](int firstTask, int lastTask) {
+        const int tid = Parallel::ThreadIndex();
+        ThreadBuildOutput& local = threadOutputs[tid];
+        GeometryProcessor& localGP = threadProcessors[static_cast<size_t>(tid)];
+
+        for (int taskIndex = firstTask; taskIndex < lastTask; ++taskIndex) {
+            const BuildTask& task = buildTasks[static_cast<size_t>(taskIndex)];
+            const DrawItem& item = queue.GetSortedItem(static_cast<size_t>(task.itemIndex));
+            const MaterialHandle handle = materialHandles[static_cast<size_t>(task.itemIndex)];
+            const GLTFAlphaMode alphaMode = item.material ? item.material->alphaMode : GLTFAlphaMode::Opaque;
+            ArenaVector<Triangle>& target = alphaMode == GLTFAlphaMode::Blend ? local.blend : local.opaque;
+
+            if (task.instanceCount > 0) {
+                localGP.BuildTrianglesInstanced(
+                    *item.mesh,
+                    item,
+                    item.instances + task.instanceBegin,
+                    task.instanceCount,
+                    frameWithMaterials,
+                    handle,
+                    target);
             } else {
-                localOpaque.insert(localOpaque.end(), localItemTriangles.begin(), localItemTriangles.end());
+                localGP.BuildTriangles(
+                    *item.mesh,
+                    item,
+                    item.modelMatrix,
+                    item.normalMatrix,
+                    frameWithMaterials,
+                    handle,
+                    target);
             }
+
+            local.built += localGP.GetLastTriangleCount();
+            const RasterStats& cull = localGP.GetLastCullStats();
+            local.culledBackface += cull.trianglesCulledBackface;
+            local.culledDegenerate += cull.trianglesCulledDegenerate;
+            local.culledOffscreen += cull.trianglesCulledOffscreen;
         }
-    }
+    });
     auto buildEnd = Clock::now();
     stats.buildMs = std::chrono::duration<double, std::milli>(buildEnd - buildStart).count();
 
     if (ompCfg.enableProfiling) {
         char buffer[256];
         std::snprintf(buffer, sizeof(buffer),
-            "[SR-PERF] OpaquePass build: schedule=%s,%d threads=%d items=%d buildMs=%.3f\n",
+            "[SR-PERF] OpaquePass build: schedule=%s,%d threads=%d items=%d tasks=%d buildMs=%.3f\n",
             ScheduleName(ompCfg.drawItemBuildSchedule),
             std::max(1, ompCfg.drawItemBuildChunk),
-            omp_get_max_threads(),
+            maxThreads,
             numItems,
+            numTasks,
             stats.buildMs);
         SR_PERF_LOG(buffer);
 
@@ -178,7 +271,7 @@ PassStats OpaquePass::Execute(RenderContext& context) {
                 off += std::snprintf(perThread + off, sizeof(perThread) - static_cast<size_t>(off),
                     " [%d: %llutri]",
                     j,
-                    static_cast<unsigned long long>(g_perThreadBuilt[static_cast<size_t>(j)]));
+                    static_cast<unsigned long long>(threadOutputs[j].built));
             }
             off += std::snprintf(perThread + off, sizeof(perThread) - static_cast<size_t>(off), "\n");
             SR_PERF_LOG(perThread);
@@ -189,102 +282,108 @@ PassStats OpaquePass::Execute(RenderContext& context) {
     auto mergeStart = Clock::now();
 
     // 1) 计算 prefix sums（单线程，O(maxThreads) 很快）
-    std::vector<size_t> opaqueOffsets(static_cast<size_t>(maxThreads) + 1, 0);
-    std::vector<size_t> blendOffsets(static_cast<size_t>(maxThreads) + 1, 0);
+    size_t* opaqueOffsets = shared.AllocateArray<size_t>(static_cast<size_t>(maxThreads) + 1);
+    opaqueOffsets[0] = 0;
+    size_t totalBlend = 0;
     for (int t = 0; t < maxThreads; ++t) {
-        stats.trianglesBuilt += g_perThreadBuilt[t];
-        opaqueOffsets[static_cast<size_t>(t) + 1] = opaqueOffsets[static_cast<size_t>(t)] + g_perThreadOpaque[t].size();
-        blendOffsets[static_cast<size_t>(t) + 1] = blendOffsets[static_cast<size_t>(t)] + g_perThreadBlend[t].size();
+        const ThreadBuildOutput& local = threadOutputs[t];
+        stats.trianglesBuilt += local.built;
+        stats.trianglesCulledBackface += local.culledBackface;
+        stats.trianglesCulledDegenerate += local.culledDegenerate;
+        stats.trianglesCulledOffscreen += local.culledOffscreen;
+        opaqueOffsets[t + 1] = opaqueOffsets[t] + local.opaque.size();
+        totalBlend += local.blend.size();
     }
-    const size_t totalOpaque = opaqueOffsets[static_cast<size_t>(maxThreads)];
-    const size_t totalBlend = blendOffsets[static_cast<size_t>(maxThreads)];
+    const size_t totalOpaque = opaqueOffsets[maxThreads];
 
-    // 2) opaque: malloc + 并行 memcpy（避免 vector::resize 的默认构造开销）
-    //    blend: reserve + 串行 insert（数量少，无需优化）
+    // 2) opaque: 共享区域分配 + 并行 memcpy（各线程列表在光栅化期间仍保留，帧末统一回收）
+    //    blend: 串行追加到帧图临时资源（数量少，无需优化）
     Triangle* opaqueRaw = nullptr;
     if (totalOpaque > 0) {
-        opaqueRaw = static_cast<Triangle*>(std::malloc(totalOpaque * sizeof(Triangle)));
-        #pragma omp parallel for schedule(static, 1)
-        for (int t = 0; t < maxThreads; ++t) {
-            if (!g_perThreadOpaque[t].empty()) {
-                std::memcpy(opaqueRaw + opaqueOffsets[static_cast<size_t>(t)],
-                            g_perThreadOpaque[t].data(),
-                            g_perThreadOpaque[t].size() * sizeof(Triangle));
+        opaqueRaw = shared.AllocateArray<Triangle>(totalOpaque);
+        Parallel::For(0, maxThreads, 1, OpenMPSchedulePolicy::Static, [&](int t) {
+            const ArenaVector<Triangle>& local = threadOutputs[t].opaque;
+            if (!local.empty()) {
+                std::memcpy(opaqueRaw + opaqueOffsets[t], local.data(), local.size() * sizeof(Triangle));
             }
-        }
+        });
     }
     blendTriangles.clear();
     blendTriangles.reserve(totalBlend);
     for (int t = 0; t < maxThreads; ++t) {
-        if (!g_perThreadBlend[t].empty()) {
-            blendTriangles.insert(blendTriangles.end(),
-                std::make_move_iterator(g_perThreadBlend[t].begin()),
-                std::make_move_iterator(g_perThreadBlend[t].end()));
-        }
+        blendTriangles.append(threadOutputs[t].blend.data(), threadOutputs[t].blend.size());
     }
     auto mergeEnd = Clock::now();
 
-    // 光栅化不透明/Mask 三角形（启用 Early-Z）
-    if (totalOpaque > 0) {
-        auto rastStart = Clock::now();
-        RasterStats rastStats = rasterizer.RasterizeTriangles(opaqueRaw, totalOpaque);
-        auto rastEnd = Clock::now();
-        std::free(opaqueRaw);
-        opaqueRaw = nullptr;
-        stats.rastMs += std::chrono::duration<double, std::milli>(rastEnd - rastStart).count();
-        stats.trianglesClipped += rastStats.trianglesClipped;
-        stats.trianglesRendered += rastStats.trianglesRaster;
-        stats.pixelsTested += rastStats.pixelsTested;
-        stats.pixelsShaded += rastStats.pixelsShaded;
-    }
+    // 光栅化不透明/Mask 三角形（Tile 收尾在其中设置）
+    RasterizeOpaque(context, frameWithMaterials, rasterizer, opaqueRaw, totalOpaque, totalBlend > 0, stats);
     auto passEnd = Clock::now();
 
     // 详细内部阶段耗时
     {
-        double copyMs   = std::chrono::duration<double, std::milli>(copyEnd - passBegin).count();
-        double sortMs   = std::chrono::duration<double, std::milli>(sortEnd - copyEnd).count();
-        double matMs    = std::chrono::duration<double, std::milli>(matRegEnd - sortEnd).count();
+        double setupMs  = std::chrono::duration<double, std::milli>(setupEnd - passBegin).count();
+        double matMs    = std::chrono::duration<double, std::milli>(matRegEnd - setupEnd).count();
         double mergeMs  = std::chrono::duration<double, std::milli>(mergeEnd - mergeStart).count();
         double rastMs   = stats.rastMs;
         double totalMs  = std::chrono::duration<double, std::milli>(passEnd - passBegin).count();
-        double gapMs    = totalMs - copyMs - sortMs - matMs - stats.buildMs - mergeMs - rastMs;
+        double gapMs    = totalMs - setupMs - matMs - stats.buildMs - mergeMs - rastMs;
 
         char buf[512];
         std::snprintf(buf, sizeof(buf),
-            "[SR-PERF] OpaquePass detail(ms): copy=%.3f sort=%.3f matReg=%.3f build=%.3f merge=%.3f rast=%.3f total=%.3f gap=%.3f opaqueT=%zu blendT=%zu\n",
-            copyMs, sortMs, matMs, stats.buildMs, mergeMs, rastMs, totalMs, gapMs,
+            "[SR-PERF] OpaquePass detail(ms): setup=%.3f matReg=%.3f build=%.3f merge=%.3f rast=%.3f total=%.3f gap=%.3f opaqueT=%zu blendT=%zu\n",
+            setupMs, matMs, stats.buildMs, mergeMs, rastMs, totalMs, gapMs,
             totalOpaque, blendTriangles.size());
         SR_PERF_LOG(buf);
     }
 
-    // 将半透明三角形传递给 TransparentPass（通过 RenderContext 共享）
-    if (context.deferredBlendTriangles) {
-        *context.deferredBlendTriangles = std::move(blendTriangles);
-    }
-
     return stats;
 }
 
-PassStats TransparentPass::Execute(RenderContext& context) {
+PassStats TransparentSetupPass::Execute(RenderContext& context) {
     PassStats stats;
-    if (!context.deferredBlendTriangles || context.deferredBlendTriangles->empty()) {
+    if (!context.deferredBlendTriangles || context.deferredBlendTriangles->empty() || !context.preparedBlendTriangles) {
         return stats;
     }
-    if (!context.framebuffer || !context.depthBuffer || !context.frameContext || !context.materialTable) {
+    if (!context.framebuffer || !context.frameContext || !context.materialTable) {
         return stats;
     }
 
     FrameContext frameWithMaterials = *context.frameContext;
     frameWithMaterials.materialTable = context.materialTable;
 
+    // 只使用帧缓冲尺寸，结果留在临时资源所在的帧级内存中，由 TransparentPass 光栅化
     Rasterizer rasterizer;
     rasterizer.SetTargets(context.framebuffer, context.depthBuffer);
     rasterizer.SetFrameContext(frameWithMaterials);
+    rasterizer.SetFrameArena(context.transientArena);
+
+    const ArenaVector<Triangle>& blendTriangles = *context.deferredBlendTriangles;
+    *context.preparedBlendTriangles = rasterizer.PrepareTriangles(blendTriangles.data(), blendTriangles.size());
+
+    const RasterStats& prepStats = context.preparedBlendTriangles->stats;
+    stats.trianglesRendered = prepStats.trianglesRaster;
+    stats.trianglesClipped = prepStats.trianglesClipped;
+    stats.shaderUsage = prepStats.shaderUsage;
+
+    return stats;
+}
 
-    RasterStats rastStats = rasterizer.RasterizeTriangles(*context.deferredBlendTriangles);
+PassStats TransparentPass::Execute(RenderContext& context) {
+    PassStats stats;
+    if (!context.preparedBlendTriangles || context.preparedBlendTriangles->triangles.empty()) {
+        return stats;
+    }
+    if (!context.framebuffer || !context.depthBuffer || !context.frameContext) {
+        return stats;
+    }
+
+    Rasterizer rasterizer;
+    rasterizer.SetTargets(context.framebuffer, context.depthBuffer);
+    rasterizer.SetFrameContext(*context.frameContext);
+    rasterizer.SetFrameArena(context.transientArena);
+
+    RasterStats rastStats = rasterizer.RasterizePrepared(*context.preparedBlendTriangles);
 
-    stats.trianglesRendered = rastStats.trianglesRaster;
-    stats.trianglesClipped = rastStats.trianglesClipped;
     stats.pixelsTested = rastStats.pixelsTested;
     stats.pixelsShaded = rastStats.pixelsShaded;
 
@@ -295,6 +394,7 @@ PassStats TransparentPass::Execute(RenderContext& context) {
 bool SkyboxPass::ShouldExecute(const RenderContext& context) const {
     if (!context.frameContext) return false;
     const FrameContext* fc = context.frameContext;
+    if (context.skyboxFilled) return false;  // 已由 OpaquePass 的 Tile 收尾完成
     return fc->environmentMap != nullptr && fc->environmentMap->IsLoaded();
 }
 
@@ -315,44 +415,13 @@ PassStats SkyboxPass::Execute(RenderContext& context) {
         return stats;
     }
 
-    // 计算 VP 矩阵的逆，用于将屏幕像素反投影到世界空间方向
-    Mat4 vp = frame.view * frame.projection;
-    Mat4 invVP = vp.Inverse();
-
-    // 并行遍历所有像素：只处理深度为 1.0（远平面）的像素（未被几何覆盖）
-#if defined(SR_INTEL_OMP)
-    #pragma omp parallel for schedule(guided)
-#else
-    #pragma omp parallel for schedule(dynamic)
-#endif
-    for (int y = 0; y < height; ++y) {
-        for (int x = 0; x < width; ++x) {
-            size_t idx = static_cast<size_t>(y) * static_cast<size_t>(width) + static_cast<size_t>(x);
-            if (depthData[idx] < 0.9999) continue;  // 已有不透明几何，跳过
-
-            // 将像素中心转换为 NDC 坐标
-            double ndcX = (2.0 * (x + 0.5) / width) - 1.0;
-            double ndcY = 1.0 - (2.0 * (y + 0.5) / height);
-
-            // 反投影近平面和远平面点到世界空间，求射线方向
-            Vec4 nearClip{ndcX, ndcY, 0.0, 1.0};
-            Vec4 farClip{ndcX, ndcY, 1.0, 1.0};
-            Vec4 nearWorld = invVP.Multiply(nearClip);
-            Vec4 farWorld = invVP.Multiply(farClip);
-            if (std::abs(nearWorld.w) < 1e-12 || std::abs(farWorld.w) < 1e-12) continue;
-
-            Vec3 nearPt{nearWorld.x / nearWorld.w, nearWorld.y / nearWorld.w, nearWorld.z / nearWorld.w};
-            Vec3 farPt{farWorld.x / farWorld.w, farWorld.y / farWorld.w, farWorld.z / farWorld.w};
-            Vec3 dir{farPt.x - nearPt.x, farPt.y - nearPt.y, farPt.z - nearPt.z};
-            // 归一化方向向量（用于采样等距柱形投影环境贴图）
-            double len = std::sqrt(dir.x * dir.x + dir.y * dir.y + dir.z * dir.z);
-            if (len > 1e-12) {
-                double inv = 1.0 / len;
-                dir.x *= inv; dir.y *= inv; dir.z *= inv;
-            }
-            linearPixels[idx] = envMap->SampleDirection(dir);
-        }
-    }
+    // 像素视线方向对屏幕坐标是仿射的：每帧反投影一次，逐像素增量步进
+    const ViewRayStepper rays = ViewRayStepper::FromFrame(frame, width, height);
+
+    // 按行并行：只处理深度为 1.0（远平面）的像素（未被几何覆盖），与 Tile 收尾共用同一实现
+    Parallel::For(0, height, 1, Parallel::kBalanced, [&](int y) {
+        FillSkyRect(*envMap, rays, depthData, linearPixels, width, 0, y, width - 1, y);
+    });
 
     return stats;
 }
@@ -364,16 +433,16 @@ PassStats PostProcessPass::Execute(RenderContext& context) {
         return stats;
     }
 
-    // 执行 FXAA 抗锯齿
-    if (m_fxaaEnabled) {
+    if (m_toneMappingEnabled && context.outputResolved) {
+        // 已在光栅化 Tile 收尾中完成色调映射与 sRGB 输出
+    } else if (m_toneMappingEnabled) {
+        // FXAA + 色调映射 + sRGB 转换单趟融合
+        context.framebuffer->ResolveToSRGB(m_exposure, false, m_fxaaEnabled);
+    } else if (m_fxaaEnabled) {
+        // HDR 输出：FXAA 结果写回线性缓冲
         context.framebuffer->ApplyFXAA();
     }
 
-    // 执行色调映射和 sRGB 转换
-    if (m_toneMappingEnabled) {
-        context.framebuffer->ResolveToSRGB(m_exposure, false);
-    }
-
     return stats;
 }
 
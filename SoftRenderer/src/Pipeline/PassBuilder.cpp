@@ -5,6 +5,20 @@
 
 namespace SR {
 
+std::string FormatResourceMask(FrameResourceMask mask) {
+    static constexpr const char* kNames[] = {"Color", "Depth", "Output", "BlendTriangles", "Materials", "FrameMemory", "BlendBins"};
+    std::string result;
+    for (uint32_t bit = 0; bit < sizeof(kNames) / sizeof(kNames[0]); ++bit) {
+        if (mask & (1u << bit)) {
+            if (!result.empty()) {
+                result += '|';
+            }
+            result += kNames[bit];
+        }
+    }
+    return result.empty() ? std::string("none") : result;
+}
+
 PassBuilder& PassBuilder::AddPass(std::unique_ptr<RenderPass> pass) {
     if (!pass) {
         m_error = "Cannot add null pass";
@@ -50,6 +64,18 @@ PassBuilder& PassBuilder::SetCondition(const std::string& passName, PassConditio
     return *this;
 }
 
+PassBuilder& PassBuilder::ConfigurePasses(const PassConfigurator& configure) {
+    if (!configure) {
+        return *this;
+    }
+    for (auto& [name, node] : m_passes) {
+        if (node.pass) {
+            configure(*node.pass);
+        }
+    }
+    return *this;
+}
+
 /**
  * @brief 对所有 Pass 进行拓扑排序（Kahn 算法）
  *
@@ -107,6 +133,57 @@ bool PassBuilder::HasCircularDependency() const {
     return TopologicalSort().size() != m_passes.size();
 }
 
+/**
+ * @brief 检查资源声明
+ *
+ * 按拓扑序求出每个 Pass 的全部（传递）前驱；互不可达的两个 Pass 执行顺序不确定、可能并发，
+ * 只要一方写入的资源被另一方读取或写入就视为冲突，须由调用方补充依赖。
+ */
+bool PassBuilder::ValidateResources(const std::vector<std::string>& order) const {
+    const size_t count = order.size();
+    std::unordered_map<std::string, size_t> indexOf;
+    std::vector<PassResources> resources(count);
+    for (size_t i = 0; i < count; ++i) {
+        indexOf[order[i]] = i;
+        const PassNode& node = m_passes.at(order[i]);
+        resources[i] = node.pass ? node.pass->GetResources() : PassResources{};
+        if (resources[i].overwrites & ~resources[i].writes) {
+            m_error = "Pass '" + order[i] + "' overwrites " +
+                      FormatResourceMask(resources[i].overwrites & ~resources[i].writes) + " without writing it";
+            return false;
+        }
+    }
+
+    // reachable[i][j]：j 是 i 的（传递）前驱；拓扑序保证前驱的行已经求完
+    std::vector<std::vector<char>> reachable(count, std::vector<char>(count, 0));
+    for (size_t i = 0; i < count; ++i) {
+        for (const auto& dep : m_passes.at(order[i]).dependencies) {
+            const size_t d = indexOf.at(dep);
+            reachable[i][d] = 1;
+            for (size_t k = 0; k < count; ++k) {
+                reachable[i][k] |= reachable[d][k];
+            }
+        }
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        for (size_t j = 0; j < i; ++j) {
+            if (reachable[i][j]) {
+                continue;
+            }
+            const PassResources& a = resources[i];
+            const PassResources& b = resources[j];
+            const FrameResourceMask conflict = (a.writes & (b.reads | b.writes)) | (b.writes & a.reads);
+            if (conflict != 0) {
+                m_error = "Passes '" + order[j] + "' and '" + order[i] + "' have no dependency but both access " +
+                          FormatResourceMask(conflict) + " with at least one writing it";
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 bool PassBuilder::Validate() const {
     if (m_passes.empty()) {
         m_error = "No passes added to pipeline";
@@ -118,11 +195,15 @@ bool PassBuilder::Validate() const {
         return false;
     }
 
+    if (!ValidateResources(TopologicalSort())) {
+        return false;
+    }
+
     m_error.clear();
     return true;
 }
 
-std::vector<std::unique_ptr<RenderPass>> PassBuilder::Build() {
+std::vector<std::unique_ptr<RenderPass>> PassBuilder::Build(PassDependencies* dependencies) {
     std::vector<std::unique_ptr<RenderPass>> result;
 
     if (!Validate()) {
@@ -132,13 +213,29 @@ std::vector<std::unique_ptr<RenderPass>> PassBuilder::Build() {
     std::vector<std::string> sortedNames = TopologicalSort();
     result.reserve(sortedNames.size());
 
+    // 只收集实例有效的 Pass，依赖下标按收集后的位置重新编号
+    std::unordered_map<std::string, int> indexOf;
     for (const auto& name : sortedNames) {
         auto it = m_passes.find(name);
         if (it != m_passes.end() && it->second.pass) {
+            indexOf[name] = static_cast<int>(result.size());
             result.push_back(std::move(it->second.pass));
         }
     }
 
+    if (dependencies) {
+        dependencies->assign(result.size(), {});
+        for (const auto& [name, index] : indexOf) {
+            for (const auto& dep : m_passes.at(name).dependencies) {
+                auto depIt = indexOf.find(dep);
+                if (depIt != indexOf.end()) {
+                    (*dependencies)[static_cast<size_t>(index)].push_back(depIt->second);
+                }
+            }
+            std::sort((*dependencies)[static_cast<size_t>(index)].begin(), (*dependencies)[static_cast<size_t>(index)].end());
+        }
+    }
+
     // Build 完成后清空构建器状态，防止重复使用
     m_passes.clear();
     m_error.clear();
@@ -153,7 +250,7 @@ void PassBuilder::Clear() {
 
 // ============================================================================
 // DefaultPipeline — 标准渲染管线配置
-// 执行顺序：OpaquePass → SkyboxPass → TransparentPass → PostProcessPass
+// 执行顺序：OpaquePass → (TransparentSetupPass ∥ SkyboxPass) → TransparentPass → PostProcessPass
 // ============================================================================
 
 std::vector<std::unique_ptr<RenderPass>> DefaultPipeline::Create() {
@@ -163,17 +260,21 @@ std::vector<std::unique_ptr<RenderPass>> DefaultPipeline::Create() {
 }
 
 PassBuilder& DefaultPipeline::Configure(PassBuilder& builder) {
-    // 注册四个标准渲染阶段
-    builder.AddPass(std::make_unique<OpaquePass>());       // 不透明/Mask 几何体
-    builder.AddPass(std::make_unique<SkyboxPass>());       // 天空盒（填充深度为远平面的像素）
-    builder.AddPass(std::make_unique<TransparentPass>());  // 半透明几何体（从远到近排序）
+    // 注册标准渲染阶段
+    builder.AddPass(std::make_unique<OpaquePass>());            // 不透明/Mask 几何体
+    builder.AddPass(std::make_unique<TransparentSetupPass>());  // 半透明三角形裁剪与分箱
+    builder.AddPass(std::make_unique<SkyboxPass>());            // 天空盒（填充深度为远平面的像素）
+    builder.AddPass(std::make_unique<TransparentPass>());       // 半透明几何体（从远到近排序）
     builder.AddPass(std::make_unique<PostProcessPass>());  // 后处理（FXAA + 色调映射）
 
     // 天空盒必须在不透明几何体之后（避免覆盖已有像素）
     builder.AddDependency("SkyboxPass", "OpaquePass");
+    // 半透明三角形由不透明 Pass 产出；准备阶段不访问颜色 / 深度，与天空盒之间没有依赖
+    builder.AddDependency("TransparentSetupPass", "OpaquePass");
     // 透明物体必须在不透明和天空盒之后（正确的混合需要完整的背景色）
     builder.AddDependency("TransparentPass", "OpaquePass");
     builder.AddDependency("TransparentPass", "SkyboxPass");
+    builder.AddDependency("TransparentPass", "TransparentSetupPass");
     // 后处理必须在所有渲染 Pass 完成后执行
     builder.AddDependency("PostProcessPass", "OpaquePass");
     builder.AddDependency("PostProcessPass", "SkyboxPass");
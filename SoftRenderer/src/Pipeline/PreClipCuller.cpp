@@ -0,0 +1,95 @@
+#include "Pipeline/PreClipCuller.h"
+
+#include <bit>
+#include <immintrin.h>
+
+#include "Pipeline/Rasterizer.h"
+
+namespace SR {
+
+namespace {
+
+/// 退化三角形的相对行列式阈值（远低于单个像素面积，仅剔除数值意义上的零面积三角形）
+constexpr double kDegenerateEpsilon = 1e-12;
+
+} // namespace
+
+/**
+ * @brief 8 个三角形分两组 __m256d 处理，输出存活位掩码
+ */
+uint32_t PreClipCuller::CullBatch(const PreClipCullBatch& batch, int count, bool cullBackface, RasterStats& stats) const {
+    if (count <= 0) {
+        return 0u;
+    }
+    const uint32_t validMask = (count >= PreClipCullBatch::kSize) ? 0xFFu : ((1u << count) - 1u);
+
+    const __m256d zero = _mm256_setzero_pd();
+    uint32_t offscreenMask = 0;
+    uint32_t degenerateMask = 0;
+    uint32_t backfaceMask = 0;
+
+    for (int half = 0; half < PreClipCullBatch::kSize; half += 4) {
+        __m256d x0 = _mm256_load_pd(&batch.x[0][half]);
+        __m256d y0 = _mm256_load_pd(&batch.y[0][half]);
+        __m256d z0 = _mm256_load_pd(&batch.z[0][half]);
+        __m256d w0 = _mm256_load_pd(&batch.w[0][half]);
+        __m256d x1 = _mm256_load_pd(&batch.x[1][half]);
+        __m256d y1 = _mm256_load_pd(&batch.y[1][half]);
+        __m256d z1 = _mm256_load_pd(&batch.z[1][half]);
+        __m256d w1 = _mm256_load_pd(&batch.w[1][half]);
+        __m256d x2 = _mm256_load_pd(&batch.x[2][half]);
+        __m256d y2 = _mm256_load_pd(&batch.y[2][half]);
+        __m256d z2 = _mm256_load_pd(&batch.z[2][half]);
+        __m256d w2 = _mm256_load_pd(&batch.w[2][half]);
+
+        // 三个顶点同时位于某个平面外侧 => 整个三角形在视锥外
+        auto allOutside = [](__m256d a0, __m256d b0, __m256d a1, __m256d b1, __m256d a2, __m256d b2) {
+            return _mm256_and_pd(_mm256_and_pd(_mm256_cmp_pd(a0, b0, _CMP_LT_OQ),
+                                               _mm256_cmp_pd(a1, b1, _CMP_LT_OQ)),
+                                 _mm256_cmp_pd(a2, b2, _CMP_LT_OQ));
+        };
+        __m256d nw0 = _mm256_sub_pd(zero, w0);
+        __m256d nw1 = _mm256_sub_pd(zero, w1);
+        __m256d nw2 = _mm256_sub_pd(zero, w2);
+        __m256d outside = allOutside(x0, nw0, x1, nw1, x2, nw2);                      // x < -w
+        outside = _mm256_or_pd(outside, allOutside(w0, x0, w1, x1, w2, x2));          // x >  w
+        outside = _mm256_or_pd(outside, allOutside(y0, nw0, y1, nw1, y2, nw2));       // y < -w
+        outside = _mm256_or_pd(outside, allOutside(w0, y0, w1, y1, w2, y2));          // y >  w
+        outside = _mm256_or_pd(outside, allOutside(z0, zero, z1, zero, z2, zero));    // z <  0
+        outside = _mm256_or_pd(outside, allOutside(w0, z0, w1, z1, w2, z2));          // z >  w
+
+        // det = x0 (y1 w2 - w1 y2) - y0 (x1 w2 - w1 x2) + w0 (x1 y2 - y1 x2)
+        __m256d c0 = _mm256_fmsub_pd(y1, w2, _mm256_mul_pd(w1, y2));
+        __m256d c1 = _mm256_fmsub_pd(x1, w2, _mm256_mul_pd(w1, x2));
+        __m256d c2 = _mm256_fmsub_pd(x1, y2, _mm256_mul_pd(y1, x2));
+        __m256d det = _mm256_fmadd_pd(w0, c2, _mm256_fmsub_pd(x0, c0, _mm256_mul_pd(y0, c1)));
+
+        // 退化判定使用相对阈值：两个顶点重合时 FMA 舍入会留下 ~1e-16 量级的残差，
+        // 以三个顶点 |x|+|y|+|w| 之积为尺度，低于 kDegenerateEpsilon 视为零面积
+        const __m256d absMask = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7FFFFFFFFFFFFFFFLL));
+        auto l1 = [&absMask](__m256d x, __m256d y, __m256d w) {
+            return _mm256_add_pd(_mm256_add_pd(_mm256_and_pd(x, absMask), _mm256_and_pd(y, absMask)), _mm256_and_pd(w, absMask));
+        };
+        __m256d scale = _mm256_mul_pd(_mm256_mul_pd(l1(x0, y0, w0), l1(x1, y1, w1)), l1(x2, y2, w2));
+        __m256d threshold = _mm256_mul_pd(scale, _mm256_set1_pd(kDegenerateEpsilon));
+        __m256d degenerate = _mm256_cmp_pd(_mm256_and_pd(det, absMask), threshold, _CMP_LE_OQ);
+
+        const int shift = half;
+        offscreenMask |= static_cast<uint32_t>(_mm256_movemask_pd(outside)) << shift;
+        degenerateMask |= static_cast<uint32_t>(_mm256_movemask_pd(degenerate)) << shift;
+        backfaceMask |= static_cast<uint32_t>(_mm256_movemask_pd(_mm256_cmp_pd(det, zero, _CMP_LT_OQ))) << shift;
+    }
+
+    // 每个三角形只计入第一个命中的剔除原因
+    offscreenMask &= validMask;
+    degenerateMask &= validMask & ~offscreenMask;
+    backfaceMask = cullBackface ? (backfaceMask & validMask & ~offscreenMask & ~degenerateMask) : 0u;
+
+    stats.trianglesCulledOffscreen += static_cast<uint64_t>(std::popcount(offscreenMask));
+    stats.trianglesCulledDegenerate += static_cast<uint64_t>(std::popcount(degenerateMask));
+    stats.trianglesCulledBackface += static_cast<uint64_t>(std::popcount(backfaceMask));
+
+    return validMask & ~(offscreenMask | degenerateMask | backfaceMask);
+}
+
+} // namespace SR
@@ -1,7 +1,10 @@
 #include "Pipeline/Rasterizer.h"
 
+#include "Core/FrameArena.h"
+#include "Core/Parallel.h"
 #include "Pipeline/FragmentShader.h"
 #include "Pipeline/Clipper.h"
+#include "Pipeline/LightCuller.h"
 #include "Pipeline/MaterialTable.h"
 #include "Utils/DebugLog.h"
 #include "Utils/TextureSampler.h"
@@ -10,6 +13,7 @@
 
 #include <algorithm>
 #include <atomic>
+#include <bit>
 #include <cstddef>
 #include <cmath>
 #include <cstring>
@@ -17,7 +21,7 @@
 #include <cstdio>
 #include <chrono>
 #include <limits>
-#include <omp.h>
+#include <span>
 
 #include <immintrin.h>
 
@@ -34,11 +38,25 @@ const char* ScheduleName(OpenMPSchedulePolicy policy) {
     }
 }
 
+/// 从帧级内存区域分配 count 个未初始化元素
+template<typename T>
+std::span<T> AllocateSpan(ArenaRegion& region, size_t count) {
+    return std::span<T>(region.AllocateArray<T>(count), count);
+}
+
+/// 仅深度路径建立 / 分箱阶段的并行块长度（三角形数）
+constexpr int kDepthSetupChunk = 256;
+
+/// 每线程直方图的行跨度（按 64 字节对齐，避免相邻线程的计数落在同一缓存行）
+inline size_t HistogramStride(int totalTiles) {
+    return (static_cast<size_t>(totalTiles) + 7) & ~static_cast<size_t>(7);
+}
+
 bool ValidateBinningConsistency(
     int totalTiles,
-    const std::vector<size_t>& binCounts,
-    const std::vector<size_t>& binOffsets,
-    const std::vector<size_t>& binWriteCursor,
+    std::span<const size_t> binCounts,
+    std::span<const size_t> binOffsets,
+    std::span<const size_t> binWriteCursor,
     size_t totalBinRefs) {
     if (totalTiles < 0) {
         return false;
@@ -155,11 +173,14 @@ inline Vec4 InterpolateVec4(const Vec4& a0, const Vec4& a1, const Vec4& a2,
     return out;
 }
 
+} // namespace
+
 /**
  * @brief 光栅化阶段的三角形中间表示
  *
  * 包含屏幕空间坐标、透视除法后的属性、材质数据和边函数系数。
  * 所有顶点属性均已除以 w（为透视正确插值做准备）。
+ * 头文件中前向声明（PreparedTriangles 持有其数组），因此不在匿名命名空间中。
  */
 struct RasterTriangle {
     double sx0, sy0, sx1, sy1, sx2, sy2; ///< 屏幕空间顶点坐标
@@ -167,6 +188,9 @@ struct RasterTriangle {
 
     Vec2 t0_over_w,   t1_over_w,   t2_over_w;   ///< 主 UV / w
     Vec2 t0_1_over_w, t1_1_over_w, t2_1_over_w; ///< 次 UV / w
+    double dInvWdx, dInvWdy;                     ///< 1/w 的屏幕空间梯度
+    Vec2 dT0dx, dT0dy;                           ///< 主 UV / w 的屏幕空间梯度
+    Vec2 dT1dx, dT1dy;                           ///< 次 UV / w 的屏幕空间梯度
     Vec4 c0_over_w,   c1_over_w,   c2_over_w;   ///< 顶点颜色 / w
     Vec3 tg0_over_w,  tg1_over_w,  tg2_over_w;  ///< 切线 / w
     double tangentW;                              ///< 切线 W 分量（副切线方向符号）
@@ -192,6 +216,7 @@ struct RasterTriangle {
     Vec3   specularColorFactor;
 
     TextureBindingArray textures; ///< 纹理绑定数组（从 MaterialTable 复制）
+    ShaderFeatureMask shaderFeatures; ///< 着色器变体掩码（材质特性 + 帧级环境贴图）
 
     int minX, maxX, minY, maxY; ///< 屏幕空间包围盒（像素坐标）
     double area;     ///< 有向面积（用于确定方向）
@@ -203,91 +228,90 @@ struct RasterTriangle {
     double A01, B01, C01; ///< 边 v0→v1 的系数
 };
 
+namespace {
+
 /**
- * @brief 无初始化缓冲区（替代 std::vector，避免 resize 默认构造大量 POD 对象）
+ * @brief 仅深度光栅化的三角形中间表示（边函数 + 屏幕空间深度平面）
  *
- * 要求 T 为平凡可析构类型（不调用析构函数）。
- * 跨帧复用分配：capacity 只增不减，后续帧仅更新 size 指针。
+ * NDC 深度对屏幕坐标线性，depth(x, y) = zDx·x + zDy·y + zC，无需逐像素透视插值。
  */
-template<typename T>
-struct UninitBuffer {
-    T* m_data = nullptr;
-    size_t m_size = 0;
-    size_t m_capacity = 0;
-
-    UninitBuffer() = default;
-    ~UninitBuffer() { std::free(m_data); }
-    UninitBuffer(const UninitBuffer&) = delete;
-    UninitBuffer& operator=(const UninitBuffer&) = delete;
-
-    /** @brief 设置逻辑大小，必要时扩容（不初始化新元素） */
-    void resize(size_t n) {
-        if (n > m_capacity) {
-            std::free(m_data);
-            m_capacity = n + n / 4; // 25% 余量，减少后续帧 realloc
-            m_data = static_cast<T*>(std::malloc(m_capacity * sizeof(T)));
-        }
-        m_size = n;
-    }
-
-    void clear() { m_size = 0; }
-    [[nodiscard]] size_t size() const { return m_size; }
-    [[nodiscard]] bool empty() const { return m_size == 0; }
-    T& operator[](size_t i) { return m_data[i]; }
-    const T& operator[](size_t i) const { return m_data[i]; }
-    T* data() { return m_data; }
-    const T* data() const { return m_data; }
+struct DepthRasterTriangle {
+    double A12, B12, C12; ///< 边 v1→v2 的系数
+    double A20, B20, C20; ///< 边 v2→v0 的系数
+    double A01, B01, C01; ///< 边 v0→v1 的系数
+    double zDx, zDy, zC;  ///< 深度平面系数
+    int minX, maxX, minY, maxY; ///< 屏幕空间包围盒（像素坐标，minX > maxX 表示不光栅化）
 };
 
 /**
- * @brief 光栅化阶段复用的临时缓冲区（线程局部存储，避免重复堆分配）
+ * @brief 建立仅深度三角形（顶点 w 必须为正）
+ * @return false 表示退化或完全位于视口外
  */
-struct RasterScratchBuffers {
-    UninitBuffer<RasterTriangle> rasterTris;  ///< 裁剪后的光栅化三角形列表（无初始化缓冲区）
-
-    // Tile 坐标缓存（仅在分辨率变化时重建）
-    std::vector<int> tileMinXs;
-    std::vector<int> tileMinYs;
-    std::vector<int> tileMaxXs;
-    std::vector<int> tileMaxYs;
-
-    // Tile Binning 数据结构（两遍统计 + 前缀和 + 填充）
-    std::vector<size_t> binCounts;      ///< 每个 Tile 的三角形引用计数
-    std::vector<size_t> binOffsets;     ///< 前缀和：Tile 在 binTriIndices 中的起始位置
-    std::vector<size_t> binWriteCursor; ///< 填充阶段的写游标（原子操作）
-    std::vector<size_t> binTriIndices;  ///< 各 Tile 引用的三角形索引数组（紧密存储）
-
-    // 每个三角形覆盖的 Tile 范围
-    std::vector<int> triMinTileX;
-    std::vector<int> triMaxTileX;
-    std::vector<int> triMinTileY;
-    std::vector<int> triMaxTileY;
-
-    // 缓存的分辨率信息（用于判断是否需要重建 Tile 网格）
-    int cachedWidth   = -1;
-    int cachedHeight  = -1;
-    int cachedTilesX  = -1;
-    int cachedTilesY  = -1;
-};
+inline bool SetupDepthTriangle(const Vec4& c0, const Vec4& c1, const Vec4& c2, int width, int height,
+                               DepthRasterTriangle& dt) {
+    const double invW0 = 1.0 / c0.w;
+    const double invW1 = 1.0 / c1.w;
+    const double invW2 = 1.0 / c2.w;
+    const double sx0 = (c0.x * invW0 * 0.5 + 0.5) * static_cast<double>(width - 1);
+    const double sx1 = (c1.x * invW1 * 0.5 + 0.5) * static_cast<double>(width - 1);
+    const double sx2 = (c2.x * invW2 * 0.5 + 0.5) * static_cast<double>(width - 1);
+    const double sy0 = (1.0 - (c0.y * invW0 * 0.5 + 0.5)) * static_cast<double>(height - 1);
+    const double sy1 = (1.0 - (c1.y * invW1 * 0.5 + 0.5)) * static_cast<double>(height - 1);
+    const double sy2 = (1.0 - (c2.y * invW2 * 0.5 + 0.5)) * static_cast<double>(height - 1);
+
+    // 包围盒先在浮点域夹取，避免视口外很远的顶点转 int 溢出
+    dt.minX = static_cast<int>(std::floor(std::max(std::min({sx0, sx1, sx2}), 0.0)));
+    dt.maxX = static_cast<int>(std::ceil(std::min(std::max({sx0, sx1, sx2}), static_cast<double>(width - 1))));
+    dt.minY = static_cast<int>(std::floor(std::max(std::min({sy0, sy1, sy2}), 0.0)));
+    dt.maxY = static_cast<int>(std::ceil(std::min(std::max({sy0, sy1, sy2}), static_cast<double>(height - 1))));
+    if (dt.minX > dt.maxX || dt.minY > dt.maxY) {
+        return false;
+    }
 
-/// 每线程独立的光栅化临时缓冲区（避免线程间竞争）
-thread_local RasterScratchBuffers g_rasterScratch;
+    const double area = (sx2 - sx0) * (sy1 - sy0) - (sy2 - sy0) * (sx1 - sx0);
+    if (area == 0.0) {
+        return false;
+    }
+    const double invArea = 1.0 / area;
+    dt.A12 = sy2 - sy1; dt.B12 = sx1 - sx2; dt.C12 = sx2 * sy1 - sx1 * sy2;
+    dt.A20 = sy0 - sy2; dt.B20 = sx2 - sx0; dt.C20 = sx0 * sy2 - sx2 * sy0;
+    dt.A01 = sy1 - sy0; dt.B01 = sx0 - sx1; dt.C01 = sx1 * sy0 - sx0 * sy1;
+
+    const double z0 = c0.z * invW0;
+    const double z1 = c1.z * invW1;
+    const double z2 = c2.z * invW2;
+    dt.zDx = (dt.A12 * z0 + dt.A20 * z1 + dt.A01 * z2) * invArea;
+    dt.zDy = (dt.B12 * z0 + dt.B20 * z1 + dt.B01 * z2) * invArea;
+    dt.zC = (dt.C12 * z0 + dt.C20 * z1 + dt.C01 * z2) * invArea;
+    return true;
+}
 
-/// 持久化的每线程裁剪结果缓冲区（避免每帧 malloc/free 32 个大 vector）
-static constexpr int kMaxClipThreads = 64;
-static std::vector<RasterTriangle> g_perThreadClipTris[kMaxClipThreads];
-static uint64_t g_perThreadClipCount[kMaxClipThreads] = {};
+/**
+ * @brief 透视校正的逐像素 UV 导数（用于 mip 选级）
+ *
+ * uv = (Σ bᵢ·uvᵢ/wᵢ) / (Σ bᵢ/wᵢ)，重心坐标 bᵢ 对屏幕坐标线性，故
+ * ∂uv/∂x = (∂(uv/w)/∂x − uv·∂(1/w)/∂x) · w，两个梯度均为三角形常量。
+ */
+inline void InterpolateTexCoordGradients(const RasterTriangle& rt, double wVal, FragmentVarying& varying) {
+    const Vec2& uv0 = varying.texCoord;
+    const Vec2& uv1 = varying.texCoord1;
+    varying.texCoordDx = Vec2{(rt.dT0dx.x - uv0.x * rt.dInvWdx) * wVal, (rt.dT0dx.y - uv0.y * rt.dInvWdx) * wVal};
+    varying.texCoordDy = Vec2{(rt.dT0dy.x - uv0.x * rt.dInvWdy) * wVal, (rt.dT0dy.y - uv0.y * rt.dInvWdy) * wVal};
+    varying.texCoord1Dx = Vec2{(rt.dT1dx.x - uv1.x * rt.dInvWdx) * wVal, (rt.dT1dx.y - uv1.y * rt.dInvWdx) * wVal};
+    varying.texCoord1Dy = Vec2{(rt.dT1dy.x - uv1.x * rt.dInvWdy) * wVal, (rt.dT1dy.y - uv1.y * rt.dInvWdy) * wVal};
+}
 
-double SampleTextureChannel(const FrameContext& context, int imageIndex, int samplerIndex, const Vec2& uv, int channel) {
+double SampleTextureChannel(const FrameContext& context, int imageIndex, int samplerIndex, const Vec2& uv, int channel, bool srgb) {
     if (!context.images || imageIndex < 0 || imageIndex >= static_cast<int>(context.images->size())) {
         return 1.0;
     }
-    const GLTFImage& image = (*context.images)[imageIndex];
     const GLTFSampler* sampler = nullptr;
     if (context.samplers && samplerIndex >= 0 && samplerIndex < static_cast<int>(context.samplers->size())) {
         sampler = &(*context.samplers)[samplerIndex];
     }
-    SampledColor sampled = SampleImageNearest(image, sampler, uv, false);
+    const PreparedTexture* prepared = context.preparedTextures ? context.preparedTextures->Find(imageIndex, srgb) : nullptr;
+    SampledColor sampled = prepared ? SampleTextureNearest(*prepared, sampler, uv)
+                                    : SampleImageNearest((*context.images)[imageIndex], sampler, uv, srgb);
     switch (channel) {
     case 0: return sampled.rgb.x;
     case 1: return sampled.rgb.y;
@@ -314,6 +338,29 @@ void Rasterizer::SetTargets(Framebuffer* framebuffer, DepthBuffer* depthBuffer)
  */
 void Rasterizer::SetFrameContext(const FrameContext& context) {
     m_frameContext = context;
+    m_frameArena = context.frameArena;
+    m_cancelRequested = context.cancelRequested;
+}
+
+/**
+ * @brief 设置帧级临时内存
+ */
+void Rasterizer::SetFrameArena(FrameArena* arena) {
+    m_frameArena = arena;
+}
+
+/**
+ * @brief 设置 Tile 收尾
+ */
+void Rasterizer::SetTileEpilogue(const TileEpilogue* epilogue) {
+    m_tileEpilogue = epilogue;
+}
+
+/**
+ * @brief 设置取消标志
+ */
+void Rasterizer::SetCancelFlag(const std::atomic<bool>* flag) {
+    m_cancelRequested = flag;
 }
 
 /**
@@ -329,9 +376,51 @@ RasterStats Rasterizer::RasterizeTriangles(const std::vector<Triangle>& triangle
  * @brief 光栅化渲染入口（原始指针版本）
  */
 RasterStats Rasterizer::RasterizeTriangles(const Triangle* triangles, size_t count) {
-    RasterStats stats{};
-    if (!m_framebuffer || !m_depthBuffer || count == 0) {
-        return stats;
+    if (!m_framebuffer || !m_depthBuffer || count == 0 || IsCancelRequested(m_cancelRequested)) {
+        return RasterStats{};
+    }
+
+    // 本次调用的临时数据全部来自帧级内存，返回时回滚（不影响调用方已分配的数据）
+    FrameArena localArena;
+    FrameArena& arena = m_frameArena ? *m_frameArena : localArena;
+    FrameArena::Scope arenaScope(arena);
+
+    const PreparedTriangles prepared = PrepareTriangles(triangles, count, arena);
+    const RasterStats rasterStats = RasterizePrepared(prepared, arena);
+    RasterStats stats = prepared.stats;
+    stats.pixelsTested = rasterStats.pixelsTested;
+    stats.pixelsShaded = rasterStats.pixelsShaded;
+    stats.tileEpilogueDone = rasterStats.tileEpilogueDone;
+    return stats;
+}
+
+/**
+ * @brief 准备三角形批次（结果留在帧级内存中，由调用方的作用域回滚）
+ */
+PreparedTriangles Rasterizer::PrepareTriangles(const Triangle* triangles, size_t count) {
+    if (!m_frameArena) {
+        return PreparedTriangles{};
+    }
+    return PrepareTriangles(triangles, count, *m_frameArena);
+}
+
+/**
+ * @brief 光栅化已准备的批次（本次调用的临时数据在返回时回滚）
+ */
+RasterStats Rasterizer::RasterizePrepared(const PreparedTriangles& prepared) {
+    FrameArena localArena;
+    FrameArena& arena = m_frameArena ? *m_frameArena : localArena;
+    FrameArena::Scope arenaScope(arena);
+    return RasterizePrepared(prepared, arena);
+}
+
+/**
+ * @brief 阶段一：裁剪、建立光栅三角形并分配到 Tile Bin
+ */
+PreparedTriangles Rasterizer::PrepareTriangles(const Triangle* triangles, size_t count, FrameArena& arena) {
+    PreparedTriangles prepared;
+    if (!m_framebuffer || count == 0 || IsCancelRequested(m_cancelRequested)) {
+        return prepared;
     }
 
     SR_DEBUG_LOG("Rasterizer: begin\n");
@@ -342,16 +431,14 @@ RasterStats Rasterizer::RasterizeTriangles(const Triangle* triangles, size_t cou
 
     using Clock = std::chrono::high_resolution_clock;
     auto stageClipBegin = Clock::now();
-    double stageClipMs = 0.0;
-    double stageBinMs = 0.0;
-    double stageRasterMs = 0.0;
 
     // ── 阶段一：裁剪并准备光栅化三角形 ──────────────────────────────────
+    RasterStats& stats = prepared.stats;
     stats.trianglesInput = static_cast<uint64_t>(count);
 
-    RasterScratchBuffers& scratch = g_rasterScratch;
-    UninitBuffer<RasterTriangle>& rasterTris = scratch.rasterTris;
-    rasterTris.clear();
+    ArenaRegion& shared = arena.Shared();
+
+    std::span<RasterTriangle> rasterTris;
 
     auto toScreenX = [width](double x) {
         return (x * 0.5 + 0.5) * static_cast<double>(width - 1);
@@ -362,36 +449,34 @@ RasterStats Rasterizer::RasterizeTriangles(const Triangle* triangles, size_t cou
 
     // 并行裁剪：每线程独立 Clipper + 本地三角形列表，避免锁竞争
     const int numInputTris = static_cast<int>(count);
-    const int maxClipThreads = omp_get_max_threads();
+    const int maxClipThreads = Parallel::MaxThreads();
+    arena.EnsureThreadRegions(maxClipThreads);
+    ArenaVector<RasterTriangle>* clipTris =
+        shared.AllocateArray<ArenaVector<RasterTriangle>>(static_cast<size_t>(maxClipThreads));
+    uint64_t* clipCounts = shared.AllocateArray<uint64_t>(static_cast<size_t>(maxClipThreads));
+    for (int t = 0; t < maxClipThreads; ++t) {
+        clipTris[t] = ArenaVector<RasterTriangle>(arena.ThreadRegion(t));
+        clipTris[t].reserve(static_cast<size_t>(numInputTris / maxClipThreads) * 2 + 16);
+        clipCounts[t] = 0;
+    }
 
-    #pragma omp parallel
-    {
-        const int tid = omp_get_thread_num();
-        auto& localTris = g_perThreadClipTris[tid];
-        localTris.clear();
-        // reserve 只在首次不足时扩容，capacity 只增不减
-        const size_t needed = static_cast<size_t>(numInputTris / omp_get_num_threads()) * 2 + 16;
-        if (localTris.capacity() < needed) {
-            localTris.reserve(needed);
-        }
+    Parallel::ForRange(0, numInputTris, ompCfg.clipChunk, [&](int first, int last) {
+        const int tid = Parallel::ThreadIndex();
+        ArenaVector<RasterTriangle>& localTris = clipTris[tid];
         uint64_t localClipped = 0;
         Clipper clipper;
 
-#if defined(SR_INTEL_OMP)
-        #pragma omp for schedule(guided)
-#else
-        #pragma omp for schedule(dynamic)
-#endif
-        for (int triIdx = 0; triIdx < numInputTris; ++triIdx) {
+        for (int triIdx = first; triIdx < last; ++triIdx) {
             const auto& tri = triangles[static_cast<size_t>(triIdx)];
-        // 背面剔除在透视除法后的屏幕空间中执行（见后续有向面积符号判断）
+        // 背面/退化/视锥外三角形已由 GeometryProcessor 在裁剪前剔除（PreClipCuller），
+        // 此处的有向面积判断仅兜底处理裁剪后的子三角形与直接提交的三角形
 
         // Sutherland-Hodgman 视锥体裁剪
         ClipVertex a{tri.v0, tri.n0, tri.w0, tri.t0, tri.t0_1, tri.c0, tri.tg0};
         ClipVertex b{tri.v1, tri.n1, tri.w1, tri.t1, tri.t1_1, tri.c1, tri.tg1};
         ClipVertex c{tri.v2, tri.n2, tri.w2, tri.t2, tri.t2_1, tri.c2, tri.tg2};
 
-        std::vector<ClipVertex> clipped = clipper.ClipTriangle(a, b, c);
+        const ClipPolygon clipped = clipper.ClipTriangle(a, b, c);
         if (clipped.size() < 3) {
             continue;
         }
@@ -542,6 +627,20 @@ RasterStats Rasterizer::RasterizeTriangles(const Triangle* triangles, size_t cou
             rt.t0_1_over_w = v0.texCoord1 * rt.invW0;
             rt.t1_1_over_w = v1.texCoord1 * rt.invW1;
             rt.t2_1_over_w = v2.texCoord1 * rt.invW2;
+
+            // 屏幕空间梯度：∂bᵢ/∂x = Aᵢ·invArea，∂bᵢ/∂y = Bᵢ·invArea（bᵢ 对应边 12/20/01）
+            const double db0dx = rt.A12 * rt.invArea, db1dx = rt.A20 * rt.invArea, db2dx = rt.A01 * rt.invArea;
+            const double db0dy = rt.B12 * rt.invArea, db1dy = rt.B20 * rt.invArea, db2dy = rt.B01 * rt.invArea;
+            rt.dInvWdx = db0dx * rt.invW0 + db1dx * rt.invW1 + db2dx * rt.invW2;
+            rt.dInvWdy = db0dy * rt.invW0 + db1dy * rt.invW1 + db2dy * rt.invW2;
+            rt.dT0dx = Vec2{db0dx * rt.t0_over_w.x + db1dx * rt.t1_over_w.x + db2dx * rt.t2_over_w.x,
+                            db0dx * rt.t0_over_w.y + db1dx * rt.t1_over_w.y + db2dx * rt.t2_over_w.y};
+            rt.dT0dy = Vec2{db0dy * rt.t0_over_w.x + db1dy * rt.t1_over_w.x + db2dy * rt.t2_over_w.x,
+                            db0dy * rt.t0_over_w.y + db1dy * rt.t1_over_w.y + db2dy * rt.t2_over_w.y};
+            rt.dT1dx = Vec2{db0dx * rt.t0_1_over_w.x + db1dx * rt.t1_1_over_w.x + db2dx * rt.t2_1_over_w.x,
+                            db0dx * rt.t0_1_over_w.y + db1dx * rt.t1_1_over_w.y + db2dx * rt.t2_1_over_w.y};
+            rt.dT1dy = Vec2{db0dy * rt.t0_1_over_w.x + db1dy * rt.t1_1_over_w.x + db2dy * rt.t2_1_over_w.x,
+                            db0dy * rt.t0_1_over_w.y + db1dy * rt.t1_1_over_w.y + db2dy * rt.t2_1_over_w.y};
             rt.c0_over_w = v0.color * rt.invW0;
             rt.c1_over_w = v1.color * rt.invW1;
             rt.c2_over_w = v2.color * rt.invW2;
@@ -612,6 +711,7 @@ RasterStats Rasterizer::RasterizeTriangles(const Triangle* triangles, size_t cou
                     matTable->GetTransmissionSamplerIndex(matId),
                     matTable->GetTransmissionTexCoordSet(matId)
                 };
+                rt.shaderFeatures = matTable->GetShaderFeatures(matId);
             } else {
                 // MaterialTable 不可用时使用默认材质（白色不透明电介质）
                 rt.albedo = Vec3{1.0, 1.0, 1.0};
@@ -628,37 +728,44 @@ RasterStats Rasterizer::RasterizeTriangles(const Triangle* triangles, size_t cou
                 rt.specularColorFactor = Vec3{1.0, 1.0, 1.0};
 
                 rt.textures = {};
+                rt.shaderFeatures = 0;
+            }
+            if (m_frameContext.environmentMap) {
+                rt.shaderFeatures |= ShaderFeature::EnvironmentMap;
             }
 
             localTris.push_back(rt);
         }
     }
 
-        g_perThreadClipCount[tid] = localClipped;
-    } // end omp parallel (clipping)
+        clipCounts[tid] += localClipped;
+    });
 
     // 并行合并各线程裁剪结果（prefix sum + 并行 memcpy）
     {
-        std::vector<size_t> clipOffsets(static_cast<size_t>(maxClipThreads) + 1, 0);
+        std::span<size_t> clipOffsets = AllocateSpan<size_t>(shared, static_cast<size_t>(maxClipThreads) + 1);
+        clipOffsets[0] = 0;
         for (int t = 0; t < maxClipThreads; ++t) {
-            stats.trianglesClipped += g_perThreadClipCount[t];
-            clipOffsets[static_cast<size_t>(t) + 1] = clipOffsets[static_cast<size_t>(t)] + g_perThreadClipTris[t].size();
+            stats.trianglesClipped += clipCounts[t];
+            clipOffsets[static_cast<size_t>(t) + 1] = clipOffsets[static_cast<size_t>(t)] + clipTris[t].size();
         }
         const size_t totalRasterTris = clipOffsets[static_cast<size_t>(maxClipThreads)];
-        rasterTris.resize(totalRasterTris);
+        rasterTris = AllocateSpan<RasterTriangle>(shared, totalRasterTris);
 
-        #pragma omp parallel for schedule(static, 1)
-        for (int t = 0; t < maxClipThreads; ++t) {
-            if (!g_perThreadClipTris[t].empty()) {
+        Parallel::For(0, maxClipThreads, 1, OpenMPSchedulePolicy::Static, [&](int t) {
+            if (!clipTris[t].empty()) {
                 std::memcpy(&rasterTris[clipOffsets[static_cast<size_t>(t)]],
-                            g_perThreadClipTris[t].data(),
-                            g_perThreadClipTris[t].size() * sizeof(RasterTriangle));
+                            clipTris[t].data(),
+                            clipTris[t].size() * sizeof(RasterTriangle));
             }
-        }
+        });
     }
 
     stats.trianglesRaster = static_cast<uint64_t>(rasterTris.size());
-    stageClipMs = std::chrono::duration<double, std::milli>(Clock::now() - stageClipBegin).count();
+    for (size_t i = 0; i < rasterTris.size(); ++i) {
+        stats.shaderUsage.Add(rasterTris[i].shaderFeatures);
+    }
+    prepared.clipMs = std::chrono::duration<double, std::milli>(Clock::now() - stageClipBegin).count();
 
     {
         char buffer[256];
@@ -670,84 +777,39 @@ RasterStats Rasterizer::RasterizeTriangles(const Triangle* triangles, size_t cou
         SR_DEBUG_LOG(buffer);
     }
 
-    // ── 阶段二：无锁 Tile-Based 并行光栅化 ───────────────────────────────
-    double* depthData = m_depthBuffer->Data();
-    if (!depthData) {
-        return stats;
-    }
-    
-    // 直接获取线性像素缓冲写指针，避免每次通过接口函数间接访问
-    Vec3* linearPixels = m_framebuffer->GetLinearPixelsWritable();
-
-    constexpr int TILE_SIZE = 32;
+    // ── Tile 分箱 ─────────────────────────────────────────────────────────
+    constexpr int TILE_SIZE = kRasterTileSize;
     int tilesX = (width + TILE_SIZE - 1) / TILE_SIZE;
     int tilesY = (height + TILE_SIZE - 1) / TILE_SIZE;
-
     int totalTiles = tilesX * tilesY;
-    std::vector<int>& tileMinXs = scratch.tileMinXs;
-    std::vector<int>& tileMinYs = scratch.tileMinYs;
-    std::vector<int>& tileMaxXs = scratch.tileMaxXs;
-    std::vector<int>& tileMaxYs = scratch.tileMaxYs;
-    const bool tileGridChanged =
-        scratch.cachedWidth != width ||
-        scratch.cachedHeight != height ||
-        scratch.cachedTilesX != tilesX ||
-        scratch.cachedTilesY != tilesY;
-
-    if (tileGridChanged) {
-        tileMinXs.resize(static_cast<size_t>(totalTiles));
-        tileMinYs.resize(static_cast<size_t>(totalTiles));
-        tileMaxXs.resize(static_cast<size_t>(totalTiles));
-        tileMaxYs.resize(static_cast<size_t>(totalTiles));
-        for (int t = 0; t < totalTiles; ++t) {
-            int ty = t / tilesX;
-            int tx = t - ty * tilesX;
-            int tileMinX = tx * TILE_SIZE;
-            int tileMinY = ty * TILE_SIZE;
-            int tileMaxX = std::min(tileMinX + TILE_SIZE - 1, width - 1);
-            int tileMaxY = std::min(tileMinY + TILE_SIZE - 1, height - 1);
-            tileMinXs[static_cast<size_t>(t)] = tileMinX;
-            tileMinYs[static_cast<size_t>(t)] = tileMinY;
-            tileMaxXs[static_cast<size_t>(t)] = tileMaxX;
-            tileMaxYs[static_cast<size_t>(t)] = tileMaxY;
-        }
-        scratch.cachedWidth = width;
-        scratch.cachedHeight = height;
-        scratch.cachedTilesX = tilesX;
-        scratch.cachedTilesY = tilesY;
-    }
 
     // 将三角形分配到 Tile Bin（紧密存储，两遍算法）：
     // 第一遍：统计每个 Tile 的引用数；前缀和计算偏移；第二遍：填充索引数组。
-    std::vector<size_t>& binCounts = scratch.binCounts;
-    std::vector<size_t>& binOffsets = scratch.binOffsets;
-    std::vector<size_t>& binWriteCursor = scratch.binWriteCursor;
-    std::vector<size_t>& binTriIndices = scratch.binTriIndices;
-    std::vector<int>& triMinTileX = scratch.triMinTileX;
-    std::vector<int>& triMaxTileX = scratch.triMaxTileX;
-    std::vector<int>& triMinTileY = scratch.triMinTileY;
-    std::vector<int>& triMaxTileY = scratch.triMaxTileY;
-    binCounts.assign(static_cast<size_t>(totalTiles), 0);
-    triMinTileX.resize(rasterTris.size());
-    triMaxTileX.resize(rasterTris.size());
-    triMinTileY.resize(rasterTris.size());
-    triMaxTileY.resize(rasterTris.size());
+    std::span<size_t> binCounts = AllocateSpan<size_t>(shared, static_cast<size_t>(totalTiles));
+    std::span<int> triMinTileX = AllocateSpan<int>(shared, rasterTris.size());
+    std::span<int> triMaxTileX = AllocateSpan<int>(shared, rasterTris.size());
+    std::span<int> triMinTileY = AllocateSpan<int>(shared, rasterTris.size());
+    std::span<int> triMaxTileY = AllocateSpan<int>(shared, rasterTris.size());
+    std::fill(binCounts.begin(), binCounts.end(), size_t{0});
 
     const int numRasterTris = static_cast<int>(rasterTris.size());
     auto stageBinBegin = Clock::now();
 
     // Pass 1: 并行计算每个三角形的 tile 范围 + 每线程独立直方图统计
     if (ompCfg.enableLegacyBinReduction) {
-        #pragma omp parallel
-        {
-            std::vector<size_t> localBinCounts(static_cast<size_t>(totalTiles), 0);
-
-#if defined(SR_INTEL_OMP)
-            #pragma omp for schedule(guided)
-#else
-            #pragma omp for schedule(dynamic)
-#endif
-            for (int i = 0; i < numRasterTris; ++i) {
+        // 旧路径：每线程首次参与时在自己的区域分配整张直方图，结束后串行归约（保留用于快速回滚）
+        const int maxThreads = Parallel::MaxThreads();
+        size_t** threadBinCounts = shared.AllocateArray<size_t*>(static_cast<size_t>(maxThreads));
+        std::fill(threadBinCounts, threadBinCounts + maxThreads, nullptr);
+
+        Parallel::ForRange(0, numRasterTris, ompCfg.binCountChunk, [&](int first, int last) {
+            const int tid = Parallel::ThreadIndex();
+            if (!threadBinCounts[tid]) {
+                threadBinCounts[tid] = arena.ThreadRegion(tid).AllocateArray<size_t>(static_cast<size_t>(totalTiles));
+                std::fill(threadBinCounts[tid], threadBinCounts[tid] + totalTiles, size_t{0});
+            }
+            size_t* localBinCounts = threadBinCounts[tid];
+            for (int i = first; i < last; ++i) {
                 const RasterTriangle& rt = rasterTris[static_cast<size_t>(i)];
                 int minTileX = std::max(rt.minX / TILE_SIZE, 0);
                 int maxTileX = std::min(rt.maxX / TILE_SIZE, tilesX - 1);
@@ -764,32 +826,26 @@ RasterStats Rasterizer::RasterizeTriangles(const Triangle* triangles, size_t cou
                     }
                 }
             }
+        });
 
-            // 旧路径：critical 归约（保留用于快速回滚）
-            #pragma omp critical
-            {
-                for (int t = 0; t < totalTiles; ++t) {
-                    binCounts[static_cast<size_t>(t)] += localBinCounts[static_cast<size_t>(t)];
-                }
+        for (int tid = 0; tid < maxThreads; ++tid) {
+            if (!threadBinCounts[tid]) {
+                continue;
+            }
+            for (int t = 0; t < totalTiles; ++t) {
+                binCounts[static_cast<size_t>(t)] += threadBinCounts[tid][static_cast<size_t>(t)];
             }
         }
     } else {
-        const int maxThreads = std::max(1, omp_get_max_threads());
-        std::vector<std::vector<size_t>> perThreadBinCounts(
-            static_cast<size_t>(maxThreads),
-            std::vector<size_t>(static_cast<size_t>(totalTiles), 0));
-
-        #pragma omp parallel
-        {
-            const int tid = omp_get_thread_num();
-            std::vector<size_t>& localBinCounts = perThreadBinCounts[static_cast<size_t>(tid)];
-
-#if defined(SR_INTEL_OMP)
-            #pragma omp for schedule(guided)
-#else
-            #pragma omp for schedule(dynamic)
-#endif
-            for (int i = 0; i < numRasterTris; ++i) {
+        const int maxThreads = Parallel::MaxThreads();
+        const size_t histogramStride = HistogramStride(totalTiles);
+        std::span<size_t> perThreadBinCounts =
+            AllocateSpan<size_t>(shared, static_cast<size_t>(maxThreads) * histogramStride);
+        std::fill(perThreadBinCounts.begin(), perThreadBinCounts.end(), size_t{0});
+
+        Parallel::ForRange(0, numRasterTris, ompCfg.binCountChunk, [&](int first, int last) {
+            size_t* localBinCounts = perThreadBinCounts.data() + static_cast<size_t>(Parallel::ThreadIndex()) * histogramStride;
+            for (int i = first; i < last; ++i) {
                 const RasterTriangle& rt = rasterTris[static_cast<size_t>(i)];
                 int minTileX = std::max(rt.minX / TILE_SIZE, 0);
                 int maxTileX = std::min(rt.maxX / TILE_SIZE, tilesX - 1);
@@ -806,37 +862,32 @@ RasterStats Rasterizer::RasterizeTriangles(const Triangle* triangles, size_t cou
                     }
                 }
             }
-        }
+        });
 
         // 分块并行归约：按 Tile 维度并行求和，避免 critical 串行热点
-#if defined(SR_INTEL_OMP)
-        #pragma omp parallel for schedule(guided)
-#else
-        #pragma omp parallel for schedule(dynamic)
-#endif
-        for (int t = 0; t < totalTiles; ++t) {
+        Parallel::For(0, totalTiles, 1, Parallel::kBalanced, [&](int t) {
             size_t sum = 0;
             const size_t tileIndex = static_cast<size_t>(t);
             for (int tid = 0; tid < maxThreads; ++tid) {
-                sum += perThreadBinCounts[static_cast<size_t>(tid)][tileIndex];
+                sum += perThreadBinCounts[static_cast<size_t>(tid) * histogramStride + tileIndex];
             }
             binCounts[tileIndex] = sum;
-        }
+        });
     }
 
     // Prefix sum（串行，O(totalTiles) 极快）
-    binOffsets.resize(static_cast<size_t>(totalTiles) + 1);
+    std::span<size_t> binOffsets = AllocateSpan<size_t>(shared, static_cast<size_t>(totalTiles) + 1);
     binOffsets[0] = 0;
     for (int t = 0; t < totalTiles; ++t) {
         binOffsets[static_cast<size_t>(t + 1)] = binOffsets[static_cast<size_t>(t)] + binCounts[static_cast<size_t>(t)];
     }
     const size_t totalBinRefs = binOffsets[static_cast<size_t>(totalTiles)];
-    binTriIndices.resize(totalBinRefs);
-    binWriteCursor.assign(binOffsets.begin(), binOffsets.begin() + static_cast<size_t>(totalTiles));
+    std::span<size_t> binTriIndices = AllocateSpan<size_t>(shared, totalBinRefs);
+    std::span<size_t> binWriteCursor = AllocateSpan<size_t>(shared, static_cast<size_t>(totalTiles));
+    std::copy(binOffsets.begin(), binOffsets.begin() + totalTiles, binWriteCursor.begin());
 
     // 第二遍：并行填充 Bin 索引（使用 C++20 atomic_ref 写游标，无锁）
-    #pragma omp parallel for schedule(guided, 1)
-    for (int i = 0; i < numRasterTris; ++i) {
+    Parallel::For(0, numRasterTris, 1, OpenMPSchedulePolicy::Guided, [&](int i) {
         const int minTileX = triMinTileX[static_cast<size_t>(i)];
         const int maxTileX = triMaxTileX[static_cast<size_t>(i)];
         const int minTileY = triMinTileY[static_cast<size_t>(i)];
@@ -850,38 +901,12 @@ RasterStats Rasterizer::RasterizeTriangles(const Triangle* triangles, size_t cou
                 binTriIndices[pos] = static_cast<size_t>(i);
             }
         }
-    }
+    });
 
     if (!ValidateBinningConsistency(totalTiles, binCounts, binOffsets, binWriteCursor, totalBinRefs)) {
         SR_DEBUG_LOG("Rasterizer: binning consistency check failed\n");
     }
 
-    // 对每个 Tile 内的三角形排序：
-    //   - 不透明/Mask：从近到远（Early-Z 优化，减少片元着色调用）
-    //   - 半透明（Blend）：从远到近（保证 Alpha 混合正确性）
-    const bool isBatchTransparent = !rasterTris.empty() && rasterTris[0].alphaMode == GLTFAlphaMode::Blend;
-    #pragma omp parallel for schedule(guided, 1)
-    for (int t = 0; t < totalTiles; ++t) {
-        const size_t begin = binOffsets[static_cast<size_t>(t)];
-        const size_t end = binOffsets[static_cast<size_t>(t + 1)];
-        if (end - begin < 2) {
-            continue;
-        }
-        auto itBegin = binTriIndices.begin() + static_cast<std::ptrdiff_t>(begin);
-        auto itEnd = binTriIndices.begin() + static_cast<std::ptrdiff_t>(end);
-        if (isBatchTransparent) {
-            // 半透明三角形从远到近排序（保证正确 Alpha 混合）
-            std::sort(itBegin, itEnd, [&rasterTris](size_t a, size_t b) {
-                return rasterTris[a].zMin > rasterTris[b].zMin;
-            });
-        } else {
-            // 不透明三角形从近到远排序（Early-Z：近处片元先通过深度测试，远处可提前 discard）
-            std::sort(itBegin, itEnd, [&rasterTris](size_t a, size_t b) {
-                return rasterTris[a].zMin < rasterTris[b].zMin;
-            });
-        }
-    }
-
     size_t maxBinSize = 0;
     for (int t = 0; t < totalTiles; ++t) {
         const size_t binSize = binCounts[static_cast<size_t>(t)];
@@ -904,7 +929,90 @@ RasterStats Rasterizer::RasterizeTriangles(const Triangle* triangles, size_t cou
         SR_DEBUG_LOG(buffer);
     }
 
-    stageBinMs = std::chrono::duration<double, std::milli>(Clock::now() - stageBinBegin).count();
+    prepared.binMs = std::chrono::duration<double, std::milli>(Clock::now() - stageBinBegin).count();
+
+    prepared.triangles = rasterTris;
+    prepared.binOffsets = binOffsets;
+    prepared.binTriIndices = binTriIndices;
+    prepared.width = width;
+    prepared.height = height;
+    prepared.tilesX = tilesX;
+    prepared.tilesY = tilesY;
+    return prepared;
+}
+
+/**
+ * @brief 阶段二：无锁 Tile-Based 并行光栅化
+ */
+RasterStats Rasterizer::RasterizePrepared(const PreparedTriangles& prepared, FrameArena& arena) {
+    RasterStats stats{};
+    if (!m_framebuffer || !m_depthBuffer || prepared.binOffsets.empty() ||
+        prepared.width != m_framebuffer->GetWidth() || prepared.height != m_framebuffer->GetHeight()) {
+        return stats;
+    }
+
+    double* depthData = m_depthBuffer->Data();
+    if (!depthData) {
+        return stats;
+    }
+
+    // 直接获取线性像素缓冲写指针，避免每次通过接口函数间接访问
+    Vec3* linearPixels = m_framebuffer->GetLinearPixelsWritable();
+
+    const int width = prepared.width;
+    const int height = prepared.height;
+    const OpenMPTuningOptions& ompCfg = m_frameContext.openmp;
+    ArenaRegion& shared = arena.Shared();
+    const std::span<RasterTriangle> rasterTris = prepared.triangles;
+    const std::span<size_t> binOffsets = prepared.binOffsets;
+    const std::span<size_t> binTriIndices = prepared.binTriIndices;
+
+    using Clock = std::chrono::high_resolution_clock;
+    double stageRasterMs = 0.0;
+
+    constexpr int TILE_SIZE = kRasterTileSize;
+    const int tilesX = prepared.tilesX;
+    int totalTiles = tilesX * prepared.tilesY;
+    // Tile 网格随调用重建（O(Tile 数)），不跨调用缓存，多个渲染器并发时互不影响
+    std::span<int> tileMinXs = AllocateSpan<int>(shared, static_cast<size_t>(totalTiles));
+    std::span<int> tileMinYs = AllocateSpan<int>(shared, static_cast<size_t>(totalTiles));
+    std::span<int> tileMaxXs = AllocateSpan<int>(shared, static_cast<size_t>(totalTiles));
+    std::span<int> tileMaxYs = AllocateSpan<int>(shared, static_cast<size_t>(totalTiles));
+    for (int t = 0; t < totalTiles; ++t) {
+        int ty = t / tilesX;
+        int tx = t - ty * tilesX;
+        int tileMinX = tx * TILE_SIZE;
+        int tileMinY = ty * TILE_SIZE;
+        tileMinXs[static_cast<size_t>(t)] = tileMinX;
+        tileMinYs[static_cast<size_t>(t)] = tileMinY;
+        tileMaxXs[static_cast<size_t>(t)] = std::min(tileMinX + TILE_SIZE - 1, width - 1);
+        tileMaxYs[static_cast<size_t>(t)] = std::min(tileMinY + TILE_SIZE - 1, height - 1);
+    }
+
+    // 对每个 Tile 内的三角形排序（在光栅阶段处理该 Tile 前执行，省去单独的排序并行区与屏障）：
+    //   - 不透明/Mask：从近到远（Early-Z 优化，减少片元着色调用）
+    //   - 半透明（Blend）：从远到近（保证 Alpha 混合正确性）
+    const bool isBatchTransparent = !rasterTris.empty() && rasterTris[0].alphaMode == GLTFAlphaMode::Blend;
+    auto sortTileBin = [&](int t) {
+        const size_t begin = binOffsets[static_cast<size_t>(t)];
+        const size_t end = binOffsets[static_cast<size_t>(t + 1)];
+        if (end - begin < 2) {
+            return;
+        }
+        auto itBegin = binTriIndices.begin() + static_cast<std::ptrdiff_t>(begin);
+        auto itEnd = binTriIndices.begin() + static_cast<std::ptrdiff_t>(end);
+        if (isBatchTransparent) {
+            // 半透明三角形从远到近排序（保证正确 Alpha 混合）
+            std::sort(itBegin, itEnd, [&rasterTris](size_t a, size_t b) {
+                return rasterTris[a].zMin > rasterTris[b].zMin;
+            });
+        } else {
+            // 不透明三角形从近到远排序（Early-Z：近处片元先通过深度测试，远处可提前 discard）
+            std::sort(itBegin, itEnd, [&rasterTris](size_t a, size_t b) {
+                return rasterTris[a].zMin < rasterTris[b].zMin;
+            });
+        }
+    };
 
     SR_DEBUG_LOG("Rasterizer: tile max depth pass skipped\n");
 
@@ -912,7 +1020,7 @@ RasterStats Rasterizer::RasterizeTriangles(const Triangle* triangles, size_t cou
     auto stageRasterBegin = Clock::now();
 
     // 全帧预计算光照数据（仅一次，避免在每个三角形/像素重复计算 normalize 和 radiance）
-    std::vector<PrecomputedLight> globalPrecomputedLights;
+    ArenaVector<PrecomputedLight> globalPrecomputedLights(shared);
     if (!m_frameContext.lights.empty()) {
         globalPrecomputedLights.reserve(m_frameContext.lights.size());
         for (const DirectionalLight& light : m_frameContext.lights) {
@@ -923,39 +1031,75 @@ RasterStats Rasterizer::RasterizeTriangles(const Triangle* triangles, size_t cou
         }
     }
 
-    const size_t maxThreadCount = static_cast<size_t>(std::max(1, omp_get_max_threads()));
-    std::vector<double> threadRasterMs(maxThreadCount, 0.0);
-    std::vector<uint64_t> threadTileCounts(maxThreadCount, 0);
-    std::vector<uint64_t> threadPixelsTested(maxThreadCount, 0);
-    std::vector<uint64_t> threadPixelsShaded(maxThreadCount, 0);
-
-    #pragma omp parallel
-    {
-        FragmentShader fragmentShader;
+    // 分块局部光源：优先使用帧级剔除结果；视口不一致或未提供时在此按当前 Tile 网格构建
+    LightCuller localLightCuller;
+    const LightCuller* lightCuller = m_frameContext.tiledLights;
+    if (lightCuller && !lightCuller->Matches(width, height, TILE_SIZE)) {
+        lightCuller = nullptr;
+    }
+    if (!lightCuller && (!m_frameContext.pointLights.empty() || !m_frameContext.spotLights.empty())) {
+        localLightCuller.Build(m_frameContext.pointLights, m_frameContext.spotLights,
+                               m_frameContext.view, m_frameContext.projection, width, height, TILE_SIZE);
+        lightCuller = &localLightCuller;
+    }
+    const PrecomputedLocalLight* localLights =
+        (lightCuller && !lightCuller->GetLights().empty()) ? lightCuller->GetLights().data() : nullptr;
+
+    const TileEpilogue* tileEpilogue =
+        (m_tileEpilogue && m_tileEpilogue->IsActive()) ? m_tileEpilogue : nullptr;
+
+    const size_t maxThreadCount = static_cast<size_t>(Parallel::MaxThreads());
+    std::span<double> threadRasterMs = AllocateSpan<double>(shared, maxThreadCount);
+    std::span<uint64_t> threadTileCounts = AllocateSpan<uint64_t>(shared, maxThreadCount);
+    std::span<uint64_t> threadPixelsTested = AllocateSpan<uint64_t>(shared, maxThreadCount);
+    std::span<uint64_t> threadPixelsShaded = AllocateSpan<uint64_t>(shared, maxThreadCount);
+    std::fill(threadRasterMs.begin(), threadRasterMs.end(), 0.0);
+    std::fill(threadTileCounts.begin(), threadTileCounts.end(), uint64_t{0});
+    std::fill(threadPixelsTested.begin(), threadPixelsTested.end(), uint64_t{0});
+    std::fill(threadPixelsShaded.begin(), threadPixelsShaded.end(), uint64_t{0});
+
+    std::atomic<uint64_t> pixelsTestedTotal{0};
+    std::atomic<uint64_t> pixelsShadedTotal{0};
+
+    // 按 Tile 并行，每个 Tile 只由一个线程写入，天然无锁（无相邻像素冲突）；取消后跳过剩余 Tile
+    const std::atomic<bool>* cancelRequested = m_cancelRequested;
+    Parallel::ForRange(0, totalTiles, ompCfg.rasterTileChunk, [&](int firstTile, int lastTile) {
+        // 4 像素批量着色的 SoA 输入（块内私有，跨像素组复用）
+        FragmentVaryingBatch varyingBatch;
+        FragmentOutputBatch shadedBatch;
         uint64_t localPixelsTested = 0;
         uint64_t localPixelsShaded = 0;
         uint64_t localTileCount = 0;
-        const int threadId = omp_get_thread_num();
-        const double threadBegin = ompCfg.enableProfiling ? omp_get_wtime() : 0.0;
-
-        // 按 Tile 并行，每个 Tile 只由一个线程写入，天然无锁（无相邻像素冲突）
-#if defined(SR_INTEL_OMP)
-        #pragma omp for schedule(guided, 1)
-#else
-        #pragma omp for schedule(dynamic, 1)
-#endif
-        for (int t = 0; t < totalTiles; ++t) {
+        const int threadId = Parallel::ThreadIndex();
+        const auto chunkBegin = ompCfg.enableProfiling ? Clock::now() : Clock::time_point{};
+
+        for (int t = firstTile; t < lastTile; ++t) {
+            if (IsCancelRequested(cancelRequested)) {
+                break;
+            }
+            sortTileBin(t);
             const size_t binBegin = binOffsets[static_cast<size_t>(t)];
             const size_t binEnd = binOffsets[static_cast<size_t>(t + 1)];
+            int tileMinX = tileMinXs[static_cast<size_t>(t)];
+            int tileMinY = tileMinYs[static_cast<size_t>(t)];
+            int tileMaxX = tileMaxXs[static_cast<size_t>(t)];
+            int tileMaxY = tileMaxYs[static_cast<size_t>(t)];
             if (binBegin == binEnd) {
+                // 空 Tile 没有三角形，但天空填充 / 输出仍需完成
+                if (tileEpilogue) {
+                    tileEpilogue->Run(tileMinX, tileMinY, tileMaxX, tileMaxY);
+                }
                 continue;
             }
             localTileCount++;
 
-            int tileMinX = tileMinXs[static_cast<size_t>(t)];
-            int tileMinY = tileMinYs[static_cast<size_t>(t)];
-            int tileMaxX = tileMaxXs[static_cast<size_t>(t)];
-            int tileMaxY = tileMaxYs[static_cast<size_t>(t)];
+            // 本 Tile 可能受影响的局部光源（该 Tile 内所有三角形共享）
+            const uint32_t* tileLightIndices = nullptr;
+            size_t tileLightCount = 0;
+            if (localLights) {
+                tileLightIndices = lightCuller->GetTileLights(static_cast<size_t>(t));
+                tileLightCount = lightCuller->GetTileLightCount(static_cast<size_t>(t));
+            }
 
             for (size_t binPos = binBegin; binPos < binEnd; ++binPos) {
                 const size_t triIndex = binTriIndices[binPos];
@@ -986,11 +1130,23 @@ RasterStats Rasterizer::RasterizeTriangles(const Triangle* triangles, size_t cou
                 fragCtx.environmentMap = m_frameContext.environmentMap;
                 fragCtx.images = m_frameContext.images;
                 fragCtx.samplers = m_frameContext.samplers;
+                if (m_frameContext.preparedTextures) {
+                    m_frameContext.preparedTextures->ResolveDescriptors(rt.textures, fragCtx.textureDescriptors);
+                } else {
+                    fragCtx.textureDescriptors.fill(nullptr);
+                }
                 fragCtx.tangentW = rt.tangentW;
                 
                 // 传入全帧预计算光照（指针方式，零拷贝）
                 fragCtx.precomputedLights = globalPrecomputedLights.empty() ? nullptr : globalPrecomputedLights.data();
                 fragCtx.precomputedLightCount = globalPrecomputedLights.size();
+                fragCtx.localLights = localLights;
+                fragCtx.localLightIndices = tileLightIndices;
+                fragCtx.localLightCount = tileLightCount;
+                fragCtx.shadow = m_frameContext.shadowMap;
+
+                // 按特性掩码选取特化的着色器变体（像素循环内不再检查贴图/双面/环境贴图）
+                const ShaderPermutation& shader = FragmentShader::GetPermutation(rt.shaderFeatures);
 
                 int minX = std::max(rt.minX, tileMinX);
                 int maxX = std::min(rt.maxX, tileMaxX);
@@ -1011,6 +1167,10 @@ RasterStats Rasterizer::RasterizeTriangles(const Triangle* triangles, size_t cou
                 const TextureBinding& transmissionBinding = rt.textures[static_cast<size_t>(TextureSlot::Transmission)];
                 const bool needsAlphaTest = (rt.alphaMode == GLTFAlphaMode::Mask && baseColorBinding.imageIndex >= 0);
                 const bool needsAlphaBlend = (rt.alphaMode == GLTFAlphaMode::Blend);
+                // 仅在着色阶段会采样贴图时计算 UV 导数
+                const bool needsTexCoordGradients = (rt.shaderFeatures &
+                    (ShaderFeature::BaseColorMap | ShaderFeature::MetallicRoughnessMap | ShaderFeature::NormalMap |
+                     ShaderFeature::OcclusionMap | ShaderFeature::EmissiveMap | ShaderFeature::Transmission)) != 0;
 
                 // 预广播边函数增量为 AVX2 寄存器（每次处理 4 个连续像素）
                 const __m256d A12_4 = _mm256_set1_pd(rt.A12);
@@ -1081,6 +1241,11 @@ RasterStats Rasterizer::RasterizeTriangles(const Triangle* triangles, size_t cou
                         _mm256_store_pd(bw2s, bw2_4);
                         _mm256_store_pd(invWs, invW_4);
 
+                        // 通过深度/Alpha 测试的像素先收集到批次中，再统一着色
+                        int shadeMask = 0;
+                        double laneAlpha[4];
+                        FragmentVarying lastVarying;
+
                         for (int i = 0; i < 4; ++i) {
                             if (!(insideMask & (1 << i))) continue;
                             
@@ -1107,36 +1272,63 @@ RasterStats Rasterizer::RasterizeTriangles(const Triangle* triangles, size_t cou
                             varying.tangent = (rt.textures[static_cast<size_t>(TextureSlot::Normal)].imageIndex >= 0)
                                 ? InterpolateVec3(rt.tg0_over_w, rt.tg1_over_w, rt.tg2_over_w, bw0, bw1, bw2, wVal)
                                 : Vec3{0.0, 0.0, 0.0};
+                            if (needsTexCoordGradients) {
+                                InterpolateTexCoordGradients(rt, wVal, varying);
+                            }
 
                             double alpha = rt.alpha;
                             if (baseColorBinding.imageIndex >= 0) {
                                 Vec2 baseUv = (baseColorBinding.texCoordSet == 1) ? varying.texCoord1 : varying.texCoord;
-                                alpha *= SampleTextureChannel(m_frameContext, baseColorBinding.imageIndex, baseColorBinding.samplerIndex, baseUv, 3);
+                                alpha *= SampleTextureChannel(m_frameContext, baseColorBinding.imageIndex, baseColorBinding.samplerIndex, baseUv, 3, true);
                             }
                             alpha *= std::clamp(varying.color.w, 0.0, 1.0);
                             if (rt.transmissionFactor > 0.0 || transmissionBinding.imageIndex >= 0) {
                                 double t = std::clamp(rt.transmissionFactor, 0.0, 1.0);
                                 Vec2 tUv = (transmissionBinding.texCoordSet == 1) ? varying.texCoord1 : varying.texCoord;
                                 if (transmissionBinding.imageIndex >= 0) {
-                                    t *= SampleTextureChannel(m_frameContext, transmissionBinding.imageIndex, transmissionBinding.samplerIndex, tUv, 0);
+                                    t *= SampleTextureChannel(m_frameContext, transmissionBinding.imageIndex, transmissionBinding.samplerIndex, tUv, 0, false);
                                 }
                                 alpha *= (1.0 - std::clamp(t, 0.0, 1.0));
                             }
                             if (needsAlphaTest && alpha < rt.alphaCutoff) continue;
 
-                            double effectiveAlpha = alpha;
-                            localPixelsShaded++;
-                            Vec3 shaded = fragmentShader.ShadeFast(fragCtx, varying,
-                                needsAlphaBlend ? &effectiveAlpha : nullptr);
-                            // 预乘 Alpha 混合：shaded 中漫反射/环境光已按 alpha 预乘，
-                            // 镜面反射保持全强度（Fresnel）。effectiveAlpha 含玻璃的 Fresnel 贡献。
-                            // 公式：result = premul_shaded + bg * (1 - effectiveAlpha)
-                            if (needsAlphaBlend && effectiveAlpha < 0.999) {
-                                Vec3 dst = linearPixels[y * width + px];
-                                linearPixels[y * width + px] = shaded + dst * (1.0 - effectiveAlpha);
+                            shadeMask |= (1 << i);
+                            laneAlpha[i] = alpha;
+                            varyingBatch.Set(i, varying);
+                            lastVarying = varying;
+                        }
+
+                        if (shadeMask != 0) {
+                            // 仅 1 个像素有效时批量着色没有收益，直接走标量路径
+                            if ((shadeMask & (shadeMask - 1)) == 0) {
+                                const int lane = std::countr_zero(static_cast<unsigned>(shadeMask));
+                                double effectiveAlpha = laneAlpha[lane];
+                                Vec3 shaded = shader.shadeFast(fragCtx, lastVarying,
+                                    needsAlphaBlend ? &effectiveAlpha : nullptr);
+                                shadedBatch.r[lane] = shaded.x;
+                                shadedBatch.g[lane] = shaded.y;
+                                shadedBatch.b[lane] = shaded.z;
+                                shadedBatch.alpha[lane] = effectiveAlpha;
                             } else {
-                                depthData[index] = depth;
-                                linearPixels[y * width + px] = shaded;
+                                shader.shadeBatch(fragCtx, varyingBatch, shadeMask, shadedBatch);
+                            }
+
+                            for (int i = 0; i < 4; ++i) {
+                                if (!(shadeMask & (1 << i))) continue;
+                                const int index = rowBase + x + i;
+                                const Vec3 shaded{shadedBatch.r[i], shadedBatch.g[i], shadedBatch.b[i]};
+                                const double effectiveAlpha = shadedBatch.alpha[i];
+                                localPixelsShaded++;
+                                // 预乘 Alpha 混合：shaded 中漫反射/环境光已按 alpha 预乘，
+                                // 镜面反射保持全强度（Fresnel）。effectiveAlpha 含玻璃的 Fresnel 贡献。
+                                // 公式：result = premul_shaded + bg * (1 - effectiveAlpha)
+                                if (needsAlphaBlend && effectiveAlpha < 0.999) {
+                                    Vec3 dst = linearPixels[index];
+                                    linearPixels[index] = shaded + dst * (1.0 - effectiveAlpha);
+                                } else {
+                                    depthData[index] = depths[i];
+                                    linearPixels[index] = shaded;
+                                }
                             }
                         }
 
@@ -1192,18 +1384,21 @@ RasterStats Rasterizer::RasterizeTriangles(const Triangle* triangles, size_t cou
                         varying.tangent = (rt.textures[static_cast<size_t>(TextureSlot::Normal)].imageIndex >= 0)
                             ? InterpolateVec3(rt.tg0_over_w, rt.tg1_over_w, rt.tg2_over_w, bw0, bw1, bw2, wVal)
                             : Vec3{0.0, 0.0, 0.0};
+                        if (needsTexCoordGradients) {
+                            InterpolateTexCoordGradients(rt, wVal, varying);
+                        }
 
                         double alpha = rt.alpha;
                         if (baseColorBinding.imageIndex >= 0) {
                             Vec2 baseUv = (baseColorBinding.texCoordSet == 1) ? varying.texCoord1 : varying.texCoord;
-                            alpha *= SampleTextureChannel(m_frameContext, baseColorBinding.imageIndex, baseColorBinding.samplerIndex, baseUv, 3);
+                            alpha *= SampleTextureChannel(m_frameContext, baseColorBinding.imageIndex, baseColorBinding.samplerIndex, baseUv, 3, true);
                         }
                         alpha *= std::clamp(varying.color.w, 0.0, 1.0);
                         if (rt.transmissionFactor > 0.0 || transmissionBinding.imageIndex >= 0) {
                             double t = std::clamp(rt.transmissionFactor, 0.0, 1.0);
                             Vec2 tUv = (transmissionBinding.texCoordSet == 1) ? varying.texCoord1 : varying.texCoord;
                             if (transmissionBinding.imageIndex >= 0) {
-                                t *= SampleTextureChannel(m_frameContext, transmissionBinding.imageIndex, transmissionBinding.samplerIndex, tUv, 0);
+                                t *= SampleTextureChannel(m_frameContext, transmissionBinding.imageIndex, transmissionBinding.samplerIndex, tUv, 0, false);
                             }
                             alpha *= (1.0 - std::clamp(t, 0.0, 1.0));
                         }
@@ -1216,7 +1411,7 @@ RasterStats Rasterizer::RasterizeTriangles(const Triangle* triangles, size_t cou
 
                         double effectiveAlpha = alpha;
                         localPixelsShaded++;
-                        Vec3 shaded = fragmentShader.ShadeFast(fragCtx, varying,
+                        Vec3 shaded = shader.shadeFast(fragCtx, varying,
                             needsAlphaBlend ? &effectiveAlpha : nullptr);
                         // 预乘 Alpha 混合（与 SIMD 路径逻辑相同）
                         if (needsAlphaBlend && effectiveAlpha < 0.999) {
@@ -1237,23 +1432,30 @@ RasterStats Rasterizer::RasterizeTriangles(const Triangle* triangles, size_t cou
                     w2_row += rt.B01;
                 }
             }
+
+            // 本 Tile 的不透明三角形已全部完成：趁数据仍在缓存中执行收尾
+            if (tileEpilogue) {
+                tileEpilogue->Run(tileMinX, tileMinY, tileMaxX, tileMaxY);
+            }
         }
 
-        #pragma omp atomic
-        stats.pixelsTested += localPixelsTested;
-        #pragma omp atomic
-        stats.pixelsShaded += localPixelsShaded;
+        pixelsTestedTotal.fetch_add(localPixelsTested, std::memory_order_relaxed);
+        pixelsShadedTotal.fetch_add(localPixelsShaded, std::memory_order_relaxed);
 
         if (ompCfg.enableProfiling) {
-            const double threadEnd = omp_get_wtime();
-            threadRasterMs[static_cast<size_t>(threadId)] = (threadEnd - threadBegin) * 1000.0;
-            threadTileCounts[static_cast<size_t>(threadId)] = localTileCount;
-            threadPixelsTested[static_cast<size_t>(threadId)] = localPixelsTested;
-            threadPixelsShaded[static_cast<size_t>(threadId)] = localPixelsShaded;
+            // 同一线程执行的各块累加（线程槽位只由该线程写入）
+            threadRasterMs[static_cast<size_t>(threadId)] +=
+                std::chrono::duration<double, std::milli>(Clock::now() - chunkBegin).count();
+            threadTileCounts[static_cast<size_t>(threadId)] += localTileCount;
+            threadPixelsTested[static_cast<size_t>(threadId)] += localPixelsTested;
+            threadPixelsShaded[static_cast<size_t>(threadId)] += localPixelsShaded;
         }
-    } // end omp parallel
+    });
+    stats.pixelsTested += pixelsTestedTotal.load(std::memory_order_relaxed);
+    stats.pixelsShaded += pixelsShadedTotal.load(std::memory_order_relaxed);
 
     stageRasterMs = std::chrono::duration<double, std::milli>(Clock::now() - stageRasterBegin).count();
+    stats.tileEpilogueDone = tileEpilogue != nullptr && !IsCancelRequested(cancelRequested);
 
     // 渲染一致性自检：用于固定输入场景的基线对比（像素统计/深度流程不应退化）
     uint64_t binChecksum = 1469598103934665603ull; // FNV-1a offset basis
@@ -1288,10 +1490,10 @@ RasterStats Rasterizer::RasterizeTriangles(const Triangle* triangles, size_t cou
         std::snprintf(
             stageBuffer, sizeof(stageBuffer),
             "[SR-PERF] Rasterizer stages(ms): clip=%.3f bin=%.3f raster=%.3f threads=%d thread(min/max/avg)=%.3f/%.3f/%.3f imbalance=%.1f%% slowest=T%d totalTiles=%d\n",
-            stageClipMs,
-            stageBinMs,
+            prepared.clipMs,
+            prepared.binMs,
             stageRasterMs,
-            omp_get_max_threads(),
+            Parallel::MaxThreads(),
             minThreadMs,
             maxThreadMs,
             avgThreadMs,
@@ -1324,4 +1526,211 @@ RasterStats Rasterizer::RasterizeTriangles(const Triangle* triangles, size_t cou
     return stats;
 }
 
+/**
+ * @brief 仅深度光栅化
+ *
+ * 流程与着色路径一致（建立 → Tile 分箱 → Tile 并行光栅），但每个三角形只保留边函数和深度平面，
+ * 像素循环 4 路 AVX2 比较后用掩码写回深度。深度取最小值与绘制顺序无关，Tile 内无需排序。
+ */
+RasterStats Rasterizer::RasterizeDepth(const DepthTriangle* triangles, size_t count) {
+    RasterStats stats{};
+    if (!m_depthBuffer || !m_depthBuffer->Data() || count == 0 || IsCancelRequested(m_cancelRequested)) {
+        return stats;
+    }
+    const int width = m_depthBuffer->GetWidth();
+    const int height = m_depthBuffer->GetHeight();
+    if (width <= 0 || height <= 0) {
+        return stats;
+    }
+    stats.trianglesInput = static_cast<uint64_t>(count);
+
+    FrameArena localArena;
+    FrameArena& arena = m_frameArena ? *m_frameArena : localArena;
+    FrameArena::Scope arenaScope(arena);
+    ArenaRegion& shared = arena.Shared();
+    const int maxThreads = Parallel::MaxThreads();
+    arena.EnsureThreadRegions(maxThreads);
+
+    // 裁剪产生的三角形先写入各线程区域，之后追加到 depthTris 尾部（depthTris 须为共享区域顶端的分配）
+    ArenaVector<DepthRasterTriangle>* threadClipped =
+        shared.AllocateArray<ArenaVector<DepthRasterTriangle>>(static_cast<size_t>(maxThreads));
+    for (int t = 0; t < maxThreads; ++t) {
+        threadClipped[t] = ArenaVector<DepthRasterTriangle>(arena.ThreadRegion(t));
+    }
+    ArenaVector<DepthRasterTriangle> depthTris(shared);
+    depthTris.resize(count);
+
+    // ── 建立：w 均为正的三角形直接建立；其余（跨越相机平面）走完整裁剪 ──
+    const int numInput = static_cast<int>(count);
+    Parallel::ForRange(0, numInput, kDepthSetupChunk, [&](int first, int last) {
+        Clipper clipper;
+        ArenaVector<DepthRasterTriangle>& localClipped = threadClipped[Parallel::ThreadIndex()];
+
+        for (int i = first; i < last; ++i) {
+            const DepthTriangle& tri = triangles[static_cast<size_t>(i)];
+            DepthRasterTriangle& dt = depthTris[static_cast<size_t>(i)];
+            if (tri.v0.w > 0.0 && tri.v1.w > 0.0 && tri.v2.w > 0.0) {
+                if (!SetupDepthTriangle(tri.v0, tri.v1, tri.v2, width, height, dt)) {
+                    dt.minX = 1;
+                    dt.maxX = 0;
+                }
+                continue;
+            }
+            dt.minX = 1;
+            dt.maxX = 0;
+            ClipVertex a{}, b{}, c{};
+            a.clip = tri.v0;
+            b.clip = tri.v1;
+            c.clip = tri.v2;
+            const ClipPolygon clipped = clipper.ClipTriangle(a, b, c);
+            for (size_t k = 1; k + 1 < clipped.size(); ++k) {
+                const Vec4& p0 = clipped[0].clip;
+                const Vec4& p1 = clipped[k].clip;
+                const Vec4& p2 = clipped[k + 1].clip;
+                DepthRasterTriangle fan;
+                if (p0.w > 0.0 && p1.w > 0.0 && p2.w > 0.0 && SetupDepthTriangle(p0, p1, p2, width, height, fan)) {
+                    localClipped.push_back(fan);
+                }
+            }
+        }
+    });
+    for (int t = 0; t < maxThreads; ++t) {
+        depthTris.append(threadClipped[t].data(), threadClipped[t].size());
+    }
+    const int numTris = static_cast<int>(depthTris.size());
+
+    // ── Tile 分箱（两遍：每线程直方图 → 前缀和 → 原子游标填充）──
+    constexpr int TILE_SIZE = kRasterTileSize;
+    const int tilesX = (width + TILE_SIZE - 1) / TILE_SIZE;
+    const int tilesY = (height + TILE_SIZE - 1) / TILE_SIZE;
+    const int totalTiles = tilesX * tilesY;
+
+    std::span<size_t> binOffsets = AllocateSpan<size_t>(shared, static_cast<size_t>(totalTiles) + 1);
+    binOffsets[0] = 0;
+
+    const size_t histogramStride = HistogramStride(totalTiles);
+    std::span<size_t> perThreadCounts = AllocateSpan<size_t>(shared, static_cast<size_t>(maxThreads) * histogramStride);
+    std::fill(perThreadCounts.begin(), perThreadCounts.end(), size_t{0});
+    std::atomic<uint64_t> rasterCount{0};
+    Parallel::ForRange(0, numTris, kDepthSetupChunk, [&](int first, int last) {
+        size_t* localCounts = perThreadCounts.data() + static_cast<size_t>(Parallel::ThreadIndex()) * histogramStride;
+        uint64_t localRasterCount = 0;
+        for (int i = first; i < last; ++i) {
+            const DepthRasterTriangle& dt = depthTris[static_cast<size_t>(i)];
+            if (dt.minX > dt.maxX) {
+                continue;
+            }
+            ++localRasterCount;
+            for (int ty = dt.minY / TILE_SIZE; ty <= dt.maxY / TILE_SIZE; ++ty) {
+                for (int tx = dt.minX / TILE_SIZE; tx <= dt.maxX / TILE_SIZE; ++tx) {
+                    ++localCounts[static_cast<size_t>(ty * tilesX + tx)];
+                }
+            }
+        }
+        rasterCount.fetch_add(localRasterCount, std::memory_order_relaxed);
+    });
+    stats.trianglesRaster = rasterCount.load(std::memory_order_relaxed);
+    for (int t = 0; t < totalTiles; ++t) {
+        size_t sum = 0;
+        for (int tid = 0; tid < maxThreads; ++tid) {
+            sum += perThreadCounts[static_cast<size_t>(tid) * histogramStride + static_cast<size_t>(t)];
+        }
+        binOffsets[static_cast<size_t>(t) + 1] = binOffsets[static_cast<size_t>(t)] + sum;
+    }
+    std::span<uint32_t> binTriIndices = AllocateSpan<uint32_t>(shared, binOffsets.back());
+    std::span<size_t> binCursor = AllocateSpan<size_t>(shared, static_cast<size_t>(totalTiles));
+    std::copy(binOffsets.begin(), binOffsets.end() - 1, binCursor.begin());
+
+    Parallel::For(0, numTris, kDepthSetupChunk, OpenMPSchedulePolicy::Static, [&](int i) {
+        const DepthRasterTriangle& dt = depthTris[static_cast<size_t>(i)];
+        if (dt.minX > dt.maxX) {
+            return;
+        }
+        for (int ty = dt.minY / TILE_SIZE; ty <= dt.maxY / TILE_SIZE; ++ty) {
+            for (int tx = dt.minX / TILE_SIZE; tx <= dt.maxX / TILE_SIZE; ++tx) {
+                std::atomic_ref<size_t> cursor(binCursor[static_cast<size_t>(ty * tilesX + tx)]);
+                binTriIndices[cursor.fetch_add(1, std::memory_order_relaxed)] = static_cast<uint32_t>(i);
+            }
+        }
+    });
+
+    // ── Tile 并行光栅：4 像素一组，掩码读取 / 写回（行尾不越界访问）──
+    double* depthData = m_depthBuffer->Data();
+    const std::atomic<bool>* cancelRequested = m_cancelRequested;
+    std::atomic<uint64_t> pixelsTestedTotal{0};
+    Parallel::ForRange(0, totalTiles, 1, [&](int firstTile, int lastTile) {
+        uint64_t pixelsTested = 0;
+        for (int t = firstTile; t < lastTile; ++t) {
+            if (IsCancelRequested(cancelRequested)) {
+                break;
+            }
+            const size_t binBegin = binOffsets[static_cast<size_t>(t)];
+            const size_t binEnd = binOffsets[static_cast<size_t>(t) + 1];
+            if (binBegin == binEnd) {
+                continue;
+            }
+            const int ty = t / tilesX;
+            const int tx = t - ty * tilesX;
+            const int tileMinX = tx * TILE_SIZE;
+            const int tileMinY = ty * TILE_SIZE;
+            const int tileMaxX = std::min(tileMinX + TILE_SIZE - 1, width - 1);
+            const int tileMaxY = std::min(tileMinY + TILE_SIZE - 1, height - 1);
+            const __m256d laneOffset = _mm256_set_pd(3.0, 2.0, 1.0, 0.0);
+            const __m256d zero = _mm256_setzero_pd();
+
+            for (size_t binPos = binBegin; binPos < binEnd; ++binPos) {
+                const DepthRasterTriangle& dt = depthTris[binTriIndices[binPos]];
+                const int minX = std::max(dt.minX, tileMinX);
+                const int maxX = std::min(dt.maxX, tileMaxX);
+                const int minY = std::max(dt.minY, tileMinY);
+                const int maxY = std::min(dt.maxY, tileMaxY);
+                const __m256d A12 = _mm256_set1_pd(dt.A12);
+                const __m256d A20 = _mm256_set1_pd(dt.A20);
+                const __m256d A01 = _mm256_set1_pd(dt.A01);
+                const __m256d zDx = _mm256_set1_pd(dt.zDx);
+                const __m256d xEnd = _mm256_set1_pd(static_cast<double>(maxX) + 0.5);
+
+                for (int y = minY; y <= maxY; ++y) {
+                    const double py = static_cast<double>(y) + 0.5;
+                    const __m256d w0Row = _mm256_set1_pd(dt.B12 * py + dt.C12);
+                    const __m256d w1Row = _mm256_set1_pd(dt.B20 * py + dt.C20);
+                    const __m256d w2Row = _mm256_set1_pd(dt.B01 * py + dt.C01);
+                    const __m256d zRow = _mm256_set1_pd(dt.zDy * py + dt.zC);
+                    double* row = depthData + static_cast<size_t>(y) * static_cast<size_t>(width);
+
+                    for (int x = minX; x <= maxX; x += 4) {
+                        const __m256d px = _mm256_add_pd(_mm256_set1_pd(static_cast<double>(x) + 0.5), laneOffset);
+                        const __m256d w0 = _mm256_fmadd_pd(A12, px, w0Row);
+                        const __m256d w1 = _mm256_fmadd_pd(A20, px, w1Row);
+                        const __m256d w2 = _mm256_fmadd_pd(A01, px, w2Row);
+                        const __m256d allPos = _mm256_and_pd(_mm256_and_pd(
+                            _mm256_cmp_pd(w0, zero, _CMP_GE_OQ), _mm256_cmp_pd(w1, zero, _CMP_GE_OQ)),
+                            _mm256_cmp_pd(w2, zero, _CMP_GE_OQ));
+                        const __m256d allNeg = _mm256_and_pd(_mm256_and_pd(
+                            _mm256_cmp_pd(w0, zero, _CMP_LE_OQ), _mm256_cmp_pd(w1, zero, _CMP_LE_OQ)),
+                            _mm256_cmp_pd(w2, zero, _CMP_LE_OQ));
+                        const __m256d inside = _mm256_and_pd(_mm256_or_pd(allPos, allNeg),
+                                                             _mm256_cmp_pd(px, xEnd, _CMP_LE_OQ));
+                        const int insideMask = _mm256_movemask_pd(inside);
+                        if (insideMask == 0) {
+                            continue;
+                        }
+                        pixelsTested += static_cast<uint64_t>(std::popcount(static_cast<unsigned>(insideMask)));
+
+                        const __m256i laneMask = _mm256_castpd_si256(inside);
+                        const __m256d depth = _mm256_fmadd_pd(zDx, px, zRow);
+                        const __m256d stored = _mm256_maskload_pd(row + x, laneMask);
+                        const __m256d pass = _mm256_and_pd(inside, _mm256_and_pd(
+                            _mm256_cmp_pd(depth, zero, _CMP_GE_OQ), _mm256_cmp_pd(depth, stored, _CMP_LT_OQ)));
+                        _mm256_maskstore_pd(row + x, _mm256_castpd_si256(pass), depth);
+                    }
+                }
+            }
+        }
+        pixelsTestedTotal.fetch_add(pixelsTested, std::memory_order_relaxed);
+    });
+    stats.pixelsTested = pixelsTestedTotal.load(std::memory_order_relaxed);
+    return stats;
+}
+
 } // namespace SR
@@ -0,0 +1,420 @@
+#include "Pipeline/ShadowMap.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <immintrin.h>
+
+#include "Core/Parallel.h"
+#include "Math/Vec4.h"
+#include "Pipeline/FrameContext.h"
+#include "Scene/RenderQueue.h"
+
+namespace SR {
+
+namespace {
+
+/// 每级剔除 / 变换投射体三角形时的并行块长度
+constexpr int kCasterCullChunk = 1024;
+
+/// 投射体变换任务：一个非实例化绘制项或一个实例
+struct CasterTask {
+    const DrawItem* item = nullptr;   ///< 绘制项
+    const Mat4* model = nullptr;      ///< 模型矩阵（绘制项或实例）
+    size_t vertexOffset = 0;          ///< 在投射体顶点数组中的起始位置
+};
+
+/// @brief 4 通道水平求和
+inline double HorizontalSum(__m256d v) {
+    const __m128d sum = _mm_add_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+    return _mm_cvtsd_f64(_mm_add_sd(sum, _mm_unpackhi_pd(sum, sum)));
+}
+
+} // namespace
+
+double SampleShadow(const ShadowMapData& data, const Vec3& worldPos, const Vec3& normal) {
+    const double viewDepth = worldPos.x * data.viewDepthAxis.x + worldPos.y * data.viewDepthAxis.y +
+                             worldPos.z * data.viewDepthAxis.z + data.viewDepthOffset;
+    int c = 0;
+    while (c < data.cascadeCount && viewDepth > data.cascades[c].splitDepth) {
+        ++c;
+    }
+    if (c >= data.cascadeCount) {
+        return 1.0;
+    }
+
+    const ShadowCascade& cascade = data.cascades[c];
+    const Vec4 s = cascade.worldToShadow.Multiply(Vec4{worldPos.x + normal.x * cascade.normalOffset,
+                                                       worldPos.y + normal.y * cascade.normalOffset,
+                                                       worldPos.z + normal.z * cascade.normalOffset, 1.0});
+    const int res = data.resolution;
+    if (s.x < 0.0 || s.y < 0.0 || s.x > static_cast<double>(res) || s.y > static_cast<double>(res)) {
+        return 1.0;
+    }
+
+    // 纹素 i 的采样点位于 i + 0.5（与 Rasterizer 的像素中心一致）
+    const double tx = s.x - 0.5;
+    const double ty = s.y - 0.5;
+    const double baseX = std::floor(tx);
+    const double baseY = std::floor(ty);
+    const double fx = tx - baseX;
+    const double fy = ty - baseY;
+    const int x0 = static_cast<int>(baseX) - 1;
+    const int y0 = static_cast<int>(baseY) - 1;
+
+    // 3×3 个双线性样本之和沿每个轴展开为 4 个纹素，权重 (1-f, 1, 1, f)
+    const __m256d wx = _mm256_set_pd(fx, 1.0, 1.0, 1.0 - fx);
+    const double wy[4] = {1.0 - fy, 1.0, 1.0, fy};
+    const __m256d reference = _mm256_set1_pd(s.z - cascade.depthBias);
+    const bool interior = x0 >= 0 && y0 >= 0 && x0 + 3 < res && y0 + 3 < res;
+
+    __m256d lit = _mm256_setzero_pd();
+    for (int j = 0; j < 4; ++j) {
+        __m256d texels;
+        if (interior) {
+            texels = _mm256_loadu_pd(cascade.depth + static_cast<size_t>(y0 + j) * static_cast<size_t>(res) + x0);
+        } else {
+            const size_t rowBase = static_cast<size_t>(std::clamp(y0 + j, 0, res - 1)) * static_cast<size_t>(res);
+            alignas(32) double row[4];
+            for (int i = 0; i < 4; ++i) {
+                row[i] = cascade.depth[rowBase + static_cast<size_t>(std::clamp(x0 + i, 0, res - 1))];
+            }
+            texels = _mm256_load_pd(row);
+        }
+        const __m256d pass = _mm256_cmp_pd(reference, texels, _CMP_LE_OQ);
+        lit = _mm256_fmadd_pd(_mm256_and_pd(pass, wx), _mm256_set1_pd(wy[j]), lit);
+    }
+    return HorizontalSum(lit) * (1.0 / 9.0);
+}
+
+void CascadedShadowMap::Clear() {
+    m_data.cascadeCount = 0;
+    m_casterTriangleCount = 0;
+    m_rasterStats = RasterStats{};
+}
+
+/**
+ * @brief 投射体顶点变换到光源空间
+ *
+ * 每个绘制项 / 实例一个任务：唯一顶点只变换一次（反量化矩阵已并入），再按索引展开为三角形。
+ * 越界索引的三角形写为退化三角形，由光栅化阶段丢弃。
+ */
+bool CascadedShadowMap::GatherCasters(const RenderQueue& queue, const Mat4& lightView, FrameArena& arena,
+                                      ArenaVector<Vec3>& casterVertices, double& minDepth, double& maxDepth) {
+    ArenaVector<CasterTask> tasks(arena.Shared());
+    size_t vertexTotal = 0;
+    for (const DrawItem& item : queue.GetItems()) {
+        // 仅深度路径不做 Alpha 测试：Mask 按不透明投射会得到实心卡片状阴影，暂不作为投射体
+        if (!item.mesh || !item.material || item.material->alphaMode != GLTFAlphaMode::Opaque) {
+            continue;
+        }
+        const size_t corners = (item.mesh->GetIndices().size() / 3) * 3;
+        if (corners == 0 || item.mesh->GetVertexCount() == 0) {
+            continue;
+        }
+        if (item.instances && item.instanceCount > 0) {
+            for (size_t i = 0; i < item.instanceCount; ++i) {
+                tasks.push_back(CasterTask{&item, &item.instances[i].modelMatrix, vertexTotal});
+                vertexTotal += corners;
+            }
+        } else {
+            tasks.push_back(CasterTask{&item, &item.modelMatrix, vertexTotal});
+            vertexTotal += corners;
+        }
+    }
+    casterVertices.resize(vertexTotal);
+    if (vertexTotal == 0) {
+        return false;
+    }
+
+    // 每线程：顶点变换缓冲（跨任务复用）与深度范围（按缓存行分开）
+    constexpr size_t kRangeStride = 8;
+    const int maxThreads = Parallel::MaxThreads();
+    arena.EnsureThreadRegions(maxThreads);
+    ArenaRegion& shared = arena.Shared();
+    ArenaVector<Vec3>* threadTransformed = shared.AllocateArray<ArenaVector<Vec3>>(static_cast<size_t>(maxThreads));
+    double* threadRange = shared.AllocateArray<double>(static_cast<size_t>(maxThreads) * kRangeStride);
+    for (int t = 0; t < maxThreads; ++t) {
+        threadTransformed[t] = ArenaVector<Vec3>(arena.ThreadRegion(t));
+        threadRange[static_cast<size_t>(t) * kRangeStride] = std::numeric_limits<double>::max();
+        threadRange[static_cast<size_t>(t) * kRangeStride + 1] = -std::numeric_limits<double>::max();
+    }
+
+    const int numTasks = static_cast<int>(tasks.size());
+    Parallel::ForRange(0, numTasks, 1, [&](int firstTask, int lastTask) {
+        const int tid = Parallel::ThreadIndex();
+        ArenaVector<Vec3>& transformed = threadTransformed[tid];
+        double lo = threadRange[static_cast<size_t>(tid) * kRangeStride];
+        double hi = threadRange[static_cast<size_t>(tid) * kRangeStride + 1];
+
+        for (int t = firstTask; t < lastTask; ++t) {
+            const CasterTask& task = tasks[static_cast<size_t>(t)];
+            const Mesh& mesh = *task.item->mesh;
+            const size_t vertexCount = mesh.GetVertexCount();
+            const std::vector<uint32_t>& indices = mesh.GetIndices();
+            transformed.resize(vertexCount);
+
+            if (mesh.IsPacked()) {
+                const PackedVertexBuffer& packed = mesh.GetPackedVertices();
+                const Mat4 toLight = packed.GetDequantizationMatrix() * *task.model * lightView;
+                for (size_t v = 0; v < vertexCount; ++v) {
+                    const Vec4 p = toLight.Multiply(packed.GetRawPosition(v));
+                    transformed[v] = Vec3{p.x, p.y, p.z};
+                }
+            } else {
+                const Mat4 toLight = *task.model * lightView;
+                const std::vector<Vertex>& vertices = mesh.GetVertices();
+                for (size_t v = 0; v < vertexCount; ++v) {
+                    const Vec3& src = vertices[v].position;
+                    const Vec4 p = toLight.Multiply(Vec4{src.x, src.y, src.z, 1.0});
+                    transformed[v] = Vec3{p.x, p.y, p.z};
+                }
+            }
+            for (const Vec3& p : transformed) {
+                lo = std::min(lo, p.z);
+                hi = std::max(hi, p.z);
+            }
+
+            Vec3* out = casterVertices.data() + task.vertexOffset;
+            const size_t corners = (indices.size() / 3) * 3;
+            for (size_t i = 0; i < corners; i += 3) {
+                const uint32_t a = indices[i], b = indices[i + 1], c = indices[i + 2];
+                if (a >= vertexCount || b >= vertexCount || c >= vertexCount) {
+                    out[i] = out[i + 1] = out[i + 2] = Vec3{0.0, 0.0, 0.0};
+                    continue;
+                }
+                out[i] = transformed[a];
+                out[i + 1] = transformed[b];
+                out[i + 2] = transformed[c];
+            }
+        }
+        threadRange[static_cast<size_t>(tid) * kRangeStride] = lo;
+        threadRange[static_cast<size_t>(tid) * kRangeStride + 1] = hi;
+    });
+
+    double lo = std::numeric_limits<double>::max();
+    double hi = -std::numeric_limits<double>::max();
+    for (int t = 0; t < maxThreads; ++t) {
+        lo = std::min(lo, threadRange[static_cast<size_t>(t) * kRangeStride]);
+        hi = std::max(hi, threadRange[static_cast<size_t>(t) * kRangeStride + 1]);
+    }
+    minDepth = lo;
+    maxDepth = hi;
+    return lo <= hi;
+}
+
+/**
+ * @brief 构建级联阴影贴图：收集投射体后为当前相机构建各级
+ */
+bool CascadedShadowMap::Build(const RenderQueue& queue, const FrameContext& frame, const ShadowMapOptions& options) {
+    Clear();
+    // 投射体顶点与每级三角形都是临时数据：分配在帧级内存中，构建结束时回滚
+    FrameArena localArena;
+    FrameArena& arena = frame.frameArena ? *frame.frameArena : localArena;
+    FrameArena::Scope arenaScope(arena);
+
+    ShadowCasters casters;
+    if (!PrepareCasters(queue, frame, options, arena, casters)) {
+        return false;
+    }
+    return BuildCascades(casters, frame, options);
+}
+
+/**
+ * @brief 投射体一次性变换到光源空间（光源看向 lights[0].direction）
+ */
+bool CascadedShadowMap::PrepareCasters(const RenderQueue& queue, const FrameContext& frame, const ShadowMapOptions& options,
+                                       FrameArena& arena, ShadowCasters& casters) {
+    casters = ShadowCasters{};
+    if (!options.enabled || frame.lights.empty() || options.resolution < 16) {
+        return false;
+    }
+    const Vec3 direction = frame.lights[0].direction;
+    if (Vec3::Dot(direction, direction) < 1e-12) {
+        return false;
+    }
+
+    const Vec3 lightDir = direction.Normalized();
+    const Vec3 up = (std::abs(lightDir.y) < 0.99) ? Vec3{0.0, 1.0, 0.0} : Vec3{1.0, 0.0, 0.0};
+    const Mat4 lightView = Mat4::LookAt(Vec3{0.0, 0.0, 0.0}, lightDir, up);
+
+    ArenaVector<Vec3> casterVertices(arena.Shared());
+    double minDepth = 0.0;
+    double maxDepth = 0.0;
+    if (!GatherCasters(queue, lightView, arena, casterVertices, minDepth, maxDepth)) {
+        return false;
+    }
+    casters.vertices = std::span<const Vec3>(casterVertices.data(), casterVertices.size());
+    casters.lightView = lightView;
+    casters.minDepth = minDepth;
+    casters.maxDepth = maxDepth;
+    return true;
+}
+
+/**
+ * @brief 为当前相机构建级联
+ *
+ * 1. 分割视锥：dᵢ = λ·n·(f/n)^(i/N) + (1-λ)·(n + (f-n)·i/N)
+ * 2. 每级：切片 8 个角点的包围球 → 正交投影（中心对齐纹素），近平面后移到投射体最近处；
+ *    剔除与该级 xy 范围不相交或完全位于其后的三角形，仅深度光栅化
+ */
+bool CascadedShadowMap::BuildCascades(const ShadowCasters& casters, const FrameContext& frame, const ShadowMapOptions& options) {
+    Clear();
+    if (!options.enabled || casters.vertices.empty() || options.resolution < 16) {
+        return false;
+    }
+    // 仅支持透视相机：z' = (z·m22 + m32) / z
+    const Mat4& projection = frame.projection;
+    if (std::abs(projection.m[2][3] - 1.0) > 1e-9 || std::abs(projection.m[2][2]) < 1e-12 ||
+        std::abs(1.0 - projection.m[2][2]) < 1e-12) {
+        return false;
+    }
+
+    // 每级三角形是临时数据：分配在帧级内存中，构建结束时回滚
+    FrameArena localArena;
+    FrameArena& arena = frame.frameArena ? *frame.frameArena : localArena;
+    FrameArena::Scope arenaScope(arena);
+    ArenaRegion& shared = arena.Shared();
+    const int maxThreads = Parallel::MaxThreads();
+    arena.EnsureThreadRegions(maxThreads);
+
+    const Mat4& lightView = casters.lightView;
+    const Vec3* casterVertices = casters.vertices.data();
+    const double casterMinZ = casters.minDepth;
+    m_casterTriangleCount = casters.vertices.size() / 3;
+
+    const double zNear = std::max(1e-4, -projection.m[3][2] / projection.m[2][2]);
+    const double zFar = projection.m[3][2] / (1.0 - projection.m[2][2]);
+    const double shadowFar = std::min(zFar, std::max(options.maxDistance, zNear * 2.0));
+    const int cascadeCount = std::clamp(options.cascadeCount, 1, kMaxShadowCascades);
+    const int res = options.resolution;
+
+    double splits[kMaxShadowCascades + 1];
+    splits[0] = zNear;
+    for (int i = 1; i <= cascadeCount; ++i) {
+        const double t = static_cast<double>(i) / static_cast<double>(cascadeCount);
+        const double logSplit = zNear * std::pow(shadowFar / zNear, t);
+        const double uniformSplit = zNear + (shadowFar - zNear) * t;
+        splits[i] = options.splitLambda * logSplit + (1.0 - options.splitLambda) * uniformSplit;
+    }
+
+    const Mat4 invView = frame.view.Inverse();
+    const double tanX = 1.0 / projection.m[0][0];
+    const double tanY = 1.0 / projection.m[1][1];
+    const double half = 0.5 * static_cast<double>(res - 1);
+    const int numCasters = static_cast<int>(m_casterTriangleCount);
+    ArenaVector<DepthTriangle>* threadTriangles =
+        shared.AllocateArray<ArenaVector<DepthTriangle>>(static_cast<size_t>(maxThreads));
+
+    for (int c = 0; c < cascadeCount; ++c) {
+        if (IsCancelRequested(frame.cancelRequested)) {
+            return false;
+        }
+        // 每级的三角形只在本级光栅化期间存活
+        FrameArena::Scope cascadeScope(arena);
+        for (int t = 0; t < maxThreads; ++t) {
+            threadTriangles[t] = ArenaVector<DepthTriangle>(arena.ThreadRegion(t));
+        }
+
+        // 切片角点（光源空间）的包围球：半径只取决于相机投影，旋转 / 平移时保持不变
+        Vec3 corners[8];
+        Vec3 center{0.0, 0.0, 0.0};
+        for (int k = 0; k < 8; ++k) {
+            const double d = (k & 4) ? splits[c + 1] : splits[c];
+            const Vec4 view{((k & 1) ? d : -d) * tanX, ((k & 2) ? d : -d) * tanY, d, 1.0};
+            const Vec4 light = lightView.Multiply(invView.Multiply(view));
+            corners[k] = Vec3{light.x, light.y, light.z};
+            center = center + corners[k] * 0.125;
+        }
+        double radius = 0.0;
+        for (const Vec3& corner : corners) {
+            const Vec3 offset = corner - center;
+            radius = std::max(radius, std::sqrt(Vec3::Dot(offset, offset)));
+        }
+        radius = std::max(radius, 1e-3);
+
+        // 中心对齐纹素网格，避免相机移动时阴影边缘闪烁；
+        // 视口把 [-1, 1] 映射到 [0, res - 1]，一个纹素对应 2r / (res - 1)
+        const double texel = 2.0 * radius / static_cast<double>(res - 1);
+        const double cx = std::floor(center.x / texel) * texel;
+        const double cy = std::floor(center.y / texel) * texel;
+        const double zMin = std::min(casterMinZ, center.z - radius);
+        const double zMax = center.z + radius;
+        const double scale = 1.0 / radius;
+        const double zScale = 1.0 / std::max(zMax - zMin, 1e-9);
+
+        // 光源空间 → 裁剪空间只需逐分量缩放平移；与该级不相交的三角形不进入光栅化
+        Parallel::ForRange(0, numCasters, kCasterCullChunk, [&](int first, int last) {
+            ArenaVector<DepthTriangle>& local = threadTriangles[Parallel::ThreadIndex()];
+
+            for (int t = first; t < last; ++t) {
+                const Vec3* v = casterVertices + static_cast<size_t>(t) * 3;
+                if (std::min({v[0].z, v[1].z, v[2].z}) > zMax ||
+                    std::max({v[0].x, v[1].x, v[2].x}) < cx - radius || std::min({v[0].x, v[1].x, v[2].x}) > cx + radius ||
+                    std::max({v[0].y, v[1].y, v[2].y}) < cy - radius || std::min({v[0].y, v[1].y, v[2].y}) > cy + radius) {
+                    continue;
+                }
+                DepthTriangle tri;
+                tri.v0 = Vec4{(v[0].x - cx) * scale, (v[0].y - cy) * scale, (v[0].z - zMin) * zScale, 1.0};
+                tri.v1 = Vec4{(v[1].x - cx) * scale, (v[1].y - cy) * scale, (v[1].z - zMin) * zScale, 1.0};
+                tri.v2 = Vec4{(v[2].x - cx) * scale, (v[2].y - cy) * scale, (v[2].z - zMin) * zScale, 1.0};
+                local.push_back(tri);
+            }
+        });
+        size_t depthTriangleCount = 0;
+        for (int t = 0; t < maxThreads; ++t) {
+            depthTriangleCount += threadTriangles[t].size();
+        }
+        ArenaVector<DepthTriangle> depthTriangles(shared);
+        depthTriangles.reserve(depthTriangleCount);
+        for (int t = 0; t < maxThreads; ++t) {
+            depthTriangles.append(threadTriangles[t].data(), threadTriangles[t].size());
+        }
+
+        DepthBuffer& depth = m_depth[c];
+        if (depth.GetWidth() != res || depth.GetHeight() != res) {
+            depth.Resize(res, res);
+        } else {
+            depth.Clear(1.0);
+        }
+        Rasterizer rasterizer;
+        rasterizer.SetTargets(nullptr, &depth);
+        rasterizer.SetFrameArena(&arena);
+        rasterizer.SetCancelFlag(frame.cancelRequested);
+        const RasterStats stats = rasterizer.RasterizeDepth(depthTriangles.data(), depthTriangles.size());
+        m_rasterStats.trianglesInput += stats.trianglesInput;
+        m_rasterStats.trianglesRaster += stats.trianglesRaster;
+        m_rasterStats.pixelsTested += stats.pixelsTested;
+
+        // 世界 → 光源空间 → 归一化正交空间 → 纹素坐标（与 Rasterizer 视口映射一致）
+        Mat4 ortho = Mat4::Identity();
+        ortho.m[0][0] = scale;
+        ortho.m[1][1] = scale;
+        ortho.m[2][2] = zScale;
+        ortho.m[3][0] = -cx * scale;
+        ortho.m[3][1] = -cy * scale;
+        ortho.m[3][2] = -zMin * zScale;
+        Mat4 viewport = Mat4::Identity();
+        viewport.m[0][0] = half;
+        viewport.m[1][1] = -half;
+        viewport.m[3][0] = half;
+        viewport.m[3][1] = half;
+
+        ShadowCascade& cascade = m_data.cascades[c];
+        cascade.worldToShadow = lightView * ortho * viewport;
+        cascade.splitDepth = splits[c + 1];
+        cascade.normalOffset = options.normalBias * texel;
+        cascade.depthBias = options.depthBias * texel * zScale;
+        cascade.depth = depth.Data();
+    }
+
+    m_data.cascadeCount = cascadeCount;
+    m_data.resolution = res;
+    m_data.viewDepthAxis = Vec3{frame.view.m[0][2], frame.view.m[1][2], frame.view.m[2][2]};
+    m_data.viewDepthOffset = frame.view.m[3][2];
+    m_data.lightIndex = 0;
+    return true;
+}
+
+} // namespace SR
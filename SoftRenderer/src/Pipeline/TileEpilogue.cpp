@@ -0,0 +1,87 @@
+#include "Pipeline/TileEpilogue.h"
+
+#include "Core/DepthBuffer.h"
+#include "Core/Framebuffer.h"
+#include "Math/Mat4.h"
+#include "Math/Vec4.h"
+#include "Pipeline/EnvironmentMap.h"
+#include "Pipeline/FrameContext.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace SR {
+
+namespace {
+
+/// 深度不小于该值视为未被几何覆盖（与原 SkyboxPass 判定一致）
+constexpr double kSkyDepthThreshold = 0.9999;
+
+// 逆 VP 反投影像素中心的近、远平面点，返回两者之差
+Vec3 UnprojectRay(const Mat4& invVP, double x, double y, int width, int height) {
+    const double ndcX = (2.0 * (x + 0.5) / width) - 1.0;
+    const double ndcY = 1.0 - (2.0 * (y + 0.5) / height);
+    const Vec4 nearWorld = invVP.Multiply(Vec4{ndcX, ndcY, 0.0, 1.0});
+    const Vec4 farWorld = invVP.Multiply(Vec4{ndcX, ndcY, 1.0, 1.0});
+    if (std::abs(nearWorld.w) < 1e-12 || std::abs(farWorld.w) < 1e-12) {
+        return Vec3{0.0, 0.0, 1.0};
+    }
+    return Vec3{farWorld.x / farWorld.w - nearWorld.x / nearWorld.w,
+                farWorld.y / farWorld.w - nearWorld.y / nearWorld.w,
+                farWorld.z / farWorld.w - nearWorld.z / nearWorld.w};
+}
+
+} // namespace
+
+ViewRayStepper ViewRayStepper::FromFrame(const FrameContext& frame, int width, int height) {
+    const Mat4 invVP = (frame.view * frame.projection).Inverse();
+    const double spanX = static_cast<double>(std::max(width - 1, 1));
+    const double spanY = static_cast<double>(std::max(height - 1, 1));
+
+    // 取对角像素求步长，减小相减误差
+    ViewRayStepper rays;
+    rays.origin = UnprojectRay(invVP, 0.0, 0.0, width, height);
+    rays.stepX = (UnprojectRay(invVP, spanX, 0.0, width, height) - rays.origin) / spanX;
+    rays.stepY = (UnprojectRay(invVP, 0.0, spanY, width, height) - rays.origin) / spanY;
+    return rays;
+}
+
+void FillSkyRect(const EnvironmentMap& environment, const ViewRayStepper& rays, const double* depth,
+                 Vec3* linearPixels, int width, int minX, int minY, int maxX, int maxY) {
+    for (int y = minY; y <= maxY; ++y) {
+        const size_t rowBase = static_cast<size_t>(y) * static_cast<size_t>(width);
+        Vec3 dir = rays.At(minX, y);
+        for (int x = minX; x <= maxX; ++x, dir = dir + rays.stepX) {
+            const size_t idx = rowBase + static_cast<size_t>(x);
+            if (depth[idx] < kSkyDepthThreshold) continue;  // 已有不透明几何，跳过
+
+            const double len = std::sqrt(dir.x * dir.x + dir.y * dir.y + dir.z * dir.z);
+            const double inv = len > 1e-12 ? 1.0 / len : 1.0;
+            linearPixels[idx] = environment.SampleDirection(Vec3{dir.x * inv, dir.y * inv, dir.z * inv});
+        }
+    }
+}
+
+void TileEpilogue::Setup(const FrameContext& frame, Framebuffer* framebuffer, const DepthBuffer* depthBuffer,
+                         const EnvironmentMap* sky, bool resolve, double exposure) {
+    m_framebuffer = framebuffer;
+    m_depth = depthBuffer ? depthBuffer->Data() : nullptr;
+    m_sky = (sky && sky->IsLoaded() && m_depth) ? sky : nullptr;
+    m_resolve = resolve;
+    m_exposure = exposure;
+    if (m_sky && framebuffer) {
+        m_rays = ViewRayStepper::FromFrame(frame, framebuffer->GetWidth(), framebuffer->GetHeight());
+    }
+}
+
+void TileEpilogue::Run(int minX, int minY, int maxX, int maxY) const {
+    if (m_sky) {
+        FillSkyRect(*m_sky, m_rays, m_depth, m_framebuffer->GetLinearPixelsWritable(),
+                    m_framebuffer->GetWidth(), minX, minY, maxX, maxY);
+    }
+    if (m_resolve) {
+        m_framebuffer->ResolveRectToSRGB(minX, minY, maxX, maxY, m_exposure);
+    }
+}
+
+} // namespace SR
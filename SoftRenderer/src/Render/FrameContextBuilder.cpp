@@ -41,19 +41,33 @@ FrameContext FrameContextBuilder::Build(const Scene& scene, int width, int heigh
     // 3. 设置光照环境
     frameContext.ambientColor = options.ambientColor;
 
-    const LightGroup* lights = scene.GetLightGroup();
-    if (lights && !lights->GetDirectionalLights().empty()) {
-        frameContext.lights = lights->GetDirectionalLights();
-    } else {
-        // 如果场景中没有灯光，则添加一个默认的平行光
-        DirectionalLight defaultLight;
-        defaultLight.direction = options.defaultLightDirection;
-        defaultLight.color = options.defaultLightColor;
-        defaultLight.intensity = options.defaultLightIntensity;
-        frameContext.lights.push_back(defaultLight);
-    }
+    ApplyLights(scene.GetLightGroup(), options, frameContext);
 
     return frameContext;
 }
 
+/**
+ * @brief 写入场景光源；场景不含任何光源时使用默认平行光
+ * @param lights 场景光源组（可为 nullptr）
+ * @param options 提供默认平行光参数
+ * @param frameContext 输出的帧上下文
+ */
+void FrameContextBuilder::ApplyLights(const LightGroup* lights, const FrameContextOptions& options, FrameContext& frameContext) const {
+    frameContext.lights.clear();
+    frameContext.pointLights.clear();
+    frameContext.spotLights.clear();
+    if (lights && !lights->IsEmpty()) {
+        frameContext.lights = lights->GetDirectionalLights();
+        frameContext.pointLights = lights->GetPointLights();
+        frameContext.spotLights = lights->GetSpotLights();
+        return;
+    }
+    // 如果场景中没有灯光，则添加一个默认的平行光
+    DirectionalLight defaultLight;
+    defaultLight.direction = options.defaultLightDirection;
+    defaultLight.color = options.defaultLightColor;
+    defaultLight.intensity = options.defaultLightIntensity;
+    frameContext.lights.push_back(defaultLight);
+}
+
 } // namespace SR
@@ -0,0 +1,117 @@
+#include "Render/FrameFuture.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace SR {
+
+/// 同一帧所有句柄共享的状态
+struct FrameFuture::State {
+    uint64_t frameId = 0;
+    std::atomic<bool> cancelRequested{false};
+    std::mutex mutex;
+    std::condition_variable finished;
+    FrameStatus status = FrameStatus::Pending;
+    CompletedFrame result{};
+    std::vector<FrameCallback> callbacks;
+};
+
+FrameFuture FrameFuture::Create(uint64_t frameId) {
+    auto state = std::make_shared<State>();
+    state->frameId = frameId;
+    state->result.frameId = frameId;
+    return FrameFuture(std::move(state));
+}
+
+uint64_t FrameFuture::GetFrameId() const {
+    return m_state ? m_state->frameId : 0;
+}
+
+FrameStatus FrameFuture::GetStatus() const {
+    if (!m_state) {
+        return FrameStatus::Cancelled;
+    }
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    return m_state->status;
+}
+
+FrameStatus FrameFuture::Wait() const {
+    if (!m_state) {
+        return FrameStatus::Cancelled;
+    }
+    std::unique_lock<std::mutex> lock(m_state->mutex);
+    m_state->finished.wait(lock, [this] { return m_state->status != FrameStatus::Pending; });
+    return m_state->status;
+}
+
+const CompletedFrame& FrameFuture::Get() const {
+    static const CompletedFrame kInvalid = [] {
+        CompletedFrame frame;
+        frame.cancelled = true;
+        return frame;
+    }();
+    if (!m_state) {
+        return kInvalid;
+    }
+    Wait();
+    return m_state->result;
+}
+
+void FrameFuture::Cancel() {
+    if (m_state) {
+        m_state->cancelRequested.store(true, std::memory_order_relaxed);
+    }
+}
+
+bool FrameFuture::IsCancelRequested() const {
+    return m_state && m_state->cancelRequested.load(std::memory_order_relaxed);
+}
+
+void FrameFuture::Then(FrameCallback callback) {
+    if (!m_state || !callback) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_state->mutex);
+        if (m_state->status == FrameStatus::Pending) {
+            m_state->callbacks.push_back(std::move(callback));
+            return;
+        }
+    }
+    callback(m_state->result);
+}
+
+const std::atomic<bool>* FrameFuture::GetCancelFlag() const {
+    return m_state ? &m_state->cancelRequested : nullptr;
+}
+
+/**
+ * @brief 写入结果并按注册顺序调用回调，回调全部返回后才唤醒等待方
+ *
+ * 回调在锁外调用；期间新注册的回调在下一轮调用，直到没有新回调时才切换状态。
+ */
+void FrameFuture::Finish(const CompletedFrame& frame) {
+    std::vector<FrameCallback> callbacks;
+    {
+        std::lock_guard<std::mutex> lock(m_state->mutex);
+        m_state->result = frame;
+        callbacks.swap(m_state->callbacks);
+    }
+    for (;;) {
+        for (const FrameCallback& callback : callbacks) {
+            callback(m_state->result);
+        }
+        callbacks.clear();
+        std::lock_guard<std::mutex> lock(m_state->mutex);
+        if (m_state->callbacks.empty()) {
+            m_state->status = frame.cancelled ? FrameStatus::Cancelled : FrameStatus::Completed;
+            break;
+        }
+        callbacks.swap(m_state->callbacks);
+    }
+    m_state->finished.notify_all();
+}
+
+} // namespace SR
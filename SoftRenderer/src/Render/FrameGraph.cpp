@@ -0,0 +1,101 @@
+#include "Render/FrameGraph.h"
+
+#include "Pipeline/PassBuilder.h"
+#include "Utils/DebugLog.h"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace SR {
+
+/**
+ * @brief 编译帧图
+ *
+ * 1. 配置 Pass 后由 PassBuilder 完成依赖与资源冲突校验、拓扑排序，取得 Pass 实例与直接前驱；
+ * 2. 顺序遍历资源声明：读取未产出的临时资源视为错误；
+ * 3. 导入资源若在首次被读取前已被某个 Pass 完整覆盖，则从清除掩码中去掉。
+ *
+ * 互不依赖的 Pass 之间已保证没有读写冲突，因此按拓扑序做的 2、3 两步对任意执行顺序都成立。
+ */
+bool FrameGraph::Compile(PassBuilder& builder, const PassConfigurator& configure) {
+    m_passes.clear();
+    m_dependencies.clear();
+    m_clearMask = FrameResource::Imported;
+    m_transients = 0;
+    m_error.clear();
+
+    builder.ConfigurePasses(configure);
+    PassDependencies dependencies;
+    std::vector<std::unique_ptr<RenderPass>> passes = builder.Build(&dependencies);
+    if (passes.empty()) {
+        m_error = builder.GetError().empty() ? std::string("No passes added to pipeline") : builder.GetError();
+        return false;
+    }
+
+    FrameResourceMask available = FrameResource::Imported | FrameResource::FrameMemory;
+    FrameResourceMask readSoFar = 0;
+    FrameResourceMask overwritten = 0;
+    FrameResourceMask used = 0;
+    for (const auto& pass : passes) {
+        const PassResources res = pass->GetResources();
+        const FrameResourceMask missing = res.reads & ~available;
+        if (missing != 0) {
+            m_error = "Pass '" + pass->GetName() + "' reads " + FormatResourceMask(missing) +
+                      " before any pass writes it";
+            return false;
+        }
+        // 在本 Pass 之前尚未被读取、且由本 Pass 完整覆盖的导入资源无需清除
+        overwritten |= res.overwrites & ~readSoFar;
+        readSoFar |= res.reads;
+        available |= res.writes;
+        used |= res.reads | res.writes;
+    }
+
+    // 依赖层数（最长链长度）：等于 Pass 数时各 Pass 只能依次执行
+    std::vector<int> level(passes.size(), 0);
+    int levels = 0;
+    for (size_t i = 0; i < passes.size(); ++i) {
+        for (int dep : dependencies[i]) {
+            level[i] = std::max(level[i], level[static_cast<size_t>(dep)] + 1);
+        }
+        levels = std::max(levels, level[i] + 1);
+    }
+
+    m_passes = std::move(passes);
+    m_dependencies = std::move(dependencies);
+    m_clearMask = FrameResource::Imported & ~overwritten;
+    m_transients = used & FrameResource::Transient;
+
+    char buffer[256];
+    std::snprintf(buffer, sizeof(buffer), "[SR-PERF] FrameGraph compiled: passes=%zu levels=%d clear=%s transient=%s\n",
+                  m_passes.size(), levels, FormatResourceMask(m_clearMask).c_str(), FormatResourceMask(m_transients).c_str());
+    SR_PERF_LOG(buffer);
+    return true;
+}
+
+/**
+ * @brief 复位并绑定临时资源
+ */
+void FrameGraph::BindTransients(RenderContext& context, FrameArena* arena) {
+    if (m_transients & (FrameResource::BlendTriangles | FrameResource::BlendBins)) {
+        if (!arena) {
+            m_fallbackArena.EndFrame();
+            arena = &m_fallbackArena;
+        }
+        context.transientArena = arena;
+    }
+    if (m_transients & FrameResource::BlendTriangles) {
+        m_blendTriangles = ArenaVector<Triangle>(arena->Shared());
+        context.deferredBlendTriangles = &m_blendTriangles;
+    }
+    if (m_transients & FrameResource::BlendBins) {
+        m_preparedBlendTriangles = PreparedTriangles{};
+        context.preparedBlendTriangles = &m_preparedBlendTriangles;
+    }
+    if (m_transients & FrameResource::Materials) {
+        m_materialTable.Clear();
+        context.materialTable = &m_materialTable;
+    }
+}
+
+} // namespace SR
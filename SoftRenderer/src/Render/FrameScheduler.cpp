@@ -0,0 +1,79 @@
+#include "Render/FrameScheduler.h"
+
+#include <utility>
+
+namespace SR {
+
+FrameScheduler::~FrameScheduler() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_submitted.notify_all();
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+}
+
+void FrameScheduler::Submit(uint64_t frameId, Task task) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pending.push_back(Pending{frameId, std::move(task)});
+        if (!m_thread.joinable()) {
+            m_thread = std::thread([this] { ThreadLoop(); });
+        }
+    }
+    m_submitted.notify_one();
+}
+
+void FrameScheduler::CompleteInline(uint64_t frameId, const Task& task) {
+    // 同步帧之前可能还有流水线模式下提交的帧，须保持完成顺序
+    Wait(frameId - 1);
+    task();
+    MarkComplete(frameId);
+}
+
+bool FrameScheduler::IsComplete(uint64_t frameId) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_completedFrameId >= frameId;
+}
+
+void FrameScheduler::Wait(uint64_t frameId) const {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_completed.wait(lock, [&] { return m_completedFrameId >= frameId; });
+}
+
+uint64_t FrameScheduler::GetCompletedFrameId() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_completedFrameId;
+}
+
+/**
+ * @brief 后端线程：按提交顺序执行帧，退出前先完成所有已提交的帧
+ */
+void FrameScheduler::ThreadLoop() {
+    for (;;) {
+        Pending pending;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_submitted.wait(lock, [&] { return m_stopping || !m_pending.empty(); });
+            if (m_pending.empty()) {
+                return;
+            }
+            pending = std::move(m_pending.front());
+            m_pending.pop_front();
+        }
+        pending.task();
+        MarkComplete(pending.frameId);
+    }
+}
+
+void FrameScheduler::MarkComplete(uint64_t frameId) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_completedFrameId = frameId;
+    }
+    m_completed.notify_all();
+}
+
+} // namespace SR
@@ -1,54 +1,117 @@
 #include "Render/GPUSceneRenderQueueBuilder.h"
 
 #include "Runtime/GPUScene.h"
-#include <algorithm>
 
 namespace SR {
 
+namespace {
+
+DrawItem MakeDrawItem(const GPUSceneDrawItem& sceneItem) {
+    DrawItem item{};
+    item.mesh = sceneItem.mesh;
+    item.material = sceneItem.material;
+    item.modelMatrix = sceneItem.modelMatrix;
+    item.normalMatrix = sceneItem.normalMatrix;
+    item.meshIndex = sceneItem.meshIndex;
+    item.materialIndex = sceneItem.materialIndex;
+    item.primitiveIndex = sceneItem.primitiveIndex;
+    item.nodeIndex = sceneItem.nodeIndex;
+    item.textures = sceneItem.textures;
+    return item;
+}
+
+/// 实例化渲染项：实例数组由 GPUScene 持有，队列仅引用；
+/// modelMatrix 取首个实例，用于排序键与调试信息
+DrawItem MakeInstancedDrawItem(const GPUSceneInstancedDrawItem& sceneItem) {
+    DrawItem item{};
+    item.mesh = sceneItem.mesh;
+    item.material = sceneItem.material;
+    item.modelMatrix = sceneItem.instances.front().modelMatrix;
+    item.normalMatrix = sceneItem.instances.front().normalMatrix;
+    item.meshIndex = sceneItem.meshIndex;
+    item.materialIndex = sceneItem.materialIndex;
+    item.primitiveIndex = sceneItem.primitiveIndex;
+    item.nodeIndex = sceneItem.instances.front().nodeIndex;
+    item.textures = sceneItem.textures;
+    item.instances = sceneItem.instances.data();
+    item.instanceCount = sceneItem.instances.size();
+    return item;
+}
+
+bool AcceptItem(int materialIndex, int onlyMaterialIndex) {
+    return onlyMaterialIndex < 0 || materialIndex == onlyMaterialIndex;
+}
+
+} // namespace
+
 /**
- * @brief 从 GPUScene 构建渲染队列（含排序优化）
+ * @brief 从 GPUScene 构建渲染队列
  * @param scene            运行时场景数据
  * @param outQueue         输出的渲染队列
  * @param onlyMaterialIndex 若 >= 0，则仅包含指定材质索引的绘制项（调试用）
+ *
+ * 绘制顺序由 RenderQueue::UpdateSortKeys 按 64 位排序键决定
+ * （先 alphaMode，不透明按材质/网格分组，半透明从远到近）。
  */
 void GPUSceneRenderQueueBuilder::Build(const GPUScene& scene, RenderQueue& outQueue, int onlyMaterialIndex) const {
     std::vector<DrawItem> items;
     const auto& sceneItems = scene.GetItems();
-    items.reserve(sceneItems.size());
+    items.reserve(sceneItems.size() + scene.GetInstancedItems().size());
 
     for (const GPUSceneDrawItem& sceneItem : sceneItems) {
-        if (onlyMaterialIndex >= 0 && sceneItem.materialIndex != onlyMaterialIndex) {
-            continue;
+        if (AcceptItem(sceneItem.materialIndex, onlyMaterialIndex)) {
+            items.push_back(MakeDrawItem(sceneItem));
+        }
+    }
+    for (const GPUSceneInstancedDrawItem& sceneItem : scene.GetInstancedItems()) {
+        if (AcceptItem(sceneItem.materialIndex, onlyMaterialIndex) && !sceneItem.instances.empty()) {
+            items.push_back(MakeInstancedDrawItem(sceneItem));
         }
+    }
 
-        DrawItem item{};
-        item.mesh = sceneItem.mesh;
-        item.material = sceneItem.material;
-        item.modelMatrix = sceneItem.modelMatrix;
-        item.normalMatrix = sceneItem.normalMatrix;
-        item.meshIndex = sceneItem.meshIndex;
-        item.materialIndex = sceneItem.materialIndex;
-        item.primitiveIndex = sceneItem.primitiveIndex;
-        item.nodeIndex = sceneItem.nodeIndex;
-        item.textures = sceneItem.textures;
-        items.push_back(item);
+    outQueue.SetItems(std::move(items));
+}
+
+/**
+ * @brief 增量同步持久渲染队列
+ */
+bool GPUSceneRenderQueueBuilder::Update(const GPUScene& scene, RenderQueue& queue, int onlyMaterialIndex) {
+    const bool sameSource = m_syncedScene == &scene && m_syncedQueue == &queue && m_syncedFilter == onlyMaterialIndex;
+    if (sameSource && m_syncedRevision == scene.GetRevision()) {
+        return false;
     }
 
-    // 先按 alphaMode 排序（Opaque=0 < Mask=1 < Blend=2），再按材质/网格分组。
-    // 确保不透明物体先渲染并填充深度缓冲区，半透明物体随后才能正确地与背景混合。
-    std::stable_sort(items.begin(), items.end(), [](const DrawItem& a, const DrawItem& b) {
-        GLTFAlphaMode alphaModeA = a.material ? a.material->alphaMode : GLTFAlphaMode::Opaque;
-        GLTFAlphaMode alphaModeB = b.material ? b.material->alphaMode : GLTFAlphaMode::Opaque;
-        if (alphaModeA != alphaModeB) {
-            return alphaModeA < alphaModeB;
+    const auto& sceneItems = scene.GetItems();
+    const auto& instancedItems = scene.GetInstancedItems();
+    const bool appendOnly = sameSource &&
+                            m_syncedLayoutRevision == scene.GetLayoutRevision() &&
+                            m_syncedItemCount <= sceneItems.size() &&
+                            m_syncedInstancedCount <= instancedItems.size();
+
+    if (appendOnly) {
+        for (size_t i = m_syncedItemCount; i < sceneItems.size(); ++i) {
+            if (AcceptItem(sceneItems[i].materialIndex, onlyMaterialIndex)) {
+                queue.AddItem(MakeDrawItem(sceneItems[i]));
+            }
         }
-        if (a.material != b.material) {
-            return a.material < b.material;
+        for (size_t i = m_syncedInstancedCount; i < instancedItems.size(); ++i) {
+            const GPUSceneInstancedDrawItem& sceneItem = instancedItems[i];
+            if (AcceptItem(sceneItem.materialIndex, onlyMaterialIndex) && !sceneItem.instances.empty()) {
+                queue.AddItem(MakeInstancedDrawItem(sceneItem));
+            }
         }
-        return a.mesh < b.mesh;
-    });
+    } else {
+        Build(scene, queue, onlyMaterialIndex);
+    }
 
-    outQueue.SetItems(std::move(items));
+    m_syncedScene = &scene;
+    m_syncedQueue = &queue;
+    m_syncedRevision = scene.GetRevision();
+    m_syncedLayoutRevision = scene.GetLayoutRevision();
+    m_syncedItemCount = sceneItems.size();
+    m_syncedInstancedCount = instancedItems.size();
+    m_syncedFilter = onlyMaterialIndex;
+    return true;
 }
 
 } // namespace SR
@@ -1,16 +1,55 @@
 #include "Render/RenderPipeline.h"
 
+#include "Core/Parallel.h"
 #include "Pipeline/MaterialTable.h"
+#include "Pipeline/MultiViewGeometry.h"
 #include "Pipeline/OpaquePass.h"
 #include "Pipeline/PassBuilder.h"
 #include "Pipeline/Rasterizer.h"
+#include "Pipeline/TileEpilogue.h"
 #include "Utils/DebugLog.h"
 
+#include <algorithm>
 #include <chrono>
 #include <vector>
 
 namespace SR {
 
+namespace {
+
+// 累加单个 Pass 的统计信息
+void AccumulatePassStats(RenderStats& totalStats, const PassStats& passStats) {
+    totalStats.buildMs += passStats.buildMs;
+    totalStats.rastMs += passStats.rastMs;
+    totalStats.trianglesBuilt += passStats.trianglesBuilt;
+    totalStats.trianglesClipped += passStats.trianglesClipped;
+    totalStats.trianglesRaster += passStats.trianglesRendered;
+    totalStats.pixelsTested += passStats.pixelsTested;
+    totalStats.pixelsShaded += passStats.pixelsShaded;
+    totalStats.trianglesCulledBackface += passStats.trianglesCulledBackface;
+    totalStats.trianglesCulledDegenerate += passStats.trianglesCulledDegenerate;
+    totalStats.trianglesCulledOffscreen += passStats.trianglesCulledOffscreen;
+    totalStats.shaderUsage.Accumulate(passStats.shaderUsage);
+}
+
+// 拓扑序中相邻两个 Pass 之间只可能有直接边，因此每个 Pass 都直接依赖前一个即为单链
+bool IsSerialChain(const PassDependencies& dependencies) {
+    for (size_t i = 1; i < dependencies.size(); ++i) {
+        const std::vector<int>& deps = dependencies[i];
+        if (std::find(deps.begin(), deps.end(), static_cast<int>(i) - 1) == deps.end()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// 帧上下文中的取消标志已置位
+bool IsFrameCancelled(const RenderContext& context) {
+    return context.frameContext && IsCancelRequested(context.frameContext->cancelRequested);
+}
+
+} // namespace
+
 /**
  * @brief 使用 Pass 系统执行渲染管线
  * @param passes 按依赖关系排序的 Pass 列表
@@ -24,23 +63,57 @@ RenderStats RenderPipeline::ExecutePasses(std::vector<std::unique_ptr<RenderPass
     for (auto& pass : passes) {
         if (!pass) continue;
 
-        // 检查 Pass 是否满足执行条件（如 SkyboxPass 要求环境贴图已加载）
-        if (!pass->ShouldExecute(context)) {
+        // 检查 Pass 是否满足执行条件（如 SkyboxPass 要求环境贴图已加载）；帧已取消时跳过剩余 Pass
+        if (IsFrameCancelled(context) || !pass->ShouldExecute(context)) {
             continue;
         }
 
-        PassStats passStats = ExecutePass(*pass, context);
+        AccumulatePassStats(totalStats, ExecutePass(*pass, context));
+    }
+
+    return totalStats;
+}
 
-        // 累加各 Pass 的统计信息
-        totalStats.buildMs += passStats.buildMs;
-        totalStats.rastMs += passStats.rastMs;
-        totalStats.trianglesBuilt += passStats.trianglesBuilt;
-        totalStats.trianglesClipped += passStats.trianglesClipped;
-        totalStats.trianglesRaster += passStats.trianglesRendered;
-        totalStats.pixelsTested += passStats.pixelsTested;
-        totalStats.pixelsShaded += passStats.pixelsShaded;
+/**
+ * @brief 按依赖图执行 Pass
+ *
+ * 每个 Pass 是任务图的一个节点，前驱全部完成后才检查 ShouldExecute 并执行；
+ * Pass 内部的并行循环嵌套提交到同一个任务系统，等待期间当前线程继续窃取其他 Pass 的任务。
+ * 资源冲突已由 PassBuilder::Validate 排除，并发的 Pass 只写 RenderContext 中互不相同的字段。
+ */
+RenderStats RenderPipeline::ExecutePasses(std::vector<std::unique_ptr<RenderPass>>& passes,
+                                          const PassDependencies& dependencies,
+                                          RenderContext& context) const {
+    if (Parallel::GetBackend() != ParallelBackend::JobSystem || dependencies.size() != passes.size() ||
+        IsSerialChain(dependencies)) {
+        return ExecutePasses(passes, context);
     }
 
+    std::vector<PassStats> passStats(passes.size());
+    auto runPasses = [&](int first, int last) {
+        for (int i = first; i < last; ++i) {
+            RenderPass* pass = passes[static_cast<size_t>(i)].get();
+            if (pass && !IsFrameCancelled(context) && pass->ShouldExecute(context)) {
+                passStats[static_cast<size_t>(i)] = ExecutePass(*pass, context);
+            }
+        }
+    };
+
+    JobGraph graph;
+    for (size_t i = 0; i < passes.size(); ++i) {
+        Parallel::AddRange(graph, static_cast<int>(i), static_cast<int>(i) + 1, 1, runPasses);
+    }
+    for (size_t i = 0; i < dependencies.size(); ++i) {
+        for (int dep : dependencies[i]) {
+            graph.Precede(dep, static_cast<int>(i));
+        }
+    }
+    Parallel::Run(graph);
+
+    RenderStats totalStats;
+    for (const PassStats& stats : passStats) {
+        AccumulatePassStats(totalStats, stats);
+    }
     return totalStats;
 }
 
@@ -72,54 +145,80 @@ PassStats RenderPipeline::ExecutePass(RenderPass& pass, RenderContext& context)
 }
 
 /**
- * @brief 传统路径：通过 PassContext 执行默认管线
+ * @brief 编译默认管线的帧图
  *
- * 创建帧级 MaterialTable 和延迟混合三角形缓冲，
- * 使用 DefaultPipeline::Create() 构建标准管线并执行。
+ * 只在首次调用或设置变化时重新实例化 Pass（后处理参数在编译时注入，
+ * 每帧不再创建 Pass 或做类型查询）。
  */
-RenderStats RenderPipeline::Render(const RenderQueue& queue, const PassContext& pass) const {
-    using Clock = std::chrono::high_resolution_clock;
+bool RenderPipeline::Configure(const FrameGraphSettings& settings) {
+    if (m_frameGraph.IsCompiled() && settings == m_settings) {
+        return true;
+    }
 
-    // 清除缓冲区（传统路径由管线自身负责清除）
-    auto clearStart = Clock::now();
-    if (pass.framebuffer && pass.depthBuffer) {
-        pass.framebuffer->ClearLinear(Vec3{0.0, 0.0, 0.0});
-        pass.depthBuffer->Clear(1.0);
+    PassBuilder builder;
+    DefaultPipeline::Configure(builder);
+    const bool compiled = m_frameGraph.Compile(builder, [&settings](RenderPass& renderPass) {
+        if (auto* post = dynamic_cast<PostProcessPass*>(&renderPass)) {
+            post->SetFXAAEnabled(settings.enableFXAA);
+            post->SetToneMappingEnabled(settings.enableToneMap);
+            post->SetExposure(settings.exposure);
+        }
+    });
+    if (!compiled) {
+        char debugMsg[256];
+        snprintf(debugMsg, sizeof(debugMsg), "RenderPipeline: 帧图编译失败: %s\n", m_frameGraph.GetError().c_str());
+        SR_DEBUG_LOG(debugMsg);
+        return false;
     }
-    auto clearEnd = Clock::now();
+    m_settings = settings;
+    return true;
+}
+
+/**
+ * @brief 传统路径：通过 PassContext 执行默认管线
+ *
+ * 帧图与临时资源（MaterialTable、延迟混合三角形）跨帧复用；
+ * 目标缓冲已由调用方按 GetClearMask() 清除，此处不再重复清除。
+ */
+RenderStats RenderPipeline::Render(const RenderQueue& queue, const PassContext& pass) {
+    using Clock = std::chrono::high_resolution_clock;
 
-    // 创建帧级 MaterialTable（SOA 布局，生命周期覆盖整帧）
     auto pipelineStart = Clock::now();
-    MaterialTable materialTable;
-    std::vector<Triangle> deferredBlend;  // OpaquePass 产出，TransparentPass 消费
-
-    // 构建默认管线并配置后处理参数
-    auto passes = DefaultPipeline::Create();
-    for (auto& passPtr : passes) {
-        if (auto* post = dynamic_cast<PostProcessPass*>(passPtr.get())) {
-            post->SetFXAAEnabled(pass.enableFXAA);
-            post->SetToneMappingEnabled(pass.enableToneMap);
-            post->SetExposure(pass.exposure);
-        }
+    FrameGraphSettings settings;
+    settings.enableFXAA = pass.enableFXAA;
+    settings.enableToneMap = pass.enableToneMap;
+    settings.exposure = pass.exposure;
+    if (!Configure(settings)) {
+        return RenderStats{};
     }
-    auto pipelineEnd = Clock::now();
 
     RenderContext context{};
     context.framebuffer = pass.framebuffer;
     context.depthBuffer = pass.depthBuffer;
     context.renderQueue = &queue;
     context.frameContext = &pass.frame;
-    context.deferredBlendTriangles = &deferredBlend;
-    context.materialTable = &materialTable;
+    m_frameGraph.BindTransients(context, pass.frame.frameArena);
+    if (pass.multiViewGeometry) {
+        context.multiViewGeometry = pass.multiViewGeometry;
+        context.materialTable = &pass.multiViewGeometry->GetMaterials();
+    }
+    auto pipelineEnd = Clock::now();
+
+    // Tile 收尾：天空总可提前填充；色调映射需无 FXAA（FXAA 需要邻域，仍走全帧 Pass）
+    TileEpilogueSettings tileEpilogue;
+    tileEpilogue.resolveOutput = pass.enableToneMap && !pass.enableFXAA;
+    tileEpilogue.exposure = pass.exposure;
+    if (pass.enableTileEpilogue) {
+        context.tileEpilogue = &tileEpilogue;
+    }
 
-    RenderStats stats = ExecutePasses(passes, context);
+    RenderStats stats = ExecutePasses(m_frameGraph.GetPasses(), m_frameGraph.GetDependencies(), context);
 
-    double clearMs2 = std::chrono::duration<double, std::milli>(clearEnd - clearStart).count();
-    double pipeCreateMs = std::chrono::duration<double, std::milli>(pipelineEnd - pipelineStart).count();
+    double setupMs = std::chrono::duration<double, std::milli>(pipelineEnd - pipelineStart).count();
     char perfMsg[256];
     snprintf(perfMsg, sizeof(perfMsg),
-        "[SR-PERF] Pipeline overhead: clear2=%.3fms pipeCreate=%.3fms\n",
-        clearMs2, pipeCreateMs);
+        "[SR-PERF] Pipeline overhead: graphSetup=%.3fms\n",
+        setupMs);
     SR_PERF_LOG(perfMsg);
 
     return stats;
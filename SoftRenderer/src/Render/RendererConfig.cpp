@@ -1,5 +1,7 @@
 #include "Render/RendererConfig.h"
 
+#include <algorithm>
+
 namespace SR {
 
 namespace {
@@ -15,6 +17,12 @@ void RendererConfig::Sanitize() {
     openmp.postProcessChunk = ClampChunk(openmp.postProcessChunk);
     openmp.rasterTileChunk = ClampChunk(openmp.rasterTileChunk);
     openmp.drawItemBuildChunk = ClampChunk(openmp.drawItemBuildChunk);
+    shadows.cascadeCount = std::clamp(shadows.cascadeCount, 1, kMaxShadowCascades);
+    shadows.resolution = std::clamp(shadows.resolution, 16, 8192);
+    frameArena.shrinkHeadroom = std::max(frameArena.shrinkHeadroom, 0.0);
+    frameArena.shrinkDelayFrames = std::max(frameArena.shrinkDelayFrames, 1);
+    parallel.jobThreads = std::max(parallel.jobThreads, 0);
+    framesInFlight = std::clamp(framesInFlight, 1, kMaxFramesInFlight);
 }
 
 /**
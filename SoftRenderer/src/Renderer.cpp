@@ -9,12 +9,14 @@
 #include "Render/GPUSceneRenderQueueBuilder.h"
 #include "Render/PassContext.h"
 #include "Render/RenderPipeline.h"
+#include "Pipeline/Rasterizer.h"
 #include "Runtime/GPUScene.h"
 #include "Utils/DebugLog.h"
 
 #include <chrono>
 #include <cstdlib>
 #include <cstdio>
+#include <string>
 #include <omp.h>
 
 #if defined(SR_INTEL_OMP) && defined(_WIN32)
@@ -65,39 +67,257 @@ void LogOpenMPDiagnostics() {
 
 } // namespace
 
+/**
+ * @brief 确保至少有 count 个帧槽（新帧槽按当前分辨率与配置初始化）
+ */
+void Renderer::EnsureSlots(size_t count) {
+    while (m_slots.size() < count) {
+        auto slot = std::make_unique<FrameSlot>();
+        slot->framebuffer.Resize(m_width, m_height);
+        slot->depthBuffer.Resize(m_width, m_height);
+        slot->frameArena.SetOptions(m_config.frameArena);
+        m_slots.push_back(std::move(slot));
+    }
+    if (!m_presentSlot.load(std::memory_order_relaxed)) {
+        m_presentSlot.store(m_slots.front().get(), std::memory_order_release);
+    }
+}
+
+/**
+ * @brief 取得本帧使用的帧槽，等待该帧槽上一帧完成后复用
+ *
+ * 同步帧按帧序号轮换。在后端执行的帧（流水线模式与 RenderAsync）与调用方读取最近完成帧并发，
+ * 因此多保留一个帧槽，并选择最久未用且不是最近完成帧的帧槽：被取消或尚未完成的帧不会破坏
+ * GetFramebuffer 返回的图像。
+ * @param deferred 本帧是否在后端执行
+ */
+FrameSlot& Renderer::AcquireSlot(uint64_t frameId, bool deferred) {
+    const size_t framesInFlight = static_cast<size_t>(m_config.framesInFlight);
+    if (!deferred) {
+        EnsureSlots(framesInFlight);
+        FrameSlot& slot = *m_slots[static_cast<size_t>(frameId % framesInFlight)];
+        m_scheduler.Wait(slot.frameId);
+        slot.frameId = frameId;
+        return slot;
+    }
+
+    EnsureSlots(framesInFlight + 1);
+    for (;;) {
+        const FrameSlot* presented = m_presentSlot.load(std::memory_order_acquire);
+        FrameSlot* candidate = nullptr;
+        for (const auto& slot : m_slots) {
+            if (slot.get() != presented && (!candidate || slot->frameId < candidate->frameId)) {
+                candidate = slot.get();
+            }
+        }
+        // 等待期间候选帧槽的上一帧可能完成并成为最近完成帧，此时改选其它帧槽
+        m_scheduler.Wait(candidate->frameId);
+        if (m_presentSlot.load(std::memory_order_acquire) != candidate) {
+            candidate->frameId = frameId;
+            return *candidate;
+        }
+    }
+}
+
+/**
+ * @brief 按当前配置准备帧槽的管线帧图（配置未变化时为空操作）
+ */
+void Renderer::PreparePipeline(FrameSlot& slot) {
+    FrameGraphSettings settings;
+    settings.enableFXAA = m_config.enableFXAA;
+    settings.enableToneMap = m_config.enableToneMap && !m_useHDR;
+    settings.exposure = m_config.exposure;
+    slot.pipeline.Configure(settings);
+}
+
 /**
  * @brief 清除帧缓冲与深度缓冲
  *
- * HDR 模式下跳过 SDR 颜色清除（线性 HDR 始终清除）。
+ * 只清除帧槽管线帧图判定需要清除的目标：色调映射会完整覆盖 SDR 输出，此时跳过 SDR 清除；
+ * HDR 模式下同样跳过 SDR 颜色清除。
+ * @param forceOutput 本帧不执行管线时强制清除 SDR 输出
  * 深度缓冲初始化为 1.0（最大深度，即远平面值）。
  */
-void Renderer::ClearBuffers() {
-    if (!m_useHDR) {
+void Renderer::ClearBuffers(const FrameSlot& slot, Framebuffer& framebuffer, DepthBuffer& depthBuffer, bool forceOutput) {
+    const FrameResourceMask clearMask = slot.pipeline.GetClearMask();
+    if (!m_useHDR && (forceOutput || (clearMask & FrameResource::Output))) {
         Color clearColor{16, 16, 16, 255};
-        m_framebuffer.Clear(clearColor);
+        framebuffer.Clear(clearColor);
+    }
+    if (clearMask & FrameResource::Color) {
+        framebuffer.ClearLinear(Vec3{0.0, 0.0, 0.0});
+    }
+    if (clearMask & FrameResource::Depth) {
+        depthBuffer.Clear(1.0);
     }
-    m_framebuffer.ClearLinear(Vec3{0.0, 0.0, 0.0});
-    m_depthBuffer.Clear(1.0);
 }
 
 /**
  * @brief 从帧上下文构建渲染 Pass 上下文
  *
- * 将 FrameContext 与帧缓冲、后处理配置打包成 PassContext，
+ * 将 FrameContext 与帧槽的帧缓冲、后处理配置打包成 PassContext，
  * 供 RenderPipeline 执行所有 Pass 时使用。
  * HDR 模式下禁用色调映射（由外部呈现层处理）。
  */
-PassContext Renderer::BuildPassContext(const FrameContext& frame) {
+PassContext Renderer::BuildPassContext(FrameSlot& slot, const FrameContext& frame) {
     PassContext passContext{};
     passContext.frame = frame;
-    passContext.framebuffer = &m_framebuffer;
-    passContext.depthBuffer = &m_depthBuffer;
+    passContext.framebuffer = &slot.framebuffer;
+    passContext.depthBuffer = &slot.depthBuffer;
     passContext.enableFXAA = m_config.enableFXAA;
     passContext.enableToneMap = m_config.enableToneMap && !m_useHDR;
     passContext.exposure = m_config.exposure;
+    passContext.enableTileEpilogue = m_config.enableTileEpilogue;
     return passContext;
 }
 
+/**
+ * @brief 构建本帧的分块局部光源列表并挂到帧上下文
+ *
+ * 无点光 / 聚光时跳过；Tile 网格与 Rasterizer 一致，本帧所有 Pass 共享同一份结果。
+ */
+void Renderer::BuildTiledLights(FrameSlot& slot, FrameContext& frame, int width, int height) {
+    frame.tiledLights = nullptr;
+    if (frame.pointLights.empty() && frame.spotLights.empty()) {
+        return;
+    }
+    LightCuller& lightCuller = slot.lightCuller;
+    lightCuller.Build(frame.pointLights, frame.spotLights, frame.view, frame.projection,
+                      width, height, kRasterTileSize);
+    frame.tiledLights = &lightCuller;
+
+    const size_t tileCount = static_cast<size_t>((width + kRasterTileSize - 1) / kRasterTileSize) *
+                             static_cast<size_t>((height + kRasterTileSize - 1) / kRasterTileSize);
+    char buffer[160];
+    std::snprintf(buffer, sizeof(buffer), "[SR-PERF] LightCull: lights=%zu tileRefs=%zu avgPerTile=%.2f\n",
+                  lightCuller.GetLights().size(), lightCuller.GetReferenceCount(),
+                  tileCount > 0 ? static_cast<double>(lightCuller.GetReferenceCount()) / static_cast<double>(tileCount) : 0.0);
+    SR_PERF_LOG(buffer);
+}
+
+/**
+ * @brief 构建本帧主平行光的级联阴影贴图并挂到帧上下文
+ *
+ * 阴影关闭、没有平行光或没有投射体时不生成（frame.shadowMap 为 nullptr）。
+ * casters 非空时复用已变换到光源空间的投射体，只为当前相机构建级联。
+ */
+void Renderer::BuildShadowMap(FrameSlot& slot, FrameContext& frame, const RenderQueue& queue,
+                              const ShadowCasters* casters) {
+    frame.shadowMap = nullptr;
+    CascadedShadowMap& shadowMap = slot.shadowMap;
+    if (!m_config.shadows.enabled) {
+        shadowMap.Clear();
+        return;
+    }
+    using Clock = std::chrono::high_resolution_clock;
+    auto shadowStart = Clock::now();
+    const bool built = casters ? shadowMap.BuildCascades(*casters, frame, m_config.shadows)
+                               : shadowMap.Build(queue, frame, m_config.shadows);
+    if (!built) {
+        return;
+    }
+    frame.shadowMap = &shadowMap.GetData();
+    const double shadowMs = std::chrono::duration<double, std::milli>(Clock::now() - shadowStart).count();
+
+    const RasterStats& stats = shadowMap.GetRasterStats();
+    char buffer[256];
+    std::snprintf(buffer, sizeof(buffer),
+        "[SR-PERF] ShadowMap: cascades=%d res=%d casters=%zu tri: in=%llu rast=%llu pxTest=%llu ms=%.3f\n",
+        shadowMap.GetData().cascadeCount, shadowMap.GetData().resolution, shadowMap.GetCasterTriangleCount(),
+        static_cast<unsigned long long>(stats.trianglesInput),
+        static_cast<unsigned long long>(stats.trianglesRaster),
+        static_cast<unsigned long long>(stats.pixelsTested), shadowMs);
+    SR_PERF_LOG(buffer);
+}
+
+/**
+ * @brief 执行一帧的后端工作：清除、执行管线、统计与帧级内存复位
+ *
+ * 帧被取消时跳过剩余工作，不更新最近完成帧、不调用渲染器的帧完成回调。
+ */
+CompletedFrame Renderer::ExecuteFrame(FrameSlot& slot, const FrameSubmission& submission, const PassContext& passContext) {
+    using Clock = std::chrono::high_resolution_clock;
+    CompletedFrame frame;
+    frame.frameId = submission.frameId;
+    frame.width = m_width;
+    frame.height = m_height;
+
+    auto clearStart = Clock::now();
+    const std::atomic<bool>* cancel = passContext.frame.cancelRequested;
+    if (!IsCancelRequested(cancel)) {
+        ClearBuffers(slot, slot.framebuffer, slot.depthBuffer, submission.queue == nullptr);
+    }
+    auto clearEnd = Clock::now();
+
+    if (submission.queue) {
+        frame.stats = slot.pipeline.Render(*submission.queue, passContext);
+        auto frameEnd = Clock::now();
+
+        double clearMs = std::chrono::duration<double, std::milli>(clearEnd - clearStart).count();
+        double pipelineMs = std::chrono::duration<double, std::milli>(frameEnd - clearEnd).count();
+        frame.totalMs = submission.setupMs + std::chrono::duration<double, std::milli>(frameEnd - clearStart).count();
+        if (submission.logBreakdown) {
+            double gapMs = pipelineMs - frame.stats.buildMs - frame.stats.rastMs;
+            char gapBuf[256];
+            std::snprintf(gapBuf, sizeof(gapBuf),
+                "[SR-PERF] Frame breakdown: pipeline=%.3fms measured(build+rast)=%.3fms gap=%.3fms (postproc+sky+other)\n",
+                pipelineMs, frame.stats.buildMs + frame.stats.rastMs, gapMs);
+            SR_PERF_LOG(gapBuf);
+        }
+        LogFrameStats(frame.stats, clearMs, submission.setupMs, frame.totalMs, submission.label,
+                      submission.logBreakdown ? submission.queue->GetItems().size() : 0);
+        EndFrameArena(slot);
+    }
+
+    frame.cancelled = IsCancelRequested(cancel);
+    if (frame.cancelled) {
+        return frame;
+    }
+    frame.pixels = slot.framebuffer.GetPixels();
+    frame.linearPixels = slot.framebuffer.GetLinearPixels();
+    m_presentSlot.store(&slot, std::memory_order_release);
+    if (m_frameCallback) {
+        m_frameCallback(frame);
+    }
+    return frame;
+}
+
+/**
+ * @brief 提交一帧的后端工作
+ *
+ * 同步模式（framesInFlight == 1）在调用线程直接完成；流水线模式交给后端线程按序执行，
+ * 帧槽在该帧完成之前不会被前端复用。
+ */
+void Renderer::SubmitFrame(FrameSlot& slot, const FrameSubmission& submission, PassContext passContext) {
+    auto task = [this, &slot, submission, passContext = std::move(passContext)]() {
+        Parallel::ContextScope parallelScope(m_parallel);
+        ExecuteFrame(slot, submission, passContext);
+    };
+    if (m_config.framesInFlight > 1) {
+        m_scheduler.Submit(submission.frameId, std::move(task));
+    } else {
+        m_scheduler.CompleteInline(submission.frameId, task);
+    }
+}
+
+/**
+ * @brief 帧末复位帧槽的帧级临时内存，输出高水位与容量变化
+ */
+void Renderer::EndFrameArena(FrameSlot& slot) {
+    slot.frameArena.EndFrame();
+    const FrameArenaStats& arena = slot.frameArena.GetLastFrameStats();
+    char buffer[256];
+    std::snprintf(buffer, sizeof(buffer),
+        "[SR-PERF] FrameArena: highWater=%.2fMB (shared=%.2fMB maxThread=%.2fMB) reserved=%.2fMB huge=%.2fMB regions=%d grow=%d shrink=%d\n",
+        static_cast<double>(arena.highWaterBytes) / (1024.0 * 1024.0),
+        static_cast<double>(arena.sharedHighWaterBytes) / (1024.0 * 1024.0),
+        static_cast<double>(arena.threadHighWaterBytes) / (1024.0 * 1024.0),
+        static_cast<double>(arena.reservedBytes) / (1024.0 * 1024.0),
+        static_cast<double>(arena.hugePageBytes) / (1024.0 * 1024.0),
+        arena.regionCount, arena.growCount, arena.shrinkCount);
+    SR_PERF_LOG(buffer);
+}
+
 /**
  * @brief 向调试输出输出帧性能统计信息
  *
@@ -129,6 +349,24 @@ void Renderer::LogFrameStats(const RenderStats& stats, double clearMs, double se
     }
     SR_PERF_LOG(buffer);
 
+    std::snprintf(
+        buffer, sizeof(buffer),
+        "%s PreClipCull: backface=%llu degenerate=%llu offscreen=%llu\n",
+        label,
+        static_cast<unsigned long long>(stats.trianglesCulledBackface),
+        static_cast<unsigned long long>(stats.trianglesCulledDegenerate),
+        static_cast<unsigned long long>(stats.trianglesCulledOffscreen));
+    SR_PERF_LOG(buffer);
+
+    // 着色器变体使用情况（按三角形数降序，最多列出 8 个）
+    const std::string permutationList = stats.shaderUsage.Format(8);
+    char permutationBuffer[512];
+    std::snprintf(
+        permutationBuffer, sizeof(permutationBuffer),
+        "%s ShaderPermutations: used=%zu/%zu %s\n",
+        label, stats.shaderUsage.GetUsedCount(), kShaderPermutationCount, permutationList.c_str());
+    SR_PERF_LOG(permutationBuffer);
+
     const char* clipSched = ScheduleName(m_config.openmp.clipSchedule);
     const char* binSched = ScheduleName(m_config.openmp.binCountSchedule);
     const char* clearSched = ScheduleName(m_config.openmp.clearSchedule);
@@ -139,8 +377,10 @@ void Renderer::LogFrameStats(const RenderStats& stats, double clearMs, double se
     char ompBuffer[512];
     std::snprintf(
         ompBuffer, sizeof(ompBuffer),
-        "%s OMP: clip=%s,%d bin=%s,%d clear=%s,%d post=%s,%d build=%s,%d raster=%s,%d legacyBin=%d profiling=%d\n",
+        "%s OMP: backend=%s threads=%d clip=%s,%d bin=%s,%d clear=%s,%d post=%s,%d build=%s,%d raster=%s,%d legacyBin=%d profiling=%d\n",
         label,
+        Parallel::GetBackend() == ParallelBackend::JobSystem ? "jobs" : "openmp",
+        Parallel::MaxThreads(),
         clipSched, m_config.openmp.clipChunk,
         binSched, m_config.openmp.binCountChunk,
         clearSched, m_config.openmp.clearChunk,
@@ -159,10 +399,14 @@ void Renderer::LogFrameStats(const RenderStats& stats, double clearMs, double se
  */
 void Renderer::Initialize(int width, int height) {
     LogOpenMPDiagnostics();
+    Flush();
     m_width = width;
     m_height = height;
-    m_framebuffer.Resize(width, height);
-    m_depthBuffer.Resize(width, height);
+    EnsureSlots(1);
+    for (auto& slot : m_slots) {
+        slot->framebuffer.Resize(width, height);
+        slot->depthBuffer.Resize(width, height);
+    }
 }
 
 /**
@@ -170,6 +414,7 @@ void Renderer::Initialize(int width, int height) {
  * @param enabled true 为启用
  */
 void Renderer::SetHDR(bool enabled) {
+    Flush();
     m_useHDR = enabled;
 }
 
@@ -178,6 +423,7 @@ void Renderer::SetHDR(bool enabled) {
  * @param options 配置参数
  */
 void Renderer::SetFrameContextOptions(const FrameContextOptions& options) {
+    Flush();
     m_config.frameContext = options;
 }
 
@@ -188,18 +434,24 @@ void Renderer::SetFrameContextOptions(const FrameContextOptions& options) {
  * @param exposure 曝光值
  */
 void Renderer::SetPostProcess(bool enableFXAA, bool enableToneMap, double exposure) {
+    Flush();
     m_config.enableFXAA = enableFXAA;
     m_config.enableToneMap = enableToneMap;
     m_config.exposure = exposure;
 }
 
 /**
- * @brief 设置渲染器整体配置
+ * @brief 设置渲染器整体配置（等待在途帧完成后生效）
  * @param config 配置对象
  */
 void Renderer::SetConfig(const RendererConfig& config) {
+    Flush();
     m_config = config;
     m_config.Sanitize();
+    for (auto& slot : m_slots) {
+        slot->frameArena.SetOptions(m_config.frameArena);
+    }
+    m_parallel = Parallel::CreateContext(m_config.parallel);
 }
 
 /**
@@ -212,54 +464,54 @@ const RendererConfig& Renderer::GetConfig() const {
 /**
  * @brief 渲染传统场景
  * @param scene 场景对象
+ * @return 帧序号
  */
-void Renderer::Render(const Scene& scene) {
+uint64_t Renderer::Render(const Scene& scene) {
     using Clock = std::chrono::high_resolution_clock;
-    auto frameStart = Clock::now();
+    WaitForAsyncFrames();
+    Parallel::ContextScope parallelScope(m_parallel);
+    const uint64_t frameId = m_scheduler.NextFrameId();
+    FrameSlot& slot = AcquireSlot(frameId, m_config.framesInFlight > 1);
+    auto setupStart = Clock::now();
+    PreparePipeline(slot);
 
-    ClearBuffers();
-    auto clearEnd = Clock::now();
+    FrameSubmission submission;
+    submission.frameId = frameId;
+    submission.label = "Scene";
 
     const ObjectGroup* objects = scene.GetObjectGroup();
     if (!objects) {
-        return;
+        SubmitFrame(slot, submission, PassContext{});  // 不执行管线，SDR 输出不会被覆盖
+        return frameId;
     }
 
     FrameContextBuilder frameContextBuilder;
     FrameContext frameContext = frameContextBuilder.Build(scene, m_width, m_height, m_config.frameContext);
     frameContext.environmentMap = m_config.environmentMap;
     frameContext.openmp = m_config.openmp;
+    frameContext.frameArena = &slot.frameArena;
+    BuildTiledLights(slot, frameContext, m_width, m_height);
     auto setupEnd = Clock::now();
 
-    RenderQueue renderQueue;
+    RenderQueue& renderQueue = slot.queue;
+    renderQueue.Clear();
     RenderQueueBuilder renderQueueBuilder;
     renderQueueBuilder.Build(*objects, renderQueue);
+    renderQueue.UpdateSortKeys(frameContext.cameraPos);
+    BuildShadowMap(slot, frameContext, renderQueue);
 
-    PassContext passContext = BuildPassContext(frameContext);
-
-    RenderPipeline pipeline;
-    RenderStats stats = pipeline.Render(renderQueue, passContext);
-
-    auto frameEnd = Clock::now();
-
-    double clearMs = std::chrono::duration<double, std::milli>(clearEnd - frameStart).count();
-    double setupMs = std::chrono::duration<double, std::milli>(setupEnd - clearEnd).count();
-    double totalMs = std::chrono::duration<double, std::milli>(frameEnd - frameStart).count();
-
-    LogFrameStats(stats, clearMs, setupMs, totalMs, "Scene");
+    submission.queue = &renderQueue;
+    submission.setupMs = std::chrono::duration<double, std::milli>(setupEnd - setupStart).count();
+    SubmitFrame(slot, submission, BuildPassContext(slot, frameContext));
+    return frameId;
 }
 
 /**
- * @brief 渲染 GPUScene (加速结构场景)
- * @param scene GPUScene 引用
+ * @brief GPUScene 帧的基础帧上下文：相机（配置覆盖或默认值）、光源、环境与场景资源
+ * @param cancel 可选取消标志（写入帧上下文，供后端各阶段检查）
  */
-void Renderer::Render(const GPUScene& scene) {
-    using Clock = std::chrono::high_resolution_clock;
-    auto frameStart = Clock::now();
-
-    ClearBuffers();
-    auto clearEnd = Clock::now();
-
+FrameContext Renderer::BuildSceneFrameContext(FrameSlot& slot, const GPUScene& scene,
+                                              const std::atomic<bool>* cancel) const {
     FrameContext frameContext{};
     const FrameContextOptions& options = m_config.frameContext;
     frameContext.view = m_config.useViewOverride ? m_config.viewOverride : Mat4::Identity();
@@ -269,58 +521,240 @@ void Renderer::Render(const GPUScene& scene) {
     frameContext.ambientColor = options.ambientColor;
     frameContext.environmentMap = m_config.environmentMap;
     frameContext.openmp = m_config.openmp;
+    frameContext.frameArena = &slot.frameArena;
+    frameContext.cancelRequested = cancel;
     frameContext.images = &scene.GetImages();
     frameContext.samplers = &scene.GetSamplers();
-    DirectionalLight defaultLight;
-    defaultLight.direction = options.defaultLightDirection;
-    defaultLight.color = options.defaultLightColor;
-    defaultLight.intensity = options.defaultLightIntensity;
-    frameContext.lights.push_back(defaultLight);
-    RenderQueue renderQueue;
-    GPUSceneRenderQueueBuilder queueBuilder;
-    queueBuilder.Build(scene, renderQueue, m_config.debugOnlyMaterialIndex);
+    frameContext.preparedTextures = &scene.GetPreparedTextures();
+    FrameContextBuilder().ApplyLights(&scene.GetLights(), options, frameContext);
+    return frameContext;
+}
+
+/**
+ * @brief GPUScene 帧的前端准备：帧上下文、分块光源、持久队列同步与排序、阴影贴图
+ *
+ * 流水线模式下后端读取的是持久队列的快照，前端可以立即为下一帧同步队列。
+ * @param cancel 可选取消标志（写入帧上下文，供后端各阶段检查）
+ */
+PassContext Renderer::PrepareFrame(FrameSlot& slot, const GPUScene& scene, const std::atomic<bool>* cancel,
+                                   FrameSubmission& submission) {
+    using Clock = std::chrono::high_resolution_clock;
+    auto setupStart = Clock::now();
+    PreparePipeline(slot);
+
+    FrameContext frameContext = BuildSceneFrameContext(slot, scene, cancel);
+    BuildTiledLights(slot, frameContext, m_width, m_height);
+    // 持久渲染队列：仅在场景变更时同步 DrawItem，排序键变化时才重新排序
+    const bool queueSynced = m_gpuSceneQueueBuilder.Update(scene, m_gpuSceneQueue, m_config.debugOnlyMaterialIndex);
+    const bool queueSorted = m_gpuSceneQueue.UpdateSortKeys(frameContext.cameraPos);
+    const RenderQueue* renderQueue = &m_gpuSceneQueue;
+    if (m_config.framesInFlight > 1) {
+        // 后端只读取绘制项与排序结果，快照仅复制该帧槽上次快照以来变化的部分
+        slot.queue.SnapshotFrom(m_gpuSceneQueue);
+        renderQueue = &slot.queue;
+    }
+    BuildShadowMap(slot, frameContext, *renderQueue);
     auto setupEnd = Clock::now();
 
-    PassContext passContext = BuildPassContext(frameContext);
+    char queueBuf[160];
+    std::snprintf(queueBuf, sizeof(queueBuf),
+        "[SR-PERF] RenderQueue: items=%zu synced=%d sorted=%d sortCount=%llu\n",
+        renderQueue->GetItems().size(), queueSynced ? 1 : 0, queueSorted ? 1 : 0,
+        static_cast<unsigned long long>(renderQueue->GetSortCount()));
+    SR_PERF_LOG(queueBuf);
+
+    submission.label = "GPUScene";
+    submission.queue = renderQueue;
+    submission.setupMs = std::chrono::duration<double, std::milli>(setupEnd - setupStart).count();
+    submission.logBreakdown = true;
+    return BuildPassContext(slot, frameContext);
+}
 
-    RenderPipeline pipeline;
-    SR_DEBUG_LOG("GPUScene Render: before pipeline\n");
-    auto pipelineStart = Clock::now();
-    RenderStats stats = pipeline.Render(renderQueue, passContext);
-    auto pipelineEnd = Clock::now();
-    SR_DEBUG_LOG("GPUScene Render: after pipeline\n");
-    auto frameEnd = Clock::now();
+/**
+ * @brief 渲染 GPUScene (加速结构场景)
+ * @param scene GPUScene 引用（在返回的帧完成之前须保持不变）
+ * @return 帧序号
+ */
+uint64_t Renderer::Render(const GPUScene& scene) {
+    WaitForAsyncFrames();
+    Parallel::ContextScope parallelScope(m_parallel);
+    FrameSubmission submission;
+    submission.frameId = m_scheduler.NextFrameId();
+    FrameSlot& slot = AcquireSlot(submission.frameId, m_config.framesInFlight > 1);
+    PassContext passContext = PrepareFrame(slot, scene, nullptr, submission);
+    SubmitFrame(slot, submission, std::move(passContext));
+    return submission.frameId;
+}
+
+/**
+ * @brief 异步渲染 GPUScene：整帧（含前端准备）在后端线程执行，调用方立即返回
+ *
+ * 异步帧与之前提交的帧按序执行；取消后在 Pass / Tile 之间尽快放弃，排队中的帧直接跳过。
+ * @param scene GPUScene 引用（在返回的帧结束之前须保持存活且不变）
+ * @return 帧句柄
+ */
+FrameFuture Renderer::RenderAsync(const GPUScene& scene) {
+    const uint64_t frameId = m_scheduler.NextFrameId();
+    FrameFuture future = FrameFuture::Create(frameId);
+    m_lastAsyncFrameId = frameId;
+    m_scheduler.Submit(frameId, [this, &scene, future]() mutable {
+        Parallel::ContextScope parallelScope(m_parallel);
+        const std::atomic<bool>* cancel = future.GetCancelFlag();
+        if (IsCancelRequested(cancel)) {
+            CompletedFrame frame;
+            frame.frameId = future.GetFrameId();
+            frame.cancelled = true;
+            future.Finish(frame);
+            return;
+        }
+        FrameSubmission submission;
+        submission.frameId = future.GetFrameId();
+        FrameSlot& slot = AcquireSlot(submission.frameId, true);
+        PassContext passContext = PrepareFrame(slot, scene, cancel, submission);
+        future.Finish(ExecuteFrame(slot, submission, passContext));
+    });
+    return future;
+}
+
+/**
+ * @brief 从多个视点渲染 GPUScene
+ *
+ * 持久队列同步与排序（按首个视图）、材质注册、世界空间几何构建（MultiViewGeometry）和
+ * 阴影投射体的光源空间变换只做一次；各视图依次执行分块光源、阴影级联、清除与管线，
+ * OpaquePass 只做该视图的裁剪空间变换与剔除。
+ * 视图的临时数据在该视图结束时回滚，帧级内存在所有视图完成后复位。
+ * 本调用同步完成：不更新最近完成帧，也不触发帧完成回调。
+ * @param scene GPUScene 引用
+ * @param views 视图列表（目标帧缓冲在调用期间须保持存活）
+ * @return 帧序号
+ */
+uint64_t Renderer::RenderViews(const GPUScene& scene, std::span<const RenderView> views) {
+    WaitForAsyncFrames();
+    Parallel::ContextScope parallelScope(m_parallel);
+    const uint64_t frameId = m_scheduler.NextFrameId();
+    FrameSlot& slot = AcquireSlot(frameId, false);
+    m_scheduler.CompleteInline(frameId, [this, &slot, &scene, views]() {
+        using Clock = std::chrono::high_resolution_clock;
+        auto frameStart = Clock::now();
+        PreparePipeline(slot);
+
+        const FrameContext baseFrame = BuildSceneFrameContext(slot, scene, nullptr);
+        const Vec3 sortOrigin = views.empty() ? baseFrame.cameraPos : views.front().cameraPos;
+        m_gpuSceneQueueBuilder.Update(scene, m_gpuSceneQueue, m_config.debugOnlyMaterialIndex);
+        m_gpuSceneQueue.UpdateSortKeys(sortOrigin);
+        MultiViewGeometry& geometry = slot.multiViewGeometry;
+        geometry.Build(m_gpuSceneQueue, baseFrame, slot.frameArena);
+        // 投射体的光源空间变换与相机无关：所有视图之前做一次，各视图只拟合级联并光栅化
+        ShadowCasters shadowCasters;
+        if (m_config.shadows.enabled) {
+            CascadedShadowMap::PrepareCasters(m_gpuSceneQueue, baseFrame, m_config.shadows, slot.frameArena, shadowCasters);
+        }
+
+        int viewCount = 0;
+        for (const RenderView& view : views) {
+            if (!view.target || view.target->GetWidth() <= 0 || view.target->GetHeight() <= 0) {
+                continue;
+            }
+            FrameArena::Scope viewScope(slot.frameArena);
+            auto viewStart = Clock::now();
+            Framebuffer& target = *view.target;
+            const int width = target.GetWidth();
+            const int height = target.GetHeight();
+
+            FrameContext frameContext = baseFrame;
+            frameContext.view = view.view;
+            frameContext.projection = view.projection;
+            frameContext.cameraPos = view.cameraPos;
+            BuildTiledLights(slot, frameContext, width, height);
+            BuildShadowMap(slot, frameContext, m_gpuSceneQueue, &shadowCasters);
+
+            DepthBuffer& depthBuffer = slot.viewDepthBuffer;
+            if (depthBuffer.GetWidth() != width || depthBuffer.GetHeight() != height) {
+                depthBuffer.Resize(width, height);
+            }
+            auto clearStart = Clock::now();
+            ClearBuffers(slot, target, depthBuffer);
+            auto clearEnd = Clock::now();
+
+            PassContext passContext = BuildPassContext(slot, frameContext);
+            passContext.framebuffer = &target;
+            passContext.depthBuffer = &depthBuffer;
+            passContext.multiViewGeometry = &geometry;
+            const RenderStats stats = slot.pipeline.Render(m_gpuSceneQueue, passContext);
+            auto viewEnd = Clock::now();
+
+            LogFrameStats(stats,
+                          std::chrono::duration<double, std::milli>(clearEnd - clearStart).count(),
+                          std::chrono::duration<double, std::milli>(clearStart - viewStart).count(),
+                          std::chrono::duration<double, std::milli>(viewEnd - viewStart).count(),
+                          "MultiView");
+            ++viewCount;
+        }
+
+        char buffer[192];
+        std::snprintf(buffer, sizeof(buffer),
+            "[SR-PERF] MultiView: views=%d sharedBuild=%.3fms opaqueT=%zu blendT=%zu total=%.3fms\n",
+            viewCount, geometry.GetBuildMs(), geometry.GetOpaqueCount(), geometry.GetBlendCount(),
+            std::chrono::duration<double, std::milli>(Clock::now() - frameStart).count());
+        SR_PERF_LOG(buffer);
+        EndFrameArena(slot);
+    });
+    return frameId;
+}
+
+/**
+ * @brief 等待已提交的异步帧结束（异步帧的前端准备在后端线程执行，与调用线程共享持久队列与帧槽）
+ */
+void Renderer::WaitForAsyncFrames() {
+    m_scheduler.Wait(m_lastAsyncFrameId);
+}
 
-    double clearMs = std::chrono::duration<double, std::milli>(clearEnd - frameStart).count();
-    double setupMs = std::chrono::duration<double, std::milli>(setupEnd - clearEnd).count();
-    double pipelineMs = std::chrono::duration<double, std::milli>(pipelineEnd - pipelineStart).count();
-    double totalMs = std::chrono::duration<double, std::milli>(frameEnd - frameStart).count();
-    double unmeasuredMs = totalMs - clearMs - setupMs;
-    double gapMs = unmeasuredMs - stats.buildMs - stats.rastMs;
+/**
+ * @brief 帧是否已完成
+ */
+bool Renderer::IsFrameComplete(uint64_t frameId) const {
+    return m_scheduler.IsComplete(frameId);
+}
+
+/**
+ * @brief 阻塞直到帧完成
+ */
+void Renderer::WaitForFrame(uint64_t frameId) const {
+    m_scheduler.Wait(frameId);
+}
 
-    char gapBuf[256];
-    std::snprintf(gapBuf, sizeof(gapBuf),
-        "[SR-PERF] Frame breakdown: pipeline=%.3fms measured(build+rast)=%.3fms gap=%.3fms (postproc+sky+clear2+other)\n",
-        pipelineMs, stats.buildMs + stats.rastMs, gapMs);
-    SR_PERF_LOG(gapBuf);
+/**
+ * @brief 阻塞直到所有在途帧完成
+ */
+void Renderer::Flush() {
+    m_scheduler.WaitIdle();
+}
 
-    LogFrameStats(stats, clearMs, setupMs, totalMs, "GPUScene", renderQueue.GetItems().size());
+/**
+ * @brief 设置帧完成回调
+ * @param callback 回调（流水线模式下在后端线程调用）
+ */
+void Renderer::SetFrameCallback(FrameCallback callback) {
+    Flush();
+    m_frameCallback = std::move(callback);
 }
 
 /**
- * @brief 获取 SDR 帧缓冲像素数据
+ * @brief 获取最近完成帧的 SDR 帧缓冲像素数据
  * @return 指向像素数组的指针
  */
 const uint32_t* Renderer::GetFramebuffer() const {
-    return m_framebuffer.GetPixels();
+    const FrameSlot* slot = m_presentSlot.load(std::memory_order_acquire);
+    return slot ? slot->framebuffer.GetPixels() : nullptr;
 }
 
 /**
- * @brief 获取线性 HDR 帧缓冲像素数据
+ * @brief 获取最近完成帧的线性 HDR 帧缓冲像素数据
  * @return 指向线性颜色数组的指针
  */
 const Vec3* Renderer::GetFramebufferLinear() const {
-    return m_framebuffer.GetLinearPixels();
+    const FrameSlot* slot = m_presentSlot.load(std::memory_order_acquire);
+    return slot ? slot->framebuffer.GetLinearPixels() : nullptr;
 }
 
 /**
@@ -337,4 +771,13 @@ int Renderer::GetHeight() const {
     return m_height;
 }
 
+/**
+ * @brief 获取最近完成帧的帧级临时内存统计
+ */
+const FrameArenaStats& Renderer::GetFrameArenaStats() const {
+    static const FrameArenaStats kEmptyStats{};
+    const FrameSlot* slot = m_presentSlot.load(std::memory_order_acquire);
+    return slot ? slot->frameArena.GetLastFrameStats() : kEmptyStats;
+}
+
 } // namespace SR
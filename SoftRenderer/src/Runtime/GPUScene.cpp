@@ -1,6 +1,7 @@
 #include "Runtime/GPUScene.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <utility>
 #include <chrono>
@@ -14,6 +15,17 @@
 
 namespace SR {
 
+namespace {
+
+/// 全局版本计数：保证不同 GPUScene 实例的版本号互不重复
+std::atomic<uint64_t> g_sceneRevisionCounter{0};
+
+uint64_t NextSceneRevision() {
+	return g_sceneRevisionCounter.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+} // namespace
+
 /** @brief 预留容量 */
 void GPUScene::Reserve(size_t count) {
 	m_items.reserve(count);
@@ -22,20 +34,28 @@ void GPUScene::Reserve(size_t count) {
 /** @brief 添加渲染项 */
 void GPUScene::AddDrawable(const GPUSceneDrawItem& item) {
 	m_items.push_back(item);
+	m_revision = NextSceneRevision();
 }
 
 /** @brief 批量设置渲染项 */
 void GPUScene::SetItems(std::vector<GPUSceneDrawItem>&& items) {
 	m_items = std::move(items);
+	m_revision = NextSceneRevision();
+	m_layoutRevision = m_revision;
 }
 
 /** @brief 清空场景 */
 void GPUScene::Clear() {
+	m_revision = NextSceneRevision();
+	m_layoutRevision = m_revision;
 	m_items.clear();
+	m_instancedItems.clear();
 	m_ownedMeshes.clear();
 	m_ownedMaterials.clear();
 	m_ownedImages.clear();
 	m_ownedSamplers.clear();
+	m_preparedTextures.Clear();
+	m_lights.Clear();
 	// 同步清空 ResourcePool（网格池和材质池）
 	m_meshPool.Clear();
 	m_materialPool.Clear();
@@ -46,6 +66,36 @@ const std::vector<GPUSceneDrawItem>& GPUScene::GetItems() const {
 	return m_items;
 }
 
+/** @brief 添加实例化渲染项 */
+void GPUScene::AddInstancedDrawable(GPUSceneInstancedDrawItem item) {
+	m_instancedItems.push_back(std::move(item));
+	m_revision = NextSceneRevision();
+}
+
+/** @brief 获取实例化渲染项 */
+const std::vector<GPUSceneInstancedDrawItem>& GPUScene::GetInstancedItems() const {
+	return m_instancedItems;
+}
+
+/** @brief 内容版本 */
+uint64_t GPUScene::GetRevision() const {
+	return m_revision;
+}
+
+/** @brief 非追加式变更版本 */
+uint64_t GPUScene::GetLayoutRevision() const {
+	return m_layoutRevision;
+}
+
+/** @brief 统计所有实例化渲染项的实例总数 */
+size_t GPUScene::GetInstanceCount() const {
+	size_t total = 0;
+	for (const auto& item : m_instancedItems) {
+		total += item.instances.size();
+	}
+	return total;
+}
+
 /** @brief 获取所有图像资源 */
 const std::vector<GLTFImage>& GPUScene::GetImages() const {
 	return m_ownedImages;
@@ -56,6 +106,16 @@ const std::vector<GLTFSampler>& GPUScene::GetSamplers() const {
 	return m_ownedSamplers;
 }
 
+/** @brief 获取采样就绪纹理 */
+const PreparedTextureSet& GPUScene::GetPreparedTextures() const {
+	return m_preparedTextures;
+}
+
+/** @brief 获取场景光源 */
+const LightGroup& GPUScene::GetLights() const {
+	return m_lights;
+}
+
 namespace {
 
 /**
@@ -112,6 +172,48 @@ void ApplyZFlip(Mat4& matrix) {
 	matrix = flip * matrix * flip;
 }
 
+/**
+ * @brief 将 KHR_lights_punctual 光源按节点世界矩阵加入光源组
+ *
+ * 光源位于节点原点、沿局部 -Z 发光；Z 翻转后局部 -Z 对应引擎空间 +Z，即世界矩阵第 2 行。
+ */
+void AddPunctualLight(LightGroup& lights, const GLTFLight& light, const Mat4& world) {
+	const Vec3 color{light.color[0], light.color[1], light.color[2]};
+	const Vec3 position{world.m[3][0], world.m[3][1], world.m[3][2]};
+	const Vec3 direction = Vec3{world.m[2][0], world.m[2][1], world.m[2][2]}.Normalized();
+	switch (light.type) {
+	case GLTFLightType::Directional: {
+		DirectionalLight directional;
+		directional.direction = direction;
+		directional.color = color;
+		directional.intensity = light.intensity;
+		lights.AddDirectionalLight(directional);
+		break;
+	}
+	case GLTFLightType::Spot: {
+		SpotLight spot;
+		spot.position = position;
+		spot.direction = direction;
+		spot.color = color;
+		spot.intensity = light.intensity;
+		spot.range = light.range;
+		spot.innerConeAngle = light.innerConeAngle;
+		spot.outerConeAngle = light.outerConeAngle;
+		lights.AddSpotLight(spot);
+		break;
+	}
+	default: {
+		PointLight point;
+		point.position = position;
+		point.color = color;
+		point.intensity = light.intensity;
+		point.range = light.range;
+		lights.AddPointLight(point);
+		break;
+	}
+	}
+}
+
 Mat4 ComputeNormalMatrix(const Mat4& modelMatrix) {
 	double m00 = modelMatrix.m[0][0];
 	double m01 = modelMatrix.m[0][1];
@@ -170,6 +272,20 @@ struct PrimitiveMeshes {
 	std::vector<size_t> meshIndices;
 };
 
+/// 同一网格槽位收集到的全部实例（遍历场景图后再决定是否合并为实例化渲染项）
+struct SlotInstances {
+	int meshIndex = -1;
+	int primitiveIndex = -1;
+	int materialIndex = -1;
+	size_t ownedMaterialIndex = 0;
+	TextureBindingArray textures{};
+	bool fromExtension = false;
+	std::vector<InstanceTransform> instances;
+};
+
+/// 合并为实例化渲染项所需的最少实例数
+constexpr size_t kMinInstanceCount = 2;
+
 } // namespace
 
 /**
@@ -177,7 +293,7 @@ struct PrimitiveMeshes {
  * @param asset 加载完成的资产
  * @param sceneIndex 要构建的场景索引
  */
-void GPUScene::Build(const GLTFAsset& asset, int sceneIndex) {
+void GPUScene::Build(const GLTFAsset& asset, int sceneIndex, const GPUSceneBuildOptions& options) {
 	using Clock = std::chrono::high_resolution_clock;
 	auto t0 = Clock::now();
 	Clear();
@@ -188,8 +304,12 @@ void GPUScene::Build(const GLTFAsset& asset, int sceneIndex) {
 	double totalAccessorReadMs = 0.0;
 	double totalNormalsMs = 0.0;
 	double totalTangentsMs = 0.0;
+	double totalPackMs = 0.0;
+	double totalOptimizeMs = 0.0;
+	MeshOptimizeStats optimizeTotals;
 	size_t normalGenCount = 0;
 	size_t tangentGenCount = 0;
+	size_t sourceVertexBytes = 0;
 
 	m_ownedImages = asset.images;
 	m_ownedSamplers = asset.samplers;
@@ -395,6 +515,34 @@ void GPUScene::Build(const GLTFAsset& asset, int sceneIndex) {
 				totalTangentsMs += std::chrono::duration<double, std::milli>(tTanEnd - tTanStart).count();
 				tangentGenCount++;
 			}
+			if (options.optimizeMeshes) {
+				// 加载期网格优化：Tipsify 顶点缓存排序 + overdraw 簇排序 + 顶点读取重映射
+				MeshOptimizeOptions optimizeOptions = options.optimizeOptions;
+				if (optimizeOptions.fetchStride == 0 && options.packVertices) {
+					optimizeOptions.fetchStride = sizeof(PackedVertex);
+				}
+				auto tOptStart = Clock::now();
+				MeshOptimizeStats meshStats = outMesh.Optimize(optimizeOptions);
+				auto tOptEnd = Clock::now();
+				totalOptimizeMs += std::chrono::duration<double, std::milli>(tOptEnd - tOptStart).count();
+
+				// 按三角形数加权汇总
+				const double weight = static_cast<double>(meshStats.triangleCount);
+				optimizeTotals.acmrBefore += meshStats.acmrBefore * weight;
+				optimizeTotals.acmrAfter += meshStats.acmrAfter * weight;
+				optimizeTotals.overfetchBefore += meshStats.overfetchBefore * weight;
+				optimizeTotals.overfetchAfter += meshStats.overfetchAfter * weight;
+				optimizeTotals.triangleCount += meshStats.triangleCount;
+				optimizeTotals.clusterCount += meshStats.clusterCount;
+			}
+			sourceVertexBytes += outMesh.GetVertexMemory();
+			if (options.packVertices) {
+				// 打包顶点：八面体法线/切线 + half UV + RGBA8 颜色，解码在顶点阶段完成
+				auto tPackStart = Clock::now();
+				outMesh.Pack(options.positionFormat, options.releaseSourceVertices);
+				auto tPackEnd = Clock::now();
+				totalPackMs += std::chrono::duration<double, std::milli>(tPackEnd - tPackStart).count();
+			}
 
 			m_ownedMeshes.push_back(std::move(outMesh));
 			primMeshes.meshIndices.push_back(m_ownedMeshes.size() - 1);
@@ -403,6 +551,72 @@ void GPUScene::Build(const GLTFAsset& asset, int sceneIndex) {
 		meshPrimitiveTable[meshIndex] = std::move(primMeshes);
 	}
 
+	auto buildTextureBindings = [&](const GLTFPrimitive& prim) {
+		TextureBindingArray textures{};
+		if (prim.materialIndex >= 0 && prim.materialIndex < static_cast<int>(asset.materials.size())) {
+			const GLTFMaterial& gltfMat = asset.materials[prim.materialIndex];
+			textures[static_cast<size_t>(TextureSlot::BaseColor)].textureIndex = gltfMat.pbr.baseColorTexture.textureIndex;
+			textures[static_cast<size_t>(TextureSlot::MetallicRoughness)].textureIndex = gltfMat.pbr.metallicRoughnessTexture.textureIndex;
+			textures[static_cast<size_t>(TextureSlot::Normal)].textureIndex = gltfMat.normalTexture.textureIndex;
+			textures[static_cast<size_t>(TextureSlot::Occlusion)].textureIndex = gltfMat.occlusionTexture.textureIndex;
+			textures[static_cast<size_t>(TextureSlot::Emissive)].textureIndex = gltfMat.emissiveTexture.textureIndex;
+			textures[static_cast<size_t>(TextureSlot::BaseColor)].texCoordSet = gltfMat.pbr.baseColorTexture.texCoord;
+			textures[static_cast<size_t>(TextureSlot::MetallicRoughness)].texCoordSet = gltfMat.pbr.metallicRoughnessTexture.texCoord;
+			textures[static_cast<size_t>(TextureSlot::Normal)].texCoordSet = gltfMat.normalTexture.texCoord;
+			textures[static_cast<size_t>(TextureSlot::Occlusion)].texCoordSet = gltfMat.occlusionTexture.texCoord;
+			textures[static_cast<size_t>(TextureSlot::Emissive)].texCoordSet = gltfMat.emissiveTexture.texCoord;
+			if (gltfMat.transmission.hasTransmission) {
+				textures[static_cast<size_t>(TextureSlot::Transmission)].textureIndex = gltfMat.transmission.transmissionTexture.textureIndex;
+				textures[static_cast<size_t>(TextureSlot::Transmission)].texCoordSet = gltfMat.transmission.transmissionTexture.texCoord;
+			}
+		}
+		auto resolveTexture = [&](TextureBinding& binding) {
+			int textureIndex = binding.textureIndex;
+			if (textureIndex < 0 || textureIndex >= static_cast<int>(asset.textures.size())) {
+				return;
+			}
+			const GLTFTexture& tex = asset.textures[textureIndex];
+			binding.imageIndex = tex.imageIndex;
+			binding.samplerIndex = tex.samplerIndex;
+		};
+		for (size_t i = 0; i < textures.size(); ++i) {
+			resolveTexture(textures[i]);
+		}
+		return textures;
+	};
+
+	// EXT_mesh_gpu_instancing：读取节点的逐实例局部变换（已做 Z 翻转）
+	auto readExtensionInstances = [&](const GLTFNode& node) {
+		std::vector<Mat4> locals;
+		auto readVec3 = [&](int accessorIndex) {
+			if (accessorIndex < 0 || accessorIndex >= static_cast<int>(asset.accessors.size())) {
+				return std::vector<Vec3>{};
+			}
+			return accessor.Read<Vec3>(asset, asset.accessors[accessorIndex]);
+		};
+		std::vector<Vec3> translations = readVec3(node.instancing.translationAccessor);
+		std::vector<Vec3> scales = readVec3(node.instancing.scaleAccessor);
+		std::vector<Vec4> rotations;
+		int rotAccessor = node.instancing.rotationAccessor;
+		if (rotAccessor >= 0 && rotAccessor < static_cast<int>(asset.accessors.size())) {
+			rotations = accessor.Read<Vec4>(asset, asset.accessors[rotAccessor]);
+		}
+		size_t count = std::max({translations.size(), rotations.size(), scales.size()});
+		locals.reserve(count);
+		for (size_t i = 0; i < count; ++i) {
+			Vec3 t = i < translations.size() ? translations[i] : Vec3{0.0, 0.0, 0.0};
+			Vec4 r = i < rotations.size() ? rotations[i] : Vec4{0.0, 0.0, 0.0, 1.0};
+			Vec3 sc = i < scales.size() ? scales[i] : Vec3{1.0, 1.0, 1.0};
+			Mat4 local = Mat4::Scale(sc.x, sc.y, sc.z) * QuaternionToMat4(r.x, r.y, r.z, r.w) * Mat4::Translation(t.x, t.y, t.z);
+			ApplyZFlip(local);
+			locals.push_back(local);
+		}
+		return locals;
+	};
+
+	// 先按网格槽位收集实例，场景图遍历结束后再决定实例化或逐节点提交
+	std::vector<SlotInstances> slotInstances(m_ownedMeshes.size());
+
 	auto addNode = [&](auto&& self, int nodeIndex, const Mat4& parentMatrix) -> void {
 		if (nodeIndex < 0 || nodeIndex >= static_cast<int>(asset.nodes.size())) {
 			return;
@@ -412,61 +626,50 @@ void GPUScene::Build(const GLTFAsset& asset, int sceneIndex) {
 		ApplyZFlip(local);
 		Mat4 world = local * parentMatrix;
 
+		if (node.lightIndex >= 0 && node.lightIndex < static_cast<int>(asset.lights.size())) {
+			AddPunctualLight(m_lights, asset.lights[static_cast<size_t>(node.lightIndex)], world);
+		}
+
 		if (node.meshIndex >= 0 && node.meshIndex < static_cast<int>(asset.meshes.size())) {
 			const PrimitiveMeshes& primMeshes = meshPrimitiveTable[node.meshIndex];
 			const GLTFMesh& mesh = asset.meshes[node.meshIndex];
+
+			std::vector<Mat4> instanceWorlds;
+			if (node.instancing.hasInstancing) {
+				instanceWorlds = readExtensionInstances(node);
+				for (Mat4& instanceWorld : instanceWorlds) {
+					instanceWorld = instanceWorld * world;
+				}
+			} else {
+				instanceWorlds.push_back(world);
+			}
+
 			for (size_t primIndex = 0; primIndex < mesh.primitives.size(); ++primIndex) {
 				size_t meshSlot = primMeshes.meshIndices[primIndex];
 				if (meshSlot == static_cast<size_t>(-1) || meshSlot >= m_ownedMeshes.size()) {
 					continue;
 				}
 				const GLTFPrimitive& prim = mesh.primitives[primIndex];
-				size_t matIndex = defaultMaterialIndex;
-				if (prim.materialIndex >= 0 && prim.materialIndex < static_cast<int>(m_ownedMaterials.size())) {
-					matIndex = static_cast<size_t>(prim.materialIndex);
-				}
-				TextureBindingArray textures{};
-				if (prim.materialIndex >= 0 && prim.materialIndex < static_cast<int>(asset.materials.size())) {
-					const GLTFMaterial& gltfMat = asset.materials[prim.materialIndex];
-					textures[static_cast<size_t>(TextureSlot::BaseColor)].textureIndex = gltfMat.pbr.baseColorTexture.textureIndex;
-					textures[static_cast<size_t>(TextureSlot::MetallicRoughness)].textureIndex = gltfMat.pbr.metallicRoughnessTexture.textureIndex;
-					textures[static_cast<size_t>(TextureSlot::Normal)].textureIndex = gltfMat.normalTexture.textureIndex;
-					textures[static_cast<size_t>(TextureSlot::Occlusion)].textureIndex = gltfMat.occlusionTexture.textureIndex;
-					textures[static_cast<size_t>(TextureSlot::Emissive)].textureIndex = gltfMat.emissiveTexture.textureIndex;
-					textures[static_cast<size_t>(TextureSlot::BaseColor)].texCoordSet = gltfMat.pbr.baseColorTexture.texCoord;
-					textures[static_cast<size_t>(TextureSlot::MetallicRoughness)].texCoordSet = gltfMat.pbr.metallicRoughnessTexture.texCoord;
-					textures[static_cast<size_t>(TextureSlot::Normal)].texCoordSet = gltfMat.normalTexture.texCoord;
-					textures[static_cast<size_t>(TextureSlot::Occlusion)].texCoordSet = gltfMat.occlusionTexture.texCoord;
-					textures[static_cast<size_t>(TextureSlot::Emissive)].texCoordSet = gltfMat.emissiveTexture.texCoord;
-					if (gltfMat.transmission.hasTransmission) {
-						textures[static_cast<size_t>(TextureSlot::Transmission)].textureIndex = gltfMat.transmission.transmissionTexture.textureIndex;
-						textures[static_cast<size_t>(TextureSlot::Transmission)].texCoordSet = gltfMat.transmission.transmissionTexture.texCoord;
+				SlotInstances& slot = slotInstances[meshSlot];
+				if (slot.meshIndex < 0) {
+					size_t matIndex = defaultMaterialIndex;
+					if (prim.materialIndex >= 0 && prim.materialIndex < static_cast<int>(m_ownedMaterials.size())) {
+						matIndex = static_cast<size_t>(prim.materialIndex);
 					}
+					slot.meshIndex = node.meshIndex;
+					slot.primitiveIndex = static_cast<int>(primIndex);
+					slot.materialIndex = prim.materialIndex;
+					slot.ownedMaterialIndex = matIndex;
+					slot.textures = buildTextureBindings(prim);
 				}
-				auto resolveTexture = [&](TextureBinding& binding) {
-					int textureIndex = binding.textureIndex;
-					if (textureIndex < 0 || textureIndex >= static_cast<int>(asset.textures.size())) {
-						return;
-					}
-					const GLTFTexture& tex = asset.textures[textureIndex];
-					binding.imageIndex = tex.imageIndex;
-					binding.samplerIndex = tex.samplerIndex;
-				};
-				for (size_t i = 0; i < textures.size(); ++i) {
-					resolveTexture(textures[i]);
+				slot.fromExtension = slot.fromExtension || node.instancing.hasInstancing;
+				for (const Mat4& instanceWorld : instanceWorlds) {
+					InstanceTransform instance;
+					instance.modelMatrix = instanceWorld;
+					instance.normalMatrix = ComputeNormalMatrix(instanceWorld);
+					instance.nodeIndex = nodeIndex;
+					slot.instances.push_back(instance);
 				}
-
-				GPUSceneDrawItem item{};
-				item.mesh = &m_ownedMeshes[meshSlot];
-				item.material = &m_ownedMaterials[matIndex];
-				item.modelMatrix = world;
-				item.normalMatrix = ComputeNormalMatrix(world);
-				item.meshIndex = node.meshIndex;
-				item.materialIndex = prim.materialIndex;
-				item.primitiveIndex = static_cast<int>(primIndex);
-				item.nodeIndex = nodeIndex;
-				item.textures = textures;
-				AddDrawable(item);
 			}
 		}
 
@@ -475,6 +678,44 @@ void GPUScene::Build(const GLTFAsset& asset, int sceneIndex) {
 		}
 	};
 
+	// 同一网格被多次引用时合并为实例化渲染项；半透明材质需逐物体按深度排序，
+	// 因此仅在显式声明 EXT_mesh_gpu_instancing 时才对其合批。
+	auto emitSlotInstances = [&]() {
+		for (size_t meshSlot = 0; meshSlot < slotInstances.size(); ++meshSlot) {
+			SlotInstances& slot = slotInstances[meshSlot];
+			if (slot.instances.empty()) {
+				continue;
+			}
+			const PBRMaterial* material = &m_ownedMaterials[slot.ownedMaterialIndex];
+			bool allowInstancing = slot.fromExtension || material->alphaMode != GLTFAlphaMode::Blend;
+			if (allowInstancing && slot.instances.size() >= kMinInstanceCount) {
+				GPUSceneInstancedDrawItem item{};
+				item.mesh = &m_ownedMeshes[meshSlot];
+				item.material = material;
+				item.meshIndex = slot.meshIndex;
+				item.materialIndex = slot.materialIndex;
+				item.primitiveIndex = slot.primitiveIndex;
+				item.textures = slot.textures;
+				item.instances = std::move(slot.instances);
+				AddInstancedDrawable(std::move(item));
+				continue;
+			}
+			for (const InstanceTransform& instance : slot.instances) {
+				GPUSceneDrawItem item{};
+				item.mesh = &m_ownedMeshes[meshSlot];
+				item.material = material;
+				item.modelMatrix = instance.modelMatrix;
+				item.normalMatrix = instance.normalMatrix;
+				item.meshIndex = slot.meshIndex;
+				item.materialIndex = slot.materialIndex;
+				item.primitiveIndex = slot.primitiveIndex;
+				item.nodeIndex = instance.nodeIndex;
+				item.textures = slot.textures;
+				AddDrawable(item);
+			}
+		}
+	};
+
 	Mat4 identity = Mat4::Identity();
 	auto tSceneGraphStart = Clock::now();
 	if (hasSceneGraph) {
@@ -482,6 +723,7 @@ void GPUScene::Build(const GLTFAsset& asset, int sceneIndex) {
 		for (int nodeIndex : scene.rootNodes) {
 			addNode(addNode, nodeIndex, identity);
 		}
+		emitSlotInstances();
 	} else {
 		for (size_t meshIndex = 0; meshIndex < asset.meshes.size(); ++meshIndex) {
 			const PrimitiveMeshes& primMeshes = meshPrimitiveTable[meshIndex];
@@ -513,6 +755,25 @@ void GPUScene::Build(const GLTFAsset& asset, int sceneIndex) {
 	auto tSceneGraphEnd = Clock::now();
 	double sceneGraphMs = std::chrono::duration<double, std::milli>(tSceneGraphEnd - tSceneGraphStart).count();
 
+	// 纹理预处理：按渲染项实际引用的用途生成采样就绪纹理（sRGB 查表解码 / 预乘 / mip 链 / 可选 BCn 压缩）
+	double textureMs = 0.0;
+	if (options.prepareTextures) {
+		auto tTextureStart = Clock::now();
+		std::vector<TextureBindingArray> bindings;
+		bindings.reserve(m_items.size() + m_instancedItems.size());
+		for (const GPUSceneDrawItem& item : m_items) {
+			bindings.push_back(item.textures);
+		}
+		for (const GPUSceneInstancedDrawItem& item : m_instancedItems) {
+			bindings.push_back(item.textures);
+		}
+		PreparedTextureOptions textureOptions;
+		textureOptions.generateMipmaps = options.generateMipmaps;
+		textureOptions.compress = options.compressTextures;
+		m_preparedTextures.Build(m_ownedImages, m_ownedSamplers, bindings, textureOptions);
+		textureMs = std::chrono::duration<double, std::milli>(Clock::now() - tTextureStart).count();
+	}
+
 	size_t totalPrims = 0;
 	for (const auto& mesh : asset.meshes) {
 		totalPrims += mesh.primitives.size();
@@ -520,13 +781,32 @@ void GPUScene::Build(const GLTFAsset& asset, int sceneIndex) {
 	auto t1 = Clock::now();
 	double totalMs = std::chrono::duration<double, std::milli>(t1 - t0).count();
 
-	char buffer[512];
+	size_t packedVertexBytes = 0;
+	for (const Mesh& mesh : m_ownedMeshes) {
+		packedVertexBytes += mesh.GetVertexMemory();
+	}
+
+	char buffer[768];
 	std::snprintf(buffer, sizeof(buffer),
-		"GPUScene Build(ms): total=%.3f accessor=%.3f normals=%.3f(x%zu) tangents=%.3f(x%zu) sceneGraph=%.3f\n"
-		"  meshes=%zu primitives=%zu items=%zu images=%zu\n",
-		totalMs, totalAccessorReadMs, totalNormalsMs, normalGenCount, totalTangentsMs, tangentGenCount, sceneGraphMs,
-		asset.meshes.size(), totalPrims, m_items.size(), asset.images.size());
+		"GPUScene Build(ms): total=%.3f accessor=%.3f normals=%.3f(x%zu) tangents=%.3f(x%zu) pack=%.3f sceneGraph=%.3f textures=%.3f\n"
+		"  meshes=%zu primitives=%zu items=%zu instancedItems=%zu instances=%zu images=%zu vertexBytes=%zu->%zu preparedTextures=%zu(%zu bytes, mips %zu)\n"
+		"  lights: directional=%zu point=%zu spot=%zu\n",
+		totalMs, totalAccessorReadMs, totalNormalsMs, normalGenCount, totalTangentsMs, tangentGenCount, totalPackMs, sceneGraphMs, textureMs,
+		asset.meshes.size(), totalPrims, m_items.size(), m_instancedItems.size(), GetInstanceCount(), asset.images.size(),
+		sourceVertexBytes, packedVertexBytes, m_preparedTextures.GetTextureCount(), m_preparedTextures.GetMemoryBytes(),
+		m_preparedTextures.GetMipMemoryBytes(),
+		m_lights.GetDirectionalLights().size(), m_lights.GetPointLights().size(), m_lights.GetSpotLights().size());
 	SR_DEBUG_LOG(buffer);
+
+	if (options.optimizeMeshes && optimizeTotals.triangleCount > 0) {
+		const double invTris = 1.0 / static_cast<double>(optimizeTotals.triangleCount);
+		std::snprintf(buffer, sizeof(buffer),
+			"GPUScene MeshOpt(ms): optimize=%.3f tris=%zu clusters=%zu acmr=%.3f->%.3f overfetch=%.3f->%.3f\n",
+			totalOptimizeMs, optimizeTotals.triangleCount, optimizeTotals.clusterCount,
+			optimizeTotals.acmrBefore * invTris, optimizeTotals.acmrAfter * invTris,
+			optimizeTotals.overfetchBefore * invTris, optimizeTotals.overfetchAfter * invTris);
+		SR_DEBUG_LOG(buffer);
+	}
 }
 
 // ========== ResourcePool 集成 API ==========
@@ -545,12 +825,15 @@ size_t GPUScene::GetTotalMemoryUsage() const {
 	size_t total = 0;
 	// 统计传统存储（拥有权网格和图像）的内存
 	for (const auto& mesh : m_ownedMeshes) {
-		total += mesh.GetVertices().size() * sizeof(Vertex);
+		total += mesh.GetVertexMemory();
 		total += mesh.GetIndices().size() * sizeof(uint32_t);
 	}
 	for (const auto& image : m_ownedImages) {
 		total += image.pixels.size();
 	}
+	// 采样就绪纹理（含 mip 链，mip 开销见 GetPreparedTextures().GetMipMemoryBytes()）
+	total += m_preparedTextures.GetMemoryBytes();
+	total += GetInstanceCount() * sizeof(InstanceTransform);
 	// 累加资源池中的内存
 	total += m_meshPool.GetTotalTriangleCount() * 3 * sizeof(uint32_t);
 	return total;
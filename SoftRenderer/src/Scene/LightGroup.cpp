@@ -7,6 +7,8 @@ namespace SR {
  */
 void LightGroup::Clear() {
 	m_directionalLights.clear();
+	m_pointLights.clear();
+	m_spotLights.clear();
 }
 
 /**
@@ -23,4 +25,39 @@ const std::vector<DirectionalLight>& LightGroup::GetDirectionalLights() const {
 	return m_directionalLights;
 }
 
+/**
+ * @brief 向场景中追加一盏点光源
+ */
+void LightGroup::AddPointLight(const PointLight& light) {
+	m_pointLights.push_back(light);
+}
+
+/**
+ * @brief 返回场景中所有的点光源集合
+ */
+const std::vector<PointLight>& LightGroup::GetPointLights() const {
+	return m_pointLights;
+}
+
+/**
+ * @brief 向场景中追加一盏聚光灯
+ */
+void LightGroup::AddSpotLight(const SpotLight& light) {
+	m_spotLights.push_back(light);
+}
+
+/**
+ * @brief 返回场景中所有的聚光灯集合
+ */
+const std::vector<SpotLight>& LightGroup::GetSpotLights() const {
+	return m_spotLights;
+}
+
+/**
+ * @brief 判断光源组是否为空（不含任何类型的光源）
+ */
+bool LightGroup::IsEmpty() const {
+	return m_directionalLights.empty() && m_pointLights.empty() && m_spotLights.empty();
+}
+
 } // namespace SR
@@ -1,5 +1,6 @@
 #include "Scene/Mesh.h"
 
+#include <algorithm>
 #include <cmath>
 
 namespace SR {
@@ -10,6 +11,8 @@ namespace SR {
 void Mesh::SetData(std::vector<Vertex> vertices, std::vector<uint32_t> indices) {
     m_vertices = std::move(vertices);
     m_indices = std::move(indices);
+    m_packed = PackedVertexBuffer{};
+    m_isPacked = false;
 }
 
 /**
@@ -364,4 +367,160 @@ const std::vector<uint32_t>& Mesh::GetIndices() const {
     return m_indices;
 }
 
+/**
+ * @brief 加载期网格优化
+ *
+ * 依次执行 Tipsify 顶点缓存排序、overdraw 簇排序与顶点读取重映射，
+ * 并按重映射结果重排顶点数组，使顶点读取顺序与索引顺序一致。
+ */
+MeshOptimizeStats Mesh::Optimize(const MeshOptimizeOptions& options) {
+    MeshOptimizeStats stats;
+    const size_t vertexCount = m_vertices.size();
+    if (m_isPacked || vertexCount == 0 || m_indices.size() < 3) {
+        return stats;
+    }
+    for (uint32_t index : m_indices) {
+        if (index >= vertexCount) {
+            return stats;
+        }
+    }
+    m_indices.resize(m_indices.size() - m_indices.size() % 3);
+
+    const size_t stride = options.fetchStride != 0 ? options.fetchStride : sizeof(Vertex);
+    stats.triangleCount = m_indices.size() / 3;
+    stats.acmrBefore = MeshOptimizer::ComputeACMR(m_indices, vertexCount, options.cacheSize);
+    stats.overfetchBefore = MeshOptimizer::ComputeOverfetch(m_indices, vertexCount, stride);
+
+    std::vector<uint32_t> clusters;
+    MeshOptimizer::OptimizeVertexCache(m_indices, vertexCount, options.cacheSize, &clusters);
+
+    if (options.overdrawThreshold >= 1.0) {
+        std::vector<Vec3> positions(vertexCount);
+        for (size_t i = 0; i < vertexCount; ++i) {
+            positions[i] = m_vertices[i].position;
+        }
+        stats.clusterCount = MeshOptimizer::OptimizeOverdraw(m_indices, positions, clusters,
+                                                             options.cacheSize, options.overdrawThreshold);
+    } else {
+        stats.clusterCount = clusters.size();
+    }
+
+    std::vector<uint32_t> remap = MeshOptimizer::OptimizeVertexFetch(m_indices, vertexCount);
+    size_t usedCount = 0;
+    for (uint32_t target : remap) {
+        if (target != UINT32_MAX) {
+            ++usedCount;
+        }
+    }
+    std::vector<Vertex> reordered(usedCount);
+    for (size_t i = 0; i < vertexCount; ++i) {
+        if (remap[i] != UINT32_MAX) {
+            reordered[remap[i]] = m_vertices[i];
+        }
+    }
+    m_vertices.swap(reordered);
+
+    stats.acmrAfter = MeshOptimizer::ComputeACMR(m_indices, usedCount, options.cacheSize);
+    stats.overfetchAfter = MeshOptimizer::ComputeOverfetch(m_indices, usedCount, stride);
+    return stats;
+}
+
+/**
+ * @brief 生成打包顶点缓冲
+ *
+ * UNorm16 位置相对包围盒量化（每轴 65535 级），退化轴的缩放取 0 以保持精确值。
+ */
+void Mesh::Pack(VertexPositionFormat positionFormat, bool releaseSource) {
+    if (m_vertices.empty()) {
+        return;
+    }
+
+    PackedVertexBuffer packed;
+    packed.positionFormat = positionFormat;
+    const size_t count = m_vertices.size();
+
+    if (positionFormat == VertexPositionFormat::UNorm16) {
+        Vec3 minP = m_vertices[0].position;
+        Vec3 maxP = m_vertices[0].position;
+        for (const Vertex& v : m_vertices) {
+            minP = Vec3{std::min(minP.x, v.position.x), std::min(minP.y, v.position.y), std::min(minP.z, v.position.z)};
+            maxP = Vec3{std::max(maxP.x, v.position.x), std::max(maxP.y, v.position.y), std::max(maxP.z, v.position.z)};
+        }
+        Vec3 extent = maxP - minP;
+        packed.dequantOffset = minP;
+        packed.dequantScale = Vec3{extent.x / 65535.0, extent.y / 65535.0, extent.z / 65535.0};
+        auto quantize = [](double value, double minValue, double range) -> uint16_t {
+            if (range <= 0.0) {
+                return 0;
+            }
+            double t = std::clamp((value - minValue) / range, 0.0, 1.0);
+            return static_cast<uint16_t>(std::lround(t * 65535.0));
+        };
+        packed.positionsU16.resize(count * 4);
+        for (size_t i = 0; i < count; ++i) {
+            const Vec3& p = m_vertices[i].position;
+            uint16_t* q = &packed.positionsU16[i * 4];
+            q[0] = quantize(p.x, minP.x, extent.x);
+            q[1] = quantize(p.y, minP.y, extent.y);
+            q[2] = quantize(p.z, minP.z, extent.z);
+            q[3] = 0;
+        }
+    } else {
+        packed.positionsF32.resize(count * 3);
+        for (size_t i = 0; i < count; ++i) {
+            const Vec3& p = m_vertices[i].position;
+            packed.positionsF32[i * 3 + 0] = static_cast<float>(p.x);
+            packed.positionsF32[i * 3 + 1] = static_cast<float>(p.y);
+            packed.positionsF32[i * 3 + 2] = static_cast<float>(p.z);
+        }
+    }
+
+    packed.attributes.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        const Vertex& v = m_vertices[i];
+        PackedVertex& out = packed.attributes[i];
+        EncodeOctahedral(v.normal, out.normalOct);
+        EncodeOctahedral(v.tangent, out.tangentOct);
+        if (out.tangentOct[1] != kOctZeroSentinel) {
+            // tangentW 符号占用 tangentOct[1] 的最低位（精度损失 1 LSB）
+            int16_t ty = static_cast<int16_t>(out.tangentOct[1] & ~1);
+            out.tangentOct[1] = static_cast<int16_t>(ty | (v.tangentW < 0.0 ? 1 : 0));
+        }
+        out.texCoord[0] = FloatToHalf(static_cast<float>(v.texCoord.x));
+        out.texCoord[1] = FloatToHalf(static_cast<float>(v.texCoord.y));
+        out.texCoord1[0] = FloatToHalf(static_cast<float>(v.texCoord1.x));
+        out.texCoord1[1] = FloatToHalf(static_cast<float>(v.texCoord1.y));
+        out.color = PackRGBA8(v.color);
+    }
+
+    m_packed = std::move(packed);
+    m_isPacked = true;
+    if (releaseSource) {
+        std::vector<Vertex>().swap(m_vertices);
+    }
+}
+
+bool Mesh::IsPacked() const {
+    return m_isPacked;
+}
+
+const PackedVertexBuffer& Mesh::GetPackedVertices() const {
+    return m_packed;
+}
+
+size_t Mesh::GetVertexCount() const {
+    return m_isPacked ? m_packed.GetVertexCount() : m_vertices.size();
+}
+
+Vec3 Mesh::GetPosition(size_t index) const {
+    if (index < m_vertices.size()) {
+        return m_vertices[index].position;
+    }
+    return m_packed.DecodePosition(index);
+}
+
+size_t Mesh::GetVertexMemory() const {
+    return m_vertices.size() * sizeof(Vertex) + m_packed.GetMemoryBytes();
+}
+
 } // namespace SR
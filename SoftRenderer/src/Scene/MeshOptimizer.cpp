@@ -0,0 +1,329 @@
+#include "Scene/MeshOptimizer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace SR {
+
+namespace {
+
+/// overfetch 统计使用的缓存行大小与模拟的行缓存容量
+constexpr size_t kCacheLineBytes = 64;
+constexpr size_t kLineCacheSize = 16;
+
+/**
+ * @brief FIFO 顶点缓存模拟：以时间戳判断顶点是否仍在缓存中
+ */
+class FifoCacheSimulator {
+public:
+    FifoCacheSimulator(size_t vertexCount, int cacheSize)
+        : m_timestamps(vertexCount, 0u), m_cacheSize(static_cast<uint32_t>(std::max(cacheSize, 1))) {}
+
+    /** @brief 访问顶点，未命中返回 true */
+    bool Access(uint32_t v) {
+        if (m_timestamps[v] != 0u && m_time - m_timestamps[v] < m_cacheSize) {
+            return false;
+        }
+        m_timestamps[v] = m_time++;
+        return true;
+    }
+
+    /** @brief 清空缓存（不重新分配） */
+    void Reset() {
+        m_time += m_cacheSize + 1u;
+    }
+
+private:
+    std::vector<uint32_t> m_timestamps;
+    uint32_t m_cacheSize;
+    uint32_t m_time = 1u;
+};
+
+/// 三角形 → 法线（未归一化，长度为面积的 2 倍）
+Vec3 TriangleNormal(const std::vector<Vec3>& positions, const uint32_t* tri) {
+    const Vec3& p0 = positions[tri[0]];
+    const Vec3& p1 = positions[tri[1]];
+    const Vec3& p2 = positions[tri[2]];
+    return Vec3::Cross(p1 - p0, p2 - p0);
+}
+
+} // namespace
+
+namespace MeshOptimizer {
+
+double ComputeACMR(const std::vector<uint32_t>& indices, size_t vertexCount, int cacheSize) {
+    const size_t triCount = indices.size() / 3;
+    if (triCount == 0) {
+        return 0.0;
+    }
+    FifoCacheSimulator cache(vertexCount, cacheSize);
+    size_t misses = 0;
+    for (size_t i = 0; i < triCount * 3; ++i) {
+        misses += cache.Access(indices[i]) ? 1u : 0u;
+    }
+    return static_cast<double>(misses) / static_cast<double>(triCount);
+}
+
+double ComputeOverfetch(const std::vector<uint32_t>& indices, size_t vertexCount, size_t vertexStride) {
+    if (vertexCount == 0 || vertexStride == 0 || indices.empty()) {
+        return 0.0;
+    }
+    size_t lines[kLineCacheSize];
+    std::fill(std::begin(lines), std::end(lines), std::numeric_limits<size_t>::max());
+    size_t head = 0;
+    size_t loadedLines = 0;
+
+    for (uint32_t v : indices) {
+        const size_t firstLine = (static_cast<size_t>(v) * vertexStride) / kCacheLineBytes;
+        const size_t lastLine = (static_cast<size_t>(v) * vertexStride + vertexStride - 1) / kCacheLineBytes;
+        for (size_t line = firstLine; line <= lastLine; ++line) {
+            if (std::find(std::begin(lines), std::end(lines), line) != std::end(lines)) {
+                continue;
+            }
+            lines[head] = line;
+            head = (head + 1) % kLineCacheSize;
+            ++loadedLines;
+        }
+    }
+    return static_cast<double>(loadedLines * kCacheLineBytes) /
+           static_cast<double>(vertexCount * vertexStride);
+}
+
+/**
+ * Tipsify：从当前扇心顶点发出其全部未输出的三角形，再在刚进入缓存的顶点中
+ * 挑选「仍在缓存且剩余三角形不会把自己挤出缓存」的最老顶点作为下一个扇心；
+ * 找不到时回退到死端栈或线性扫描，此处即为一个硬簇边界。
+ */
+void OptimizeVertexCache(std::vector<uint32_t>& indices, size_t vertexCount, int cacheSize,
+                         std::vector<uint32_t>* outClusters) {
+    const size_t triCount = indices.size() / 3;
+    if (outClusters) {
+        outClusters->assign(1, 0u);
+    }
+    if (triCount == 0 || vertexCount == 0) {
+        return;
+    }
+    const int64_t k = std::max(cacheSize, 3);
+
+    // 顶点 → 三角形邻接（CSR）
+    std::vector<uint32_t> liveCount(vertexCount, 0u);
+    for (size_t i = 0; i < triCount * 3; ++i) {
+        liveCount[indices[i]]++;
+    }
+    std::vector<uint32_t> offsets(vertexCount + 1, 0u);
+    for (size_t v = 0; v < vertexCount; ++v) {
+        offsets[v + 1] = offsets[v] + liveCount[v];
+    }
+    std::vector<uint32_t> adjacency(offsets[vertexCount]);
+    {
+        std::vector<uint32_t> cursor(offsets.begin(), offsets.end() - 1);
+        for (size_t t = 0; t < triCount; ++t) {
+            for (int c = 0; c < 3; ++c) {
+                adjacency[cursor[indices[t * 3 + c]]++] = static_cast<uint32_t>(t);
+            }
+        }
+    }
+
+    std::vector<int64_t> cacheTime(vertexCount, 0);
+    std::vector<uint8_t> emitted(triCount, 0u);
+    std::vector<uint32_t> deadEnd;
+    std::vector<uint32_t> candidates;
+    std::vector<uint32_t> output;
+    output.reserve(triCount * 3);
+    deadEnd.reserve(triCount * 3);
+
+    int64_t time = k + 1;
+    size_t scanCursor = 1;
+    int64_t fan = 0;
+
+    while (fan >= 0) {
+        const uint32_t f = static_cast<uint32_t>(fan);
+        candidates.clear();
+        for (uint32_t a = offsets[f]; a < offsets[f + 1]; ++a) {
+            const uint32_t t = adjacency[a];
+            if (emitted[t]) {
+                continue;
+            }
+            emitted[t] = 1u;
+            for (int c = 0; c < 3; ++c) {
+                const uint32_t v = indices[t * 3 + c];
+                output.push_back(v);
+                deadEnd.push_back(v);
+                candidates.push_back(v);
+                liveCount[v]--;
+                if (time - cacheTime[v] > k) {
+                    cacheTime[v] = time++;
+                }
+            }
+        }
+
+        // 在候选中选择下一个扇心
+        int64_t best = -1;
+        int64_t bestPriority = -1;
+        for (uint32_t v : candidates) {
+            if (liveCount[v] == 0u) {
+                continue;
+            }
+            int64_t priority = 0;
+            if (time - cacheTime[v] + 2 * static_cast<int64_t>(liveCount[v]) <= k) {
+                priority = time - cacheTime[v];
+            }
+            if (priority > bestPriority) {
+                bestPriority = priority;
+                best = v;
+            }
+        }
+
+        if (best < 0) {
+            // 死端：优先回溯最近使用过的顶点，其次线性扫描
+            while (!deadEnd.empty() && best < 0) {
+                const uint32_t d = deadEnd.back();
+                deadEnd.pop_back();
+                if (liveCount[d] > 0u) {
+                    best = d;
+                }
+            }
+            while (best < 0 && scanCursor < vertexCount) {
+                if (liveCount[scanCursor] > 0u) {
+                    best = static_cast<int64_t>(scanCursor);
+                }
+                ++scanCursor;
+            }
+            const uint32_t boundary = static_cast<uint32_t>(output.size() / 3);
+            if (best >= 0 && outClusters && boundary > outClusters->back()) {
+                outClusters->push_back(boundary);
+            }
+        }
+        fan = best;
+    }
+
+    indices.swap(output);
+}
+
+/**
+ * 簇细分（软边界）：在每个硬簇内用全新缓存重新模拟，当子簇的 ACMR 已不高于
+ * threshold × 整簇 ACMR 时切分，保证重排后整体缓存效率损失受控。
+ * 簇排序：按 dot(簇质心 - 网格质心, 簇平均法线) 降序，外层朝外的表面先绘制，
+ * 被遮挡的内部表面更容易被 Early-Z 拒绝。
+ */
+size_t OptimizeOverdraw(std::vector<uint32_t>& indices, const std::vector<Vec3>& positions,
+                        const std::vector<uint32_t>& clusters, int cacheSize, double threshold) {
+    const size_t triCount = indices.size() / 3;
+    if (triCount == 0 || positions.empty()) {
+        return 0;
+    }
+
+    // 1. 在硬簇内生成软边界
+    std::vector<uint32_t> boundaries;
+    boundaries.reserve(clusters.size() * 2);
+    FifoCacheSimulator cache(positions.size(), cacheSize);
+    for (size_t c = 0; c < clusters.size(); ++c) {
+        const size_t begin = clusters[c];
+        const size_t end = (c + 1 < clusters.size()) ? clusters[c + 1] : triCount;
+        if (begin >= end) {
+            continue;
+        }
+
+        cache.Reset();
+        size_t clusterMisses = 0;
+        for (size_t i = begin * 3; i < end * 3; ++i) {
+            clusterMisses += cache.Access(indices[i]) ? 1u : 0u;
+        }
+        const double clusterAcmr = static_cast<double>(clusterMisses) / static_cast<double>(end - begin);
+
+        boundaries.push_back(static_cast<uint32_t>(begin));
+        cache.Reset();
+        size_t localMisses = 0;
+        size_t localStart = begin;
+        for (size_t t = begin; t < end; ++t) {
+            for (int k = 0; k < 3; ++k) {
+                localMisses += cache.Access(indices[t * 3 + k]) ? 1u : 0u;
+            }
+            const size_t localCount = t + 1 - localStart;
+            const double localAcmr = static_cast<double>(localMisses) / static_cast<double>(localCount);
+            if (t + 1 < end && localAcmr <= clusterAcmr * threshold) {
+                boundaries.push_back(static_cast<uint32_t>(t + 1));
+                localStart = t + 1;
+                localMisses = 0;
+                cache.Reset();
+            }
+        }
+    }
+    if (boundaries.size() <= 1) {
+        return boundaries.size();
+    }
+
+    // 2. 簇质心（面积加权）与平均法线
+    struct ClusterInfo {
+        uint32_t begin;
+        uint32_t end;
+        Vec3 centroid;
+        Vec3 normal;
+        double area;
+        double sortKey;
+    };
+    std::vector<ClusterInfo> infos(boundaries.size());
+    Vec3 meshCentroid{0.0, 0.0, 0.0};
+    double meshArea = 0.0;
+    for (size_t c = 0; c < boundaries.size(); ++c) {
+        ClusterInfo& info = infos[c];
+        info.begin = boundaries[c];
+        info.end = (c + 1 < boundaries.size()) ? boundaries[c + 1] : static_cast<uint32_t>(triCount);
+        info.centroid = Vec3{0.0, 0.0, 0.0};
+        info.normal = Vec3{0.0, 0.0, 0.0};
+        info.area = 0.0;
+        for (uint32_t t = info.begin; t < info.end; ++t) {
+            const uint32_t* tri = indices.data() + static_cast<size_t>(t) * 3;
+            const Vec3 n = TriangleNormal(positions, tri);
+            const double area = n.Length() * 0.5;
+            const Vec3 center = (positions[tri[0]] + positions[tri[1]] + positions[tri[2]]) * (1.0 / 3.0);
+            info.centroid = info.centroid + center * area;
+            info.normal = info.normal + n;
+            info.area += area;
+        }
+        meshCentroid = meshCentroid + info.centroid;
+        meshArea += info.area;
+        if (info.area > 0.0) {
+            info.centroid = info.centroid * (1.0 / info.area);
+        }
+    }
+    if (meshArea > 0.0) {
+        meshCentroid = meshCentroid * (1.0 / meshArea);
+    }
+    for (ClusterInfo& info : infos) {
+        const double len = info.normal.Length();
+        info.sortKey = (len > 0.0) ? Vec3::Dot(info.centroid - meshCentroid, info.normal) / len : 0.0;
+    }
+
+    // 3. 稳定排序后重写索引
+    std::stable_sort(infos.begin(), infos.end(), [](const ClusterInfo& a, const ClusterInfo& b) {
+        return a.sortKey > b.sortKey;
+    });
+    std::vector<uint32_t> sorted;
+    sorted.reserve(indices.size());
+    for (const ClusterInfo& info : infos) {
+        sorted.insert(sorted.end(),
+                      indices.begin() + static_cast<std::ptrdiff_t>(info.begin) * 3,
+                      indices.begin() + static_cast<std::ptrdiff_t>(info.end) * 3);
+    }
+    indices.swap(sorted);
+    return infos.size();
+}
+
+std::vector<uint32_t> OptimizeVertexFetch(std::vector<uint32_t>& indices, size_t vertexCount) {
+    constexpr uint32_t kUnused = std::numeric_limits<uint32_t>::max();
+    std::vector<uint32_t> remap(vertexCount, kUnused);
+    uint32_t next = 0;
+    for (uint32_t& index : indices) {
+        if (remap[index] == kUnused) {
+            remap[index] = next++;
+        }
+        index = remap[index];
+    }
+    return remap;
+}
+
+} // namespace MeshOptimizer
+
+} // namespace SR
@@ -0,0 +1,583 @@
+#include "Scene/PreparedTexture.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+
+#include "Asset/GLTFTypes.h"
+#include "Utils/BlockCompression.h"
+#include "Utils/TextureSampler.h"
+
+namespace SR {
+
+namespace {
+
+/// @brief sRGB 8-bit → 16 位线性查找表（由双精度表就近舍入）
+const std::array<uint16_t, 256>& GetSRGB8ToLinear16Table() {
+    static const std::array<uint16_t, 256> table = [] {
+        std::array<uint16_t, 256> t{};
+        const std::array<double, 256>& linear = GetSRGB8ToLinearTable();
+        for (size_t i = 0; i < t.size(); ++i) {
+            t[i] = static_cast<uint16_t>(std::lround(linear[i] * 65535.0));
+        }
+        return t;
+    }();
+    return table;
+}
+
+/// @brief 压缩纹理的解码块缓存标识分配器（0 保留给未压缩纹理）
+std::atomic<uint64_t> g_nextBlockCacheId{1};
+
+/// @brief 块内行主序位置（y * 4 + x）→ 块内 Morton 序号，与 PreparedTextureLevel::TexelIndex 一致
+constexpr std::array<uint8_t, 16> kRowMajorToMorton = [] {
+    std::array<uint8_t, 16> t{};
+    for (int y = 0; y < 4; ++y) {
+        for (int x = 0; x < 4; ++x) {
+            t[static_cast<size_t>(y * 4 + x)] =
+                static_cast<uint8_t>((x & 1) | ((y & 1) << 1) | ((x & 2) << 1) | ((y & 2) << 2));
+        }
+    }
+    return t;
+}();
+
+/// @brief [0, 1] 浮点量化为 8-bit
+uint8_t QuantizeUnorm8(float v) {
+    return static_cast<uint8_t>(std::lround(std::clamp(v, 0.0f, 1.0f) * 255.0f));
+}
+
+/// @brief 线性值编码为 sRGB 8-bit（仅在压缩时调用，不在采样路径上）
+uint8_t EncodeSRGB8(float linear) {
+    const double v = std::clamp(static_cast<double>(linear), 0.0, 1.0);
+    const double srgb = (v <= 0.0031308) ? v * 12.92 : 1.055 * std::pow(v, 1.0 / 2.4) - 0.055;
+    return static_cast<uint8_t>(std::lround(srgb * 255.0));
+}
+
+/// @brief 盒式滤波的一个抽头（源纹素序号与面积权重）
+struct BoxTap {
+    int index;
+    float weight;
+};
+
+/**
+ * @brief 计算一维面积加权盒式滤波抽头
+ *
+ * 目标纹素 i 覆盖源区间 [i*s, (i+1)*s)，s = srcSize / dstSize；偶数尺寸即 2x2 平均，
+ * 奇数尺寸时边界纹素按覆盖比例分配权重，不丢弃最后一行/列。
+ * @param tapBegin 输出每个目标纹素的首抽头序号（长度 dstSize + 1）
+ */
+std::vector<BoxTap> BuildBoxTaps(int srcSize, int dstSize, std::vector<size_t>& tapBegin) {
+    std::vector<BoxTap> taps;
+    tapBegin.assign(static_cast<size_t>(dstSize) + 1, 0);
+    const double scale = static_cast<double>(srcSize) / static_cast<double>(dstSize);
+    for (int i = 0; i < dstSize; ++i) {
+        tapBegin[static_cast<size_t>(i)] = taps.size();
+        const double start = i * scale;
+        const double end = (i + 1) * scale;
+        const int first = static_cast<int>(std::floor(start));
+        const int last = std::min(srcSize - 1, static_cast<int>(std::ceil(end)) - 1);
+        for (int s = first; s <= last; ++s) {
+            const double overlap = std::min(end, s + 1.0) - std::max(start, static_cast<double>(s));
+            if (overlap > 0.0) {
+                taps.push_back({s, static_cast<float>(overlap / scale)});
+            }
+        }
+    }
+    tapBegin[static_cast<size_t>(dstSize)] = taps.size();
+    return taps;
+}
+
+/**
+ * @brief 将行主序纹素（每纹素 4 分量）按块布局追加到纹素数组末尾
+ *
+ * 要求 dst 当前长度恰为 level.offset 个纹素；块补齐位置复制最近的边缘纹素。
+ */
+template <typename T>
+void AppendTiled(std::vector<T>& dst, const T* rowMajor, const PreparedTextureLevel& level) {
+    dst.resize((level.offset + level.GetStoredTexelCount()) * 4);
+    const int paddedW = level.blocksX * kTextureBlockSize;
+    const int paddedH = level.blocksY * kTextureBlockSize;
+    for (int y = 0; y < paddedH; ++y) {
+        const size_t srcRow = static_cast<size_t>(std::min(y, level.height - 1)) * static_cast<size_t>(level.width);
+        for (int x = 0; x < paddedW; ++x) {
+            const T* src = rowMajor + (srcRow + static_cast<size_t>(std::min(x, level.width - 1))) * 4;
+            T* out = dst.data() + level.TexelIndex(x, y) * 4;
+            out[0] = src[0]; out[1] = src[1]; out[2] = src[2]; out[3] = src[3];
+        }
+    }
+}
+
+/// @brief 将基础级由行主序重排为块布局
+void TileBaseLevel(PreparedTexture& texture) {
+    const PreparedTextureLevel& level = texture.levels.front();
+    auto tile = [&](auto& texels) {
+        auto rowMajor = std::move(texels);
+        texels.clear();
+        AppendTiled(texels, rowMajor.data(), level);
+    };
+    switch (texture.format) {
+    case PreparedTextureFormat::RGBA8Unorm: tile(texture.texels8); break;
+    case PreparedTextureFormat::RGBA16Linear: tile(texture.texels16); break;
+    default: tile(texture.texelsF32); break;
+    }
+}
+
+/// @brief 将指定级别读取为行主序 float RGBA（与存储格式同一空间：线性，预乘格式保持预乘）
+std::vector<float> LoadLevel(const PreparedTexture& texture, const PreparedTextureLevel& level) {
+    std::vector<float> values(static_cast<size_t>(level.width) * static_cast<size_t>(level.height) * 4);
+    float* out = values.data();
+    for (int y = 0; y < level.height; ++y) {
+        for (int x = 0; x < level.width; ++x, out += 4) {
+            const size_t base = level.TexelIndex(x, y) * 4;
+            for (size_t c = 0; c < 4; ++c) {
+                switch (texture.format) {
+                case PreparedTextureFormat::RGBA8Unorm:
+                    out[c] = texture.texels8[base + c] * (1.0f / 255.0f);
+                    break;
+                case PreparedTextureFormat::RGBA16Linear:
+                    out[c] = texture.texels16[base + c] * (1.0f / 65535.0f);
+                    break;
+                default:
+                    out[c] = texture.texelsF32[base + c];
+                    break;
+                }
+            }
+        }
+    }
+    return values;
+}
+
+/// @brief 将行主序 float RGBA 按纹理格式量化，并按块布局追加为新级别
+void AppendLevel(PreparedTexture& texture, const PreparedTextureLevel& level, const std::vector<float>& values) {
+    switch (texture.format) {
+    case PreparedTextureFormat::RGBA8Unorm: {
+        std::vector<uint8_t> quantized(values.size());
+        for (size_t i = 0; i < values.size(); ++i) {
+            quantized[i] = static_cast<uint8_t>(std::lround(std::clamp(values[i], 0.0f, 1.0f) * 255.0f));
+        }
+        AppendTiled(texture.texels8, quantized.data(), level);
+        break;
+    }
+    case PreparedTextureFormat::RGBA16Linear: {
+        std::vector<uint16_t> quantized(values.size());
+        for (size_t i = 0; i < values.size(); ++i) {
+            quantized[i] = static_cast<uint16_t>(std::lround(std::clamp(values[i], 0.0f, 1.0f) * 65535.0f));
+        }
+        AppendTiled(texture.texels16, quantized.data(), level);
+        break;
+    }
+    default:
+        AppendTiled(texture.texelsF32, values.data(), level);
+        break;
+    }
+}
+
+/// @brief 面积加权盒式降采样（先水平后垂直，可分离）
+std::vector<float> DownsampleBox(const std::vector<float>& src, int srcW, int srcH, int dstW, int dstH) {
+    std::vector<size_t> xBegin;
+    std::vector<size_t> yBegin;
+    const std::vector<BoxTap> xTaps = BuildBoxTaps(srcW, dstW, xBegin);
+    const std::vector<BoxTap> yTaps = BuildBoxTaps(srcH, dstH, yBegin);
+
+    std::vector<float> horizontal(static_cast<size_t>(dstW) * static_cast<size_t>(srcH) * 4, 0.0f);
+    for (int y = 0; y < srcH; ++y) {
+        const float* srcRow = src.data() + static_cast<size_t>(y) * static_cast<size_t>(srcW) * 4;
+        float* dstRow = horizontal.data() + static_cast<size_t>(y) * static_cast<size_t>(dstW) * 4;
+        for (int x = 0; x < dstW; ++x) {
+            for (size_t t = xBegin[static_cast<size_t>(x)]; t < xBegin[static_cast<size_t>(x) + 1]; ++t) {
+                const float* p = srcRow + static_cast<size_t>(xTaps[t].index) * 4;
+                for (int c = 0; c < 4; ++c) {
+                    dstRow[x * 4 + c] += p[c] * xTaps[t].weight;
+                }
+            }
+        }
+    }
+
+    std::vector<float> result(static_cast<size_t>(dstW) * static_cast<size_t>(dstH) * 4, 0.0f);
+    const size_t rowFloats = static_cast<size_t>(dstW) * 4;
+    for (int y = 0; y < dstH; ++y) {
+        float* dstRow = result.data() + static_cast<size_t>(y) * rowFloats;
+        for (size_t t = yBegin[static_cast<size_t>(y)]; t < yBegin[static_cast<size_t>(y) + 1]; ++t) {
+            const float* srcRow = horizontal.data() + static_cast<size_t>(yTaps[t].index) * rowFloats;
+            for (size_t i = 0; i < rowFloats; ++i) {
+                dstRow[i] += srcRow[i] * yTaps[t].weight;
+            }
+        }
+    }
+    return result;
+}
+
+/// @brief 图像是否包含非不透明纹素
+bool HasTranslucentTexels(const GLTFImage& image, size_t texelCount) {
+    for (size_t i = 0; i < texelCount; ++i) {
+        if (image.pixels[i * 4 + 3] != 255) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief 将一个级别按 4x4 块编码并写入 texture.blocks
+ * @param values 行主序 float RGBA（LoadLevel 的输出）
+ * @param srgb   颜色是否以 sRGB 8-bit 编码（BC1/BC3）
+ */
+void CompressLevel(PreparedTexture& texture, const PreparedTextureLevel& level,
+                   const std::vector<float>& values, bool premultiplied, bool srgb) {
+    const size_t blockBytes = texture.GetBlockBytes();
+    for (int by = 0; by < level.blocksY; ++by) {
+        for (int bx = 0; bx < level.blocksX; ++bx) {
+            // 收集块内纹素（行主序），越界位置复制最近的边缘纹素
+            uint8_t rgba[64];
+            for (int y = 0; y < 4; ++y) {
+                const int sy = std::min(by * 4 + y, level.height - 1);
+                for (int x = 0; x < 4; ++x) {
+                    const int sx = std::min(bx * 4 + x, level.width - 1);
+                    const float* src = values.data() +
+                        (static_cast<size_t>(sy) * static_cast<size_t>(level.width) + static_cast<size_t>(sx)) * 4;
+                    const float invA = (premultiplied && src[3] > 1e-6f) ? 1.0f / src[3] : 1.0f;
+                    uint8_t* out = rgba + (y * 4 + x) * 4;
+                    for (int c = 0; c < 3; ++c) {
+                        out[c] = srgb ? EncodeSRGB8(src[c] * invA) : QuantizeUnorm8(src[c] * invA);
+                    }
+                    out[3] = QuantizeUnorm8(src[3]);
+                }
+            }
+
+            const size_t blockIndex = level.offset / 16 +
+                static_cast<size_t>(by) * static_cast<size_t>(level.blocksX) + static_cast<size_t>(bx);
+            uint8_t* out = texture.blocks.data() + blockIndex * blockBytes;
+            switch (texture.format) {
+            case PreparedTextureFormat::BC3:
+                EncodeBC3Block(rgba, out);
+                break;
+            case PreparedTextureFormat::BC4: {
+                uint8_t red[16];
+                for (int i = 0; i < 16; ++i) {
+                    red[i] = rgba[i * 4];
+                }
+                EncodeBC4Block(red, out);
+                break;
+            }
+            case PreparedTextureFormat::BC5: {
+                uint8_t red[16], green[16];
+                for (int i = 0; i < 16; ++i) {
+                    red[i] = rgba[i * 4 + 0];
+                    green[i] = rgba[i * 4 + 1];
+                }
+                EncodeBC5Block(red, green, out);
+                break;
+            }
+            default:
+                EncodeBC1Block(rgba, out);
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * @brief 按数据贴图的引用插槽选择压缩格式
+ * @param slotMask 以 1 << TextureSlot 记录的数据用途
+ */
+PreparedTextureFormat ChooseDataBlockFormat(uint32_t slotMask) {
+    constexpr uint32_t kNormal = 1u << static_cast<uint32_t>(TextureSlot::Normal);
+    constexpr uint32_t kRedOnly = (1u << static_cast<uint32_t>(TextureSlot::Occlusion)) |
+                                  (1u << static_cast<uint32_t>(TextureSlot::Transmission));
+    if (slotMask == kNormal) {
+        return PreparedTextureFormat::BC5;
+    }
+    if ((slotMask & ~kRedOnly) == 0) {
+        return PreparedTextureFormat::BC4;
+    }
+    return PreparedTextureFormat::BC1;
+}
+
+/// @brief 按用途转换基础级纹素
+PreparedTexture PrepareBaseLevel(const GLTFImage& image, TextureUsage usage) {
+    PreparedTexture texture;
+    texture.width = image.width;
+    texture.height = image.height;
+
+    const size_t texelCount = static_cast<size_t>(std::max(0, image.width)) * static_cast<size_t>(std::max(0, image.height));
+    if (texelCount == 0 || image.pixels.size() < texelCount * 4) {
+        // 像素数据不完整：退化为 1x1 白色，与 SampleImage* 越界时返回的默认值一致
+        texture.width = 1;
+        texture.height = 1;
+        texture.format = PreparedTextureFormat::RGBA8Unorm;
+        texture.texels8.assign(4, 255);
+        return texture;
+    }
+
+    const bool decodeSrgb = (usage == TextureUsage::Color) || image.isSRGB;
+    if (!decodeSrgb) {
+        texture.format = PreparedTextureFormat::RGBA8Unorm;
+        texture.texels8.assign(image.pixels.begin(), image.pixels.begin() + static_cast<std::ptrdiff_t>(texelCount * 4));
+        return texture;
+    }
+
+    if (!HasTranslucentTexels(image, texelCount)) {
+        // 不透明颜色贴图：16 位线性足以保留 8 位 sRGB 的暗部精度
+        const std::array<uint16_t, 256>& lut = GetSRGB8ToLinear16Table();
+        texture.format = PreparedTextureFormat::RGBA16Linear;
+        texture.texels16.resize(texelCount * 4);
+        for (size_t i = 0; i < texelCount * 4; i += 4) {
+            texture.texels16[i + 0] = lut[image.pixels[i + 0]];
+            texture.texels16[i + 1] = lut[image.pixels[i + 1]];
+            texture.texels16[i + 2] = lut[image.pixels[i + 2]];
+            texture.texels16[i + 3] = static_cast<uint16_t>(image.pixels[i + 3] * 257u);
+        }
+        return texture;
+    }
+
+    // 半透明颜色贴图：预乘后过滤，避免透明纹素的颜色渗入边缘
+    const std::array<double, 256>& lut = GetSRGB8ToLinearTable();
+    texture.format = PreparedTextureFormat::RGBA32FPremultiplied;
+    texture.texelsF32.resize(texelCount * 4);
+    for (size_t i = 0; i < texelCount * 4; i += 4) {
+        const double a = static_cast<double>(image.pixels[i + 3]) / 255.0;
+        texture.texelsF32[i + 0] = static_cast<float>(lut[image.pixels[i + 0]] * a);
+        texture.texelsF32[i + 1] = static_cast<float>(lut[image.pixels[i + 1]] * a);
+        texture.texelsF32[i + 2] = static_cast<float>(lut[image.pixels[i + 2]] * a);
+        texture.texelsF32[i + 3] = static_cast<float>(a);
+    }
+    return texture;
+}
+
+} // namespace
+
+PreparedTexture PrepareTexture(const GLTFImage& image, TextureUsage usage, bool generateMipmaps) {
+    PreparedTexture texture = PrepareBaseLevel(image, usage);
+    texture.levels.push_back(PreparedTextureLevel::Make(texture.width, texture.height, 0));
+    TileBaseLevel(texture);
+    if (generateMipmaps) {
+        GenerateMipChain(texture);
+    }
+    return texture;
+}
+
+void GenerateMipChain(PreparedTexture& texture) {
+    if (texture.levels.size() != 1) {
+        return;
+    }
+    PreparedTextureLevel level = texture.levels.front();
+    // 始终从上一级的 float 结果降采样，量化误差不随级数累积
+    std::vector<float> current = LoadLevel(texture, level);
+    while (level.width > 1 || level.height > 1) {
+        const PreparedTextureLevel next = PreparedTextureLevel::Make(
+            std::max(1, level.width / 2), std::max(1, level.height / 2), level.offset + level.GetStoredTexelCount());
+        current = DownsampleBox(current, level.width, level.height, next.width, next.height);
+        AppendLevel(texture, next, current);
+        texture.levels.push_back(next);
+        level = next;
+    }
+}
+
+void CompressTexture(PreparedTexture& texture, PreparedTextureFormat format) {
+    if (!IsBlockCompressed(format) || IsBlockCompressed(texture.format) || texture.levels.empty()) {
+        return;
+    }
+    // 由 sRGB 图像解码而来的颜色以 sRGB 编码，8-bit 量化误差按感知均匀分布
+    const bool premultiplied = texture.format == PreparedTextureFormat::RGBA32FPremultiplied;
+    const bool srgb = texture.format != PreparedTextureFormat::RGBA8Unorm &&
+                      (format == PreparedTextureFormat::BC1 || format == PreparedTextureFormat::BC3);
+
+    std::vector<std::vector<float>> levelValues;
+    levelValues.reserve(texture.levels.size());
+    for (const PreparedTextureLevel& level : texture.levels) {
+        levelValues.push_back(LoadLevel(texture, level));
+    }
+    const PreparedTextureLevel& last = texture.levels.back();
+
+    texture.format = format;
+    texture.srgbBlocks = srgb;
+    texture.blockCacheId = g_nextBlockCacheId.fetch_add(1, std::memory_order_relaxed);
+    texture.blocks.assign(texture.GetStorageBytes(last.offset + last.GetStoredTexelCount()), 0);
+    for (size_t i = 0; i < texture.levels.size(); ++i) {
+        CompressLevel(texture, texture.levels[i], levelValues[i], premultiplied, srgb);
+    }
+    texture.texels8 = {};
+    texture.texels16 = {};
+    texture.texelsF32 = {};
+}
+
+void DecodePreparedBlock(const PreparedTexture& texture, size_t blockIndex, float out[64]) {
+    const uint8_t* block = texture.blocks.data() + blockIndex * texture.GetBlockBytes();
+    uint8_t rgba[64];
+    switch (texture.format) {
+    case PreparedTextureFormat::BC3:
+        DecodeBC3Block(block, rgba);
+        break;
+    case PreparedTextureFormat::BC4: {
+        uint8_t red[16];
+        DecodeBC4Block(block, red);
+        for (int i = 0; i < 16; ++i) {
+            rgba[i * 4 + 0] = rgba[i * 4 + 1] = rgba[i * 4 + 2] = red[i];
+            rgba[i * 4 + 3] = 255;
+        }
+        break;
+    }
+    case PreparedTextureFormat::BC5: {
+        uint8_t red[16], green[16];
+        DecodeBC5Block(block, red, green);
+        for (int i = 0; i < 16; ++i) {
+            float* dst = out + kRowMajorToMorton[static_cast<size_t>(i)] * 4;
+            const float nx = red[i] * (2.0f / 255.0f) - 1.0f;
+            const float ny = green[i] * (2.0f / 255.0f) - 1.0f;
+            const float nz = std::sqrt(std::max(0.0f, 1.0f - nx * nx - ny * ny));
+            dst[0] = red[i] * (1.0f / 255.0f);
+            dst[1] = green[i] * (1.0f / 255.0f);
+            dst[2] = nz * 0.5f + 0.5f;
+            dst[3] = 1.0f;
+        }
+        return;
+    }
+    default:
+        DecodeBC1Block(block, rgba);
+        break;
+    }
+
+    const std::array<double, 256>& srgbLut = GetSRGB8ToLinearTable();
+    const bool premultiply = texture.format == PreparedTextureFormat::BC3;
+    for (int i = 0; i < 16; ++i) {
+        const uint8_t* src = rgba + i * 4;
+        float* dst = out + kRowMajorToMorton[static_cast<size_t>(i)] * 4;
+        const float a = src[3] * (1.0f / 255.0f);
+        const float scale = premultiply ? a : 1.0f;
+        for (int c = 0; c < 3; ++c) {
+            const float v = texture.srgbBlocks ? static_cast<float>(srgbLut[src[c]]) : src[c] * (1.0f / 255.0f);
+            dst[c] = v * scale;
+        }
+        dst[3] = a;
+    }
+}
+
+void PreparedTextureSet::Build(const std::vector<GLTFImage>& images, const std::vector<GLTFSampler>& samplers,
+                               const std::vector<TextureBindingArray>& bindings, const PreparedTextureOptions& options) {
+    Clear();
+    m_colorIndex.assign(images.size(), -1);
+    m_dataIndex.assign(images.size(), -1);
+
+    // 与 FragmentShader 的采样约定一致：基础色与自发光按 sRGB 采样，其余插槽为线性数据
+    std::vector<uint8_t> usedAsColor(images.size(), 0);
+    std::vector<uint32_t> dataSlotMask(images.size(), 0);
+    std::vector<uint8_t> needsMips(images.size(), 0);
+    for (const TextureBindingArray& slots : bindings) {
+        for (size_t slot = 0; slot < slots.size(); ++slot) {
+            const int imageIndex = slots[slot].imageIndex;
+            if (imageIndex < 0 || static_cast<size_t>(imageIndex) >= images.size()) {
+                continue;
+            }
+            if (IsColorTextureSlot(slot)) {
+                usedAsColor[static_cast<size_t>(imageIndex)] = 1;
+            } else {
+                dataSlotMask[static_cast<size_t>(imageIndex)] |= 1u << slot;
+            }
+
+            const int samplerIndex = slots[slot].samplerIndex;
+            if (options.generateMipmaps && samplerIndex >= 0 && static_cast<size_t>(samplerIndex) < samplers.size() &&
+                UsesMipmapFilter(&samplers[static_cast<size_t>(samplerIndex)])) {
+                needsMips[static_cast<size_t>(imageIndex)] = 1;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < images.size(); ++i) {
+        const bool mips = needsMips[i] != 0;
+        if (usedAsColor[i]) {
+            m_colorIndex[i] = static_cast<int32_t>(m_textures.size());
+            m_textures.push_back(PrepareTexture(images[i], TextureUsage::Color, mips));
+            if (options.compress) {
+                PreparedTexture& texture = m_textures.back();
+                CompressTexture(texture, texture.format == PreparedTextureFormat::RGBA32FPremultiplied
+                                             ? PreparedTextureFormat::BC3 : PreparedTextureFormat::BC1);
+            }
+        }
+        if (dataSlotMask[i] != 0) {
+            if (images[i].isSRGB && m_colorIndex[i] >= 0) {
+                // sRGB 图像两种用途都解码，复用同一份纹理
+                m_dataIndex[i] = m_colorIndex[i];
+                continue;
+            }
+            m_dataIndex[i] = static_cast<int32_t>(m_textures.size());
+            m_textures.push_back(PrepareTexture(images[i], TextureUsage::Data, mips));
+            if (options.compress) {
+                PreparedTexture& texture = m_textures.back();
+                // 含半透明纹素的 sRGB 数据贴图仍需保留 alpha
+                CompressTexture(texture, texture.format == PreparedTextureFormat::RGBA32FPremultiplied
+                                             ? PreparedTextureFormat::BC3 : ChooseDataBlockFormat(dataSlotMask[i]));
+            }
+        }
+    }
+
+    // 为每个被引用的（纹理, 采样器）组合预解析描述符；m_textures 此后不再增长，指针保持有效
+    for (const TextureBindingArray& slots : bindings) {
+        for (size_t slot = 0; slot < slots.size(); ++slot) {
+            const int imageIndex = slots[slot].imageIndex;
+            if (imageIndex < 0 || static_cast<size_t>(imageIndex) >= images.size()) {
+                continue;
+            }
+            const int32_t textureIndex = IsColorTextureSlot(slot) ? m_colorIndex[static_cast<size_t>(imageIndex)]
+                                                                  : m_dataIndex[static_cast<size_t>(imageIndex)];
+            const int samplerIndex = slots[slot].samplerIndex;
+            const bool validSampler = samplerIndex >= 0 && static_cast<size_t>(samplerIndex) < samplers.size();
+            const uint64_t key = MakeDescriptorKey(textureIndex, validSampler ? samplerIndex : -1);
+            if (m_descriptorIndex.count(key) != 0) {
+                continue;
+            }
+            m_descriptorIndex.emplace(key, static_cast<int32_t>(m_descriptors.size()));
+            m_descriptors.push_back(MakeTextureDescriptor(m_textures[static_cast<size_t>(textureIndex)],
+                validSampler ? &samplers[static_cast<size_t>(samplerIndex)] : nullptr));
+        }
+    }
+}
+
+const TextureDescriptor* PreparedTextureSet::FindDescriptor(const TextureBinding& binding, bool srgb) const {
+    const int imageIndex = binding.imageIndex;
+    if (imageIndex < 0 || static_cast<size_t>(imageIndex) >= m_colorIndex.size()) {
+        return nullptr;
+    }
+    const int32_t textureIndex = srgb ? m_colorIndex[static_cast<size_t>(imageIndex)]
+                                      : m_dataIndex[static_cast<size_t>(imageIndex)];
+    if (textureIndex < 0) {
+        return nullptr;
+    }
+    auto it = m_descriptorIndex.find(MakeDescriptorKey(textureIndex, binding.samplerIndex));
+    if (it == m_descriptorIndex.end()) {
+        // 越界的采样器索引在构建时按默认采样器登记
+        it = m_descriptorIndex.find(MakeDescriptorKey(textureIndex, -1));
+    }
+    return it != m_descriptorIndex.end() ? &m_descriptors[static_cast<size_t>(it->second)] : nullptr;
+}
+
+void PreparedTextureSet::ResolveDescriptors(const TextureBindingArray& bindings, TextureDescriptorArray& out) const {
+    for (size_t slot = 0; slot < bindings.size(); ++slot) {
+        out[slot] = (bindings[slot].imageIndex >= 0) ? FindDescriptor(bindings[slot], IsColorTextureSlot(slot)) : nullptr;
+    }
+}
+
+void PreparedTextureSet::Clear() {
+    m_textures.clear();
+    m_descriptors.clear();
+    m_descriptorIndex.clear();
+    m_colorIndex.clear();
+    m_dataIndex.clear();
+}
+
+size_t PreparedTextureSet::GetMemoryBytes() const {
+    size_t total = 0;
+    for (const PreparedTexture& texture : m_textures) {
+        total += texture.GetMemoryBytes();
+    }
+    return total;
+}
+
+size_t PreparedTextureSet::GetMipMemoryBytes() const {
+    size_t total = 0;
+    for (const PreparedTexture& texture : m_textures) {
+        total += texture.GetMipMemoryBytes();
+    }
+    return total;
+}
+
+} // namespace SR
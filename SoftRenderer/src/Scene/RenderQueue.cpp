@@ -1,14 +1,124 @@
 #include "Scene/RenderQueue.h"
 
+#include <array>
+#include <cmath>
+#include <cstring>
 #include <utility>
 
 namespace SR {
 
+namespace {
+
+constexpr uint64_t kIdMask = (1ull << 20) - 1ull;     ///< 材质/网格编号位宽 20
+constexpr uint64_t kDepthMask = (1ull << 22) - 1ull;  ///< 深度桶位宽 22
+
+/**
+ * @brief 距离平方 → 22 位深度桶
+ *
+ * 非负 float 的位模式与数值单调一致，取符号位之后的高 22 位（8 位指数 + 14 位尾数），
+ * 相对精度约 1e-4，无需开方或对数。
+ */
+uint64_t DepthBucket(double distanceSquared) {
+    float d = static_cast<float>(distanceSquared);
+    if (!(d >= 0.0f)) {
+        d = 0.0f;
+    }
+    uint32_t bits = 0;
+    std::memcpy(&bits, &d, sizeof(bits));
+    return static_cast<uint64_t>(bits >> 9) & kDepthMask;
+}
+
+uint64_t ComputeSortKey(const DrawItem& item, const RenderQueueRecord& record, const Vec3& cameraPos) {
+    const GLTFAlphaMode alphaMode = item.material ? item.material->alphaMode : GLTFAlphaMode::Opaque;
+    const uint64_t alpha = static_cast<uint64_t>(alphaMode) & 3ull;
+    const uint64_t material = record.materialId & kIdMask;
+    const uint64_t mesh = record.meshId & kIdMask;
+
+    // 深度取模型矩阵平移到相机的距离平方（实例化项取首个实例）
+    const Vec3 pos{item.modelMatrix.m[3][0], item.modelMatrix.m[3][1], item.modelMatrix.m[3][2]};
+    const Vec3 d = pos - cameraPos;
+    const uint64_t depth = DepthBucket(d.x * d.x + d.y * d.y + d.z * d.z);
+
+    if (alphaMode == GLTFAlphaMode::Blend) {
+        // 半透明：从远到近，其次按材质/网格合批
+        return (alpha << 62) | ((kDepthMask - depth) << 40) | (material << 20) | mesh;
+    }
+    // 不透明/Mask：按材质/网格合批，组内从近到远以提高 Early-Z 命中
+    return (alpha << 62) | (material << 42) | (mesh << 22) | depth;
+}
+
+/**
+ * @brief LSD 基数排序（8 位一趟，稳定；全部键在某一字节相同时跳过该趟）
+ */
+void RadixSortEntries(std::vector<RenderQueueEntry>& entries, std::vector<RenderQueueEntry>& scratch) {
+    const size_t count = entries.size();
+    if (count < 2) {
+        return;
+    }
+    scratch.resize(count);
+
+    std::array<std::array<uint32_t, 256>, 8> histograms{};
+    for (const RenderQueueEntry& e : entries) {
+        for (int pass = 0; pass < 8; ++pass) {
+            histograms[pass][(e.sortKey >> (pass * 8)) & 0xFFu]++;
+        }
+    }
+
+    RenderQueueEntry* src = entries.data();
+    RenderQueueEntry* dst = scratch.data();
+    for (int pass = 0; pass < 8; ++pass) {
+        std::array<uint32_t, 256>& histogram = histograms[pass];
+        const uint64_t firstDigit = (src[0].sortKey >> (pass * 8)) & 0xFFu;
+        if (histogram[firstDigit] == count) {
+            continue;
+        }
+
+        uint32_t offset = 0;
+        for (uint32_t& bucket : histogram) {
+            const uint32_t n = bucket;
+            bucket = offset;
+            offset += n;
+        }
+        for (size_t i = 0; i < count; ++i) {
+            const uint64_t digit = (src[i].sortKey >> (pass * 8)) & 0xFFu;
+            dst[histogram[digit]++] = src[i];
+        }
+        std::swap(src, dst);
+    }
+
+    if (src != entries.data()) {
+        entries.swap(scratch);
+    }
+}
+
+} // namespace
+
 /**
  * @brief 使用移动语义设置渲染队列中的绘制项
  */
 void RenderQueue::SetItems(std::vector<DrawItem>&& items) {
     m_items = std::move(items);
+    m_materialIds.clear();
+    m_meshIds.clear();
+    m_records.clear();
+    m_records.reserve(m_items.size());
+    for (const DrawItem& item : m_items) {
+        m_records.push_back(MakeRecord(item));
+    }
+    m_orderDirty = true;
+    ++m_itemsVersion;
+    m_snapshotSource = nullptr;
+}
+
+/**
+ * @brief 追加单个绘制项，已有条目的记录与编号保持不变
+ */
+void RenderQueue::AddItem(const DrawItem& item) {
+    m_items.push_back(item);
+    m_records.push_back(MakeRecord(item));
+    m_orderDirty = true;
+    ++m_itemsVersion;
+    m_snapshotSource = nullptr;
 }
 
 /**
@@ -16,6 +126,14 @@ void RenderQueue::SetItems(std::vector<DrawItem>&& items) {
  */
 void RenderQueue::Clear() {
     m_items.clear();
+    m_records.clear();
+    m_keys.clear();
+    m_sorted.clear();
+    m_materialIds.clear();
+    m_meshIds.clear();
+    m_orderDirty = true;
+    ++m_itemsVersion;
+    m_snapshotSource = nullptr;
 }
 
 /**
@@ -25,4 +143,81 @@ const std::vector<DrawItem>& RenderQueue::GetItems() const {
     return m_items;
 }
 
+/**
+ * @brief 重新计算排序键；仅当条目集合或任一键变化时执行基数排序
+ */
+bool RenderQueue::UpdateSortKeys(const Vec3& cameraPos) {
+    const size_t count = m_items.size();
+    bool changed = m_orderDirty || m_keys.size() != count;
+    m_keys.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        const uint64_t key = ComputeSortKey(m_items[i], m_records[i], cameraPos);
+        if (key != m_keys[i]) {
+            m_keys[i] = key;
+            changed = true;
+        }
+    }
+    if (!changed) {
+        return false;
+    }
+
+    m_sorted.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        m_sorted[i] = RenderQueueEntry{m_keys[i], static_cast<uint32_t>(i)};
+    }
+    RadixSortEntries(m_sorted, m_sortScratch);
+    m_orderDirty = false;
+    ++m_sortCount;
+    return true;
+}
+
+/**
+ * @brief 获取排序后的条目
+ */
+const std::vector<RenderQueueEntry>& RenderQueue::GetSortedEntries() const {
+    return m_sorted;
+}
+
+/**
+ * @brief 按排序位置获取绘制项
+ */
+const DrawItem& RenderQueue::GetSortedItem(size_t sortedIndex) const {
+    return m_items[m_sorted[sortedIndex].itemIndex];
+}
+
+/**
+ * @brief 获取累计排序次数
+ */
+uint64_t RenderQueue::GetSortCount() const {
+    return m_sortCount;
+}
+
+/**
+ * @brief 复制来源队列中后端读取的部分；绘制项与排序结果分别按修改计数跳过未变化的内容
+ */
+bool RenderQueue::SnapshotFrom(const RenderQueue& source) {
+    const bool itemsChanged = m_snapshotSource != &source || m_snapshotItemsVersion != source.m_itemsVersion;
+    if (itemsChanged) {
+        m_items = source.m_items;
+    }
+    if (itemsChanged || m_snapshotSortCount != source.m_sortCount) {
+        m_sorted = source.m_sorted;
+    }
+    m_sortCount = source.m_sortCount;
+    m_snapshotSource = &source;
+    m_snapshotItemsVersion = source.m_itemsVersion;
+    m_snapshotSortCount = source.m_sortCount;
+    return itemsChanged;
+}
+
+/**
+ * @brief 为绘制项分配稠密材质/网格编号
+ */
+RenderQueueRecord RenderQueue::MakeRecord(const DrawItem& item) {
+    RenderQueueRecord record;
+    record.materialId = m_materialIds.try_emplace(item.material, static_cast<uint32_t>(m_materialIds.size())).first->second;
+    record.meshId = m_meshIds.try_emplace(item.mesh, static_cast<uint32_t>(m_meshIds.size())).first->second;
+    return record;
+}
+
 } // namespace SR
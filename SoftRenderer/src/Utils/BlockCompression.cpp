@@ -0,0 +1,261 @@
+#include "Utils/BlockCompression.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace SR {
+
+namespace {
+
+/// @brief 8-bit RGB 量化为 RGB565
+uint16_t PackRGB565(double r, double g, double b) {
+    const int r5 = static_cast<int>(std::lround(std::clamp(r, 0.0, 255.0) * 31.0 / 255.0));
+    const int g6 = static_cast<int>(std::lround(std::clamp(g, 0.0, 255.0) * 63.0 / 255.0));
+    const int b5 = static_cast<int>(std::lround(std::clamp(b, 0.0, 255.0) * 31.0 / 255.0));
+    return static_cast<uint16_t>((r5 << 11) | (g6 << 5) | b5);
+}
+
+/// @brief RGB565 展开为 8-bit RGB（位复制，与硬件解码一致）
+void UnpackRGB565(uint16_t c, int out[3]) {
+    const int r5 = (c >> 11) & 31;
+    const int g6 = (c >> 5) & 63;
+    const int b5 = c & 31;
+    out[0] = (r5 << 3) | (r5 >> 2);
+    out[1] = (g6 << 2) | (g6 >> 4);
+    out[2] = (b5 << 3) | (b5 >> 2);
+}
+
+/// @brief BC1 调色板（c0 > c1 为 4 色模式，否则为 3 色 + 透明黑）
+void BuildBC1Palette(uint16_t c0, uint16_t c1, int palette[4][4]) {
+    int p0[3], p1[3];
+    UnpackRGB565(c0, p0);
+    UnpackRGB565(c1, p1);
+    for (int i = 0; i < 3; ++i) {
+        palette[0][i] = p0[i];
+        palette[1][i] = p1[i];
+        if (c0 > c1) {
+            palette[2][i] = (2 * p0[i] + p1[i]) / 3;
+            palette[3][i] = (p0[i] + 2 * p1[i]) / 3;
+        } else {
+            palette[2][i] = (p0[i] + p1[i]) / 2;
+            palette[3][i] = 0;
+        }
+    }
+    palette[0][3] = palette[1][3] = palette[2][3] = 255;
+    palette[3][3] = (c0 > c1) ? 255 : 0;
+}
+
+/// @brief 编码 BC1 颜色部分（始终使用 4 色模式）
+void EncodeBC1Color(const uint8_t rgba[64], uint8_t out[8]) {
+    // 颜色主轴：协方差矩阵幂迭代
+    double mean[3] = {0.0, 0.0, 0.0};
+    for (int i = 0; i < 16; ++i) {
+        for (int c = 0; c < 3; ++c) {
+            mean[c] += rgba[i * 4 + c];
+        }
+    }
+    for (double& m : mean) {
+        m /= 16.0;
+    }
+    double cov[6] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0}; // rr rg rb gg gb bb
+    for (int i = 0; i < 16; ++i) {
+        const double r = rgba[i * 4 + 0] - mean[0];
+        const double g = rgba[i * 4 + 1] - mean[1];
+        const double b = rgba[i * 4 + 2] - mean[2];
+        cov[0] += r * r; cov[1] += r * g; cov[2] += r * b;
+        cov[3] += g * g; cov[4] += g * b; cov[5] += b * b;
+    }
+    double axis[3] = {1.0, 1.0, 1.0};
+    for (int iter = 0; iter < 8; ++iter) {
+        const double x = cov[0] * axis[0] + cov[1] * axis[1] + cov[2] * axis[2];
+        const double y = cov[1] * axis[0] + cov[3] * axis[1] + cov[4] * axis[2];
+        const double z = cov[2] * axis[0] + cov[4] * axis[1] + cov[5] * axis[2];
+        const double len = std::max({std::abs(x), std::abs(y), std::abs(z)});
+        if (len < 1e-9) {
+            break;
+        }
+        axis[0] = x / len; axis[1] = y / len; axis[2] = z / len;
+    }
+    const double axisLenSq = axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2];
+
+    // 沿主轴投影求端点范围
+    double minT = 0.0, maxT = 0.0;
+    for (int i = 0; i < 16; ++i) {
+        const double t = ((rgba[i * 4 + 0] - mean[0]) * axis[0] +
+                          (rgba[i * 4 + 1] - mean[1]) * axis[1] +
+                          (rgba[i * 4 + 2] - mean[2]) * axis[2]) / axisLenSq;
+        minT = std::min(minT, t);
+        maxT = std::max(maxT, t);
+    }
+
+    // 候选端点：原始范围与向内收缩 1/16 的范围（后者降低渐变块的端点量化误差），取误差较小者
+    uint16_t c0 = 0, c1 = 0;
+    uint32_t indices = 0;
+    int bestError = -1;
+    for (int candidate = 0; candidate < 2; ++candidate) {
+        const double inset = candidate == 0 ? 0.0 : (maxT - minT) / 16.0;
+        uint16_t e0 = PackRGB565(mean[0] + axis[0] * (maxT - inset), mean[1] + axis[1] * (maxT - inset),
+                                 mean[2] + axis[2] * (maxT - inset));
+        uint16_t e1 = PackRGB565(mean[0] + axis[0] * (minT + inset), mean[1] + axis[1] * (minT + inset),
+                                 mean[2] + axis[2] * (minT + inset));
+        if (e0 < e1) {
+            std::swap(e0, e1);
+        }
+        int palette[4][4];
+        BuildBC1Palette(e0, e1, palette);
+        // 两端点相同时为 3 色模式，只使用索引 0，避免落到透明黑
+        const int paletteSize = (e0 > e1) ? 4 : 1;
+        uint32_t candidateIndices = 0;
+        int error = 0;
+        for (int i = 0; i < 16; ++i) {
+            int best = 0;
+            int bestDist = 1 << 30;
+            for (int p = 0; p < paletteSize; ++p) {
+                const int dr = rgba[i * 4 + 0] - palette[p][0];
+                const int dg = rgba[i * 4 + 1] - palette[p][1];
+                const int db = rgba[i * 4 + 2] - palette[p][2];
+                const int dist = dr * dr + dg * dg + db * db;
+                if (dist < bestDist) {
+                    bestDist = dist;
+                    best = p;
+                }
+            }
+            candidateIndices |= static_cast<uint32_t>(best) << (2 * i);
+            error += bestDist;
+        }
+        if (bestError < 0 || error < bestError) {
+            bestError = error;
+            c0 = e0;
+            c1 = e1;
+            indices = candidateIndices;
+        }
+    }
+
+    out[0] = static_cast<uint8_t>(c0 & 0xFF);
+    out[1] = static_cast<uint8_t>(c0 >> 8);
+    out[2] = static_cast<uint8_t>(c1 & 0xFF);
+    out[3] = static_cast<uint8_t>(c1 >> 8);
+    for (int i = 0; i < 4; ++i) {
+        out[4 + i] = static_cast<uint8_t>(indices >> (8 * i));
+    }
+}
+
+/// @brief BC4 调色板（a0 > a1 为 8 值模式，否则为 6 值 + 0/255）
+void BuildBC4Palette(int a0, int a1, int palette[8]) {
+    palette[0] = a0;
+    palette[1] = a1;
+    if (a0 > a1) {
+        for (int i = 1; i <= 6; ++i) {
+            palette[i + 1] = ((7 - i) * a0 + i * a1) / 7;
+        }
+    } else {
+        for (int i = 1; i <= 4; ++i) {
+            palette[i + 1] = ((5 - i) * a0 + i * a1) / 5;
+        }
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+}
+
+} // namespace
+
+void EncodeBC4Block(const uint8_t values[16], uint8_t out[8]) {
+    const int maxV = *std::max_element(values, values + 16);
+    const int minV = *std::min_element(values, values + 16);
+    out[0] = static_cast<uint8_t>(maxV);
+    out[1] = static_cast<uint8_t>(minV);
+
+    uint64_t indices = 0;
+    if (maxV > minV) {
+        // 8 值模式：沿 a0→a1 均分 7 段，段号 j 对应索引 0 / 2..7 / 1
+        const double scale = 7.0 / static_cast<double>(maxV - minV);
+        for (int i = 0; i < 16; ++i) {
+            const int j = static_cast<int>(std::lround((maxV - values[i]) * scale));
+            const int index = (j == 0) ? 0 : (j == 7) ? 1 : j + 1;
+            indices |= static_cast<uint64_t>(index) << (3 * i);
+        }
+    }
+    for (int i = 0; i < 6; ++i) {
+        out[2 + i] = static_cast<uint8_t>(indices >> (8 * i));
+    }
+}
+
+void EncodeBC1Block(const uint8_t rgba[64], uint8_t out[8]) {
+    EncodeBC1Color(rgba, out);
+}
+
+void EncodeBC3Block(const uint8_t rgba[64], uint8_t out[16]) {
+    uint8_t alpha[16];
+    for (int i = 0; i < 16; ++i) {
+        alpha[i] = rgba[i * 4 + 3];
+    }
+    EncodeBC4Block(alpha, out);
+    EncodeBC1Color(rgba, out + 8);
+}
+
+void EncodeBC5Block(const uint8_t red[16], const uint8_t green[16], uint8_t out[16]) {
+    EncodeBC4Block(red, out);
+    EncodeBC4Block(green, out + 8);
+}
+
+void DecodeBC1Block(const uint8_t* block, uint8_t rgba[64]) {
+    const uint16_t c0 = static_cast<uint16_t>(block[0] | (block[1] << 8));
+    const uint16_t c1 = static_cast<uint16_t>(block[2] | (block[3] << 8));
+    int palette[4][4];
+    BuildBC1Palette(c0, c1, palette);
+    const uint32_t indices = static_cast<uint32_t>(block[4]) | (static_cast<uint32_t>(block[5]) << 8) |
+                             (static_cast<uint32_t>(block[6]) << 16) | (static_cast<uint32_t>(block[7]) << 24);
+    for (int i = 0; i < 16; ++i) {
+        const int* p = palette[(indices >> (2 * i)) & 3u];
+        rgba[i * 4 + 0] = static_cast<uint8_t>(p[0]);
+        rgba[i * 4 + 1] = static_cast<uint8_t>(p[1]);
+        rgba[i * 4 + 2] = static_cast<uint8_t>(p[2]);
+        rgba[i * 4 + 3] = static_cast<uint8_t>(p[3]);
+    }
+}
+
+void DecodeBC4Block(const uint8_t* block, uint8_t values[16]) {
+    int palette[8];
+    BuildBC4Palette(block[0], block[1], palette);
+    uint64_t indices = 0;
+    for (int i = 0; i < 6; ++i) {
+        indices |= static_cast<uint64_t>(block[2 + i]) << (8 * i);
+    }
+    for (int i = 0; i < 16; ++i) {
+        values[i] = static_cast<uint8_t>(palette[(indices >> (3 * i)) & 7u]);
+    }
+}
+
+void DecodeBC3Block(const uint8_t* block, uint8_t rgba[64]) {
+    uint8_t alpha[16];
+    DecodeBC4Block(block, alpha);
+    // BC3 的颜色块总是按 4 色模式解码
+    const uint16_t c0 = static_cast<uint16_t>(block[8] | (block[9] << 8));
+    const uint16_t c1 = static_cast<uint16_t>(block[10] | (block[11] << 8));
+    int p0[3], p1[3];
+    UnpackRGB565(c0, p0);
+    UnpackRGB565(c1, p1);
+    int palette[4][3];
+    for (int c = 0; c < 3; ++c) {
+        palette[0][c] = p0[c];
+        palette[1][c] = p1[c];
+        palette[2][c] = (2 * p0[c] + p1[c]) / 3;
+        palette[3][c] = (p0[c] + 2 * p1[c]) / 3;
+    }
+    const uint32_t indices = static_cast<uint32_t>(block[12]) | (static_cast<uint32_t>(block[13]) << 8) |
+                             (static_cast<uint32_t>(block[14]) << 16) | (static_cast<uint32_t>(block[15]) << 24);
+    for (int i = 0; i < 16; ++i) {
+        const int* p = palette[(indices >> (2 * i)) & 3u];
+        rgba[i * 4 + 0] = static_cast<uint8_t>(p[0]);
+        rgba[i * 4 + 1] = static_cast<uint8_t>(p[1]);
+        rgba[i * 4 + 2] = static_cast<uint8_t>(p[2]);
+        rgba[i * 4 + 3] = alpha[i];
+    }
+}
+
+void DecodeBC5Block(const uint8_t* block, uint8_t red[16], uint8_t green[16]) {
+    DecodeBC4Block(block, red);
+    DecodeBC4Block(block + 8, green);
+}
+
+} // namespace SR